@@ -37,6 +37,7 @@ typedef uint8_t gui_align_t;
 
 #include "gui_obj.h"
 #include "gui_debug.h"
+#include "gui_frame.h"
 #include "gui_utils.h"
 #include "gui_graphics.h"
 
@@ -25,12 +25,25 @@
 #include "salloc.h"
 #include "resources.h"
 
+#define DBG_LINES 8   /*number of debug lines, at the bottom of the screen*/
+#define DEBUG_STR 50
+
 /**
  * local variables
  */
 static bool bDispMem = false;
 static timer_t tmDisp = 0;
 static uint32_t cycleCnt = 0;
+static gui_damage_stat_st lastStat;  /*redraw statistics of the last cycle which redrew something*/
+static uint32_t regWritten = 0, regSaved = 0;         /*LCD register counters at the end of the last task*/
+static uint32_t lastRegWritten = 0, lastRegSaved = 0; /*LCD register writes done & saved during the last cycle which wrote registers*/
+static uint32_t lcCyclesSaved = 0;                    /*lut cache saved cycles at the last display*/
+
+
+/**
+ * local functions
+ */
+static void DispHist(uint8_t line, const char *name, const uint32_t *arHist);
 
 
 /**
@@ -40,9 +53,33 @@ static uint32_t cycleCnt = 0;
  * @return none
  */
 void GUI_DBG_DispMemUsage(bool bDisp) {
+
+  rect_st rec;
+  gui_font_t font;
+  lut_cache_stat_st lcStat;
+
+  /*on hide, the page is recomposited below the debug lines*/
+  if(bDispMem && bDisp == false) {
+    font = GetCurrentFont();
+    SetFont(G_FONT_DEFAULT);
+    rec.x = 0;
+    rec.w = LCD_GetWidth();
+    rec.h = DBG_LINES * P2D_GetTextHeight();
+    rec.y = LCD_GetHeight() - rec.h;
+    SetFont(font);
+    GUI_Invalidate(&rec);
+  }
+
   bDispMem = bDisp;
   cycleCnt = 0;
   tmDisp = 0;
+  gmemset(&lastStat, 0, sizeof(lastStat));
+  lastRegWritten = lastRegSaved = 0;
+  LCD_GetRegStat(&regWritten, &regSaved);
+  P2D_LutCacheGetStat(&lcStat);
+  lcCyclesSaved = lcStat.cyclesSaved;
+  P2D_ListResetStat();
+  GUI_FrameResetStat();
 }
 
 
@@ -55,11 +92,27 @@ void GUI_DBG_DispMemUsage(bool bDisp) {
 void GUI_DBG_Task(void) {
 
   gui_font_t font;
-  #define DEBUG_STR 50
   char str[DEBUG_STR];
+  gui_damage_stat_st stat;
+  uint32_t written, saved, hitRate, lcSaved, cnt;
+  glyph_cache_stat_st gcStat;
+  lut_cache_stat_st lcStat;
+  dlist_stat_st dlStat;
+  gui_frame_stat_st frStat;
 
   if(bDispMem) {
 
+    /*keep the statistics of the last cycle which redrew something*/
+    GUI_GetDamageStat(&stat);
+    if(stat.pxInvalidated > 0) lastStat = stat;
+
+    /*register writes of this cycle (the debug display of the previous call excluded)*/
+    LCD_GetRegStat(&written, &saved);
+    if(written != regWritten) {
+      lastRegWritten = written - regWritten;
+      lastRegSaved = saved - regSaved;
+    }
+
     /*display every 1s*/
     if(IsTimerElapsed(tmDisp)) {
 
@@ -75,6 +128,35 @@ void GUI_DBG_Task(void) {
 
       /*display info*/
       P2D_PutText(0, LCD_GetHeight() - P2D_GetTextHeight(), str);
+      snprintf(str, DEBUG_STR, "INV:%06lu PUSH:%06lu RC:%d", (unsigned long) lastStat.pxInvalidated, (unsigned long) lastStat.pxPushed, lastStat.rectCnt);
+      P2D_PutText(0, LCD_GetHeight() - 2 * P2D_GetTextHeight(), str);
+      P2D_GlyphCacheGetStat(&gcStat);
+      hitRate = (gcStat.hit + gcStat.miss > 0)? gcStat.hit * 100 / (gcStat.hit + gcStat.miss): 0;
+      snprintf(str, DEBUG_STR, "REG:%05lu SAVED:%05lu GC:%03lu%%", (unsigned long) lastRegWritten, (unsigned long) lastRegSaved, (unsigned long) hitRate);
+      P2D_PutText(0, LCD_GetHeight() - 3 * P2D_GetTextHeight(), str);
+      P2D_LutCacheGetStat(&lcStat);
+      hitRate = (lcStat.hit + lcStat.miss > 0)? lcStat.hit * 100 / (lcStat.hit + lcStat.miss): 0;
+      lcSaved = (cycleCnt > 0) ? (lcStat.cyclesSaved - lcCyclesSaved) / cycleCnt : 0;  /*core timer count saved per GUI cycle*/
+      snprintf(str, DEBUG_STR, "LUT:%03lu%% SAVED:%06lu/CY", (unsigned long) hitRate, (unsigned long) lcSaved);
+      P2D_PutText(0, LCD_GetHeight() - 4 * P2D_GetTextHeight(), str);
+      lcCyclesSaved = lcStat.cyclesSaved;
+
+      /*display list: commands recorded, culled, and state changes & window restores saved, per GUI cycle*/
+      P2D_ListGetStat(&dlStat);
+      cnt = (cycleCnt > 0) ? cycleCnt : 1;
+      snprintf(str, DEBUG_STR, "DL:%04lu CULL:%03lu ST:%03lu WND:%03lu", (unsigned long) (dlStat.recorded / cnt), (unsigned long) (dlStat.culled / cnt),
+               (unsigned long) (dlStat.stateSaved / cnt), (unsigned long) (dlStat.wndSaved / cnt));
+      P2D_PutText(0, LCD_GetHeight() - 5 * P2D_GetTextHeight(), str);
+      P2D_ListResetStat();
+
+      /*frames of the last second: synchronized on the frame marker, over budget; frame time & interval histograms*/
+      GUI_FrameGetStat(&frStat);
+      snprintf(str, DEBUG_STR, "FPS:%02lu SY:%02lu OV:%02lu MAX:%06luus", (unsigned long) frStat.frameCnt, (unsigned long) frStat.syncCnt,
+               (unsigned long) frStat.overBudget, (unsigned long) frStat.timeMax);
+      P2D_PutText(0, LCD_GetHeight() - 6 * P2D_GetTextHeight(), str);
+      DispHist(7, "FT", frStat.arTime);
+      DispHist(8, "IV", frStat.arInterval);
+      GUI_FrameResetStat();
 
       /*restore current user font*/
       SetFont(font);
@@ -83,5 +165,27 @@ void GUI_DBG_Task(void) {
       cycleCnt = 0;
     }
     cycleCnt++;
+    LCD_GetRegStat(&regWritten, &regSaved);
+  }
+}
+
+
+/**
+ * @function DispHist
+ * @brief display a frame histogram on a debug line (one count per bin, bin width: a quarter of the target frame period)
+ * @param uint8_t line: debug line, from the bottom of the screen (1 to DBG_LINES)
+ * @param const char *name: histogram name
+ * @param const uint32_t *arHist: histogram, GUI_FRAME_HIST_BINS bins
+ * @return none
+ */
+static void DispHist(uint8_t line, const char *name, const uint32_t *arHist) {
+
+  char str[DEBUG_STR];
+  uint8_t ii, len;
+
+  len = (uint8_t) snprintf(str, DEBUG_STR, "%s:", name);
+  for(ii = 0; ii < GUI_FRAME_HIST_BINS && len < DEBUG_STR; ii++) {
+    len += (uint8_t) snprintf(&str[len], DEBUG_STR - len, "%02lu ", (unsigned long) (arHist[ii] < 99 ? arHist[ii] : 99));
   }
+  P2D_PutText(0, LCD_GetHeight() - line * P2D_GetTextHeight(), str);
 }
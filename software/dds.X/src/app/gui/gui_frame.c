@@ -0,0 +1,201 @@
+/**
+ * @file gui_frame.c
+ * @brief GUI frame pacing: GUI_RefreshObjects() scheduling on the display refresh (frame marker)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-12
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gui_frame.h"
+#include "hw_config.h"
+#include "ticks.h"
+
+#define FRAME_CYCLES_PER_S  (SYS_CLK / 2)   /*core timer runs at SYS_CLK / 2*/
+#define FRAME_SYNC_DIV      4               /*screen damage of 1/FRAME_SYNC_DIV of the screen or more: large redraw*/
+#define FRAME_SYNC_WND      4               /*a synchronized frame starts within 1/FRAME_SYNC_WND of the panel period after the marker*/
+#define FRAME_MARK_TIMEOUT  4               /*no marker for FRAME_MARK_TIMEOUT panel periods: frame marker lost*/
+#define FRAME_SYNC_WAIT_MAX 3               /*a large redraw waits for a marker FRAME_SYNC_WAIT_MAX target periods at most*/
+
+
+/**
+ * local variables
+ */
+static uint8_t budget = GUI_FRAME_BUDGET_DEF;
+static uint32_t periodCycles = FRAME_CYCLES_PER_S / GUI_FRAME_FPS_DEF;  /*target frame period*/
+static uint32_t holdCycles = FRAME_CYCLES_PER_S / GUI_FRAME_FPS_DEF;    /*min delay between two frame starts: period, or budget delay*/
+static uint32_t tStart = 0;                                             /*core timer, at the start of the last frame*/
+static bool bStarted = false;                                           /*at least one frame drawn*/
+static uint32_t markUsed = 0;                                           /*marker count, at the last synchronized frame*/
+static gui_frame_stat_st frameStat;
+
+
+/**
+ * local functions
+ */
+static bool FrameSyncReady(uint32_t now);
+static void FrameHist(uint32_t *arHist, uint32_t cycles);
+
+
+/**
+ * @function GUI_FrameSetRate
+ * @brief set the target frame rate & the frame time budget; statistics are reset
+ * @param uint8_t fps: target frame rate, in frames per second (1 to GUI_FRAME_FPS_MAX)
+ * @param uint8_t budget: part of the frame period which may be spent drawing, in % (GUI_FRAME_BUDGET_MIN to GUI_FRAME_BUDGET_MAX);
+ *        a longer frame delays the next one, so that the main loop tasks keep the rest of the CPU time
+ * @return int8_t: 0 success, -1 error (parameter out of range; nothing changed)
+ */
+int8_t GUI_FrameSetRate(uint8_t fps, uint8_t _budget) {
+
+  int8_t res = -1;
+
+  if(fps > 0 && fps <= GUI_FRAME_FPS_MAX && _budget >= GUI_FRAME_BUDGET_MIN && _budget <= GUI_FRAME_BUDGET_MAX) {
+    budget = _budget;
+    periodCycles = FRAME_CYCLES_PER_S / fps;
+    holdCycles = periodCycles;
+    GUI_FrameResetStat();
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function GUI_FrameTask
+ * @brief frame scheduler; shall be called in the main loop, instead of GUI_DrawObjects(). The events are handled at
+ *        each call (GUI_HandleObjects), so that the pacing never delays the input; a frame (GUI_RefreshObjects) is
+ *        drawn once the target period (or the budget delay) elapsed; a large screen damage waits for the next frame
+ *        marker, so that its write starts with the panel scan (no tearing). Without frame marker, frames are paced by
+ *        the core timer only
+ * @param none
+ * @return bool: true if a frame was drawn
+ */
+bool GUI_FrameTask(void) {
+
+  uint32_t now, tFrame;
+  bool bDraw = false;
+
+  /*touch, signals, object & user tasks: at each call, whatever the frame pacing*/
+  GUI_HandleObjects();
+
+  now = TicksGetCycles();
+  if(bStarted == false) {
+    bDraw = true;
+  }
+  else if(now - tStart >= holdCycles) {
+
+    /*large redraw: wait for the marker, unless it takes too long (marker lost, or always missed)*/
+    if(GUI_GetDamagePending() >= (uint32_t) LCD_GetWidth() * LCD_GetHeight() / FRAME_SYNC_DIV) {
+      if(FrameSyncReady(now)) {
+        bDraw = true;
+      }
+      else if(now - tStart >= holdCycles + FRAME_SYNC_WAIT_MAX * periodCycles) {
+        bDraw = true;
+      }
+    }
+    else {
+      bDraw = true;
+    }
+  }
+
+  if(bDraw) {
+
+    if(bStarted) FrameHist(frameStat.arInterval, now - tStart);
+    tStart = now;
+    bStarted = true;
+
+    GUI_RefreshObjects();
+
+    tFrame = TicksGetCycles() - tStart;
+    FrameHist(frameStat.arTime, tFrame);
+    if(TicksCyclesToUs(tFrame) > frameStat.timeMax) frameStat.timeMax = TicksCyclesToUs(tFrame);
+    frameStat.frameCnt++;
+
+    /*budget: the frame time shall not exceed budget % of the time between two frames; a longer frame delays the next one*/
+    holdCycles = tFrame / budget * 100;
+    if(holdCycles > periodCycles) frameStat.overBudget++;
+    else holdCycles = periodCycles;
+  }
+
+  return bDraw;
+}
+
+
+/**
+ * @function GUI_FrameGetStat
+ * @brief return the frame statistics, since the last GUI_FrameResetStat()
+ * @param gui_frame_stat_st *stat: output statistics
+ * @return none
+ */
+void GUI_FrameGetStat(gui_frame_stat_st *stat) {
+  if(stat != NULL) *stat = frameStat;
+}
+
+
+/**
+ * @function GUI_FrameResetStat
+ * @brief reset the frame statistics
+ * @param none
+ * @return none
+ */
+void GUI_FrameResetStat(void) {
+  gmemset(&frameStat, 0, sizeof(frameStat));
+}
+
+
+/**
+ * @function FrameSyncReady
+ * @brief tell if a large redraw may start: a new marker was received, and the scan has not gone far since;
+ *        or no marker is received (FMARK not wired): nothing to wait for
+ * @param uint32_t now: core timer
+ * @return bool: true if the frame may start
+ */
+static bool FrameSyncReady(uint32_t now) {
+
+  uint32_t mkCnt, mkTime, mkPeriod;
+  bool bReady = false;
+
+  LCD_GetFrameMark(&mkCnt, &mkTime, &mkPeriod);
+  if(mkPeriod == 0 || now - mkTime >= FRAME_MARK_TIMEOUT * mkPeriod) {
+    bReady = true;
+  }
+  else if(mkCnt != markUsed && now - mkTime < mkPeriod / FRAME_SYNC_WND) {
+    markUsed = mkCnt;
+    frameStat.syncCnt++;
+    bReady = true;
+  }
+
+  return bReady;
+}
+
+
+/**
+ * @function FrameHist
+ * @brief add a time to a histogram
+ * @param uint32_t *arHist: histogram (GUI_FRAME_HIST_BINS bins of a quarter of the target period)
+ * @param uint32_t cycles: time, in core timer cycles
+ * @return none
+ */
+static void FrameHist(uint32_t *arHist, uint32_t cycles) {
+
+  uint32_t bin;
+
+  bin = cycles / (periodCycles / 4);
+  if(bin >= GUI_FRAME_HIST_BINS) bin = GUI_FRAME_HIST_BINS - 1;
+  arHist[bin]++;
+}
@@ -0,0 +1,87 @@
+/**
+ * @file gui_frame.h
+ * @brief GUI frame pacing: GUI_RefreshObjects() scheduling on the display refresh (frame marker)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-12
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _gui_frame_h_
+#define _gui_frame_h_
+
+#include "gui.h"
+
+#define GUI_FRAME_FPS_DEF     40    /*default target frame rate*/
+#define GUI_FRAME_FPS_MAX     60    /*the ILI9320 refreshes at ~70Hz*/
+#define GUI_FRAME_BUDGET_DEF  60    /*default frame time budget, in % of the frame period*/
+#define GUI_FRAME_BUDGET_MIN  10
+#define GUI_FRAME_BUDGET_MAX  90
+#define GUI_FRAME_HIST_BINS   8     /*histogram bins; bin width: a quarter of the target period, the last bin collects the longer times*/
+
+/**
+* @struct: gui_frame_stat_st
+* @brief: frame statistics
+*/
+typedef struct {
+  uint32_t frameCnt;                          /*frames drawn*/
+  uint32_t syncCnt;                           /*frames started right after a frame marker (large screen damage)*/
+  uint32_t overBudget;                        /*frames longer than the budget: the next one was delayed*/
+  uint32_t timeMax;                           /*longest frame, in us*/
+  uint32_t arTime[GUI_FRAME_HIST_BINS];       /*frame time (GUI_RefreshObjects() duration) histogram*/
+  uint32_t arInterval[GUI_FRAME_HIST_BINS];   /*histogram of the interval between two frame starts*/
+} gui_frame_stat_st;
+
+/**
+ * @function GUI_FrameSetRate
+ * @brief set the target frame rate & the frame time budget; statistics are reset
+ * @param uint8_t fps: target frame rate, in frames per second (1 to GUI_FRAME_FPS_MAX)
+ * @param uint8_t budget: part of the frame period which may be spent drawing, in % (GUI_FRAME_BUDGET_MIN to GUI_FRAME_BUDGET_MAX);
+ *        a longer frame delays the next one, so that the main loop tasks keep the rest of the CPU time
+ * @return int8_t: 0 success, -1 error (parameter out of range; nothing changed)
+ */
+int8_t GUI_FrameSetRate(uint8_t fps, uint8_t budget);
+
+/**
+ * @function GUI_FrameTask
+ * @brief frame scheduler; shall be called in the main loop, instead of GUI_DrawObjects(). The events are handled at
+ *        each call (GUI_HandleObjects), so that the pacing never delays the input; a frame (GUI_RefreshObjects) is
+ *        drawn once the target period (or the budget delay) elapsed; a large screen damage waits for the next frame
+ *        marker, so that its write starts with the panel scan (no tearing). Without frame marker, frames are paced by
+ *        the core timer only
+ * @param none
+ * @return bool: true if a frame was drawn
+ */
+bool GUI_FrameTask(void);
+
+/**
+ * @function GUI_FrameGetStat
+ * @brief return the frame statistics, since the last GUI_FrameResetStat()
+ * @param gui_frame_stat_st *stat: output statistics
+ * @return none
+ */
+void GUI_FrameGetStat(gui_frame_stat_st *stat);
+
+/**
+ * @function GUI_FrameResetStat
+ * @brief reset the frame statistics
+ * @param none
+ * @return none
+ */
+void GUI_FrameResetStat(void);
+
+#endif
@@ -28,20 +28,29 @@
  * sprite_sheet_st
  * sprite sheet, where all sprites have the same width & height
  */
-typedef struct sprite_sheet_t {
-  struct sprite_sheet_t *next;
+typedef struct {
   const void *ptrFile;
   lut8bpp_st *arLut[G_NB_LUT];
-  gui_img_t from, to;
 } sprite_sheet_st;
 
+/**
+ * sprite_entry_st
+ * one sprite: its sheet & its place in the sheet, resolved at GraphInit()
+ */
+typedef struct {
+  const sprite_sheet_st *sheet;   /*NULL if the sprite does not exist*/
+  coord_t y;                      /*first line of the sprite in its sheet*/
+  length_t w, h;
+} sprite_entry_st;
+
 
 /**
  * local variables
  */
 static color_t arColors[G_NB_COLORS];         /*color LUT for widgets*/
 static const void *arFonts[G_NB_FONT];        /*font LUT*/
-static sprite_sheet_st *spriteSheet = NULL;   /*head of list of sprite sheets*/
+static sprite_sheet_st *lastSheet = NULL;     /*last added sprite sheet*/
+static sprite_entry_st arSprite[G_NB_IMG];    /*sprites, indexed by uid*/
 static gui_font_t fontId;                     /*current font used*/
 static gui_align_t align;
 static uint8_t lutId;
@@ -50,11 +59,9 @@ static lut8bpp_st lut_base; /*lut for the basic GUI elements (box, radio...)*/
 /**
  * local functions
  */
-static sprite_sheet_st /*@null@*/ *GetSpriteSheet(gui_img_t idSprite);
+static const sprite_entry_st /*@null@*/ *GetSprite(gui_img_t idSprite);
 static int8_t SpriteSheetAdd(const void *ptrFile, gui_img_t from, gui_img_t to);
 static int8_t SpriteSheetAddLut(const void *ptrFileLut, uint8_t idLut, lutmode_t mode);
-static length_t GetW(const sprite_sheet_st /*@null@*/ *sp);
-static length_t GetH(const sprite_sheet_st /*@null@*/ *sp);
 
 
 /**
@@ -92,7 +99,9 @@ void GraphInit(void) {
   /*for DrawBox()*/
   P2D_InitLut8BPP(&lut_base, sprite_box_lut, LUT_E_COPY | LUT_O_COLOR_KEY);
 
-  /*sprite sheets registration*/
+  /*sprite sheets registration; each sprite gets its entry in arSprite[]*/
+  gmemset(arSprite, 0, sizeof(arSprite));
+  lastSheet = NULL;
   /*background*/
   SpriteSheetAdd(sprite_background, G_IMG_BACKROUND, G_IMG_BACKROUND);
   SpriteSheetAddLut(sprite_background_lut, G_LUT_NORMAL, LUT_E_COPY);
@@ -232,7 +241,10 @@ void SetLut(uint8_t lut) {
  * @return length_t: width of the sprite, 0 if the sprite does not exist
  */
 length_t SpriteGetWidth(gui_img_t idSprite) {
-  return GetW(GetSpriteSheet(idSprite));
+  length_t res = 0;
+  const sprite_entry_st *sp = GetSprite(idSprite);
+  if(sp != NULL) res = sp->w;
+  return res;
 }
 
 
@@ -243,7 +255,10 @@ length_t SpriteGetWidth(gui_img_t idSprite) {
  * @return length_t: height of the sprite, 0 if the sprite does not exist
  */
 length_t SpriteGetHeight(gui_img_t idSprite) {
-  return GetH(GetSpriteSheet(idSprite));
+  length_t res = 0;
+  const sprite_entry_st *sp = GetSprite(idSprite);
+  if(sp != NULL) res = sp->h;
+  return res;
 }
 
 
@@ -257,60 +272,55 @@ length_t SpriteGetHeight(gui_img_t idSprite) {
 void Sprite(coord_t x0, coord_t y0, gui_img_t idSprite) {
 
   rect_st dst, src;
-  length_t w, h;
   lut8bpp_st *pLut;
-  sprite_sheet_st *sp = NULL;
+  const sprite_entry_st *sp;
 
-  /*retrieve the sheet containing the idSprite*/
-  sp = GetSpriteSheet(idSprite);
+  /*retrieve the sheet & the place of idSprite*/
+  sp = GetSprite(idSprite);
   if(sp != NULL) {
 
-    /*get the width & height of idSprite*/
-    w = GetW(sp);
-    h = GetH(sp);
-
     /*define destination rect (to screen)*/
     dst.x = x0;
     dst.y = y0;
-    dst.w = w;
-    dst.h = h;
+    dst.w = sp->w;
+    dst.h = sp->h;
 
     /*define source rect (from sheet)*/
     src.x = 0;
-    src.y = (idSprite - sp->from) * h;
-    src.w = w;
-    src.h = h;
+    src.y = sp->y;
+    src.w = sp->w;
+    src.h = sp->h;
 
     /*select & update the CLUT; if current lut == NULL, select the G_LUT_NORMAL*/
-    if(sp->arLut[lutId] != NULL) pLut = sp->arLut[lutId];
-    else pLut = sp->arLut[0];
+    if(sp->sheet->arLut[lutId] != NULL) pLut = sp->sheet->arLut[lutId];
+    else pLut = sp->sheet->arLut[0];
     P2D_SpriteSetLut8BPP(pLut);
     P2D_UpdateLut8BPP(pLut);      /*always update the CLUT! (for colorkey mask)*/
 
     /*display the sprite*/
-    P2D_Sprite(&src, &dst, sp->ptrFile);
+    P2D_Sprite(&src, &dst, sp->sheet->ptrFile);
   }
 }
 
 
 /**
- * @function GetSpriteSheet
- * @brief retrieve the pointer to the sprite sheet containing the idSprite
+ * @function GetSprite
+ * @brief retrieve the sheet & the place of idSprite
  * @param gui_img_t idSprite: sprite uid
- * @return sprite_sheet_st*: pointer to sprite sheet if success, NULL if ot found
+ * @return const sprite_entry_st*: sprite entry if success, NULL if not found
  */
-static sprite_sheet_st /*@null@*/ *GetSpriteSheet(gui_img_t idSprite) {
+static const sprite_entry_st /*@null@*/ *GetSprite(gui_img_t idSprite) {
 
-  sprite_sheet_st *res = spriteSheet;
+  const sprite_entry_st *res = NULL;
 
-  while(res != NULL && (idSprite < res->from || idSprite > res->to)) res = res->next;
+  if(idSprite < G_NB_IMG && arSprite[idSprite].sheet != NULL) res = &arSprite[idSprite];
   return res;
 }
 
 
 /**
  * @function SpriteSheetAdd
- * @brief add a new sprite sheet in list
+ * @brief add a new sprite sheet, and fill the entries of its sprites (tiles stacked vertically, same size)
  * @param const void *ptrFile: pointer to the sprite file
  * @param gui_img_t from, to: from & to uid
  * @return int8_t: 0 success, -1 error
@@ -318,24 +328,28 @@ static sprite_sheet_st /*@null@*/ *GetSpriteSheet(gui_img_t idSprite) {
 static int8_t SpriteSheetAdd(const void *ptrFile, gui_img_t from, gui_img_t to) {
 
   int8_t res = -1;
-  sprite_sheet_st **seek = NULL, *pNewSheet = NULL;
+  sprite_sheet_st *pNewSheet = NULL;
+  length_t w, h;
+  gui_img_t id;
 
   /*allocate a new sheet*/
-  pNewSheet = salloc(sizeof(sprite_sheet_st));
+  if(from <= to && to < G_NB_IMG) pNewSheet = salloc(sizeof(sprite_sheet_st));
   if(pNewSheet != NULL) {
 
-    /*clear all internal pointer*/
+    /*clear all internal pointer, copy file pointer*/
     gmemset(pNewSheet, 0, sizeof(sprite_sheet_st));
-
-    /*copy file pointer, from & to uid*/
     pNewSheet->ptrFile = ptrFile;
-    pNewSheet->from = from;
-    pNewSheet->to = to;
-
-    /*insert the new sheet into the sheets list*/
-    seek = &spriteSheet;
-    while(*seek != NULL) seek = &((*seek)->next);
-    *seek = pNewSheet;
+    lastSheet = pNewSheet;
+
+    /*the sheet header is parsed once, here*/
+    w = P2D_SpriteGetWidth(ptrFile);
+    h = P2D_SpriteGetHeight(ptrFile) / (to - from + 1);
+    for(id = from; id <= to; id++) {
+      arSprite[id].sheet = pNewSheet;
+      arSprite[id].y = (id - from) * h;
+      arSprite[id].w = w;
+      arSprite[id].h = h;
+    }
 
     res = 0;
   }
@@ -355,13 +369,9 @@ static int8_t SpriteSheetAdd(const void *ptrFile, gui_img_t from, gui_img_t to)
 static int8_t SpriteSheetAddLut(const void *ptrFileLut, uint8_t idLut, lutmode_t mode) {
 
   int8_t res = -1;
-  sprite_sheet_st *seek = NULL;
-
-  if(spriteSheet != NULL && idLut < G_NB_LUT) {
+  sprite_sheet_st *seek = lastSheet;
 
-    /*go to the last added sheet*/
-    seek = spriteSheet;
-    while(seek->next != NULL) seek = seek->next;
+  if(seek != NULL && idLut < G_NB_LUT) {
 
     /*allocate a new lut*/
     seek->arLut[idLut] = salloc(sizeof(lut8bpp_st));
@@ -377,35 +387,6 @@ static int8_t SpriteSheetAddLut(const void *ptrFileLut, uint8_t idLut, lutmode_t
 }
 
 
-/**
- * @function GetW
- * @brief return the width of a tile contained in a sprite sheet
- * @param sprite_sheet_st *sp: pointer to the sprite sheet
- * @return length_t: width of the tile, 0 if sp == NULL
- */
-static length_t GetW(const sprite_sheet_st /*@null@*/ *sp) {
-  length_t res = 0;
-  if(sp != NULL) res = P2D_SpriteGetWidth(sp->ptrFile);
-  return res;
-}
-
-
-/**
- * @function GetH
- * @brief return the height of a tile contained in a sprite sheet
- * @param sprite_sheet_st *sp: pointer to the sprite sheet
- * @return length_t: height of the tile, 0 if sp == NULL
- */
-static length_t GetH(const sprite_sheet_st /*@null@*/ *sp) {
-  length_t res = 0, div;
-  if(sp != NULL) {
-    div = sp->to - sp->from + 1;
-    if(div > 0) res = P2D_SpriteGetHeight(sp->ptrFile) / div;
-  }
-  return res;
-}
-
-
 /**
  * @function DrawBox
  * @brief draw an empty box
@@ -40,6 +40,9 @@
 #define OBJ_S_FOCUSED       (state_t) 0x0020
 #define OBJ_S_NEED_REFRESH  (state_t) 0x0040
 #define OBJ_S_STATIC        (state_t) 0x0080
+#define GUI_DAMAGE_MAX      8   /*maximal number of screen damage rects per cycle; beyond, the closest rects are merged*/
+#define GUI_BAND_LINES      8   /*height of the bands used for redrawing the screen damage; RAM: 2 bands of LCD width x GUI_BAND_LINES pixels; cost vs height: "make p2d_band"*/
+#define GUI_LIST_SIZE       4096  /*display list arena, in bytes; the drawing of a cycle is recorded, then replayed without the redundant state changes & hidden commands*/
 
 
 /**
@@ -64,10 +67,14 @@ static signal_t signal = 0;                                   /*curent signal, c
 static signal_t lastSignal = 0;                               /*last non-null signal, coming from widgets of the active layer*/
 static timer_t tmrBlink = 0;                                  /*timer for notification blinkin*/
 static bool bBlink = false;                                   /*notification blink state*/
-static coord_t x, y;                                          /*touchscreen coords, taken at the begining of GUI_DrawObject*/
+static coord_t x, y;                                          /*touchscreen coords, taken at the begining of GUI_HandleObjects*/
 static pGuiUsrTask_t pUserTask = NULL, pHookUserTask = NULL;  /*pointer to current user handler / hook handler*/
 static pGuiInternalTask_t /*@null@*/ pInternalTask = NULL;    /*pointer to internal handler (e.g. keyboard handler)*/
 static g_context_st savedContext;                             /*for switch between base/top layer*/
+static rect_st arDamage[GUI_DAMAGE_MAX];                      /*screen damage rects, waiting for the next GUI_RefreshObjects()*/
+static uint8_t damageCnt = 0;                                 /*number of rects in arDamage*/
+static gui_damage_stat_st damageStat;                         /*redraw statistics of the last cycle*/
+static bool bDisplayList = true;                              /*objects drawn through the P2D display list*/
 
 /**
  * Local functions
@@ -77,6 +84,9 @@ static void HandleSignal(const g_obj_st *obj);
 static bool StateGet(const g_obj_st /*@null@*/ *obj, state_t state);
 static void StateSet(g_obj_st /*@null@*/ *obj, state_t state, bool b);
 static g_obj_st /*@null@*/ *GetObjectList(void);
+static void DrawObject(g_obj_st *obj, const rect_st *clip);
+static void DrawDamage(const rect_st *rec);
+static void RectUnion(rect_st *dst, const rect_st *src);
 
 
 /**
@@ -90,6 +100,12 @@ void GUI_Init(void) {
   /*load graphic resources (color LUT for sprites)*/
   GraphInit();
 
+  /*band buffer, for redrawing the screen damage off-screen; kept by GUI_ClearAll()*/
+  (void) P2D_BandInit((uint32_t) P2D_GetLcdWidth() * GUI_BAND_LINES * 2);
+
+  /*display list arena; kept by GUI_ClearAll() too*/
+  (void) P2D_ListInit(GUI_LIST_SIZE);
+
   /*save the current stack address; all data before this address belongs to GraphInit*/
   addrStart = salloc(0);
 
@@ -109,7 +125,7 @@ void GUI_Init(void) {
  */
 void GUI_TopLayerOpen(pGuiInternalTask_t p) {
 
-  coord_t yl;
+  rect_st lrect;
 
   if(bTopLayerActive == false) {
 
@@ -117,16 +133,16 @@ void GUI_TopLayerOpen(pGuiInternalTask_t p) {
     savedContext.lastAddedObj = lastAddedObj;
     savedContext.group = group;
 
-    /*make a fake alpha(128) on the whole screen*/
+    /*translucent white veil, alpha(128), on the whole screen*/
     P2D_SetClip(NULL);
-    P2D_SetColor(0xFFFF);
-    P2D_SetLineType(LINE_DOT);
-    P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
-    for(yl = 0; yl < P2D_GetLcdHeight(); yl++) {
-      P2D_Line(yl % 2, yl, P2D_GetLcdWidth() - yl % 2, yl);
-    }
-    P2D_SetLineType(LINE_SOLID);
-    P2D_SetDisplayMode(DISPLAY_SOLID);
+    lrect.x = 0;
+    lrect.y = 0;
+    lrect.w = P2D_GetLcdWidth();
+    lrect.h = P2D_GetLcdHeight();
+    P2D_SetColor(COLOR_WHITE);
+    P2D_SetAlpha(128);
+    P2D_FillRectAlpha(&lrect);
+    P2D_SetAlpha(255);
 
     /*new context*/
     headTop = NULL;
@@ -134,6 +150,7 @@ void GUI_TopLayerOpen(pGuiInternalTask_t p) {
     group = 0;
     bTopLayerActive = true;
     pInternalTask = p;
+    damageCnt = 0;
   }
 }
 
@@ -157,6 +174,7 @@ void GUI_TopLayerClose(void) {
     lastAddedObj = savedContext.lastAddedObj;
     group = savedContext.group;
     bTopLayerActive = false;
+    damageCnt = 0;
 
     /*clear screen*/
     P2D_SetClip(NULL);
@@ -244,6 +262,9 @@ g_obj_st /*@null@*/ *GUI_AddGenericObject(void) {
  */
 void GUI_ClearAll(void) {
 
+  /*what is recorded in the display list is drawn before the objects it may refer to are deleted*/
+  P2D_ListFlush();
+
   /*delete all memory allocated to objects*/
   sfreeFrom(addrStart);
 
@@ -253,6 +274,7 @@ void GUI_ClearAll(void) {
   group = 0;
   tmrBlink = 0;
   bBlink = false;
+  damageCnt = 0;
 
   /*clear screen*/
   P2D_SetClip(NULL);
@@ -340,11 +362,25 @@ void GUI_ReadTouchScreen(coord_t /*@out@*/ /*@null@*/ *px, coord_t /*@out@*/ /*@
 
 /**
  * @function GUI_DrawObjects
- * @brief handle all object (user event, refresh)
+ * @brief handle all object (user event, refresh): GUI_HandleObjects(), then GUI_RefreshObjects()
  * @param none
  * @return none
  */
 void GUI_DrawObjects(void) {
+  GUI_HandleObjects();
+  GUI_RefreshObjects();
+}
+
+
+/**
+ * @function GUI_HandleObjects
+ * @brief event part of the GUI cycle: read the touch screen, handle the touch events, signals & tasks of the objects,
+ *        then the top layer & user tasks; nothing is drawn (except by the tasks themselves). Shall run at each
+ *        main loop pass, even if the redraw is paced (GUI_FrameTask)
+ * @param none
+ * @return none
+ */
+void GUI_HandleObjects(void) {
 
   g_obj_st *ptr = NULL;
   coord_t newX, newY;
@@ -370,7 +406,6 @@ void GUI_DrawObjects(void) {
     }
   }
 
-
   /*get the object list, according to the active layer*/
   ptr = GetObjectList();
 
@@ -385,7 +420,7 @@ void GUI_DrawObjects(void) {
   }
 
   /*process each generic object of the current layer*/
-  while(ptr != NULL) {
+  for(ptr = GetObjectList(); ptr != NULL; ptr = ptr->next) {
 
     /*handle user interaction*/
     HandleTouchEvent(x, y, ptr);
@@ -393,28 +428,15 @@ void GUI_DrawObjects(void) {
     /*handle object signals*/
     HandleSignal(ptr);
 
-    if(ptr->obj != NULL) {
-
-      /*launch the object task, if any*/
-      if(ptr->task != NULL) ptr->task(ptr, ptr->obj);
-
-      /*redraw the object, only if needed*/
-      if(GUI_ObjIsNeedRefresh(ptr) && ptr->draw != NULL) {
-        P2D_SetClip(&(ptr->rec));
-        ptr->draw(ptr, ptr->obj);
-        GUI_ObjSetNeedRefresh(ptr, false);
-      }
-    }
-
-    /*next object*/
-    ptr = ptr->next;
+    /*launch the object task, if any*/
+    if(ptr->obj != NULL && ptr->task != NULL) ptr->task(ptr, ptr->obj);
   }
 
   /**
    * execute, if any, the top layer task
    * pInternalTask may close the top layer and return a signal;
    * when closing the top layer, pInternalTask becomes NULL
-   * this signal will be given to the user at end of GUI_DrawObjects()
+   * this signal will be given to the user at end of GUI_HandleObjects()
    */
   if(pInternalTask != NULL) signal = pInternalTask(signal);
 
@@ -436,6 +458,182 @@ void GUI_DrawObjects(void) {
 }
 
 
+/**
+ * @function GUI_RefreshObjects
+ * @brief draw part of the GUI cycle: redraw the screen damage & the objects which need it (whole object or damaged part)
+ * @param none
+ * @return none
+ */
+void GUI_RefreshObjects(void) {
+
+  g_obj_st *ptr = NULL;
+  rect_st arCurDamage[GUI_DAMAGE_MAX], lrec;
+  bool arBanded[GUI_DAMAGE_MAX];
+  uint8_t curDamageCnt, ii;
+  uint32_t pxStart;
+
+  /*take the screen damage declared so far (by the tasks, since the last refresh)*/
+  curDamageCnt = damageCnt;
+  for(ii = 0; ii < curDamageCnt; ii++) arCurDamage[ii] = arDamage[ii];
+  damageCnt = 0;
+  damageStat.pxInvalidated = 0;
+  damageStat.rectCnt = curDamageCnt;
+  pxStart = LCD_GetPixelCnt();
+
+  /*record the drawing of this cycle; replayed band after band (P2D_BandNext), and at the end of the object loop*/
+  if(bDisplayList) (void) P2D_ListBegin();
+
+  /**
+   * damaged areas are cleared, then objects are composited over them (in the list order);
+   * this is done off-screen, band after band (no flicker), unless the band buffer is unavailable:
+   * then the area is cleared on the screen and its objects are redrawn in the object loop below
+   */
+  for(ii = 0; ii < curDamageCnt; ii++) {
+    arBanded[ii] = (P2D_BandBegin(&arCurDamage[ii], 0) == 0) ? true : false;
+    if(arBanded[ii]) {
+      while(P2D_BandNext(&lrec)) DrawDamage(&lrec);
+    }
+    else {
+      P2D_SetColor(GetColor(G_COL_BACKGROUND));
+      P2D_SetClip(&arCurDamage[ii]);
+      P2D_FillRect(&arCurDamage[ii]);
+    }
+    damageStat.pxInvalidated += P2D_GetPixelCnt(&arCurDamage[ii]);
+  }
+
+  /*redraw each generic object of the current layer, if needed*/
+  for(ptr = GetObjectList(); ptr != NULL; ptr = ptr->next) {
+
+    if(ptr->obj != NULL && ptr->draw != NULL) {
+
+      /*redraw the object, only if needed: whole object or its damaged part only*/
+      if(GUI_ObjIsNeedRefresh(ptr)) {
+        if(ptr->damage.w > 0) {
+          DrawObject(ptr, &(ptr->damage));
+          damageStat.pxInvalidated += P2D_GetPixelCnt(&(ptr->damage));
+        }
+        else {
+          DrawObject(ptr, &(ptr->rec));
+          damageStat.pxInvalidated += P2D_GetPixelCnt(&(ptr->rec));
+        }
+      }
+
+      /*redraw the parts of the object overlapped by the screen damage not drawn in bands, unless already redrawn as a whole*/
+      if(GUI_ObjIsNeedRefresh(ptr) == false || ptr->damage.w > 0) {
+        for(ii = 0; ii < curDamageCnt; ii++) {
+          if(arBanded[ii] == false) {
+            lrec = arCurDamage[ii];
+            P2D_Clip(&lrec, &(ptr->rec));
+            if(P2D_GetPixelCnt(&lrec) > 0) DrawObject(ptr, &lrec);
+          }
+        }
+      }
+
+      GUI_ObjSetNeedRefresh(ptr, false);
+    }
+  }
+
+  P2D_ListEnd();
+  damageStat.pxPushed = LCD_GetPixelCnt() - pxStart;
+}
+
+
+/**
+ * @function GUI_Invalidate
+ * @brief declare a damaged screen area; on next GUI_RefreshObjects(), it is cleared and every object overlapping it is redrawn, clipped to it
+ * @param const rect_st *rec: damaged area (absolute); NULL for the whole screen
+ * @return none
+ */
+void GUI_Invalidate(const rect_st /*@null@*/ *rec) {
+
+  rect_st lrec, scr, u;
+  int32_t waste, bestWaste;
+  uint8_t ii, best;
+  bool bMerged;
+
+  scr.x = 0;
+  scr.y = 0;
+  scr.w = P2D_GetLcdWidth();
+  scr.h = P2D_GetLcdHeight();
+  if(rec == NULL) lrec = scr;
+  else {
+    lrec = *rec;
+    P2D_Clip(&lrec, &scr);
+  }
+
+  if(P2D_GetPixelCnt(&lrec) > 0) {
+
+    /**
+     * merge the new rect with the existing one which wastes the less area once merged;
+     * only if it costs nothing (overlapping or contained rects), or if the list is full.
+     * the merged rect may now overlap another one: loop until no merge happens
+     */
+    do {
+      bMerged = false;
+      best = 0;
+      bestWaste = INT32_MAX;
+      for(ii = 0; ii < damageCnt; ii++) {
+        u = arDamage[ii];
+        RectUnion(&u, &lrec);
+        waste = (int32_t) P2D_GetPixelCnt(&u) - (int32_t) P2D_GetPixelCnt(&arDamage[ii]) - (int32_t) P2D_GetPixelCnt(&lrec);
+        if(waste < bestWaste) {
+          bestWaste = waste;
+          best = ii;
+        }
+      }
+
+      if(damageCnt > 0 && (bestWaste <= 0 || damageCnt >= GUI_DAMAGE_MAX)) {
+        RectUnion(&lrec, &arDamage[best]);
+        damageCnt--;
+        arDamage[best] = arDamage[damageCnt];
+        bMerged = true;
+      }
+    } while(bMerged);
+
+    arDamage[damageCnt] = lrec;
+    damageCnt++;
+  }
+}
+
+
+/**
+ * @function GUI_GetDamageStat
+ * @brief return the redraw statistics of the last GUI_RefreshObjects() cycle
+ * @param gui_damage_stat_st *stat: output statistics
+ * @return none
+ */
+void GUI_GetDamageStat(gui_damage_stat_st *stat) {
+  if(stat != NULL) *stat = damageStat;
+}
+
+
+/**
+ * @function GUI_GetDamagePending
+ * @brief return the size of the screen damage declared so far, which will be redrawn by the next GUI_RefreshObjects()
+ * @param none
+ * @return uint32_t: number of pixels (sum of the damage rects)
+ */
+uint32_t GUI_GetDamagePending(void) {
+
+  uint32_t px = 0;
+  uint8_t ii;
+
+  for(ii = 0; ii < damageCnt; ii++) px += P2D_GetPixelCnt(&arDamage[ii]);
+  return px;
+}
+
+
+/**
+ * @function GUI_DisplayListEnable
+ * @brief enable or disable the drawing of the objects through the P2D display list (enabled by default)
+ * @param bool bEnable: true for enabling the display list
+ * @return none
+ */
+void GUI_DisplayListEnable(bool bEnable) {
+  bDisplayList = bEnable;
+}
+
+
 /**
  * @function GUI_GroupDisable
  * @brief disable or enable a group of object
@@ -688,6 +886,39 @@ bool GUI_ObjIsNeedRefresh(const g_obj_st /*@null@*/ *obj) {
 void GUI_ObjSetNeedRefresh(g_obj_st /*@null@*/ *obj, bool p) {
   if(obj == NULL) obj = lastAddedObj;
   StateSet(obj, OBJ_S_NEED_REFRESH, p);
+  if(obj != NULL) {
+    obj->damage.w = 0;
+    obj->damage.h = 0;
+  }
+}
+
+
+/**
+ * @function GUI_ObjInvalidate
+ * @brief request the redraw of a part of a generic object only; damaged parts are merged until the next refresh
+ * @param g_obj_st *obj: generic object
+ * @param const rect_st *rec: damaged part (absolute); clipped to the object window
+ * @return none
+ */
+void GUI_ObjInvalidate(g_obj_st /*@null@*/ *obj, const rect_st *rec) {
+
+  rect_st lrec;
+
+  if(obj == NULL) obj = lastAddedObj;
+  if(obj != NULL && rec != NULL) {
+    lrec = *rec;
+    P2D_Clip(&lrec, &(obj->rec));
+    if(P2D_GetPixelCnt(&lrec) > 0) {
+      if(GUI_ObjIsNeedRefresh(obj) == false) {
+        StateSet(obj, OBJ_S_NEED_REFRESH, true);
+        obj->damage = lrec;
+      }
+      else if(obj->damage.w > 0) {
+        RectUnion(&(obj->damage), &lrec);
+      }
+      else { /*the whole object is already to be redrawn*/ }
+    }
+  }
 }
 
 
@@ -818,3 +1049,67 @@ static g_obj_st /*@null@*/ *GetObjectList(void) {
   else ptr = headTop;
   return ptr;
 }
+
+
+/**
+ * @function DrawObject
+ * @brief launch the draw function of an object, clipped to a part of it
+ * @param g_obj_st *obj: generic object
+ * @param const rect_st *clip: part to redraw (absolute)
+ * @return none
+ */
+static void DrawObject(g_obj_st *obj, const rect_st *clip) {
+  /*an empty clip would be expanded to the whole screen by P2D_SetClip()*/
+  if(P2D_GetPixelCnt(clip) > 0) {
+    P2D_SetClip(clip);
+    obj->draw(obj, obj->obj);
+  }
+}
+
+
+/**
+ * @function DrawDamage
+ * @brief draw a part of the screen damage: background, then every object of the active layer overlapping it (in the list order)
+ * @param const rect_st *rec: part to draw (absolute)
+ * @return none
+ */
+static void DrawDamage(const rect_st *rec) {
+
+  g_obj_st *ptr;
+  rect_st lrec;
+
+  P2D_SetColor(GetColor(G_COL_BACKGROUND));
+  P2D_SetClip(rec);
+  P2D_FillRect(rec);
+
+  for(ptr = GetObjectList(); ptr != NULL; ptr = ptr->next) {
+    if(ptr->obj != NULL && ptr->draw != NULL) {
+      lrec = *rec;
+      P2D_Clip(&lrec, &(ptr->rec));
+      DrawObject(ptr, &lrec);
+    }
+  }
+}
+
+
+/**
+ * @function RectUnion
+ * @brief compute the smallest rect containing 2 given rects
+ * @param rect_st *dst: first rect, and output
+ * @param const rect_st *src: second rect
+ * @return none
+ */
+static void RectUnion(rect_st *dst, const rect_st *src) {
+
+  coord_t dx0, dy0, dx1, dy1, sx0, sy0, sx1, sy1;
+
+  if(P2D_GetPixelCnt(src) > 0) {
+    if(P2D_GetPixelCnt(dst) == 0) {
+      *dst = *src;
+    }
+    else if(P2D_RectToCoord(dst, &dx0, &dy0, &dx1, &dy1) == 0 && P2D_RectToCoord(src, &sx0, &sy0, &sx1, &sy1) == 0) {
+      (void) P2D_CoordToRect(dst, P2D_CoordGetMin(dx0, sx0), P2D_CoordGetMin(dy0, sy0), P2D_CoordGetMax(dx1, sx1), P2D_CoordGetMax(dy1, sy1));
+    }
+    else { /*cannot happen*/ }
+  }
+}
@@ -53,6 +53,7 @@ typedef struct g_obj_t {
   pObjFunc_t /*@null@*/ draw;       /*draw function of the object*/
 
   rect_st rec;                      /*absolute object window*/
+  rect_st damage;                   /*part of rec to redraw on next refresh; w == 0 for the whole rec*/
   signal_t signals[E_MAX_EVENT];    /*signals table (one signal per possible event)*/
   state_t state;                    /*object state (disabled, hiden, focused, etc...)*/
   event_e event;                    /*user event (released, pushed, ...)*/
@@ -60,6 +61,16 @@ typedef struct g_obj_t {
 
 } g_obj_st;
 
+/**
+* @struct: gui_damage_stat_st
+* @brief: redraw statistics of one GUI_RefreshObjects() cycle
+*/
+typedef struct {
+  uint32_t pxInvalidated;           /*pixels of area invalidated (screen damage rects + object refresh areas, counted once where merged)*/
+  uint32_t pxPushed;                /*pixels actually sent to the display*/
+  uint8_t rectCnt;                  /*number of screen damage rects, after merging*/
+} gui_damage_stat_st;
+
 /**
  * @function GUI_Init
  * @brief Initialize the GUI; call me first !
@@ -151,12 +162,62 @@ void GUI_ReadTouchScreen(coord_t /*@out@*/ /*@null@*/ *px, coord_t /*@out@*/ /*@
 
 /**
  * @function GUI_DrawObjects
- * @brief handle all object (user event, refresh)
+ * @brief handle all object (user event, refresh): GUI_HandleObjects(), then GUI_RefreshObjects()
  * @param none
  * @return none
  */
 void GUI_DrawObjects(void);
 
+/**
+ * @function GUI_HandleObjects
+ * @brief event part of the GUI cycle: read the touch screen, handle the touch events, signals & tasks of the objects,
+ *        then the top layer & user tasks; nothing is drawn (except by the tasks themselves). Shall run at each
+ *        main loop pass, even if the redraw is paced (GUI_FrameTask)
+ * @param none
+ * @return none
+ */
+void GUI_HandleObjects(void);
+
+/**
+ * @function GUI_RefreshObjects
+ * @brief draw part of the GUI cycle: redraw the screen damage & the objects which need it (whole object or damaged part)
+ * @param none
+ * @return none
+ */
+void GUI_RefreshObjects(void);
+
+/**
+ * @function GUI_Invalidate
+ * @brief declare a damaged screen area; on next GUI_RefreshObjects(), it is cleared and every object overlapping it is redrawn, clipped to it
+ * @param const rect_st *rec: damaged area (absolute); NULL for the whole screen
+ * @return none
+ */
+void GUI_Invalidate(const rect_st /*@null@*/ *rec);
+
+/**
+ * @function GUI_GetDamageStat
+ * @brief return the redraw statistics of the last GUI_RefreshObjects() cycle
+ * @param gui_damage_stat_st *stat: output statistics
+ * @return none
+ */
+void GUI_GetDamageStat(gui_damage_stat_st *stat);
+
+/**
+ * @function GUI_GetDamagePending
+ * @brief return the size of the screen damage declared so far, which will be redrawn by the next GUI_RefreshObjects()
+ * @param none
+ * @return uint32_t: number of pixels (sum of the damage rects)
+ */
+uint32_t GUI_GetDamagePending(void);
+
+/**
+ * @function GUI_DisplayListEnable
+ * @brief enable or disable the drawing of the objects through the P2D display list (enabled by default)
+ * @param bool bEnable: true for enabling the display list
+ * @return none
+ */
+void GUI_DisplayListEnable(bool bEnable);
+
 /**
  * @function GUI_GroupDisable
  * @brief disable or enable a group of object
@@ -303,6 +364,15 @@ bool GUI_ObjIsNeedRefresh(const g_obj_st /*@null@*/ *obj);
  */
 void GUI_ObjSetNeedRefresh(g_obj_st /*@null@*/ *obj, bool p);
 
+/**
+ * @function GUI_ObjInvalidate
+ * @brief request the redraw of a part of a generic object only; damaged parts are merged until the next refresh
+ * @param g_obj_st *obj: generic object
+ * @param const rect_st *rec: damaged part (absolute); clipped to the object window
+ * @return none
+ */
+void GUI_ObjInvalidate(g_obj_st /*@null@*/ *obj, const rect_st *rec);
+
 /**
  * @function GUI_ObjSetStatic
  * @brief set the flag <Static> of a generic object
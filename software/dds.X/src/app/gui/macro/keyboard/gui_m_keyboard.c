@@ -129,6 +129,7 @@ int8_t GUI_M_KeyboardCreate(coord_t x, coord_t y, kbd_type_e _type, void *kbdBuf
     P2D_InitLut8BPP(&tmpLut, sprite_background_lut, LUT_E_COPY);
     P2D_SpriteSetLut8BPP(&tmpLut);
     P2D_Sprite(&recBackground, &recWnd, sprite_background);
+    P2D_ListFlush();  /*tmpLut is local: the background is drawn now, not when the display list is replayed*/
 
     /*add user entry*/
     pUsrEntryObj = GUI_W_UsrEntryAdd(&recEntry, buff, bufferSize, true);
@@ -270,6 +270,49 @@ void GUI_W_GraphAddSampleToCurve(g_obj_st *obj, uint8_t curveId, uint8_t sample)
 }
 
 
+/**
+ * @function GUI_W_GraphInvalidateSamples
+ * @brief request the redraw of the part of the graph showing some samples only (e.g. samples modified by the user)
+ * @param g_obj_st *obj: pointer to the graph container
+ * @param uint16_t first: index of the first sample modified, in the curve data
+ * @param uint16_t cnt: number of samples modified
+ * @return none
+ */
+void GUI_W_GraphInvalidateSamples(g_obj_st *obj, uint16_t first, uint16_t cnt) {
+
+  graph_st *graph = NULL;
+  curve_st *curve = NULL;
+  rect_st lrec;
+  uint16_t col, col0;
+
+  /*check parameters*/
+  if(obj != NULL && obj->obj != NULL && obj->draw == GraphDraw && cnt > 0) {
+
+    graph = (graph_st *) obj->obj;
+    lrec.y = obj->rec.y;
+    lrec.h = obj->rec.h;
+
+    /**
+     * the sample i of a curve is drawn in the columns (i - posDisp) - 1 & (i - posDisp) (segments ending & starting
+     * on it); the whole graph is invalidated if the samples wrap around the graph width
+     */
+    for(curve = graph->curve; curve != NULL; curve = curve->next) {
+      col = (uint16_t) ((first % obj->rec.w + obj->rec.w - curve->posDisp % obj->rec.w) % obj->rec.w);
+      if((uint32_t) col + cnt <= obj->rec.w) {
+        col0 = (col > 0) ? col - 1 : col;
+        lrec.x = obj->rec.x + col0;
+        lrec.w = col + cnt - col0;
+      }
+      else {
+        lrec.x = obj->rec.x;
+        lrec.w = obj->rec.w;
+      }
+      GUI_ObjInvalidate(obj, &lrec);
+    }
+  }
+}
+
+
 /**
  * @function GraphRefresh
  * @brief graph task; force refresh if timer has elapsed, read touch coords inside the graph
@@ -329,8 +372,9 @@ static void GraphDraw(void *_g_obj, void *_obj) {
   g_obj_st *g_obj;
   graph_st *graph;
   curve_st *curve;
+  rect_st lrec;
 
-  uint16_t p0, p1;
+  uint16_t p0, p1, last;
 
   /*retreive generic & specific object*/
   if(_g_obj != NULL && _obj != NULL) {
@@ -345,37 +389,42 @@ static void GraphDraw(void *_g_obj, void *_obj) {
     P2D_SetLineType(LINE_SOLID);
     P2D_SetColors(colBack, colBack);
 
-    /*vertical "clean-up" line definition*/
-    rec.x = g_obj->rec.x;
-    rec.y = g_obj->rec.y;
-    rec.w = 1;
-    rec.h = g_obj->rec.h;
+    /*only the vertical lines within the clip (damaged part of the graph) are drawn*/
+    lrec = g_obj->rec;
+    P2D_ClipFit(&lrec);
+    if(lrec.w > 0) {
 
-    /*for each vertical line*/
-    for(pxCnt = 0; pxCnt < g_obj->rec.w - 1; pxCnt++) {
+      /*vertical "clean-up" line definition*/
+      pxCnt = (uint16_t) (lrec.x - g_obj->rec.x);
+      last = pxCnt + lrec.w - 1;
+      rec.x = lrec.x;
+      rec.y = g_obj->rec.y;
+      rec.w = 1;
+      rec.h = g_obj->rec.h;
 
-      /*clean-up current line by calling the grid function*/
-      graph->fGrid();
+      /*for each vertical line*/
+      for(; pxCnt <= last; pxCnt++) {
 
-      /*draw each curve*/
-      curve = graph->curve;
-      while(curve != NULL) {
+        /*clean-up current line by calling the grid function*/
+        graph->fGrid();
 
-        P2D_SetColor(curve->color);
+        /*draw each curve; the last line is always empty*/
+        curve = graph->curve;
+        while(curve != NULL && pxCnt < g_obj->rec.w - 1) {
 
-        p0 = (curve->posDisp + pxCnt    ) % g_obj->rec.w;
-        p1 = (curve->posDisp + pxCnt + 1) % g_obj->rec.w;
-        P2D_Line(rec.x, graph->lut[ curve->data[p0] ], rec.x, graph->lut[ curve->data[p1] ]);
+          P2D_SetColor(curve->color);
 
-        /*4) next curve*/
-        curve = curve->next;
-      }
+          p0 = (curve->posDisp + pxCnt    ) % g_obj->rec.w;
+          p1 = (curve->posDisp + pxCnt + 1) % g_obj->rec.w;
+          P2D_Line(rec.x, graph->lut[ curve->data[p0] ], rec.x, graph->lut[ curve->data[p1] ]);
 
-      rec.x++;
-    }
+          /*4) next curve*/
+          curve = curve->next;
+        }
 
-    /*last line (always empty)*/
-    graph->fGrid();
+        rec.x++;
+      }
+    }
   }
 }
 
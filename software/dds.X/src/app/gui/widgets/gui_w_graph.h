@@ -78,6 +78,16 @@ int8_t GUI_W_GraphAddCurveToGraph(g_obj_st *obj, uint8_t *data, color_t color);
  */
 void GUI_W_GraphAddSampleToCurve(g_obj_st *obj, uint8_t curveId, uint8_t sample);
 
+/**
+ * @function GUI_W_GraphInvalidateSamples
+ * @brief request the redraw of the part of the graph showing some samples only (e.g. samples modified by the user)
+ * @param g_obj_st *obj: pointer to the graph container
+ * @param uint16_t first: index of the first sample modified, in the curve data
+ * @param uint16_t cnt: number of samples modified
+ * @return none
+ */
+void GUI_W_GraphInvalidateSamples(g_obj_st *obj, uint16_t first, uint16_t cnt);
+
 
 /**
  * @function GUI_W_GraphGetTouch
@@ -18,6 +18,7 @@ typedef struct {
  * local functions
  */
 static void ImgDraw(void *g_obj, void *obj);
+static void ImgGetRect(const g_obj_st *g_obj, gui_img_t img, rect_st *rec);
 
 
 
@@ -54,6 +55,49 @@ g_obj_st /*@null@*/*GUI_W_ImgAdd(const rect_st *rec, gui_img_t img, dmode_t disp
 }
 
 
+/**
+ * @function GUI_W_ImgSet
+ * @brief change the image of an img object; only the area covered by the old or the new image is redrawn
+ * @param g_obj_st *g_obj: generic object; NULL -> last added object
+ * @param gui_img_t img: new sprite uid; 0 -> empty box
+ * @return none
+ */
+void GUI_W_ImgSet(g_obj_st /*@null@*/ *g_obj, gui_img_t img) {
+
+  img_st *wimg;
+  rect_st oldRec, newRec;
+  coord_t x0, y0, x1, y1;
+
+  if(g_obj == NULL) g_obj = GUI_GetLastAddedObject();
+  if(g_obj != NULL && g_obj->obj != NULL && g_obj->draw == ImgDraw) {
+    wimg = (img_st *) g_obj->obj;
+    if(wimg->img != img) {
+
+      ImgGetRect(g_obj, wimg->img, &oldRec);
+      ImgGetRect(g_obj, img, &newRec);
+      wimg->img = img;
+
+      /**
+       * a solid image which covers the old one is just redrawn over it; otherwise, the pixels of the old image
+       * which are not covered are background: the union of both is declared as screen damage
+       */
+      if(wimg->mode == DISPLAY_SOLID && oldRec.x == newRec.x && oldRec.y == newRec.y && newRec.w >= oldRec.w && newRec.h >= oldRec.h) {
+        GUI_ObjInvalidate(g_obj, &newRec);
+      }
+      else {
+        x0 = P2D_CoordGetMin(oldRec.x, newRec.x);
+        y0 = P2D_CoordGetMin(oldRec.y, newRec.y);
+        x1 = P2D_CoordGetMax(oldRec.x + oldRec.w, newRec.x + newRec.w);
+        y1 = P2D_CoordGetMax(oldRec.y + oldRec.h, newRec.y + newRec.h);
+        newRec = GUI_Rect(x0, y0, x1 - x0, y1 - y0);
+        P2D_Clip(&newRec, &(g_obj->rec));
+        GUI_Invalidate(&newRec);
+      }
+    }
+  }
+}
+
+
 /**
  * @function ImgDraw
  * @brief img draw function
@@ -83,3 +127,20 @@ static void ImgDraw(void *_g_obj, void *_obj) {
 
   }
 }
+
+
+/**
+ * @function ImgGetRect
+ * @brief area drawn by an img object for a given image (sprite anchored at the top-left corner of the object)
+ * @param const g_obj_st *g_obj: generic object
+ * @param gui_img_t img: sprite uid; 0 -> empty box (whole object)
+ * @param rect_st *rec: output area (absolute)
+ * @return none
+ */
+static void ImgGetRect(const g_obj_st *g_obj, gui_img_t img, rect_st *rec) {
+  *rec = g_obj->rec;
+  if(img != 0) {
+    rec->w = SpriteGetWidth(img);
+    rec->h = SpriteGetHeight(img);
+  }
+}
@@ -6,6 +6,7 @@
 
 
 g_obj_st /*@null@*/*GUI_W_ImgAdd(const rect_st *rec, gui_img_t img, dmode_t displayMode);
+void GUI_W_ImgSet(g_obj_st /*@null@*/ *g_obj, gui_img_t img);
 
 
 #endif
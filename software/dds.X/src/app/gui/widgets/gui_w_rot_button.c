@@ -146,9 +146,12 @@ static void RotBtnRefresh(void *_g_obj, void *_obj) {
         /*compute the increment/decrement according to old & new angle*/
         if(rbtn->bWasPressed) *(rbtn->pVar) = GetInc(rbtn->deg, deg, rbtn->step);
 
-        /*save the new angle*/
+        /**
+         * save the new angle; each frame of the sprite is the whole knob rotated, with its own transparent border:
+         * the knob area is declared as screen damage, so that the background is drawn again below the new frame
+         */
         rbtn->deg = deg;
-        GUI_ObjSetNeedRefresh(g_obj, true);
+        GUI_Invalidate(&(g_obj->rec));
       }
       else {
         *(rbtn->pVar) = 0;
@@ -259,40 +262,14 @@ static void RotBtnDraw(void *_g_obj, void *_obj) {
 static int16_t GetAngle(coord_t xc, coord_t yc, coord_t xt, coord_t yt, uint8_t step) {
 
   int16_t angle = 0;
-  int32_t o, a, h, tmp;
-  const uint16_t multiplier = 32767;  /* P2D_Cos / P2D_Sin return a value between -32767 & 32767*/
+  uint32_t q16;
 
-  /*compute adjacent, opposite & hypotenuse*/
-  a = xt - xc;
-  o = yc - yt;
-  h = (int32_t) a * a + (int32_t) o * o;
-  h = P2D_sqrt(h);
+  if((xt != xc || yt != yc) && step > 0) {
 
-  if(h > 0) {
-
-    if(P2D_Abs(o) <= P2D_Abs(a)) {
-      tmp = (int32_t)P2D_Abs(o) * multiplier / h;
-      for(angle = 0; angle <= 90; angle += step) {
-        if(tmp <= P2D_Sin(angle) || tmp < P2D_Sin(angle + step/2)) break;
-      }
-    }
-    else {
-      tmp = (int32_t)P2D_Abs(a) * multiplier / h;
-      for(angle = 90; angle >= 0; angle -= step) {
-        if(tmp <= P2D_Cos(angle) || tmp < P2D_Cos(angle - step/2)) break;
-      }
-    }
-
-    /*update angle, according quadrant location*/
-    if(a <= 0) {
-      if(o >= 0) angle = 90 + (90 - angle); /*top left quadrant*/
-      else if(o < 0) angle = angle + 180;   /*bottom left quadrant*/
-    }
-    else if(a > 0) {
-      if(o < 0) angle = 270 + (90 - angle); /*bottom right quadrant*/
-      else {/*nothing*/}                    /*top right quadrant*/
-    }
-    if(angle == 360) angle = 0;
+    /*angle of the touched point around the center (screen y axis pointing down), rounded to the closest step*/
+    q16 = P2D_Atan2(yc - yt, xt - xc);
+    angle = (int16_t) (((q16 * 360 / step + 32768) >> 16) * step);
+    if(angle >= 360) angle = 0;
   }
 
   return angle;
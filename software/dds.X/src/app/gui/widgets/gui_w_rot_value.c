@@ -71,6 +71,7 @@ static length_t GetMaxCarWidth(void);
 static uint8_t GetSelectedDigit(const rot_val_st *rval, coord_t xt);
 static bool IsValidDigit(const rot_val_st *rval, uint8_t digit);
 static coord_t GetDigitCoord(const rot_val_st *rval, uint8_t digitId);
+static void InvalidateDigits(g_obj_st *g_obj, const rot_val_st *rval, int32_t oldVal, int32_t newVal);
 static void KeyboardDecodeBuffer(int32_t *val, uint8_t posDot);
 static void RvalKbdStart(signal_t sig);
 
@@ -450,10 +451,10 @@ static void RotValRefresh(void *_g_obj, void *_obj) {
     if( *(rval->pVar) < rval->min) *(rval->pVar) = rval->min;
     else if( *(rval->pVar) > rval->max) *(rval->pVar) = rval->max;
 
-    /*changed pVar? -> refresh*/
+    /*changed pVar? -> refresh the changed digits only*/
     if( *(rval->pVar) != rval->oldVal) {
+      InvalidateDigits(g_obj, rval, rval->oldVal, *(rval->pVar));
       rval->oldVal = *(rval->pVar);
-      bRefresh = true;
     }
 
     if(bRefresh) GUI_ObjSetNeedRefresh(g_obj, true);
@@ -634,6 +635,44 @@ static coord_t GetDigitCoord(const rot_val_st *rval, uint8_t digitId) {
 }
 
 
+/**
+ * @function InvalidateDigits
+ * @brief request the redraw of the digits which differ between 2 values (whole object if the sign changed)
+ * @param g_obj_st *g_obj: generic object
+ * @param const rot_val_st *rval: pointer to rot value object
+ * @param int32_t oldVal: displayed value
+ * @param int32_t newVal: value to display
+ * @return none
+ */
+static void InvalidateDigits(g_obj_st *g_obj, const rot_val_st *rval, int32_t oldVal, int32_t newVal) {
+
+  uint32_t absOld, absNew;
+  uint8_t digitCnt = 0;
+  rect_st lrec;
+
+  absOld = (oldVal < 0) ? 0u - (uint32_t) oldVal : (uint32_t) oldVal;
+  absNew = (newVal < 0) ? 0u - (uint32_t) newVal : (uint32_t) newVal;
+
+  /*number of digits, from the right one, containing all the differences*/
+  while(absOld != absNew) {
+    absOld /= 10u;
+    absNew /= 10u;
+    digitCnt++;
+  }
+
+  if((oldVal < 0) == (newVal < 0) && digitCnt > 0 && IsValidDigit(rval, digitCnt - 1)) {
+    lrec.x = g_obj->rec.x + GetDigitCoord(rval, digitCnt - 1);
+    lrec.y = g_obj->rec.y;
+    lrec.w = (length_t) (g_obj->rec.x + rval->xUnit - lrec.x);  /*right digit ends at xUnit*/
+    lrec.h = g_obj->rec.h;
+    GUI_ObjInvalidate(g_obj, &lrec);
+  }
+  else {
+    GUI_ObjSetNeedRefresh(g_obj, true);
+  }
+}
+
+
 /**
  * @function RvalDecode
  * @brief handles the keyboard response
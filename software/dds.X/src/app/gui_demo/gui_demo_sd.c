@@ -92,7 +92,7 @@ void Gui_DemoSDHandler(signal_t sig) {
   color_t arCol[wImg * sizeof(color_t)];
   FIL file;
   rect_st rec;
-  int16_t x, y;
+  int16_t y;
   UINT dummy;
 
   switch(sig) {
@@ -143,9 +143,7 @@ void Gui_DemoSDHandler(signal_t sig) {
         f_read(&file, &arCol, wImg * sizeof(color_t), &dummy);
 
         /*put it on the screen*/
-        for(x = 0; x < wImg; x++) {
-          LCD_Put(arCol[x]);
-        }
+        LCD_PutRun(arCol, wImg);
       }
     }
 
@@ -41,13 +41,18 @@ static coord_t _x0, _y0, _x1, _y1;
  */
 static void TestFillPoly(void);
 static void TestFont(void);
+static void TestFontCache(void);
 static void TestSprite(void);
 static void TestFillrect(void);
 static void TestRect(void);
 static void TestFillCircle(void);
 static void TestCircle(void);
+static void TestCircleAA(void);
 static void TestLine(void);
 static void TestPixel(void);
+static void TestScroll(void);
+static void TestBand(void);
+static void DrawBandScene(const rect_st *area);
 static void StartTest(const void *title);
 static void EndTest(const void *str);
 static void WdtCallback(void);
@@ -70,13 +75,17 @@ void P2D_Demo(signal_t sig) {
 
   TestFillPoly();
   TestFont();
+  TestFontCache();
   TestSprite();
   TestFillrect();
   TestRect();
   TestFillCircle();
   TestCircle();
+  TestCircleAA();
   TestLine();
   TestPixel();
+  TestScroll();
+  TestBand();
 
   /*return to demo menu*/
   GUI_SetUserTask(Gui_Demo);
@@ -103,6 +112,7 @@ static void TestFillPoly(void) {
   point_st ar[NB_POINT] = { {100,100}, {150,150}, {120,140}, {150,200}, {50 ,200}, {80 ,140}, {50, 150} };
   point_st arTmp[NB_POINT];
   point_st ref;
+  xform_st m;
 
   /*surface creation*/
   dim.w = 160;
@@ -139,12 +149,12 @@ static void TestFillPoly(void) {
   /*main loop*/
   while(done == 0) {
 
-    /* copy the polygon points list in another points list
-     * this step is mandatory because of the successive P2D_P_Rotate() function calls;
-     * this function usually introduces rounding errors, and will distort the polygon
+    /* rotate the polygon into another points list (Q16 angle)
+     * the source points are never modified: successive rotations of the same points
+     * would accumulate rounding errors, and distort the polygon
      */
-    P2D_P_Copy(ar, arTmp, NB_POINT);
-    P2D_P_Rotate(arTmp, NB_POINT, &ref, angle);
+    P2D_XformInit(&m, &ref, angle, 100, 0, 0);
+    P2D_P_Transform(ar, arTmp, NB_POINT, &m);
 
     /*put next operation in the internal surface*/
     P2D_SetDest(surface);
@@ -167,7 +177,7 @@ static void TestFillPoly(void) {
     P2D_SetDest(SURFACE_LCD);
     P2D_CopySurface(surface, &src, &dst);
 
-    angle += 5;
+    angle += 910; /*5 degrees*/
     frame++;
   }
 
@@ -211,6 +221,45 @@ static void TestFont(void) {
 }
 
 
+/**
+ * @function TestFontCache
+ * @brief 4BPP font throughput, glyph cache cold then warm
+ * @param none
+ * @return none
+ */
+static void TestFontCache(void) {
+  uint32_t cntCold = 0, cntWarm = 0;
+  char str[50];
+  const char *testStr = "0123456789";
+
+  StartTest("Glyph cache cold / warm");
+
+  P2D_SetFont(FontFreeSerif_4bpp_n_16);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_SetColors(COLOR_WHITE, COLOR_BLACK);
+
+  /*cold: the cache is flushed before each string, so that each glyph is shaded again*/
+  while(done == 0) {
+    P2D_GlyphCacheFlush();
+    P2D_PutText(P2D_Rand(P2D_GetLcdWidth()), P2D_Rand(P2D_GetLcdHeight()), testStr);
+    cntCold++;
+  }
+
+  /*warm: same glyphs, same colors; each glyph is put from the cache*/
+  done = 0;
+  TicksSetWatchdog(WdtCallback, TIME_TEST);
+  while(done == 0) {
+    P2D_PutText(P2D_Rand(P2D_GetLcdWidth()), P2D_Rand(P2D_GetLcdHeight()), testStr);
+    cntWarm++;
+  }
+
+  cntCold *= strlen(testStr);
+  cntWarm *= strlen(testStr);
+  sprintf(str, "%d / %d glyphs/s", cntCold * 1000 / TIME_TEST, cntWarm * 1000 / TIME_TEST);
+  EndTest(str);
+}
+
+
 /**
  * @function TestSprite
  * @brief 8BPP sprite demo
@@ -371,6 +420,37 @@ static void TestCircle(void) {
 }
 
 
+/**
+ * @function TestCircleAA
+ * @brief anti-aliased circle & line demo
+ * @param none
+ * @return none
+ */
+static void TestCircleAA(void) {
+  uint32_t px = 0;
+  coord_t x0, y0;
+  uint8_t r;
+  char str[50];
+
+  StartTest("Random clipped AA circle & line");
+
+  while(done == 0) {
+
+    x0 = P2D_Rand(P2D_GetLcdWidth());
+    y0 = P2D_Rand(P2D_GetLcdHeight());
+    r = (uint8_t) P2D_Rand(50);
+    P2D_SetColors(P2D_Rand(0xFFFF), COLOR_BLACK);
+    P2D_CircleAA(x0, y0, r);
+    P2D_LineAA(x0 - r, y0 + r, x0 + r, y0 - r);
+
+    px++;
+  }
+
+  sprintf(str, "%d circle/s", px * 1000 / TIME_TEST);
+  EndTest(str);
+}
+
+
 /**
  * @function TestLine
  * @brief line demo
@@ -430,6 +510,114 @@ static void TestPixel(void) {
 }
 
 
+/**
+ * @function TestScroll
+ * @brief hardware scroll test: text lines added at the bottom of the screen, as a terminal
+ * @param none
+ * @return none
+ */
+static void TestScroll(void) {
+  uint32_t lines = 0;
+  rect_st rec, recLine;
+  length_t hLine;
+  char str[50];
+
+  StartTest("Hardware scroll, text lines");
+
+  /*the whole screen is scrolled; only the exposed line is drawn*/
+  P2D_SetClip(NULL);
+  rec.x = 0;
+  rec.y = 0;
+  rec.w = P2D_GetLcdWidth();
+  rec.h = P2D_GetLcdHeight();
+  hLine = P2D_GetTextHeight();
+  recLine = rec;
+  recLine.y = (coord_t) (rec.h - hLine);
+  recLine.h = hLine;
+
+  while(done == 0 && P2D_ScrollV(&rec, (coord_t) hLine) == 0) {
+
+    P2D_SetColor(COLOR_BLACK);
+    P2D_FillRect(&recLine);
+    P2D_SetColors(P2D_Rand(0xFFFF), COLOR_BLACK);
+    sprintf(str, "line %d", lines);
+    P2D_PutText(_x0, recLine.y, str);
+
+    lines++;
+  }
+
+  sprintf(str, "%d line/s", lines * 1000 / TIME_TEST);
+  EndTest(str);
+}
+
+
+/**
+ * @function TestBand
+ * @brief band rendering benchmark: the same scene drawn on the screen directly, then in bands of several heights
+ * @param none
+ * @return none
+ */
+static void TestBand(void) {
+  static const length_t arBandH[] = {0, 1, 2, 4, 8};  /*0: drawn on the screen directly*/
+  uint32_t arCnt[sizeof(arBandH) / sizeof(arBandH[0])];
+  uint8_t ii, n = sizeof(arBandH) / sizeof(arBandH[0]);
+  rect_st rec;
+  char str[50];
+
+  StartTest("Bands: direct/1/2/4/8 lines");
+  P2D_CoordToRect(&rec, _x0+1, _y0+1, _x1-1, _y1-1);
+
+  /*each mode gets the same share of the test time*/
+  for(ii = 0; ii < n; ii++) {
+    arCnt[ii] = 0;
+    done = 0;
+    TicksSetWatchdog(WdtCallback, TIME_TEST / n);
+
+    while(done == 0) {
+      if(arBandH[ii] == 0) {
+        P2D_SetClip(&rec);
+        DrawBandScene(&rec);
+      }
+      else if(P2D_BandBegin(&rec, arBandH[ii]) == 0) {
+        while(P2D_BandNext(NULL)) DrawBandScene(&rec);
+      }
+      arCnt[ii]++;
+    }
+  }
+
+  sprintf(str, "%d/%d/%d/%d/%d fps", arCnt[0] * n * 1000 / TIME_TEST, arCnt[1] * n * 1000 / TIME_TEST,
+    arCnt[2] * n * 1000 / TIME_TEST, arCnt[3] * n * 1000 / TIME_TEST, arCnt[4] * n * 1000 / TIME_TEST);
+  EndTest(str);
+}
+
+
+/**
+ * @function DrawBandScene
+ * @brief scene of the band rendering benchmark: background & overlapping shapes, always the same
+ * @param const rect_st *area: scene area
+ * @return none
+ */
+static void DrawBandScene(const rect_st *area) {
+  rect_st rec;
+  uint8_t ii;
+
+  P2D_SetColor(COLOR_BLACK);
+  P2D_FillRect(area);
+
+  P2D_RandInit(1);
+  for(ii = 0; ii < 16; ii++) {
+    rec.x = area->x + P2D_Rand(area->w);
+    rec.y = area->y + P2D_Rand(area->h);
+    rec.w = P2D_Rand(area->w / 2);
+    rec.h = P2D_Rand(area->h / 4);
+    P2D_SetColor(P2D_Rand(0xFFFF));
+    P2D_FillRect(&rec);
+    P2D_SetColor(P2D_Rand(0xFFFF));
+    P2D_FillCircle(rec.x, rec.y, P2D_Rand(40));
+  }
+}
+
+
 /**
  * @function StartTest
  * @brief set the test clip & callback
@@ -31,6 +31,7 @@
 #include "p2d_buffer.h"
 #include "p2d_clip.h"
 #include "p2d_colors.h"
+#include "p2d_dlist.h"
 #include "p2d_font.h"
 #include "p2d_geo_circle.h"
 #include "p2d_geo_line.h"
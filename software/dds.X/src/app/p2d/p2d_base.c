@@ -24,6 +24,8 @@
 
 #include "p2d_internal.h"
 
+#define ALPHA_RUN_LEN   64    /*pixels read, blended & written back at once by P2D_FillRectAlpha()*/
+
 
 /**
  * @function P2D_Init
@@ -41,7 +43,9 @@ void P2D_Init(void) {
   P2D_SetColors(COLOR_BLACK, COLOR_BLACK);
   P2D_SetAlpha(255);
   P2D_SetLineType(LINE_SOLID);
+  P2D_SetFillRule(FILL_EVEN_ODD);
   P2D_SetFont(NULL);
+  P2D_GlyphCacheFlush();
 
   /*clear screen*/
   P2D_SetClip(NULL);
@@ -118,7 +122,7 @@ void P2D_SetAlpha(uint8_t a) {
 
 /**
  * @function P2D_SetLineType
- * @brief sets the line type (solid line, dotted line)
+ * @brief sets the line type (solid line, dotted line, or any dash pattern)
  * @param line_t: line type
  * @return none
  */
@@ -127,6 +131,17 @@ void P2D_SetLineType(line_t type) {
 }
 
 
+/**
+ * @function P2D_SetFillRule
+ * @brief sets the rule which decides what is inside a filled polygon
+ * @param fill_t rule: FILL_EVEN_ODD / FILL_NON_ZERO
+ * @return none
+ */
+void P2D_SetFillRule(fill_t rule) {
+  context.fillRule = rule;
+}
+
+
 /**
  * @function P2D_SetPixel
  * @brief Put a pixel on current surface
@@ -143,6 +158,20 @@ void P2D_SetPixel(coord_t x, coord_t y, color_t col) {
 }
 
 
+/**
+ * @function P2D_SetPixelAA
+ * @brief Put a pixel of the front color, blended on the background color
+ * @param coord_t x: position x, in pixels
+ * @param coord_t y: position y; in pixels
+ * @param uint8_t alpha: coverage of the pixel; 0: nothing is put, 255: front color
+ * @return none
+ */
+void P2D_SetPixelAA(coord_t x, coord_t y, uint8_t alpha) {
+  if(alpha == 255) P2D_SetPixel(x, y, context.colFront);
+  else if(alpha > 0) P2D_SetPixel(x, y, P2D_Alpha_a_on_b(context.colFront, context.colBackgrnd, alpha));
+}
+
+
 /**
  * @function P2D_Clear
  * @brief clears the current surface within the current clip
@@ -188,7 +217,7 @@ void P2D_Line(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
   }
   /*else (dashed vertical line, random line, ...), put pixel per pixel -> slower*/
   else {
-    P2D_Gline(x0, y0, x1, y1);
+    if(bListRec == false || ListLine(x0, y0, x1, y1) == false) P2D_Gline(x0, y0, x1, y1);
   }
 }
 
@@ -225,10 +254,80 @@ void P2D_FillRect(const rect_st *rec) {
     P2D_ClipFit(&lrect);
     pxCnt = P2D_GetPixelCnt(&lrect);
 
-    if(pxCnt > 0) {
+    /*while recording, the fill is drawn on replay*/
+    if(pxCnt > 0 && (bListRec == false || ListRect(DL_FILL_RECT, &lrect) == false)) {
       SetWnd(&lrect);
-      while(pxCnt-- > 0) Put(context.colFront);
+      PutN(context.colFront, pxCnt);
       SetWnd(NULL); /*always restore full screen window*/
     }
   }
 }
+
+
+/**
+ * @function P2D_FillRectAlpha
+ * @brief draw a translucent filled rectangle: the front color is blended (current alpha) on the surface content,
+ *        read back from the surface (software surface or LCD GRAM)
+ * @param const rect_st *rec: rectangle parameters
+ * @return none
+ */
+void P2D_FillRectAlpha(const rect_st *rec) {
+  rect_st lrect;
+  color_t arPix[ALPHA_RUN_LEN];
+  coord_t x, y;
+  length_t n, rem;
+
+  if(rec != NULL) {
+
+    /*opaque: plain fill*/
+    if(context.alpha == 255) {
+      P2D_FillRect(rec);
+    }
+    else if(context.alpha > 0) {
+      lrect = *rec;
+      P2D_ClipFit(&lrect);
+
+      if(P2D_GetPixelCnt(&lrect) > 0 && (bListRec == false || ListRect(DL_FILL_RECT_ALPHA, &lrect) == false)) {
+
+        /*read, blend & write back each line by runs of ALPHA_RUN_LEN pixels*/
+        for(y = lrect.y; y < lrect.y + (coord_t) lrect.h; y++) {
+          x = lrect.x;
+          rem = lrect.w;
+          while(rem > 0) {
+            n = (rem > ALPHA_RUN_LEN) ? ALPHA_RUN_LEN : rem;
+            SetPos(x, y);
+            GetRun(arPix, n);
+            P2D_AlphaBlendRun(arPix, n, context.colFront, context.alpha);
+            SetPos(x, y);
+            PutRun(arPix, n);
+            x += (coord_t) n;
+            rem -= n;
+          }
+        }
+      }
+    }
+  }
+}
+
+
+/**
+ * @function P2D_ScrollV
+ * @brief move the content of an area up by dy lines (down if dy < 0), without redrawing it; the lines exposed
+ *        at the bottom (top if dy < 0) are not cleared and shall be redrawn by the caller.
+ *        Software surfaces: any area. LCD: hardware scroll, the whole screen only (see LCD_ScrollV)
+ * @param const rect_st *rec: area; clipped to the current clip
+ * @param coord_t dy: number of lines, range[-(rec->h-1) - (rec->h-1)]
+ * @return int8_t: 0 success, -1 error (not supported by the current surface: the area shall be redrawn)
+ */
+int8_t P2D_ScrollV(const rect_st *rec, coord_t dy) {
+  rect_st lrect;
+  int8_t res = -1;
+
+  if(rec != NULL) {
+    lrect = *rec;
+    P2D_ClipFit(&lrect);
+    if(P2D_GetPixelCnt(&lrect) > 0) res = ScrollV(&lrect, dy);
+  }
+
+  return res;
+}
@@ -27,13 +27,15 @@
 #include "p2d.h"
 
 /**
- * @enum line_t LINE_SOLID: continuous line
- * @enum line_t LINE_DOT: one pixel on, one pixel off
+ * line_t: dash pattern of the lines, 16 pixels, MSB first; repeated along the line from its first point
+ * bit set: front color; bit clear: background color if DISPLAY_SOLID, nothing if DISPLAY_TRANSPARENT
  */
-typedef enum {
-  LINE_SOLID,
-  LINE_DOT
-} line_t;
+typedef uint16_t line_t;
+
+#define LINE_SOLID      (line_t) 0xFFFF   /*continuous line*/
+#define LINE_DOT        (line_t) 0xAAAA   /*one pixel on, one pixel off*/
+#define LINE_DASH       (line_t) 0xFF00   /*8 pixels on, 8 pixels off*/
+#define LINE_DASH_DOT   (line_t) 0xFE10   /*7 pixels on, 3 off, 1 on, 4 off*/
 
 /**
  * @enum dmode_t DISPLAY_SOLID: put all pixels
@@ -44,6 +46,15 @@ typedef enum {
   DISPLAY_TRANSPARENT = 0x01
 } dmode_t;
 
+/**
+ * @enum fill_t FILL_EVEN_ODD: a point is inside if any ray from it crosses an odd number of edges
+ * @enum fill_t FILL_NON_ZERO: a point is inside if the edges winding around it do not cancel out
+ */
+typedef enum {
+  FILL_EVEN_ODD,
+  FILL_NON_ZERO
+} fill_t;
+
 
 /**
  * @function P2D_Init
@@ -103,12 +114,20 @@ void P2D_SetAlpha(uint8_t a);
 
 /**
  * @function P2D_SetLineType
- * @brief sets the line type (solid line, dotted line)
+ * @brief sets the line type (solid line, dotted line, or any dash pattern)
  * @param line_t: line type
  * @return none
  */
 void P2D_SetLineType(line_t type);
 
+/**
+ * @function P2D_SetFillRule
+ * @brief sets the rule which decides what is inside a filled polygon
+ * @param fill_t rule: FILL_EVEN_ODD / FILL_NON_ZERO
+ * @return none
+ */
+void P2D_SetFillRule(fill_t rule);
+
 /**
  * @function P2D_SetPixel
  * @brief Put a pixel on current surface
@@ -119,6 +138,16 @@ void P2D_SetLineType(line_t type);
  */
 void P2D_SetPixel(coord_t x, coord_t y, color_t col);
 
+/**
+ * @function P2D_SetPixelAA
+ * @brief Put a pixel of the front color, blended on the background color
+ * @param coord_t x: position x, in pixels
+ * @param coord_t y: position y; in pixels
+ * @param uint8_t alpha: coverage of the pixel; 0: nothing is put, 255: front color
+ * @return none
+ */
+void P2D_SetPixelAA(coord_t x, coord_t y, uint8_t alpha);
+
 /**
  * @function P2D_Clear
  * @brief clears the current surface within the current clip
@@ -152,4 +181,24 @@ void P2D_Rect(const rect_st *rec);
  */
 void P2D_FillRect(const rect_st *rec);
 
+/**
+ * @function P2D_FillRectAlpha
+ * @brief draw a translucent filled rectangle: the front color is blended (current alpha) on the surface content,
+ *        read back from the surface (software surface or LCD GRAM)
+ * @param const rect_st *rec: rectangle parameters
+ * @return none
+ */
+void P2D_FillRectAlpha(const rect_st *rec);
+
+/**
+ * @function P2D_ScrollV
+ * @brief move the content of an area up by dy lines (down if dy < 0), without redrawing it; the lines exposed
+ *        at the bottom (top if dy < 0) are not cleared and shall be redrawn by the caller.
+ *        Software surfaces: any area. LCD: hardware scroll, the whole screen only (see LCD_ScrollV)
+ * @param const rect_st *rec: area; clipped to the current clip
+ * @param coord_t dy: number of lines, range[-(rec->h-1) - (rec->h-1)]
+ * @return int8_t: 0 success, -1 error (not supported by the current surface: the area shall be redrawn)
+ */
+int8_t P2D_ScrollV(const rect_st *rec, coord_t dy);
+
 #endif
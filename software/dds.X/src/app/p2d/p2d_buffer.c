@@ -38,6 +38,12 @@ static length_t GetHeightBuffer(void);
 static void SetWndBuffer(const rect_st *wnd);
 static void SetCursorBuffer(coord_t _x, coord_t _y);
 static void PutBuffer(color_t col);
+static void PutNBuffer(color_t col, uint32_t n);
+static void PutRunBuffer(const color_t *src, uint32_t n);
+static void PutLut8RunBuffer(const uint8_t *src, const color_t *lut, uint32_t n);
+static void GetRunBuffer(color_t *dst, uint32_t n);
+static int8_t ScrollVBuffer(const rect_st *rec, coord_t dy);
+static color_t *NextSpanBuffer(uint32_t *pN);
 static void PutFast(const rect_st *dst, const color_t *srcRaw, uint32_t pxCnt);
 static void PutSlow(const rect_st *dst, const rect_st *src, const surface_t *surface);
 
@@ -54,6 +60,21 @@ static rect_st *dim;      /*surface dimension; only w & h are used*/
 static color_t *raw;      /*pointer to raw data*/
 static coord_t x, y;      /*surface cursor position*/
 static coord_t wx0, wx1, wy0, wy1;  /*surface software window, in abs coordinates*/
+static rect_st lcdClip;   /*LCD clip, saved while drawing in a software surface*/
+static bool bDestLcd = true;  /*the LCD (or the band standing for it) is the current surface*/
+
+/**
+ * Band rendering: an area of the LCD is drawn band after band in a small buffer, each band
+ * being sent to the LCD in one burst. The buffer holds 2 bands: one is drawn while the other is sent
+ */
+static color_t *bandRaw = NULL;   /*band buffer, allocated once*/
+static uint32_t bandPxMax = 0;    /*pixels per band (half of the band buffer)*/
+static uint8_t bandHalf = 0;      /*half of the band buffer used by the current band*/
+static surface_t band = {NULL, {0, 0, 0, 0}};  /*current band; dim in LCD coordinates*/
+static rect_st bandArea;          /*area being drawn*/
+static length_t bandH;            /*height of the bands*/
+static rect_st bandClip;          /*LCD clip, restored at the end of the area*/
+static bool bBand = false;        /*band rendering in progress: the band stands for the LCD*/
 
 
 /**
@@ -169,22 +190,36 @@ void P2D_SurfaceDelete(surfaceId_t id) {
 surfaceId_t P2D_SetDest(surfaceId_t id) {
 
   surfaceId_t res = SURFACE_LCD;
+  bool bFromLcd = bDestLcd;
+
+  /*the display list is drawn on the surface it was recorded for*/
+  ListSuspend();
 
   /*check if surface is valid*/
   if(id >= SURFACE_1 && id < SURFACE_NUMBER) {
     if(arSurface[id].raw != NULL && P2D_GetPixelCnt(&arSurface[id].dim) > 0) {
+      if(bFromLcd) lcdClip = context.clip;
       res = id;
       dim = &arSurface[id].dim;
       raw = arSurface[id].raw;
     }
   }
-  else {
-    raw = NULL;
+
+  /*during band rendering, the LCD is replaced by the current band, which is a software surface*/
+  if(res == SURFACE_LCD && bBand) {
+    dim = &band.dim;
+    raw = band.raw;
   }
 
   /*assign new function pointers*/
-  if(res == SURFACE_LCD) {
+  if(res == SURFACE_LCD && bBand == false) {
+    raw = NULL;
     Put = LCD_Put;
+    PutN = LCD_PutN;
+    PutRun = LCD_PutRun;
+    PutLut8Run = LCD_PutLut8Run;
+    GetRun = LCD_GetRun;
+    ScrollV = LCD_ScrollV;
     SetWnd = LCD_SetWnd;
     SetPos = LCD_SetPos;
     GetWidth = LCD_GetWidth;
@@ -192,15 +227,26 @@ surfaceId_t P2D_SetDest(surfaceId_t id) {
   }
   else {
     Put = PutBuffer;
+    PutN = PutNBuffer;
+    PutRun = PutRunBuffer;
+    PutLut8Run = PutLut8RunBuffer;
+    GetRun = GetRunBuffer;
+    ScrollV = ScrollVBuffer;
     SetWnd = SetWndBuffer;
     SetPos = SetCursorBuffer;
     GetWidth = GetWidthBuffer;
     GetHeight = GetHeightBuffer;
   }
 
-  /*reset surface clip & window*/
-  P2D_SetClip(NULL);
+  /**
+   * reset surface clip & window; when coming back to the LCD, its clip is restored,
+   * so that a double buffered object is flipped only within its damaged part
+   */
+  bDestLcd = (res == SURFACE_LCD) ? true : false;
+  if(res == SURFACE_LCD && bFromLcd == false) P2D_SetClip(&lcdClip);
+  else P2D_SetClip(NULL);
   SetWnd(NULL);
+  ListResume();
 
   return res;
 }
@@ -251,6 +297,135 @@ void P2D_CopySurface(surfaceId_t from, const rect_st *src, const rect_st *dst) {
 }
 
 
+/**
+ * @function P2D_GetDestRect
+ * @brief return the area covered by the current surface: whole LCD, software surface, or current band
+ * @param rect_st *rec: output area, in the coordinates of the surface
+ * @return none
+ */
+void P2D_GetDestRect(rect_st *rec) {
+  if(raw == NULL) {
+    rec->x = 0;
+    rec->y = 0;
+    rec->w = GetWidth();
+    rec->h = GetHeight();
+  }
+  else {
+    *rec = *dim;
+  }
+}
+
+
+/**
+ * @function P2D_BandInit
+ * @brief allocate the band buffer, once for all (salloc); it holds 2 bands, so that one is drawn while the other is sent
+ * @param uint32_t pxCnt: size of the buffer, in pixels
+ * @return int8_t: 0 success, -1 error (no memory, or already allocated)
+ */
+int8_t P2D_BandInit(uint32_t pxCnt) {
+
+  int8_t res = -1;
+
+  if(bandRaw == NULL && pxCnt >= 2) {
+    bandRaw = salloc(pxCnt * sizeof(color_t));
+    if(bandRaw != NULL) {
+      bandPxMax = pxCnt / 2;
+      res = 0;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function P2D_BandBegin
+ * @brief start the band rendering of an area of the LCD; the LCD shall be the current surface
+ * @param const rect_st *area: area to draw
+ * @param length_t hMax: maximal height of the bands; 0: as high as the band buffer allows
+ * @return int8_t: 0 success (call P2D_BandNext() until it returns false), -1 error (area wider than a band, or no band buffer)
+ */
+int8_t P2D_BandBegin(const rect_st *area, length_t hMax) {
+
+  rect_st lcdRect;
+  int8_t res = -1;
+
+  if(area != NULL && bandRaw != NULL && bBand == false && raw == NULL) {
+
+    /*the area is limited to the LCD*/
+    bandArea = *area;
+    P2D_GetDestRect(&lcdRect);
+    P2D_Clip(&bandArea, &lcdRect);
+
+    if(P2D_GetPixelCnt(&bandArea) > 0 && bandArea.w <= bandPxMax) {
+      bandH = (length_t) (bandPxMax / bandArea.w);
+      if(hMax > 0 && hMax < bandH) bandH = hMax;
+
+      /*empty band above the area: the first P2D_BandNext() sends nothing*/
+      band.dim = bandArea;
+      band.dim.h = 0;
+      bandClip = context.clip;
+      bBand = true;
+      res = 0;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function P2D_BandNext
+ * @brief send the current band to the LCD, then select the next one as the current surface, with a clip set to it
+ * @param rect_st *pBand: if not NULL, output area of the next band (LCD coordinates)
+ * @return bool: true: a band has to be drawn; false: the area is complete, the LCD is the current surface again
+ */
+bool P2D_BandNext(rect_st *pBand) {
+
+  coord_t yEnd;
+  bool res = false;
+
+  /*the display list is drawn in the band before it is sent*/
+  ListSuspend();
+
+  if(bBand) {
+
+    /*send the finished band in one burst; the DMA reads it while the next band is drawn in the other half*/
+    if(band.dim.h > 0) {
+      LCD_SetWnd(&band.dim);
+      LCD_PutRunAsync(band.raw, P2D_GetPixelCnt(&band.dim), NULL);
+      band.dim.y += (coord_t) band.dim.h;
+    }
+
+    yEnd = bandArea.y + (coord_t) bandArea.h;
+    if(band.dim.y < yEnd) {
+
+      /**
+       * next band, in the other half of the buffer; the DMA transfer which used this half is over,
+       * since the transfer of the current band could not start before its end
+       */
+      band.dim.h = bandH;
+      if(band.dim.y + (coord_t) bandH > yEnd) band.dim.h = (length_t) (yEnd - band.dim.y);
+      bandHalf ^= 1;
+      band.raw = &bandRaw[bandHalf * bandPxMax];
+      (void) P2D_SetDest(SURFACE_LCD);
+      if(pBand != NULL) *pBand = band.dim;
+      res = true;
+    }
+    else {
+      /*back to the LCD, with its previous clip*/
+      bBand = false;
+      (void) P2D_SetDest(SURFACE_LCD);
+      P2D_SetClip(&bandClip);
+    }
+  }
+
+  ListResume();
+
+  return res;
+}
+
+
 /**
  * @function PutFast
  * @brief optimized copy procedure
@@ -261,11 +436,12 @@ void P2D_CopySurface(surfaceId_t from, const rect_st *src, const rect_st *dst) {
  */
 static void PutFast(const rect_st *dst, const color_t *srcRaw, uint32_t pxCnt) {
 
-  /*set a hardware window & just put the sprite stream*/
+  /*set a hardware window & just put the sprite stream; LCD: DMA straight from the surface, no intermediate copy*/
   SetWnd(dst);
-  while(pxCnt-- > 0) Put(*srcRaw++);
+  if(raw == NULL) LCD_PutRunAsync(srcRaw, pxCnt, NULL);
+  else PutRun(srcRaw, pxCnt);
 
-  /*restore full screen window*/
+  /*restore full screen window (waits for the end of the DMA transfer: the surface may be modified or deleted next)*/
   SetWnd(NULL);
 
 }
@@ -281,10 +457,9 @@ static void PutFast(const rect_st *dst, const color_t *srcRaw, uint32_t pxCnt) {
  */
 static void PutSlow(const rect_st *dst, const rect_st *src, const surface_t *surface) {
 
-  coord_t sx, sy, dx, dy;
+  coord_t sy, dy;
   const color_t *srcRaw;
 
-  dx = dst->x;
   dy = dst->y;
 
   /*for each line...*/
@@ -292,40 +467,34 @@ static void PutSlow(const rect_st *dst, const rect_st *src, const surface_t *sur
 
     /*gets the address of the corresponding line of source surface*/
     srcRaw = &(surface->raw[src->x + sy * surface->dim.w]);
-    SetPos(dx, dy);
-
-    /*for each pixel...*/
-    for(sx = 0; sx < dst->w; sx++) {
-      Put(*srcRaw);
-      srcRaw++;
-      dx++;
-    }
+    SetPos(dst->x, dy);
 
+    /*put the whole line*/
+    PutRun(srcRaw, dst->w);
     dy++;
-    dx = dst->x;
   }
 }
 
 
 /**
  * @function GetWidthBuffer
- * @brief return the absolute width of the current surface
+ * @brief return the absolute width of the current surface (a band may not start at x = 0)
  * @param none
  * @return length_t: width
  */
 static length_t GetWidthBuffer(void) {
-  return dim->w;
+  return dim->x + dim->w;
 }
 
 
 /**
  * @function GetHeightBuffer
- * @brief return the absolute height of the current surface
+ * @brief return the absolute height of the current surface (a band may not start at y = 0)
  * @param none
  * @return length_t: height
  */
 static length_t GetHeightBuffer(void) {
-  return dim->h;
+  return dim->y + dim->h;
 }
 
 
@@ -378,7 +547,7 @@ static void SetCursorBuffer(coord_t _x, coord_t _y) {
  */
 static void PutBuffer(color_t col) {
 
-  raw[(uint32_t)dim->w * y + x] = col;
+  raw[(uint32_t)dim->w * (uint32_t) (y - dim->y) + (uint32_t) (x - dim->x)] = col;
 
   /*cursor increment*/
   x++;
@@ -392,3 +561,164 @@ static void PutBuffer(color_t col) {
     }
   }
 }
+
+
+/**
+ * @function PutNBuffer
+ * @brief put n pixels of the same color on the current surface and increase the cursor
+ * @param color_t col: pixel color
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutNBuffer(color_t col, uint32_t n) {
+
+  color_t *p;
+  uint32_t cnt;
+
+  while(n > 0) {
+    cnt = n;
+    p = NextSpanBuffer(&cnt);
+    n -= cnt;
+    while(cnt-- > 0) *p++ = col;
+  }
+}
+
+
+/**
+ * @function PutRunBuffer
+ * @brief put n pixels from an array on the current surface and increase the cursor
+ * @param const color_t *src: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutRunBuffer(const color_t *src, uint32_t n) {
+
+  color_t *p;
+  uint32_t cnt;
+
+  while(n > 0) {
+    cnt = n;
+    p = NextSpanBuffer(&cnt);
+    n -= cnt;
+    while(cnt-- > 0) *p++ = *src++;
+  }
+}
+
+
+/**
+ * @function PutLut8RunBuffer
+ * @brief put n pixels from an array of 8bit indexes, through a lut, on the current surface and increase the cursor
+ * @param const uint8_t *src: pixel indexes
+ * @param const color_t *lut: lut
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutLut8RunBuffer(const uint8_t *src, const color_t *lut, uint32_t n) {
+
+  color_t *p;
+  uint32_t cnt;
+
+  while(n > 0) {
+    cnt = n;
+    p = NextSpanBuffer(&cnt);
+    n -= cnt;
+    while(cnt-- > 0) *p++ = lut[*src++];
+  }
+}
+
+
+/**
+ * @function GetRunBuffer
+ * @brief read n pixels from the current surface into an array and increase the cursor
+ * @param color_t *dst: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void GetRunBuffer(color_t *dst, uint32_t n) {
+
+  const color_t *p;
+  uint32_t cnt;
+
+  while(n > 0) {
+    cnt = n;
+    p = NextSpanBuffer(&cnt);
+    n -= cnt;
+    while(cnt-- > 0) *dst++ = *p++;
+  }
+}
+
+
+/**
+ * @function ScrollVBuffer
+ * @brief move the content of an area of the current surface up by dy lines (down if dy < 0)
+ * @param const rect_st *rec: area, within the surface
+ * @param coord_t dy: number of lines, range[-(rec->h-1) - (rec->h-1)]
+ * @return int8_t: 0 success, -1 error
+ */
+static int8_t ScrollVBuffer(const rect_st *rec, coord_t dy) {
+
+  color_t *dst;
+  const color_t *src;
+  coord_t y, yStep;
+  length_t cnt, lineCnt;
+  int8_t res = -1;
+
+  /*a band only holds a part of the LCD: scrolling would need the content above or below it*/
+  if(rec != NULL && raw != band.raw && dy > -(coord_t) rec->h && dy < (coord_t) rec->h) {
+
+    /*content moved up: copy from the top line; moved down: from the bottom line (no line is overwritten before being read)*/
+    lineCnt = rec->h - (length_t) P2D_Abs(dy);
+    if(dy > 0) {
+      y = rec->y;
+      yStep = 1;
+    }
+    else {
+      y = rec->y + (coord_t) rec->h - 1;
+      yStep = -1;
+    }
+
+    if(dy != 0) {
+      while(lineCnt-- > 0) {
+        dst = &raw[(uint32_t)dim->w * (uint32_t) y + (uint32_t) rec->x];
+        src = &raw[(uint32_t)dim->w * (uint32_t) (y + dy) + (uint32_t) rec->x];
+        for(cnt = 0; cnt < rec->w; cnt++) *dst++ = *src++;
+        y += yStep;
+      }
+    }
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function NextSpanBuffer
+ * @brief reserve the longest span available on the current line of the window, and increase the cursor after it
+ * @param uint32_t *pN: in: wanted number of pixels (> 0); out: number of pixels of the span
+ * @return color_t *: address of the first pixel of the span
+ */
+static color_t *NextSpanBuffer(uint32_t *pN) {
+
+  color_t *p;
+  uint32_t cnt;
+
+  p = &raw[(uint32_t)dim->w * (uint32_t) (y - dim->y) + (uint32_t) (x - dim->x)];
+
+  /*span limited by the right edge of the window*/
+  cnt = (uint32_t) (wx1 - x) + 1;
+  if(*pN < cnt) cnt = *pN;
+  *pN = cnt;
+
+  /*cursor increment, with the same window check than PutBuffer()*/
+  x += (coord_t) cnt;
+  if(x > wx1) {
+    x = wx0;
+    y++;
+    if(y > wy1) {
+      y = wy0;
+    }
+  }
+
+  return p;
+}
@@ -78,4 +78,37 @@ surfaceId_t P2D_SetDest(surfaceId_t id);
  */
 void P2D_CopySurface(surfaceId_t from, const rect_st *src, const rect_st *dst);
 
+/**
+ * @function P2D_GetDestRect
+ * @brief return the area covered by the current surface: whole LCD, software surface, or current band
+ * @param rect_st *rec: output area, in the coordinates of the surface
+ * @return none
+ */
+void P2D_GetDestRect(rect_st *rec);
+
+/**
+ * @function P2D_BandInit
+ * @brief allocate the band buffer, once for all (salloc); it holds 2 bands, so that one is drawn while the other is sent
+ * @param uint32_t pxCnt: size of the buffer, in pixels
+ * @return int8_t: 0 success, -1 error (no memory, or already allocated)
+ */
+int8_t P2D_BandInit(uint32_t pxCnt);
+
+/**
+ * @function P2D_BandBegin
+ * @brief start the band rendering of an area of the LCD; the LCD shall be the current surface
+ * @param const rect_st *area: area to draw
+ * @param length_t hMax: maximal height of the bands; 0: as high as the band buffer allows
+ * @return int8_t: 0 success (call P2D_BandNext() until it returns false), -1 error (area wider than a band, or no band buffer)
+ */
+int8_t P2D_BandBegin(const rect_st *area, length_t hMax);
+
+/**
+ * @function P2D_BandNext
+ * @brief send the current band to the LCD, then select the next one as the current surface, with a clip set to it
+ * @param rect_st *pBand: if not NULL, output area of the next band (LCD coordinates)
+ * @return bool: true: a band has to be drawn; false: the area is complete, the LCD is the current surface again
+ */
+bool P2D_BandNext(rect_st *pBand);
+
 #endif
@@ -56,10 +56,7 @@ bool P2D_IsCoordInClip(coord_t x, coord_t y) {
 void P2D_SetClip(const rect_st *rec) {
 
   rect_st dimRect;
-  dimRect.x = 0;
-  dimRect.y = 0;
-  dimRect.w = GetWidth();
-  dimRect.h = GetHeight();
+  P2D_GetDestRect(&dimRect);
 
   if(rec == NULL || rec->w == 0 || rec->h == 0) { /*if invalid clip, expand it to the surface dimension*/
     context.clip = dimRect;
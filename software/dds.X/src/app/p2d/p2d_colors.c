@@ -25,6 +25,15 @@
 
 #include "p2d_internal.h"
 
+/**
+ * RGB 5:6:5 spread over 32 bits, for SWAR blending: 0b00000GGGGGG00000RRRRR000000BBBBB
+ * each channel is followed by enough free bits to hold its product with a 5 bit alpha (range[0-32])
+ */
+#define RGB565_MASK_SWAR    0x07E0F81Ful
+#define RGB565_EXPAND(c)    ((((uint32_t) (c) << 16) | (uint32_t) (c)) & RGB565_MASK_SWAR)
+#define RGB565_PACK(x)      ((color_t) (((x) >> 16) | (x)))
+#define ALPHA_TO_5BIT(a)    (((uint32_t) (a) + 4) >> 3)   /*range[0-255] -> range[0-32]*/
+
 
 /**
  * @function P2D_Color
@@ -96,3 +105,48 @@ color_t P2D_Alpha_a_on_b(color_t a, color_t b, uint8_t alpha) {
 
   return P2D_Color(or, og, ob);
 }
+
+
+/**
+ * @function P2D_AlphaBlend
+ * @brief same as P2D_Alpha_a_on_b, but the 3 channels are blended at once within a 32bit word (SWAR),
+ *        with a 5 bit alpha (32 levels); no conversion to RGB 8:8:8
+ * @param color_t a, b: input colors
+ * @param alpha: range[0-255]
+ * @return color_t: corresponding alpha(color A on color B)
+ */
+color_t P2D_AlphaBlend(color_t a, color_t b, uint8_t alpha) {
+  uint32_t a5, xa, xb;
+
+  a5 = ALPHA_TO_5BIT(alpha);
+  xa = RGB565_EXPAND(a);
+  xb = RGB565_EXPAND(b);
+
+  /*a5 * A + (32 - a5) * B: no channel can overflow into the next one*/
+  xb = ((xa * a5 + xb * (32 - a5)) >> 5) & RGB565_MASK_SWAR;
+
+  return RGB565_PACK(xb);
+}
+
+
+/**
+ * @function P2D_AlphaBlendRun
+ * @brief blend a color on each pixel of an array (in place): pix[n] = alpha(col on pix[n])
+ * @param color_t *pix: pixels
+ * @param uint32_t n: number of pixels
+ * @param color_t col: color to put on the pixels
+ * @param alpha: range[0-255]
+ * @return none
+ */
+void P2D_AlphaBlendRun(color_t *pix, uint32_t n, color_t col, uint8_t alpha) {
+  uint32_t a5, aComp, xc, x;
+
+  a5 = ALPHA_TO_5BIT(alpha);
+  aComp = 32 - a5;
+  xc = RGB565_EXPAND(col) * a5;   /*constant part of the blend, computed once*/
+
+  while(n-- > 0) {
+    x = ((RGB565_EXPAND(*pix) * aComp + xc) >> 5) & RGB565_MASK_SWAR;
+    *pix++ = RGB565_PACK(x);
+  }
+}
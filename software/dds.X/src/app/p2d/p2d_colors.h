@@ -62,6 +62,27 @@ color_t P2D_ColorBlackAndWhite(color_t a);
  */
 color_t P2D_Alpha_a_on_b(color_t a, color_t b, uint8_t alpha);
 
+/**
+ * @function P2D_AlphaBlend
+ * @brief same as P2D_Alpha_a_on_b, but the 3 channels are blended at once within a 32bit word (SWAR),
+ *        with a 5 bit alpha (32 levels); no conversion to RGB 8:8:8
+ * @param color_t a, b: input colors
+ * @param alpha: range[0-255]
+ * @return color_t: corresponding alpha(color A on color B)
+ */
+color_t P2D_AlphaBlend(color_t a, color_t b, uint8_t alpha);
+
+/**
+ * @function P2D_AlphaBlendRun
+ * @brief blend a color on each pixel of an array (in place): pix[n] = alpha(col on pix[n])
+ * @param color_t *pix: pixels
+ * @param uint32_t n: number of pixels
+ * @param color_t col: color to put on the pixels
+ * @param alpha: range[0-255]
+ * @return none
+ */
+void P2D_AlphaBlendRun(color_t *pix, uint32_t n, color_t col, uint8_t alpha);
+
 #define COLOR_BLACK         0x0000  /*P2D_Color(0  , 0  , 0  )*/
 #define COLOR_DARK_GREY     P2D_Color(64 , 64 , 64 )
 #define COLOR_GREY          P2D_Color(128, 128, 128)
@@ -0,0 +1,804 @@
+/**
+ * @file p2d_dlist.c
+ * @brief p2d display list: deferred rendering of the drawing primitives
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "p2d_internal.h"
+#include "salloc.h"
+
+
+/**
+ * While recording, the primitives hand their command to List*() once clipped, instead of drawing it.
+ * The arena holds the commands from its start, and the opaque fills (culling rects) from its end.
+ * A state record (context & font) is only inserted when the state differs from the one of the previous command.
+ * On replay:
+ *  - a command whose area lies within a later opaque fill is skipped
+ *  - a state record is only applied before a replayed command, and if it differs from the current state
+ *  - the full screen window restore which ends each primitive is delayed, & dropped if the next command sets its own window
+ * The primitives which are not recorded (pixels, polygons, anti-aliased shapes, surface copies...) still draw directly:
+ * SetWnd/SetPos/ScrollV are hooked during the recording, so that the list is replayed before any direct access.
+ */
+#define DL_ALIGN(n)     (((uint32_t) (n) + sizeof(void *) - 1) & ~((uint32_t) sizeof(void *) - 1))  /*records are aligned on pointers*/
+#define DL_HEAD_SIZE    DL_ALIGN(sizeof(dl_cmd_st))
+#define DL_RECORD_MAX   0xFFFF  /*maximal size of a record*/
+#define DL_OCC_PX_MIN   64      /*opaque fills smaller than this are not used for culling*/
+
+typedef struct {
+  uint8_t op;                 /*dl_op_e*/
+  uint8_t reserved;
+  uint16_t size;              /*size of the record, header included*/
+  rect_st bounds;             /*area the command may change, within the clip; unused by DL_STATE*/
+} dl_cmd_st;
+
+typedef struct {
+  context_st ctx;
+  const uint8_t *font;
+} dl_state_st;
+
+typedef struct {
+  coord_t x0, y0, x1, y1;
+} dl_line_st;
+
+typedef struct {
+  coord_t x0, y0;
+  length_t radius;
+} dl_circle_st;
+
+typedef struct {
+  coord_t x, y;               /*followed by the string*/
+} dl_text_st;
+
+typedef struct {
+  rect_st src;
+  const uint8_t *pFile;
+  lut8bpp_st *lut;
+} dl_sprite_st;
+
+typedef struct {
+  rect_st rec;
+  uint16_t seq;               /*sequence number of the fill, among the drawing commands*/
+} dl_occ_st;
+
+
+/**
+ * Local variables
+ */
+bool bListRec = false;                        /*recording in progress*/
+static uint8_t *arena = NULL;                 /*arena, allocated once*/
+static uint32_t arenaSize = 0;
+static uint32_t used = 0;                     /*bytes of records, from the start of the arena*/
+static uint16_t cmdCnt = 0;                   /*drawing commands in the list*/
+static uint16_t occCnt = 0;                   /*culling rects, from the end of the arena*/
+static dl_state_st recState;                  /*state of the last recorded command*/
+static bool bRecState = false;                /*recState is valid*/
+static bool bHooked = false;                  /*the recording hooks are installed*/
+static bool bWndReset = false;                /*replay: full screen window restore pending*/
+static SetWndFunt_t realSetWnd;               /*surface functions, saved while hooked*/
+static SetPosFunc_t realSetPos;
+static ScrollVFunc_t realScrollV;
+static dlist_stat_st listStat;
+
+
+/**
+ * Local functions
+ */
+static void *Record(dl_op_e op, const rect_st *bounds, uint32_t argSize);
+static void Replay(void);
+static void Play(const dl_cmd_st *cmd);
+static bool IsCulled(uint16_t seq, const rect_st *rec);
+static bool StateEqual(const dl_state_st *st);
+static void StateApply(const dl_state_st *st);
+static void Hook(void);
+static void Unhook(void);
+static void RecSetWnd(const rect_st *rec);
+static void RecSetPos(coord_t x, coord_t y);
+static int8_t RecScrollV(const rect_st *rec, coord_t dy);
+static void PlaySetWnd(const rect_st *rec);
+static void PlaySetPos(coord_t x, coord_t y);
+static int8_t PlayScrollV(const rect_st *rec, coord_t dy);
+static void PlayWndApply(void);
+
+
+/**
+ * @function P2D_ListInit
+ * @brief allocate the display list arena, once for all (salloc)
+ * @param uint32_t size: size of the arena, in bytes
+ * @return int8_t: 0 success, -1 error (no memory, or already allocated)
+ */
+int8_t P2D_ListInit(uint32_t size) {
+
+  int8_t res = -1;
+
+  size &= ~((uint32_t) sizeof(void *) - 1);
+  if(arena == NULL && size >= 2 * (DL_HEAD_SIZE + sizeof(dl_state_st))) {
+    arena = salloc(size);
+    if(arena != NULL) {
+      arenaSize = size;
+      P2D_ListResetStat();
+      res = 0;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function P2D_ListBegin
+ * @brief start recording: the drawing primitives are appended to the display list instead of being drawn;
+ *        the list is replayed by P2D_ListEnd(), or before any direct access to the surface.
+ *        While recording, the luts given to P2D_SpriteSetLut8BPP() shall stay allocated until the replay,
+ *        which updates them again (P2D_UpdateLut8BPP()) before drawing their sprites; P2D_InitLut8BPP() replays the list
+ * @param none
+ * @return int8_t: 0 success, -1 error (no arena, or already recording)
+ */
+int8_t P2D_ListBegin(void) {
+
+  int8_t res = -1;
+
+  if(arena != NULL && bListRec == false) {
+    used = 0;
+    cmdCnt = 0;
+    occCnt = 0;
+    bRecState = false;
+    bListRec = true;
+    Hook();
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function P2D_ListEnd
+ * @brief replay the display list & stop recording
+ * @param none
+ * @return none
+ */
+void P2D_ListEnd(void) {
+  if(bListRec) {
+    Unhook();
+    bListRec = false;
+    Replay();
+  }
+}
+
+
+/**
+ * @function P2D_ListFlush
+ * @brief replay the display list, then go on recording into an empty list
+ * @param none
+ * @return none
+ */
+void P2D_ListFlush(void) {
+  if(bListRec) {
+    Unhook();
+    bListRec = false;
+    Replay();
+    bListRec = true;
+    Hook();
+  }
+}
+
+
+/**
+ * @function P2D_ListIsRecording
+ * @brief return the recording state
+ * @param none
+ * @return bool: true if the drawing primitives are recorded
+ */
+bool P2D_ListIsRecording(void) {
+  return bListRec;
+}
+
+
+/**
+ * @function P2D_ListResetStat
+ * @brief reset the display list statistics
+ * @param none
+ * @return none
+ */
+void P2D_ListResetStat(void) {
+  listStat.recorded = 0;
+  listStat.culled = 0;
+  listStat.replayed = 0;
+  listStat.stateSaved = 0;
+  listStat.wndSaved = 0;
+  listStat.flush = 0;
+  listStat.byteMax = 0;
+}
+
+
+/**
+ * @function P2D_ListGetStat
+ * @brief return the display list statistics, since the last P2D_ListResetStat()
+ * @param dlist_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_ListGetStat(dlist_stat_st *stat) {
+  if(stat != NULL) *stat = listStat;
+}
+
+
+/**
+ * @function ListRect
+ * @brief record a fill (DL_FILL_RECT, opaque) or a translucent fill (DL_FILL_RECT_ALPHA)
+ * @param dl_op_e op: DL_FILL_RECT or DL_FILL_RECT_ALPHA
+ * @param const rect_st *rec: rectangle, already clipped & not empty
+ * @return bool: true if recorded; false: the command shall be drawn now
+ */
+bool ListRect(dl_op_e op, const rect_st *rec) {
+  return Record(op, rec, 0) != NULL;
+}
+
+
+/**
+ * @function ListLine
+ * @brief record a line drawn by P2D_Gline()
+ * @param coord_t x0, coord_t y0: point 0
+ * @param coord_t x1, coord_t y1: point 1
+ * @return bool: true if recorded (or out of the clip); false: the command shall be drawn now
+ */
+bool ListLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+
+  rect_st rec;
+  dl_line_st *arg;
+  bool res = true;
+
+  rec.x = P2D_CoordGetMin(x0, x1);
+  rec.y = P2D_CoordGetMin(y0, y1);
+  rec.w = P2D_GetLengthBtwnCoord(x0, x1);
+  rec.h = P2D_GetLengthBtwnCoord(y0, y1);
+  P2D_ClipFit(&rec);
+
+  if(P2D_GetPixelCnt(&rec) > 0) {
+    arg = Record(DL_LINE, &rec, sizeof(dl_line_st));
+    if(arg != NULL) {
+      arg->x0 = x0;
+      arg->y0 = y0;
+      arg->x1 = x1;
+      arg->y1 = y1;
+    }
+    else {
+      res = false;
+    }
+  }
+  else {
+    listStat.culled++;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ListCircle
+ * @brief record a circle (DL_CIRCLE) or a filled circle (DL_FILL_CIRCLE)
+ * @param dl_op_e op: DL_CIRCLE or DL_FILL_CIRCLE
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param length_t radius: radius
+ * @return bool: true if recorded; false: the command shall be drawn now
+ */
+bool ListCircle(dl_op_e op, coord_t x0, coord_t y0, length_t radius) {
+
+  rect_st rec;
+  dl_circle_st *arg;
+  bool res = true;
+
+  rec.x = x0 - (coord_t) radius;
+  rec.y = y0 - (coord_t) radius;
+  rec.w = 2 * radius + 1;
+  rec.h = rec.w;
+  P2D_ClipFit(&rec);
+
+  if(P2D_GetPixelCnt(&rec) > 0) {
+    arg = Record(op, &rec, sizeof(dl_circle_st));
+    if(arg != NULL) {
+      arg->x0 = x0;
+      arg->y0 = y0;
+      arg->radius = radius;
+    }
+    else {
+      res = false;
+    }
+  }
+  else {
+    listStat.culled++;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ListText
+ * @brief record a text, with the current font; the string is copied into the list
+ * @param coord_t x, coord_t y: position of the text
+ * @param const uint8_t *str: string
+ * @return bool: true if recorded (or out of the clip); false: the command shall be drawn now
+ */
+bool ListText(coord_t x, coord_t y, const uint8_t *str) {
+
+  rect_st rec;
+  dl_text_st *arg;
+  uint8_t *dst;
+  uint32_t len = 0;
+  bool res = true;
+
+  rec.x = x;
+  rec.y = y;
+  rec.w = P2D_GetTextWidth(str);
+  rec.h = P2D_GetTextHeight();
+  P2D_ClipFit(&rec);
+
+  if(P2D_GetPixelCnt(&rec) > 0) {
+    while(str[len] != 0) len++;
+    arg = Record(DL_TEXT, &rec, sizeof(dl_text_st) + len + 1);
+    if(arg != NULL) {
+      arg->x = x;
+      arg->y = y;
+      dst = (uint8_t *) (arg + 1);
+      while(len-- > 0) *dst++ = *str++;
+      *dst = 0;
+    }
+    else {
+      res = false;
+    }
+  }
+  else {
+    listStat.culled++;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ListSprite
+ * @brief record a sprite
+ * @param const rect_st *src: part of the sprite, already clipped
+ * @param const rect_st *dst: destination, already clipped & not empty
+ * @param const uint8_t *pFile: sprite file
+ * @param const lut8bpp_st *lut: lut of 8BPP sprites; updated again at replay (P2D_UpdateLut8BPP())
+ * @return bool: true if recorded; false: the command shall be drawn now
+ */
+bool ListSprite(const rect_st *src, const rect_st *dst, const uint8_t *pFile, const lut8bpp_st *lut) {
+
+  dl_sprite_st *arg;
+
+  arg = Record(DL_SPRITE, dst, sizeof(dl_sprite_st));
+  if(arg != NULL) {
+    arg->src = *src;
+    arg->pFile = pFile;
+    arg->lut = (lut8bpp_st *) lut;
+  }
+
+  return arg != NULL;
+}
+
+
+/**
+ * @function ListSuspend
+ * @brief replay the list & remove the recording hooks, before a change of the surface functions (P2D_SetDest)
+ *        or a direct access to the LCD (P2D_BandNext)
+ * @param none
+ * @return none
+ */
+void ListSuspend(void) {
+  if(bListRec) {
+    Unhook();
+    bListRec = false;
+    Replay();
+    bListRec = true;
+  }
+}
+
+
+/**
+ * @function ListResume
+ * @brief install the recording hooks again on the current surface functions, after ListSuspend()
+ * @param none
+ * @return none
+ */
+void ListResume(void) {
+  if(bListRec) Hook();
+}
+
+
+/**
+ * @function Record
+ * @brief append a drawing command to the list, preceded by a state record if the state has changed;
+ *        the list is replayed first if the arena is full
+ * @param dl_op_e op: command
+ * @param const rect_st *bounds: area the command may change, within the clip (not empty)
+ * @param uint32_t argSize: size of the command arguments
+ * @return void *: command arguments, to be filled by the caller; NULL if the command does not fit in the arena
+ */
+static void *Record(dl_op_e op, const rect_st *bounds, uint32_t argSize) {
+
+  dl_cmd_st *cmd;
+  dl_occ_st *occ;
+  void *res = NULL;
+  uint32_t size, stateSize, occSize;
+
+  size = DL_HEAD_SIZE + DL_ALIGN(argSize);
+  occSize = (op == DL_FILL_RECT && P2D_GetPixelCnt(bounds) >= DL_OCC_PX_MIN) ? sizeof(dl_occ_st) : 0;
+  stateSize = (bRecState && StateEqual(&recState)) ? 0 : DL_HEAD_SIZE + DL_ALIGN(sizeof(dl_state_st));
+
+  /*arena full: replay the list, then record into the empty one (a state record is always needed)*/
+  if(used + stateSize + size + (occCnt * sizeof(dl_occ_st)) + occSize > arenaSize) {
+    P2D_ListFlush();
+    stateSize = DL_HEAD_SIZE + DL_ALIGN(sizeof(dl_state_st));
+  }
+
+  if(size <= DL_RECORD_MAX && used + stateSize + size + (occCnt * sizeof(dl_occ_st)) + occSize <= arenaSize) {
+
+    if(stateSize > 0) {
+      recState.ctx = context;
+      recState.font = P2D_GetFont();
+      bRecState = true;
+      cmd = (dl_cmd_st *) &arena[used];
+      cmd->op = DL_STATE;
+      cmd->size = (uint16_t) stateSize;
+      *((dl_state_st *) &arena[used + DL_HEAD_SIZE]) = recState;
+      used += stateSize;
+    }
+
+    cmd = (dl_cmd_st *) &arena[used];
+    cmd->op = op;
+    cmd->size = (uint16_t) size;
+    cmd->bounds = *bounds;
+    res = &arena[used + DL_HEAD_SIZE];
+    used += size;
+
+    /*opaque fill: culling rect, stored from the end of the arena*/
+    if(occSize > 0) {
+      occ = (dl_occ_st *) &arena[arenaSize] - 1 - occCnt;
+      occ->rec = *bounds;
+      occ->seq = cmdCnt;
+      occCnt++;
+    }
+
+    cmdCnt++;
+    listStat.recorded++;
+    if(used + occCnt * sizeof(dl_occ_st) > listStat.byteMax) listStat.byteMax = used + occCnt * sizeof(dl_occ_st);
+  }
+
+  return res;
+}
+
+
+/**
+ * @function Replay
+ * @brief draw the list, then empty it; the state (context, font, sprite lut) is restored at the end
+ * @param none
+ * @return none
+ */
+static void Replay(void) {
+
+  const dl_cmd_st *cmd;
+  const dl_state_st *pState = NULL;  /*state not applied yet*/
+  dl_state_st saved;
+  const lut8bpp_st *savedLut;
+  uint32_t pos = 0;
+  uint16_t seq = 0;
+
+  if(cmdCnt > 0) {
+
+    saved.ctx = context;
+    saved.font = P2D_GetFont();
+    savedLut = P2D_SpriteGetLut8BPP();
+
+    /*window restores are delayed during the replay*/
+    realSetWnd = SetWnd;
+    realSetPos = SetPos;
+    realScrollV = ScrollV;
+    SetWnd = PlaySetWnd;
+    SetPos = PlaySetPos;
+    ScrollV = PlayScrollV;
+    bWndReset = false;
+
+    while(pos < used) {
+      cmd = (const dl_cmd_st *) &arena[pos];
+
+      if(cmd->op == DL_STATE) {
+        if(pState != NULL) listStat.stateSaved++;
+        pState = (const dl_state_st *) &arena[pos + DL_HEAD_SIZE];
+      }
+      else {
+        if(IsCulled(seq, &cmd->bounds)) {
+          listStat.culled++;
+        }
+        else {
+          if(pState != NULL) {
+            if(StateEqual(pState)) listStat.stateSaved++;
+            else StateApply(pState);
+            pState = NULL;
+          }
+          Play(cmd);
+          listStat.replayed++;
+        }
+        seq++;
+      }
+
+      pos += cmd->size;
+    }
+    if(pState != NULL) listStat.stateSaved++;
+
+    PlayWndApply();
+    SetWnd = realSetWnd;
+    SetPos = realSetPos;
+    ScrollV = realScrollV;
+
+    if(StateEqual(&saved) == false) StateApply(&saved);
+    P2D_SpriteSetLut8BPP(savedLut);
+    listStat.flush++;
+  }
+
+  used = 0;
+  cmdCnt = 0;
+  occCnt = 0;
+  bRecState = false;
+}
+
+
+/**
+ * @function Play
+ * @brief draw a command, with the current state
+ * @param const dl_cmd_st *cmd: command
+ * @return none
+ */
+static void Play(const dl_cmd_st *cmd) {
+
+  const void *arg = (const uint8_t *) cmd + DL_HEAD_SIZE;
+  const dl_line_st *line;
+  const dl_circle_st *circle;
+  const dl_text_st *text;
+  const dl_sprite_st *sprite;
+
+  switch(cmd->op) {
+
+    case DL_FILL_RECT:
+      P2D_FillRect(&cmd->bounds);
+      break;
+
+    case DL_FILL_RECT_ALPHA:
+      P2D_FillRectAlpha(&cmd->bounds);
+      break;
+
+    case DL_LINE:
+      line = (const dl_line_st *) arg;
+      P2D_Gline(line->x0, line->y0, line->x1, line->y1);
+      break;
+
+    case DL_CIRCLE:
+      circle = (const dl_circle_st *) arg;
+      P2D_Circle(circle->x0, circle->y0, circle->radius);
+      break;
+
+    case DL_FILL_CIRCLE:
+      circle = (const dl_circle_st *) arg;
+      P2D_FillCircle(circle->x0, circle->y0, circle->radius);
+      break;
+
+    case DL_TEXT:
+      text = (const dl_text_st *) arg;
+      P2D_PutText(text->x, text->y, text + 1);
+      break;
+
+    case DL_SPRITE:
+      sprite = (const dl_sprite_st *) arg;
+      P2D_SpriteSetLut8BPP(sprite->lut);
+      P2D_UpdateLut8BPP(sprite->lut);
+      P2D_Sprite(&sprite->src, &cmd->bounds, sprite->pFile);
+      break;
+
+    default:
+      break;
+  }
+}
+
+
+/**
+ * @function IsCulled
+ * @brief check if a command is hidden by a later opaque fill
+ * @param uint16_t seq: sequence number of the command
+ * @param const rect_st *rec: area of the command
+ * @return bool: true if hidden
+ */
+static bool IsCulled(uint16_t seq, const rect_st *rec) {
+
+  const dl_occ_st *occ;
+  uint16_t cnt = occCnt;
+  bool res = false;
+
+  /*from the last fill, back to the first one recorded after the command*/
+  occ = (const dl_occ_st *) &arena[arenaSize] - occCnt;
+  while(cnt > 0 && occ->seq > seq && res == false) {
+    res = rec->x >= occ->rec.x && rec->y >= occ->rec.y &&
+          rec->x + (coord_t) rec->w <= occ->rec.x + (coord_t) occ->rec.w &&
+          rec->y + (coord_t) rec->h <= occ->rec.y + (coord_t) occ->rec.h;
+    occ++;
+    cnt--;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function StateEqual
+ * @brief compare a state with the current one
+ * @param const dl_state_st *st: state
+ * @return bool: true if identical
+ */
+static bool StateEqual(const dl_state_st *st) {
+  const context_st *ctx = &st->ctx;
+  return st->font == P2D_GetFont() &&
+         ctx->clip.x == context.clip.x && ctx->clip.y == context.clip.y &&
+         ctx->clip.w == context.clip.w && ctx->clip.h == context.clip.h &&
+         ctx->colFront == context.colFront && ctx->colBackgrnd == context.colBackgrnd &&
+         ctx->mode == context.mode && ctx->alpha == context.alpha &&
+         ctx->lineType == context.lineType && ctx->fillRule == context.fillRule;
+}
+
+
+/**
+ * @function StateApply
+ * @brief set a state as the current one
+ * @param const dl_state_st *st: state
+ * @return none
+ */
+static void StateApply(const dl_state_st *st) {
+  context = st->ctx;
+  if(st->font != P2D_GetFont()) (void) P2D_SetFont(st->font);
+}
+
+
+/**
+ * @function Hook
+ * @brief save the surface functions & replace them by the recording hooks
+ * @param none
+ * @return none
+ */
+static void Hook(void) {
+  if(bHooked == false) {
+    realSetWnd = SetWnd;
+    realSetPos = SetPos;
+    realScrollV = ScrollV;
+    SetWnd = RecSetWnd;
+    SetPos = RecSetPos;
+    ScrollV = RecScrollV;
+    bHooked = true;
+  }
+}
+
+
+/**
+ * @function Unhook
+ * @brief restore the surface functions saved by Hook()
+ * @param none
+ * @return none
+ */
+static void Unhook(void) {
+  if(bHooked) {
+    SetWnd = realSetWnd;
+    SetPos = realSetPos;
+    ScrollV = realScrollV;
+    bHooked = false;
+  }
+}
+
+
+/**
+ * @function RecSetWnd
+ * @brief recording hook: a primitive which is not recorded accesses the surface; the list is replayed before
+ * @param const rect_st *rec: window
+ * @return none
+ */
+static void RecSetWnd(const rect_st *rec) {
+  if(cmdCnt > 0) P2D_ListFlush();
+  realSetWnd(rec);
+}
+
+
+/**
+ * @function RecSetPos
+ * @brief recording hook: a primitive which is not recorded accesses the surface; the list is replayed before
+ * @param coord_t x, coord_t y: cursor position
+ * @return none
+ */
+static void RecSetPos(coord_t x, coord_t y) {
+  if(cmdCnt > 0) P2D_ListFlush();
+  realSetPos(x, y);
+}
+
+
+/**
+ * @function RecScrollV
+ * @brief recording hook: the surface content is moved; the list is replayed before
+ * @param const rect_st *rec: area
+ * @param coord_t dy: number of lines
+ * @return int8_t: result of the surface function
+ */
+static int8_t RecScrollV(const rect_st *rec, coord_t dy) {
+  if(cmdCnt > 0) P2D_ListFlush();
+  return realScrollV(rec, dy);
+}
+
+
+/**
+ * @function PlaySetWnd
+ * @brief replay hook: the full screen window restore is delayed until the next cursor move, or the end of the replay;
+ *        a window set in between makes it useless
+ * @param const rect_st *rec: window; NULL for the full screen
+ * @return none
+ */
+static void PlaySetWnd(const rect_st *rec) {
+  if(rec == NULL) {
+    bWndReset = true;
+  }
+  else {
+    if(bWndReset) listStat.wndSaved++;
+    bWndReset = false;
+    realSetWnd(rec);
+  }
+}
+
+
+/**
+ * @function PlaySetPos
+ * @brief replay hook: apply the pending full screen window, then move the cursor
+ * @param coord_t x, coord_t y: cursor position
+ * @return none
+ */
+static void PlaySetPos(coord_t x, coord_t y) {
+  PlayWndApply();
+  realSetPos(x, y);
+}
+
+
+/**
+ * @function PlayScrollV
+ * @brief replay hook: apply the pending full screen window, then scroll
+ * @param const rect_st *rec: area
+ * @param coord_t dy: number of lines
+ * @return int8_t: result of the surface function
+ */
+static int8_t PlayScrollV(const rect_st *rec, coord_t dy) {
+  PlayWndApply();
+  return realScrollV(rec, dy);
+}
+
+
+/**
+ * @function PlayWndApply
+ * @brief apply the pending full screen window restore, if any
+ * @param none
+ * @return none
+ */
+static void PlayWndApply(void) {
+  if(bWndReset) {
+    bWndReset = false;
+    realSetWnd(NULL);
+  }
+}
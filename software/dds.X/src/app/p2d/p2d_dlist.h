@@ -0,0 +1,102 @@
+/**
+ * @file p2d_dlist.h
+ * @brief p2d display list: deferred rendering of the drawing primitives
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _p2d_dlist_h_
+#define _p2d_dlist_h_
+
+#include "p2d.h"
+
+/**
+ * @typedef dlist_stat_st
+ */
+typedef struct {
+  uint32_t recorded;      /*drawing commands recorded*/
+  uint32_t culled;        /*commands not replayed: hidden by a later opaque rect, or out of the clip*/
+  uint32_t replayed;      /*commands replayed*/
+  uint32_t stateSaved;    /*recorded state changes (clip, colors, mode, alpha, font) which did not need to be applied*/
+  uint32_t wndSaved;      /*full screen window restores skipped between two replayed commands*/
+  uint32_t flush;         /*replays: end of list, full arena, surface change, or direct access to the surface*/
+  uint32_t byteMax;       /*peak arena usage*/
+} dlist_stat_st;
+
+
+/**
+ * @function P2D_ListInit
+ * @brief allocate the display list arena, once for all (salloc)
+ * @param uint32_t size: size of the arena, in bytes
+ * @return int8_t: 0 success, -1 error (no memory, or already allocated)
+ */
+int8_t P2D_ListInit(uint32_t size);
+
+/**
+ * @function P2D_ListBegin
+ * @brief start recording: the drawing primitives are appended to the display list instead of being drawn;
+ *        the list is replayed by P2D_ListEnd(), or before any direct access to the surface.
+ *        While recording, the luts given to P2D_SpriteSetLut8BPP() shall stay allocated until the replay,
+ *        which updates them again (P2D_UpdateLut8BPP()) before drawing their sprites; P2D_InitLut8BPP() replays the list
+ * @param none
+ * @return int8_t: 0 success, -1 error (no arena, or already recording)
+ */
+int8_t P2D_ListBegin(void);
+
+/**
+ * @function P2D_ListEnd
+ * @brief replay the display list & stop recording
+ * @param none
+ * @return none
+ */
+void P2D_ListEnd(void);
+
+/**
+ * @function P2D_ListFlush
+ * @brief replay the display list, then go on recording into an empty list
+ * @param none
+ * @return none
+ */
+void P2D_ListFlush(void);
+
+/**
+ * @function P2D_ListIsRecording
+ * @brief return the recording state
+ * @param none
+ * @return bool: true if the drawing primitives are recorded
+ */
+bool P2D_ListIsRecording(void);
+
+/**
+ * @function P2D_ListResetStat
+ * @brief reset the display list statistics
+ * @param none
+ * @return none
+ */
+void P2D_ListResetStat(void);
+
+/**
+ * @function P2D_ListGetStat
+ * @brief return the display list statistics, since the last P2D_ListResetStat()
+ * @param dlist_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_ListGetStat(dlist_stat_st *stat);
+
+#endif
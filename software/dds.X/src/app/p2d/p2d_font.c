@@ -2,12 +2,13 @@
  * @file p2d_font.c
  * @brief p2d font management (limited to 1BPP and 4BPP)
  * @author Duboisset Philippe
- * @version 0.4b
+ * @version 0.5b
  * @date (yyyy-mm-dd)
  *  0.1b  2013-04-07 initial version
  *  0.2b  2013-07-23 small modification (disp. window restoration to NULL)
  *  0.3b  2013-09-07 implementation of P2D_GetGlyphWidth() & P2D_PutGlyph()
  *  0.4b  2014-01-30 small bug fix (setWnd issue)
+ *  0.5b  2014-07-05 4BPP fonts with trimmed glyph boxes (FONT_4BPP_BOX)
  *
  * Copyright (C) <2013>  Duboisset Philippe <duboisset.philippe@gmail.com>
  *
@@ -35,11 +36,12 @@
 enum {
   FONT_1BPP = 1,
   FONT_4BPP,
+  FONT_4BPP_BOX,
   FONT_INVALID
 };
 
 enum {    /*font file header*/
-  BPP_TYPE = 0,     /*1st byte represents the font type (FONT_1BPP / FONT_4BPP)*/
+  BPP_TYPE = 0,     /*1st byte represents the font type (FONT_1BPP / FONT_4BPP / FONT_4BPP_BOX)*/
   BPP_GMIN,         /*2nd byte is the first glyph ID; e.g. 'a'*/
   BPP_GMAX,         /*3rd byte is the last glyph ID; e.g. 'z'*/
   BPP_HEIGHT,       /*4th byte is the font height (all glyphs have the same height)*/
@@ -52,16 +54,58 @@ enum {    /*glyph entry*/
   BPP_OFFSET_LL,            /*the raw address is located just after the glyph table entries*/
   BPP_ENTRY_SIZE
 };
+enum {    /*glyph entry of a FONT_4BPP_BOX font (see tools/font_box)*/
+  BOX_ENTRY_WIDTH,  /*1st byte is the glyph width (advance); the glyph cell is width x font height*/
+  BOX_X,            /*next bytes are the position & size of the glyph box, relative to the cell;*/
+  BOX_Y,                    /*pixels of the cell outside the box are all 0 (background)*/
+  BOX_W,
+  BOX_H,
+  BOX_OFFSET_HL,    /*glyph offset, as BPP_OFFSET_xx; bit 7 of HL is BOX_RLE*/
+  BOX_OFFSET_LH,
+  BOX_OFFSET_LL,
+  BOX_ENTRY_SIZE
+};
+#define BOX_RLE     0x80  /*box pixels stored as runs [LLLL CCCC]: L + 1 pixels of nibble C, never crossing a row; else raw nibbles*/
 
 /**
  * private variables
  */
-static uint8_t fontType;                    /*type of font*/
+static uint8_t fontType;                    /*type of font; FONT_4BPP_BOX fonts are FONT_4BPP with bBox set*/
+static bool bBox;                           /*true if glyphs are stored as trimmed boxes*/
+static uint8_t entrySize;                   /*size of a glyph table entry*/
 static const uint8_t *index;                /*pointer to the glyph table*/
 static const uint8_t *raw;                  /*pointer to the first glyph*/
 static uint8_t glyphMin, glyphMax;          /*minimum & maximum supported glyph ID (~ASCII code)*/
 static uint8_t height;                      /*font height; all glyph contained in a font have the same height*/
 static lut4bpp_st lut;                      /*local lut, for 4BPP fonts*/
+static const uint8_t *font;                 /*current font file, used as glyph cache key*/
+
+/**
+ * Glyph cache: 4BPP glyphs already shaded through the lut, stored as RGB565 pixels.
+ * The arena is split into blocks of GC_BLOCK_PX pixels; a glyph uses a chain of blocks,
+ * so that evicting any entry gives back memory usable by any other glyph.
+ */
+#define GC_BLOCK_PX     64    /*pixels per arena block*/
+#define GC_BLOCK_CNT    64    /*arena blocks; arena size = GC_BLOCK_CNT * GC_BLOCK_PX * sizeof(color_t) = 8KB*/
+#define GC_ENTRY_CNT    32    /*maximum number of cached glyphs*/
+#define GC_NO_BLOCK     0xFF  /*end of a block chain*/
+
+typedef struct {
+  const uint8_t *font;                      /*font file; NULL if the entry is free*/
+  color_t colFront, colBackgrnd;            /*colors used for shading the glyph*/
+  uint8_t alpha;
+  uint8_t glyph;
+  uint8_t block;                            /*first block of the chain*/
+  uint32_t lastUse;                         /*LRU stamp*/
+} gc_entry_st;
+
+static color_t gcArena[GC_BLOCK_CNT][GC_BLOCK_PX];
+static uint8_t gcNext[GC_BLOCK_CNT];        /*next block of a chain, or of the free list*/
+static uint8_t gcFree, gcFreeCnt;           /*free list head & length*/
+static gc_entry_st gcEntry[GC_ENTRY_CNT];
+static uint32_t gcClock;                    /*incremented at each cache access*/
+static bool bGcEnable = true;
+static glyph_cache_stat_st gcStat;
 
 /**
  * Local functions prototypes
@@ -69,13 +113,25 @@ static lut4bpp_st lut;                      /*local lut, for 4BPP fonts*/
 static int8_t OpenBPP(const uint8_t *fontFile);
 static const uint8_t *GetGlyphAddr(uint8_t id);
 static uint8_t GetGlyphWidth(uint8_t id);
-static void PutGlyph(const rect_st *rec, const uint8_t *ptrGlyph);
-static void PutFast_1BPP(const rect_st *rec, const uint8_t *ptr, uint32_t cntPxClip);
-static void PutSlow_1BPP(const rect_st *rec, const uint8_t *ptr);
+static void PutGlyph(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph);
+static void PutBox(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph);
+static void PutRaw(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph);
+static void PutRle_4BPP(const rect_st *rec, const uint8_t *ptr);
+static void FillClip(coord_t x, coord_t y, coord_t w, coord_t h, color_t col);
+static void PutFast_1BPP(const uint8_t *ptr, uint32_t cntPxClip);
+static void PutSlow_1BPP(const rect_st *rec, const rect_st *clip, const uint8_t *ptr);
 static void NextBit_1BPP(uint8_t *mask, const uint8_t **ptr);
-static void PutFast_4BPP(const rect_st *rec, const uint8_t *ptr, uint32_t cntPxClip);
-static void PutSlow_4BPP(const rect_st *rec, const uint8_t *ptr);
+static void PutFast_4BPP(const uint8_t *ptr, uint32_t cntPxClip);
+static void PutSlow_4BPP(const rect_st *rec, const rect_st *clip, const uint8_t *ptr);
 static void NextBit_4BPP(uint8_t *mask, const uint8_t **ptr);
+static void PutSpanClip(coord_t x0, coord_t x1, coord_t y, color_t col, const rect_st *clip);
+static gc_entry_st *CacheGet(uint8_t id, const uint8_t *ptr, uint16_t cntPx);
+static void CacheEvict(gc_entry_st *e);
+static gc_entry_st *CacheGetLRU(void);
+static void PutCached(const gc_entry_st *e, const rect_st *rec, const rect_st *clip);
+static void PutCachedRange(uint8_t block, uint16_t start, uint16_t n);
+
+#define LUT_RUN_LEN   32  /*PutFast_4BPP(): number of decoded pixels per PutLut8Run()*/
 
 
 /**
@@ -95,6 +151,7 @@ int8_t P2D_SetFont(const uint8_t *pFile) {
 
       case FONT_1BPP:
       case FONT_4BPP:
+      case FONT_4BPP_BOX:
         res = OpenBPP(pFile);
         break;
 
@@ -106,6 +163,10 @@ int8_t P2D_SetFont(const uint8_t *pFile) {
   /*if any error, force current type to FONT_INVALID*/
   if(res < 0) {
     fontType = FONT_INVALID;
+    font = NULL;
+  }
+  else {
+    font = pFile;
   }
 
   /*always initialize the lut for 4BPP fonts*/
@@ -117,6 +178,17 @@ int8_t P2D_SetFont(const uint8_t *pFile) {
 }
 
 
+/**
+ * @function P2D_GetFont
+ * @brief return the current font
+ * @param none
+ * @return const uint8_t *: current font file; NULL if no valid font is set
+ */
+const uint8_t *P2D_GetFont(void) {
+  return font;
+}
+
+
 /**
  * @function P2D_GetTextHeight
  * @brief return the current font height
@@ -198,8 +270,8 @@ void P2D_PutText(coord_t x, coord_t y, const void /*@null@*/ *ptr) {
   rect_st rec;
   const uint8_t *str = (const uint8_t *) ptr;
 
-  /*print something only if the current font is valid & the str is not null*/
-  if(fontType != FONT_INVALID && str != NULL) {
+  /*print something only if the current font is valid & the str is not null; while recording, the text is drawn on replay*/
+  if(fontType != FONT_INVALID && str != NULL && (bListRec == false || ListText(x, y, str) == false)) {
 
     rec.x = x;
     rec.y = y;
@@ -222,7 +294,7 @@ void P2D_PutText(coord_t x, coord_t y, const void /*@null@*/ *ptr) {
         rec.w = GetGlyphWidth(*str);
 
         /*Put he glyph on screen & increment x with the glyph width*/
-        PutGlyph(&rec, ptrGlyph);
+        PutGlyph(&rec, *str, ptrGlyph);
         rec.x += rec.w;
       }
 
@@ -234,6 +306,60 @@ void P2D_PutText(coord_t x, coord_t y, const void /*@null@*/ *ptr) {
 }
 
 
+/**
+ * @function P2D_GlyphCacheEnable
+ * @brief enable or disable the glyph cache of 4BPP fonts (enabled by default)
+ * @param bool bEnable: true for enabling the cache
+ * @return none
+ */
+void P2D_GlyphCacheEnable(bool bEnable) {
+  bGcEnable = bEnable;
+}
+
+
+/**
+ * @function P2D_GlyphCacheFlush
+ * @brief drop all the cached glyphs & reset the cache statistics
+ * @param none
+ * @return none
+ */
+void P2D_GlyphCacheFlush(void) {
+
+  uint8_t i;
+
+  /*all blocks go to the free list*/
+  for(i = 0; i < GC_BLOCK_CNT; i++) gcNext[i] = i + 1;
+  gcNext[GC_BLOCK_CNT - 1] = GC_NO_BLOCK;
+  gcFree = 0;
+  gcFreeCnt = GC_BLOCK_CNT;
+
+  for(i = 0; i < GC_ENTRY_CNT; i++) gcEntry[i].font = NULL;
+  gcClock = 0;
+  gcStat.hit = 0;
+  gcStat.miss = 0;
+  gcStat.evict = 0;
+}
+
+
+/**
+ * @function P2D_GlyphCacheGetStat
+ * @brief return the glyph cache statistics, since the last P2D_GlyphCacheFlush()
+ * @param glyph_cache_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_GlyphCacheGetStat(glyph_cache_stat_st *stat) {
+  uint8_t i;
+  if(stat != NULL) {
+    gcStat.entryUsed = 0;
+    for(i = 0; i < GC_ENTRY_CNT; i++) {
+      if(gcEntry[i].font != NULL) gcStat.entryUsed++;
+    }
+    gcStat.byteUsed = (uint32_t) (GC_BLOCK_CNT - gcFreeCnt) * GC_BLOCK_PX * sizeof(color_t);
+    *stat = gcStat;
+  }
+}
+
+
 /**
  * @function OpenBPP
  * @brief Opens a BPP font & sets font properties in the static global variables
@@ -245,6 +371,11 @@ static int8_t OpenBPP(const uint8_t *fontFile) {
   int8_t res = -1;
   uint16_t glyphCnt;
 
+  /*a box font is rendered as a 4BPP font, its entries being larger*/
+  bBox = (fontType == FONT_4BPP_BOX) ? true : false;
+  if(bBox) fontType = FONT_4BPP;
+  entrySize = bBox ? BOX_ENTRY_SIZE : BPP_ENTRY_SIZE;
+
   /*gets min & max glyph ID*/
   glyphMin = fontFile[BPP_GMIN];
   glyphMax = fontFile[BPP_GMAX];
@@ -259,7 +390,7 @@ static int8_t OpenBPP(const uint8_t *fontFile) {
       index = &fontFile[BPP_INDEX];
 
       glyphCnt = (glyphMax - glyphMin) + 1;
-      raw = &fontFile[BPP_INDEX + BPP_ENTRY_SIZE * glyphCnt];
+      raw = &fontFile[BPP_INDEX + entrySize * glyphCnt];
 
       /*at this point, the font seems to be valid*/
       res = 0;
@@ -284,10 +415,12 @@ static const uint8_t *GetGlyphAddr(uint8_t id) {
    *casting it directly, like "offset = *((uint32_t *) &index[entryPos]) & 0x00FFFFFF"
    *A direct cast will be sensitive to endianess, implying different files for a same font
    */
-  entryPos = (id - glyphMin) * BPP_ENTRY_SIZE;
+  entryPos = (id - glyphMin) * entrySize;
+  if(bBox) entryPos += BOX_OFFSET_HL - BPP_OFFSET_HL;
   offset  = ((uint32_t) index[entryPos + BPP_OFFSET_HL]) << 16;
   offset |= ((uint32_t) index[entryPos + BPP_OFFSET_LH]) << 8;
   offset |=  (uint32_t) index[entryPos + BPP_OFFSET_LL];
+  if(bBox) offset &= ~((uint32_t) BOX_RLE << 16);
 
   return &raw[offset];
 }
@@ -300,7 +433,7 @@ static const uint8_t *GetGlyphAddr(uint8_t id) {
  * @return uint8_t: glyph width
  */
 static uint8_t GetGlyphWidth(uint8_t id) {
-  uint16_t entryPos = entryPos = (id - glyphMin) * BPP_ENTRY_SIZE;
+  uint16_t entryPos = (id - glyphMin) * entrySize;
   return index[entryPos + BPP_ENTRY_WIDTH];
 }
 
@@ -309,13 +442,67 @@ static uint8_t GetGlyphWidth(uint8_t id) {
  * @function PutGlyph
  * @brief puts a given glyph to a given position
  * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @param uint8_t id: glyph id
+ * @param const uint8_t *ptrGlyph: glyph stream; shall be not null
+ * @return none
+ */
+static void PutGlyph(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph) {
+  if(bBox) PutBox(rec, id, ptrGlyph);
+  else PutRaw(rec, id, ptrGlyph);
+}
+
+
+/**
+ * @function PutBox
+ * @brief puts a glyph of a FONT_4BPP_BOX font; in DISPLAY_SOLID mode, the cell area outside the box
+ * is filled with the background, one rectangle per side; in DISPLAY_TRANSPARENT mode, it is skipped
+ * @param const rect_st *rec: contains the position, width & height of the glyph cell; shall be not null
+ * @param uint8_t id: glyph id
+ * @param const uint8_t *ptrGlyph: box stream; shall be not null
+ * @return none
+ */
+static void PutBox(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph) {
+
+  const uint8_t *entry = &index[(id - glyphMin) * BOX_ENTRY_SIZE];
+  rect_st box;
+
+  box.x = rec->x + entry[BOX_X];
+  box.y = rec->y + entry[BOX_Y];
+  box.w = entry[BOX_W];
+  box.h = entry[BOX_H];
+
+  if(context.mode == DISPLAY_SOLID) {
+    if(box.w == 0 || box.h == 0) {
+      FillClip(rec->x, rec->y, rec->w, rec->h, lut.lut[0]);
+    }
+    else {
+      FillClip(rec->x, rec->y, rec->w, box.y - rec->y, lut.lut[0]);                            /*top*/
+      FillClip(rec->x, box.y + box.h, rec->w, rec->y + rec->h - box.y - box.h, lut.lut[0]);   /*bottom*/
+      FillClip(rec->x, box.y, box.x - rec->x, box.h, lut.lut[0]);                            /*left*/
+      FillClip(box.x + box.w, box.y, rec->x + rec->w - box.x - box.w, box.h, lut.lut[0]);    /*right*/
+    }
+  }
+
+  if(box.w > 0 && box.h > 0) {
+    if(entry[BOX_OFFSET_HL] & BOX_RLE) PutRle_4BPP(&box, ptrGlyph);
+    else PutRaw(&box, id, ptrGlyph);
+  }
+}
+
+
+/**
+ * @function PutRaw
+ * @brief puts a glyph stored as raw pixels (the whole cell, or the box of a FONT_4BPP_BOX glyph)
+ * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @param uint8_t id: glyph id
  * @param const uint8_t *ptrGlyph: glyph stream; shall be not null
  * @return none
  */
-static void PutGlyph(const rect_st *rec, const uint8_t *ptrGlyph) {
+static void PutRaw(const rect_st *rec, uint8_t id, const uint8_t *ptrGlyph) {
 
   uint16_t cntPxGly, cntPxClip;
   rect_st lrec = *rec;
+  const gc_entry_st *e = NULL;
 
   /*compute the number of pixels composing the glyph*/
   cntPxGly = P2D_GetPixelCnt(rec);
@@ -325,66 +512,85 @@ static void PutGlyph(const rect_st *rec, const uint8_t *ptrGlyph) {
   cntPxClip = P2D_GetPixelCnt(&lrec);
   SetWnd(&lrec);
 
+  /*4BPP solid glyph, even partially visible: use the shaded copy from the glyph cache*/
+  if(context.mode == DISPLAY_SOLID && fontType == FONT_4BPP && cntPxClip > 0) {
+    e = CacheGet(id, ptrGlyph, cntPxGly);
+  }
+
+  if(e != NULL) {
+    PutCached(e, rec, &lrec);
+  }
   /*if the lrec completly fits into the current clip && DISPLAY_SOLID -> optimized procedure*/
-  if(context.mode == DISPLAY_SOLID && cntPxClip == cntPxGly) {
-    if(fontType == FONT_1BPP) PutFast_1BPP(&lrec, ptrGlyph, cntPxClip);
-    else if(fontType == FONT_4BPP) PutFast_4BPP(&lrec, ptrGlyph, cntPxClip);
+  else if(context.mode == DISPLAY_SOLID && cntPxClip == cntPxGly) {
+    if(fontType == FONT_1BPP) PutFast_1BPP(ptrGlyph, cntPxClip);
+    else if(fontType == FONT_4BPP) PutFast_4BPP(ptrGlyph, cntPxClip);
   }
-  /*else, put pixel per pixel... much slower !*/
+  /*else, put run per run, clipped... slower !*/
   else {
-    if(fontType == FONT_1BPP) PutSlow_1BPP(rec, ptrGlyph);
-    else if(fontType == FONT_4BPP) PutSlow_4BPP(rec, ptrGlyph);
+    if(fontType == FONT_1BPP) PutSlow_1BPP(rec, &lrec, ptrGlyph);
+    else if(fontType == FONT_4BPP) PutSlow_4BPP(rec, &lrec, ptrGlyph);
   }
 }
 
 
 /**
  * @function PutFast_1BPP
- * @brief fast procedure for displaying a 1BPP glyph
- * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @brief fast procedure for displaying a 1BPP glyph; the glyph window shall be set
  * @param const uint8_t *ptr: glyph raw; shall be not null
  * @param uint32_t cntPxClip: number of pixel contained in rec
  * @return none
  */
-static void PutFast_1BPP(const rect_st *rec, const uint8_t *ptr, uint32_t cntPxClip) {
+static void PutFast_1BPP(const uint8_t *ptr, uint32_t cntPxClip) {
 
   uint8_t mask = 0x80;
+  bool bFront, bRunFront = false;
+  uint32_t run = 0;
 
-  /*just put the glyph stream*/
+  /*just put the glyph stream, one PutN() per run of identical bits*/
   while(cntPxClip-- > 0) {
-    if(*ptr & mask) Put(context.colFront);
-    else Put(context.colBackgrnd);
+    bFront = (*ptr & mask) != 0;
+    if(run > 0 && bFront != bRunFront) {
+      PutN(bRunFront? context.colFront: context.colBackgrnd, run);
+      run = 0;
+    }
+    bRunFront = bFront;
+    run++;
     NextBit_1BPP(&mask, &ptr);
   }
+
+  if(run > 0) PutN(bRunFront? context.colFront: context.colBackgrnd, run);
 }
 
 
 /**
  * @function PutSlow_1BPP
- * @brief slow procedure for displaying a 1BPP glyph
+ * @brief slow procedure for displaying a 1BPP glyph (clipped or transparent)
  * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @param const rect_st *clip: glyph rect, clipped; shall be not null
  * @param const uint8_t *ptr: glyph raw; shall be not null
  * @return none
  */
-static void PutSlow_1BPP(const rect_st *rec, const uint8_t *ptr) {
+static void PutSlow_1BPP(const rect_st *rec, const rect_st *clip, const uint8_t *ptr) {
 
   uint8_t mask = 0x80;
-  coord_t x, y;
+  coord_t x, xRun, y;
+  bool bFront;
 
-  /*for each pixel*/
+  /*for each line, for each run of identical bits*/
   for(y = rec->y; y < rec->y + rec->h; y++) {
-    for(x = rec->x; x < rec->x + rec->w; x++) {
-
-      /*always puts glyph front*/
-      if(*ptr & mask) {
-        P2D_SetPixel(x, y, context.colFront);
-      }
-      /*puts glyph background ONLY if DISPLAY_SOLID*/
-      else if(context.mode == DISPLAY_SOLID) {
-        P2D_SetPixel(x, y, context.colBackgrnd);
+    x = rec->x;
+    while(x < rec->x + rec->w) {
+
+      bFront = (*ptr & mask) != 0;
+      xRun = x;
+      while(x < rec->x + rec->w && ((*ptr & mask) != 0) == bFront) {
+        NextBit_1BPP(&mask, &ptr);
+        x++;
       }
 
-      NextBit_1BPP(&mask, &ptr);
+      /*always puts glyph front; puts glyph background ONLY if DISPLAY_SOLID*/
+      if(bFront) PutSpanClip(xRun, x - 1, y, context.colFront, clip);
+      else if(context.mode == DISPLAY_SOLID) PutSpanClip(xRun, x - 1, y, context.colBackgrnd, clip);
     }
   }
 }
@@ -408,60 +614,75 @@ static void NextBit_1BPP(uint8_t *mask, const uint8_t **ptr) {
 
 /**
  * @function PutFast_4BPP
- * @brief fast procedure for displaying a 4BPP glyph
- * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @brief fast procedure for displaying a 4BPP glyph; the glyph window shall be set
  * @param const uint8_t *ptr: glyph raw; shall be not null
  * @param uint32_t cntPxClip: number of pixel contained in rec
  * @return none
  */
-static void PutFast_4BPP(const rect_st *rec, const uint8_t *ptr, uint32_t cntPxClip) {
+static void PutFast_4BPP(const uint8_t *ptr, uint32_t cntPxClip) {
 
   uint8_t mask = 0xF0;
-  uint8_t color;
+  uint8_t color, cnt;
+  uint8_t buff[LUT_RUN_LEN];
 
-  /*just put the glyph stream*/
+  /*decode the glyph stream by block of LUT_RUN_LEN pixels, & put each block at once*/
+  cnt = 0;
   while(cntPxClip-- > 0) {
     color = *ptr & mask;
     if(mask == 0xF0) color >>= 4;
     /*color &= 0x0F;   ->be sure that color value does not overlap lut4BPP size*/
-    Put(lut.lut[color]);
+    buff[cnt++] = color;
+    if(cnt == LUT_RUN_LEN) {
+      PutLut8Run(buff, lut.lut, cnt);
+      cnt = 0;
+    }
     NextBit_4BPP(&mask, &ptr);
   }
+
+  if(cnt > 0) PutLut8Run(buff, lut.lut, cnt);
 }
 
 
 /**
  * @function PutSlow_4BPP
- * @brief slow procedure for displaying a 4BPP glyph
+ * @brief slow procedure for displaying a 4BPP glyph (clipped or transparent)
  * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @param const rect_st *clip: glyph rect, clipped; shall be not null
  * @param const uint8_t *ptr: glyph raw; shall be not null
  * @return none
  */
-static void PutSlow_4BPP(const rect_st *rec, const uint8_t *ptr) {
+static void PutSlow_4BPP(const rect_st *rec, const rect_st *clip, const uint8_t *ptr) {
 
   uint8_t mask = 0xF0;
-  uint8_t color;
-  coord_t x, y;
+  uint8_t color, runColor;
+  coord_t x, xRun, y;
 
-  /*for each pixel*/
+  /*for each line, for each run of identical nibbles*/
   for(y = rec->y; y < rec->y + rec->h; y++) {
-    for(x = rec->x; x < rec->x + rec->w; x++) {
+    x = rec->x;
+    runColor = 0;
+    xRun = x;
+    while(x < rec->x + rec->w) {
 
       color = *ptr & mask;
       if(mask == 0xF0) color >>= 4;
       /*color &= 0x0F;   ->be sure that color is in RANGE[0x00-0x0F]*/
 
-      /*always puts glyph front*/
-      if(color != 0) {
-        P2D_SetPixel(x, y, lut.lut[color]);
+      if(x == xRun) {
+        runColor = color;
       }
-      /*puts glyph background ONLY if DISPLAY_SOLID*/
-      else if(context.mode == DISPLAY_SOLID) {
-        P2D_SetPixel(x, y, lut.lut[0]);
+      else if(color != runColor) {
+        /*always puts glyph front; puts glyph background ONLY if DISPLAY_SOLID*/
+        if(runColor != 0 || context.mode == DISPLAY_SOLID) PutSpanClip(xRun, x - 1, y, lut.lut[runColor], clip);
+        runColor = color;
+        xRun = x;
       }
 
       NextBit_4BPP(&mask, &ptr);
+      x++;
     }
+
+    if(runColor != 0 || context.mode == DISPLAY_SOLID) PutSpanClip(xRun, x - 1, y, lut.lut[runColor], clip);
   }
 }
 
@@ -480,3 +701,274 @@ static void NextBit_4BPP(uint8_t *mask, const uint8_t **ptr) {
     *mask = 0xF0;
   }
 }
+
+
+/**
+ * @function PutRle_4BPP
+ * @brief put a run-length encoded 4BPP glyph box; one PutN() per run when the box is fully visible
+ * & DISPLAY_SOLID, else clipped spans, background runs being skipped in DISPLAY_TRANSPARENT mode
+ * @param const rect_st *rec: contains the position, width & height of the box; shall be not null
+ * @param const uint8_t *ptr: box runs; shall be not null
+ * @return none
+ */
+static void PutRle_4BPP(const rect_st *rec, const uint8_t *ptr) {
+
+  rect_st clip = *rec;
+  bool bFast;
+  uint8_t color;
+  length_t len;
+  coord_t x, y;
+
+  P2D_ClipFit(&clip);
+  bFast = (context.mode == DISPLAY_SOLID && P2D_GetPixelCnt(&clip) == P2D_GetPixelCnt(rec)) ? true : false;
+  SetWnd(&clip);
+
+  for(y = rec->y; y < rec->y + rec->h; y++) {
+    x = rec->x;
+    while(x < rec->x + rec->w) {
+      len = (length_t) (*ptr >> 4) + 1;
+      color = *ptr & 0x0F;
+      ptr++;
+      if(bFast) PutN(lut.lut[color], len);
+      else if(color != 0 || context.mode == DISPLAY_SOLID) PutSpanClip(x, x + len - 1, y, lut.lut[color], &clip);
+      x += len;
+    }
+  }
+}
+
+
+/**
+ * @function FillClip
+ * @brief fill a rectangle with one color, clipped; empty rectangles are ignored
+ * @param coord_t x, y: top-left corner
+ * @param coord_t w, h: size; may be <= 0
+ * @param color_t col: color
+ * @return none
+ */
+static void FillClip(coord_t x, coord_t y, coord_t w, coord_t h, color_t col) {
+
+  rect_st rec;
+  uint32_t cnt;
+
+  if(w > 0 && h > 0) {
+    rec.x = x;
+    rec.y = y;
+    rec.w = (length_t) w;
+    rec.h = (length_t) h;
+    P2D_ClipFit(&rec);
+    cnt = P2D_GetPixelCnt(&rec);
+    if(cnt > 0) {
+      SetWnd(&rec);
+      PutN(col, cnt);
+    }
+  }
+}
+
+
+/**
+ * @function PutSpanClip
+ * @brief put a horizontal span of one color, clipped
+ * @param coord_t x0, x1: first & last pixel of the span (x0 <= x1)
+ * @param coord_t y: line of the span
+ * @param color_t col: color
+ * @param const rect_st *clip: clip; shall be not null
+ * @return none
+ */
+static void PutSpanClip(coord_t x0, coord_t x1, coord_t y, color_t col, const rect_st *clip) {
+
+  if(y >= clip->y && y < clip->y + clip->h) {
+    if(x0 < clip->x) x0 = clip->x;
+    if(x1 > clip->x + clip->w - 1) x1 = clip->x + clip->w - 1;
+
+    if(x0 <= x1) {
+      SetPos(x0, y);
+      PutN(col, (uint32_t) (x1 - x0 + 1));
+    }
+  }
+}
+
+
+/**
+ * @function CacheGet
+ * @brief return the cache entry of a glyph, shaded with the current lut & colors; the glyph is
+ * decoded into the cache if needed, evicting the least recently used glyphs
+ * @param uint8_t id: glyph id
+ * @param const uint8_t *ptr: glyph raw; shall be not null
+ * @param uint16_t cntPx: number of pixels composing the glyph
+ * @return gc_entry_st *: cache entry, NULL if the glyph cannot be cached
+ */
+static gc_entry_st *CacheGet(uint8_t id, const uint8_t *ptr, uint16_t cntPx) {
+
+  gc_entry_st *e = NULL;
+  uint8_t i, block, blockCnt, mask, color;
+  uint16_t px;
+
+  if(bGcEnable && cntPx > 0) {
+
+    gcClock++;
+
+    /*lookup*/
+    for(i = 0; i < GC_ENTRY_CNT && e == NULL; i++) {
+      if(gcEntry[i].font == font && gcEntry[i].glyph == id && gcEntry[i].colFront == context.colFront &&
+         gcEntry[i].colBackgrnd == context.colBackgrnd && gcEntry[i].alpha == context.alpha) {
+        e = &gcEntry[i];
+      }
+    }
+
+    if(e != NULL) {
+      gcStat.hit++;
+      e->lastUse = gcClock;
+    }
+    else if(cntPx <= GC_BLOCK_CNT * GC_BLOCK_PX) {
+
+      gcStat.miss++;
+
+      /*find a free entry, or evict the least recently used one*/
+      for(i = 0; i < GC_ENTRY_CNT && e == NULL; i++) {
+        if(gcEntry[i].font == NULL) e = &gcEntry[i];
+      }
+      if(e == NULL) {
+        e = CacheGetLRU();
+        CacheEvict(e);
+      }
+
+      /*then evict glyphs until there is enough free blocks*/
+      blockCnt = (uint8_t) ((cntPx + GC_BLOCK_PX - 1) / GC_BLOCK_PX);
+      while(gcFreeCnt < blockCnt) CacheEvict(CacheGetLRU());
+
+      /*take the chain from the free list head*/
+      e->block = gcFree;
+      block = gcFree;
+      for(i = 1; i < blockCnt; i++) block = gcNext[block];
+      gcFree = gcNext[block];
+      gcNext[block] = GC_NO_BLOCK;
+      gcFreeCnt -= blockCnt;
+
+      /*shade the glyph through the lut*/
+      block = e->block;
+      px = 0;
+      mask = 0xF0;
+      while(cntPx-- > 0) {
+        color = *ptr & mask;
+        if(mask == 0xF0) color >>= 4;
+        gcArena[block][px++] = lut.lut[color];
+        if(px == GC_BLOCK_PX) {
+          block = gcNext[block];
+          px = 0;
+        }
+        NextBit_4BPP(&mask, &ptr);
+      }
+
+      e->font = font;
+      e->glyph = id;
+      e->colFront = context.colFront;
+      e->colBackgrnd = context.colBackgrnd;
+      e->alpha = context.alpha;
+      e->lastUse = gcClock;
+    }
+    else {
+      gcStat.miss++;
+    }
+  }
+
+  return e;
+}
+
+
+/**
+ * @function CacheEvict
+ * @brief free a cache entry & give back its blocks to the free list
+ * @param gc_entry_st *e: entry; shall be not null
+ * @return none
+ */
+static void CacheEvict(gc_entry_st *e) {
+
+  uint8_t block, cnt = 1;
+
+  if(e->font != NULL) {
+    block = e->block;
+    while(gcNext[block] != GC_NO_BLOCK) {
+      block = gcNext[block];
+      cnt++;
+    }
+    gcNext[block] = gcFree;
+    gcFree = e->block;
+    gcFreeCnt += cnt;
+    e->font = NULL;
+    gcStat.evict++;
+  }
+}
+
+
+/**
+ * @function CacheGetLRU
+ * @brief return the least recently used entry
+ * @param none
+ * @return gc_entry_st *: entry
+ */
+static gc_entry_st *CacheGetLRU(void) {
+
+  uint8_t i;
+  gc_entry_st *e = NULL;
+
+  for(i = 0; i < GC_ENTRY_CNT; i++) {
+    if(gcEntry[i].font != NULL && (e == NULL || gcClock - gcEntry[i].lastUse > gcClock - e->lastUse)) {
+      e = &gcEntry[i];
+    }
+  }
+
+  return e;
+}
+
+
+/**
+ * @function PutCached
+ * @brief put a cached glyph into the current window (already set to clip)
+ * @param const gc_entry_st *e: cache entry; shall be not null
+ * @param const rect_st *rec: contains the position, width & height of the glyph; shall be not null
+ * @param const rect_st *clip: glyph rect, clipped; shall be not null
+ * @return none
+ */
+static void PutCached(const gc_entry_st *e, const rect_st *rec, const rect_st *clip) {
+
+  coord_t y;
+
+  /*only full lines: one single range*/
+  if(clip->w == rec->w) {
+    PutCachedRange(e->block, (uint16_t) ((clip->y - rec->y) * rec->w), (uint16_t) (clip->w * clip->h));
+  }
+  /*else, the visible part of each line; the window wraps the cursor*/
+  else {
+    for(y = clip->y; y < clip->y + clip->h; y++) {
+      PutCachedRange(e->block, (uint16_t) ((y - rec->y) * rec->w + clip->x - rec->x), (uint16_t) clip->w);
+    }
+  }
+}
+
+
+/**
+ * @function PutCachedRange
+ * @brief put n pixels of a block chain, starting at a given pixel
+ * @param uint8_t block: first block of the chain
+ * @param uint16_t start: first pixel to put
+ * @param uint16_t n: number of pixels to put
+ * @return none
+ */
+static void PutCachedRange(uint8_t block, uint16_t start, uint16_t n) {
+
+  uint16_t len;
+
+  while(start >= GC_BLOCK_PX) {
+    block = gcNext[block];
+    start -= GC_BLOCK_PX;
+  }
+
+  while(n > 0) {
+    len = GC_BLOCK_PX - start;
+    if(len > n) len = n;
+    PutRun(&gcArena[block][start], len);
+    n -= len;
+    start = 0;
+    block = gcNext[block];
+  }
+}
@@ -30,6 +30,16 @@
 
 #include "p2d.h"
 
+/**
+ * @typedef glyph_cache_stat_st
+ */
+typedef struct {
+  uint32_t hit, miss, evict;  /*glyph lookups found / not found in the cache, glyphs evicted*/
+  uint32_t byteUsed;          /*arena memory holding glyphs*/
+  uint8_t entryUsed;          /*glyphs currently cached*/
+} glyph_cache_stat_st;
+
+
 /**
  * @function P2D_SetFont
  * @brief Set the current font
@@ -38,6 +48,14 @@
  */
 int8_t P2D_SetFont(const uint8_t *pFile);
 
+/**
+ * @function P2D_GetFont
+ * @brief return the current font
+ * @param none
+ * @return const uint8_t *: current font file; NULL if no valid font is set
+ */
+const uint8_t *P2D_GetFont(void);
+
 /**
  * @function P2D_GetTextHeight
  * @brief return the current font height
@@ -80,4 +98,28 @@ void P2D_PutGlyph(coord_t x, coord_t y, uint8_t glyph);
  */
 void P2D_PutText(coord_t x, coord_t y, const void /*@null@*/ *ptr);
 
+/**
+ * @function P2D_GlyphCacheEnable
+ * @brief enable or disable the glyph cache of 4BPP fonts (enabled by default)
+ * @param bool bEnable: true for enabling the cache
+ * @return none
+ */
+void P2D_GlyphCacheEnable(bool bEnable);
+
+/**
+ * @function P2D_GlyphCacheFlush
+ * @brief drop all the cached glyphs & reset the cache statistics
+ * @param none
+ * @return none
+ */
+void P2D_GlyphCacheFlush(void);
+
+/**
+ * @function P2D_GlyphCacheGetStat
+ * @brief return the glyph cache statistics, since the last P2D_GlyphCacheFlush()
+ * @param glyph_cache_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_GlyphCacheGetStat(glyph_cache_stat_st *stat);
+
 #endif
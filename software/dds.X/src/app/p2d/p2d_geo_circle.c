@@ -24,6 +24,21 @@
 #include "p2d_internal.h"
 
 
+/**
+ * Local variables
+ */
+static coord_t clipX0, clipY0, clipX1, clipY1;  /*context.clip as coordinates, computed once per primitive*/
+
+/**
+ * Local functions
+ */
+static bool SpanClipInit(coord_t x0, coord_t y0, length_t radius);
+static void Span(coord_t xa, coord_t xb, coord_t y);
+static void CircleRunY(coord_t x0, coord_t y0, coord_t dy, coord_t aLo, coord_t aHi);
+static void CircleRunX(coord_t x0, coord_t y0, coord_t dx, coord_t bLo, coord_t bHi);
+static void PutAA8(coord_t x0, coord_t y0, coord_t a, coord_t b, uint8_t alpha);
+
+
 /**
  * @function P2D_Circle
  * @brief draw a circle
@@ -34,30 +49,54 @@
 void P2D_Circle(coord_t x0, coord_t y0, length_t radius) {
 
   coord_t x, y, err, r;
+  coord_t rowY, aFirst, aLast;  /*current run on the rows y0 +/- y*/
+  coord_t rowX, bFirst, bLast;  /*current run on the rows y0 +/- (-x)*/
 
-  r = radius;
-  x = -r;
-  y = 0;
-  err = 2 - 2 * r;
+  if(SpanClipInit(x0, y0, radius) && (bListRec == false || ListCircle(DL_CIRCLE, x0, y0, radius) == false)) {
 
-  /*classic mid-point algorithm*/
-  do {
+    r = radius;
+    x = -r;
+    y = 0;
+    err = 2 - 2 * r;
+    rowY = 0;
+    aFirst = r;
+    aLast = r;
+    rowX = r;
+    bFirst = 0;
+    bLast = 0;
 
-    P2D_SetPixel(x0-x, y0+y, context.colFront);
-    P2D_SetPixel(x0-y, y0-x, context.colFront);
-    P2D_SetPixel(x0+x, y0-y, context.colFront);
-    P2D_SetPixel(x0+y, y0+x, context.colFront);
+    /*classic mid-point algorithm; consecutive pixels of a same row are gathered into runs,
+     *one run per quadrant & per row. Quadrants do not overlap, each pixel is put once*/
+    do {
 
-    r = err;
-    if (r <= y) {
-      y++;
-      err += y * 2 + 1;
-    }
-    if (r > x || err > y) {
-      x++;
-      err += x * 2 + 1;
-    }
-  } while (x < 0);
+      if(y != rowY) {
+        CircleRunY(x0, y0, rowY, aLast, aFirst);
+        rowY = y;
+        aFirst = -x;
+      }
+      aLast = -x;
+
+      if(-x != rowX) {
+        CircleRunX(x0, y0, rowX, bFirst, bLast);
+        rowX = -x;
+        bFirst = y;
+      }
+      bLast = y;
+
+      r = err;
+      if (r <= y) {
+        y++;
+        err += y * 2 + 1;
+      }
+      if (r > x || err > y) {
+        x++;
+        err += x * 2 + 1;
+      }
+    } while (x < 0);
+
+    CircleRunY(x0, y0, rowY, aLast, aFirst);
+    CircleRunX(x0, y0, rowX, bFirst, bLast);
+  }
 }
 
 
@@ -70,34 +109,154 @@ void P2D_Circle(coord_t x0, coord_t y0, length_t radius) {
  */
 void P2D_FillCircle(coord_t x0, coord_t y0, length_t radius) {
 
-  coord_t x, y, err, r;
-  line_t lineType;
-
-  /*save line context*/
-  lineType = context.lineType;
-  context.lineType = LINE_SOLID;
-
-  r = radius;
-  x = -r;
-  y = 0;
-  err = 2 - 2 * r;
-
-  /*classic mid-point algorithm, but using line() between quadrant of instead pixel()*/
-  do {
-    P2D_Line(x0-x, y0+y, x0+x, y0+y);
-    P2D_Line(x0-x, y0-y, x0+x, y0-y);
-
-    r = err;
-    if (r <= y) {
-      y++;
-      err += y * 2 + 1;
+  coord_t x, y, err, r, rowY = -1;
+
+  if(SpanClipInit(x0, y0, radius) && (bListRec == false || ListCircle(DL_FILL_CIRCLE, x0, y0, radius) == false)) {
+
+    r = radius;
+    x = -r;
+    y = 0;
+    err = 2 - 2 * r;
+
+    /*classic mid-point algorithm; the first point reached on a row is the widest one,
+     *so that each row is put once, with a single span*/
+    do {
+      if(y != rowY) {
+        Span(x0 + x, x0 - x, y0 + y);
+        if(y != 0) Span(x0 + x, x0 - x, y0 - y);
+        rowY = y;
+      }
+
+      r = err;
+      if (r <= y) {
+        y++;
+        err += y * 2 + 1;
+      }
+      if (r > x || err > y) {
+        x++;
+        err += x * 2 + 1;
+      }
+    } while (x < 0);
+  }
+}
+
+
+/**
+ * @function P2D_CircleAA
+ * @brief draw an anti-aliased circle (Wu's algorithm); the front color is blended on the
+ * background color, so that the circle shall be drawn over a background of this color.
+ * Radius >= 256 falls back to P2D_Circle()
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param length_t radius: radius
+ * @return none
+ */
+void P2D_CircleAA(coord_t x0, coord_t y0, length_t radius) {
+
+  uint32_t r2, xf;
+  coord_t i, xi;
+  uint8_t f;
+
+  if(radius >= 256) {
+    P2D_Circle(x0, y0, radius);
+  }
+  else if(SpanClipInit(x0, y0, radius + 1)) {
+
+    r2 = (uint32_t) radius * radius;
+
+    /*one octant; for each row, the exact x (8 bits of fraction) shares the coverage between 2 pixels*/
+    for(i = 0; 2 * (uint32_t) i * i <= r2; i++) {
+      xf = P2D_sqrt32((r2 - (uint32_t) i * i) << 16);
+      xi = (coord_t) (xf >> 8);
+      f = (uint8_t) (xf & 0xFF);
+      PutAA8(x0, y0, xi, i, 255 - f);
+      PutAA8(x0, y0, xi + 1, i, f);
     }
-    if (r > x || err > y) {
-      x++;
-      err += x * 2 + 1;
+  }
+}
+
+
+/**
+ * @function SpanClipInit
+ * @brief compute the clip coordinates used by Span(), & check if the circle bounding box touches the clip
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param length_t radius: radius
+ * @return bool: true if something could be visible
+ */
+static bool SpanClipInit(coord_t x0, coord_t y0, length_t radius) {
+
+  clipX0 = context.clip.x;
+  clipY0 = context.clip.y;
+  clipX1 = context.clip.x + context.clip.w - 1;
+  clipY1 = context.clip.y + context.clip.h - 1;
+
+  return x0 + radius >= clipX0 && x0 - radius <= clipX1 && y0 + radius >= clipY0 && y0 - radius <= clipY1;
+}
+
+
+/**
+ * @function Span
+ * @brief put a horizontal span of the front color, clipped
+ * @param coord_t xa, xb: first & last pixel of the span (xa <= xb)
+ * @param coord_t y: row
+ * @return none
+ */
+static void Span(coord_t xa, coord_t xb, coord_t y) {
+
+  if(y >= clipY0 && y <= clipY1) {
+    if(xa < clipX0) xa = clipX0;
+    if(xb > clipX1) xb = clipX1;
+
+    if(xa <= xb) {
+      SetPos(xa, y);
+      PutN(context.colFront, (uint32_t) (xb - xa + 1));
     }
-  } while (x < 0);
+  }
+}
+
 
-  /*restore line context*/
-  context.lineType = lineType;
+/**
+ * @function CircleRunY
+ * @brief put the runs of the two quadrants which are on the rows y0 + dy & y0 - dy
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param coord_t dy: row, relative to the center
+ * @param coord_t aLo, aHi: run, as distance from the center (aLo <= aHi)
+ * @return none
+ */
+static void CircleRunY(coord_t x0, coord_t y0, coord_t dy, coord_t aLo, coord_t aHi) {
+  Span(x0 + aLo, x0 + aHi, y0 + dy);
+  Span(x0 - aHi, x0 - aLo, y0 - dy);
+}
+
+
+/**
+ * @function CircleRunX
+ * @brief put the runs of the two quadrants which are on the rows y0 + dx & y0 - dx
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param coord_t dx: row, relative to the center
+ * @param coord_t bLo, bHi: run, as distance from the center (bLo <= bHi)
+ * @return none
+ */
+static void CircleRunX(coord_t x0, coord_t y0, coord_t dx, coord_t bLo, coord_t bHi) {
+  Span(x0 - bHi, x0 - bLo, y0 + dx);
+  Span(x0 + bLo, x0 + bHi, y0 - dx);
+}
+
+
+/**
+ * @function PutAA8
+ * @brief put the 8 symmetrical pixels of a circle, blended
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param coord_t a, b: pixel, relative to the center
+ * @param uint8_t alpha: coverage
+ * @return none
+ */
+static void PutAA8(coord_t x0, coord_t y0, coord_t a, coord_t b, uint8_t alpha) {
+  P2D_SetPixelAA(x0 + a, y0 + b, alpha);
+  P2D_SetPixelAA(x0 - a, y0 + b, alpha);
+  P2D_SetPixelAA(x0 + a, y0 - b, alpha);
+  P2D_SetPixelAA(x0 - a, y0 - b, alpha);
+  P2D_SetPixelAA(x0 + b, y0 + a, alpha);
+  P2D_SetPixelAA(x0 - b, y0 + a, alpha);
+  P2D_SetPixelAA(x0 + b, y0 - a, alpha);
+  P2D_SetPixelAA(x0 - b, y0 - a, alpha);
 }
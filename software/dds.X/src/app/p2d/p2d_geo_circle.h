@@ -43,4 +43,15 @@ void P2D_Circle(coord_t x0, coord_t y0, length_t radius);
  */
 void P2D_FillCircle(coord_t x0, coord_t y0, length_t radius);
 
+/**
+ * @function P2D_CircleAA
+ * @brief draw an anti-aliased circle (Wu's algorithm); the front color is blended on the
+ * background color, so that the circle shall be drawn over a background of this color.
+ * Radius >= 256 falls back to P2D_Circle()
+ * @param coord_t x0, coord_t y0: center coordinate
+ * @param length_t radius: radius
+ * @return none
+ */
+void P2D_CircleAA(coord_t x0, coord_t y0, length_t radius);
+
 #endif
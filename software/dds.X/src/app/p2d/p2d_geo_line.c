@@ -24,6 +24,31 @@
 #include "p2d_internal.h"
 
 
+/**
+ * Private defines
+ */
+enum {    /*Cohen-Sutherland outcodes*/
+  OUT_LEFT   = 0x01,
+  OUT_RIGHT  = 0x02,
+  OUT_TOP    = 0x04,
+  OUT_BOTTOM = 0x08
+};
+
+/**
+ * Local variables
+ */
+static uint8_t patPos;      /*pattern bit of the next pixel (0: MSB)*/
+static bool bWndSet;        /*a window has been set for a vertical run, & shall be restored*/
+
+/**
+ * Local functions
+ */
+static uint8_t OutCode(coord_t x, coord_t y);
+static bool ClipRange(coord_t x0, coord_t y0, int8_t sx, int8_t sy, bool bXMajor, int32_t D, int32_t d, int32_t *iFirst, int32_t *iLast);
+static void PutLineRun(coord_t x, coord_t y, int8_t s, uint16_t n, bool bHorizontal);
+static void PutSegment(coord_t x, coord_t y, int8_t s, uint16_t n, bool bHorizontal, color_t col);
+
+
 /**
  * @function P2D_Gline
  * @brief draw a line
@@ -33,43 +58,303 @@
  */
 void P2D_Gline(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
 
-  coord_t dx, sx, dy, sy, err, e2;
-  bool blink;
+  int32_t dx, dy, D, d, e0, i, iFirst, iLast, iEnd, j, q, r, qStep, rStep;
+  int8_t sx, sy;
+  bool bXMajor;
 
   dx = P2D_Abs(x1 - x0);
   sx = x0 < x1 ? 1 : -1;
   dy = P2D_Abs(y1 - y0);
   sy = y0 < y1 ? 1 : -1;
-  err = (dx > dy ? dx : -dy) / 2;
 
-  /* Same algorithm, but different loops according to line type
-   * -> faster processing
-   */
-  if(context.lineType == LINE_SOLID) {
-    while(1) {
-      P2D_SetPixel(x0, y0, context.colFront);
-      if(x0 == x1 && y0 == y1) break;
-      e2 = err;
-      if(e2 >-dx) { err -= dy; x0 += sx; }
-      if(e2 < dy) { err += dx; y0 += sy; }
+  /*pixel i of the line (i = 0..D along the major axis) is on the minor step j(i) = ceil((i * d - e0) / D);
+   *same pixels as the former pixel per pixel Bresenham, which started with err = D / 2*/
+  bXMajor = dx > dy;
+  D = bXMajor? dx: dy;
+  d = bXMajor? dy: dx;
+  e0 = D / 2;
+
+  /*Cohen-Sutherland outcodes: trivial reject & accept; else, exact visible range of the line*/
+  if((OutCode(x0, y0) & OutCode(x1, y1)) == 0) {
+
+    if((OutCode(x0, y0) | OutCode(x1, y1)) == 0) {
+      iFirst = 0;
+      iLast = D;
     }
-  }
-  else if(context.lineType == LINE_DOT) {
-    blink = 1;
-    while(1) {
+    else if(ClipRange(x0, y0, sx, sy, bXMajor, D, d, &iFirst, &iLast) == false) {
+      iLast = -1;
+    }
+
+    /*run-slice: one run per minor step; the run of step j ends at i = floor((j * D + e0) / d),
+     *the quotient & the remainder are advanced by D / d & D % d*/
+    if(iFirst <= iLast) {
+
+      /*called directly while recording: a line replayed by the first SetPos / SetWnd would change patPos & bWndSet*/
+      if(bListRec) P2D_ListFlush();
+
+      patPos = (uint8_t) (iFirst & 0x0F);
+      bWndSet = false;
 
-      if(blink) {
-        P2D_SetPixel(x0, y0, context.colFront);
+      j = (d > 0)? -P2D_FloorDiv(e0 - iFirst * d, D): 0;
+      if(d > 0) {
+        q = P2D_FloorDiv(j * D + e0, d);
+        r = j * D + e0 - q * d;
+        qStep = D / d;
+        rStep = D % d;
       }
-      else if(context.mode == DISPLAY_SOLID) {
-        P2D_SetPixel(x0, y0, context.colBackgrnd);
+      else {
+        /*horizontal or vertical line: a single run*/
+        q = iLast;
+        r = qStep = rStep = 0;
       }
-      blink = !blink;
 
-      if(x0 == x1 && y0 == y1) break;
-      e2 = err;
-      if(e2 >-dx) { err -= dy; x0 += sx; }
-      if(e2 < dy) { err += dx; y0 += sy; }
+      i = iFirst;
+      while(i <= iLast) {
+
+        iEnd = (d > 0 && q < iLast)? q: iLast;
+
+        if(bXMajor) PutLineRun(x0 + sx * i, y0 + sy * j, sx, (uint16_t) (iEnd - i + 1), true);
+        else PutLineRun(x0 + sx * j, y0 + sy * i, sy, (uint16_t) (iEnd - i + 1), false);
+
+        i = iEnd + 1;
+        j++;
+        if(d > 0) {
+          q += qStep;
+          r += rStep;
+          if(r >= d) {
+            r -= d;
+            q++;
+          }
+        }
+      }
+
+      if(bWndSet) SetWnd(NULL);
+    }
+  }
+}
+
+
+/**
+ * @function P2D_LineAA
+ * @brief draw an anti-aliased line (Wu's algorithm); the front color is blended on the
+ * background color, so that the line shall be drawn over a background of this color.
+ * Always solid, the line type is ignored
+ * @param coord_t x0, coord_t y0: point 0
+ * @param coord_t x1, coord_t y1: point 1
+ * @return none
+ */
+void P2D_LineAA(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+
+  coord_t tmp, x, y;
+  int32_t dx, dy, grad, inter;
+  uint8_t f;
+  bool bSteep;
+
+  /*walk along the major axis, from left to right (or top to bottom)*/
+  bSteep = P2D_Abs(y1 - y0) > P2D_Abs(x1 - x0);
+  if(bSteep) {
+    tmp = x0; x0 = y0; y0 = tmp;
+    tmp = x1; x1 = y1; y1 = tmp;
+  }
+  if(x0 > x1) {
+    tmp = x0; x0 = x1; x1 = tmp;
+    tmp = y0; y0 = y1; y1 = tmp;
+  }
+
+  dx = x1 - x0;
+  dy = y1 - y0;
+  grad = (dx > 0)? (dy * 65536) / dx: 0;
+  inter = (int32_t) y0 * 65536;
+
+  /*the exact minor coordinate (16 bits of fraction) shares the coverage between 2 pixels*/
+  for(x = x0; x <= x1; x++) {
+    y = (coord_t) (inter >> 16);
+    f = (uint8_t) (inter >> 8);
+    if(bSteep) {
+      P2D_SetPixelAA(y, x, 255 - f);
+      P2D_SetPixelAA(y + 1, x, f);
+    }
+    else {
+      P2D_SetPixelAA(x, y, 255 - f);
+      P2D_SetPixelAA(x, y + 1, f);
+    }
+    inter += grad;
+  }
+}
+
+
+/**
+ * @function OutCode
+ * @brief Cohen-Sutherland outcode of a point, against the current clip
+ * @param coord_t x, coord_t y: point
+ * @return uint8_t: outcode (OUT_LEFT | OUT_RIGHT | OUT_TOP | OUT_BOTTOM), 0 if inside
+ */
+static uint8_t OutCode(coord_t x, coord_t y) {
+  uint8_t code = 0;
+  if(x < context.clip.x) code |= OUT_LEFT;
+  else if(x > context.clip.x + context.clip.w - 1) code |= OUT_RIGHT;
+  if(y < context.clip.y) code |= OUT_TOP;
+  else if(y > context.clip.y + context.clip.h - 1) code |= OUT_BOTTOM;
+  return code;
+}
+
+
+/**
+ * @function ClipRange
+ * @brief compute the visible pixels of a line crossing the clip border: the clip gives a range on the
+ * major axis, and a range of minor steps, which is turned into a range on the major axis
+ * @param coord_t x0, coord_t y0: point 0
+ * @param int8_t sx, sy: x & y directions
+ * @param bool bXMajor: true if |dx| > |dy|
+ * @param int32_t D, d: major & minor lengths
+ * @param int32_t *iFirst, *iLast: output; first & last visible pixels, along the major axis
+ * @return bool: false if the line is not visible
+ */
+static bool ClipRange(coord_t x0, coord_t y0, int8_t sx, int8_t sy, bool bXMajor, int32_t D, int32_t d, int32_t *iFirst, int32_t *iLast) {
+
+  int32_t lo[2], hi[2], p0[2], k, jLo, jHi, e0 = D / 2;
+  int8_t s[2];
+  bool bVisible;
+
+  /*clip bounds, expressed as steps from point 0: [0] major axis, [1] minor axis*/
+  p0[0] = bXMajor? x0: y0;
+  p0[1] = bXMajor? y0: x0;
+  s[0] = bXMajor? sx: sy;
+  s[1] = bXMajor? sy: sx;
+  lo[0] = bXMajor? context.clip.x: context.clip.y;
+  hi[0] = lo[0] + (bXMajor? context.clip.w: context.clip.h) - 1;
+  lo[1] = bXMajor? context.clip.y: context.clip.x;
+  hi[1] = lo[1] + (bXMajor? context.clip.h: context.clip.w) - 1;
+
+  for(k = 0; k < 2; k++) {
+    if(s[k] > 0) {
+      lo[k] = lo[k] - p0[k];
+      hi[k] = hi[k] - p0[k];
+    }
+    else {
+      jLo = p0[k] - hi[k];
+      hi[k] = p0[k] - lo[k];
+      lo[k] = jLo;
+    }
+  }
+
+  /*visible minor steps, then the pixels of these steps*/
+  jLo = (lo[1] > 0)? lo[1]: 0;
+  jHi = (hi[1] < d)? hi[1]: d;
+  bVisible = jLo <= jHi;
+
+  if(bVisible) {
+
+    if(d == 0) {
+      *iFirst = 0;
+      *iLast = D;
     }
+    else {
+      *iFirst = (jLo == 0)? 0: P2D_FloorDiv((jLo - 1) * D + e0, d) + 1;
+      *iLast = P2D_FloorDiv(jHi * D + e0, d);
+    }
+
+    /*intersection with the visible range of the major axis, & with the line itself*/
+    if(*iFirst < lo[0]) *iFirst = lo[0];
+    if(*iFirst < 0) *iFirst = 0;
+    if(*iLast > hi[0]) *iLast = hi[0];
+    if(*iLast > D) *iLast = D;
+    bVisible = *iFirst <= *iLast;
+  }
+
+  return bVisible;
+}
+
+
+/**
+ * @function PutLineRun
+ * @brief put a run of the line, according to the line pattern
+ * @param coord_t x, coord_t y: first pixel of the run
+ * @param int8_t s: direction of the run (+1 / -1)
+ * @param uint16_t n: number of pixels
+ * @param bool bHorizontal: true for a horizontal run, false for a vertical one
+ * @return none
+ */
+static void PutLineRun(coord_t x, coord_t y, int8_t s, uint16_t n, bool bHorizontal) {
+
+  uint16_t k;
+  bool bOn;
+  rect_st rec;
+
+  if(context.lineType == LINE_SOLID) {
+    PutSegment(x, y, s, n, bHorizontal, context.colFront);
+  }
+  /*DISPLAY_SOLID & run in the cursor direction: the run is positioned once, then each group of
+   *identical pattern bits follows the previous one*/
+  else if(context.mode == DISPLAY_SOLID && s > 0 && n > 1) {
+    if(bHorizontal) {
+      SetPos(x, y);
+    }
+    else {
+      rec.x = x;
+      rec.y = y;
+      rec.w = 1;
+      rec.h = n;
+      SetWnd(&rec);
+      bWndSet = true;
+    }
+    while(n > 0) {
+      bOn = (context.lineType & (0x8000 >> patPos)) != 0;
+      k = 0;
+      while(k < n && ((context.lineType & (0x8000 >> ((patPos + k) & 0x0F))) != 0) == bOn) k++;
+      PutN(bOn? context.colFront: context.colBackgrnd, k);
+      patPos = (uint8_t) ((patPos + k) & 0x0F);
+      n -= k;
+    }
+  }
+  else {
+    /*one segment per group of identical pattern bits*/
+    while(n > 0) {
+      bOn = (context.lineType & (0x8000 >> patPos)) != 0;
+      k = 0;
+      while(k < n && ((context.lineType & (0x8000 >> ((patPos + k) & 0x0F))) != 0) == bOn) k++;
+
+      if(bOn) PutSegment(x, y, s, k, bHorizontal, context.colFront);
+      else if(context.mode == DISPLAY_SOLID) PutSegment(x, y, s, k, bHorizontal, context.colBackgrnd);
+
+      if(bHorizontal) x += s * (coord_t) k;
+      else y += s * (coord_t) k;
+      patPos = (uint8_t) ((patPos + k) & 0x0F);
+      n -= k;
+    }
+  }
+}
+
+
+/**
+ * @function PutSegment
+ * @brief put n pixels of one color, horizontally (one SetPos) or vertically (a 1 pixel wide window)
+ * @param coord_t x, coord_t y: first pixel
+ * @param int8_t s: direction (+1 / -1)
+ * @param uint16_t n: number of pixels
+ * @param bool bHorizontal: true for a horizontal segment, false for a vertical one
+ * @param color_t col: color
+ * @return none
+ */
+static void PutSegment(coord_t x, coord_t y, int8_t s, uint16_t n, bool bHorizontal, color_t col) {
+
+  rect_st rec;
+
+  if(n == 1) {
+    SetPos(x, y);
+    Put(col);
+  }
+  else if(bHorizontal) {
+    SetPos((s > 0)? x: x - (coord_t) n + 1, y);
+    PutN(col, n);
+  }
+  else {
+    rec.x = x;
+    rec.y = (s > 0)? y: y - (coord_t) n + 1;
+    rec.w = 1;
+    rec.h = n;
+    SetWnd(&rec);
+    PutN(col, n);
+    bWndSet = true;
   }
 }
@@ -35,4 +35,15 @@
  */
 void P2D_Gline(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
 
+/**
+ * @function P2D_LineAA
+ * @brief draw an anti-aliased line (Wu's algorithm); the front color is blended on the
+ * background color, so that the line shall be drawn over a background of this color.
+ * Always solid, the line type is ignored
+ * @param coord_t x0, coord_t y0: point 0
+ * @param coord_t x1, coord_t y1: point 1
+ * @return none
+ */
+void P2D_LineAA(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+
 #endif
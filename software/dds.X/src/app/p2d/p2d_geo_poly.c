@@ -5,7 +5,7 @@
  * @version 0.1b
  * @date (yyyy-mm-dd) 2013-04-07
  *
- * Implementation of filled polygon is inspired from http://alienryderflex.com/polygon_fill/
+ * Filled polygon: active edge table scanline filler (even-odd & non-zero rules)
  * Copyright (C) <2013>  Duboisset Philippe <duboisset.philippe@gmail.com>
  *
  * This program is free software: you can redistribute it and/or modify
@@ -24,14 +24,35 @@
 
 #include "p2d_internal.h"
 
-#define INTER_LIST_SIZE 16	/*maximum number of intersection per scanned line*/
+#define POLY_EDGE_MAX 255  /*one edge per point; nbPoint is an uint8_t*/
+
+/*
+ * Local types & variables, for the active edge table filler
+ */
+typedef struct {
+  coord_t x;        /*x of the current scanline = x + num / den; the fraction is exact, no error is accumulated*/
+  uint16_t num;     /*0 <= num < den*/
+  coord_t xStep;    /*x increment per scanline = xStep + numStep / den*/
+  uint16_t numStep; /*0 <= numStep < den*/
+  uint16_t den;     /*edge height*/
+  coord_t yTop;     /*the edge crosses the scanlines yTop+1 .. yBottom*/
+  coord_t yBottom;
+  int8_t dir;       /*+1: edge going down, -1: edge going up (non-zero rule)*/
+} edge_st;
+
+static edge_st arEdge[POLY_EDGE_MAX];
+static uint8_t arEdgeOrder[POLY_EDGE_MAX];  /*edge table: edges sorted by yTop*/
+static uint8_t arActive[POLY_EDGE_MAX];     /*active edge table: edges crossing the current scanline, sorted by x*/
 
 /*
  * Local functions
  */
 static void FindPolyLimits(const point_st *pts, uint8_t nbPoint, coord_t *yMin, coord_t *yMax);
-static uint8_t FindIntersection(const point_st *pts, uint8_t nbPoint, coord_t y, coord_t *xList, uint8_t listSize);
-static void SortIntersection(coord_t *xList, uint8_t listSize);
+static uint8_t BuildEdgeTable(const point_st *pts, uint8_t nbPoint);
+static void SortActive(uint8_t nbActive);
+static void EdgeAdvance(edge_st *e, uint16_t n);
+static void PutSpans(coord_t y, uint8_t nbActive);
+static void PutSpanClip(coord_t x0, coord_t x1, coord_t y);
 
 
 
@@ -119,24 +140,91 @@ void P2D_P_Zoom(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint8_
  * @return none
  */
 void P2D_P_Rotate(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint16_t deg) {
+  P2D_P_RotateQ16(arPoints, nbPoint, ref, P2D_DegToQ16((int16_t) (deg % 360)));
+}
+
 
-  int32_t rx, ry, dx, dy, cos, sin;
+/**
+ * @function P2D_P_RotateQ16
+ * @brief Rotate all points of an array around a reference point, with a sub-degree resolution
+ * @param point_st *arPoints: array of points; content will be overwritten
+ * @param uint8_t nbPoint: number of points
+ * @param const point_st *ref: reference point
+ * @param uint16_t angle: rotation, Q16 angle (65536 = 1 turn), clockwise on screen
+ * @return none
+ */
+void P2D_P_RotateQ16(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint16_t angle) {
+  xform_st m;
   if(arPoints != NULL && ref != NULL) {
+    P2D_XformInit(&m, ref, angle, 100, 0, 0);
+    P2D_P_Transform(arPoints, arPoints, nbPoint, &m);
+  }
+}
 
-    cos = P2D_Cos(deg);
-    sin = P2D_Sin(deg);
 
-    while(nbPoint) {
+/**
+ * @function P2D_XformInit
+ * @brief compute the transform: rotation & zoom around a reference point, then move
+ * @param xform_st *m: output transform
+ * @param const point_st *ref: reference point
+ * @param uint16_t angle: rotation, Q16 angle (65536 = 1 turn), clockwise on screen
+ * @param uint8_t zoomPercent: zoom, in percent (100 -> no zoom)
+ * @param coord_t mvX, mvY: x & y moves
+ * @return none
+ */
+void P2D_XformInit(xform_st *m, const point_st *ref, uint16_t angle, uint8_t zoomPercent, coord_t mvX, coord_t mvY) {
 
-      dx = arPoints->x - ref->x;
-      dy = arPoints->y - ref->y;
-      rx = (cos * dx - sin * dy) / P2D_G_DIV;
-      ry = (sin * dx + cos * dy) / P2D_G_DIV;
+  int32_t c, s;
 
-      arPoints->x = ref->x + (coord_t) rx;
-      arPoints->y = ref->y + (coord_t) ry;
+  if(m != NULL && ref != NULL) {
+    c = (int32_t) P2D_CosQ16(angle) * zoomPercent / 100;
+    s = (int32_t) P2D_SinQ16(angle) * zoomPercent / 100;
 
-      arPoints++;
+    /*p' = M.(p - ref) + ref + mv, with the constant part folded into tx, ty*/
+    m->xx = c;
+    m->xy = -s;
+    m->yx = s;
+    m->yy = c;
+    m->tx = (((int64_t) ref->x + mvX) << XFORM_SHIFT) - (int64_t) c * ref->x + (int64_t) s * ref->y;
+    m->ty = (((int64_t) ref->y + mvY) << XFORM_SHIFT) - (int64_t) s * ref->x - (int64_t) c * ref->y;
+  }
+}
+
+
+/**
+ * @function P2D_P_Transform
+ * @brief Apply a transform to an array of points (one multiply-add pass per point); the result is clamped to the coord_t range
+ * @param const point_st *src: source array
+ * @param point_st *dst: destination array; may be the source one
+ * @param uint8_t nbPoint: number of points
+ * @param const xform_st *m: transform (see P2D_XformInit())
+ * @return none
+ */
+void P2D_P_Transform(const point_st *src, point_st *dst, uint8_t nbPoint, const xform_st *m) {
+
+  int32_t x, y, xx, xy, yx, yy;
+  int64_t tx, ty, v;
+
+  if(src != NULL && dst != NULL && m != NULL) {
+
+    /*coefficients in registers; the constant rounding term is folded into tx & ty*/
+    xx = m->xx;
+    xy = m->xy;
+    yx = m->yx;
+    yy = m->yy;
+    tx = m->tx + (1L << (XFORM_SHIFT - 1));
+    ty = m->ty + (1L << (XFORM_SHIFT - 1));
+
+    /*64 bit products (a single mult on the MIPS32 core); clamped instead of wrapped*/
+    while(nbPoint > 0) {
+      x = src->x;
+      y = src->y;
+      v = ((int64_t) xx * x + (int64_t) xy * y + tx) >> XFORM_SHIFT;
+      dst->x = (coord_t) ((v < INT16_MIN)? INT16_MIN: (v > INT16_MAX)? INT16_MAX: v);
+      v = ((int64_t) yx * x + (int64_t) yy * y + ty) >> XFORM_SHIFT;
+      dst->y = (coord_t) ((v < INT16_MIN)? INT16_MIN: (v > INT16_MAX)? INT16_MAX: v);
+      src++;
+      dst++;
       nbPoint--;
     }
   }
@@ -210,7 +298,7 @@ void P2D_Poly(const point_st *arPoints, uint8_t nbPoint) {
 
 /**
  * @function P2D_FillPoly
- * @brief draw a filled polygon
+ * @brief draw a filled polygon, according to the current fill rule (see P2D_SetFillRule())
  * @param const point_st *arPoints: points array
  * @param uint8_t nbPoint: number of points
  * @return none
@@ -218,8 +306,8 @@ void P2D_Poly(const point_st *arPoints, uint8_t nbPoint) {
 void P2D_FillPoly(const point_st *arPoints, uint8_t nbPoint) {
 
   coord_t y, yMin, yMax;
-  coord_t xList[INTER_LIST_SIZE];
-  uint8_t ii, nbIntersection;
+  uint8_t nbEdge, nextEdge, nbActive, ii, jj;
+  edge_st *e;
   line_t lineType;
 
   if(arPoints != NULL && nbPoint >= 3) {
@@ -228,25 +316,47 @@ void P2D_FillPoly(const point_st *arPoints, uint8_t nbPoint) {
     lineType = context.lineType;
     context.lineType = LINE_SOLID;
 
-    /*retrieve Y min & max coord of the polygon*/
+    /*retrieve Y min & max coord of the polygon, & reduce them to the current clip*/
     FindPolyLimits(arPoints, nbPoint, &yMin, &yMax);
+    if(yMin < context.clip.y) yMin = context.clip.y - 1;
+    if(yMax > context.clip.y + context.clip.h - 1) yMax = context.clip.y + context.clip.h - 1;
 
-    //TODO: reduce yMin/yMax to the current Clip (optional, for faster processing with Clip)
+    /*edge table, sorted by yTop*/
+    nbEdge = BuildEdgeTable(arPoints, nbPoint);
+    nextEdge = 0;
+    nbActive = 0;
 
-    /*scan each line*/
-    for(y = yMin; y <= yMax; y++) {
+    /*scan each line; the first line (yMin) is only touched by the outline*/
+    for(y = yMin + 1; y <= yMax; y++) {
 
-      /*find all intersections of the current line*/
-      nbIntersection = FindIntersection(arPoints, nbPoint, y, xList, INTER_LIST_SIZE);
-
-      if(nbIntersection >= 2) {
-
-        /*sort intersection list, from lower to higher*/
-        SortIntersection(xList, nbIntersection);
+      /*remove the edges which ended on the previous line*/
+      jj = 0;
+      for(ii = 0; ii < nbActive; ii++) {
+        if(arEdge[arActive[ii]].yBottom >= y) arActive[jj++] = arActive[ii];
+      }
+      nbActive = jj;
+
+      /*activate the edges which start above this line; the edges starting above the clip
+       *jump directly to this line*/
+      while(nextEdge < nbEdge && arEdge[arEdgeOrder[nextEdge]].yTop < y) {
+        e = &arEdge[arEdgeOrder[nextEdge]];
+        if(e->yBottom >= y) {
+          EdgeAdvance(e, (uint16_t) (y - e->yTop - 1));
+          arActive[nbActive++] = arEdgeOrder[nextEdge];
+        }
+        nextEdge++;
+      }
 
-        /*drawing lines between each intersection pairs*/
-        for(ii = 0; ii < nbIntersection; ii += 2) {
-          P2D_Line(xList[ii], y, xList[ii+1], y);
+      /*put the spans between edges, then advance the edges to the next line*/
+      SortActive(nbActive);
+      PutSpans(y, nbActive);
+      for(ii = 0; ii < nbActive; ii++) {
+        e = &arEdge[arActive[ii]];
+        e->x += e->xStep;
+        e->num += e->numStep;
+        if(e->num >= e->den) {
+          e->num -= e->den;
+          e->x++;
         }
       }
     }
@@ -278,71 +388,161 @@ static void FindPolyLimits(const point_st *pts, uint8_t nbPoint, coord_t *yMin,
 
 
 /**
- * @function FindIntersection
- * @brief build the intersection list of the current line
+ * @function BuildEdgeTable
+ * @brief build the edge table: one entry per non horizontal edge, sorted by yTop
  * @param const point_st *pts: points array
  * @param uint8_t nbPoint: number of points
- * @param coord_t y: current scanned line
- * @param coord_t *xList: output list
- * @param uint8_t listSize: maximum list size
- * @return none
+ * @return uint8_t: number of edges
  */
-static uint8_t FindIntersection(const point_st *pts, uint8_t nbPoint, coord_t y, coord_t *xList, uint8_t listSize) {
+static uint8_t BuildEdgeTable(const point_st *pts, uint8_t nbPoint) {
 
-  uint8_t p1, p2;
-  uint8_t nbInter;
-  coord_t x1, y1, x2, y2, x;
+  uint8_t p1, p2, nbEdge, ii;
+  const point_st *top, *bottom;
+  edge_st *e;
+  int8_t dir;
+  int32_t dx, dy, c, q;
 
-  /*looks for intersection between 2 consecutive points only*/
-  nbInter = 0;
+  nbEdge = 0;
   p2 = nbPoint - 1;
-  for(p1 = 0; p1 < nbPoint && nbInter < listSize; p1++) {
-
-    y1 = pts[p1].y;
-    y2 = pts[p2].y;
-
-    /*intersection if: current y line is between 2 points*/
-    if((y1 < y && y2 >= y) || (y2 < y && y1 >= y)) {
+  for(p1 = 0; p1 < nbPoint; p1++) {
 
-      x1 = pts[p1].x;
-      x2 = pts[p2].x;
+    /*horizontal edges never cross a scanline*/
+    if(pts[p1].y != pts[p2].y) {
 
-      x = (y - y1) * (x2 - x1) / (y2 - y1); /*relative x*/
-      xList[nbInter] = x1 + x; /*absolute x*/
+      if(pts[p1].y > pts[p2].y) {
+        top = &pts[p2];
+        bottom = &pts[p1];
+        dir = 1;
+      }
+      else {
+        top = &pts[p1];
+        bottom = &pts[p2];
+        dir = -1;
+      }
 
-      nbInter++;
+      e = &arEdge[nbEdge];
+      e->yTop = top->y;
+      e->yBottom = bottom->y;
+      e->dir = dir;
+
+      /*the edge crosses the line yTop + k at x = xTop + k * dx / dy. Same rounding as the former filler,
+       *which truncated toward 0 the offset from pts[p1]: this is a floor when the offset is positive,
+       *a ceil otherwise, i.e. floor((k * dx + c) / dy) with c = 0 or dy - 1*/
+      dx = bottom->x - top->x;
+      dy = bottom->y - top->y;
+      c = ((top == &pts[p1]) == (dx >= 0))? 0: dy - 1;
+
+      e->den = (uint16_t) dy;
+      e->xStep = (coord_t) P2D_FloorDiv(dx, dy);
+      e->numStep = (uint16_t) (dx - e->xStep * dy);
+
+      /*x is given for the line yTop + 1*/
+      q = P2D_FloorDiv(dx + c, dy);
+      e->x = top->x + (coord_t) q;
+      e->num = (uint16_t) (dx + c - q * dy);
+
+      /*insertion into the edge table*/
+      ii = nbEdge;
+      while(ii > 0 && arEdge[arEdgeOrder[ii - 1]].yTop > e->yTop) {
+        arEdgeOrder[ii] = arEdgeOrder[ii - 1];
+        ii--;
+      }
+      arEdgeOrder[ii] = nbEdge;
+      nbEdge++;
     }
 
     p2 = p1;
   }
 
-  return nbInter;
+  return nbEdge;
 }
 
 
 /**
- * @function SortIntersection
- * @brief sort the list (increasing order)
- * @param coord_t *xList: list to sort (in & out)
- * @param uint8_t listSize: list size
+ * @function EdgeAdvance
+ * @brief move an edge n scanlines down at once
+ * @param edge_st *e: edge
+ * @param uint16_t n: number of scanlines
  * @return none
  */
-static void SortIntersection(coord_t *xList, uint8_t listSize) {
-
-  uint8_t ii = 0;
-  coord_t tmp;
-
-  if(listSize >= 2) {
-    while(ii < listSize - 1) {
-      if(xList[ii] > xList[ii + 1]) {
-        tmp = xList[ii];
-        xList[ii] = xList[ii + 1];
-        xList[ii + 1] = tmp;
-        if(ii > 0) ii--;
-      }
-      else {
-        ii++;
-      }
+static void EdgeAdvance(edge_st *e, uint16_t n) {
+  uint32_t num;
+  if(n > 0) {
+    num = e->num + (uint32_t) n * e->numStep;
+    e->x += (coord_t) (n * e->xStep + num / e->den);
+    e->num = (uint16_t) (num % e->den);
+  }
+}
+
+
+/**
+ * @function SortActive
+ * @brief sort the active edges by x (insertion sort: the order only changes where edges cross)
+ * @param uint8_t nbActive: number of active edges
+ * @return none
+ */
+static void SortActive(uint8_t nbActive) {
+
+  uint8_t ii, jj, tmp;
+
+  for(ii = 1; ii < nbActive; ii++) {
+    tmp = arActive[ii];
+    jj = ii;
+    while(jj > 0 && arEdge[arActive[jj - 1]].x > arEdge[tmp].x) {
+      arActive[jj] = arActive[jj - 1];
+      jj--;
     }
+    arActive[jj] = tmp;
+  }
+}
+
+
+/**
+ * @function PutSpans
+ * @brief put the spans of a scanline, according to the fill rule
+ * @param coord_t y: scanline
+ * @param uint8_t nbActive: number of active edges
+ * @return none
+ */
+static void PutSpans(coord_t y, uint8_t nbActive) {
+
+  uint8_t ii;
+  int16_t winding = 0;
+  coord_t xStart = 0, x;
+
+  for(ii = 0; ii < nbActive; ii++) {
+
+    x = arEdge[arActive[ii]].x;
+
+    /*even-odd: spans between each pair of edges*/
+    if(context.fillRule == FILL_EVEN_ODD) {
+      if((ii & 1) == 0) xStart = x;
+      else PutSpanClip(xStart, x, y);
+    }
+    /*non-zero: spans where the winding number is not 0*/
+    else {
+      if(winding == 0) xStart = x;
+      winding += arEdge[arActive[ii]].dir;
+      if(winding == 0) PutSpanClip(xStart, x, y);
+    }
+  }
+}
+
+
+/**
+ * @function PutSpanClip
+ * @brief put a horizontal span of the front color, clipped
+ * @param coord_t x0, x1: first & last pixel of the span (x0 <= x1)
+ * @param coord_t y: line of the span; shall be within the clip
+ * @return none
+ */
+static void PutSpanClip(coord_t x0, coord_t x1, coord_t y) {
+
+  if(x0 < context.clip.x) x0 = context.clip.x;
+  if(x1 > context.clip.x + context.clip.w - 1) x1 = context.clip.x + context.clip.w - 1;
+
+  if(x0 <= x1) {
+    SetPos(x0, y);
+    PutN(context.colFront, (uint32_t) (x1 - x0 + 1));
   }
 }
@@ -31,6 +31,18 @@ typedef struct {
   coord_t x, y;
 } point_st;
 
+/**
+ * xform_st: 2D affine transform, in fixed point (1.0 = 1 << XFORM_SHIFT):
+ * x' = (xx.x + xy.y + tx) >> XFORM_SHIFT; y' = (yx.x + yy.y + ty) >> XFORM_SHIFT
+ * computed in 64 bits (a zoom up to 255% of any coord_t overflows 32 bits); the result is clamped to the coord_t range
+ */
+#define XFORM_SHIFT 15
+
+typedef struct {
+  int32_t xx, xy, yx, yy;
+  int64_t tx, ty;
+} xform_st;
+
 /**
  * @function P2D_P_Copy
  * @brief Copy an array of point into another given array
@@ -76,6 +88,40 @@ void P2D_P_Zoom(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint8_
  */
 void P2D_P_Rotate(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint16_t deg);
 
+/**
+ * @function P2D_P_RotateQ16
+ * @brief Rotate all points of an array around a reference point, with a sub-degree resolution
+ * @param point_st *arPoints: array of points; content will be overwritten
+ * @param uint8_t nbPoint: number of points
+ * @param const point_st *ref: reference point
+ * @param uint16_t angle: rotation, Q16 angle (65536 = 1 turn), clockwise on screen
+ * @return none
+ */
+void P2D_P_RotateQ16(point_st *arPoints, uint8_t nbPoint, const point_st *ref, uint16_t angle);
+
+/**
+ * @function P2D_XformInit
+ * @brief compute the transform: rotation & zoom around a reference point, then move
+ * @param xform_st *m: output transform
+ * @param const point_st *ref: reference point
+ * @param uint16_t angle: rotation, Q16 angle (65536 = 1 turn), clockwise on screen
+ * @param uint8_t zoomPercent: zoom, in percent (100 -> no zoom)
+ * @param coord_t mvX, mvY: x & y moves
+ * @return none
+ */
+void P2D_XformInit(xform_st *m, const point_st *ref, uint16_t angle, uint8_t zoomPercent, coord_t mvX, coord_t mvY);
+
+/**
+ * @function P2D_P_Transform
+ * @brief Apply a transform to an array of points (one multiply-add pass per point); the result is clamped to the coord_t range
+ * @param const point_st *src: source array
+ * @param point_st *dst: destination array; may be the source one
+ * @param uint8_t nbPoint: number of points
+ * @param const xform_st *m: transform (see P2D_XformInit())
+ * @return none
+ */
+void P2D_P_Transform(const point_st *src, point_st *dst, uint8_t nbPoint, const xform_st *m);
+
 /**
  * @function P2D_FindPolyCenter
  * @brief Find the center of a polygon
@@ -97,7 +143,7 @@ void P2D_Poly(const point_st *arPoints, uint8_t nbPoint);
 
 /**
  * @function P2D_FillPoly
- * @brief draw a filled polygon
+ * @brief draw a filled polygon, according to the current fill rule (see P2D_SetFillRule())
  * @param const point_st *arPoints: points array
  * @param uint8_t nbPoint: number of points
  * @return none
@@ -28,6 +28,11 @@ context_st context;
 
 /*redirected functions*/
 PutFunc_t Put = LCD_Put;
+PutNFunc_t PutN = LCD_PutN;
+PutRunFunc_t PutRun = LCD_PutRun;
+PutLut8RunFunc_t PutLut8Run = LCD_PutLut8Run;
+GetRunFunc_t GetRun = LCD_GetRun;
+ScrollVFunc_t ScrollV = LCD_ScrollV;
 SetWndFunt_t SetWnd = LCD_SetWnd;
 SetPosFunc_t SetPos = LCD_SetPos;
 GetWidthFunc_t GetWidth = LCD_GetWidth;
@@ -32,6 +32,7 @@ typedef struct {
   dmode_t mode;                   /*display mode (SOLID / TRANSPARENT)*/
   uint8_t alpha;                  /*alpha level*/
   line_t lineType;
+  fill_t fillRule;                /*filled polygon rule (EVEN_ODD / NON_ZERO)*/
 } context_st;
 
 extern context_st context;
@@ -44,6 +45,41 @@ extern context_st context;
 typedef void (*PutFunc_t) (color_t col);
 extern PutFunc_t Put;
 
+/**
+ * PutNFunc_t: puts n pixels of the same color; same cursor behaviour than n calls of Put()
+ * Candidate prototype: void Function(color_t col, uint32_t n)
+ */
+typedef void (*PutNFunc_t) (color_t col, uint32_t n);
+extern PutNFunc_t PutN;
+
+/**
+ * PutRunFunc_t: puts n pixels from an array; same cursor behaviour than n calls of Put()
+ * Candidate prototype: void Function(const color_t *src, uint32_t n)
+ */
+typedef void (*PutRunFunc_t) (const color_t *src, uint32_t n);
+extern PutRunFunc_t PutRun;
+
+/**
+ * PutLut8RunFunc_t: puts n pixels from an array of 8bit indexes, through a lut; same cursor behaviour than n calls of Put()
+ * Candidate prototype: void Function(const uint8_t *src, const color_t *lut, uint32_t n)
+ */
+typedef void (*PutLut8RunFunc_t) (const uint8_t *src, const color_t *lut, uint32_t n);
+extern PutLut8RunFunc_t PutLut8Run;
+
+/**
+ * GetRunFunc_t: reads n pixels into an array; same cursor behaviour than n calls of Put()
+ * Candidate prototype: void Function(color_t *dst, uint32_t n)
+ */
+typedef void (*GetRunFunc_t) (color_t *dst, uint32_t n);
+extern GetRunFunc_t GetRun;
+
+/**
+ * ScrollVFunc_t: moves the content of an area up by dy lines (down if dy < 0); returns 0 if success, -1 if not supported
+ * Candidate prototype: int8_t Function(const rect_st *rec, coord_t dy)
+ */
+typedef int8_t (*ScrollVFunc_t) (const rect_st *rec, coord_t dy);
+extern ScrollVFunc_t ScrollV;
+
 /**
  * SetWndFunt_t: sets a hardware window, and put the cursor at the begin (top-left)
  * Candidate prototype: void Function(rect_st *rec)
@@ -73,4 +109,36 @@ typedef length_t (*GetHeightFunc_t) (void);
 extern GetHeightFunc_t  GetHeight;
 
 
+/**
+ * Display list (p2d_dlist.c): while bListRec is true, the primitives below hand their command to
+ * the corresponding List*() function once clipped, instead of drawing it; List*() returns false
+ * if the command could not be recorded, and shall then be drawn at once
+ */
+typedef enum {
+  DL_STATE = 0,         /*context & font of the next commands*/
+  DL_FILL_RECT,         /*P2D_FillRect()*/
+  DL_FILL_RECT_ALPHA,   /*P2D_FillRectAlpha()*/
+  DL_LINE,              /*P2D_Gline()*/
+  DL_CIRCLE,            /*P2D_Circle()*/
+  DL_FILL_CIRCLE,       /*P2D_FillCircle()*/
+  DL_TEXT,              /*P2D_PutText()*/
+  DL_SPRITE             /*P2D_Sprite()*/
+} dl_op_e;
+
+extern bool bListRec;
+
+bool ListRect(dl_op_e op, const rect_st *rec);
+bool ListLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1);
+bool ListCircle(dl_op_e op, coord_t x0, coord_t y0, length_t radius);
+bool ListText(coord_t x, coord_t y, const uint8_t *str);
+bool ListSprite(const rect_st *src, const rect_st *dst, const uint8_t *pFile, const lut8bpp_st *lut);
+
+/**
+ * ListSuspend() replays the list & removes its hooks from the surface functions, before they are changed
+ * (P2D_SetDest) or bypassed (P2D_BandNext); ListResume() installs the hooks again
+ */
+void ListSuspend(void);
+void ListResume(void);
+
+
 #endif
@@ -22,6 +22,33 @@
  */
 
 #include "p2d_internal.h"
+#include "ticks.h"
+
+
+/**
+ * Lut cache: luts already built, keyed on their source & the part of the color context they depend on,
+ * so that a lut going back to a previous color state (e.g. selected / normal text) is copied, not computed again.
+ * Only luts of up to LC_COLORS colors are cached (4BPP luts); colorkey is applied after the cache
+ */
+#define LC_ENTRY_CNT    8     /*cached luts*/
+#define LC_COLORS       16    /*maximal size of a cached lut*/
+
+typedef struct {
+  const uint8_t *pFile;
+  lutmode_t mode;                           /*lut mode without LUT_O_COLOR_KEY; 0 if the entry is free*/
+  uint16_t size;                            /*requested lut size*/
+  uint16_t colorCount;                      /*resulting lut size*/
+  color_t front, backgrnd;                  /*color context; unused members are set to 0*/
+  uint8_t alpha;
+  uint32_t cycles;                          /*core timer count spent for building the lut*/
+  uint32_t lastUse;                         /*LRU stamp*/
+  color_t lut[LC_COLORS];
+} lc_entry_st;
+
+static lc_entry_st lcEntry[LC_ENTRY_CNT];
+static uint32_t lcClock;                    /*incremented at each cache access*/
+static bool bLcEnable = true;
+static lut_cache_stat_st lcStat;
 
 
 /**
@@ -35,6 +62,9 @@ static int8_t LutCopy(lut_info_st *info, color_t *arColors);
 static void LutAlpha(const lut_info_st *info, color_t *arColors);
 static void LutBlackAndWhite(const lut_info_st *info, color_t *arColors);
 static void LutColorkey(const lut_info_st *info, color_t *arColors);
+static void CacheKey(const lut_info_st *info, uint16_t size, lc_entry_st *key);
+static lc_entry_st *CacheFind(const lc_entry_st *key);
+static void CacheAdd(const lc_entry_st *key, const lut_info_st *info, const color_t *arColors, uint32_t cycles);
 
 
 /**
@@ -82,6 +112,10 @@ int8_t P2D_InitLut8BPP(lut8bpp_st *lut, const uint8_t *pFile, lutmode_t mode) {
 
   int8_t res = -1;
   if(lut != NULL) {
+
+    /*sprites recorded in the display list may use this lut: they are drawn before it changes*/
+    if(bListRec) P2D_ListFlush();
+
     lut->info.pFile = pFile;
     lut->info.mode = mode;
     res = InitLut(&lut->info, lut->lut, 256);
@@ -103,6 +137,44 @@ void P2D_UpdateLut8BPP(lut8bpp_st *lut) {
 }
 
 
+/**
+ * @function P2D_LutCacheEnable
+ * @brief enable or disable the lut cache (enabled by default)
+ * @param bool bEnable: true for enabling the cache
+ * @return none
+ */
+void P2D_LutCacheEnable(bool bEnable) {
+  bLcEnable = bEnable;
+}
+
+
+/**
+ * @function P2D_LutCacheFlush
+ * @brief drop all the cached luts & reset the cache statistics
+ * @param none
+ * @return none
+ */
+void P2D_LutCacheFlush(void) {
+  uint8_t i;
+  for(i = 0; i < LC_ENTRY_CNT; i++) lcEntry[i].mode = 0;
+  lcClock = 0;
+  lcStat.hit = 0;
+  lcStat.miss = 0;
+  lcStat.cyclesSaved = 0;
+}
+
+
+/**
+ * @function P2D_LutCacheGetStat
+ * @brief return the lut cache statistics, since the last P2D_LutCacheFlush()
+ * @param lut_cache_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_LutCacheGetStat(lut_cache_stat_st *stat) {
+  if(stat != NULL) *stat = lcStat;
+}
+
+
 /**
  * @function InitLut
  * @brief initialize a lut
@@ -114,28 +186,53 @@ void P2D_UpdateLut8BPP(lut8bpp_st *lut) {
 static int8_t InitLut(lut_info_st *info, color_t *arColors, uint16_t maxLutSize) {
 
   int8_t res = -1;
+  lc_entry_st key, *e = NULL;
+  uint32_t t0;
+  uint16_t cnt;
+  bool bCache = (bLcEnable && maxLutSize <= LC_COLORS) ? true : false;
+
   info->colorCount = maxLutSize;
 
-  /* 1- Manage exclusive flags*/
-  if     (info->mode & LUT_E_FILLED)   res = LutFill(info, arColors);     /*fill lut with colFront*/
-  else if(info->mode & LUT_E_GRADIENT) res = LutGradient(info, arColors); /*fill lut with alpha gradient*/
-  else if(info->mode & LUT_E_COPY)     res = LutCopy(info, arColors);     /*fill lut with file content*/
-
-  /* 2- Manage optional flags
-   * shall be in the following order:
-   * first, save color context (it is used for color computing)
-   * then apply LUT_O_BLACK_AND_WHITE
-   * then apply LUT_O_ALPHA
-   * finally, apply LUT_COLOR_KEY */
-  if(res == 0) {
+  /* 0- Same lut already built within the same color context: copy it*/
+  if(bCache) {
+    CacheKey(info, maxLutSize, &key);
+    e = CacheFind(&key);
+  }
+  if(e != NULL) {
+    info->colorCount = e->colorCount;
+    for(cnt = 0; cnt < e->colorCount; cnt++) arColors[cnt] = e->lut[cnt];
+    lcStat.hit++;
+    lcStat.cyclesSaved += e->cycles;
+    res = 0;
+  }
+  else {
+    t0 = TicksGetCycles();
+
+    /* 1- Manage exclusive flags*/
+    if     (info->mode & LUT_E_FILLED)   res = LutFill(info, arColors);     /*fill lut with colFront*/
+    else if(info->mode & LUT_E_GRADIENT) res = LutGradient(info, arColors); /*fill lut with alpha gradient*/
+    else if(info->mode & LUT_E_COPY)     res = LutCopy(info, arColors);     /*fill lut with file content*/
+
+    /* 2- Manage optional flags (except colorkey, applied below)
+     * shall be in the following order:
+     * first apply LUT_O_BLACK_AND_WHITE
+     * then apply LUT_O_ALPHA */
+    if(res == 0) {
+      if(info->mode & LUT_O_BLACK_AND_WHITE)  LutBlackAndWhite(info, arColors);
+      if(info->mode & LUT_O_ALPHA)            LutAlpha(info, arColors);
+      if(bCache) {
+        CacheAdd(&key, info, arColors, TicksGetCycles() - t0);
+        lcStat.miss++;
+      }
+    }
+  }
 
-    /*save the color context which has been used for creating the lut*/
+  /* 3- save the color context which has been used for creating the lut, finally apply LUT_COLOR_KEY*/
+  if(res == 0) {
     info->front = context.colFront;
     info->backgrnd = context.colBackgrnd;
     info->alpha = context.alpha;
 
-    if(info->mode & LUT_O_BLACK_AND_WHITE)  LutBlackAndWhite(info, arColors);
-    if(info->mode & LUT_O_ALPHA)            LutAlpha(info, arColors);
     if(info->mode & LUT_O_COLOR_KEY)        LutColorkey(info, arColors);
   }
 
@@ -214,7 +311,7 @@ static int8_t LutFill(const lut_info_st *info, color_t *arColors) {
 static int8_t LutGradient(const lut_info_st *info, color_t *arColors) {
   uint16_t cnt;
   for(cnt = 0; cnt < info->colorCount; cnt++) {
-    arColors[cnt] = P2D_Alpha_a_on_b(context.colFront, context.colBackgrnd, cnt * 255 / (info->colorCount - 1));
+    arColors[cnt] = P2D_AlphaBlend(context.colFront, context.colBackgrnd, cnt * 255 / (info->colorCount - 1));
   }
   return 0;
 }
@@ -267,7 +364,7 @@ static int8_t LutCopy(lut_info_st *info, color_t *arColors) {
 static void LutAlpha(const lut_info_st *info, color_t *arColors) {
   uint16_t cnt;
   for(cnt = 0; cnt < info->colorCount; cnt++) {
-    arColors[cnt] = P2D_Alpha_a_on_b(arColors[cnt], context.colBackgrnd, context.alpha);
+    arColors[cnt] = P2D_AlphaBlend(arColors[cnt], context.colBackgrnd, context.alpha);
   }
 }
 
@@ -295,5 +392,79 @@ static void LutBlackAndWhite(const lut_info_st *info, color_t *arColors) {
  * @return none
  */
 static void LutColorkey(/*@unused@*/const lut_info_st *info, color_t *arColors) {
+  (void) info;  /*same signature as the other lut builders*/
   arColors[0] = context.colBackgrnd;
 }
+
+
+/**
+ * @function CacheKey
+ * @brief build the cache key of a lut: its source, and the part of the color context it depends on
+ * @param const lut_info_st *info: lut info
+ * @param uint16_t size: requested lut size
+ * @param lc_entry_st *key: output key
+ * @return none
+ */
+static void CacheKey(const lut_info_st *info, uint16_t size, lc_entry_st *key) {
+
+  lutmode_t mode = info->mode;
+
+  key->pFile = info->pFile;
+  key->mode = mode & (lutmode_t) ~LUT_O_COLOR_KEY;
+  key->size = size;
+  key->front = (mode & (LUT_E_FILLED | LUT_E_GRADIENT)) ? context.colFront : 0;
+  key->backgrnd = (mode & (LUT_E_GRADIENT | LUT_O_ALPHA)) ? context.colBackgrnd : 0;
+  key->alpha = (mode & LUT_O_ALPHA) ? context.alpha : 0;
+}
+
+
+/**
+ * @function CacheFind
+ * @brief look for a cached lut
+ * @param const lc_entry_st *key: key
+ * @return lc_entry_st *: cache entry, NULL if not found
+ */
+static lc_entry_st *CacheFind(const lc_entry_st *key) {
+
+  uint8_t i;
+  lc_entry_st *e, *res = NULL;
+
+  lcClock++;
+  for(i = 0; i < LC_ENTRY_CNT && res == NULL; i++) {
+    e = &lcEntry[i];
+    if(e->mode == key->mode && e->pFile == key->pFile && e->size == key->size &&
+       e->front == key->front && e->backgrnd == key->backgrnd && e->alpha == key->alpha) {
+      e->lastUse = lcClock;
+      res = e;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function CacheAdd
+ * @brief store a lut into the cache, in a free entry or in place of the least recently used one
+ * @param const lc_entry_st *key: key
+ * @param const lut_info_st *info: lut info
+ * @param const color_t *arColors: lut colors
+ * @param uint32_t cycles: core timer count spent for building the lut
+ * @return none
+ */
+static void CacheAdd(const lc_entry_st *key, const lut_info_st *info, const color_t *arColors, uint32_t cycles) {
+
+  uint8_t i;
+  uint16_t cnt;
+  lc_entry_st *e = &lcEntry[0];
+
+  for(i = 1; i < LC_ENTRY_CNT && e->mode != 0; i++) {
+    if(lcEntry[i].mode == 0 || lcEntry[i].lastUse < e->lastUse) e = &lcEntry[i];
+  }
+
+  *e = *key;
+  e->colorCount = info->colorCount;
+  e->cycles = cycles;
+  e->lastUse = lcClock;
+  for(cnt = 0; cnt < info->colorCount; cnt++) e->lut[cnt] = arColors[cnt];
+}
@@ -55,6 +55,14 @@ typedef struct {
   lut_info_st info;
 } lut8bpp_st;
 
+/**
+ * @typedef lut_cache_stat_st
+ */
+typedef struct {
+  uint32_t hit, miss;       /*lut builds found / not found in the lut cache*/
+  uint32_t cyclesSaved;     /*core timer count (SYS_CLK / 2) the hits did not spend in building luts*/
+} lut_cache_stat_st;
+
 
 /**
  *
@@ -115,4 +123,28 @@ int8_t P2D_InitLut8BPP(lut8bpp_st *lut, const uint8_t *pFile, lutmode_t mode);
  */
 void P2D_UpdateLut8BPP(lut8bpp_st *lut);
 
+/**
+ * @function P2D_LutCacheEnable
+ * @brief enable or disable the lut cache (enabled by default)
+ * @param bool bEnable: true for enabling the cache
+ * @return none
+ */
+void P2D_LutCacheEnable(bool bEnable);
+
+/**
+ * @function P2D_LutCacheFlush
+ * @brief drop all the cached luts & reset the cache statistics
+ * @param none
+ * @return none
+ */
+void P2D_LutCacheFlush(void);
+
+/**
+ * @function P2D_LutCacheGetStat
+ * @brief return the lut cache statistics, since the last P2D_LutCacheFlush()
+ * @param lut_cache_stat_st *stat: output statistics
+ * @return none
+ */
+void P2D_LutCacheGetStat(lut_cache_stat_st *stat);
+
 #endif
@@ -1,6 +1,6 @@
 /**
  * @file p2d_math.c
- * @brief p2d math functions (synthetized sin table & random)
+ * @brief p2d math functions (synthetized sin table, Q16 trigonometry & random)
  * @author Duboisset Philippe
  * @version 0.2b
  * @date (yyyy-mm-dd)
@@ -69,6 +69,42 @@ static const int16_t arSin[360] = {
   -5689,  -5125,  -4560,  -3993,  -3425,  -2855,  -2285,  -1714,  -1143,   -571
 };
 
+/*sin(i * 90deg / 256) * 32767, i E [0; 256]: quarter wave, for Q16 angles (with interpolation)*/
+static const int16_t arQuarterSin[257] = {
+       0,    201,    402,    603,    804,   1005,   1206,   1407,   1608,   1809,
+    2009,   2210,   2410,   2611,   2811,   3012,   3212,   3412,   3612,   3811,
+    4011,   4210,   4410,   4609,   4808,   5007,   5205,   5404,   5602,   5800,
+    5998,   6195,   6393,   6590,   6786,   6983,   7179,   7375,   7571,   7767,
+    7962,   8157,   8351,   8545,   8739,   8933,   9126,   9319,   9512,   9704,
+    9896,  10087,  10278,  10469,  10659,  10849,  11039,  11228,  11417,  11605,
+   11793,  11980,  12167,  12353,  12539,  12725,  12910,  13094,  13279,  13462,
+   13645,  13828,  14010,  14191,  14372,  14553,  14732,  14912,  15090,  15269,
+   15446,  15623,  15800,  15976,  16151,  16325,  16499,  16673,  16846,  17018,
+   17189,  17360,  17530,  17700,  17869,  18037,  18204,  18371,  18537,  18703,
+   18868,  19032,  19195,  19357,  19519,  19680,  19841,  20000,  20159,  20317,
+   20475,  20631,  20787,  20942,  21096,  21250,  21403,  21554,  21705,  21856,
+   22005,  22154,  22301,  22448,  22594,  22739,  22884,  23027,  23170,  23311,
+   23452,  23592,  23731,  23870,  24007,  24143,  24279,  24413,  24547,  24680,
+   24811,  24942,  25072,  25201,  25329,  25456,  25582,  25708,  25832,  25955,
+   26077,  26198,  26319,  26438,  26556,  26674,  26790,  26905,  27019,  27133,
+   27245,  27356,  27466,  27575,  27683,  27790,  27896,  28001,  28105,  28208,
+   28310,  28411,  28510,  28609,  28706,  28803,  28898,  28992,  29085,  29177,
+   29268,  29358,  29447,  29534,  29621,  29706,  29791,  29874,  29956,  30037,
+   30117,  30195,  30273,  30349,  30424,  30498,  30571,  30643,  30714,  30783,
+   30852,  30919,  30985,  31050,  31113,  31176,  31237,  31297,  31356,  31414,
+   31470,  31526,  31580,  31633,  31685,  31736,  31785,  31833,  31880,  31926,
+   31971,  32014,  32057,  32098,  32137,  32176,  32213,  32250,  32285,  32318,
+   32351,  32382,  32412,  32441,  32469,  32495,  32521,  32545,  32567,  32589,
+   32609,  32628,  32646,  32663,  32678,  32692,  32705,  32717,  32728,  32737,
+   32745,  32752,  32757,  32761,  32765,  32766,  32767
+};
+
+/*atan(2^-i) for the CORDIC iterations, in 1/2^24 turn*/
+#define CORDIC_ITER 18
+static const uint32_t arAtan[CORDIC_ITER] = {
+  2097152, 1238021, 654136, 332050, 166669, 83416, 41718, 20860, 10430, 5215, 2608, 1304, 652, 326, 163, 81, 41, 20
+};
+
 
 /**
  * @function P2D_RandInit
@@ -117,6 +153,130 @@ int16_t P2D_Cos(int16_t deg) {
 }
 
 
+/**
+ * @function P2D_DegToQ16
+ * @brief convert an angle in degrees into a Q16 angle
+ * @param int16_t deg: angle, in degree
+ * @return uint16_t: Q16 angle (65536 = 1 turn)
+ */
+uint16_t P2D_DegToQ16(int16_t deg) {
+  int32_t d = deg % 360;
+  if(d < 0) d += 360;
+  return (uint16_t) ((d * 65536L + 180) / 360);
+}
+
+
+/**
+ * @function P2D_Q16ToDeg
+ * @brief convert a Q16 angle into degrees (rounded)
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn)
+ * @return int16_t: angle, in degree, range [0; 359]
+ */
+int16_t P2D_Q16ToDeg(uint16_t angle) {
+  int16_t deg = (int16_t) (((uint32_t) angle * 360 + 32768) >> 16);
+  if(deg == 360) deg = 0;
+  return deg;
+}
+
+
+/**
+ * @function P2D_SinQ16
+ * @brief return sinus value of a Q16 angle: quarter wave table, linearly interpolated
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn, 1 LSB = 0.0055 degree)
+ * @return int16_t: sinus, between -32767 and +32767
+ */
+int16_t P2D_SinQ16(uint16_t angle) {
+
+  uint16_t a, idx, frac;
+  int32_t res;
+
+  /*fold the angle into the first quarter: 256 table steps of 64 Q16 LSB*/
+  a = angle & 0x3FFF;
+  if(angle & 0x4000) a = 0x4000 - a;
+  idx = a >> 6;
+  frac = a & 0x3F;
+
+  res = arQuarterSin[idx];
+  if(frac != 0) res += ((arQuarterSin[idx + 1] - res) * frac + 32) >> 6;
+
+  /*second half: negative*/
+  if(angle & 0x8000) res = -res;
+
+  return (int16_t) res;
+}
+
+
+/**
+ * @function P2D_CosQ16
+ * @brief return cosinus value of a Q16 angle
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn)
+ * @return int16_t: cosinus, between -32767 and +32767
+ */
+int16_t P2D_CosQ16(uint16_t angle) {
+  return P2D_SinQ16((uint16_t) (angle + 0x4000));
+}
+
+
+/**
+ * @function P2D_Atan2
+ * @brief return the angle of a vector (CORDIC, vectoring mode)
+ * @param int32_t y, int32_t x: vector; y axis pointing up (negate screen y)
+ * @return uint16_t: Q16 angle, counterclockwise from the x axis (65536 = 1 turn); 0 if x = y = 0
+ */
+uint16_t P2D_Atan2(int32_t y, int32_t x) {
+
+  uint32_t angle = 0, m;
+  int32_t xNew;
+  uint8_t i;
+
+  if(x != 0 || y != 0) {
+
+    /*left half-plane: rotate by half a turn, so that the iterations converge*/
+    if(x < 0) {
+      x = -x;
+      y = -y;
+      angle = 0x800000;
+    }
+
+    /*bring the magnitude to [2^28; 2^29[ : full precision, no overflow (x grows by 1.65)*/
+    m = (uint32_t) x | (uint32_t) P2D_Abs(y);
+    while(m >= (1UL << 29)) {
+      x >>= 1;
+      y >>= 1;
+      m >>= 1;
+    }
+    while(m < (1UL << 20)) {
+      x <<= 8;
+      y <<= 8;
+      m <<= 8;
+    }
+    while(m < (1UL << 28)) {
+      x <<= 1;
+      y <<= 1;
+      m <<= 1;
+    }
+
+    /*rotate the vector toward the x axis, summing the rotations*/
+    for(i = 0; i < CORDIC_ITER; i++) {
+      if(y > 0) {
+        xNew = x + (y >> i);
+        y -= x >> i;
+        angle += arAtan[i];
+      }
+      else {
+        xNew = x - (y >> i);
+        y += x >> i;
+        angle -= arAtan[i];
+      }
+      x = xNew;
+    }
+  }
+
+  /*1/2^24 turn -> Q16, rounded*/
+  return (uint16_t) ((angle + 0x80) >> 8);
+}
+
+
 /**
  * @function P2D_Abs
  * @brief return abs value
@@ -129,6 +289,20 @@ int32_t P2D_Abs(int32_t val) {
 }
 
 
+/**
+ * @function P2D_FloorDiv
+ * @brief return floor(a / b); the C division truncates toward 0
+ * @param int32_t a
+ * @param int32_t b: shall be > 0
+ * @return int32_t: floor(a / b)
+ */
+int32_t P2D_FloorDiv(int32_t a, int32_t b) {
+  int32_t q = a / b;
+  if(q * b != a && a < 0) q--;
+  return q;
+}
+
+
 /**
  * @function P2D_sqrt
  * @brief return the root of a given value
@@ -156,3 +330,31 @@ uint8_t P2D_sqrt(uint16_t val) {
 
   return res;
 }
+
+
+/**
+ * @function P2D_sqrt32
+ * @brief return the integer root of a given 32 bit value
+ * @param uint32_t val
+ * @return uint16_t: floor(sqrt(val))
+ */
+uint16_t P2D_sqrt32(uint32_t val) {
+
+  uint32_t res = 0, bit = 1UL << 30;
+
+  /*digit by digit method, 2 bits per iteration*/
+  while(bit > val) bit >>= 2;
+
+  while(bit != 0) {
+    if(val >= res + bit) {
+      val -= res + bit;
+      res = (res >> 1) + bit;
+    }
+    else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return (uint16_t) res;
+}
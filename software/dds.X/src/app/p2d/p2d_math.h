@@ -1,6 +1,6 @@
 /**
  * @file p2d_math.h
- * @brief p2d math functions (synthetized sin table & random)
+ * @brief p2d math functions (synthetized sin table, Q16 trigonometry & random)
  * @author Duboisset Philippe
  * @version 0.2b
  * @date (yyyy-mm-dd)
@@ -62,6 +62,46 @@ int16_t P2D_Sin(int16_t deg);
  */
 int16_t P2D_Cos(int16_t deg);
 
+/**
+ * @function P2D_DegToQ16
+ * @brief convert an angle in degrees into a Q16 angle
+ * @param int16_t deg: angle, in degree
+ * @return uint16_t: Q16 angle (65536 = 1 turn)
+ */
+uint16_t P2D_DegToQ16(int16_t deg);
+
+/**
+ * @function P2D_Q16ToDeg
+ * @brief convert a Q16 angle into degrees (rounded)
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn)
+ * @return int16_t: angle, in degree, range [0; 359]
+ */
+int16_t P2D_Q16ToDeg(uint16_t angle);
+
+/**
+ * @function P2D_SinQ16
+ * @brief return sinus value of a Q16 angle: quarter wave table, linearly interpolated
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn, 1 LSB = 0.0055 degree)
+ * @return int16_t: sinus, between -32767 and +32767
+ */
+int16_t P2D_SinQ16(uint16_t angle);
+
+/**
+ * @function P2D_CosQ16
+ * @brief return cosinus value of a Q16 angle
+ * @param uint16_t angle: Q16 angle (65536 = 1 turn)
+ * @return int16_t: cosinus, between -32767 and +32767
+ */
+int16_t P2D_CosQ16(uint16_t angle);
+
+/**
+ * @function P2D_Atan2
+ * @brief return the angle of a vector (CORDIC, vectoring mode)
+ * @param int32_t y, int32_t x: vector; y axis pointing up (negate screen y)
+ * @return uint16_t: Q16 angle, counterclockwise from the x axis (65536 = 1 turn); 0 if x = y = 0
+ */
+uint16_t P2D_Atan2(int32_t y, int32_t x);
+
 /**
  * @function P2D_Abs
  * @brief return abs value
@@ -70,6 +110,15 @@ int16_t P2D_Cos(int16_t deg);
  */
 int32_t P2D_Abs(int32_t val);
 
+/**
+ * @function P2D_FloorDiv
+ * @brief return floor(a / b); the C division truncates toward 0
+ * @param int32_t a
+ * @param int32_t b: shall be > 0
+ * @return int32_t: floor(a / b)
+ */
+int32_t P2D_FloorDiv(int32_t a, int32_t b);
+
 /**
  * @function P2D_sqrt
  * @brief return the root of a given value
@@ -78,4 +127,12 @@ int32_t P2D_Abs(int32_t val);
  */
 uint8_t P2D_sqrt(uint16_t val);
 
+/**
+ * @function P2D_sqrt32
+ * @brief return the integer root of a given 32 bit value
+ * @param uint32_t val
+ * @return uint16_t: floor(sqrt(val))
+ */
+uint16_t P2D_sqrt32(uint32_t val);
+
 #endif
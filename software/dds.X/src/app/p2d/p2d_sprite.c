@@ -1,6 +1,6 @@
 /**
  * @file p2d_sprite.c
- * @brief p2d sprite functions (limited to 8BPP)
+ * @brief p2d sprite functions (limited to 8BPP, raw or run-length encoded)
  * @author Duboisset Philippe
  * @version based on 0.2b (modification not checked) 2014-04-05
  * @date (yyyy-mm-dd) 2013-04-07 creation
@@ -43,6 +43,21 @@ enum {
   SP_OFFSET_RAW
 };
 
+/**
+ * run-length encoded sprites (see software/tools/sprite_rle):
+ * after the header, a row index gives the offset (24 bits, MSB first) of every SP_RLE_INDEX_ROWS-th row
+ * from the first run; then come the runs: a control byte [TT LLLLLL] of L + 1 pixels, never crossing a row
+ */
+#define SP_BPP_8          8
+#define SP_BPP_RLE8       0x88  /*8BPP indexes, run-length encoded*/
+#define SP_RLE_INDEX_ROWS 16
+#define SP_RLE_TYPE       0xC0
+#define SP_RLE_LEN        0x3F
+#define SP_RLE_SKIP       0x00  /*transparent run (index 0)*/
+#define SP_RLE_FILL       0x40  /*fill run, followed by the index*/
+#define SP_RLE_LITERAL    0x80  /*literal run, followed by the indexes*/
+#define SP_RLE_LINE       256   /*DISPLAY_SOLID: decoded indexes are gathered in a line, sent at once*/
+
 
 /**
  * private variables
@@ -54,8 +69,11 @@ static /*@null@*/ const lut8bpp_st *pLut8 = NULL;
  * Local functions prototypes
  */
 static int8_t SpriteOpen(/*@out@*/sprite_st *ptr, const uint8_t *pFile);
-static void PutFast_8BPP(const rect_st *dst, const color_t *lut, const uint8_t *raw, uint32_t pxCnt);
+static void PutFast_8BPP(const color_t *lut, const uint8_t *raw, uint32_t pxCnt);
 static void PutSlow_8BPP(const rect_st *dst, const rect_st *src, const color_t *lut, const sprite_st *sprite);
+static void Put_RLE8(const rect_st *dst, const rect_st *src, const color_t *lut, const sprite_st *sprite);
+static const uint8_t *RleSeekRow(const sprite_st *sprite, coord_t y);
+static const uint8_t *RleNextRun(const uint8_t *run);
 
 
 /**
@@ -95,6 +113,17 @@ void P2D_SpriteSetLut8BPP(const lut8bpp_st *lut) {
 }
 
 
+/**
+ * @function P2D_SpriteGetLut8BPP
+ * @brief return the lut used for 8BPP sprites
+ * @param none
+ * @return const lut8bpp_st *: current lut; may be NULL
+ */
+const lut8bpp_st *P2D_SpriteGetLut8BPP(void) {
+  return pLut8;
+}
+
+
 /**
  * @function P2D_Sprite
  * @brief put a given sprite part on current surface, at given coordinates
@@ -115,21 +144,25 @@ void P2D_Sprite(const rect_st *src, const rect_st *dst, const uint8_t *pFile) {
     /*apply clipping*/
     px = P2D_ClipBitBlt(&sprite.dim, src, dst, &lsrc, &ldst);
 
-    /*if some pixels remain after clipping*/
-    if(px > 0) {
+    /*if some pixels remain after clipping; while recording, the sprite is drawn on replay*/
+    if(px > 0 && (bListRec == false || ListSprite(&lsrc, &ldst, pFile, pLut8) == false)) {
 
       SetWnd(&ldst);
 
+      /*run-length encoded: decoded into spans, whatever the clipping & display mode*/
+      if(sprite.bpp == SP_BPP_RLE8) {
+        if(pLut8 != NULL) Put_RLE8(&ldst, &lsrc, pLut8->lut, &sprite);
+      }
       /*if source & destination have the same width & DISPLAY_SOLID -> optimized procedure*/
-      if(ldst.w == sprite.dim.w && context.mode == DISPLAY_SOLID) {
-        if(sprite.bpp == 8 && pLut8 != NULL) {
+      else if(ldst.w == sprite.dim.w && context.mode == DISPLAY_SOLID) {
+        if(sprite.bpp == SP_BPP_8 && pLut8 != NULL) {
           raw = &(sprite.raw[lsrc.x + lsrc.y * sprite.dim.w]);
-          PutFast_8BPP(&ldst, pLut8->lut, raw, px);
+          PutFast_8BPP(pLut8->lut, raw, px);
         }
       }
       /*else, pixel per pixel... much slower!*/
       else {
-        if(sprite.bpp == 8 && pLut8 != NULL) {
+        if(sprite.bpp == SP_BPP_8 && pLut8 != NULL) {
           PutSlow_8BPP(&ldst, &lsrc, pLut8->lut, &sprite);
         }
       }
@@ -160,7 +193,7 @@ static int8_t SpriteOpen(sprite_st *ptr, const uint8_t *pFile) {
   ptr->raw   = &pFile[SP_OFFSET_RAW];
 
   /*check coherence: known bpp and valid dimension*/
-  if(P2D_GetPixelCnt(&ptr->dim) > 0 && ptr->bpp == 8) {
+  if(P2D_GetPixelCnt(&ptr->dim) > 0 && (ptr->bpp == SP_BPP_8 || ptr->bpp == SP_BPP_RLE8)) {
     res = 0;
   }
 
@@ -170,18 +203,15 @@ static int8_t SpriteOpen(sprite_st *ptr, const uint8_t *pFile) {
 
 /**
  * @function PutFast_8BPP
- * @brief sprite copy, optimized procedure
- * @param const rect_st *dst: destination window
+ * @brief sprite copy, optimized procedure; the destination window shall be set
  * @param const color_t *lut: lut to use
  * @param const uint8_t *raw: sprite raw address
  * @param uint32_t pxCnt: number of pixel composing the destination window
  * @return none
  */
-static void PutFast_8BPP(const rect_st *dst, const color_t *lut, const uint8_t *raw, uint32_t pxCnt) {
-
-
-  while(pxCnt-- > 0) Put(lut[*raw++]);
+static void PutFast_8BPP(const color_t *lut, const uint8_t *raw, uint32_t pxCnt) {
 
+  PutLut8Run(raw, lut, pxCnt);
 }
 
 
@@ -196,9 +226,8 @@ static void PutFast_8BPP(const rect_st *dst, const color_t *lut, const uint8_t *
  */
 static void PutSlow_8BPP(const rect_st *dst, const rect_st *src, const color_t *lut, const sprite_st *sprite) {
 
-  coord_t sx, sy, dx, dy;
+  coord_t sx, sy, dx, dy, run;
   const uint8_t *raw;
-  bool bPos;
 
   dx = dst->x;
   dy = dst->y;
@@ -208,14 +237,8 @@ static void PutSlow_8BPP(const rect_st *dst, const rect_st *src, const color_t *
 
       raw = &(sprite->raw[src->x + sy * sprite->dim.w]);
       SetPos(dx, dy);
-
-      for(sx = 0; sx < dst->w; sx++) {
-        Put(lut[*raw]);
-        raw++;
-      }
-
+      PutLut8Run(raw, lut, dst->w);
       dy++;
-      dx = dst->x;
     }
   }
   else {
@@ -223,30 +246,154 @@ static void PutSlow_8BPP(const rect_st *dst, const rect_st *src, const color_t *
 
       raw = &(sprite->raw[src->x + sy * sprite->dim.w]);
 
-      bPos = true;
+      /*transparent: put each run of non-null indexes at once*/
+      sx = 0;
+      while(sx < dst->w) {
+        run = 0;
+        while(sx + run < dst->w && raw[run] != 0) run++;
+
+        if(run > 0) {
+          SetPos(dx + sx, dy);
+          PutLut8Run(raw, lut, run);
+        }
+        else {
+          run = 1;  /*skip a transparent pixel*/
+        }
+        sx += run;
+        raw += run;
+      }
+
+      dy++;
+    }
+  }
+
+
+}
+
+
+/**
+ * @function Put_RLE8
+ * @brief run-length encoded sprite copy; each visible run is sent as a span (transparent runs skipped if DISPLAY_TRANSPARENT)
+ * @param const rect_st *dst: destination window
+ * @param const rect_st *src: source window
+ * @param const color_t *lut: lut to use
+ * @param const const sprite_st *sprite: pointer to sprite structure
+ * @return none
+ */
+static void Put_RLE8(const rect_st *dst, const rect_st *src, const color_t *lut, const sprite_st *sprite) {
+
+  const uint8_t *run, *pRaw;
+  coord_t x, x0, x1, dy, len, a, b, cnt;
+  uint8_t type, line[SP_RLE_LINE], *pLine;
+  uint16_t lineLen = 0;
+  bool bSeek;
+
+  run = RleSeekRow(sprite, src->y);
+  x0 = src->x;
+  x1 = src->x + dst->w;
+
+  for(dy = dst->y; dy < dst->y + dst->h; dy++) {
+
+    bSeek = true;
+
+    for(x = 0; x < sprite->dim.w; x += len) {
+
+      type = run[0] & SP_RLE_TYPE;
+      len = (coord_t) (run[0] & SP_RLE_LEN) + 1;
 
-      for(sx = 0; sx < dst->w; sx++) {
-        if(*raw != 0) {
+      /*visible part of the run [a; b[*/
+      a = (x > x0) ? x : x0;
+      b = (x + len < x1) ? x + len : x1;
 
-          if(bPos) {
-            SetPos(dx, dy);
-            bPos = false;
+      /*solid: the window wraps the rows, indexes are gathered and sent by lines*/
+      if(context.mode == DISPLAY_SOLID) {
+        while(a < b) {
+          cnt = (b - a < SP_RLE_LINE - lineLen) ? b - a : SP_RLE_LINE - lineLen;
+          pLine = &line[lineLen];
+          lineLen += cnt;
+          a += cnt;
+          if(type == SP_RLE_SKIP) {
+            while(cnt-- > 0) *pLine++ = 0;
           }
-          Put(lut[*raw]);
+          else if(type == SP_RLE_FILL) {
+            while(cnt-- > 0) *pLine++ = run[1];
+          }
+          else {
+            pRaw = &run[1 + a - cnt - x];
+            while(cnt-- > 0) *pLine++ = *pRaw++;
+          }
+          if(lineLen == SP_RLE_LINE) {
+            PutLut8Run(line, lut, lineLen);
+            lineLen = 0;
+          }
+        }
+      }
+      /*transparent: each opaque run is a span, the cursor is moved after a skipped run*/
+      else if(a < b) {
+        if(type == SP_RLE_SKIP) {
+          bSeek = true;
         }
         else {
-          bPos = true;
+          if(bSeek) {
+            SetPos(dst->x + a - x0, dy);
+            bSeek = false;
+          }
+          if(type == SP_RLE_FILL) PutN(lut[run[1]], (uint32_t) (b - a));
+          else PutLut8Run(&run[1 + a - x], lut, (uint32_t) (b - a));
         }
-        dx++;
-        raw++;
       }
 
-      dy++;
-      dx = dst->x;
+      run = RleNextRun(run);
     }
   }
 
+  if(lineLen > 0) PutLut8Run(line, lut, lineLen);
+}
 
+
+/**
+ * @function RleSeekRow
+ * @brief return the first run of a row of a run-length encoded sprite
+ * @param const sprite_st *sprite: pointer to sprite structure
+ * @param coord_t y: row
+ * @return const uint8_t*: first run of the row
+ */
+static const uint8_t *RleSeekRow(const sprite_st *sprite, coord_t y) {
+
+  const uint8_t *run, *index;
+  coord_t row, x;
+  uint32_t offset;
+
+  /*jump to the closest indexed row*/
+  index = &sprite->raw[3 * (y / SP_RLE_INDEX_ROWS)];
+  offset = ((uint32_t) index[0] << 16) | ((uint32_t) index[1] << 8) | index[2];
+  run = &sprite->raw[3 * ((sprite->dim.h + SP_RLE_INDEX_ROWS - 1) / SP_RLE_INDEX_ROWS) + offset];
+
+  /*then walk the remaining rows*/
+  for(row = y - y % SP_RLE_INDEX_ROWS; row < y; row++) {
+    x = 0;
+    while(x < sprite->dim.w) {
+      x += (coord_t) (run[0] & SP_RLE_LEN) + 1;
+      run = RleNextRun(run);
+    }
+  }
+
+  return run;
+}
+
+
+/**
+ * @function RleNextRun
+ * @brief return the run following a given one
+ * @param const uint8_t *run: current run
+ * @return const uint8_t*: next run
+ */
+static const uint8_t *RleNextRun(const uint8_t *run) {
+  const uint8_t *res;
+  if((run[0] & SP_RLE_TYPE) == SP_RLE_FILL) res = run + 2;
+  else if((run[0] & SP_RLE_TYPE) == SP_RLE_LITERAL) res = run + 2 + (run[0] & SP_RLE_LEN);
+  else res = run + 1;
+  return res;
 }
 
 
@@ -261,10 +408,24 @@ uint8_t P2D_SpriteGetPixel(const uint8_t *ptr, coord_t x, coord_t y) {
 
   sprite_st sprite;
   uint8_t res = 0;
+  const uint8_t *run;
+  coord_t xr;
 
   if(SpriteOpen(&sprite, ptr) == 0) {
     if(x >= 0 && y >= 0 && x < sprite.dim.w && y < sprite.dim.h) {
-      res = sprite.raw[(uint32_t)sprite.dim.w * y + x];
+      if(sprite.bpp == SP_BPP_RLE8) {
+        run = RleSeekRow(&sprite, y);
+        for(xr = (coord_t) (run[0] & SP_RLE_LEN) + 1; xr <= x; xr += (coord_t) (run[0] & SP_RLE_LEN) + 1) {
+          run = RleNextRun(run);
+        }
+        xr -= (coord_t) (run[0] & SP_RLE_LEN) + 1;  /*first pixel of the run containing x*/
+        if((run[0] & SP_RLE_TYPE) == SP_RLE_FILL) res = run[1];
+        else if((run[0] & SP_RLE_TYPE) == SP_RLE_LITERAL) res = run[1 + x - xr];
+        else res = 0;
+      }
+      else {
+        res = sprite.raw[(uint32_t)sprite.dim.w * y + x];
+      }
     }
   }
   return res;
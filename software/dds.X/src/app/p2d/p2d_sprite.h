@@ -1,6 +1,6 @@
 /**
  * @file p2d_sprite.c
- * @brief p2d sprite functions (limited to 8BPP)
+ * @brief p2d sprite functions (limited to 8BPP, raw or run-length encoded)
  * @author Duboisset Philippe
  * @version based on 0.2b (modification not checked) 2014-04-05
  * @date (yyyy-mm-dd) 2013-04-07 creation
@@ -51,6 +51,14 @@ length_t P2D_SpriteGetHeight(const uint8_t *pFile);
  */
 void P2D_SpriteSetLut8BPP(const lut8bpp_st *lut);
 
+/**
+ * @function P2D_SpriteGetLut8BPP
+ * @brief return the lut used for 8BPP sprites
+ * @param none
+ * @return const lut8bpp_st *: current lut; may be NULL
+ */
+const lut8bpp_st *P2D_SpriteGetLut8BPP(void);
+
 /**
  * @function P2D_Sprite
  * @brief put a given sprite part on current surface, at given coordinates
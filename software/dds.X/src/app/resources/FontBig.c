@@ -2,1359 +2,620 @@
 #include "resources.h"
 //client.exe FreeSerif.ttf 4 32 44 127 FontBig.c
 const uint8_t FontBig[] = {
-
-  2,  /*font type*/
+  3,  /*font type: 4BPP, trimmed glyph boxes*/
   44, /*first car ID*/
-  127, /*number of car*/
+  127, /*last car ID*/
   36, /*font height*/
-  /*index table: glyph width, offset hl, lh, ll*/
-  0x08, 0x00, 0x00, 0x00,
-  0x0B, 0x00, 0x00, 0x91,
-  0x08, 0x00, 0x01, 0x58,
-  0x0A, 0x00, 0x01, 0xE9,
-  0x10, 0x00, 0x02, 0x9E,
-  0x10, 0x00, 0x03, 0xBF,
-  0x10, 0x00, 0x04, 0xE0,
-  0x10, 0x00, 0x06, 0x01,
-  0x11, 0x00, 0x07, 0x22,
-  0x11, 0x00, 0x08, 0x55,
-  0x10, 0x00, 0x09, 0x88,
-  0x10, 0x00, 0x0A, 0xA9,
-  0x11, 0x00, 0x0B, 0xCA,
-  0x10, 0x00, 0x0C, 0xFD,
-  0x09, 0x00, 0x0E, 0x1E,
-  0x08, 0x00, 0x0E, 0xC1,
-  0x12, 0x00, 0x0F, 0x52,
-  0x12, 0x00, 0x10, 0x97,
-  0x12, 0x00, 0x11, 0xDC,
-  0x0E, 0x00, 0x13, 0x21,
-  0x1C, 0x00, 0x14, 0x1E,
-  0x17, 0x00, 0x16, 0x17,
-  0x15, 0x00, 0x17, 0xB6,
-  0x16, 0x00, 0x19, 0x31,
-  0x16, 0x00, 0x1A, 0xBE,
-  0x13, 0x00, 0x1C, 0x4B,
-  0x12, 0x00, 0x1D, 0xA2,
-  0x17, 0x00, 0x1E, 0xE7,
-  0x16, 0x00, 0x20, 0x86,
-  0x0B, 0x00, 0x22, 0x13,
-  0x0C, 0x00, 0x22, 0xDA,
-  0x17, 0x00, 0x23, 0xB3,
-  0x13, 0x00, 0x25, 0x52,
-  0x1C, 0x00, 0x26, 0xA9,
-  0x18, 0x00, 0x28, 0xA2,
-  0x17, 0x00, 0x2A, 0x53,
-  0x12, 0x00, 0x2B, 0xF2,
-  0x17, 0x00, 0x2D, 0x37,
-  0x15, 0x00, 0x2E, 0xD6,
-  0x11, 0x00, 0x30, 0x51,
-  0x14, 0x00, 0x31, 0x84,
-  0x16, 0x00, 0x32, 0xED,
-  0x17, 0x00, 0x34, 0x7A,
-  0x1F, 0x00, 0x36, 0x19,
-  0x18, 0x00, 0x38, 0x48,
-  0x17, 0x00, 0x39, 0xF9,
-  0x14, 0x00, 0x3B, 0x98,
-  0x0B, 0x00, 0x3D, 0x01,
-  0x0A, 0x00, 0x3D, 0xC8,
-  0x0B, 0x00, 0x3E, 0x7D,
-  0x0F, 0x00, 0x3F, 0x44,
-  0x10, 0x00, 0x40, 0x53,
-  0x09, 0x00, 0x41, 0x74,
-  0x0F, 0x00, 0x42, 0x17,
-  0x11, 0x00, 0x43, 0x26,
-  0x0E, 0x00, 0x44, 0x59,
-  0x11, 0x00, 0x45, 0x56,
-  0x0F, 0x00, 0x46, 0x89,
-  0x0D, 0x00, 0x47, 0x98,
-  0x10, 0x00, 0x48, 0x83,
-  0x10, 0x00, 0x49, 0xA4,
-  0x08, 0x00, 0x4A, 0xC5,
-  0x0B, 0x00, 0x4B, 0x56,
-  0x11, 0x00, 0x4C, 0x1D,
-  0x09, 0x00, 0x4D, 0x50,
-  0x19, 0x00, 0x4D, 0xF3,
-  0x10, 0x00, 0x4F, 0xB6,
-  0x10, 0x00, 0x50, 0xD7,
-  0x11, 0x00, 0x51, 0xF8,
-  0x10, 0x00, 0x53, 0x2B,
-  0x0C, 0x00, 0x54, 0x4C,
-  0x0B, 0x00, 0x55, 0x25,
-  0x09, 0x00, 0x55, 0xEC,
-  0x0F, 0x00, 0x56, 0x8F,
-  0x0F, 0x00, 0x57, 0x9E,
-  0x17, 0x00, 0x58, 0xAD,
-  0x10, 0x00, 0x5A, 0x4C,
-  0x10, 0x00, 0x5B, 0x6D,
-  0x0E, 0x00, 0x5C, 0x8E,
-  0x10, 0x00, 0x5D, 0x8B,
-  0x06, 0x00, 0x5E, 0xAC,
-  0x10, 0x00, 0x5F, 0x19,
-  0x10, 0x00, 0x60, 0x3A,
-  0x13, 0x00, 0x61, 0x5B,
-  /*glyph raw*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x8F, 0xC1, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x02, 0xFF, 0xFF, 0x00, 0x00, 0xAF, 0xFF, 0x00, 0x00, 0x00, 0x4C, 0x00, 
-  0x00, 0x00, 0x76, 0x00, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x4B, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x11, 0x11, 0x10, 
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xE5, 0x00, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x5F, 0xE5, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 
-  0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 
-  0x00, 0x3F, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x00, 0x00, 
-  0x08, 0xFA, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 
-  0xDF, 0x50, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x00, 0x00, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x3F, 
-  0xF1, 0x00, 0x00, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCF, 0xFD, 0x70, 0x00, 0x00, 0x00, 0x01, 0xBF, 0x60, 0x06, 0xFC, 
-  0x10, 0x00, 0x00, 0x0A, 0xF7, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x0F, 0xF5, 0x00, 0x00, 0xDF, 
-  0x90, 0x00, 0x00, 0x0A, 0xFD, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 0x06, 0xFF, 0x30, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x03, 
-  0xFF, 0x80, 0x0B, 0xFF, 0x10, 0x00, 0x00, 0x01, 0xFF, 0xB0, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x0F, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0xEF, 0xF0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0B, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x07, 0xFF, 0x20, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x02, 0xFF, 0x50, 0x00, 0x00, 0x05, 
-  0xFF, 0x30, 0x00, 0xCF, 0x90, 0x00, 0x00, 0x09, 0xFD, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0x0A, 
-  0xF6, 0x00, 0x00, 0x6F, 0xB0, 0x00, 0x00, 0x01, 0xBF, 0x50, 0x06, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xFD, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x03, 0x99, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 
-  0x50, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 
-  0x00, 0x5F, 0xA4, 0x35, 0xAF, 0xFF, 0xC0, 0x00, 0x01, 0xE6, 0x00, 0x00, 0x04, 0xFF, 0xF6, 0x00, 0x07, 0xB0, 0x00, 0x00, 
-  0x00, 0x9F, 0xFB, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFD, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x7F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-  0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF6, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3F, 0x60, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x2E, 0xA3, 0x33, 
-  0x33, 0x33, 0x38, 0xD0, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xEF, 0xFC, 0x60, 0x00, 
-  0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x7E, 0x61, 0x02, 0x9F, 0xFF, 0x60, 0x00, 0x02, 0xD1, 0x00, 
-  0x00, 0x09, 0xFF, 0xC0, 0x00, 0x09, 0x20, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x5E, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xFF, 0x40, 
-  0x00, 0x00, 0x00, 0x13, 0x59, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xCF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x7F, 0xB0, 0x00, 0x08, 0xA5, 0x00, 0x00, 0x02, 0xFC, 0x10, 0x00, 0x0F, 0xFF, 0xC4, 0x00, 0x5E, 0x80, 0x00, 
-  0x00, 0x04, 0xBF, 0xFF, 0xDB, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xE0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0D, 0x4F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0xE1, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE4, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xA9, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x5E, 0x10, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x0A, 0x90, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0xE1, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBA, 0x11, 0x11, 0x11, 0x1F, 0xFE, 0x11, 0x10, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 
-  0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xEE, 0xEE, 0xED, 0x40, 0x00, 0x00, 0x00, 
-  0x7F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF6, 0x10, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00, 
-  0x00, 0x02, 0x78, 0xCF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xDF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xBF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x06, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x00, 0x00, 0x04, 0xFE, 0x80, 0x00, 0x00, 0x8E, 
-  0x30, 0x00, 0x00, 0x6F, 0xFF, 0xE6, 0x24, 0xBB, 0x20, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFD, 0x93, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xAD, 0x96, 0x10, 0x00, 0x00, 0x00, 0x07, 0xEE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xA1, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x5F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x06, 0xFF, 0xD6, 0xAD, 0xFE, 0xC6, 0x00, 0x00, 0x0A, 0xFF, 0xF5, 0x10, 0x17, 0xFF, 0xC1, 0x00, 0x0D, 0xFF, 0x50, 0x00, 
-  0x00, 0x5F, 0xFB, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x40, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xA0, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x0B, 0xFF, 0x10, 0x00, 
-  0x00, 0x00, 0xFF, 0xD0, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xFF, 0xB0, 0x02, 0xFF, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x70, 
-  0x00, 0xAF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0x10, 0x00, 0x1E, 0xF8, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x02, 0xEF, 0x81, 
-  0x02, 0xBF, 0x70, 0x00, 0x00, 0x00, 0x17, 0xDF, 0xFE, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 
-  0x00, 0x0E, 0xB4, 0x33, 0x33, 0x33, 0x3C, 0xF6, 0x00, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x72, 0x00, 0x00, 
-  0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x08, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF6, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x8D, 0xFF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x02, 0xAF, 0x90, 0x00, 0x00, 0x03, 0xFF, 0x50, 0x00, 0x00, 
-  0xBF, 0x70, 0x00, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x05, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 
-  0x00, 0xFF, 0xF2, 0x00, 0x00, 0x04, 0xFE, 0x00, 0x00, 0x0C, 0xFF, 0xB0, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x5F, 0xFF, 
-  0x80, 0x00, 0x3F, 0xD1, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA1, 0x3E, 0xB1, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xEF, 0x50, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xED, 0xFF, 0xFE, 0x30, 0x00, 0x00, 
-  0x00, 0x08, 0xF7, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xFA, 0x00, 0x05, 0xFF, 0xFE, 0x10, 0x00, 0x07, 0xFF, 0x30, 
-  0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0xDF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x2F, 
-  0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x0B, 0xFF, 0x30, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 
-  0x3F, 0xFB, 0x00, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00, 0x5F, 0xFA, 0x20, 0x17, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x18, 0xDF, 
-  0xFE, 0xC7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3A, 0xEF, 0xFC, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFB, 0x10, 0x18, 0xFC, 0x10, 0x00, 0x00, 0x5F, 0xD0, 
-  0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xFF, 0x60, 0x00, 0x00, 0x0E, 0xF8, 0x00, 0x08, 0xFF, 0x10, 0x00, 0x00, 0x09, 0xFF, 
-  0x10, 0x0C, 0xFF, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x0F, 0xFF, 0x00, 
-  0x00, 0x00, 0x01, 0xFF, 0xC0, 0x0F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0C, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x07, 0xFF, 0x90, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x01, 0xDF, 0xF3, 0x00, 0x00, 0x05, 0xFF, 0xB0, 0x00, 0x2E, 0xFF, 
-  0x50, 0x02, 0x8D, 0xFF, 0x70, 0x00, 0x01, 0x7C, 0xFF, 0xD9, 0x46, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFC, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x09, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFC, 0x20, 0x00, 
-  0x00, 0x00, 0x00, 0x16, 0xEE, 0x60, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xEA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x01, 0x52, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEE, 
-  0x50, 0x00, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x5F, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xE5, 0x00, 0x00, 0x0E, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0x00, 
-  0x00, 0x05, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEE, 0x50, 0x00, 0x0E, 0xFF, 
-  0xE0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x05, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFC, 
-  0x10, 0x00, 0x0E, 0xFF, 0xA0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x04, 0xC0, 0x00, 0x00, 0x07, 
-  0x60, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xC2, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xAF, 0xFF, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xFF, 
-  0xB4, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEF, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x8F, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7E, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x5D, 0xFF, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x2A, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x17, 0xE8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0A, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 
-  0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFE, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 
-  0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xEF, 
-  0xFF, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCF, 0xFF, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFC, 0x50, 0x00, 
-  0x00, 0x00, 0x01, 0x7E, 0xFF, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x02, 0x8F, 0xFF, 0xF9, 0x20, 0x00, 0x00, 0x00, 0x03, 0xAF, 
-  0xFF, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xC5, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C, 0xEF, 0xEA, 0x30, 0x00, 0x00, 0x0B, 0x92, 0x01, 0x8F, 0xF7, 0x00, 
-  0x00, 0x8C, 0x00, 0x00, 0x09, 0xFF, 0x50, 0x00, 0xEF, 0x10, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0xFF, 0xB0, 0x00, 0x00, 0xEF, 
-  0xF0, 0x00, 0xDF, 0xC0, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x26, 0x20, 0x00, 0x01, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x05, 
-  0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x7F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x09, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x60, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xDF, 0xFE, 0xEA, 0x61, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6E, 0xF9, 0x30, 0x00, 0x15, 0xBE, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 
-  0xFC, 0x20, 0x00, 0x00, 0x00, 0x04, 0xEB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x00, 0x00, 0x00, 0x00, 
-  0x7F, 0xF5, 0x00, 0x00, 0x07, 0xDF, 0xE7, 0x7B, 0x60, 0x5F, 0x20, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x01, 0xDF, 0xD3, 
-  0x1C, 0xFF, 0x60, 0x0D, 0x80, 0x00, 0x00, 0x06, 0xFF, 0x70, 0x00, 0x0C, 0xFD, 0x10, 0x06, 0xFF, 0x20, 0x07, 0xC0, 0x00, 
-  0x00, 0x0B, 0xFF, 0x30, 0x00, 0x7F, 0xF3, 0x00, 0x06, 0xFE, 0x00, 0x04, 0xF0, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x01, 0xFF, 
-  0xB0, 0x00, 0x07, 0xFB, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x06, 0xFF, 0x50, 0x00, 0x0A, 0xF7, 0x00, 0x04, 
-  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0A, 0xFF, 0x20, 0x00, 0x0E, 0xF3, 0x00, 0x06, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 
-  0x0D, 0xFF, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0C, 0xFF, 0x10, 0x0E, 0xFF, 0x00, 0x00, 0x9F, 0xC0, 
-  0x00, 0x2F, 0x20, 0x00, 0x00, 0x08, 0xFF, 0x50, 0x0C, 0xFF, 0x30, 0x02, 0xFF, 0x90, 0x00, 0xC8, 0x00, 0x00, 0x00, 0x02, 
-  0xFF, 0xA0, 0x06, 0xFF, 0xB1, 0x2A, 0x8F, 0xD1, 0x1B, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF2, 0x00, 0x8F, 0xFF, 0x91, 
-  0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFC, 0x00, 0x01, 0x20, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x02, 0xEF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFB, 0x20, 
-  0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xF9, 0x41, 0x00, 0x03, 0x7C, 0xE6, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0xDF, 0xFE, 0xEC, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xC5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0A, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xAC, 0xFF, 
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF4, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xBD, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x70, 0x09, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0xF1, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0xCF, 0xFA, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x06, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 
-  0x0F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x11, 0x11, 0x11, 0x9F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xB4, 0x44, 0x44, 0x44, 0x4D, 0xFF, 0xD0, 0x00, 0x00, 
-  0x00, 0x07, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xFB, 0x00, 0x00, 0x00, 0x6F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x0E, 0xF1, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x1A, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x50, 0x2F, 0xFF, 0xFF, 
-  0xF2, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF5, 0x44, 0x58, 
-  0xDF, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x8F, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFA, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x30, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x01, 0x5D, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x02, 0x6B, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 
-  0xC0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 
-  0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0xAF, 0xFF, 0x60, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x6F, 0xFF, 0x74, 0x34, 0x69, 
-  0xFF, 0xFF, 0xA1, 0x00, 0x1B, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0xFF, 0xEE, 0xC9, 0x62, 0x4F, 0x00, 0x00, 0x00, 0x02, 
-  0xBF, 0xF9, 0x30, 0x00, 0x39, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0x00, 
-  0x04, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x2F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 
-  0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x02, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0C, 0x00, 0x08, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF3, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
-  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0A, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x70, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x10, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x50, 0x00, 0x00, 0x8F, 0xFF, 0x40, 
-  0x00, 0x00, 0x00, 0x05, 0xE6, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xFB, 0x51, 0x00, 0x15, 0xCB, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xAD, 0xFF, 0xFD, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEC, 0x95, 0x10, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x01, 0x37, 
-  0xDF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xE4, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x1D, 0xFF, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xE1, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x20, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x70, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0xFF, 0xA0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x10, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xE1, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x30, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xBF, 
-  0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x20, 0x00, 0x26, 0xBF, 0xF9, 0x10, 0x00, 0x00, 0x58, 0xEF, 0xFF, 0xFF, 0xFF, 0xFD, 
-  0xA6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 
-  0x5F, 0xFF, 0x10, 0x00, 0x00, 0x01, 0x5F, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x17, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x28, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0D, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x88, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 
-  0x90, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF4, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0x00, 
-  0x06, 0xFF, 0xF3, 0x00, 0x00, 0x01, 0x37, 0xEF, 0xB0, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x5F, 
-  0xFF, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xF0, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xE0, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00, 
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x4E, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x05, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x2F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 
-  0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDF, 0xFE, 0xEC, 0x96, 
-  0x4A, 0xA0, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xF9, 0x30, 0x00, 0x4B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE3, 0x00, 
-  0x00, 0x00, 0x08, 0xFF, 0xA0, 0x00, 0x00, 0x05, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFA, 0x00, 0x00, 0x02, 0xFF, 
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xA0, 0x00, 0x00, 0xBF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 
-  0x00, 0x2F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA0, 0x00, 0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xF3, 0x0F, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0x80, 0x00, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 
-  0x00, 0x0D, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x9F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xEF, 0xF0, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0D, 0xFF, 0xF1, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 
-  0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x1F, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xB5, 0x10, 0x01, 0x5D, 0xFD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0xEF, 0xFE, 
-  0xDA, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9D, 0xFF, 0xFF, 0xFD, 0x90, 0x00, 0x09, 0xDF, 0xFF, 0xFF, 0xD9, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 
-  0x00, 0x05, 0xFF, 0xF7, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x22, 0x22, 0x22, 0x22, 0x22, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xF2, 0x00, 0x01, 0x9F, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFA, 0x10, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
-  0x0D, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x19, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0x81, 0x00, 0x1F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x19, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xFF, 
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x00, 0x1C, 0xE4, 0x00, 0xFF, 0x70, 0x00, 0x7F, 0xFC, 
-  0x01, 0xFF, 0x10, 0x00, 0x5F, 0xFF, 0x6A, 0xF5, 0x00, 0x00, 0x07, 0xEF, 0xFB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 
-  0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x01, 0x9F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xBF, 0xFA, 
-  0x20, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x08, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x1B, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x2D, 0xF6, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x3E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xE2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x4F, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x5F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x2F, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xC1, 0x00, 0x00, 0x19, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xD3, 
-  0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x24, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x50, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 
-  0xF1, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEC, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x01, 0x49, 0xFF, 0x80, 
-  0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF2, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFB, 0x00, 0x1B, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 
-  0xFF, 0xF9, 0x10, 0x00, 0x04, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x03, 0xFF, 
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFC, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xF8, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF5, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF2, 0xEF, 0xF0, 0x00, 0x00, 
-  0x03, 0xF0, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xA0, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x6F, 0xFF, 0x50, 0x00, 
-  0x00, 0x00, 0x7F, 0x30, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xEC, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0x03, 0xF0, 0x07, 0xFF, 0xF3, 0x00, 0x00, 0x05, 0xF5, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFF, 
-  0xFB, 0x00, 0x00, 0x0C, 0xD0, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0x3F, 0x60, 0x00, 
-  0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0xAF, 0x10, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 
-  0x00, 0x0A, 0xFF, 0xF1, 0x01, 0xF8, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0xF8, 0x07, 0xF1, 
-  0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0xCF, 0xFE, 0x1E, 0xA0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 
-  0x03, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xBF, 0x30, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0D, 0xFF, 
-  0xFB, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x04, 0xF1, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0x06, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0xD0, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x0C, 0xFA, 0x00, 0x00, 
-  0x00, 0x7F, 0x60, 0x00, 0x00, 0x05, 0xFF, 0xF7, 0x00, 0x3B, 0xFF, 0xFF, 0xEB, 0x10, 0x00, 0x1D, 0x00, 0x00, 0x09, 0xCF, 
-  0xFF, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 
-  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x15, 0xFF, 0xE4, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8F, 
-  0x40, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x00, 0x03, 0xFD, 0xFF, 0xFA, 0x00, 
-  0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF2, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 
-  0xF0, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x06, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x3F, 
-  0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x9F, 0xFF, 0xD0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x0C, 0xFF, 
-  0xFA, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xEF, 0xFF, 0x70, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 
-  0xF0, 0x00, 0x00, 0x2F, 0xFF, 0xF4, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x20, 0x3F, 
-  0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD1, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 
-  0x0A, 0xFF, 0xFA, 0x3F, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x03, 
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 
-  0x00, 0x00, 0x00, 0x04, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0xFF, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x00, 0x4F, 0xFF, 
-  0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 
-  0xDF, 0xFF, 0xDA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xDF, 0xD5, 0x00, 0x05, 0xDF, 0xD4, 0x00, 0x00, 0x00, 0x00, 
-  0x07, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF7, 
-  0x00, 0x00, 0x03, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF3, 0x00, 0x00, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0D, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x30, 0x09, 0xFF, 0xF6, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF8, 0x00, 0xCF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0F, 
-  0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0C, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0x9F, 0xFF, 0x60, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x90, 0x04, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF4, 0x00, 
-  0x0C, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFD, 0x00, 0x00, 0x3F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x5F, 
-  0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x00, 0x00, 
-  0x00, 0x0A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFC, 0x40, 0x00, 0x5D, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xAE, 0xFF, 0xFD, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xEB, 0x71, 
-  0x00, 0x00, 0x00, 0x5F, 0xFF, 0x10, 0x02, 0x5B, 0xFF, 0x91, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x60, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x03, 0xFF, 0xA0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x30, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x5F, 0xF8, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x01, 0x4A, 0xFF, 0x70, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0xDA, 0x61, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0x91, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0xDE, 0xFE, 0xD9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xCF, 0xD5, 0x10, 0x05, 0xDF, 0xC3, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xB0, 0x00, 0x00, 0x01, 0xBF, 0xF5, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF5, 
-  0x00, 0x00, 0x02, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0E, 0xFF, 0xB0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x07, 0xFF, 0xF5, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF7, 0x00, 0xBF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x0E, 
-  0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-  0xFF, 0xF0, 0x0F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x0E, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0x00, 0xAF, 0xFF, 0x50, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x90, 0x06, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF5, 0x00, 
-  0x1F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFE, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x5F, 
-  0xFF, 0x60, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xDF, 0xFB, 0x00, 0x00, 
-  0x00, 0x0A, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFD, 0x40, 0x00, 0x4C, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4C, 0xFF, 0xFE, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB1, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x8E, 0xFF, 0xFB, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x8B, 0xDE, 0xFF, 0x60, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0xBF, 0xFF, 0xFF, 0xFF, 0xFE, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x01, 0x49, 
-  0xFF, 0xA1, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x04, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0x47, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFE, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x0C, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x1E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x4F, 0xFF, 0xC0, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xBF, 0xFF, 0x50, 
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x03, 0xFF, 
-  0xFD, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFB, 0x00, 0x00, 0x1A, 0xFF, 0xF7, 0x10, 0x00, 0x00, 
-  0x09, 0xFF, 0xFA, 0x10, 0xAF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xFE, 0xC9, 0x66, 0xC0, 0x00, 0x00, 0x05, 0xFE, 
-  0x40, 0x03, 0xBF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 
-  0xCF, 0x10, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x0D, 0x40, 0x00, 
-  0x0E, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0xAF, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 
-  0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0x90, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x00, 0x07, 0x00, 0x00, 0x00, 
-  0x00, 0x07, 0xFF, 0xF0, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0A, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xD0, 0x00, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x05, 0xFF, 0x60, 0x00, 0x00, 0x08, 0xFD, 0x10, 0x00, 0x3F, 
-  0xFF, 0xA3, 0x00, 0x19, 0xFD, 0x20, 0x00, 0x01, 0xF3, 0x59, 0xCE, 0xFF, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x8F, 0xD4, 0x10, 0x00, 
-  0xFF, 0xE0, 0x00, 0x03, 0x9F, 0xF0, 0x8F, 0x20, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0B, 0xF0, 0x8A, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x03, 0xF0, 0x85, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0xF0, 0x21, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 
-  0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x01, 0x9F, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x30, 0x00, 0x2F, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xF4, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xF1, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-  0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x00, 0x00, 
-  0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xE0, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB0, 
-  0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0x5F, 0x10, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x10, 0x00, 0x00, 0x17, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x87, 
-  0x8B, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xCF, 0xFF, 0xFC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 
-  0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFB, 0x00, 0x6F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xE2, 0x00, 0x00, 0x9F, 
-  0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 
-  0x00, 0x00, 0x09, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x50, 0x00, 0x00, 0x00, 
-  0x08, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF4, 
-  0x00, 0x00, 0x00, 0x4F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x6F, 0xFF, 0x20, 0x00, 0x01, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF9, 0x00, 0x00, 0x8F, 0x30, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF1, 0x00, 0x0E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x70, 0x04, 
-  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x00, 0xBF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
-  0xFF, 0xF5, 0x1F, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xC7, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x70, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFA, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 
-  0xFF, 0xF1, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF2, 0x05, 0xFF, 0xFF, 0x30, 0x00, 0x03, 0xEF, 
-  0xFF, 0x50, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x81, 0x00, 0x06, 0xFF, 0xF2, 0x00, 0x00, 0x06, 0xFF, 0xF2, 0x00, 0x00, 0x00, 
-  0x00, 0x1F, 0xB0, 0x00, 0x00, 0x0F, 0xFF, 0x70, 0x00, 0x00, 0x0F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x03, 0xF4, 0x00, 0x00, 
-  0x00, 0x9F, 0xFC, 0x00, 0x00, 0x00, 0x9F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF2, 0x00, 
-  0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x80, 0x00, 0x00, 0x0E, 0xFF, 0xA0, 
-  0x00, 0x00, 0x04, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0xAC, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x8E, 0xFF, 0xF7, 0x00, 0x00, 0x1F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x0D, 
-  0xFF, 0xA0, 0x00, 0x0E, 0x99, 0xFF, 0xE0, 0x00, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x10, 0x04, 0xF3, 
-  0x3F, 0xFF, 0x40, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF6, 0x00, 0xAD, 0x00, 0xDF, 0xFA, 0x00, 0x2F, 
-  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xC0, 0x1F, 0x80, 0x07, 0xFF, 0xF1, 0x08, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x6F, 0xFF, 0x26, 0xF2, 0x00, 0x1F, 0xFF, 0x70, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF8, 
-  0xCC, 0x00, 0x00, 0xBF, 0xFD, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xEF, 0x70, 0x00, 0x04, 0xFF, 
-  0xFD, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF1, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0A, 0xFF, 0x60, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x00, 0x00, 
-  0x00, 0x0C, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEA, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x00, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x0C, 
-  0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x18, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
-  0xB0, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x5F, 0x60, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0xEF, 0xFC, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x1E, 
-  0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0x00, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0xEF, 0xFC, 0x09, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xCF, 0x60, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFD, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x09, 0xFC, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x81, 0xEF, 0xFE, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0xFC, 0x00, 0x4F, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0x00, 0x09, 0xFF, 
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x40, 0x00, 0x01, 0xEF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF7, 
-  0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xC0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF6, 0x00, 0x00, 
-  0x00, 0x03, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x04, 
-  0xFF, 0xFF, 0xE5, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF4, 0x01, 0x8F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 
-  0x00, 0x1B, 0xFF, 0x71, 0x00, 0x00, 0x9F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x00, 0xDF, 0xFF, 
-  0x30, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x00, 
-  0x00, 0x07, 0xFF, 0xF6, 0x00, 0x00, 0x08, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE1, 0x00, 0x03, 0xF8, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0xCD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x20, 
-  0x7F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFB, 0x2F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFF, 0xFE, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0x81, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0xEF, 0x93, 0x00, 
-  0x00, 0x00, 0x00, 0x9F, 0xFF, 0x40, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF9, 0x00, 0x01, 0xF1, 0x00, 0x00, 
-  0x00, 0x00, 0x1E, 0xFF, 0xE1, 0x00, 0x03, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x40, 0x00, 0x02, 0x40, 0x00, 0x00, 
-  0x00, 0x04, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x9F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 
-  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 
-  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x04, 0xFF, 0xFB, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x1E, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x00, 0x9F, 0xFF, 0x60, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0xF1, 0x0E, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 
-  0xF3, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 
-  0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x50, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 
-  0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0D, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00, 
-  0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x8F, 0xA0, 
-  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x03, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x00, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0E, 
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x05, 0xFF, 
-  0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 
-  0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xEF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0xFF, 0x30, 0x00, 0x00, 0x00, 
-  0x0A, 0xF9, 0x08, 0xFA, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x1F, 0xF2, 0x00, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x9F, 0xA0, 
-  0x00, 0x00, 0x2F, 0xF2, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x09, 0xFA, 0x00, 0x00, 0x0A, 0xF9, 0x00, 0x01, 0xFF, 0x20, 0x00, 
-  0x00, 0x2F, 0xF2, 0x00, 0x8F, 0xB0, 0x00, 0x00, 0x00, 0xAF, 0x90, 0x1F, 0xF3, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x10, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 
-  0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x40, 0x00, 0x00, 0x0E, 0xFF, 0x40, 0x00, 0x00, 0x2C, 0xFF, 0x40, 
-  0x00, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x00, 0x01, 0xAF, 0x30, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBE, 0xEF, 0xE9, 0x20, 0x00, 0x00, 0x1B, 0xF9, 0x10, 0x1B, 0xFE, 0x10, 0x00, 0x09, 
-  0xFF, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x0F, 0xFD, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xAC, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x3C, 0xD4, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xC1, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x5F, 0xF2, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0D, 
-  0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x0E, 0xFF, 0x90, 0x04, 0xCF, 0xFF, 
-  0x11, 0x10, 0x7F, 0xFF, 0xFF, 0xD2, 0xDF, 0xFF, 0xE2, 0x00, 0x7E, 0xFD, 0x60, 0x04, 0xEF, 0xC2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCF, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xBF, 0xFD, 0x70, 0x00, 0x00, 0x00, 0xFF, 
-  0xE5, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x0F, 0xFF, 0xE6, 0x22, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0xFF, 0xF3, 0x00, 0x00, 
-  0x5F, 0xFF, 0x30, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xCF, 0xF9, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x06, 0xFF, 0xC0, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xFD, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x3F, 0xF2, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x08, 0xF9, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x02, 0xFD, 0x10, 0x00, 
-  0x00, 0xAF, 0xF9, 0x20, 0x04, 0xDB, 0x10, 0x00, 0x00, 0x00, 0x4A, 0xDF, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xFD, 
-  0x91, 0x00, 0x00, 0x04, 0xEE, 0x40, 0x09, 0xFF, 0x30, 0x00, 0x4F, 0xF2, 0x00, 0x02, 0xFF, 0xD0, 0x00, 0xEF, 0x70, 0x00, 
-  0x00, 0xDF, 0xF0, 0x06, 0xFF, 0x20, 0x00, 0x00, 0x3A, 0x40, 0x0B, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x84, 0x04, 0xFF, 0xFA, 0x00, 0x00, 0x06, 0xA0, 0x00, 
-  0xAF, 0xFF, 0xC5, 0x34, 0xAD, 0x10, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x6C, 0xFF, 0xD7, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xCF, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x18, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x29, 0xEF, 0xE9, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x4F, 
-  0xD3, 0x01, 0x8E, 0xFF, 0xE0, 0x00, 0x00, 0x3F, 0xE1, 0x00, 0x00, 0x8F, 0xFE, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x00, 0x01, 
-  0xFF, 0xE0, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x0E, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xEF, 0xF3, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0B, 0xFF, 0x90, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x5F, 0xFF, 0x30, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xDF, 0xFE, 0x50, 0x02, 0xCF, 0xFF, 0x85, 0x00, 
-  0x02, 0xEF, 0xFF, 0xFE, 0xF6, 0xFF, 0xFC, 0x60, 0x00, 0x01, 0x8D, 0xFF, 0xC4, 0x0D, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0xDF, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x6F, 0x81, 0x02, 0xDF, 0xD1, 0x00, 0x00, 0x5F, 0xB0, 
-  0x00, 0x03, 0xFF, 0xA0, 0x00, 0x1F, 0xF4, 0x00, 0x00, 0x0E, 0xFF, 0x20, 0x07, 0xFF, 0x00, 0x00, 0x00, 0xBF, 0xF7, 0x00, 
-  0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x31, 0x0A, 0xFF, 0xD0, 
-  0x00, 0x00, 0x00, 0x1C, 0x10, 0x4F, 0xFF, 0x90, 0x00, 0x00, 0x1C, 0x60, 0x00, 0xBF, 0xFF, 0xD6, 0x33, 0x7E, 0xA0, 0x00, 
-  0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xEA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xDF, 0xFD, 0x70, 
-  0x00, 0x00, 0x4F, 0x90, 0x1C, 0xFF, 0x60, 0x00, 0x1E, 0xF2, 0x00, 0x2E, 0xF4, 0x00, 0x06, 0xFF, 0x00, 0x00, 0x01, 0x00, 
-  0x00, 0xAF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 
-  0x20, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xEF, 0xEB, 
-  0x61, 0x00, 0x00, 0x00, 0x05, 0xFB, 0x10, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xF2, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 
-  0xAF, 0xF0, 0x00, 0x05, 0xFF, 0xD0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0xEF, 0xF1, 0x00, 0x00, 
-  0xFF, 0xF0, 0x00, 0x00, 0xCF, 0xF5, 0x00, 0x00, 0xEF, 0xC0, 0x00, 0x00, 0x5F, 0xFB, 0x00, 0x02, 0xFF, 0x40, 0x00, 0x00, 
-  0x06, 0xFF, 0x91, 0x1B, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xDF, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x02, 0xB2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x83, 0x33, 0x33, 0x22, 0x00, 0x00, 0x00, 
-  0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x09, 0xDC, 0xEF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x4E, 0x20, 0x00, 0x00, 
-  0x01, 0x4B, 0xE0, 0x03, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x0F, 
-  0xF7, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x60, 0x0D, 0xFF, 0x92, 0x00, 0x00, 0x27, 0xE8, 0x00, 0x03, 0xEF, 0xFF, 0xFE, 0xEF, 
-  0xFD, 0x40, 0x00, 0x00, 0x17, 0xCF, 0xFF, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6B, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xCF, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x02, 0xAF, 0xFD, 0x40, 0x00, 0x00, 0x0F, 0xFE, 0x3F, 0xFF, 0xFF, 0xF3, 0x00, 
-  0x00, 0x0F, 0xFF, 0xD5, 0x00, 0xAF, 0xFA, 0x00, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0x30, 0x0A, 0xFF, 0xFF, 0xE7, 
-  0x07, 0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x9F, 0x80, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xF0, 
-  0x00, 0x7D, 0xFF, 0xF0, 0x00, 0x13, 0xFF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x80, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9F, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0x4F, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 
-  0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 
-  0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x0C, 0xE3, 0x01, 0xFF, 0x20, 0x00, 0xEF, 0xE4, 0x8F, 0x60, 0x00, 0x04, 0xCF, 
-  0xFC, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x09, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x02, 0xFF, 0x71, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBB, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x01, 0xC9, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-  0xFE, 0x02, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xB0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE8, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x0C, 0xFF, 0x50, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x1E, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x4F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x7F, 0xFB, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x17, 0xFF, 0xF5, 0x00, 0x02, 
-  0xFF, 0xFA, 0x20, 0x6F, 0xFF, 0xFF, 0xFF, 0x44, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x14, 0x00, 0x00, 0x48, 0xCF, 0xE0, 0x00, 0x58, 0xCF, 0xFE, 0x00, 0x00, 0x02, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x08, 0xFF, 0xF4, 0x00, 0x6F, 0xFF, 
-  0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9D, 0x00, 0x6D, 0xFD, 0x30, 0x01, 0x8D, 0xFE, 
-  0x60, 0x00, 0x01, 0xAE, 0xFF, 0xE1, 0xBF, 0xFF, 0xFF, 0x12, 0xDF, 0xFF, 0xFF, 0x40, 0x00, 0x01, 0x6F, 0xFF, 0xB5, 0x00, 
-  0x9F, 0xFA, 0xD5, 0x00, 0x6F, 0xFB, 0x00, 0x00, 0x01, 0xFF, 0xF2, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x00, 0xFF, 0xF0, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x0D, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 
-  0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0xFF, 
-  0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0C, 
-  0xFF, 0x20, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x0E, 0xFF, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x00, 0xCF, 0xF2, 0x00, 
-  0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFF, 0x10, 0x00, 0x0D, 0xFF, 0x20, 0x00, 0x07, 0xFF, 0xF3, 0x00, 0x03, 0xFF, 0xF7, 
-  0x00, 0x02, 0xFF, 0xF7, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x0C, 0xFF, 0xFF, 0xFF, 0x18, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0xAD, 0x00, 0x8E, 0xFD, 0x40, 0x00, 0x09, 0xFF, 0xFE, 0x1D, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x4F, 0xFF, 0xC5, 0x00, 0x9F, 
-  0xFA, 0x00, 0x00, 0x0F, 0xFF, 0x30, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 
-  0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0F, 
-  0xFF, 0x00, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0x30, 0x09, 0xEF, 0xFF, 0xD8, 0x06, 0xEF, 0xFF, 0xE9, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xEE, 0xFE, 0x92, 0x00, 0x00, 0x00, 0x07, 0xFB, 0x20, 0x18, 
-  0xFF, 0x70, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x8F, 0xF6, 0x00, 0x01, 0xFF, 0x40, 0x00, 0x00, 0x0E, 0xFF, 0x20, 0x08, 
-  0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x90, 0x0C, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xD0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xEF, 0xF0, 0x0C, 
-  0xFF, 0x50, 0x00, 0x00, 0x00, 0xFF, 0xB0, 0x07, 0xFF, 0xA0, 0x00, 0x00, 0x01, 0xFF, 0x60, 0x01, 0xFF, 0xF1, 0x00, 0x00, 
-  0x06, 0xFE, 0x00, 0x00, 0x5F, 0xF9, 0x00, 0x00, 0x1D, 0xF3, 0x00, 0x00, 0x05, 0xFF, 0x91, 0x02, 0xCF, 0x40, 0x00, 0x00, 
-  0x00, 0x29, 0xEF, 0xFD, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x9C, 0x01, 0x9E, 0xFE, 0x91, 0x00, 0x01, 0x8E, 0xFF, 0xE3, 0xEF, 0xFF, 0xFF, 0xE2, 0x00, 
-  0x03, 0x7F, 0xFF, 0xD6, 0x10, 0x5F, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xF2, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x0F, 0xFE, 
-  0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x05, 0xFF, 0xC0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x2F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x00, 
-  0x00, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0x80, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0x0F, 0xFF, 0x20, 0x00, 0x03, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0xFE, 0x50, 0x04, 0xEE, 
-  0x30, 0x00, 0x00, 0x0F, 0xFE, 0x4C, 0xFF, 0xD8, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 0xEC, 0x71, 0x6D, 0x00, 0x00, 0x03, 0xEE, 0x50, 0x03, 0xEF, 0xFE, 0x00, 0x00, 
-  0x2F, 0xF2, 0x00, 0x00, 0x4F, 0xFE, 0x00, 0x00, 0xDF, 0x80, 0x00, 0x00, 0x1F, 0xFE, 0x00, 0x05, 0xFF, 0x30, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0E, 0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x30, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x2F, 0xFE, 0x00, 0x01, 
-  0xEF, 0xFE, 0x50, 0x15, 0xDF, 0xFE, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFE, 0x00, 0x00, 0x03, 0xBF, 0xFD, 0x81, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xE8, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x9C, 0x02, 0xBF, 0xD2, 0x19, 0xEF, 0xFE, 0x2E, 0xFF, 0xF7, 0x00, 0x4F, 0xFE, 0xB3, 
-  0x2C, 0xF4, 0x00, 0x0F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x00, 
-  0x00, 0x00, 0x01, 0x8F, 0xFF, 0x70, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xF1, 0x00, 
-  0x3F, 0xA1, 0x02, 0xCF, 0x10, 0x0C, 0xF1, 0x00, 0x01, 0xF1, 0x00, 0xFF, 0x10, 0x00, 0x08, 0x10, 0x0F, 0xF8, 0x00, 0x00, 
-  0x00, 0x00, 0xAF, 0xFB, 0x20, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 
-  0x6E, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xD0, 0x0A, 0x00, 0x00, 0x08, 0xFF, 0x20, 0xF1, 0x00, 0x00, 0x1F, 0xF2, 
-  0x0F, 0x70, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x71, 0x02, 0xCF, 0x30, 0x0F, 0xFF, 0xFF, 0xFB, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x9E, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x9F, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xDF, 0xF4, 0x02, 0x70, 0x08, 0xFF, 
-  0xFC, 0xD2, 0x00, 0x1A, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 
-  0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 
-  0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 
-  0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFF, 0x10, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0xCF, 0xFA, 0x00, 0x4B, 0xFF, 
-  0xF4, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x1E, 0xFF, 0xE9, 0x00, 0x05, 0xDF, 0xE9, 0x10, 0xC8, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x70, 0x00, 
-  0x7F, 0xFF, 0xE0, 0x7F, 0xFF, 0x20, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0xCF, 0xF3, 0x00, 0x00, 0x02, 0xF3, 0x00, 0x05, 0xFF, 
-  0x90, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0x0E, 0x60, 0x00, 0x00, 0x7F, 0xF6, 0x00, 0x04, 0xF0, 0x00, 
-  0x00, 0x01, 0xFF, 0xC0, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x30, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x2F, 0xF9, 0x07, 
-  0xC0, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF1, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x2D, 0xFF, 0xFC, 0x40, 0x5E, 0xFF, 0xFD, 0x70, 0x00, 0x8F, 0xFD, 0x00, 0x2F, 0xFF, 0x10, 0x00, 0x1F, 0xFF, 
-  0x10, 0x00, 0x00, 0x9F, 0x10, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x0B, 0xA0, 0x00, 0x04, 0xFF, 0x90, 
-  0x00, 0x02, 0xFF, 0x80, 0x00, 0x01, 0xF4, 0x00, 0x00, 0x0D, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x00, 0x00, 0x6E, 0x00, 0x00, 
-  0x00, 0x7F, 0xF5, 0x00, 0x04, 0xFF, 0xF4, 0x00, 0x0C, 0x70, 0x00, 0x00, 0x01, 0xFF, 0xB0, 0x00, 0xBB, 0xEF, 0xA0, 0x03, 
-  0xF2, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0x10, 0x2F, 0x39, 0xFF, 0x00, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xF7, 0x09, 0xC0, 
-  0x3F, 0xF5, 0x0F, 0x50, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xD1, 0xF4, 0x00, 0xDF, 0xB5, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x08, 
-  0xFF, 0xAD, 0x00, 0x07, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x60, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xCF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xF7, 0x00, 0x00, 0x05, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF5, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x8F, 0xFF, 0x20, 
-  0x02, 0xFD, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0x50, 0x06, 0xF1, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xE0, 0x2F, 0x50, 0x00, 0x00, 
-  0x00, 0x00, 0x5F, 0xF9, 0xCA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
-  0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xED, 0xFF, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x2F, 0x54, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x9F, 0xF8, 0x00, 0x00, 0x00, 0x06, 0xF2, 0x00, 
-  0x1E, 0xFF, 0x30, 0x00, 0x00, 0x2F, 0x70, 0x00, 0x04, 0xFF, 0xD1, 0x00, 0x02, 0xDF, 0x20, 0x00, 0x01, 0xFF, 0xFB, 0x10, 
-  0x6F, 0xFF, 0xF3, 0x00, 0x3F, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 
-  0xF3, 0x00, 0x0F, 0xFF, 0xF4, 0x03, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x00, 0xBB, 
-  0x00, 0x00, 0x1F, 0xFA, 0x00, 0x00, 0x01, 0xF5, 0x00, 0x00, 0x09, 0xFF, 0x20, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x02, 0xFF, 
-  0x90, 0x00, 0x0B, 0x90, 0x00, 0x00, 0x00, 0xAF, 0xF1, 0x00, 0x1F, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xF9, 0x00, 0x5D, 0x00, 
-  0x00, 0x00, 0x00, 0x0C, 0xFF, 0x10, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0x81, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xDF, 0xF6, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFD, 0x9A, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x05, 0xEF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 
-  0xF5, 0x00, 0x00, 0x0D, 0xFF, 0x60, 0x00, 0xD0, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x90, 0x00, 0x02, 0xFF, 0xF2, 0x00, 
-  0x00, 0x00, 0x00, 0x0B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF4, 0x00, 
-  0x00, 0x00, 0x00, 0x0A, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF6, 0x00, 
-  0x00, 0x00, 0x00, 0x08, 0xFF, 0xC0, 0x00, 0x00, 0x14, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x56, 0x00, 0xCF, 0xF8, 0x00, 
-  0x00, 0x00, 0xA4, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xF3, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAE, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8F, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xA3, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0xAD, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x20, 
-  0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 
-  0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 
-  0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 0x00, 0xFF, 0x20, 
-  0x00, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7D, 0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xF7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xF7, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 
-  0xD9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD7, 0x10, 0x00, 0x06, 0x30, 0x0A, 0xFF, 0xEF, 0xFF, 0xF9, 0x43, 
-  0x8F, 0xF2, 0x2E, 0xF4, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x70, 0x01, 0x30, 0x00, 0x00, 0x4A, 0xEF, 0xD6, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0x0F, 0xB6, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0xBF, 0x00, 0xF9, 0x00, 0x04, 0xBE, 0xFD, 0x92, 0x00, 0x09, 0xF0, 0x0F, 
-  0x90, 0x09, 0xC4, 0x12, 0xAF, 0xF6, 0x00, 0x9F, 0x00, 0xF9, 0x06, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x09, 0xF0, 0x0F, 0x90, 
-  0xDD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x9F, 0x00, 0xF9, 0x0F, 0xF6, 0x00, 0x00, 0x0F, 0xFF, 0x09, 0xF0, 0x0F, 0x90, 0xFF, 
-  0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x9F, 0x00, 0xF9, 0x08, 0xF7, 0x00, 0x00, 0x2F, 0xFC, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 
-  0x00, 0x05, 0xFF, 0x60, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 0x00, 
-  0x1F, 0xF4, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 0x00, 0xEB, 
-  0x00, 0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 0x09, 0x80, 0x00, 
-  0x00, 0x9F, 0x00, 0xF9, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 
-  0x9F, 0x00, 0xF9, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 
-  0x00, 0xF9, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x9F, 0x00, 
-  0xF9, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x09, 0xF0, 0x0F, 0x90, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x9F, 0x00, 0xF9, 
-  0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x09, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  /*index table: glyph width, box x, y, w, h, offset hl (bit 7: RLE), lh, ll*/
+  0x08, 0x01, 0x19, 0x05, 0x09, 0x00, 0x00, 0x00, /*','*/
+  0x0B, 0x01, 0x14, 0x08, 0x03, 0x80, 0x00, 0x17, /*'-'*/
+  0x08, 0x02, 0x19, 0x04, 0x04, 0x00, 0x00, 0x1A, /*'.'*/
+  0x0A, 0x00, 0x07, 0x0A, 0x16, 0x80, 0x00, 0x22, /*'/'*/
+  0x10, 0x01, 0x07, 0x0E, 0x16, 0x00, 0x00, 0x8A, /*'0'*/
+  0x10, 0x03, 0x06, 0x0A, 0x17, 0x80, 0x01, 0x24, /*'1'*/
+  0x10, 0x01, 0x07, 0x0F, 0x16, 0x80, 0x01, 0x88, /*'2'*/
+  0x10, 0x01, 0x07, 0x0D, 0x16, 0x80, 0x02, 0x0C, /*'3'*/
+  0x11, 0x01, 0x07, 0x0F, 0x16, 0x80, 0x02, 0x91, /*'4'*/
+  0x11, 0x01, 0x06, 0x0E, 0x17, 0x80, 0x03, 0x0C, /*'5'*/
+  0x10, 0x01, 0x06, 0x0E, 0x17, 0x80, 0x03, 0x8D, /*'6'*/
+  0x10, 0x00, 0x07, 0x0E, 0x16, 0x80, 0x04, 0x2D, /*'7'*/
+  0x11, 0x02, 0x07, 0x0D, 0x16, 0x00, 0x04, 0x9B, /*'8'*/
+  0x10, 0x01, 0x07, 0x0E, 0x17, 0x80, 0x05, 0x2A, /*'9'*/
+  0x09, 0x03, 0x0E, 0x04, 0x0F, 0x80, 0x05, 0xC8, /*':'*/
+  0x08, 0x03, 0x0E, 0x04, 0x14, 0x00, 0x05, 0xE5, /*';'*/
+  0x12, 0x01, 0x0C, 0x11, 0x12, 0x80, 0x06, 0x0D, /*'<'*/
+  0x12, 0x01, 0x10, 0x10, 0x09, 0x80, 0x06, 0x74, /*'='*/
+  0x12, 0x01, 0x0C, 0x11, 0x12, 0x80, 0x06, 0x7D, /*'>'*/
+  0x0E, 0x02, 0x07, 0x0B, 0x16, 0x80, 0x06, 0xE5, /*'?'*/
+  0x1C, 0x03, 0x07, 0x16, 0x16, 0x00, 0x07, 0x4F, /*'@'*/
+  0x17, 0x00, 0x07, 0x17, 0x16, 0x80, 0x08, 0x41, /*'A'*/
+  0x15, 0x00, 0x07, 0x14, 0x16, 0x80, 0x08, 0xE2, /*'B'*/
+  0x16, 0x01, 0x07, 0x14, 0x16, 0x80, 0x09, 0x93, /*'C'*/
+  0x16, 0x00, 0x07, 0x15, 0x16, 0x80, 0x0A, 0x24, /*'D'*/
+  0x13, 0x00, 0x07, 0x13, 0x16, 0x80, 0x0A, 0xDD, /*'E'*/
+  0x12, 0x00, 0x07, 0x11, 0x16, 0x80, 0x0B, 0x6E, /*'F'*/
+  0x17, 0x01, 0x07, 0x16, 0x16, 0x80, 0x0B, 0xE5, /*'G'*/
+  0x16, 0x00, 0x07, 0x16, 0x16, 0x80, 0x0C, 0x99, /*'H'*/
+  0x0B, 0x00, 0x07, 0x0A, 0x16, 0x80, 0x0D, 0x38, /*'I'*/
+  0x0C, 0x00, 0x07, 0x0C, 0x16, 0x80, 0x0D, 0x92, /*'J'*/
+  0x17, 0x00, 0x07, 0x16, 0x16, 0x80, 0x0D, 0xFA, /*'K'*/
+  0x13, 0x00, 0x07, 0x13, 0x16, 0x80, 0x0E, 0xB0, /*'L'*/
+  0x1C, 0x00, 0x07, 0x1C, 0x16, 0x80, 0x0F, 0x1F, /*'M'*/
+  0x18, 0x00, 0x07, 0x17, 0x16, 0x80, 0x10, 0x3B, /*'N'*/
+  0x17, 0x01, 0x07, 0x15, 0x16, 0x80, 0x11, 0x10, /*'O'*/
+  0x12, 0x00, 0x07, 0x11, 0x16, 0x80, 0x11, 0xBE, /*'P'*/
+  0x17, 0x01, 0x07, 0x16, 0x1C, 0x80, 0x12, 0x4B, /*'Q'*/
+  0x15, 0x00, 0x07, 0x15, 0x16, 0x80, 0x13, 0x32, /*'R'*/
+  0x11, 0x01, 0x07, 0x0E, 0x16, 0x00, 0x13, 0xEE, /*'S'*/
+  0x14, 0x00, 0x07, 0x13, 0x16, 0x80, 0x14, 0x88, /*'T'*/
+  0x16, 0x00, 0x07, 0x16, 0x16, 0x80, 0x14, 0xF9, /*'U'*/
+  0x17, 0x00, 0x07, 0x17, 0x16, 0x80, 0x15, 0xA9, /*'V'*/
+  0x1F, 0x00, 0x07, 0x1F, 0x16, 0x80, 0x16, 0x4F, /*'W'*/
+  0x18, 0x01, 0x07, 0x17, 0x16, 0x80, 0x17, 0x54, /*'X'*/
+  0x17, 0x00, 0x07, 0x17, 0x16, 0x80, 0x18, 0x0E, /*'Y'*/
+  0x14, 0x01, 0x07, 0x13, 0x16, 0x80, 0x18, 0x9D, /*'Z'*/
+  0x0B, 0x03, 0x07, 0x08, 0x1B, 0x80, 0x19, 0x2E, /*'['*/
+  0x0A, 0x00, 0x07, 0x0A, 0x16, 0x80, 0x19, 0x7D, /*'\'*/
+  0x0B, 0x00, 0x07, 0x08, 0x1B, 0x80, 0x19, 0xE0, /*']'*/
+  0x0F, 0x00, 0x07, 0x0F, 0x0C, 0x00, 0x1A, 0x33, /*'^'*/
+  0x10, 0x00, 0x1F, 0x10, 0x02, 0x80, 0x1A, 0x8D, /*'_'*/
+  0x09, 0x01, 0x07, 0x07, 0x06, 0x00, 0x1A, 0x8F, /*'`'*/
+  0x0F, 0x01, 0x0E, 0x0E, 0x0F, 0x00, 0x1A, 0xA4, /*'a'*/
+  0x11, 0x00, 0x06, 0x10, 0x17, 0x80, 0x1B, 0x0D, /*'b'*/
+  0x0E, 0x01, 0x0E, 0x0D, 0x0F, 0x80, 0x1B, 0xAA, /*'c'*/
+  0x11, 0x01, 0x06, 0x0F, 0x17, 0x80, 0x1C, 0x0A, /*'d'*/
+  0x0F, 0x01, 0x0E, 0x0E, 0x0F, 0x80, 0x1C, 0xAF, /*'e'*/
+  0x0D, 0x00, 0x07, 0x0D, 0x16, 0x80, 0x1D, 0x16, /*'f'*/
+  0x10, 0x01, 0x0E, 0x0E, 0x16, 0x00, 0x1D, 0x80, /*'g'*/
+  0x10, 0x01, 0x06, 0x0F, 0x17, 0x80, 0x1E, 0x1A, /*'h'*/
+  0x08, 0x00, 0x07, 0x08, 0x16, 0x80, 0x1E, 0xB0, /*'i'*/
+  0x0B, 0x00, 0x07, 0x08, 0x1D, 0x80, 0x1E, 0xFD, /*'j'*/
+  0x11, 0x00, 0x06, 0x11, 0x17, 0x80, 0x1F, 0x5E, /*'k'*/
+  0x09, 0x00, 0x06, 0x09, 0x17, 0x80, 0x1F, 0xF8, /*'l'*/
+  0x19, 0x00, 0x0E, 0x19, 0x0F, 0x80, 0x20, 0x5A, /*'m'*/
+  0x10, 0x01, 0x0E, 0x0F, 0x0F, 0x00, 0x21, 0x11, /*'n'*/
+  0x10, 0x01, 0x0E, 0x0E, 0x0F, 0x00, 0x21, 0x82, /*'o'*/
+  0x11, 0x00, 0x0E, 0x10, 0x16, 0x80, 0x21, 0xEB, /*'p'*/
+  0x10, 0x01, 0x0E, 0x0F, 0x16, 0x80, 0x22, 0x86, /*'q'*/
+  0x0C, 0x00, 0x0E, 0x0C, 0x0F, 0x80, 0x23, 0x21, /*'r'*/
+  0x0B, 0x01, 0x0E, 0x0A, 0x0F, 0x00, 0x23, 0x70, /*'s'*/
+  0x09, 0x00, 0x0A, 0x09, 0x13, 0x80, 0x23, 0xBB, /*'t'*/
+  0x0F, 0x00, 0x0E, 0x0F, 0x0F, 0x00, 0x24, 0x0E, /*'u'*/
+  0x0F, 0x00, 0x0E, 0x0F, 0x0F, 0x80, 0x24, 0x7F, /*'v'*/
+  0x17, 0x00, 0x0E, 0x16, 0x0F, 0x00, 0x24, 0xE8, /*'w'*/
+  0x10, 0x00, 0x0E, 0x10, 0x0F, 0x80, 0x25, 0x8D, /*'x'*/
+  0x10, 0x00, 0x0E, 0x10, 0x16, 0x80, 0x26, 0x04, /*'y'*/
+  0x0E, 0x01, 0x0E, 0x0D, 0x0F, 0x80, 0x26, 0x92, /*'z'*/
+  0x10, 0x03, 0x07, 0x09, 0x1C, 0x00, 0x26, 0xE9, /*'{'*/
+  0x06, 0x02, 0x07, 0x03, 0x16, 0x00, 0x27, 0x67, /*'|'*/
+  0x10, 0x04, 0x07, 0x09, 0x1C, 0x00, 0x27, 0x88, /*'}'*/
+  0x10, 0x00, 0x12, 0x10, 0x05, 0x00, 0x28, 0x06, /*'~'*/
+  0x13, 0x01, 0x05, 0x11, 0x1A, 0x00, 0x28, 0x2E, /*0x7F*/
+  /*glyph boxes*/
+  0x08, 0xFC, 0x11, 0xFF, 0xFA, 0x2F, 0xFF, 0xF0, 0xAF, 0xFF, 0x00, 0x04, 0xC0, 0x00, 0x76, 0x00, 0x3B, 0x00, 0x4B, 0x10,
+  0x02, 0x00, 0x00, 0x71, 0x7F, 0x7F, 0x5E, 0xE5, 0xEF, 0xFE, 0xFF, 0xFF, 0x5F, 0xE5, 0x60, 0x0D, 0x0F, 0x05, 0x50, 0x03,
+  0x1F, 0x00, 0x50, 0x08, 0x0F, 0x0A, 0x00, 0x50, 0x0D, 0x0F, 0x05, 0x00, 0x40, 0x03, 0x1F, 0x10, 0x40, 0x08, 0x0F, 0x0A,
+  0x10, 0x40, 0x0D, 0x0F, 0x05, 0x10, 0x30, 0x03, 0x1F, 0x01, 0x10, 0x30, 0x08, 0x0F, 0x0A, 0x20, 0x30, 0x0D, 0x0F, 0x05,
+  0x20, 0x20, 0x03, 0x1F, 0x01, 0x20, 0x20, 0x08, 0x0F, 0x0A, 0x30, 0x20, 0x0D, 0x0F, 0x05, 0x30, 0x10, 0x03, 0x1F, 0x01,
+  0x30, 0x10, 0x08, 0x0F, 0x0B, 0x40, 0x10, 0x0D, 0x0F, 0x05, 0x40, 0x00, 0x03, 0x1F, 0x01, 0x40, 0x00, 0x08, 0x0F, 0x0B,
+  0x50, 0x00, 0x0D, 0x0F, 0x05, 0x50, 0x03, 0x1F, 0x01, 0x50, 0x08, 0x0F, 0x0B, 0x60, 0x0D, 0x0F, 0x05, 0x60, 0x00, 0x00,
+  0x6C, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x1B, 0xF6, 0x00, 0x6F, 0xC1, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x07, 0xFB, 0x00, 0x04,
+  0xFE, 0x00, 0x00, 0x00, 0xFF, 0x50, 0x0D, 0xF9, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x3F, 0xF5, 0x00, 0x00, 0x00, 0x6F, 0xF3,
+  0x8F, 0xF3, 0x00, 0x00, 0x00, 0x3F, 0xF8, 0xBF, 0xF1, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xEF, 0xF0, 0x00, 0x00, 0x00, 0x0F,
+  0xFD, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+  0x0E, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xDF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xBF, 0xF0, 0x00, 0x00,
+  0x00, 0x0F, 0xFB, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xF8, 0x2F, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xF3, 0x0C, 0xF9, 0x00,
+  0x00, 0x00, 0x9F, 0xD0, 0x04, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0x50, 0x00, 0xAF, 0x60, 0x00, 0x06, 0xFB, 0x00, 0x00, 0x1B,
+  0xF5, 0x00, 0x6F, 0xC1, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xD7, 0x00, 0x00, 0x50, 0x01, 0x20, 0x30, 0x03, 0x0B, 0x0E, 0x20,
+  0x10, 0x03, 0x0B, 0x1F, 0x0E, 0x20, 0x03, 0x19, 0x0C, 0x1F, 0x0E, 0x20, 0x01, 0x10, 0x01, 0x1F, 0x0E, 0x20, 0x30, 0x1F,
+  0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F,
+  0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F,
+  0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x20, 0x01,
+  0x1F, 0x0E, 0x20, 0x10, 0x01, 0x0A, 0x2F, 0x05, 0x10, 0x04, 0x7F, 0x0E, 0x20, 0x02, 0x09, 0x0E, 0x1F, 0x0C, 0x07, 0x40,
+  0x10, 0x06, 0x6F, 0x0D, 0x01, 0x20, 0x00, 0x05, 0x0F, 0x0A, 0x04, 0x03, 0x05, 0x0A, 0x2F, 0x0C, 0x20, 0x01, 0x0E, 0x06,
+  0x40, 0x04, 0x2F, 0x06, 0x10, 0x07, 0x0B, 0x60, 0x09, 0x1F, 0x0B, 0x10, 0x0C, 0x03, 0x60, 0x03, 0x1F, 0x0D, 0x10, 0x06,
+  0x80, 0x1F, 0x0D, 0x10, 0x80, 0x01, 0x1F, 0x0B, 0x10, 0x80, 0x03, 0x1F, 0x06, 0x10, 0x80, 0x07, 0x1F, 0x01, 0x10, 0x80,
+  0x0D, 0x0F, 0x07, 0x20, 0x70, 0x06, 0x0F, 0x0C, 0x30, 0x60, 0x01, 0x0E, 0x0F, 0x02, 0x30, 0x60, 0x0A, 0x0F, 0x03, 0x40,
+  0x50, 0x07, 0x0F, 0x04, 0x50, 0x40, 0x05, 0x0F, 0x05, 0x60, 0x30, 0x04, 0x0F, 0x06, 0x70, 0x20, 0x03, 0x0F, 0x06, 0x70,
+  0x02, 0x10, 0x03, 0x0F, 0x07, 0x70, 0x08, 0x03, 0x00, 0x02, 0x0E, 0x0A, 0x73, 0x08, 0x0D, 0x00, 0x01, 0x0E, 0xAF, 0x06,
+  0x00, 0x0D, 0xBF, 0x10, 0x20, 0x04, 0x0B, 0x0E, 0x1F, 0x0C, 0x06, 0x20, 0x10, 0x09, 0x6F, 0x0A, 0x10, 0x00, 0x07, 0x0E,
+  0x06, 0x01, 0x00, 0x02, 0x09, 0x2F, 0x06, 0x00, 0x02, 0x0D, 0x01, 0x40, 0x09, 0x1F, 0x0C, 0x00, 0x09, 0x02, 0x50, 0x02,
+  0x1F, 0x0E, 0x00, 0x03, 0x70, 0x1F, 0x0C, 0x00, 0x70, 0x02, 0x1F, 0x05, 0x00, 0x70, 0x08, 0x0F, 0x07, 0x10, 0x60, 0x05,
+  0x0E, 0x04, 0x20, 0x40, 0x01, 0x09, 0x1F, 0x0A, 0x02, 0x10, 0x20, 0x02, 0x09, 0x5F, 0x04, 0x00, 0x20, 0x01, 0x03, 0x05,
+  0x09, 0x4F, 0x02, 0x60, 0x01, 0x0A, 0x2F, 0x09, 0x80, 0x0C, 0x1F, 0x0C, 0x80, 0x05, 0x1F, 0x0E, 0x80, 0x01, 0x1F, 0x0D,
+  0x90, 0x1F, 0x0A, 0x80, 0x02, 0x1F, 0x04, 0x80, 0x07, 0x0F, 0x0B, 0x00, 0x08, 0x0A, 0x05, 0x40, 0x02, 0x0F, 0x0C, 0x01,
+  0x00, 0x2F, 0x0C, 0x04, 0x10, 0x05, 0x0E, 0x08, 0x20, 0x04, 0x0B, 0x2F, 0x0D, 0x0B, 0x07, 0x01, 0x30, 0x80, 0x02, 0x0F,
+  0x0E, 0x20, 0x80, 0x0D, 0x0F, 0x0E, 0x20, 0x70, 0x08, 0x1F, 0x0E, 0x20, 0x60, 0x03, 0x0E, 0x1F, 0x0E, 0x20, 0x60, 0x0D,
+  0x04, 0x1F, 0x0E, 0x20, 0x50, 0x09, 0x0A, 0x00, 0x1F, 0x0E, 0x20, 0x40, 0x04, 0x0E, 0x01, 0x00, 0x1F, 0x0E, 0x20, 0x30,
+  0x01, 0x0E, 0x04, 0x10, 0x1F, 0x0E, 0x20, 0x30, 0x0A, 0x09, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x05, 0x0E, 0x01, 0x20, 0x1F,
+  0x0E, 0x20, 0x10, 0x01, 0x0E, 0x04, 0x30, 0x1F, 0x0E, 0x20, 0x10, 0x0A, 0x09, 0x40, 0x1F, 0x0E, 0x20, 0x00, 0x05, 0x0E,
+  0x01, 0x40, 0x1F, 0x0E, 0x20, 0x02, 0x0F, 0x04, 0x50, 0x1F, 0x0E, 0x20, 0x0B, 0x0A, 0x61, 0x1F, 0x0E, 0x21, 0xEF, 0xEF,
+  0x80, 0x1F, 0x0E, 0x20, 0x80, 0x1F, 0x0E, 0x20, 0x80, 0x1F, 0x0E, 0x20, 0x80, 0x1F, 0x0E, 0x20, 0x80, 0x1F, 0x0E, 0x20,
+  0xB0, 0x03, 0x05, 0x30, 0x02, 0x7F, 0x02, 0x30, 0x09, 0x6F, 0x0B, 0x00, 0x20, 0x01, 0x0F, 0x5E, 0x0D, 0x04, 0x00, 0x20,
+  0x07, 0x0F, 0x01, 0x70, 0x20, 0x0E, 0x08, 0x80, 0x10, 0x05, 0x0F, 0x06, 0x01, 0x70, 0x10, 0x0C, 0x2F, 0x0D, 0x08, 0x02,
+  0x40, 0x00, 0x03, 0x6F, 0x0A, 0x01, 0x20, 0x00, 0x02, 0x07, 0x08, 0x0C, 0x4F, 0x0E, 0x03, 0x10, 0x40, 0x01, 0x06, 0x0D,
+  0x2F, 0x0E, 0x01, 0x00, 0x70, 0x07, 0x2F, 0x08, 0x00, 0x80, 0x06, 0x1F, 0x0E, 0x00, 0x90, 0x0B, 0x1F, 0x01, 0x90, 0x05,
+  0x1F, 0x02, 0x90, 0x01, 0x1F, 0x02, 0xA0, 0x1F, 0x00, 0x90, 0x02, 0x0F, 0x0C, 0x00, 0x90, 0x06, 0x0F, 0x07, 0x00, 0x90,
+  0x0D, 0x0E, 0x10, 0x04, 0x0F, 0x0E, 0x08, 0x40, 0x08, 0x0E, 0x03, 0x10, 0x06, 0x2F, 0x0E, 0x06, 0x02, 0x04, 0x1B, 0x02,
+  0x20, 0x00, 0x07, 0x0D, 0x2F, 0x0D, 0x09, 0x03, 0x40, 0xA0, 0x01, 0x04, 0x01, 0x70, 0x05, 0x0A, 0x0D, 0x09, 0x06, 0x01,
+  0x50, 0x07, 0x1E, 0x06, 0x30, 0x30, 0x03, 0x0E, 0x0F, 0x0A, 0x01, 0x40, 0x20, 0x05, 0x1F, 0x08, 0x60, 0x10, 0x03, 0x1F,
+  0x0A, 0x70, 0x00, 0x01, 0x0E, 0x1F, 0x01, 0x70, 0x00, 0x08, 0x1F, 0x08, 0x80, 0x01, 0x2F, 0x01, 0x80, 0x06, 0x1F, 0x0D,
+  0x06, 0x0A, 0x0D, 0x0F, 0x0E, 0x0C, 0x06, 0x20, 0x0A, 0x2F, 0x05, 0x01, 0x00, 0x01, 0x07, 0x1F, 0x0C, 0x01, 0x00, 0x0D,
+  0x1F, 0x05, 0x40, 0x05, 0x1F, 0x0B, 0x00, 0x2F, 0x60, 0x0C, 0x1F, 0x04, 0x1F, 0x0E, 0x60, 0x06, 0x1F, 0x0A, 0x1F, 0x0E,
+  0x60, 0x03, 0x1F, 0x0D, 0x0E, 0x1F, 0x60, 0x01, 0x1F, 0x0E, 0x0B, 0x1F, 0x01, 0x60, 0x1F, 0x0D, 0x08, 0x1F, 0x04, 0x50,
+  0x01, 0x1F, 0x0B, 0x02, 0x1F, 0x08, 0x50, 0x03, 0x1F, 0x07, 0x00, 0x0A, 0x0F, 0x0E, 0x50, 0x07, 0x1F, 0x01, 0x00, 0x01,
+  0x0E, 0x0F, 0x08, 0x40, 0x0D, 0x0F, 0x05, 0x00, 0x10, 0x02, 0x0E, 0x0F, 0x08, 0x01, 0x00, 0x02, 0x0B, 0x0F, 0x07, 0x10,
+  0x20, 0x01, 0x07, 0x0D, 0x1F, 0x0E, 0x0A, 0x03, 0x20, 0x00, 0x01, 0xBF, 0x00, 0x07, 0xAF, 0x0B, 0x00, 0x0E, 0x0B, 0x04,
+  0x63, 0x0C, 0x0F, 0x06, 0x05, 0x0B, 0x80, 0x1F, 0x01, 0x07, 0x02, 0x70, 0x05, 0x0F, 0x0C, 0x00, 0x90, 0x0A, 0x0F, 0x07,
+  0x00, 0x90, 0x1F, 0x02, 0x00, 0x80, 0x04, 0x0F, 0x0C, 0x10, 0x80, 0x09, 0x0F, 0x07, 0x10, 0x80, 0x0E, 0x0F, 0x02, 0x10,
+  0x70, 0x03, 0x0F, 0x0D, 0x20, 0x70, 0x08, 0x0F, 0x08, 0x20, 0x70, 0x0D, 0x0F, 0x03, 0x20, 0x60, 0x03, 0x0F, 0x0E, 0x30,
+  0x60, 0x08, 0x0F, 0x09, 0x30, 0x60, 0x0D, 0x0F, 0x04, 0x30, 0x50, 0x02, 0x1F, 0x40, 0x50, 0x07, 0x0F, 0x0A, 0x40, 0x50,
+  0x0C, 0x0F, 0x05, 0x40, 0x40, 0x01, 0x1F, 0x01, 0x40, 0x40, 0x06, 0x0F, 0x0B, 0x50, 0x40, 0x0B, 0x0F, 0x06, 0x50, 0x00,
+  0x18, 0xDF, 0xFE, 0xB4, 0x00, 0x00, 0x5F, 0xF6, 0x00, 0x2A, 0xF9, 0x00, 0x3F, 0xF5, 0x00, 0x00, 0x0B, 0xF7, 0x0B, 0xFF,
+  0x00, 0x00, 0x00, 0x5F, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xE0, 0xCF, 0xFB,
+  0x00, 0x00, 0x09, 0xF9, 0x05, 0xFF, 0xF8, 0x00, 0x03, 0xFD, 0x10, 0x07, 0xFF, 0xFA, 0x13, 0xEB, 0x10, 0x00, 0x05, 0xFF,
+  0xFE, 0xF5, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x5E, 0xDF, 0xFF, 0xE3, 0x00, 0x00, 0x8F, 0x70,
+  0x8F, 0xFF, 0xF3, 0x00, 0xAF, 0xA0, 0x00, 0x5F, 0xFF, 0xE1, 0x7F, 0xF3, 0x00, 0x00, 0x4F, 0xFF, 0x7D, 0xFF, 0x00, 0x00,
+  0x00, 0x8F, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x02, 0xFF, 0xEF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0xBF, 0xF3, 0x00, 0x00,
+  0x02, 0xFF, 0x83, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xF1, 0x05, 0xFF, 0xA2, 0x01, 0x7F, 0xE3, 0x00, 0x01, 0x8D, 0xFF, 0xEC,
+  0x71, 0x00, 0x20, 0x03, 0x0A, 0x0E, 0x1F, 0x0C, 0x06, 0x30, 0x10, 0x06, 0x0F, 0x0B, 0x01, 0x00, 0x01, 0x08, 0x0F, 0x0C,
+  0x01, 0x10, 0x00, 0x05, 0x0F, 0x0D, 0x40, 0x07, 0x0F, 0x0C, 0x10, 0x01, 0x1F, 0x06, 0x50, 0x0E, 0x0F, 0x08, 0x00, 0x08,
+  0x1F, 0x01, 0x50, 0x09, 0x1F, 0x01, 0x0C, 0x1F, 0x60, 0x05, 0x1F, 0x06, 0x1F, 0x0E, 0x60, 0x03, 0x1F, 0x0A, 0x2F, 0x60,
+  0x01, 0x1F, 0x0C, 0x2F, 0x01, 0x60, 0x1F, 0x0E, 0x0C, 0x1F, 0x04, 0x60, 0x1F, 0x0E, 0x07, 0x1F, 0x09, 0x60, 0x1F, 0x0D,
+  0x01, 0x0D, 0x1F, 0x03, 0x40, 0x05, 0x1F, 0x0B, 0x00, 0x02, 0x0E, 0x1F, 0x05, 0x10, 0x02, 0x08, 0x0D, 0x1F, 0x07, 0x10,
+  0x01, 0x07, 0x0C, 0x1F, 0x0D, 0x09, 0x04, 0x06, 0x1F, 0x02, 0x90, 0x0C, 0x0F, 0x0C, 0x00, 0x80, 0x04, 0x1F, 0x04, 0x00,
+  0x80, 0x0D, 0x0F, 0x0B, 0x10, 0x70, 0x09, 0x0F, 0x0E, 0x02, 0x10, 0x60, 0x08, 0x1F, 0x03, 0x20, 0x40, 0x01, 0x0A, 0x0F,
+  0x0C, 0x02, 0x30, 0x20, 0x01, 0x06, 0x1E, 0x06, 0x50, 0x01, 0x06, 0x0A, 0x0E, 0x0A, 0x05, 0x70, 0x01, 0x05, 0x02, 0xA0,
+  0x05, 0x1E, 0x05, 0x0E, 0x1F, 0x0E, 0x3F, 0x05, 0x0F, 0x0E, 0x05, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x05, 0x1E,
+  0x05, 0x0E, 0x1F, 0x0E, 0x3F, 0x05, 0x0F, 0x0E, 0x05, 0x5E, 0xE5, 0xEF, 0xFE, 0xFF, 0xFF, 0x5F, 0xE5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xC1, 0xEF, 0xFA, 0xFF, 0xFF, 0x7F, 0xFF, 0x00,
+  0x4C, 0x00, 0x76, 0x03, 0xC0, 0x3C, 0x20, 0x21, 0x00, 0xE0, 0x16, 0xB0, 0x01, 0x07, 0x0E, 0x0F, 0x08, 0x90, 0x02, 0x09,
+  0x3F, 0x05, 0x70, 0x03, 0x0A, 0x2F, 0x0E, 0x07, 0x01, 0x00, 0x50, 0x05, 0x0C, 0x2F, 0x0D, 0x06, 0x30, 0x30, 0x06, 0x0D,
+  0x2F, 0x0B, 0x04, 0x50, 0x00, 0x01, 0x07, 0x0E, 0x2F, 0x0A, 0x03, 0x70, 0x09, 0x3F, 0x09, 0x02, 0x90, 0x2F, 0x08, 0x01,
+  0xB0, 0x3F, 0x08, 0x01, 0xA0, 0x01, 0x08, 0x3F, 0x09, 0x02, 0x80, 0x10, 0x01, 0x07, 0x0E, 0x2F, 0x0B, 0x03, 0x60, 0x40,
+  0x05, 0x0D, 0x2F, 0x0C, 0x05, 0x40, 0x60, 0x04, 0x0B, 0x2F, 0x0D, 0x06, 0x20, 0x80, 0x02, 0x0A, 0x2F, 0x0E, 0x08, 0x01,
+  0xA0, 0x01, 0x08, 0x2F, 0x08, 0xC0, 0x01, 0x07, 0x0E, 0x08, 0xF0, 0x02, 0xFF, 0xFF, 0xF3, 0xF0, 0xF0, 0xF0, 0xF3, 0xFF,
+  0xFF, 0x0A, 0x02, 0xE0, 0x1F, 0x0B, 0x04, 0xC0, 0x0C, 0x2F, 0x0C, 0x05, 0xA0, 0x00, 0x03, 0x0B, 0x2F, 0x0E, 0x07, 0x01,
+  0x70, 0x20, 0x02, 0x09, 0x3F, 0x08, 0x01, 0x50, 0x40, 0x01, 0x08, 0x3F, 0x0A, 0x02, 0x30, 0x60, 0x01, 0x06, 0x0E, 0x2F,
+  0x0B, 0x04, 0x10, 0x90, 0x05, 0x0C, 0x2F, 0x0D, 0x04, 0xB0, 0x04, 0x0D, 0x1F, 0x08, 0xA0, 0x04, 0x0C, 0x2F, 0x07, 0x80,
+  0x06, 0x0D, 0x2F, 0x0C, 0x05, 0x00, 0x50, 0x01, 0x07, 0x0E, 0x2F, 0x0A, 0x03, 0x20, 0x30, 0x02, 0x08, 0x3F, 0x09, 0x02,
+  0x40, 0x10, 0x03, 0x0A, 0x2F, 0x0E, 0x07, 0x01, 0x60, 0x04, 0x0B, 0x2F, 0x0D, 0x06, 0x90, 0x2F, 0x0C, 0x05, 0xB0, 0x0F,
+  0x0A, 0x03, 0xD0, 0x02, 0xF0, 0x10, 0x06, 0x0C, 0x0E, 0x0F, 0x0E, 0x0A, 0x03, 0x10, 0x00, 0x0B, 0x09, 0x02, 0x00, 0x01,
+  0x08, 0x1F, 0x07, 0x00, 0x08, 0x0C, 0x40, 0x09, 0x1F, 0x05, 0x0E, 0x0F, 0x01, 0x30, 0x01, 0x1F, 0x0D, 0x1F, 0x0B, 0x40,
+  0x0E, 0x1F, 0x0D, 0x0F, 0x0C, 0x40, 0x2F, 0x02, 0x06, 0x02, 0x30, 0x01, 0x1F, 0x0B, 0x60, 0x05, 0x1F, 0x04, 0x60, 0x0A,
+  0x0F, 0x0B, 0x00, 0x50, 0x01, 0x1F, 0x02, 0x00, 0x50, 0x07, 0x0F, 0x04, 0x10, 0x50, 0x0E, 0x07, 0x20, 0x40, 0x04, 0x0D,
+  0x30, 0x40, 0x09, 0x05, 0x30, 0x40, 0x0B, 0x40, 0x40, 0x09, 0x40, 0xA0, 0xA0, 0x30, 0x07, 0x0F, 0x05, 0x30, 0x30, 0x1F,
+  0x0D, 0x30, 0x30, 0x1F, 0x0D, 0x30, 0x30, 0x08, 0x0F, 0x06, 0x30, 0x00, 0x00, 0x00, 0x05, 0xAD, 0xFF, 0xEE, 0xA6, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xEF, 0x93, 0x00, 0x01, 0x5B, 0xE6, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xC2, 0x00, 0x00, 0x00,
+  0x00, 0x4E, 0xB1, 0x00, 0x00, 0x1D, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDC, 0x00, 0x00, 0xBF, 0xE1, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x80, 0x07, 0xFF, 0x50, 0x00, 0x00, 0x7D, 0xFE, 0x77, 0xB6, 0x05, 0xF2, 0x1F, 0xFD, 0x00,
+  0x00, 0x1D, 0xFD, 0x31, 0xCF, 0xF6, 0x00, 0xD8, 0x6F, 0xF7, 0x00, 0x00, 0xCF, 0xD1, 0x00, 0x6F, 0xF2, 0x00, 0x7C, 0xBF,
+  0xF3, 0x00, 0x07, 0xFF, 0x30, 0x00, 0x6F, 0xE0, 0x00, 0x4F, 0xEF, 0xF0, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x7F, 0xB0, 0x00,
+  0x3F, 0xFF, 0xF0, 0x00, 0x6F, 0xF5, 0x00, 0x00, 0xAF, 0x70, 0x00, 0x4E, 0xFF, 0xE0, 0x00, 0xAF, 0xF2, 0x00, 0x00, 0xEF,
+  0x30, 0x00, 0x6C, 0xFF, 0xF0, 0x00, 0xDF, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xB8, 0xCF, 0xF1, 0x00, 0xEF, 0xF0, 0x00,
+  0x09, 0xFC, 0x00, 0x02, 0xF2, 0x8F, 0xF5, 0x00, 0xCF, 0xF3, 0x00, 0x2F, 0xF9, 0x00, 0x0C, 0x80, 0x2F, 0xFA, 0x00, 0x6F,
+  0xFB, 0x12, 0xA8, 0xFD, 0x11, 0xBB, 0x00, 0x09, 0xFF, 0x20, 0x08, 0xFF, 0xF9, 0x10, 0xAF, 0xFF, 0x80, 0x00, 0x01, 0xDF,
+  0xC0, 0x00, 0x12, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x2E, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xCF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0x00, 0x00, 0x07, 0xEF, 0x94, 0x10, 0x00, 0x37, 0xCE,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAD, 0xFF, 0xEE, 0xC8, 0x40, 0x00, 0x00, 0xA0, 0x0C, 0x05, 0x90, 0x90, 0x03, 0x0F,
+  0x0C, 0x90, 0x90, 0x0A, 0x1F, 0x03, 0x80, 0x80, 0x01, 0x2F, 0x0A, 0x80, 0x80, 0x07, 0x3F, 0x01, 0x70, 0x80, 0x0E, 0x0A,
+  0x0C, 0x1F, 0x07, 0x70, 0x70, 0x04, 0x0F, 0x04, 0x06, 0x1F, 0x0E, 0x70, 0x70, 0x0B, 0x0D, 0x10, 0x2F, 0x05, 0x60, 0x60,
+  0x02, 0x0F, 0x07, 0x10, 0x09, 0x1F, 0x0C, 0x60, 0x60, 0x08, 0x0F, 0x01, 0x10, 0x02, 0x2F, 0x03, 0x50, 0x60, 0x0F, 0x0A,
+  0x30, 0x0C, 0x1F, 0x0A, 0x50, 0x50, 0x06, 0x0F, 0x04, 0x30, 0x06, 0x2F, 0x01, 0x40, 0x50, 0x1D, 0x50, 0x2F, 0x08, 0x40,
+  0x40, 0x03, 0x0F, 0x08, 0x51, 0x09, 0x2F, 0x40, 0x40, 0x0A, 0xBF, 0x06, 0x30, 0x30, 0x01, 0x0F, 0x0B, 0x74, 0x0D, 0x1F,
+  0x0D, 0x30, 0x30, 0x07, 0x0F, 0x03, 0x70, 0x06, 0x2F, 0x04, 0x20, 0x30, 0x0E, 0x0C, 0x90, 0x0E, 0x1F, 0x0B, 0x20, 0x20,
+  0x06, 0x0F, 0x06, 0x90, 0x07, 0x2F, 0x02, 0x10, 0x20, 0x0E, 0x0F, 0x01, 0x90, 0x02, 0x2F, 0x09, 0x10, 0x00, 0x01, 0x0A,
+  0x1F, 0x05, 0x90, 0x03, 0x3F, 0x05, 0x00, 0x02, 0x5F, 0x02, 0x50, 0x03, 0x6F, 0x0E, 0x01, 0x0B, 0x0D, 0x8F, 0x0D, 0x0A,
+  0x05, 0x40, 0x20, 0x06, 0x2F, 0x05, 0x14, 0x05, 0x08, 0x0D, 0x1F, 0x0D, 0x03, 0x20, 0x20, 0x01, 0x1F, 0x0E, 0x50, 0x06,
+  0x2F, 0x02, 0x10, 0x30, 0x1F, 0x0E, 0x60, 0x08, 0x1F, 0x0A, 0x10, 0x30, 0x1F, 0x0E, 0x60, 0x01, 0x1F, 0x0E, 0x10, 0x30,
+  0x1F, 0x0E, 0x70, 0x2F, 0x10, 0x30, 0x1F, 0x0E, 0x70, 0x2F, 0x10, 0x30, 0x1F, 0x0E, 0x60, 0x03, 0x1F, 0x0A, 0x10, 0x30,
+  0x1F, 0x0E, 0x60, 0x0C, 0x1F, 0x03, 0x10, 0x30, 0x1F, 0x0E, 0x30, 0x01, 0x05, 0x0D, 0x0F, 0x0E, 0x04, 0x20, 0x30, 0x9F,
+  0x0B, 0x03, 0x30, 0x30, 0x1F, 0x0E, 0x30, 0x02, 0x06, 0x0B, 0x1F, 0x0C, 0x04, 0x10, 0x30, 0x1F, 0x0E, 0x60, 0x05, 0x2F,
+  0x08, 0x00, 0x30, 0x1F, 0x0E, 0x70, 0x09, 0x2F, 0x04, 0x30, 0x1F, 0x0E, 0x70, 0x03, 0x2F, 0x0C, 0x30, 0x1F, 0x0E, 0x80,
+  0x3F, 0x30, 0x1F, 0x0E, 0x70, 0x01, 0x3F, 0x30, 0x1F, 0x0E, 0x70, 0x03, 0x2F, 0x0C, 0x30, 0x1F, 0x0E, 0x70, 0x0A, 0x2F,
+  0x06, 0x20, 0x01, 0x1F, 0x0E, 0x60, 0x09, 0x2F, 0x0B, 0x00, 0x20, 0x06, 0x2F, 0x07, 0x04, 0x03, 0x04, 0x06, 0x09, 0x3F,
+  0x0A, 0x01, 0x00, 0x01, 0x0B, 0x0D, 0xAF, 0x0D, 0x09, 0x03, 0x20, 0x50, 0x03, 0x08, 0x0C, 0x1F, 0x1E, 0x0C, 0x09, 0x06,
+  0x02, 0x04, 0x0F, 0x00, 0x30, 0x02, 0x0B, 0x1F, 0x09, 0x03, 0x20, 0x03, 0x09, 0x3F, 0x00, 0x20, 0x04, 0x2F, 0x03, 0x60,
+  0x03, 0x2F, 0x00, 0x10, 0x04, 0x2F, 0x03, 0x80, 0x04, 0x1F, 0x00, 0x00, 0x02, 0x2F, 0x07, 0xA0, 0x0A, 0x0F, 0x00, 0x00,
+  0x0B, 0x2F, 0x01, 0xA0, 0x02, 0x0F, 0x00, 0x02, 0x2F, 0x0A, 0xC0, 0x0C, 0x00, 0x08, 0x2F, 0x05, 0xE0, 0x0C, 0x2F, 0x03,
+  0xE0, 0x0E, 0x2F, 0x01, 0xE0, 0x3F, 0xF0, 0x3F, 0xF0, 0x3F, 0x01, 0xE0, 0x0D, 0x2F, 0x03, 0xE0, 0x0A, 0x2F, 0x06, 0xE0,
+  0x05, 0x2F, 0x0A, 0xE0, 0x00, 0x0E, 0x2F, 0x01, 0xD0, 0x00, 0x05, 0x2F, 0x07, 0xB0, 0x11, 0x10, 0x08, 0x2F, 0x03, 0x90,
+  0x01, 0x0C, 0x05, 0x20, 0x08, 0x2F, 0x04, 0x70, 0x05, 0x0E, 0x06, 0x00, 0x30, 0x04, 0x0D, 0x1F, 0x0B, 0x05, 0x01, 0x10,
+  0x01, 0x05, 0x0C, 0x0B, 0x03, 0x10, 0x50, 0x05, 0x0A, 0x0D, 0x2F, 0x0D, 0x0C, 0x08, 0x02, 0x30, 0x07, 0x0B, 0x7F, 0x0E,
+  0x0C, 0x09, 0x05, 0x01, 0x50, 0x10, 0x05, 0x2F, 0x02, 0x10, 0x01, 0x03, 0x07, 0x0D, 0x1F, 0x09, 0x01, 0x30, 0x10, 0x01,
+  0x1F, 0x0E, 0x60, 0x04, 0x0E, 0x0F, 0x0E, 0x04, 0x20, 0x20, 0x1F, 0x0E, 0x70, 0x01, 0x0D, 0x1F, 0x04, 0x10, 0x20, 0x1F,
+  0x0E, 0x80, 0x01, 0x0E, 0x0F, 0x0E, 0x01, 0x00, 0x20, 0x1F, 0x0E, 0x90, 0x05, 0x1F, 0x0A, 0x00, 0x20, 0x1F, 0x0E, 0xA0,
+  0x0E, 0x1F, 0x02, 0x20, 0x1F, 0x0E, 0xA0, 0x08, 0x1F, 0x07, 0x20, 0x1F, 0x0E, 0xA0, 0x04, 0x1F, 0x0A, 0x20, 0x1F, 0x0E,
+  0xA0, 0x02, 0x1F, 0x0D, 0x20, 0x1F, 0x0E, 0xA0, 0x01, 0x1F, 0x0E, 0x20, 0x1F, 0x0E, 0xB0, 0x1F, 0x0D, 0x20, 0x1F, 0x0E,
+  0xA0, 0x01, 0x1F, 0x0C, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x1F, 0x0A, 0x20, 0x1F, 0x0E, 0xA0, 0x06, 0x1F, 0x06, 0x20, 0x1F,
+  0x0E, 0xA0, 0x0B, 0x1F, 0x01, 0x20, 0x1F, 0x0E, 0x90, 0x02, 0x1F, 0x09, 0x00, 0x20, 0x1F, 0x0E, 0x90, 0x0B, 0x0F, 0x0E,
+  0x01, 0x00, 0x20, 0x1F, 0x0E, 0x80, 0x08, 0x1F, 0x03, 0x10, 0x10, 0x01, 0x1F, 0x0E, 0x60, 0x02, 0x0B, 0x1F, 0x04, 0x20,
+  0x10, 0x04, 0x2F, 0x02, 0x20, 0x02, 0x06, 0x0B, 0x1F, 0x09, 0x01, 0x30, 0x05, 0x08, 0x0E, 0x7F, 0x0D, 0x0A, 0x06, 0x01,
+  0x50, 0x06, 0x0B, 0xEF, 0x10, 0x10, 0x05, 0x2F, 0x01, 0x50, 0x01, 0x05, 0x1F, 0x10, 0x10, 0x01, 0x1F, 0x0E, 0x80, 0x05,
+  0x0F, 0x10, 0x20, 0x1F, 0x0E, 0x90, 0x0F, 0x10, 0x20, 0x1F, 0x0E, 0x90, 0x0A, 0x10, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F,
+  0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0x70, 0x06, 0x08, 0x20, 0x20, 0x1F, 0x0E, 0x70, 0x0B, 0x08, 0x20, 0x20, 0x1F, 0x0E, 0x50,
+  0x01, 0x07, 0x0F, 0x08, 0x20, 0x20, 0xBF, 0x08, 0x20, 0x20, 0x1F, 0x0E, 0x50, 0x02, 0x08, 0x0F, 0x08, 0x20, 0x20, 0x1F,
+  0x0E, 0x70, 0x0D, 0x08, 0x20, 0x20, 0x1F, 0x0E, 0x70, 0x18, 0x20, 0x20, 0x1F, 0x0E, 0x70, 0x06, 0x08, 0x20, 0x20, 0x1F,
+  0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xB0, 0x01, 0x20, 0x1F, 0x0E, 0xA0, 0x08, 0x09, 0x20, 0x1F, 0x0E, 0x90, 0x02, 0x0F, 0x04,
+  0x10, 0x01, 0x1F, 0x0E, 0x80, 0x01, 0x0D, 0x0F, 0x00, 0x10, 0x06, 0x2F, 0x03, 0x40, 0x01, 0x03, 0x07, 0x0E, 0x0F, 0x0B,
+  0x00, 0x06, 0x0B, 0xEF, 0x07, 0x00, 0x06, 0x0B, 0xEF, 0x10, 0x05, 0x2F, 0x60, 0x01, 0x06, 0x1F, 0x10, 0x01, 0x1F, 0x0E,
+  0x80, 0x06, 0x0F, 0x20, 0x1F, 0x0E, 0x80, 0x01, 0x0F, 0x20, 0x1F, 0x0E, 0x90, 0x0B, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F,
+  0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0x70, 0x0E, 0x10, 0x20, 0x1F, 0x0E, 0x60, 0x02, 0x0F, 0x10, 0x20, 0x1F, 0x0E, 0x50, 0x03,
+  0x0C, 0x0F, 0x10, 0x20, 0xBF, 0x10, 0x20, 0x1F, 0x0E, 0x50, 0x04, 0x0E, 0x0F, 0x10, 0x20, 0x1F, 0x0E, 0x60, 0x05, 0x0F,
+  0x10, 0x20, 0x1F, 0x0E, 0x70, 0x0F, 0x10, 0x20, 0x1F, 0x0E, 0x70, 0x0D, 0x10, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E,
+  0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x10, 0x02, 0x2F, 0x01, 0x90, 0x00, 0x01, 0x09, 0x2F, 0x08, 0x01,
+  0x80, 0x0C, 0x6F, 0x0D, 0x70, 0x50, 0x03, 0x09, 0x0D, 0x1F, 0x1E, 0x0C, 0x09, 0x06, 0x04, 0x1A, 0x20, 0x30, 0x02, 0x0C,
+  0x1F, 0x09, 0x03, 0x20, 0x04, 0x0B, 0x2F, 0x0A, 0x20, 0x20, 0x05, 0x1F, 0x0E, 0x03, 0x60, 0x08, 0x1F, 0x0A, 0x20, 0x10,
+  0x05, 0x2F, 0x03, 0x80, 0x0B, 0x0F, 0x0A, 0x20, 0x00, 0x02, 0x2F, 0x08, 0x90, 0x02, 0x0F, 0x0A, 0x20, 0x00, 0x0B, 0x2F,
+  0x01, 0xA0, 0x09, 0x0A, 0x20, 0x02, 0x2F, 0x0B, 0xB0, 0x02, 0x0A, 0x20, 0x08, 0x2F, 0x07, 0xF0, 0x00, 0x0C, 0x2F, 0x04,
+  0xF0, 0x00, 0x0E, 0x2F, 0x01, 0xF0, 0x00, 0x3F, 0x80, 0x08, 0x6F, 0x03, 0x3F, 0x90, 0x01, 0x07, 0x2F, 0x08, 0x10, 0x3F,
+  0x01, 0xA0, 0x2F, 0x01, 0x10, 0x0D, 0x2F, 0x03, 0xA0, 0x0E, 0x1F, 0x20, 0x09, 0x2F, 0x05, 0xA0, 0x0E, 0x1F, 0x20, 0x04,
+  0x2F, 0x0A, 0xA0, 0x0E, 0x1F, 0x20, 0x00, 0x0D, 0x2F, 0x01, 0x90, 0x0E, 0x1F, 0x20, 0x00, 0x04, 0x2F, 0x08, 0x90, 0x0E,
+  0x1F, 0x20, 0x10, 0x08, 0x2F, 0x04, 0x80, 0x0E, 0x1F, 0x20, 0x20, 0x07, 0x2F, 0x05, 0x60, 0x01, 0x2F, 0x20, 0x30, 0x03,
+  0x0B, 0x1F, 0x0B, 0x05, 0x01, 0x10, 0x01, 0x05, 0x0D, 0x0F, 0x0D, 0x06, 0x20, 0x50, 0x03, 0x08, 0x0C, 0x0E, 0x1F, 0x0E,
+  0x0D, 0x0A, 0x07, 0x03, 0x40, 0x09, 0x0D, 0x4F, 0x0D, 0x09, 0x30, 0x09, 0x0D, 0x4F, 0x0D, 0x09, 0x10, 0x07, 0x2F, 0x05,
+  0x70, 0x05, 0x2F, 0x07, 0x10, 0x10, 0x01, 0x2F, 0x90, 0x2F, 0x01, 0x10, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20,
+  0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20,
+  0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x92, 0x0E, 0x1F,
+  0x20, 0x20, 0xFF, 0x20, 0x20, 0x2F, 0x95, 0x2F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90,
+  0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E,
+  0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x0E, 0x1F, 0x20, 0x10, 0x02,
+  0x2F, 0x90, 0x2F, 0x02, 0x10, 0x00, 0x01, 0x09, 0x2F, 0x08, 0x01, 0x60, 0x08, 0x2F, 0x0A, 0x01, 0x00, 0x0C, 0x6F, 0x0C,
+  0x30, 0x0D, 0x6F, 0x0B, 0x01, 0x8F, 0x10, 0x01, 0x09, 0x2F, 0x08, 0x01, 0x00, 0x20, 0x02, 0x2F, 0x20, 0x30, 0x1F, 0x0E,
+  0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E,
+  0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E,
+  0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E, 0x20, 0x30, 0x1F, 0x0E,
+  0x20, 0x20, 0x02, 0x2F, 0x20, 0x10, 0x01, 0x09, 0x2F, 0x08, 0x01, 0x00, 0x01, 0x8F, 0x10, 0x01, 0x7F, 0x0C, 0x30, 0x01,
+  0x09, 0x2F, 0x07, 0x10, 0x40, 0x02, 0x2F, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20,
+  0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20,
+  0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20, 0x50, 0x1F, 0x0E, 0x20,
+  0x50, 0x1F, 0x0D, 0x20, 0x50, 0x1F, 0x0B, 0x20, 0x01, 0x0C, 0x0E, 0x04, 0x10, 0x1F, 0x07, 0x20, 0x07, 0x1F, 0x0C, 0x00,
+  0x01, 0x1F, 0x01, 0x20, 0x05, 0x2F, 0x06, 0x0A, 0x0F, 0x05, 0x30, 0x00, 0x07, 0x0E, 0x1F, 0x0B, 0x03, 0x40, 0x0D, 0x6F,
+  0x0D, 0x20, 0x0E, 0x6F, 0x06, 0x00, 0x00, 0x01, 0x09, 0x2F, 0x07, 0x60, 0x0B, 0x1F, 0x0A, 0x02, 0x20, 0x10, 0x02, 0x2F,
+  0x70, 0x0B, 0x0F, 0x07, 0x40, 0x20, 0x1F, 0x0E, 0x60, 0x07, 0x0F, 0x07, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x06, 0x0F, 0x06,
+  0x60, 0x20, 0x1F, 0x0E, 0x40, 0x08, 0x0F, 0x06, 0x70, 0x20, 0x1F, 0x0E, 0x30, 0x0A, 0x0F, 0x06, 0x80, 0x20, 0x1F, 0x0E,
+  0x10, 0x01, 0x0B, 0x0F, 0x06, 0x90, 0x20, 0x1F, 0x0E, 0x00, 0x02, 0x0D, 0x0F, 0x06, 0xA0, 0x20, 0x1F, 0x0E, 0x03, 0x0E,
+  0x0F, 0x0A, 0xB0, 0x20, 0x6F, 0x06, 0xA0, 0x20, 0x2F, 0x0B, 0x3F, 0x05, 0x90, 0x20, 0x1F, 0x0E, 0x00, 0x04, 0x3F, 0x04,
+  0x80, 0x20, 0x1F, 0x0E, 0x10, 0x04, 0x3F, 0x03, 0x70, 0x20, 0x1F, 0x0E, 0x20, 0x03, 0x2F, 0x0E, 0x02, 0x60, 0x20, 0x1F,
+  0x0E, 0x30, 0x03, 0x2F, 0x0E, 0x02, 0x50, 0x20, 0x1F, 0x0E, 0x40, 0x04, 0x2F, 0x0D, 0x01, 0x40, 0x20, 0x1F, 0x0E, 0x50,
+  0x05, 0x2F, 0x0C, 0x01, 0x30, 0x20, 0x1F, 0x0E, 0x60, 0x08, 0x2F, 0x0C, 0x01, 0x20, 0x10, 0x02, 0x2F, 0x70, 0x0D, 0x2F,
+  0x0C, 0x01, 0x10, 0x00, 0x01, 0x09, 0x2F, 0x07, 0x60, 0x0A, 0x3F, 0x0D, 0x03, 0x00, 0x0D, 0x6F, 0x0C, 0x20, 0x0C, 0x8F,
+  0x0B, 0x6F, 0x0C, 0x90, 0x00, 0x01, 0x0A, 0x2F, 0x08, 0x01, 0xA0, 0x10, 0x02, 0x2F, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20,
+  0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20,
+  0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20,
+  0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xC0, 0x20, 0x1F, 0x0E, 0xA0, 0x02, 0x04, 0x20, 0x1F, 0x0E, 0xA0, 0x0A, 0x05, 0x20,
+  0x1F, 0x0E, 0x90, 0x03, 0x0F, 0x01, 0x10, 0x01, 0x1F, 0x0E, 0x80, 0x02, 0x0E, 0x0C, 0x00, 0x10, 0x05, 0x2F, 0x02, 0x40,
+  0x01, 0x04, 0x09, 0x1F, 0x08, 0x00, 0x06, 0x0A, 0xEF, 0x03, 0x00, 0x03, 0x5F, 0x02, 0xC0, 0x07, 0x4F, 0x0B, 0x10, 0x01,
+  0x0B, 0x2F, 0x0A, 0xC0, 0x0E, 0x2F, 0x09, 0x01, 0x00, 0x20, 0x04, 0x3F, 0x01, 0xA0, 0x05, 0x3F, 0x02, 0x10, 0x20, 0x03,
+  0x3F, 0x08, 0xA0, 0x0B, 0x3F, 0x20, 0x20, 0x03, 0x0F, 0x0C, 0x2F, 0x01, 0x80, 0x02, 0x0F, 0x08, 0x0E, 0x1F, 0x20, 0x20,
+  0x03, 0x0F, 0x05, 0x2F, 0x07, 0x80, 0x09, 0x0F, 0x02, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x00, 0x0D, 0x1F, 0x0E, 0x70,
+  0x01, 0x0F, 0x0A, 0x00, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x00, 0x06, 0x2F, 0x05, 0x60, 0x07, 0x0F, 0x03, 0x00, 0x0E,
+  0x1F, 0x20, 0x20, 0x03, 0x0F, 0x10, 0x0E, 0x1F, 0x0C, 0x60, 0x0E, 0x0C, 0x10, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x10,
+  0x07, 0x2F, 0x03, 0x40, 0x05, 0x0F, 0x05, 0x10, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x10, 0x01, 0x2F, 0x0B, 0x40, 0x0C,
+  0x0D, 0x20, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x20, 0x09, 0x2F, 0x02, 0x20, 0x03, 0x0F, 0x06, 0x20, 0x0E, 0x1F, 0x20,
+  0x20, 0x03, 0x0F, 0x20, 0x02, 0x2F, 0x09, 0x20, 0x0A, 0x0F, 0x01, 0x20, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x30, 0x0A,
+  0x2F, 0x01, 0x00, 0x01, 0x0F, 0x08, 0x30, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x30, 0x03, 0x2F, 0x08, 0x00, 0x07, 0x0F,
+  0x01, 0x30, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x40, 0x0C, 0x1F, 0x0E, 0x01, 0x0E, 0x0A, 0x40, 0x0E, 0x1F, 0x20, 0x20,
+  0x03, 0x0F, 0x40, 0x04, 0x2F, 0x0B, 0x0F, 0x03, 0x40, 0x0E, 0x1F, 0x20, 0x20, 0x03, 0x0F, 0x50, 0x0D, 0x2F, 0x0B, 0x50,
+  0x0E, 0x1F, 0x20, 0x20, 0x04, 0x0F, 0x01, 0x40, 0x06, 0x2F, 0x04, 0x50, 0x0E, 0x1F, 0x20, 0x20, 0x06, 0x0F, 0x03, 0x50,
+  0x0E, 0x0F, 0x0D, 0x60, 0x2F, 0x01, 0x10, 0x20, 0x0C, 0x0F, 0x0A, 0x50, 0x07, 0x0F, 0x06, 0x50, 0x05, 0x2F, 0x07, 0x10,
+  0x03, 0x0B, 0x3F, 0x0E, 0x0B, 0x01, 0x20, 0x01, 0x0D, 0x40, 0x09, 0x0C, 0x4F, 0x0D, 0x08, 0x04, 0x4F, 0x06, 0x70, 0x06,
+  0x6F, 0x10, 0x06, 0x3F, 0x03, 0x70, 0x01, 0x05, 0x1F, 0x0E, 0x04, 0x00, 0x20, 0x06, 0x2F, 0x0E, 0x02, 0x80, 0x08, 0x0F,
+  0x04, 0x10, 0x20, 0x03, 0x3F, 0x0C, 0x80, 0x04, 0x0F, 0x01, 0x10, 0x20, 0x03, 0x0F, 0x0D, 0x2F, 0x0A, 0x70, 0x03, 0x0F,
+  0x20, 0x20, 0x03, 0x0F, 0x02, 0x0E, 0x2F, 0x07, 0x60, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x00, 0x04, 0x3F, 0x04, 0x50,
+  0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x10, 0x06, 0x3F, 0x02, 0x40, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x20, 0x09, 0x2F,
+  0x0D, 0x40, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x30, 0x0C, 0x2F, 0x0A, 0x30, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x30,
+  0x01, 0x0E, 0x2F, 0x07, 0x20, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x40, 0x02, 0x3F, 0x04, 0x10, 0x03, 0x0F, 0x20, 0x20,
+  0x03, 0x0F, 0x50, 0x05, 0x3F, 0x02, 0x00, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x60, 0x07, 0x2F, 0x0D, 0x01, 0x03, 0x0F,
+  0x20, 0x20, 0x03, 0x0F, 0x70, 0x0A, 0x2F, 0x0A, 0x03, 0x0F, 0x20, 0x20, 0x03, 0x0F, 0x80, 0x0C, 0x2F, 0x0A, 0x0F, 0x20,
+  0x20, 0x03, 0x0F, 0x80, 0x02, 0x0E, 0x3F, 0x20, 0x20, 0x03, 0x0F, 0x90, 0x03, 0x3F, 0x20, 0x20, 0x04, 0x0F, 0x01, 0x90,
+  0x06, 0x2F, 0x20, 0x20, 0x07, 0x0F, 0x04, 0xA0, 0x08, 0x1F, 0x20, 0x10, 0x03, 0x0E, 0x0F, 0x0C, 0x02, 0xA0, 0x0B, 0x0F,
+  0x20, 0x04, 0x6F, 0x02, 0x80, 0x01, 0x0D, 0x20, 0x50, 0x05, 0x0A, 0x0D, 0x2F, 0x0D, 0x0A, 0x05, 0x50, 0x30, 0x04, 0x0D,
+  0x0F, 0x0D, 0x05, 0x20, 0x05, 0x0D, 0x0F, 0x0D, 0x04, 0x30, 0x20, 0x07, 0x1F, 0x0A, 0x60, 0x0B, 0x1F, 0x07, 0x20, 0x10,
+  0x06, 0x1F, 0x0D, 0x80, 0x0D, 0x1F, 0x07, 0x10, 0x00, 0x03, 0x2F, 0x05, 0x80, 0x04, 0x2F, 0x03, 0x00, 0x00, 0x0C, 0x1F,
+  0x0E, 0xA0, 0x0D, 0x1F, 0x0C, 0x00, 0x03, 0x2F, 0x09, 0xA0, 0x09, 0x2F, 0x03, 0x09, 0x2F, 0x06, 0xA0, 0x05, 0x2F, 0x08,
+  0x0C, 0x2F, 0x03, 0xA0, 0x03, 0x2F, 0x0C, 0x3F, 0x01, 0xA0, 0x01, 0x2F, 0x0E, 0x3F, 0xC0, 0x3F, 0x3F, 0xC0, 0x3F, 0x3F,
+  0x01, 0xA0, 0x01, 0x3F, 0x0C, 0x2F, 0x03, 0xA0, 0x03, 0x2F, 0x0D, 0x09, 0x2F, 0x06, 0xA0, 0x06, 0x2F, 0x09, 0x04, 0x2F,
+  0x09, 0xA0, 0x0A, 0x2F, 0x04, 0x00, 0x0C, 0x1F, 0x0E, 0xA0, 0x2F, 0x0D, 0x00, 0x00, 0x03, 0x2F, 0x05, 0x80, 0x05, 0x2F,
+  0x04, 0x00, 0x10, 0x07, 0x1F, 0x0D, 0x80, 0x0D, 0x1F, 0x07, 0x10, 0x20, 0x07, 0x1F, 0x09, 0x60, 0x0A, 0x1F, 0x07, 0x20,
+  0x30, 0x04, 0x0D, 0x0F, 0x0C, 0x04, 0x20, 0x05, 0x0D, 0x0F, 0x0D, 0x04, 0x30, 0x50, 0x05, 0x0A, 0x0E, 0x2F, 0x0D, 0x0A,
+  0x04, 0x50, 0x06, 0x0B, 0x7F, 0x0E, 0x0B, 0x07, 0x01, 0x20, 0x10, 0x05, 0x2F, 0x01, 0x10, 0x02, 0x05, 0x0B, 0x1F, 0x09,
+  0x01, 0x00, 0x10, 0x01, 0x1F, 0x0E, 0x50, 0x06, 0x1F, 0x0B, 0x00, 0x20, 0x1F, 0x0E, 0x60, 0x09, 0x1F, 0x06, 0x20, 0x1F,
+  0x0E, 0x60, 0x03, 0x1F, 0x0C, 0x20, 0x1F, 0x0E, 0x60, 0x01, 0x1F, 0x0E, 0x20, 0x1F, 0x0E, 0x60, 0x01, 0x1F, 0x0D, 0x20,
+  0x1F, 0x0E, 0x60, 0x03, 0x1F, 0x0A, 0x20, 0x1F, 0x0E, 0x60, 0x09, 0x1F, 0x03, 0x20, 0x1F, 0x0E, 0x50, 0x05, 0x1F, 0x08,
+  0x00, 0x20, 0x1F, 0x0E, 0x20, 0x01, 0x04, 0x0A, 0x1F, 0x07, 0x10, 0x20, 0x5F, 0x0E, 0x0D, 0x0A, 0x06, 0x01, 0x20, 0x20,
+  0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20,
+  0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x10, 0x02, 0x2F, 0x01, 0x90, 0x00, 0x01, 0x09, 0x2F, 0x09, 0x01, 0x80, 0x0A,
+  0x7F, 0x03, 0x60, 0x50, 0x04, 0x09, 0x0D, 0x0E, 0x0F, 0x0E, 0x0D, 0x09, 0x04, 0x60, 0x30, 0x03, 0x0C, 0x0F, 0x0D, 0x05,
+  0x01, 0x10, 0x05, 0x0D, 0x0F, 0x0C, 0x03, 0x40, 0x20, 0x05, 0x1F, 0x0B, 0x50, 0x01, 0x0B, 0x1F, 0x05, 0x30, 0x10, 0x05,
+  0x1F, 0x0D, 0x70, 0x01, 0x0E, 0x1F, 0x05, 0x20, 0x00, 0x02, 0x2F, 0x05, 0x80, 0x05, 0x2F, 0x02, 0x10, 0x00, 0x0A, 0x1F,
+  0x0E, 0xA0, 0x0E, 0x1F, 0x0B, 0x10, 0x02, 0x2F, 0x09, 0xA0, 0x09, 0x2F, 0x02, 0x00, 0x07, 0x2F, 0x05, 0xA0, 0x05, 0x2F,
+  0x07, 0x00, 0x0B, 0x2F, 0x03, 0xA0, 0x03, 0x2F, 0x0C, 0x00, 0x0E, 0x2F, 0x01, 0xA0, 0x01, 0x2F, 0x0E, 0x00, 0x3F, 0xC0,
+  0x3F, 0x00, 0x3F, 0x01, 0xB0, 0x3F, 0x00, 0x3F, 0x01, 0xA0, 0x01, 0x3F, 0x00, 0x0E, 0x2F, 0x03, 0xA0, 0x03, 0x2F, 0x0D,
+  0x00, 0x0A, 0x2F, 0x05, 0xA0, 0x05, 0x2F, 0x09, 0x00, 0x06, 0x2F, 0x09, 0xA0, 0x09, 0x2F, 0x05, 0x00, 0x01, 0x2F, 0x0D,
+  0xA0, 0x0E, 0x1F, 0x0E, 0x10, 0x00, 0x08, 0x2F, 0x03, 0x80, 0x05, 0x2F, 0x06, 0x10, 0x10, 0x0D, 0x1F, 0x0C, 0x80, 0x0D,
+  0x1F, 0x0A, 0x20, 0x10, 0x01, 0x0D, 0x1F, 0x0B, 0x60, 0x0A, 0x1F, 0x0B, 0x30, 0x20, 0x01, 0x0B, 0x1F, 0x0D, 0x04, 0x20,
+  0x04, 0x0C, 0x1F, 0x07, 0x40, 0x40, 0x04, 0x0C, 0x2F, 0x0E, 0x1F, 0x0D, 0x08, 0x01, 0x50, 0x60, 0x05, 0x3F, 0x0D, 0x80,
+  0x70, 0x07, 0x3F, 0x0B, 0x70, 0x80, 0x08, 0x3F, 0x0B, 0x01, 0x50, 0x90, 0x05, 0x3F, 0x0D, 0x03, 0x40, 0xA0, 0x01, 0x08,
+  0x0E, 0x2F, 0x0B, 0x06, 0x02, 0x10, 0xD0, 0x04, 0x08, 0x0B, 0x0D, 0x0E, 0x1F, 0x06, 0x06, 0x0B, 0x7F, 0x0E, 0x0C, 0x08,
+  0x02, 0x60, 0x10, 0x05, 0x2F, 0x02, 0x10, 0x01, 0x04, 0x09, 0x1F, 0x0A, 0x01, 0x40, 0x10, 0x01, 0x1F, 0x0E, 0x50, 0x04,
+  0x1F, 0x0C, 0x40, 0x20, 0x1F, 0x0E, 0x60, 0x08, 0x1F, 0x06, 0x30, 0x20, 0x1F, 0x0E, 0x60, 0x03, 0x1F, 0x0B, 0x30, 0x20,
+  0x1F, 0x0E, 0x60, 0x01, 0x1F, 0x0E, 0x30, 0x20, 0x1F, 0x0E, 0x60, 0x01, 0x1F, 0x0D, 0x30, 0x20, 0x1F, 0x0E, 0x60, 0x03,
+  0x1F, 0x0B, 0x30, 0x20, 0x1F, 0x0E, 0x60, 0x09, 0x1F, 0x05, 0x30, 0x20, 0x1F, 0x0E, 0x50, 0x06, 0x1F, 0x0B, 0x40, 0x20,
+  0x1F, 0x0E, 0x10, 0x01, 0x04, 0x07, 0x0D, 0x1F, 0x08, 0x50, 0x20, 0x7F, 0x0E, 0x06, 0x01, 0x60, 0x20, 0x1F, 0x0E, 0x10,
+  0x0C, 0x2F, 0x03, 0x70, 0x20, 0x1F, 0x0E, 0x10, 0x01, 0x0E, 0x1F, 0x0E, 0x01, 0x60, 0x20, 0x1F, 0x0E, 0x20, 0x04, 0x2F,
+  0x0C, 0x60, 0x20, 0x1F, 0x0E, 0x30, 0x07, 0x2F, 0x08, 0x50, 0x20, 0x1F, 0x0E, 0x40, 0x0B, 0x2F, 0x05, 0x40, 0x20, 0x1F,
+  0x0E, 0x40, 0x01, 0x0E, 0x2F, 0x02, 0x30, 0x20, 0x1F, 0x0E, 0x50, 0x03, 0x2F, 0x0D, 0x01, 0x20, 0x10, 0x02, 0x2F, 0x60,
+  0x06, 0x2F, 0x0B, 0x20, 0x00, 0x01, 0x0A, 0x2F, 0x07, 0x01, 0x50, 0x09, 0x2F, 0x0A, 0x01, 0x00, 0x0A, 0x7F, 0x50, 0x0D,
+  0x3F, 0x07, 0x00, 0x03, 0xAE, 0xFE, 0xC9, 0x66, 0xC0, 0x00, 0x5F, 0xE4, 0x00, 0x3B, 0xFF, 0xE0, 0x03, 0xFF, 0x40, 0x00,
+  0x00, 0x8F, 0xF0, 0x0A, 0xFF, 0x00, 0x00, 0x00, 0x0C, 0xF1, 0x0E, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xF2, 0x0F, 0xFF, 0x50,
+  0x00, 0x00, 0x00, 0xD4, 0x0E, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x85, 0x0A, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x02, 0xFF,
+  0xFF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xE5, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0x19, 0xFF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF6,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x1F,
+  0xFF, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFD, 0x8F, 0x70, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x5F, 0xF6, 0x00, 0x00, 0x00,
+  0x8F, 0xD1, 0x3F, 0xFF, 0xA3, 0x00, 0x19, 0xFD, 0x20, 0x1F, 0x35, 0x9C, 0xEF, 0xFC, 0x60, 0x00, 0x08, 0xFF, 0x1F, 0x08,
+  0x0F, 0x0D, 0x04, 0x01, 0x20, 0x1F, 0x0E, 0x30, 0x03, 0x09, 0x1F, 0x08, 0x0F, 0x02, 0x40, 0x1F, 0x0E, 0x50, 0x0B, 0x0F,
+  0x08, 0x0A, 0x50, 0x1F, 0x0E, 0x50, 0x03, 0x0F, 0x08, 0x05, 0x50, 0x1F, 0x0E, 0x60, 0x0F, 0x02, 0x01, 0x50, 0x1F, 0x0E,
+  0x60, 0x03, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F,
+  0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F,
+  0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x70, 0x1F, 0x0E, 0x70, 0x60, 0x02, 0x2F, 0x70, 0x50, 0x01,
+  0x09, 0x2F, 0x08, 0x01, 0x50, 0x40, 0x8F, 0x03, 0x30, 0x0C, 0x6F, 0x0C, 0x40, 0x04, 0x5F, 0x0E, 0x00, 0x01, 0x09, 0x2F,
+  0x07, 0x01, 0x70, 0x03, 0x0E, 0x0F, 0x0C, 0x03, 0x00, 0x10, 0x02, 0x2F, 0xA0, 0x07, 0x0F, 0x04, 0x10, 0x20, 0x1F, 0x0E,
+  0xA0, 0x04, 0x0F, 0x01, 0x10, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20,
+  0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20,
+  0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F,
+  0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03, 0x0F, 0x20, 0x20, 0x1F, 0x0E, 0xA0, 0x03,
+  0x0F, 0x20, 0x20, 0x0E, 0x1F, 0xA0, 0x04, 0x0E, 0x20, 0x20, 0x0C, 0x1F, 0x02, 0x90, 0x07, 0x0B, 0x20, 0x20, 0x08, 0x1F,
+  0x06, 0x90, 0x0C, 0x07, 0x20, 0x20, 0x02, 0x1F, 0x0E, 0x80, 0x05, 0x0F, 0x01, 0x20, 0x30, 0x07, 0x1F, 0x0B, 0x01, 0x40,
+  0x01, 0x07, 0x0F, 0x06, 0x30, 0x40, 0x08, 0x2F, 0x0B, 0x08, 0x07, 0x08, 0x0B, 0x1F, 0x07, 0x40, 0x50, 0x02, 0x08, 0x0C,
+  0x3F, 0x0C, 0x08, 0x02, 0x50, 0x02, 0x7F, 0x06, 0x50, 0x0C, 0x4F, 0x0B, 0x10, 0x06, 0x3F, 0x03, 0x80, 0x01, 0x0C, 0x0F,
+  0x0E, 0x02, 0x00, 0x20, 0x09, 0x2F, 0x02, 0x90, 0x09, 0x0F, 0x06, 0x10, 0x20, 0x01, 0x2F, 0x08, 0x90, 0x0C, 0x0E, 0x20,
+  0x30, 0x09, 0x1F, 0x0E, 0x80, 0x02, 0x0F, 0x08, 0x20, 0x30, 0x02, 0x2F, 0x05, 0x70, 0x08, 0x0F, 0x02, 0x20, 0x40, 0x0B,
+  0x1F, 0x0C, 0x70, 0x0E, 0x0C, 0x30, 0x40, 0x04, 0x2F, 0x04, 0x50, 0x04, 0x0F, 0x06, 0x30, 0x50, 0x0D, 0x1F, 0x0B, 0x50,
+  0x0B, 0x0F, 0x40, 0x50, 0x06, 0x2F, 0x02, 0x30, 0x01, 0x0F, 0x09, 0x40, 0x60, 0x0E, 0x1F, 0x09, 0x30, 0x08, 0x0F, 0x03,
+  0x40, 0x60, 0x08, 0x2F, 0x01, 0x20, 0x0E, 0x0C, 0x50, 0x60, 0x01, 0x2F, 0x07, 0x10, 0x04, 0x0F, 0x06, 0x50, 0x70, 0x0A,
+  0x1F, 0x0E, 0x10, 0x0B, 0x0F, 0x01, 0x50, 0x70, 0x03, 0x2F, 0x05, 0x01, 0x0F, 0x0A, 0x60, 0x80, 0x0B, 0x1F, 0x0C, 0x07,
+  0x0F, 0x03, 0x60, 0x80, 0x04, 0x3F, 0x0D, 0x70, 0x90, 0x0D, 0x2F, 0x07, 0x70, 0x90, 0x06, 0x2F, 0x01, 0x70, 0xA0, 0x1F,
+  0x0A, 0x80, 0xA0, 0x08, 0x0F, 0x04, 0x80, 0xA0, 0x01, 0x0D, 0x90, 0x0C, 0x6F, 0x01, 0x00, 0x7F, 0x08, 0x30, 0x04, 0x5F,
+  0x02, 0x00, 0x05, 0x3F, 0x03, 0x30, 0x03, 0x0E, 0x2F, 0x05, 0x70, 0x07, 0x1F, 0x08, 0x01, 0x00, 0x10, 0x06, 0x2F, 0x02,
+  0x40, 0x06, 0x2F, 0x02, 0x70, 0x01, 0x0F, 0x0B, 0x20, 0x20, 0x2F, 0x07, 0x50, 0x2F, 0x07, 0x70, 0x03, 0x0F, 0x04, 0x20,
+  0x20, 0x09, 0x1F, 0x0C, 0x50, 0x09, 0x1F, 0x0E, 0x70, 0x08, 0x0E, 0x30, 0x20, 0x03, 0x2F, 0x02, 0x40, 0x02, 0x2F, 0x04,
+  0x60, 0x0E, 0x08, 0x30, 0x30, 0x0D, 0x1F, 0x08, 0x50, 0x0E, 0x1F, 0x0A, 0x50, 0x04, 0x0F, 0x02, 0x30, 0x30, 0x08, 0x1F,
+  0x0E, 0x40, 0x03, 0x3F, 0x01, 0x40, 0x0A, 0x0C, 0x40, 0x30, 0x02, 0x2F, 0x04, 0x30, 0x08, 0x0E, 0x2F, 0x07, 0x30, 0x01,
+  0x0F, 0x06, 0x40, 0x40, 0x0D, 0x1F, 0x0A, 0x30, 0x0E, 0x19, 0x1F, 0x0E, 0x30, 0x06, 0x0F, 0x01, 0x40, 0x40, 0x07, 0x2F,
+  0x01, 0x10, 0x04, 0x0F, 0x13, 0x2F, 0x04, 0x20, 0x0C, 0x0B, 0x50, 0x40, 0x01, 0x2F, 0x06, 0x10, 0x0A, 0x0D, 0x10, 0x0D,
+  0x1F, 0x0A, 0x10, 0x02, 0x0F, 0x05, 0x50, 0x50, 0x0C, 0x1F, 0x0C, 0x00, 0x01, 0x0F, 0x08, 0x10, 0x07, 0x2F, 0x01, 0x00,
+  0x08, 0x0F, 0x60, 0x50, 0x06, 0x2F, 0x02, 0x06, 0x0F, 0x02, 0x10, 0x01, 0x2F, 0x07, 0x00, 0x0E, 0x09, 0x60, 0x50, 0x01,
+  0x2F, 0x08, 0x1C, 0x30, 0x0B, 0x1F, 0x0D, 0x04, 0x0F, 0x04, 0x60, 0x60, 0x0B, 0x1F, 0x0E, 0x0F, 0x07, 0x30, 0x04, 0x2F,
+  0x0D, 0x0E, 0x70, 0x60, 0x05, 0x3F, 0x01, 0x40, 0x0E, 0x2F, 0x09, 0x70, 0x70, 0x2F, 0x0B, 0x50, 0x08, 0x2F, 0x04, 0x70,
+  0x70, 0x0A, 0x1F, 0x06, 0x50, 0x02, 0x1F, 0x0E, 0x80, 0x70, 0x04, 0x1F, 0x01, 0x60, 0x0C, 0x0F, 0x09, 0x80, 0x80, 0x0E,
+  0x0A, 0x70, 0x06, 0x0F, 0x04, 0x80, 0x80, 0x09, 0x05, 0x80, 0x0D, 0x90, 0x0A, 0x7F, 0x0D, 0x30, 0x0C, 0x5F, 0x0D, 0x00,
+  0x00, 0x01, 0x08, 0x3F, 0x0A, 0x70, 0x0B, 0x1F, 0x07, 0x01, 0x10, 0x20, 0x07, 0x2F, 0x0B, 0x70, 0x0B, 0x0F, 0x05, 0x30,
+  0x30, 0x0A, 0x2F, 0x03, 0x50, 0x05, 0x0F, 0x06, 0x40, 0x30, 0x01, 0x0E, 0x1F, 0x0C, 0x40, 0x03, 0x0F, 0x09, 0x50, 0x40,
+  0x04, 0x2F, 0x06, 0x20, 0x01, 0x0E, 0x0C, 0x60, 0x50, 0x09, 0x2F, 0x02, 0x10, 0x0C, 0x0E, 0x01, 0x60, 0x50, 0x01, 0x0E,
+  0x1F, 0x0C, 0x00, 0x09, 0x0F, 0x03, 0x70, 0x60, 0x04, 0x2F, 0x0C, 0x0F, 0x06, 0x80, 0x70, 0x09, 0x2F, 0x0A, 0x90, 0x70,
+  0x01, 0x0E, 0x1F, 0x0D, 0x90, 0x80, 0x0C, 0x2F, 0x08, 0x80, 0x70, 0x09, 0x0F, 0x0C, 0x2F, 0x04, 0x70, 0x60, 0x05, 0x0F,
+  0x08, 0x01, 0x0E, 0x1F, 0x0E, 0x01, 0x60, 0x50, 0x03, 0x0F, 0x0C, 0x10, 0x04, 0x2F, 0x0A, 0x60, 0x40, 0x01, 0x1E, 0x01,
+  0x20, 0x09, 0x2F, 0x05, 0x50, 0x40, 0x0B, 0x0F, 0x04, 0x30, 0x01, 0x0E, 0x2F, 0x01, 0x40, 0x30, 0x08, 0x0F, 0x07, 0x50,
+  0x04, 0x2F, 0x0B, 0x40, 0x20, 0x05, 0x0F, 0x0C, 0x70, 0x0B, 0x2F, 0x06, 0x30, 0x10, 0x03, 0x1F, 0x03, 0x70, 0x03, 0x3F,
+  0x03, 0x20, 0x00, 0x04, 0x2F, 0x04, 0x70, 0x04, 0x3F, 0x0E, 0x05, 0x10, 0x6F, 0x05, 0x30, 0x06, 0x8F, 0x02, 0x03, 0x7F,
+  0x09, 0x40, 0x0C, 0x5F, 0x04, 0x00, 0x01, 0x08, 0x3F, 0x0B, 0x70, 0x01, 0x0B, 0x1F, 0x07, 0x01, 0x00, 0x20, 0x09, 0x2F,
+  0x0B, 0x80, 0x0B, 0x0F, 0x05, 0x20, 0x30, 0x0D, 0x2F, 0x03, 0x60, 0x03, 0x0F, 0x08, 0x30, 0x30, 0x02, 0x2F, 0x0C, 0x60,
+  0x1D, 0x40, 0x40, 0x07, 0x2F, 0x06, 0x40, 0x08, 0x0F, 0x03, 0x40, 0x50, 0x0C, 0x1F, 0x0E, 0x01, 0x20, 0x03, 0x0F, 0x08,
+  0x50, 0x50, 0x02, 0x2F, 0x08, 0x20, 0x0C, 0x0D, 0x60, 0x60, 0x07, 0x2F, 0x02, 0x00, 0x07, 0x0F, 0x03, 0x60, 0x70, 0x0D,
+  0x1F, 0x0B, 0x02, 0x0F, 0x08, 0x70, 0x70, 0x03, 0x2F, 0x0E, 0x0D, 0x80, 0x80, 0x08, 0x2F, 0x03, 0x80, 0x90, 0x1F, 0x0E,
+  0x90, 0x90, 0x1F, 0x0E, 0x90, 0x90, 0x1F, 0x0E, 0x90, 0x90, 0x1F, 0x0E, 0x90, 0x90, 0x1F, 0x0E, 0x90, 0x90, 0x1F, 0x0E,
+  0x90, 0x90, 0x1F, 0x0E, 0x90, 0x80, 0x02, 0x2F, 0x90, 0x70, 0x01, 0x09, 0x2F, 0x08, 0x01, 0x70, 0x50, 0x01, 0x8F, 0x05,
+  0x50, 0x00, 0x0C, 0xEF, 0x0E, 0x00, 0x00, 0x0E, 0x0F, 0x09, 0x03, 0x70, 0x09, 0x2F, 0x04, 0x00, 0x00, 0x0F, 0x08, 0x80,
+  0x04, 0x2F, 0x09, 0x10, 0x01, 0x0F, 0x01, 0x70, 0x01, 0x0E, 0x1F, 0x0E, 0x01, 0x10, 0x03, 0x0B, 0x80, 0x09, 0x2F, 0x04,
+  0x20, 0x02, 0x04, 0x70, 0x04, 0x2F, 0x0A, 0x30, 0x80, 0x01, 0x0E, 0x1F, 0x0E, 0x01, 0x30, 0x80, 0x09, 0x2F, 0x05, 0x40,
+  0x70, 0x04, 0x2F, 0x0A, 0x50, 0x60, 0x01, 0x0E, 0x1F, 0x0E, 0x01, 0x50, 0x60, 0x09, 0x2F, 0x05, 0x60, 0x50, 0x04, 0x2F,
+  0x0A, 0x70, 0x40, 0x01, 0x0E, 0x2F, 0x01, 0x70, 0x40, 0x09, 0x2F, 0x05, 0x80, 0x30, 0x04, 0x2F, 0x0B, 0x90, 0x20, 0x01,
+  0x0E, 0x2F, 0x01, 0x90, 0x20, 0x09, 0x2F, 0x05, 0x80, 0x02, 0x06, 0x10, 0x04, 0x2F, 0x0B, 0x90, 0x07, 0x08, 0x00, 0x01,
+  0x0E, 0x2F, 0x02, 0x90, 0x0D, 0x06, 0x00, 0x09, 0x2F, 0x06, 0x90, 0x07, 0x0F, 0x03, 0x04, 0x2F, 0x0B, 0x80, 0x03, 0x09,
+  0x1F, 0x01, 0x0E, 0xFF, 0x0F, 0x00, 0x6F, 0x03, 0x2F, 0x02, 0x30, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40,
+  0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E,
+  0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F,
+  0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40,
+  0x2F, 0x04, 0x30, 0x6F, 0x03, 0x0D, 0x0F, 0x05, 0x60, 0x08, 0x0F, 0x0A, 0x60, 0x03, 0x1F, 0x60, 0x00, 0x0D, 0x0F, 0x05,
+  0x50, 0x00, 0x08, 0x0F, 0x0A, 0x50, 0x00, 0x03, 0x1F, 0x50, 0x10, 0x0E, 0x0F, 0x05, 0x40, 0x10, 0x08, 0x0F, 0x0A, 0x40,
+  0x10, 0x03, 0x1F, 0x40, 0x20, 0x0E, 0x0F, 0x05, 0x30, 0x20, 0x08, 0x0F, 0x0A, 0x30, 0x20, 0x03, 0x1F, 0x30, 0x30, 0x0E,
+  0x0F, 0x05, 0x20, 0x30, 0x08, 0x0F, 0x0A, 0x20, 0x30, 0x03, 0x1F, 0x20, 0x40, 0x0E, 0x0F, 0x05, 0x10, 0x40, 0x08, 0x0F,
+  0x0A, 0x10, 0x40, 0x03, 0x1F, 0x10, 0x50, 0x0E, 0x0F, 0x05, 0x00, 0x50, 0x09, 0x0F, 0x0A, 0x00, 0x50, 0x03, 0x1F, 0x00,
+  0x60, 0x0E, 0x0F, 0x05, 0x05, 0x5F, 0x0E, 0x30, 0x06, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E,
+  0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F,
+  0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40,
+  0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E, 0x40, 0x1F, 0x0E,
+  0x30, 0x05, 0x1F, 0x0E, 0x05, 0x5F, 0x0D, 0x00, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x2F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xAF,
+  0x90, 0x8F, 0xA0, 0x00, 0x00, 0x00, 0x2F, 0xF2, 0x01, 0xFF, 0x20, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x09, 0xFA, 0x00, 0x00,
+  0x02, 0xFF, 0x20, 0x00, 0x2F, 0xF2, 0x00, 0x00, 0x9F, 0xA0, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x1F, 0xF2, 0x00, 0x00, 0x02,
+  0xFF, 0x20, 0x08, 0xFB, 0x00, 0x00, 0x00, 0x0A, 0xF9, 0x01, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x3F, 0xF1, 0xFE, 0xFF, 0xDE,
+  0x40, 0x00, 0x0E, 0xFF, 0x40, 0x00, 0x2C, 0xFF, 0x40, 0x00, 0x06, 0xFF, 0x40, 0x00, 0x01, 0xAF, 0x30, 0x00, 0x00, 0x47,
+  0x00, 0x5B, 0xEE, 0xFE, 0x92, 0x00, 0x00, 0x1B, 0xF9, 0x10, 0x1B, 0xFE, 0x10, 0x00, 0x9F, 0xF0, 0x00, 0x02, 0xFF, 0x70,
+  0x00, 0xDF, 0xF0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x7F, 0x90, 0x00, 0x00, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x16, 0xFF,
+  0xE0, 0x00, 0x00, 0x00, 0x3A, 0xC6, 0xFF, 0xE0, 0x00, 0x00, 0x3C, 0xD4, 0x00, 0xFF, 0xE0, 0x00, 0x07, 0xFC, 0x10, 0x00,
+  0xFF, 0xE0, 0x00, 0x5F, 0xF2, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xDF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xF0, 0x00,
+  0x02, 0xFF, 0xE0, 0x00, 0xEF, 0xF9, 0x00, 0x4C, 0xFF, 0xF1, 0x11, 0x7F, 0xFF, 0xFF, 0xD2, 0xDF, 0xFF, 0xE2, 0x07, 0xEF,
+  0xD6, 0x00, 0x4E, 0xFC, 0x20, 0x30, 0x01, 0x05, 0x90, 0x00, 0x03, 0x07, 0x0B, 0x0F, 0x0E, 0x90, 0x01, 0x08, 0x0C, 0x1F,
+  0x0E, 0x90, 0x10, 0x01, 0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E, 0x90, 0x20,
+  0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E, 0x00, 0x03, 0x0B, 0x1F, 0x0D, 0x07, 0x20, 0x20, 0x1F, 0x0E, 0x05, 0x5F, 0x0C, 0x01,
+  0x00, 0x20, 0x2F, 0x0E, 0x06, 0x12, 0x07, 0x2F, 0x0A, 0x00, 0x20, 0x2F, 0x03, 0x30, 0x05, 0x2F, 0x03, 0x20, 0x1F, 0x0E,
+  0x50, 0x0C, 0x1F, 0x09, 0x20, 0x1F, 0x0E, 0x50, 0x06, 0x1F, 0x0C, 0x20, 0x1F, 0x0E, 0x50, 0x03, 0x1F, 0x0D, 0x20, 0x1F,
+  0x0E, 0x50, 0x01, 0x1F, 0x0E, 0x20, 0x1F, 0x0E, 0x60, 0x1F, 0x0C, 0x20, 0x1F, 0x0E, 0x50, 0x01, 0x1F, 0x08, 0x20, 0x1F,
+  0x0E, 0x50, 0x03, 0x1F, 0x02, 0x20, 0x1F, 0x0E, 0x50, 0x08, 0x0F, 0x09, 0x00, 0x20, 0x1F, 0x0E, 0x40, 0x02, 0x0F, 0x0D,
+  0x01, 0x00, 0x20, 0x0A, 0x1F, 0x09, 0x02, 0x10, 0x04, 0x0D, 0x0B, 0x01, 0x10, 0x30, 0x04, 0x0A, 0x0D, 0x1F, 0x0E, 0x0B,
+  0x05, 0x30, 0x20, 0x01, 0x08, 0x0D, 0x1F, 0x0D, 0x09, 0x01, 0x10, 0x10, 0x04, 0x1E, 0x04, 0x10, 0x09, 0x1F, 0x03, 0x00,
+  0x00, 0x04, 0x1F, 0x02, 0x20, 0x02, 0x1F, 0x0D, 0x00, 0x00, 0x0E, 0x0F, 0x07, 0x40, 0x0D, 0x1F, 0x00, 0x06, 0x1F, 0x02,
+  0x40, 0x03, 0x0A, 0x04, 0x00, 0x0B, 0x1F, 0x90, 0x1F, 0x0E, 0x90, 0x2F, 0x90, 0x2F, 0x01, 0x80, 0x0E, 0x1F, 0x06, 0x80,
+  0x0A, 0x1F, 0x0D, 0x60, 0x08, 0x04, 0x04, 0x2F, 0x0A, 0x40, 0x06, 0x0A, 0x00, 0x00, 0x0A, 0x2F, 0x0C, 0x05, 0x03, 0x04,
+  0x0A, 0x0D, 0x01, 0x00, 0x00, 0x01, 0x0C, 0x5F, 0x0D, 0x02, 0x10, 0x20, 0x06, 0x0C, 0x1F, 0x0D, 0x07, 0x30, 0xA0, 0x01,
+  0x05, 0x10, 0x70, 0x03, 0x07, 0x0C, 0x0F, 0x0E, 0x10, 0x60, 0x01, 0x08, 0x0C, 0x1F, 0x0E, 0x10, 0x80, 0x01, 0x1F, 0x0E,
+  0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x20, 0x02, 0x09,
+  0x0E, 0x0F, 0x0E, 0x09, 0x01, 0x1F, 0x0E, 0x10, 0x10, 0x04, 0x0F, 0x0D, 0x03, 0x00, 0x01, 0x08, 0x0E, 0x1F, 0x0E, 0x10,
+  0x00, 0x03, 0x0F, 0x0E, 0x01, 0x30, 0x08, 0x1F, 0x0E, 0x10, 0x00, 0x0D, 0x0F, 0x07, 0x40, 0x01, 0x1F, 0x0E, 0x10, 0x05,
+  0x1F, 0x02, 0x50, 0x1F, 0x0E, 0x10, 0x0A, 0x1F, 0x60, 0x1F, 0x0E, 0x10, 0x0E, 0x0F, 0x0E, 0x60, 0x1F, 0x0E, 0x10, 0x2F,
+  0x60, 0x1F, 0x0E, 0x10, 0x2F, 0x60, 0x1F, 0x0E, 0x10, 0x0E, 0x1F, 0x03, 0x50, 0x1F, 0x0E, 0x10, 0x0B, 0x1F, 0x09, 0x50,
+  0x1F, 0x0E, 0x10, 0x05, 0x2F, 0x03, 0x30, 0x01, 0x2F, 0x10, 0x00, 0x0D, 0x1F, 0x0E, 0x05, 0x10, 0x02, 0x0C, 0x2F, 0x08,
+  0x05, 0x00, 0x02, 0x0E, 0x3F, 0x0E, 0x0F, 0x06, 0x2F, 0x0C, 0x06, 0x10, 0x01, 0x08, 0x0D, 0x1F, 0x0C, 0x04, 0x00, 0x0D,
+  0x08, 0x02, 0x10, 0x20, 0x02, 0x09, 0x0D, 0x1F, 0x0D, 0x08, 0x01, 0x20, 0x10, 0x06, 0x0F, 0x08, 0x01, 0x00, 0x02, 0x0D,
+  0x0F, 0x0D, 0x01, 0x10, 0x00, 0x05, 0x0F, 0x0B, 0x30, 0x03, 0x1F, 0x0A, 0x10, 0x01, 0x1F, 0x04, 0x40, 0x0E, 0x1F, 0x02,
+  0x00, 0x07, 0x1F, 0x50, 0x0B, 0x1F, 0x07, 0x00, 0x0C, 0xAF, 0x09, 0x00, 0x0E, 0x0F, 0x0E, 0xA0, 0x2F, 0xA0, 0x2F, 0x02,
+  0x90, 0x0E, 0x1F, 0x06, 0x70, 0x03, 0x01, 0x0A, 0x1F, 0x0D, 0x60, 0x01, 0x0C, 0x01, 0x04, 0x2F, 0x09, 0x40, 0x01, 0x0C,
+  0x06, 0x00, 0x00, 0x0B, 0x2F, 0x0D, 0x06, 0x13, 0x07, 0x0E, 0x0A, 0x10, 0x00, 0x01, 0x0C, 0x6F, 0x09, 0x20, 0x20, 0x07,
+  0x0C, 0x1F, 0x0E, 0x0A, 0x03, 0x30, 0x40, 0x02, 0x0A, 0x0D, 0x1F, 0x0D, 0x07, 0x00, 0x30, 0x04, 0x0F, 0x09, 0x00, 0x01,
+  0x0C, 0x1F, 0x06, 0x20, 0x01, 0x0E, 0x0F, 0x02, 0x10, 0x02, 0x0E, 0x0F, 0x04, 0x20, 0x06, 0x1F, 0x40, 0x01, 0x00, 0x20,
+  0x0A, 0x1F, 0x60, 0x20, 0x0D, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x00, 0x8F, 0x20, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E,
+  0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E,
+  0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x0E, 0x1F, 0x60, 0x20, 0x2F,
+  0x02, 0x50, 0x10, 0x05, 0x2F, 0x09, 0x01, 0x40, 0x01, 0x7F, 0x01, 0x20, 0x00, 0x03, 0xAE, 0xFE, 0xB6, 0x10, 0x00, 0x00,
+  0x5F, 0xB1, 0x07, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0x20, 0x00, 0xBF, 0xF8, 0x00, 0x0A, 0xFF, 0x00, 0x00, 0x5F, 0xFD, 0x00,
+  0x0E, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0x00, 0x0E, 0xFF, 0x10, 0x00, 0x0F, 0xFF, 0x00, 0x0C, 0xFF, 0x50, 0x00, 0x0E, 0xFC,
+  0x00, 0x05, 0xFF, 0xB0, 0x00, 0x2F, 0xF4, 0x00, 0x00, 0x6F, 0xF9, 0x11, 0xBF, 0x80, 0x00, 0x00, 0x03, 0xFD, 0xFE, 0xB4,
+  0x00, 0x00, 0x00, 0x2B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xF8, 0x33, 0x33,
+  0x32, 0x20, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x9D, 0xCE, 0xFF, 0xFF, 0xFF, 0xF7, 0x04, 0xE2, 0x00,
+  0x00, 0x00, 0x14, 0xBE, 0x3F, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x70,
+  0x00, 0x00, 0x00, 0x01, 0xC6, 0xDF, 0xF9, 0x20, 0x00, 0x02, 0x7E, 0x80, 0x3E, 0xFF, 0xFF, 0xEE, 0xFF, 0xD4, 0x00, 0x01,
+  0x7C, 0xFF, 0xFD, 0xA4, 0x00, 0x00, 0x20, 0x01, 0x04, 0x90, 0x02, 0x06, 0x0B, 0x0F, 0x0E, 0x90, 0x08, 0x0C, 0x1F, 0x0E,
+  0x90, 0x00, 0x01, 0x1F, 0x0E, 0x90, 0x10, 0x1F, 0x0E, 0x90, 0x10, 0x1F, 0x0E, 0x90, 0x10, 0x1F, 0x0E, 0x90, 0x10, 0x1F,
+  0x0E, 0x90, 0x10, 0x1F, 0x0E, 0x00, 0x02, 0x0A, 0x1F, 0x0D, 0x04, 0x20, 0x10, 0x1F, 0x0E, 0x03, 0x5F, 0x03, 0x10, 0x10,
+  0x2F, 0x0D, 0x05, 0x10, 0x0A, 0x1F, 0x0A, 0x10, 0x10, 0x2F, 0x04, 0x20, 0x02, 0x1F, 0x0E, 0x10, 0x10, 0x1F, 0x0E, 0x40,
+  0x2F, 0x10, 0x10, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E, 0x40,
+  0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E,
+  0x40, 0x0E, 0x1F, 0x10, 0x10, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x10, 0x00, 0x01, 0x1F, 0x0E, 0x40, 0x2F, 0x10, 0x00, 0x03,
+  0x2F, 0x01, 0x20, 0x02, 0x2F, 0x03, 0x00, 0x0A, 0x3F, 0x0E, 0x07, 0x00, 0x07, 0x0E, 0x3F, 0x09, 0x10, 0x08, 0x0F, 0x08,
+  0x20, 0x10, 0x2F, 0x20, 0x10, 0x09, 0x0F, 0x08, 0x20, 0x70, 0x70, 0x70, 0x70, 0x10, 0x03, 0x09, 0x0F, 0x20, 0x07, 0x0D,
+  0x2F, 0x20, 0x01, 0x03, 0x2F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E,
+  0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E, 0x1F, 0x20, 0x10, 0x0E,
+  0x1F, 0x20, 0x10, 0x2F, 0x01, 0x10, 0x00, 0x04, 0x2F, 0x07, 0x10, 0x6F, 0x05, 0x40, 0x08, 0x0F, 0x08, 0x40, 0x2F, 0x40,
+  0x09, 0x0F, 0x08, 0x70, 0x70, 0x70, 0x70, 0x40, 0x02, 0x09, 0x0F, 0x20, 0x06, 0x0D, 0x2F, 0x20, 0x03, 0x04, 0x2F, 0x40,
+  0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F,
+  0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E, 0x1F, 0x40, 0x0E,
+  0x0F, 0x0E, 0x40, 0x0E, 0x0F, 0x0C, 0x40, 0x1F, 0x08, 0x0C, 0x0E, 0x03, 0x00, 0x01, 0x1F, 0x02, 0x0E, 0x0F, 0x0E, 0x04,
+  0x08, 0x0F, 0x06, 0x00, 0x04, 0x0C, 0x1F, 0x0C, 0x04, 0x10, 0x30, 0x01, 0x04, 0xA0, 0x00, 0x03, 0x07, 0x0C, 0x0F, 0x0E,
+  0xA0, 0x04, 0x08, 0x0C, 0x1F, 0x0E, 0xA0, 0x10, 0x02, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0,
+  0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0xA0, 0x20, 0x1F, 0x0E, 0x20, 0x09, 0x4F, 0x0E, 0x00, 0x20, 0x1F, 0x0E, 0x30,
+  0x02, 0x1F, 0x07, 0x01, 0x10, 0x20, 0x1F, 0x0E, 0x30, 0x1B, 0x01, 0x30, 0x20, 0x1F, 0x0E, 0x10, 0x01, 0x0C, 0x09, 0x50,
+  0x20, 0x1F, 0x0E, 0x00, 0x02, 0x0D, 0x07, 0x60, 0x20, 0x1F, 0x0E, 0x03, 0x0F, 0x06, 0x70, 0x20, 0x4F, 0x0B, 0x70, 0x20,
+  0x1F, 0x0E, 0x08, 0x1F, 0x08, 0x60, 0x20, 0x1F, 0x0E, 0x00, 0x0C, 0x1F, 0x05, 0x50, 0x20, 0x1F, 0x0E, 0x00, 0x01, 0x0E,
+  0x1F, 0x03, 0x40, 0x20, 0x1F, 0x0E, 0x10, 0x04, 0x1F, 0x0E, 0x01, 0x30, 0x20, 0x1F, 0x0E, 0x20, 0x07, 0x1F, 0x0B, 0x30,
+  0x20, 0x1F, 0x0E, 0x30, 0x0B, 0x1F, 0x09, 0x20, 0x00, 0x01, 0x07, 0x2F, 0x05, 0x20, 0x02, 0x2F, 0x0A, 0x02, 0x00, 0x06,
+  0x6F, 0x14, 0x5F, 0x0B, 0x30, 0x01, 0x04, 0x20, 0x00, 0x04, 0x08, 0x0C, 0x0F, 0x0E, 0x20, 0x05, 0x08, 0x0C, 0x1F, 0x0E,
+  0x20, 0x10, 0x02, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F,
+  0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F,
+  0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F,
+  0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x20, 0x1F, 0x0E, 0x20, 0x10, 0x01, 0x2F, 0x20, 0x10, 0x08, 0x2F, 0x04, 0x10, 0x06,
+  0x6F, 0x04, 0x20, 0x04, 0x09, 0x0D, 0x10, 0x06, 0x0D, 0x0F, 0x0D, 0x03, 0x10, 0x01, 0x08, 0x0D, 0x0F, 0x0E, 0x06, 0x30,
+  0x01, 0x0A, 0x0E, 0x1F, 0x0E, 0x01, 0x0B, 0x4F, 0x01, 0x02, 0x0D, 0x4F, 0x04, 0x20, 0x00, 0x01, 0x06, 0x2F, 0x0B, 0x05,
+  0x10, 0x09, 0x1F, 0x0A, 0x0D, 0x05, 0x10, 0x06, 0x1F, 0x0B, 0x20, 0x10, 0x01, 0x2F, 0x02, 0x20, 0x01, 0x2F, 0x04, 0x30,
+  0x2F, 0x20, 0x20, 0x1F, 0x0E, 0x40, 0x2F, 0x40, 0x0D, 0x1F, 0x01, 0x10, 0x20, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x40, 0x0C,
+  0x1F, 0x02, 0x10, 0x20, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x40, 0x0C, 0x1F, 0x02, 0x10, 0x20, 0x1F, 0x0E, 0x40, 0x0E, 0x1F,
+  0x40, 0x0C, 0x1F, 0x02, 0x10, 0x20, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x40, 0x0C, 0x1F, 0x02, 0x10, 0x20, 0x1F, 0x0E, 0x40,
+  0x0E, 0x1F, 0x40, 0x0C, 0x1F, 0x02, 0x10, 0x20, 0x1F, 0x0E, 0x40, 0x0E, 0x1F, 0x40, 0x0C, 0x1F, 0x02, 0x10, 0x20, 0x1F,
+  0x0E, 0x40, 0x0E, 0x1F, 0x40, 0x0C, 0x1F, 0x02, 0x10, 0x10, 0x01, 0x1F, 0x0E, 0x40, 0x2F, 0x01, 0x30, 0x0D, 0x1F, 0x02,
+  0x10, 0x10, 0x07, 0x2F, 0x03, 0x20, 0x03, 0x2F, 0x07, 0x20, 0x02, 0x2F, 0x07, 0x10, 0x04, 0x5F, 0x0D, 0x00, 0x0C, 0x5F,
+  0x01, 0x08, 0x4F, 0x0E, 0x04, 0x00, 0x4A, 0xD0, 0x08, 0xEF, 0xD4, 0x00, 0x09, 0xFF, 0xFE, 0x1D, 0xFF, 0xFF, 0xF3, 0x00,
+  0x04, 0xFF, 0xFC, 0x50, 0x09, 0xFF, 0xA0, 0x00, 0x0F, 0xFF, 0x30, 0x00, 0x1F, 0xFE, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x10, 0x00, 0x2F, 0xFF, 0x30, 0x9E, 0xFF, 0xFD, 0x80, 0x6E, 0xFF, 0xFE, 0x90, 0x00, 0x02,
+  0x9E, 0xEF, 0xE9, 0x20, 0x00, 0x00, 0x7F, 0xB2, 0x01, 0x8F, 0xF7, 0x00, 0x06, 0xFC, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x1F,
+  0xF4, 0x00, 0x00, 0x00, 0xEF, 0xF2, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFD,
+  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x0E,
+  0xFF, 0xCF, 0xF5, 0x00, 0x00, 0x00, 0x0F, 0xFB, 0x7F, 0xFA, 0x00, 0x00, 0x00, 0x1F, 0xF6, 0x1F, 0xFF, 0x10, 0x00, 0x00,
+  0x6F, 0xE0, 0x05, 0xFF, 0x90, 0x00, 0x01, 0xDF, 0x30, 0x00, 0x5F, 0xF9, 0x10, 0x2C, 0xF4, 0x00, 0x00, 0x02, 0x9E, 0xFF,
+  0xD8, 0x10, 0x00, 0x20, 0x03, 0x09, 0x0C, 0x00, 0x01, 0x09, 0x0E, 0x0F, 0x0E, 0x09, 0x01, 0x10, 0x01, 0x08, 0x0E, 0x1F,
+  0x0E, 0x03, 0x0E, 0x4F, 0x0E, 0x02, 0x00, 0x00, 0x03, 0x07, 0x2F, 0x0D, 0x06, 0x01, 0x00, 0x05, 0x2F, 0x0C, 0x00, 0x20,
+  0x2F, 0x02, 0x30, 0x03, 0x2F, 0x04, 0x20, 0x1F, 0x0E, 0x50, 0x0B, 0x1F, 0x09, 0x20, 0x1F, 0x0E, 0x50, 0x05, 0x1F, 0x0C,
+  0x20, 0x1F, 0x0E, 0x50, 0x02, 0x1F, 0x0E, 0x20, 0x1F, 0x0E, 0x50, 0x01, 0x1F, 0x0D, 0x20, 0x1F, 0x0E, 0x60, 0x1F, 0x0C,
+  0x20, 0x1F, 0x0E, 0x50, 0x02, 0x1F, 0x08, 0x20, 0x1F, 0x0E, 0x50, 0x05, 0x1F, 0x03, 0x20, 0x1F, 0x0E, 0x50, 0x0A, 0x0F,
+  0x0B, 0x00, 0x20, 0x2F, 0x02, 0x30, 0x03, 0x1F, 0x01, 0x00, 0x20, 0x2F, 0x0E, 0x05, 0x10, 0x04, 0x1E, 0x03, 0x10, 0x20,
+  0x1F, 0x0E, 0x04, 0x0C, 0x1F, 0x0D, 0x08, 0x01, 0x20, 0x20, 0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E, 0x90, 0x20, 0x1F, 0x0E,
+  0x90, 0x20, 0x1F, 0x0E, 0x90, 0x10, 0x01, 0x2F, 0x90, 0x10, 0x07, 0x2F, 0x05, 0x80, 0x03, 0x6F, 0x0A, 0x60, 0x20, 0x01,
+  0x08, 0x0D, 0x0F, 0x0E, 0x0C, 0x07, 0x01, 0x06, 0x0D, 0x10, 0x10, 0x03, 0x1E, 0x05, 0x10, 0x03, 0x0E, 0x1F, 0x0E, 0x10,
+  0x00, 0x02, 0x1F, 0x02, 0x30, 0x04, 0x1F, 0x0E, 0x10, 0x00, 0x0D, 0x0F, 0x08, 0x40, 0x01, 0x1F, 0x0E, 0x10, 0x05, 0x1F,
+  0x03, 0x50, 0x1F, 0x0E, 0x10, 0x0A, 0x1F, 0x60, 0x1F, 0x0E, 0x10, 0x0E, 0x0F, 0x0E, 0x60, 0x1F, 0x0E, 0x10, 0x1F, 0x0E,
+  0x60, 0x1F, 0x0E, 0x10, 0x2F, 0x60, 0x1F, 0x0E, 0x10, 0x2F, 0x03, 0x50, 0x1F, 0x0E, 0x10, 0x0C, 0x1F, 0x08, 0x50, 0x1F,
+  0x0E, 0x10, 0x07, 0x2F, 0x02, 0x30, 0x02, 0x1F, 0x0E, 0x10, 0x01, 0x0E, 0x1F, 0x0E, 0x05, 0x00, 0x01, 0x05, 0x0D, 0x1F,
+  0x0E, 0x10, 0x00, 0x04, 0x5F, 0x0E, 0x03, 0x1F, 0x0E, 0x10, 0x10, 0x03, 0x0B, 0x1F, 0x0D, 0x08, 0x01, 0x00, 0x1F, 0x0E,
+  0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x90, 0x1F, 0x0E, 0x10, 0x80, 0x01, 0x1F,
+  0x0E, 0x10, 0x80, 0x06, 0x2F, 0x01, 0x00, 0x60, 0x07, 0x0D, 0x3F, 0x0E, 0x08, 0x20, 0x04, 0x09, 0x0C, 0x00, 0x02, 0x0B,
+  0x0F, 0x0D, 0x02, 0x01, 0x09, 0x0E, 0x1F, 0x0E, 0x02, 0x0E, 0x2F, 0x07, 0x10, 0x04, 0x1F, 0x0E, 0x0B, 0x03, 0x02, 0x0C,
+  0x0F, 0x04, 0x20, 0x2F, 0x04, 0x40, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F,
+  0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x20, 0x1F, 0x0E, 0x50, 0x10, 0x01,
+  0x2F, 0x50, 0x00, 0x01, 0x08, 0x2F, 0x07, 0x40, 0x04, 0x6F, 0x09, 0x20, 0x03, 0xBF, 0xFF, 0xFF, 0x10, 0x3F, 0xA1, 0x02,
+  0xCF, 0x10, 0xCF, 0x10, 0x00, 0x1F, 0x10, 0xFF, 0x10, 0x00, 0x08, 0x10, 0xFF, 0x80, 0x00, 0x00, 0x00, 0xAF, 0xFB, 0x20,
+  0x00, 0x00, 0x1E, 0xFF, 0xF7, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xD3, 0x00, 0x00, 0x06, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x19,
+  0xFF, 0xD0, 0xA0, 0x00, 0x00, 0x8F, 0xF2, 0xF1, 0x00, 0x00, 0x1F, 0xF2, 0xF7, 0x00, 0x00, 0x2F, 0xD0, 0xFF, 0x71, 0x02,
+  0xCF, 0x30, 0xFF, 0xFF, 0xFF, 0xB2, 0x00, 0x30, 0x0A, 0x30, 0x20, 0x09, 0x0E, 0x30, 0x10, 0x07, 0x0F, 0x0E, 0x30, 0x00,
+  0x07, 0x1F, 0x0E, 0x30, 0x09, 0x6F, 0x00, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10,
+  0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10,
+  0x1F, 0x0E, 0x30, 0x10, 0x1F, 0x0E, 0x30, 0x10, 0x2F, 0x30, 0x10, 0x0D, 0x1F, 0x04, 0x00, 0x02, 0x07, 0x10, 0x08, 0x2F,
+  0x0C, 0x0D, 0x02, 0x10, 0x01, 0x0A, 0x1F, 0x0A, 0x02, 0x00, 0xFF, 0xFF, 0xE0, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0x6F, 0xFE,
+  0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00,
+  0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0xEF, 0xF0, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x0E, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0xEF, 0xF0, 0x00, 0x0F, 0xFF, 0x10, 0x00, 0x3F, 0xFF, 0x00,
+  0x00, 0xCF, 0xFA, 0x00, 0x4B, 0xFF, 0xF4, 0x00, 0x04, 0xFF, 0xFF, 0xFD, 0x1E, 0xFF, 0xE9, 0x00, 0x05, 0xDF, 0xE9, 0x10,
+  0xC8, 0x30, 0x00, 0x0C, 0x4F, 0x07, 0x20, 0x07, 0x2F, 0x0E, 0x00, 0x07, 0x2F, 0x02, 0x40, 0x03, 0x0F, 0x0C, 0x00, 0x10,
+  0x0C, 0x1F, 0x03, 0x40, 0x02, 0x0F, 0x03, 0x00, 0x10, 0x05, 0x1F, 0x09, 0x40, 0x07, 0x0C, 0x10, 0x20, 0x0E, 0x1F, 0x40,
+  0x0E, 0x06, 0x10, 0x20, 0x07, 0x1F, 0x06, 0x20, 0x04, 0x0F, 0x20, 0x20, 0x01, 0x1F, 0x0C, 0x20, 0x0A, 0x09, 0x20, 0x30,
+  0x09, 0x1F, 0x03, 0x00, 0x01, 0x0F, 0x02, 0x20, 0x30, 0x02, 0x1F, 0x09, 0x00, 0x07, 0x0C, 0x30, 0x40, 0x0C, 0x1F, 0x01,
+  0x0D, 0x05, 0x30, 0x40, 0x05, 0x1F, 0x0A, 0x0E, 0x40, 0x50, 0x0E, 0x1F, 0x08, 0x40, 0x50, 0x07, 0x1F, 0x02, 0x40, 0x50,
+  0x01, 0x0F, 0x0B, 0x50, 0x60, 0x09, 0x04, 0x50, 0x2D, 0xFF, 0xFC, 0x40, 0x5E, 0xFF, 0xFD, 0x70, 0x00, 0x8F, 0xFD, 0x02,
+  0xFF, 0xF1, 0x00, 0x01, 0xFF, 0xF1, 0x00, 0x00, 0x09, 0xF1, 0x00, 0xAF, 0xF3, 0x00, 0x00, 0x8F, 0xF3, 0x00, 0x00, 0x0B,
+  0xA0, 0x00, 0x4F, 0xF9, 0x00, 0x00, 0x2F, 0xF8, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0D, 0xFE, 0x00, 0x00, 0x0E, 0xFE, 0x00,
+  0x00, 0x6E, 0x00, 0x00, 0x07, 0xFF, 0x50, 0x00, 0x4F, 0xFF, 0x40, 0x00, 0xC7, 0x00, 0x00, 0x01, 0xFF, 0xB0, 0x00, 0xBB,
+  0xEF, 0xA0, 0x03, 0xF2, 0x00, 0x00, 0x00, 0xBF, 0xF1, 0x02, 0xF3, 0x9F, 0xF0, 0x09, 0xB0, 0x00, 0x00, 0x00, 0x5F, 0xF7,
+  0x09, 0xC0, 0x3F, 0xF5, 0x0F, 0x50, 0x00, 0x00, 0x00, 0x0E, 0xFD, 0x1F, 0x40, 0x0D, 0xFB, 0x5E, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xFF, 0xAD, 0x00, 0x07, 0xFF, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF6, 0x00, 0x01, 0xFF, 0xF2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xCF, 0xE0, 0x00, 0x00, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x5F, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x10, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x5F, 0x05, 0x04, 0x3F, 0x0C, 0x10,
+  0x10, 0x08, 0x2F, 0x02, 0x10, 0x02, 0x0F, 0x0D, 0x03, 0x20, 0x20, 0x0A, 0x1F, 0x05, 0x10, 0x06, 0x0F, 0x01, 0x30, 0x20,
+  0x01, 0x0E, 0x0F, 0x0E, 0x00, 0x02, 0x0F, 0x05, 0x40, 0x30, 0x05, 0x1F, 0x09, 0x0C, 0x0A, 0x50, 0x40, 0x0B, 0x1F, 0x0E,
+  0x01, 0x50, 0x40, 0x01, 0x1F, 0x0D, 0x60, 0x50, 0x0B, 0x1F, 0x08, 0x50, 0x40, 0x05, 0x0E, 0x0D, 0x1F, 0x03, 0x40, 0x30,
+  0x02, 0x0F, 0x05, 0x04, 0x1F, 0x0D, 0x40, 0x30, 0x1B, 0x10, 0x09, 0x1F, 0x08, 0x30, 0x20, 0x06, 0x0F, 0x02, 0x10, 0x01,
+  0x0E, 0x1F, 0x03, 0x20, 0x10, 0x02, 0x0F, 0x07, 0x30, 0x04, 0x1F, 0x0D, 0x01, 0x10, 0x00, 0x02, 0x0D, 0x0F, 0x02, 0x30,
+  0x01, 0x2F, 0x0B, 0x01, 0x00, 0x06, 0x3F, 0x03, 0x10, 0x03, 0x5F, 0x04, 0x07, 0x5F, 0x03, 0x20, 0x3F, 0x04, 0x00, 0x03,
+  0x2F, 0x03, 0x50, 0x0A, 0x0F, 0x03, 0x00, 0x10, 0x08, 0x1F, 0x03, 0x50, 0x1B, 0x10, 0x10, 0x01, 0x1F, 0x0A, 0x40, 0x01,
+  0x0F, 0x05, 0x10, 0x20, 0x09, 0x1F, 0x02, 0x30, 0x06, 0x0F, 0x20, 0x20, 0x02, 0x1F, 0x09, 0x30, 0x0B, 0x09, 0x20, 0x30,
+  0x0A, 0x1F, 0x01, 0x10, 0x01, 0x0F, 0x03, 0x20, 0x30, 0x03, 0x1F, 0x09, 0x10, 0x05, 0x0D, 0x30, 0x40, 0x0C, 0x1F, 0x01,
+  0x00, 0x0B, 0x07, 0x30, 0x40, 0x04, 0x1F, 0x08, 0x01, 0x0F, 0x01, 0x30, 0x50, 0x0D, 0x1F, 0x06, 0x0B, 0x40, 0x50, 0x05,
+  0x2F, 0x05, 0x40, 0x60, 0x0D, 0x1F, 0x50, 0x60, 0x06, 0x0F, 0x09, 0x50, 0x60, 0x01, 0x0F, 0x03, 0x50, 0x60, 0x03, 0x0D,
+  0x60, 0x60, 0x09, 0x07, 0x60, 0x50, 0x01, 0x0E, 0x01, 0x60, 0x50, 0x0A, 0x08, 0x70, 0x00, 0x09, 0x0F, 0x0D, 0x09, 0x0A,
+  0x0E, 0x01, 0x70, 0x00, 0x4F, 0x04, 0x80, 0x00, 0x05, 0x0E, 0x0F, 0x0C, 0x04, 0x90, 0x00, 0x9F, 0x0E, 0x00, 0x00, 0x0F,
+  0x05, 0x40, 0x0D, 0x1F, 0x06, 0x00, 0x00, 0x0D, 0x40, 0x08, 0x1F, 0x0C, 0x10, 0x00, 0x09, 0x30, 0x02, 0x2F, 0x02, 0x10,
+  0x50, 0x0B, 0x1F, 0x08, 0x20, 0x40, 0x06, 0x1F, 0x0D, 0x30, 0x30, 0x01, 0x0E, 0x1F, 0x04, 0x30, 0x30, 0x0A, 0x1F, 0x0A,
+  0x40, 0x20, 0x04, 0x2F, 0x01, 0x40, 0x20, 0x0D, 0x1F, 0x06, 0x50, 0x10, 0x08, 0x1F, 0x0C, 0x40, 0x01, 0x04, 0x00, 0x02,
+  0x2F, 0x02, 0x40, 0x05, 0x06, 0x00, 0x0C, 0x1F, 0x08, 0x50, 0x0A, 0x04, 0x06, 0x1F, 0x0E, 0x50, 0x07, 0x0F, 0x03, 0xBF,
+  0x01, 0x00, 0x00, 0x3A, 0xEC, 0x60, 0x00, 0x4F, 0xFB, 0x00, 0x00, 0x0C, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00,
+  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE,
+  0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFD, 0x00, 0x00, 0x02, 0xFF, 0xB0, 0x00, 0x00, 0x8F, 0xF4, 0x00, 0x02,
+  0x8F, 0xB4, 0x00, 0x00, 0x18, 0xFA, 0x30, 0x00, 0x00, 0x08, 0xFF, 0x40, 0x00, 0x00, 0x2F, 0xFB, 0x00, 0x00, 0x00, 0xFF,
+  0xD0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+  0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00, 0xCF, 0xF2, 0x00, 0x00, 0x04,
+  0xFF, 0xA0, 0x00, 0x00, 0x03, 0xAD, 0xC6, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF,
+  0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2, 0xFF, 0x2F, 0xF2,
+  0x7D, 0xD9, 0x20, 0x00, 0x00, 0x1C, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFA, 0x00, 0x00, 0x01, 0xFF, 0xD0, 0x00, 0x00, 0x0F,
+  0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00,
+  0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xDF, 0xF0, 0x00, 0x00, 0x06, 0xFF, 0x60, 0x00, 0x00,
+  0x04, 0xBF, 0x71, 0x00, 0x00, 0x5C, 0xF7, 0x10, 0x00, 0x6F, 0xF6, 0x00, 0x00, 0x0D, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+  0x0F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFD, 0x00, 0x00, 0x05, 0xFF, 0xA0, 0x00, 0x01, 0xCF, 0xF2,
+  0x00, 0x07, 0xDD, 0x92, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD7, 0x10, 0x00,
+  0x06, 0x30, 0x0A, 0xFF, 0xEF, 0xFF, 0xF9, 0x43, 0x8F, 0xF2, 0x2E, 0xF4, 0x00, 0x5C, 0xFF, 0xFF, 0xFF, 0x70, 0x01, 0x30,
+  0x00, 0x00, 0x4A, 0xEF, 0xD6, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0x66, 0x66, 0x66, 0x66,
+  0x66, 0x66, 0xBF, 0xF9, 0x00, 0x04, 0xBE, 0xFD, 0x92, 0x00, 0x09, 0xFF, 0x90, 0x09, 0xC4, 0x12, 0xAF, 0xF6, 0x00, 0x9F,
+  0xF9, 0x06, 0xD0, 0x00, 0x00, 0xBF, 0xF4, 0x09, 0xFF, 0x90, 0xDD, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x9F, 0xF9, 0x0F, 0xF6,
+  0x00, 0x00, 0x0F, 0xFF, 0x09, 0xFF, 0x90, 0xFF, 0xD0, 0x00, 0x00, 0xFF, 0xF0, 0x9F, 0xF9, 0x08, 0xF7, 0x00, 0x00, 0x2F,
+  0xFC, 0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x05, 0xFF, 0x60, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xD0, 0x09, 0xFF,
+  0x90, 0x00, 0x00, 0x00, 0x1F, 0xF4, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00,
+  0x00, 0xEB, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0x4F, 0x10, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0x09, 0x80, 0x00,
+  0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x00, 0x9F, 0xF9,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x09, 0xFF, 0x90, 0x00, 0x01, 0xDF, 0xA0, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00,
+  0x09, 0xFF, 0x90, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0x9F, 0xF9, 0x00, 0x00, 0x01, 0x30, 0x00, 0x00, 0x09, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
 };
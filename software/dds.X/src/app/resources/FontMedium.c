@@ -2,805 +2,420 @@
 #include "resources.h"
 
 const uint8_t FontMedium[] = {
-  2,  /*font type*/
+  3,  /*font type: 4BPP, trimmed glyph boxes*/
   32, /*first car ID*/
-  127, /*number of car*/
+  127, /*last car ID*/
   25, /*font height*/
-  /*index table: glyph width, offset hl, lh, ll*/
-  0x06, 0x00, 0x00, 0x00,
-  0x07, 0x00, 0x00, 0x4C,
-  0x0A, 0x00, 0x00, 0xA4,
-  0x0D, 0x00, 0x01, 0x22,
-  0x0B, 0x00, 0x01, 0xC5,
-  0x12, 0x00, 0x02, 0x4F,
-  0x11, 0x00, 0x03, 0x31,
-  0x04, 0x00, 0x04, 0x06,
-  0x07, 0x00, 0x04, 0x39,
-  0x07, 0x00, 0x04, 0x91,
-  0x0C, 0x00, 0x04, 0xE9,
-  0x0D, 0x00, 0x05, 0x80,
-  0x05, 0x00, 0x06, 0x23,
-  0x07, 0x00, 0x06, 0x62,
-  0x06, 0x00, 0x06, 0xBA,
-  0x07, 0x00, 0x07, 0x06,
-  0x0C, 0x00, 0x07, 0x5E,
-  0x0B, 0x00, 0x07, 0xF5,
-  0x0C, 0x00, 0x08, 0x7F,
-  0x0B, 0x00, 0x09, 0x16,
-  0x0C, 0x00, 0x09, 0xA0,
-  0x0C, 0x00, 0x0A, 0x37,
-  0x0C, 0x00, 0x0A, 0xCE,
-  0x0B, 0x00, 0x0B, 0x65,
-  0x0B, 0x00, 0x0B, 0xEF,
-  0x0B, 0x00, 0x0C, 0x79,
-  0x05, 0x00, 0x0D, 0x03,
-  0x06, 0x00, 0x0D, 0x42,
-  0x0D, 0x00, 0x0D, 0x8E,
-  0x0D, 0x00, 0x0E, 0x31,
-  0x0D, 0x00, 0x0E, 0xD4,
-  0x0A, 0x00, 0x0F, 0x77,
-  0x13, 0x00, 0x0F, 0xF5,
-  0x10, 0x00, 0x10, 0xE3,
-  0x0E, 0x00, 0x11, 0xAC,
-  0x0F, 0x00, 0x12, 0x5C,
-  0x10, 0x00, 0x13, 0x18,
-  0x0E, 0x00, 0x13, 0xE1,
-  0x0D, 0x00, 0x14, 0x91,
-  0x10, 0x00, 0x15, 0x34,
-  0x0F, 0x00, 0x15, 0xFD,
-  0x08, 0x00, 0x16, 0xB9,
-  0x09, 0x00, 0x17, 0x1E,
-  0x10, 0x00, 0x17, 0x8F,
-  0x0D, 0x00, 0x18, 0x58,
-  0x14, 0x00, 0x18, 0xFB,
-  0x11, 0x00, 0x19, 0xF6,
-  0x10, 0x00, 0x1A, 0xCB,
-  0x0D, 0x00, 0x1B, 0x94,
-  0x10, 0x00, 0x1C, 0x37,
-  0x0F, 0x00, 0x1D, 0x00,
-  0x0B, 0x00, 0x1D, 0xBC,
-  0x0E, 0x00, 0x1E, 0x46,
-  0x10, 0x00, 0x1E, 0xF6,
-  0x10, 0x00, 0x1F, 0xBF,
-  0x15, 0x00, 0x20, 0x88,
-  0x10, 0x00, 0x21, 0x8F,
-  0x10, 0x00, 0x22, 0x58,
-  0x0E, 0x00, 0x23, 0x21,
-  0x08, 0x00, 0x23, 0xD1,
-  0x07, 0x00, 0x24, 0x36,
-  0x08, 0x00, 0x24, 0x8E,
-  0x0A, 0x00, 0x24, 0xF3,
-  0x0B, 0x00, 0x25, 0x71,
-  0x06, 0x00, 0x25, 0xFB,
-  0x0A, 0x00, 0x26, 0x47,
-  0x0C, 0x00, 0x26, 0xC5,
-  0x0A, 0x00, 0x27, 0x5C,
-  0x0C, 0x00, 0x27, 0xDA,
-  0x0B, 0x00, 0x28, 0x71,
-  0x08, 0x00, 0x28, 0xFB,
-  0x0C, 0x00, 0x29, 0x60,
-  0x0C, 0x00, 0x29, 0xF7,
-  0x06, 0x00, 0x2A, 0x8E,
-  0x08, 0x00, 0x2A, 0xDA,
-  0x0C, 0x00, 0x2B, 0x3F,
-  0x06, 0x00, 0x2B, 0xD6,
-  0x12, 0x00, 0x2C, 0x22,
-  0x0C, 0x00, 0x2D, 0x04,
-  0x0C, 0x00, 0x2D, 0x9B,
-  0x0C, 0x00, 0x2E, 0x32,
-  0x0C, 0x00, 0x2E, 0xC9,
-  0x08, 0x00, 0x2F, 0x60,
-  0x09, 0x00, 0x2F, 0xC5,
-  0x07, 0x00, 0x30, 0x36,
-  0x0C, 0x00, 0x30, 0x8E,
-  0x0C, 0x00, 0x31, 0x25,
-  0x10, 0x00, 0x31, 0xBC,
-  0x0B, 0x00, 0x32, 0x85,
-  0x0B, 0x00, 0x33, 0x0F,
-  0x0A, 0x00, 0x33, 0x99,
-  0x0B, 0x00, 0x34, 0x17,
-  0x04, 0x00, 0x34, 0xA1,
-  0x0B, 0x00, 0x34, 0xD4,
-  0x0B, 0x00, 0x35, 0x5E,
-  0x0D, 0x00, 0x35, 0xE8,
-  /*glyph raw*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xB0, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00, 0xAA, 0x00, 0x00, 0x08, 
-  0x80, 0x00, 0x00, 0x77, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x44, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x22, 0x00, 0x00, 
-  0x0F, 0xE0, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00, 0xDC, 0x00, 0x00, 
-  0xFF, 0x00, 0xFF, 0x00, 0x00, 0xDC, 0x00, 0xDC, 0x00, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0x00, 0x76, 0x00, 0x76, 0x00, 0x00, 
-  0x11, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x30, 0x2F, 0x10, 0x00, 0x00, 0x03, 0xF0, 0x05, 
-  0xF0, 0x00, 0x00, 0x00, 0x6E, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x08, 0xB0, 0x0A, 0xA0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0x00, 0x03, 0x3E, 0x83, 0x3F, 0x73, 0x30, 0x00, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0x00, 0x00, 0x2F, 0x10, 0x3F, 0x10, 
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x33, 0x8D, 0x33, 0x9C, 0x33, 0x00, 0x00, 0x09, 0xA0, 0x0A, 0x90, 0x00, 
-  0x00, 0x00, 0xB8, 0x00, 0xC7, 0x00, 0x00, 0x00, 0x0D, 0x60, 0x0E, 0x50, 0x00, 0x00, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 
-  0x00, 0x00, 0x14, 0xF4, 0x10, 0x00, 0x00, 0x9E, 0x7F, 0x6D, 0xA1, 0x00, 0xAF, 0x40, 0xE0, 0x1D, 0x30, 0x0F, 0xF0, 0x0E, 
-  0x00, 0x63, 0x00, 0xFF, 0x40, 0xE0, 0x01, 0x10, 0x09, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF2, 0x00, 0x00, 0x00, 
-  0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x0E, 0x3F, 0xFA, 0x00, 0x00, 0x00, 0xE0, 0x5F, 
-  0xF0, 0x05, 0x00, 0x0E, 0x00, 0xFF, 0x00, 0xB0, 0x00, 0xE0, 0x1F, 0xD0, 0x0F, 0x70, 0x0E, 0x09, 0xF5, 0x00, 0x3A, 0xCA, 
-  0xFB, 0xA3, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x05, 0xE3, 0x00, 0x00, 0x00, 0x04, 0xCC, 0xFC, 0x88, 0x9C, 0xA0, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x4F, 0x00, 0x1E, 
-  0x20, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0x00, 0x98, 0x00, 0x00, 0x00, 0x0B, 0xF7, 0x00, 0x2C, 0x02, 0xE1, 0x00, 0x00, 
-  0x00, 0x0F, 0xF2, 0x00, 0x66, 0x0B, 0x60, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xB0, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x0A, 
-  0xF3, 0x09, 0x40, 0xC4, 0x01, 0x7B, 0xBB, 0x20, 0x01, 0xAD, 0xA3, 0x05, 0xB0, 0x3E, 0xE2, 0x06, 0xD0, 0x00, 0x00, 0x00, 
-  0x0D, 0x22, 0xEF, 0x30, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x69, 0x09, 0xFA, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x01, 0xD1, 0x0E, 
-  0xF4, 0x00, 0x07, 0x90, 0x00, 0x00, 0x08, 0x70, 0x0F, 0xF1, 0x00, 0x1D, 0x20, 0x00, 0x00, 0x1D, 0x00, 0x0B, 0xF2, 0x01, 
-  0xB5, 0x00, 0x00, 0x00, 0x95, 0x00, 0x01, 0xBE, 0xAA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDC, 0xBA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF5, 
-  0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x6C, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xBF, 0xA1, 0x8D, 0x20, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD7, 0x00, 0x7D, 0xFD, 0x70, 0x00, 
-  0x02, 0xBF, 0xFC, 0x00, 0x00, 0x9E, 0x10, 0x00, 0x05, 0xF5, 0x3F, 0xF7, 0x00, 0x0D, 0x40, 0x00, 0x04, 0xF6, 0x00, 0x8F, 
-  0xF4, 0x05, 0x90, 0x00, 0x00, 0xCF, 0x10, 0x00, 0xBF, 0xF4, 0xC1, 0x00, 0x00, 0x0F, 0xF1, 0x00, 0x01, 0xDF, 0xF4, 0x00, 
-  0x00, 0x00, 0xFF, 0x70, 0x00, 0x03, 0xFF, 0xD2, 0x00, 0x04, 0x09, 0xFF, 0x83, 0x38, 0xE5, 0xBF, 0xFB, 0x9D, 0x30, 0x07, 
-  0xDF, 0xFD, 0x81, 0x00, 0x7D, 0xFD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0D, 0xC0, 0x0F, 0xF0, 0x0D, 0xC0, 0x0A, 0xA0, 0x07, 0x60, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x25, 0x00, 0x00, 0x4A, 0x10, 0x00, 0x4C, 0x00, 0x00, 0x2F, 0x30, 0x00, 0x0C, 0xB0, 0x00, 0x03, 0xF6, 0x00, 0x00, 
-  0x9F, 0x30, 0x00, 0x0D, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0xF1, 0x00, 
-  0x00, 0x9F, 0x30, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x0C, 0xA0, 0x00, 0x00, 0x2F, 0x20, 0x00, 0x00, 0x5B, 0x00, 0x00, 0x00, 
-  0x69, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x20, 0x00, 0x00, 0x1A, 0x30, 0x00, 0x00, 0x0C, 0x30, 0x00, 0x00, 0x3E, 0x10, 
-  0x00, 0x00, 0xBA, 0x00, 0x00, 0x07, 0xF2, 0x00, 0x00, 0x3F, 0x70, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x06, 0xF4, 0x00, 0x00, 0xAD, 0x00, 0x00, 
-  0x2F, 0x30, 0x00, 0x0B, 0x60, 0x00, 0x09, 0x60, 0x00, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD0, 0x00, 0x00, 0x01, 
-  0x20, 0x0F, 0xB0, 0x12, 0x00, 0x09, 0xF5, 0x0F, 0x52, 0xEF, 0x00, 0x02, 0x9D, 0x5F, 0x5D, 0xA4, 0x00, 0x00, 0x00, 0x7F, 
-  0xB1, 0x00, 0x00, 0x00, 0x7C, 0x3F, 0x3D, 0xB6, 0x00, 0x00, 0xE6, 0x0F, 0x51, 0xCE, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x00, 
-  0x00, 0x00, 0x00, 0x0C, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x22, 0x22, 0x2F, 0xF2, 0x22, 0x20, 0x0F, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x0E, 0xFB, 0x00, 0xCF, 
-  0xF0, 0x00, 0x1D, 0x00, 0x09, 0x40, 0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0xFF, 0xFF, 0xF0, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0xFE, 0x00, 0x00, 
-  0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF6, 0x00, 
-  0x00, 0x8F, 0x10, 0x00, 0x0D, 0xB0, 0x00, 0x02, 0xF6, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0D, 0xB0, 0x00, 0x02, 0xF5, 0x00, 
-  0x00, 0x8F, 0x10, 0x00, 0x0D, 0xB0, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x0D, 0xB0, 0x00, 0x03, 0xF5, 0x00, 
-  0x00, 0x8F, 0x10, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0xB9, 0xAB, 0x30, 0x00, 0x00, 0x4F, 0x40, 0x04, 0xF4, 0x00, 0x01, 0xEA, 0x00, 0x00, 0xBE, 0x10, 
-  0x07, 0xF5, 0x00, 0x00, 0x6F, 0x60, 0x0B, 0xF2, 0x00, 0x00, 0x3F, 0xB0, 0x0E, 0xF1, 0x00, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 
-  0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0xF1, 0x00, 0x00, 0x1F, 0xE0, 0x0B, 0xF2, 0x00, 0x00, 
-  0x2F, 0xB0, 0x06, 0xF5, 0x00, 0x00, 0x5F, 0x60, 0x01, 0xEA, 0x00, 0x00, 0xAE, 0x10, 0x00, 0x4F, 0x30, 0x03, 0xF4, 0x00, 
-  0x00, 0x03, 0xB9, 0xAB, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x03, 0xBF, 0xF0, 0x00, 0x00, 0x01, 0x32, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 
-  0x00, 0x00, 0x00, 0x6B, 0xFF, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFB, 0x30, 0x00, 0x00, 0xBE, 0xAB, 
-  0xFF, 0xF3, 0x00, 0x06, 0xA0, 0x00, 0x1C, 0xFC, 0x00, 0x0B, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x02, 0x00, 0x00, 0x00, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x40, 0x00, 0x00, 
-  0x00, 0x00, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x09, 0x50, 0x00, 0x00, 0x00, 0x00, 0x94, 0x00, 0x00, 0x00, 0x00, 0x09, 0x30, 
-  0x00, 0x00, 0x80, 0x00, 0xBD, 0xBB, 0xBB, 0xBD, 0x80, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x1A, 0xEF, 0xE8, 0x00, 0x00, 0x1C, 0x85, 0x7F, 0xFA, 0x00, 0x07, 0x20, 0x00, 0x4F, 0xF0, 0x00, 0x30, 0x00, 0x00, 0xFE, 
-  0x00, 0x00, 0x00, 0x00, 0x4F, 0x40, 0x00, 0x00, 0x00, 0x3D, 0x40, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0x80, 0x00, 0x00, 0x12, 
-  0x5B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFD, 0x00, 
-  0x00, 0x00, 0x00, 0x5F, 0x50, 0x0C, 0xB4, 0x00, 0x3E, 0x70, 0x00, 0x8F, 0xFD, 0xA9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xF0, 0x00, 
-  0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF0, 0x00, 0x00, 0x00, 0x09, 0x3F, 0xF0, 0x00, 0x00, 0x00, 
-  0x48, 0x0F, 0xF0, 0x00, 0x00, 0x01, 0xB0, 0x0F, 0xF0, 0x00, 0x00, 0x0A, 0x30, 0x0F, 0xF0, 0x00, 0x00, 0x58, 0x00, 0x0F, 
-  0xF0, 0x00, 0x02, 0xB0, 0x00, 0x0F, 0xF0, 0x00, 0x0B, 0x42, 0x22, 0x2F, 0xF2, 0x20, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 
-  0x05, 0x55, 0x55, 0x5F, 0xF5, 0x50, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xCC, 
-  0xCC, 0xB4, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x51, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC4, 0x00, 
-  0x00, 0x01, 0x46, 0xAF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFD, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFB, 0x00, 0x01, 0x10, 0x00, 
-  0x07, 0xF4, 0x00, 0x0F, 0xF7, 0x00, 0x5F, 0x60, 0x00, 0x07, 0xEF, 0xEB, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x47, 0x30, 0x00, 0x00, 0x03, 0xAC, 
-  0x51, 0x00, 0x00, 0x00, 0x9F, 0x70, 0x00, 0x00, 0x00, 0x0B, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x00, 
-  0x02, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x08, 0xFC, 0x8E, 0xFE, 0xA1, 0x00, 0x0D, 0xFC, 0x30, 0x29, 0xFE, 0x10, 0x0F, 0xF3, 
-  0x00, 0x00, 0xBF, 0x90, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0D, 0xF2, 0x00, 0x00, 
-  0x0F, 0xF0, 0x08, 0xF5, 0x00, 0x00, 0x1F, 0xC0, 0x02, 0xFB, 0x00, 0x00, 0x4F, 0x50, 0x00, 0x5F, 0x60, 0x00, 0xCA, 0x00, 
-  0x00, 0x03, 0xBB, 0x9B, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xCD, 0xAA, 0xAA, 0xAF, 
-  0xA0, 0x39, 0x00, 0x00, 0x01, 0xF4, 0x01, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x90, 0x00, 0x00, 0x00, 
-  0x02, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 
-  0x00, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x90, 0x00, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x9E, 0x00, 
-  0x00, 0x00, 0x00, 0x0E, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0xAB, 0xD7, 0x00, 0x00, 0x6F, 0x60, 0x07, 0xF9, 0x00, 0x0E, 
-  0xF0, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x20, 0x00, 0xFE, 0x00, 0x0B, 0xF9, 0x00, 0x4F, 0x60, 0x00, 0x1D, 0xF7, 0x1B, 0x50, 
-  0x00, 0x00, 0x1A, 0xFF, 0x70, 0x00, 0x00, 0x01, 0xB9, 0xFF, 0xC2, 0x00, 0x02, 0xE8, 0x02, 0xCF, 0xF3, 0x00, 0xCF, 0x20, 
-  0x00, 0xBF, 0xC0, 0x0F, 0xF0, 0x00, 0x02, 0xFF, 0x00, 0xEF, 0x20, 0x00, 0x1F, 0xD0, 0x05, 0xFB, 0x00, 0x07, 0xF5, 0x00, 
-  0x04, 0xBC, 0xAA, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xBA, 0xC6, 0x00, 0x00, 0x0B, 0xB0, 0x02, 0xF7, 0x00, 0x06, 0xF4, 0x00, 
-  0x08, 0xF2, 0x00, 0xCF, 0x10, 0x00, 0x4F, 0x90, 0x0F, 0xF0, 0x00, 0x02, 0xFD, 0x00, 0xFF, 0x10, 0x00, 0x0F, 0xF0, 0x0E, 
-  0xF3, 0x00, 0x00, 0xFF, 0x00, 0xAF, 0x80, 0x00, 0x1F, 0xF0, 0x02, 0xFF, 0x50, 0x2A, 0xFC, 0x00, 0x03, 0xBF, 0xE9, 0x6F, 
-  0x80, 0x00, 0x00, 0x00, 0x0B, 0xF2, 0x00, 0x00, 0x00, 0x03, 0xF9, 0x00, 0x00, 0x00, 0x01, 0xDD, 0x10, 0x00, 0x00, 0x02, 
-  0xDC, 0x20, 0x00, 0x00, 0x28, 0xD6, 0x00, 0x00, 0x00, 0x37, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x0F, 
-  0xE0, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x30, 0x00, 0xFE, 0x00, 0x0C, 
-  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xEF, 0xB0, 0x00, 0xCF, 0xF0, 0x00, 0x01, 0xD0, 0x00, 0x09, 0x40, 
-  0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xAF, 
-  0xF9, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0x81, 0x00, 0x00, 0x06, 0xDF, 0xE7, 0x10, 0x00, 0x00, 0x7E, 0xFC, 0x50, 0x00, 0x00, 
-  0x00, 0x0F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFC, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDF, 0xE6, 0x10, 0x00, 
-  0x00, 0x00, 0x00, 0x4C, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xAF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xF0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 
-  0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x0F, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x09, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x17, 0xEF, 0xD6, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5C, 0xFE, 0x70, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x5C, 0xFE, 0x70, 
-  0x00, 0x00, 0x16, 0xEF, 0xD6, 0x00, 0x00, 0x01, 0x8F, 0xFC, 0x40, 0x00, 0x00, 0x09, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x00, 
-  0xF9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0xBD, 0xC4, 0x00, 0x08, 0x60, 0x00, 0xAF, 0x60, 0x0F, 
-  0x80, 0x00, 0x2F, 0xE0, 0x0E, 0xE0, 0x00, 0x1F, 0xF0, 0x01, 0x20, 0x00, 0x3F, 0xA0, 0x00, 0x00, 0x00, 0x9F, 0x20, 0x00, 
-  0x00, 0x01, 0xF4, 0x00, 0x00, 0x00, 0x08, 0x60, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 
-  0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0xCB, 0xBB, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDC, 0x30, 0x00, 0x03, 0xC9, 0x00, 
-  0x00, 0x00, 0x03, 0xFB, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x01, 0xEE, 0x10, 0x05, 0xDF, 0xA8, 0x80, 0xD6, 0x00, 
-  0x00, 0x8F, 0x80, 0x07, 0xFA, 0x16, 0xF9, 0x05, 0xD0, 0x00, 0x0D, 0xF3, 0x03, 0xFC, 0x00, 0x3F, 0x50, 0x1F, 0x00, 0x00, 
-  0xFF, 0x10, 0xAF, 0x40, 0x06, 0xF1, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x0E, 0xF1, 0x00, 0xAC, 0x00, 0x3C, 0x00, 0x00, 0xEF, 
-  0x20, 0xFF, 0x10, 0x2F, 0x80, 0x0A, 0x60, 0x00, 0x09, 0xF7, 0x0C, 0xF8, 0x38, 0xF8, 0x06, 0xB0, 0x00, 0x00, 0x2F, 0xE1, 
-  0x2C, 0xD8, 0x14, 0xCB, 0x70, 0x00, 0x00, 0x00, 0x4F, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE6, 
-  0x10, 0x00, 0x38, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBE, 0xED, 0xDA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x8F, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xFF, 
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x30, 0xCF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x5F, 0xD0, 0x00, 0x00, 0x00, 
-  0x00, 0xA5, 0x00, 0x0E, 0xF4, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x07, 0xFB, 0x00, 0x00, 0x00, 0x07, 0xFE, 0xEE, 0xEE, 
-  0xFF, 0x20, 0x00, 0x00, 0x0D, 0x10, 0x00, 0x00, 0xAF, 0x90, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x00, 0x4F, 0xF1, 0x00, 0x00, 
-  0xC4, 0x00, 0x00, 0x00, 0x0D, 0xF7, 0x00, 0x04, 0xF1, 0x00, 0x00, 0x00, 0x09, 0xFE, 0x10, 0x7F, 0xFA, 0x40, 0x00, 0x01, 
-  0x7D, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCF, 0xFE, 0xDE, 0xFD, 0x92, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x05, 0xFF, 0x40, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 
-  0xD0, 0x00, 0x0F, 0xF0, 0x00, 0x15, 0xEF, 0x40, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x38, 
-  0xFE, 0x20, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 
-  0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x5F, 0xB0, 0x00, 0x1F, 0xF1, 0x00, 0x06, 0xFF, 0x20, 0x17, 0xCF, 0xFF, 
-  0xDE, 0xFD, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCE, 0xEF, 0xFF, 0xFF, 0x00, 0x00, 0x5F, 0xB4, 0x00, 0x04, 0xCF, 0xF0, 
-  0x00, 0x6F, 0x90, 0x00, 0x00, 0x00, 0xBF, 0x00, 0x2F, 0xD0, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x09, 0xF6, 0x00, 0x00, 0x00, 
-  0x00, 0x09, 0x00, 0xDF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xF9, 0x00, 0x00, 0x00, 0x01, 0x92, 0x00, 0x08, 0xFD, 0x51, 0x00, 
-  0x38, 0xD5, 0x00, 0x00, 0x02, 0x9D, 0xFF, 0xFC, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xED, 0xEE, 
-  0xDA, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x01, 0x49, 0xFE, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x2E, 0xF5, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x00, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0x3F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x00, 0xFF, 0x00, 0x00, 
-  0x00, 0x01, 0xEF, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x1C, 0xF5, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x38, 0xFE, 0x50, 0x00, 
-  0x7C, 0xFF, 0xED, 0xEE, 0xDA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xED, 0xDD, 0xEF, 0xFF, 0x00, 0x01, 0xFF, 
-  0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0xFF, 0xEE, 0xEE, 0xFF, 0x80, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0x19, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xD0, 0x01, 0xFF, 0x10, 0x00, 0x00, 
-  0x5E, 0x90, 0x7C, 0xFF, 0xFD, 0xDD, 0xEF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xED, 0xDD, 0xEF, 0xFF, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0x04, 0xF0, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0x0A, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0F, 0xF0, 0x00, 
-  0x01, 0xA8, 0x00, 0x00, 0xFF, 0xEE, 0xEE, 0xFF, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xA8, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0x02, 0x80, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x07, 0xCF, 0xFC, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xDF, 
-  0xEF, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xFB, 0x40, 0x00, 0x4D, 0xFC, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x00, 0x01, 0xDC, 0x00, 
-  0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0D, 0xF2, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x7A, 0xCC, 0xA4, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20, 
-  0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xFD, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x07, 0xFC, 0x50, 0x00, 0x17, 0xFD, 0x00, 
-  0x00, 0x00, 0x28, 0xCF, 0xED, 0xC9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xC7, 0x00, 0x07, 0xCF, 
-  0xFC, 0x70, 0x1F, 0xF1, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 
-  0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xF1, 0x07, 0xCF, 0xFD, 0x80, 0x00, 0x8C, 0xFF, 0xD7, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x18, 0xCF, 0xFC, 0x81, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x18, 0xCF, 0xFC, 0x81, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xFF, 0xC8, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x01, 0x82, 0x0F, 0xC0, 0x00, 0x7F, 
-  0xA2, 0xF6, 0x00, 0x02, 0xCF, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 
-  0xFF, 0xC8, 0x10, 0x5A, 0xFF, 0xC8, 0x10, 0x01, 0xFF, 0x10, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2D, 
-  0x50, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x6E, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x8F, 0xFD, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2E, 0xFD, 0x10, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x02, 0xEF, 0xC1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x10, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x05, 
-  0xFF, 0xD1, 0x00, 0x7C, 0xFF, 0xB7, 0x00, 0x48, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF1, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0x60, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x76, 0x01, 0xFF, 0x10, 0x00, 0x02, 0x9F, 0x27, 0xCF, 0xFF, 0xEE, 0xEF, 
-  0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xCF, 0xFA, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0xFF, 0xC7, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x10, 0x00, 0x0F, 0xFF, 0xA0, 0x00, 
-  0x00, 0x00, 0x7C, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0x00, 0x00, 0x0F, 0x1F, 0xFA, 0x00, 
-  0x00, 0x06, 0xC0, 0xFF, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x20, 0x00, 0x0D, 0x40, 0xFF, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xA0, 
-  0x00, 0x5C, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x7F, 0xF2, 0x00, 0xD5, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xFA, 
-  0x04, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xFF, 0x2C, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xFF, 
-  0xCD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xF5, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x1F, 
-  0xD0, 0x00, 0x01, 0xFF, 0x10, 0x18, 0xDF, 0xE8, 0x10, 0x08, 0x60, 0x01, 0x8C, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xF2, 
-  0x00, 0x00, 0x18, 0xEF, 0xE8, 0x10, 0x03, 0xFF, 0xD1, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 
-  0x1F, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x50, 0x00, 0x0F, 0x00, 0x00, 
-  0x00, 0xF0, 0x09, 0xFF, 0x30, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x0B, 0xFE, 0x10, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 
-  0x1D, 0xFC, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xF9, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0xF6, 
-  0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 
-  0x3F, 0x30, 0x00, 0x00, 0x00, 0xAF, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDD, 0xCD, 0x93, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x10, 0x01, 
-  0x8F, 0x80, 0x00, 0x00, 0x8F, 0x50, 0x00, 0x00, 0x05, 0xF8, 0x00, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x09, 
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x90, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xD0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0E, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x09, 
-  0xF6, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xA0, 0x03, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x30, 0x00, 0x8F, 0x50, 0x00, 0x00, 
-  0x05, 0xF8, 0x00, 0x00, 0x08, 0xF6, 0x00, 0x01, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x3A, 0xDC, 0xCD, 0x93, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 
-  0xFF, 0xED, 0xEE, 0xB6, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x27, 0xFE, 0x20, 0x00, 0xFF, 0x00, 0x00, 0x06, 0xFB, 0x00, 0x0F, 
-  0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x6F, 0x90, 0x00, 0xFF, 
-  0x00, 0x02, 0x8F, 0xC1, 0x00, 0x0F, 0xFD, 0xEE, 0xDA, 0x50, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 
-  0x00, 0x00, 0x00, 0x06, 0xCF, 0xFD, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xDD, 0xDD, 0x92, 0x00, 0x00, 0x00, 
-  0x06, 0xF9, 0x10, 0x01, 0x8F, 0x60, 0x00, 0x00, 0x5F, 0x70, 0x00, 0x00, 0x08, 0xF5, 0x00, 0x01, 0xFD, 0x00, 0x00, 0x00, 
-  0x00, 0xDF, 0x10, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x70, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 
-  0xF1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
-  0x00, 0x1F, 0xF0, 0x0D, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x09, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x90, 0x02, 
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0xDF, 0x20, 0x00, 0x7F, 0x50, 0x00, 0x00, 0x06, 0xF8, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 
-  0x7F, 0x90, 0x00, 0x00, 0x00, 0x3A, 0xFB, 0xCE, 0xB4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x37, 0xAA, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xED, 0xEF, 0xC8, 0x20, 0x00, 0x00, 0x1F, 0xF0, 0x00, 
-  0x05, 0xEF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x37, 0xFD, 0x20, 0x00, 0x00, 0xFF, 0xDE, 0xFF, 0xB5, 0x00, 
-  0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x5F, 0xF9, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
-  0x8F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xF2, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xDF, 0xD0, 0x00, 0x02, 
-  0xFF, 0x10, 0x00, 0x02, 0xFF, 0xA0, 0x07, 0xCF, 0xFC, 0x82, 0x00, 0x05, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xF3, 0x00, 0x6F, 0x90, 0x03, 0xDF, 0x40, 0x0E, 0xF1, 0x00, 0x01, 
-  0xE6, 0x00, 0xFF, 0x30, 0x00, 0x05, 0x70, 0x0D, 0xFD, 0x20, 0x00, 0x05, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x4E, 
-  0xFF, 0xD4, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF6, 0x02, 0x00, 0x00, 0x00, 0x9F, 0xE0, 
-  0x84, 0x00, 0x00, 0x01, 0xFF, 0x06, 0xE1, 0x00, 0x00, 0x1F, 0xC0, 0x4F, 0xD3, 0x00, 0x1B, 0xF3, 0x01, 0xFF, 0xFE, 0xDE, 
-  0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x0F, 
-  0x71, 0x00, 0xFF, 0x00, 0x03, 0xE8, 0x0D, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x68, 0x05, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x15, 
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xFF, 0xC8, 0x00, 0x01, 0x8E, 
-  0xFE, 0x80, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xDF, 0x30, 0x00, 0x00, 0x03, 
-  0xC0, 0x00, 0x00, 0x8F, 0x90, 0x00, 0x00, 0x0A, 0x70, 0x00, 0x00, 0x1D, 0xF8, 0x20, 0x04, 0xAC, 0x00, 0x00, 0x00, 0x01, 
-  0x7D, 0xFF, 0xFD, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xF9, 0x50, 0x00, 
-  0x05, 0xAF, 0xE7, 0x00, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x0E, 0xF8, 0x00, 0x00, 0x00, 0x5D, 0x00, 0x00, 
-  0x07, 0xFF, 0x10, 0x00, 0x00, 0xC6, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x7F, 0xF1, 0x00, 
-  0x09, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xF7, 0x00, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x08, 0xFE, 0x00, 0x7B, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0xFF, 0x60, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE5, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x93, 0x18, 0xFF, 0xFA, 0x50, 0x00, 0x8E, 
-  0xFB, 0x20, 0x5F, 0xF1, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0x9B, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x0E, 0xF7, 0x00, 0x00, 
-  0x0C, 0x50, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40, 
-  0x00, 0x88, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0xDC, 0xFB, 0x00, 0x0E, 0x20, 0x00, 0x00, 0x05, 0xFF, 0x10, 0x4D, 0x3F, 
-  0xF1, 0x04, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0x0A, 0x60, 0xDF, 0x70, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE1, 0xF1, 
-  0x07, 0xFE, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBA, 0x00, 0x1F, 0xFB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 
-  0x40, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0xF7, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 
-  0xEF, 0xFF, 0x95, 0x00, 0x4A, 0xFF, 0xB6, 0x00, 0x1D, 0xFF, 0x20, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 
-  0x1D, 0x60, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x18, 0xB0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xDF, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xD6, 0xBF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x1F, 0xFA, 0x00, 0x00, 0x00, 
-  0x00, 0xAB, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x08, 0xD1, 0x00, 0x00, 0xBF, 0xF2, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 
-  0x2F, 0xFD, 0x10, 0x3B, 0xFF, 0xA6, 0x00, 0x05, 0xAF, 0xFF, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x4C, 0xFF, 0xFA, 0x50, 0x00, 0x4A, 0xFF, 0xA2, 0x00, 0xBF, 0xF3, 0x00, 0x00, 0x02, 0xF5, 0x00, 0x00, 0x1D, 0xFC, 0x00, 
-  0x00, 0x0B, 0x80, 0x00, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xF2, 0x01, 0xE2, 0x00, 0x00, 
-  0x00, 0x00, 0x0B, 0xFD, 0x0B, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 
-  0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 
-  0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xCF, 0xFC, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFE, 0xDD, 0xDD, 
-  0xFF, 0xF5, 0x04, 0xE4, 0x00, 0x00, 0x01, 0xEF, 0xA0, 0x06, 0x60, 0x00, 0x00, 0x0A, 0xFE, 0x10, 0x05, 0x10, 0x00, 0x00, 
-  0x6F, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xAF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0xDF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFE, 0x10, 0x00, 0x00, 0x07, 0x00, 0x6F, 0xF4, 0x00, 0x00, 0x00, 0x1B, 0x03, 
-  0xFF, 0x80, 0x00, 0x00, 0x02, 0xCA, 0x0D, 0xFF, 0xDD, 0xDD, 0xDD, 0xEF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xB9, 0x80, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x10, 
-  0x00, 0x00, 0xCC, 0xB9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x0D, 0xA0, 
-  0x00, 0x00, 0x8F, 0x10, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x03, 0xF5, 0x00, 0x00, 
-  0x0D, 0xB0, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x0D, 0xB0, 0x00, 0x00, 0x8F, 0x10, 0x00, 0x02, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x08, 0x9C, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x08, 0x9A, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 
-  0x0C, 0xC7, 0xF2, 0x00, 0x00, 0x4F, 0x40, 0xE9, 0x00, 0x00, 0xCC, 0x00, 0x7F, 0x20, 0x04, 0xF4, 0x00, 0x1E, 0x90, 0x0C, 
-  0xC0, 0x00, 0x07, 0xF2, 0x4F, 0x40, 0x00, 0x01, 0xE9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xEA, 0x00, 0x00, 0x6F, 0xC1, 0x00, 0x01, 0xAC, 0x10, 0x00, 0x03, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8A, 0x9D, 0xB1, 0x00, 0x0B, 0xF0, 0x02, 0xFB, 0x00, 0x0F, 
-  0xF0, 0x00, 0xFF, 0x00, 0x02, 0x20, 0x03, 0xFF, 0x00, 0x00, 0x05, 0xA5, 0xFF, 0x00, 0x01, 0xCA, 0x00, 0xFF, 0x00, 0x0B, 
-  0xF1, 0x00, 0xFF, 0x00, 0x0F, 0xF1, 0x00, 0xFF, 0x00, 0x0E, 0xFA, 0x59, 0xFF, 0x64, 0x04, 0xEF, 0x91, 0x9F, 0xC2, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1A, 0xFF, 0xB2, 0x00, 0x00, 0xFF, 0xB8, 0x7D, 0xFE, 0x10, 0x00, 0xFF, 0x20, 
-  0x00, 0xDF, 0x90, 0x00, 0xFF, 0x00, 0x00, 0x5F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 
-  0xE0, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x5F, 0x30, 0x00, 0xFF, 0x20, 0x02, 0xD6, 0x00, 0x00, 
-  0x3A, 0xEC, 0xBA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xCA, 0xCA, 0x10, 0x00, 0xAD, 0x10, 0x2F, 0xC0, 0x05, 0xF5, 0x00, 0x0C, 
-  0xE0, 0x0C, 0xF1, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0x0E, 0xF7, 0x00, 0x00, 
-  0x22, 0x09, 0xFF, 0x30, 0x01, 0x90, 0x01, 0xEF, 0xFB, 0xAD, 0x30, 0x00, 0x2A, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0x00, 0x00, 0x00, 
-  0x00, 0x03, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x06, 0xCA, 0xA7, 0xFF, 0x00, 0x00, 0x8E, 0x10, 0x08, 0xFF, 0x00, 0x04, 0xF5, 0x00, 0x01, 0xFF, 0x00, 
-  0x0B, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0x0E, 0xF4, 
-  0x00, 0x00, 0xFF, 0x00, 0x0A, 0xFB, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xFF, 0xA3, 0x39, 0xFF, 0x93, 0x00, 0x2B, 0xFF, 0xB2, 
-  0xE9, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xCC, 0xEB, 0x20, 0x00, 0x0B, 0xB0, 0x02, 0xFE, 0x10, 0x06, 
-  0xF3, 0x00, 0x0A, 0xF7, 0x00, 0xCF, 0xBB, 0xBB, 0xCE, 0x90, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x30, 0x00, 0x00, 
-  0x00, 0x0E, 0xF8, 0x00, 0x00, 0x05, 0x00, 0x9F, 0xF3, 0x00, 0x04, 0x90, 0x01, 0xEF, 0xFA, 0x8B, 0xC1, 0x00, 0x02, 0xAF, 
-  0xFD, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xBB, 0xE7, 0x00, 0x4F, 0x20, 0xCF, 0x00, 
-  0xBF, 0x00, 0x12, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x9B, 0xFF, 0xBB, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x5A, 0xFF, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xAB, 0xE9, 0x20, 0x00, 0x00, 0x7F, 
-  0x10, 0xAF, 0xFE, 0xE3, 0x01, 0xFD, 0x00, 0x4F, 0xC0, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x01, 0xFF, 0x10, 0x0F, 
-  0xE0, 0x00, 0x00, 0x7F, 0x80, 0x4F, 0x60, 0x00, 0x00, 0x06, 0xC9, 0xA4, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xFD, 0xBB, 0xBB, 0xA6, 0x00, 0x00, 0x8E, 0xEF, 0xFF, 0xFF, 0x90, 0x01, 0xD5, 0x00, 0x00, 0x17, 0xF0, 0x0A, 0xF0, 
-  0x00, 0x00, 0x01, 0xE0, 0x0F, 0xF3, 0x00, 0x00, 0x08, 0x80, 0x0B, 0xFE, 0x74, 0x46, 0xB8, 0x00, 0x00, 0x7D, 0xFF, 0xD9, 
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x2A, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x08, 0xEF, 0xC1, 0x00, 0x00, 0xFF, 0xA6, 0x3B, 0xFA, 0x00, 0x00, 0xFF, 0x20, 0x02, 0xFE, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x10, 0x01, 0xFF, 0x00, 0x2A, 0xFF, 0xA3, 
-  0x3A, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0x00, 0x27, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x29, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCC, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8F, 0x00, 0x00, 0x28, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 
-  0xFB, 0x00, 0x6F, 0x33, 0xF4, 0x00, 0x3D, 0xEB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x02, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x4A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3C, 0xF9, 0x50, 0x00, 0xFF, 0x00, 
-  0x2C, 0x30, 0x00, 0x00, 0xFF, 0x03, 0xB1, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x20, 0x00, 
-  0x00, 0x00, 0xFF, 0x4F, 0xD1, 0x00, 0x00, 0x00, 0xFF, 0x08, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xCF, 0x70, 0x00, 0x00, 
-  0xFF, 0x00, 0x1E, 0xF4, 0x00, 0x4A, 0xFF, 0xA4, 0x2C, 0xFF, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0x00, 
-  0x5A, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x4A, 
-  0xFF, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x9E, 0x06, 0xDF, 0xB1, 0x18, 0xEF, 0xB1, 0x00, 0x27, 0xFF, 0x96, 
-  0x3A, 0xFA, 0xA5, 0x39, 0xF9, 0x00, 0x00, 0xFF, 0x10, 0x01, 0xFF, 0x10, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-  0x01, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x4A, 0xFF, 0x93, 0x3A, 0xFF, 0xB4, 0x3A, 0xFF, 0x93, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x04, 0x9E, 0x07, 0xEF, 0xB1, 0x00, 0x26, 0xFF, 0x96, 0x4B, 0xFA, 0x00, 0x00, 0xFF, 0x20, 0x02, 
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x2A, 0xFF, 
-  0x93, 0x2A, 0xFF, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBA, 0xCD, 0x60, 
-  0x00, 0x00, 0xBC, 0x10, 0x06, 0xFB, 0x00, 0x06, 0xF4, 0x00, 0x00, 0xBF, 0x70, 0x0D, 0xF0, 0x00, 0x00, 0x4F, 0xD0, 0x0F, 
-  0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF2, 0x00, 0x00, 0x0F, 0xF0, 0x0C, 0xF6, 0x00, 0x00, 0x1F, 0xB0, 0x06, 0xFC, 0x00, 
-  0x00, 0x5F, 0x40, 0x00, 0xAF, 0x70, 0x01, 0xD8, 0x00, 0x00, 0x06, 0xDC, 0xAB, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8E, 0x18, 0xEF, 0xC3, 0x00, 0x39, 0xFF, 0xA7, 0x6B, 0xFF, 0x20, 0x00, 0xFF, 
-  0x20, 0x00, 0xCF, 0xA0, 0x00, 0xFF, 0x00, 0x00, 0x4F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 
-  0x0F, 0xE0, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xB0, 0x00, 0xFF, 0x00, 0x00, 0x6F, 0x40, 0x00, 0xFF, 0x60, 0x02, 0xE8, 0x00, 
-  0x00, 0xFF, 0x7C, 0xBC, 0x60, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xB9, 
-  0x9A, 0x7D, 0x00, 0x00, 0x8E, 0x10, 0x04, 0xFF, 0x00, 0x04, 0xF5, 0x00, 0x00, 0xFF, 0x00, 0x0B, 0xF1, 0x00, 0x00, 0xFF, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x0B, 
-  0xFC, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0xC6, 0x7A, 0xFF, 0x00, 0x00, 0x4D, 0xFE, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 
-  0x00, 0x00, 0x00, 0x00, 0x7D, 0xFF, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8D, 0x1B, 0xF4, 0x38, 0xFF, 0x88, 0xF7, 0x00, 0xFF, 0x30, 0x10, 
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0x3B, 0xFF, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x98, 0x9F, 0xF0, 0x00, 0xE2, 
-  0x00, 0x2F, 0x00, 0x2F, 0x30, 0x00, 0x80, 0x01, 0xFF, 0x71, 0x00, 0x00, 0x05, 0xFF, 0xE7, 0x00, 0x00, 0x02, 0xBF, 0xFE, 
-  0x30, 0x11, 0x00, 0x4D, 0xFD, 0x03, 0x70, 0x00, 0x2F, 0xF0, 0x3E, 0x10, 0x02, 0xF9, 0x03, 0xFE, 0x99, 0xC8, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x1B, 0xFF, 0xBB, 
-  0x20, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 
-  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xDF, 0x74, 0x60, 0x05, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xFF, 0x00, 0x49, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x03, 0xFF, 0x00, 0x00, 0xCF, 
-  0xC5, 0x78, 0xFF, 0x71, 0x00, 0x2C, 0xFE, 0x70, 0xE8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x2A, 0xFF, 0x70, 0x01, 0x8F, 0x90, 0x00, 0xDF, 0x20, 0x00, 0x2D, 0x00, 0x00, 0x6F, 0x90, 0x00, 0x86, 0x00, 0x00, 
-  0x0F, 0xF1, 0x00, 0xD0, 0x00, 0x00, 0x08, 0xF6, 0x05, 0x80, 0x00, 0x00, 0x01, 0xFD, 0x0B, 0x20, 0x00, 0x00, 0x00, 0xAF, 
-  0x6B, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x05, 0x60, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFC, 0x31, 0xAF, 0xF9, 0x10, 0x3D, 0xE2, 
-  0x07, 0xF9, 0x00, 0x0D, 0xF1, 0x00, 0x09, 0x60, 0x01, 0xFE, 0x00, 0x07, 0xF7, 0x00, 0x0D, 0x00, 0x00, 0xAF, 0x50, 0x07, 
-  0xFD, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xB0, 0x0D, 0xAF, 0x30, 0xB2, 0x00, 0x00, 0x0D, 0xF1, 0x68, 0x3F, 0x92, 0xC0, 0x00, 
-  0x00, 0x06, 0xF7, 0xD1, 0x0D, 0xE9, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x9F, 0x20, 
-  0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0xFF, 0x71, 0x9F, 0x92, 0x00, 0x0D, 0xF4, 0x08, 0x70, 0x00, 0x00, 
-  0x3F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x9F, 0xF2, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x2E, 0xFC, 0x00, 
-  0x00, 0x00, 0x0C, 0x3C, 0xF7, 0x00, 0x00, 0x07, 0x80, 0x2F, 0xF2, 0x00, 0x03, 0xD1, 0x00, 0x7F, 0xB0, 0x05, 0xEC, 0x20, 
-  0x08, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0x71, 0x02, 0xAF, 0x40, 0x1F, 0xF2, 0x00, 0x07, 0x90, 0x00, 0xAF, 0x80, 
-  0x00, 0xD3, 0x00, 0x03, 0xFE, 0x00, 0x2D, 0x00, 0x00, 0x0C, 0xF5, 0x07, 0x70, 0x00, 0x00, 0x5F, 0xB0, 0xD2, 0x00, 0x00, 
-  0x00, 0xEF, 0x4C, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 
-  0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x02, 0x20, 0xA7, 0x00, 0x00, 0x00, 0xFF, 0xED, 
-  0x00, 0x00, 0x00, 0x09, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 
-  0xCB, 0xBB, 0xEF, 0xE0, 0x0B, 0x00, 0x02, 0xFF, 0x30, 0x04, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 
-  0x02, 0xFF, 0x30, 0x00, 0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x35, 0x0C, 
-  0xF6, 0x00, 0x00, 0xA3, 0x6F, 0xFB, 0xBB, 0xBD, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xD6, 0x00, 0x00, 0x00, 0x0C, 0xF4, 0x00, 0x00, 0x00, 
-  0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 
-  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF6, 0x00, 0x00, 0x00, 0x05, 0xE7, 
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 
-  0x00, 0x00, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x05, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 
-  0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xDA, 
-  0x20, 0x00, 0x00, 0x00, 0x04, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 
-  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x10, 
-  0x00, 0x00, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE4, 0x00, 0x00, 0x00, 0x0A, 0xF4, 0x00, 0x00, 0x00, 0x00, 
-  0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x00, 0x00, 0x00, 0x06, 0x95, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x1A, 
-  0xFF, 0xFB, 0x62, 0x4C, 0x43, 0xC2, 0x03, 0xAF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x14, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF1, 0xF0, 0x06, 0xBC, 0xDA, 0x20, 0x1F, 0x1F, 
-  0x08, 0x70, 0x02, 0xDF, 0x41, 0xF1, 0xF0, 0xF6, 0x00, 0x04, 0xFD, 0x1F, 0x1F, 0x0F, 0xE0, 0x00, 0x1F, 0xF1, 0xF1, 0xF0, 
-  0x22, 0x00, 0x02, 0xFD, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x6F, 0x71, 0xF1, 0xF0, 0x00, 0x00, 0x0B, 0xD0, 0x1F, 0x1F, 0x00, 
-  0x00, 0x02, 0xF2, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x95, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x0A, 0x00, 0x01, 0xF1, 0xF0, 0x00, 
-  0x02, 0x60, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x11, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x01, 0x10, 0x00, 0x1F, 0x1F, 0x00, 0x03, 
-  0xFD, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x21, 0x00, 0x01, 0xF1, 0xCC, 0xCC, 0xCC, 
-  0xCC, 0xCC, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00
+  /*index table: glyph width, box x, y, w, h, offset hl (bit 7: RLE), lh, ll*/
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /*0x20*/
+  0x07, 0x03, 0x06, 0x02, 0x0E, 0x00, 0x00, 0x00, /*'!'*/
+  0x0A, 0x02, 0x06, 0x06, 0x06, 0x00, 0x00, 0x0E, /*'"'*/
+  0x0D, 0x01, 0x06, 0x0B, 0x0E, 0x00, 0x00, 0x20, /*'#'*/
+  0x0B, 0x01, 0x04, 0x09, 0x12, 0x00, 0x00, 0x6D, /*'$'*/
+  0x12, 0x01, 0x05, 0x10, 0x0F, 0x00, 0x00, 0xBE, /*'%'*/
+  0x11, 0x01, 0x06, 0x10, 0x0E, 0x00, 0x01, 0x36, /*'&'*/
+  0x04, 0x01, 0x06, 0x02, 0x06, 0x00, 0x01, 0xA6, /*'''*/
+  0x07, 0x01, 0x05, 0x06, 0x13, 0x00, 0x01, 0xAC, /*'('*/
+  0x07, 0x00, 0x05, 0x06, 0x13, 0x00, 0x01, 0xE5, /*')'*/
+  0x0C, 0x01, 0x06, 0x09, 0x09, 0x00, 0x02, 0x1E, /*'*'*/
+  0x0D, 0x01, 0x09, 0x0B, 0x0B, 0x80, 0x02, 0x47, /*'+'*/
+  0x05, 0x01, 0x11, 0x03, 0x06, 0x00, 0x02, 0x66, /*','*/
+  0x07, 0x01, 0x0E, 0x05, 0x03, 0x80, 0x02, 0x6F, /*'-'*/
+  0x06, 0x02, 0x11, 0x02, 0x03, 0x00, 0x02, 0x72, /*'.'*/
+  0x07, 0x00, 0x05, 0x07, 0x0F, 0x00, 0x02, 0x75, /*'/'*/
+  0x0C, 0x01, 0x06, 0x0A, 0x0E, 0x00, 0x02, 0xAA, /*'0'*/
+  0x0B, 0x02, 0x05, 0x07, 0x0F, 0x00, 0x02, 0xF0, /*'1'*/
+  0x0C, 0x01, 0x06, 0x0A, 0x0E, 0x00, 0x03, 0x25, /*'2'*/
+  0x0B, 0x01, 0x06, 0x09, 0x0E, 0x00, 0x03, 0x6B, /*'3'*/
+  0x0C, 0x01, 0x05, 0x0A, 0x0F, 0x80, 0x03, 0xAA, /*'4'*/
+  0x0C, 0x01, 0x05, 0x0A, 0x0F, 0x00, 0x03, 0xEB, /*'5'*/
+  0x0C, 0x01, 0x04, 0x0A, 0x10, 0x00, 0x04, 0x36, /*'6'*/
+  0x0B, 0x00, 0x06, 0x0A, 0x0E, 0x80, 0x04, 0x86, /*'7'*/
+  0x0B, 0x01, 0x06, 0x09, 0x0E, 0x00, 0x04, 0xC5, /*'8'*/
+  0x0B, 0x01, 0x06, 0x09, 0x10, 0x00, 0x05, 0x04, /*'9'*/
+  0x05, 0x02, 0x0A, 0x02, 0x0A, 0x00, 0x05, 0x4C, /*':'*/
+  0x06, 0x02, 0x0A, 0x03, 0x0D, 0x00, 0x05, 0x56, /*';'*/
+  0x0D, 0x01, 0x08, 0x0B, 0x0D, 0x80, 0x05, 0x6A, /*'<'*/
+  0x0D, 0x01, 0x0B, 0x0B, 0x07, 0x80, 0x05, 0xAD, /*'='*/
+  0x0D, 0x01, 0x08, 0x0B, 0x0D, 0x80, 0x05, 0xB4, /*'>'*/
+  0x0A, 0x01, 0x06, 0x08, 0x0E, 0x00, 0x05, 0xF7, /*'?'*/
+  0x13, 0x02, 0x06, 0x0F, 0x0E, 0x00, 0x06, 0x2F, /*'@'*/
+  0x10, 0x00, 0x05, 0x10, 0x0F, 0x80, 0x06, 0x98, /*'A'*/
+  0x0E, 0x00, 0x06, 0x0D, 0x0E, 0x00, 0x07, 0x07, /*'B'*/
+  0x0F, 0x01, 0x06, 0x0E, 0x0E, 0x80, 0x07, 0x62, /*'C'*/
+  0x10, 0x00, 0x06, 0x0F, 0x0E, 0x80, 0x07, 0xB9, /*'D'*/
+  0x0E, 0x00, 0x06, 0x0E, 0x0E, 0x80, 0x08, 0x21, /*'E'*/
+  0x0D, 0x00, 0x06, 0x0C, 0x0E, 0x80, 0x08, 0x77, /*'F'*/
+  0x10, 0x01, 0x06, 0x0F, 0x0E, 0x00, 0x08, 0xC0, /*'G'*/
+  0x0F, 0x00, 0x06, 0x0F, 0x0E, 0x80, 0x09, 0x29, /*'H'*/
+  0x08, 0x00, 0x06, 0x08, 0x0E, 0x80, 0x09, 0x81, /*'I'*/
+  0x09, 0x00, 0x06, 0x08, 0x0E, 0x00, 0x09, 0xB7, /*'J'*/
+  0x10, 0x00, 0x06, 0x10, 0x0E, 0x00, 0x09, 0xEF, /*'K'*/
+  0x0D, 0x00, 0x06, 0x0D, 0x0E, 0x80, 0x0A, 0x5F, /*'L'*/
+  0x14, 0x00, 0x06, 0x14, 0x0E, 0x00, 0x0A, 0x9B, /*'M'*/
+  0x11, 0x00, 0x06, 0x11, 0x0E, 0x00, 0x0B, 0x27, /*'N'*/
+  0x10, 0x01, 0x06, 0x0E, 0x0E, 0x00, 0x0B, 0x9E, /*'O'*/
+  0x0D, 0x00, 0x06, 0x0C, 0x0E, 0x80, 0x0C, 0x00, /*'P'*/
+  0x10, 0x01, 0x06, 0x0F, 0x13, 0x00, 0x0C, 0x50, /*'Q'*/
+  0x0F, 0x00, 0x06, 0x0F, 0x0E, 0x00, 0x0C, 0xDF, /*'R'*/
+  0x0B, 0x00, 0x06, 0x0A, 0x0E, 0x00, 0x0D, 0x48, /*'S'*/
+  0x0E, 0x01, 0x06, 0x0D, 0x0E, 0x80, 0x0D, 0x8E, /*'T'*/
+  0x10, 0x00, 0x06, 0x0F, 0x0E, 0x80, 0x0D, 0xCA, /*'U'*/
+  0x10, 0x00, 0x06, 0x10, 0x0E, 0x80, 0x0E, 0x2C, /*'V'*/
+  0x15, 0x00, 0x06, 0x15, 0x0E, 0x00, 0x0E, 0x93, /*'W'*/
+  0x10, 0x00, 0x06, 0x10, 0x0E, 0x00, 0x0F, 0x26, /*'X'*/
+  0x10, 0x00, 0x06, 0x10, 0x0E, 0x80, 0x0F, 0x96, /*'Y'*/
+  0x0E, 0x01, 0x06, 0x0D, 0x0E, 0x80, 0x0F, 0xF2, /*'Z'*/
+  0x08, 0x02, 0x06, 0x05, 0x12, 0x80, 0x10, 0x4B, /*'['*/
+  0x07, 0x00, 0x05, 0x07, 0x0F, 0x00, 0x10, 0x74, /*'\'*/
+  0x08, 0x01, 0x06, 0x05, 0x12, 0x80, 0x10, 0xA9, /*']'*/
+  0x0A, 0x00, 0x06, 0x0A, 0x08, 0x00, 0x10, 0xD3, /*'^'*/
+  0x0B, 0x00, 0x16, 0x0B, 0x02, 0x80, 0x10, 0xFB, /*'_'*/
+  0x06, 0x00, 0x06, 0x05, 0x04, 0x00, 0x10, 0xFD, /*'`'*/
+  0x0A, 0x01, 0x0A, 0x09, 0x0A, 0x00, 0x11, 0x07, /*'a'*/
+  0x0C, 0x00, 0x04, 0x0B, 0x10, 0x00, 0x11, 0x34, /*'b'*/
+  0x0A, 0x01, 0x0A, 0x09, 0x0A, 0x00, 0x11, 0x8C, /*'c'*/
+  0x0C, 0x01, 0x04, 0x0B, 0x10, 0x00, 0x11, 0xB9, /*'d'*/
+  0x0B, 0x01, 0x0A, 0x09, 0x0A, 0x00, 0x12, 0x11, /*'e'*/
+  0x08, 0x00, 0x05, 0x08, 0x0F, 0x00, 0x12, 0x3E, /*'f'*/
+  0x0C, 0x01, 0x0A, 0x0B, 0x0F, 0x00, 0x12, 0x7A, /*'g'*/
+  0x0C, 0x00, 0x05, 0x0C, 0x0F, 0x80, 0x12, 0xCD, /*'h'*/
+  0x06, 0x00, 0x05, 0x06, 0x0F, 0x00, 0x13, 0x23, /*'i'*/
+  0x08, 0x00, 0x05, 0x06, 0x14, 0x80, 0x13, 0x50, /*'j'*/
+  0x0C, 0x00, 0x05, 0x0C, 0x0F, 0x00, 0x13, 0x83, /*'k'*/
+  0x06, 0x00, 0x05, 0x06, 0x0F, 0x00, 0x13, 0xDD, /*'l'*/
+  0x12, 0x00, 0x0A, 0x12, 0x0A, 0x00, 0x14, 0x0A, /*'m'*/
+  0x0C, 0x00, 0x0A, 0x0C, 0x0A, 0x00, 0x14, 0x64, /*'n'*/
+  0x0C, 0x01, 0x0A, 0x0A, 0x0A, 0x00, 0x14, 0xA0, /*'o'*/
+  0x0C, 0x00, 0x0A, 0x0B, 0x0F, 0x00, 0x14, 0xD2, /*'p'*/
+  0x0C, 0x01, 0x0A, 0x0B, 0x0F, 0x00, 0x15, 0x25, /*'q'*/
+  0x08, 0x00, 0x0A, 0x08, 0x0A, 0x00, 0x15, 0x78, /*'r'*/
+  0x09, 0x00, 0x0A, 0x08, 0x0A, 0x00, 0x15, 0xA0, /*'s'*/
+  0x07, 0x00, 0x07, 0x07, 0x0D, 0x00, 0x15, 0xC8, /*'t'*/
+  0x0C, 0x00, 0x0A, 0x0C, 0x0A, 0x00, 0x15, 0xF6, /*'u'*/
+  0x0C, 0x00, 0x0A, 0x0B, 0x0A, 0x00, 0x16, 0x32, /*'v'*/
+  0x10, 0x00, 0x0A, 0x10, 0x0A, 0x00, 0x16, 0x69, /*'w'*/
+  0x0B, 0x00, 0x0A, 0x0B, 0x0A, 0x00, 0x16, 0xB9, /*'x'*/
+  0x0B, 0x00, 0x0A, 0x0B, 0x0F, 0x00, 0x16, 0xF0, /*'y'*/
+  0x0A, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x17, 0x43, /*'z'*/
+  0x0B, 0x02, 0x06, 0x06, 0x13, 0x00, 0x17, 0x75, /*'{'*/
+  0x04, 0x01, 0x05, 0x02, 0x0F, 0x00, 0x17, 0xAE, /*'|'*/
+  0x0B, 0x03, 0x06, 0x06, 0x13, 0x00, 0x17, 0xBD, /*'}'*/
+  0x0B, 0x00, 0x0D, 0x0B, 0x04, 0x00, 0x17, 0xF6, /*'~'*/
+  0x0D, 0x00, 0x03, 0x0D, 0x13, 0x00, 0x18, 0x0C, /*0x7F*/
+  /*glyph boxes*/
+  0xBB, 0xFF, 0xFF, 0xEE, 0xCC, 0xAA, 0x88, 0x77, 0x55, 0x44, 0x22, 0x22, 0xFE, 0xCC, 0xDC, 0x00, 0xDC, 0xFF, 0x00, 0xFF,
+  0xDC, 0x00, 0xDC, 0xAA, 0x00, 0xAA, 0x76, 0x00, 0x76, 0x11, 0x00, 0x11, 0x00, 0x01, 0xF3, 0x02, 0xF1, 0x00, 0x00, 0x3F,
+  0x00, 0x5F, 0x00, 0x00, 0x06, 0xE0, 0x07, 0xC0, 0x00, 0x00, 0x8B, 0x00, 0xAA, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+  0x33, 0xE8, 0x33, 0xF7, 0x33, 0x00, 0x0F, 0x40, 0x0F, 0x30, 0x00, 0x02, 0xF1, 0x03, 0xF1, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x03, 0x38, 0xD3, 0x39, 0xC3, 0x30, 0x00, 0x9A, 0x00, 0xA9, 0x00, 0x00, 0x0B, 0x80, 0x0C, 0x70, 0x00, 0x00, 0xD6,
+  0x00, 0xE5, 0x00, 0x00, 0x0F, 0x40, 0x0F, 0x30, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x01, 0x4F, 0x41, 0x00, 0x09, 0xE7,
+  0xF6, 0xDA, 0x1A, 0xF4, 0x0E, 0x01, 0xD3, 0xFF, 0x00, 0xE0, 0x06, 0x3F, 0xF4, 0x0E, 0x00, 0x11, 0x9F, 0xF4, 0xE0, 0x00,
+  0x01, 0xBF, 0xFF, 0x20, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xD1, 0x00, 0x00, 0xE3, 0xFF, 0xA0, 0x00,
+  0x0E, 0x05, 0xFF, 0x50, 0x00, 0xE0, 0x0F, 0xFB, 0x00, 0x0E, 0x01, 0xFD, 0xF7, 0x00, 0xE0, 0x9F, 0x53, 0xAC, 0xAF, 0xBA,
+  0x30, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x30, 0x00, 0x00, 0x4C,
+  0xCF, 0xC8, 0x89, 0xCA, 0x00, 0x00, 0x07, 0xF7, 0x04, 0xF0, 0x01, 0xE2, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0xF0, 0x09, 0x80,
+  0x00, 0x00, 0xBF, 0x70, 0x02, 0xC0, 0x2E, 0x10, 0x00, 0x00, 0xFF, 0x20, 0x06, 0x60, 0xB6, 0x00, 0x00, 0x00, 0xFF, 0x00,
+  0x0B, 0x04, 0xD0, 0x00, 0x00, 0x00, 0xAF, 0x30, 0x94, 0x0C, 0x40, 0x17, 0xBB, 0xB2, 0x1A, 0xDA, 0x30, 0x5B, 0x03, 0xEE,
+  0x20, 0x6D, 0x00, 0x00, 0x00, 0xD2, 0x2E, 0xF3, 0x00, 0x1F, 0x00, 0x00, 0x06, 0x90, 0x9F, 0xA0, 0x00, 0x2E, 0x00, 0x00,
+  0x1D, 0x10, 0xEF, 0x40, 0x00, 0x79, 0x00, 0x00, 0x87, 0x00, 0xFF, 0x10, 0x01, 0xD2, 0x00, 0x01, 0xD0, 0x00, 0xBF, 0x20,
+  0x1B, 0x50, 0x00, 0x09, 0x50, 0x00, 0x1B, 0xEA, 0xA3, 0x00, 0x00, 0x00, 0x6D, 0xCB, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xF5, 0x00, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x6C, 0x00,
+  0x00, 0x00, 0x00, 0x0B, 0xFA, 0x18, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD7, 0x00, 0x7D, 0xFD, 0x70, 0x00, 0x2B,
+  0xFF, 0xC0, 0x00, 0x09, 0xE1, 0x00, 0x05, 0xF5, 0x3F, 0xF7, 0x00, 0x0D, 0x40, 0x00, 0x4F, 0x60, 0x08, 0xFF, 0x40, 0x59,
+  0x00, 0x00, 0xCF, 0x10, 0x00, 0xBF, 0xF4, 0xC1, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x1D, 0xFF, 0x40, 0x00, 0x00, 0xFF, 0x70,
+  0x00, 0x03, 0xFF, 0xD2, 0x00, 0x04, 0x9F, 0xF8, 0x33, 0x8E, 0x5B, 0xFF, 0xB9, 0xD3, 0x07, 0xDF, 0xFD, 0x81, 0x00, 0x7D,
+  0xFD, 0x40, 0xDC, 0xFF, 0xDC, 0xAA, 0x76, 0x11, 0x00, 0x00, 0x25, 0x00, 0x04, 0xA1, 0x00, 0x4C, 0x00, 0x02, 0xF3, 0x00,
+  0x0C, 0xB0, 0x00, 0x3F, 0x60, 0x00, 0x9F, 0x30, 0x00, 0xDF, 0x10, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xDF, 0x10, 0x00, 0x9F, 0x30, 0x00, 0x3F, 0x60, 0x00, 0x0C, 0xA0, 0x00, 0x02, 0xF2, 0x00, 0x00, 0x5B, 0x00, 0x00,
+  0x06, 0x90, 0x00, 0x00, 0x35, 0x52, 0x00, 0x00, 0x1A, 0x30, 0x00, 0x00, 0xC3, 0x00, 0x00, 0x3E, 0x10, 0x00, 0x0B, 0xA0,
+  0x00, 0x07, 0xF2, 0x00, 0x03, 0xF7, 0x00, 0x01, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01,
+  0xFD, 0x00, 0x03, 0xF9, 0x00, 0x06, 0xF4, 0x00, 0x0A, 0xD0, 0x00, 0x2F, 0x30, 0x00, 0xB6, 0x00, 0x09, 0x60, 0x00, 0x63,
+  0x00, 0x00, 0x00, 0x00, 0xDD, 0x00, 0x01, 0x20, 0x0F, 0xB0, 0x12, 0x9F, 0x50, 0xF5, 0x2E, 0xF2, 0x9D, 0x5F, 0x5D, 0xA4,
+  0x00, 0x07, 0xFB, 0x10, 0x00, 0x7C, 0x3F, 0x3D, 0xB6, 0x0E, 0x60, 0xF5, 0x1C, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00,
+  0xCB, 0x00, 0x00, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x42, 0x1F, 0x32, 0xAF, 0x45,
+  0x1F, 0x35, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x40, 0x1F, 0x30, 0x25, 0x0E, 0xFB, 0xCF, 0xF0, 0x1D,
+  0x09, 0x45, 0x50, 0x42, 0x4F, 0x44, 0x33, 0xFE, 0xCB, 0x00, 0x00, 0x2F, 0x60, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x2F, 0x60, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x2F, 0x50, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x3F, 0x50, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x08, 0xF1, 0x00, 0x00, 0xDB, 0x00,
+  0x00, 0x00, 0x00, 0x3B, 0x9A, 0xB3, 0x00, 0x04, 0xF4, 0x00, 0x4F, 0x40, 0x1E, 0xA0, 0x00, 0x0B, 0xE1, 0x7F, 0x50, 0x00,
+  0x06, 0xF6, 0xBF, 0x20, 0x00, 0x03, 0xFB, 0xEF, 0x10, 0x00, 0x01, 0xFE, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0xEF, 0x10, 0x00, 0x01, 0xFE, 0xBF, 0x20, 0x00, 0x02, 0xFB, 0x6F, 0x50, 0x00, 0x05, 0xF6, 0x1E, 0xA0, 0x00,
+  0x0A, 0xE1, 0x04, 0xF3, 0x00, 0x3F, 0x40, 0x00, 0x3B, 0x9A, 0xB3, 0x00, 0x00, 0x03, 0xA0, 0x00, 0x3B, 0xFF, 0x00, 0x13,
+  0x2F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x01, 0xFF,
+  0x00, 0x06, 0xBF, 0xF9, 0x60, 0x00, 0x7D, 0xFF, 0xB3, 0x00, 0x0B, 0xEA, 0xBF, 0xFF, 0x30, 0x6A, 0x00, 0x01, 0xCF, 0xC0,
+  0xB0, 0x00, 0x00, 0x3F, 0xF0, 0x20, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0x00, 0x00, 0x7F, 0x10,
+  0x00, 0x00, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x0B, 0x50, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x09, 0x40, 0x00, 0x00,
+  0x00, 0x93, 0x00, 0x00, 0x08, 0x0B, 0xDB, 0xBB, 0xBB, 0xD8, 0xCF, 0xFF, 0xFF, 0xFF, 0xF2, 0x01, 0xAE, 0xFE, 0x80, 0x01,
+  0xC8, 0x57, 0xFF, 0xA0, 0x72, 0x00, 0x04, 0xFF, 0x03, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x04, 0xF4, 0x00, 0x00, 0x03,
+  0xD4, 0x00, 0x00, 0x3A, 0xFF, 0xF8, 0x00, 0x01, 0x25, 0xBF, 0xF8, 0x00, 0x00, 0x00, 0x9F, 0xE0, 0x00, 0x00, 0x02, 0xFF,
+  0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x00, 0x05, 0xF5, 0xCB, 0x40, 0x03, 0xE7, 0x08, 0xFF, 0xDA, 0x92, 0x00, 0x50, 0x08,
+  0x0F, 0x10, 0x40, 0x03, 0x1F, 0x10, 0x30, 0x01, 0x0B, 0x1F, 0x10, 0x30, 0x09, 0x03, 0x1F, 0x10, 0x20, 0x04, 0x08, 0x00,
+  0x1F, 0x10, 0x10, 0x01, 0x0B, 0x10, 0x1F, 0x10, 0x10, 0x0A, 0x03, 0x10, 0x1F, 0x10, 0x00, 0x05, 0x08, 0x20, 0x1F, 0x10,
+  0x02, 0x0B, 0x30, 0x1F, 0x10, 0x0B, 0x04, 0x32, 0x1F, 0x12, 0x9F, 0x55, 0x1F, 0x15, 0x50, 0x1F, 0x10, 0x50, 0x1F, 0x10,
+  0x50, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x3F, 0xFF, 0xFF, 0xD0, 0x00, 0xBC, 0xCC, 0xCB, 0x40, 0x03, 0xC0,
+  0x00, 0x00, 0x00, 0x0A, 0xB5, 0x10, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x40, 0x00, 0x14, 0x6A, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+  0x1B, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xBF, 0xD0, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,
+  0x00, 0x2F, 0xB0, 0x11, 0x00, 0x00, 0x7F, 0x40, 0xFF, 0x70, 0x05, 0xF6, 0x00, 0x7E, 0xFE, 0xB9, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0x73, 0x00, 0x00, 0x3A, 0xC5, 0x10, 0x00, 0x09, 0xF7, 0x00, 0x00, 0x00, 0xBF, 0x50, 0x00, 0x00, 0x08, 0xF9,
+  0x00, 0x00, 0x00, 0x2F, 0xF1, 0x00, 0x00, 0x00, 0x8F, 0xC8, 0xEF, 0xEA, 0x10, 0xDF, 0xC3, 0x02, 0x9F, 0xE1, 0xFF, 0x30,
+  0x00, 0x0B, 0xF9, 0xFF, 0x00, 0x00, 0x04, 0xFE, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xDF, 0x20, 0x00, 0x00, 0xFF, 0x8F, 0x50,
+  0x00, 0x01, 0xFC, 0x2F, 0xB0, 0x00, 0x04, 0xF5, 0x05, 0xF6, 0x00, 0x0C, 0xA0, 0x00, 0x3B, 0xB9, 0xB6, 0x00, 0x00, 0x06,
+  0x7F, 0x00, 0x0C, 0x0D, 0x4A, 0x0F, 0x0A, 0x03, 0x09, 0x40, 0x01, 0x0F, 0x04, 0x01, 0x50, 0x06, 0x0F, 0x00, 0x60, 0x0C,
+  0x09, 0x00, 0x50, 0x02, 0x0F, 0x04, 0x00, 0x50, 0x07, 0x0E, 0x10, 0x50, 0x0D, 0x09, 0x10, 0x40, 0x03, 0x0F, 0x03, 0x10,
+  0x40, 0x08, 0x0E, 0x20, 0x40, 0x0E, 0x09, 0x20, 0x30, 0x03, 0x0F, 0x03, 0x20, 0x30, 0x09, 0x0E, 0x30, 0x30, 0x0E, 0x08,
+  0x30, 0x04, 0xBA, 0xBD, 0x70, 0x06, 0xF6, 0x00, 0x7F, 0x90, 0xEF, 0x00, 0x01, 0xFF, 0x0F, 0xF2, 0x00, 0x0F, 0xE0, 0xBF,
+  0x90, 0x04, 0xF6, 0x01, 0xDF, 0x71, 0xB5, 0x00, 0x01, 0xAF, 0xF7, 0x00, 0x00, 0x1B, 0x9F, 0xFC, 0x20, 0x2E, 0x80, 0x2C,
+  0xFF, 0x3C, 0xF2, 0x00, 0x0B, 0xFC, 0xFF, 0x00, 0x00, 0x2F, 0xFE, 0xF2, 0x00, 0x01, 0xFD, 0x5F, 0xB0, 0x00, 0x7F, 0x50,
+  0x4B, 0xCA, 0xAB, 0x40, 0x00, 0x8B, 0xAC, 0x60, 0x00, 0xBB, 0x00, 0x2F, 0x70, 0x6F, 0x40, 0x00, 0x8F, 0x2C, 0xF1, 0x00,
+  0x04, 0xF9, 0xFF, 0x00, 0x00, 0x2F, 0xDF, 0xF1, 0x00, 0x00, 0xFF, 0xEF, 0x30, 0x00, 0x0F, 0xFA, 0xF8, 0x00, 0x01, 0xFF,
+  0x2F, 0xF5, 0x02, 0xAF, 0xC0, 0x3B, 0xFE, 0x96, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0x20, 0x00, 0x00, 0x3F, 0x90, 0x00, 0x00,
+  0x1D, 0xD1, 0x00, 0x00, 0x2D, 0xC2, 0x00, 0x02, 0x8D, 0x60, 0x00, 0x03, 0x73, 0x00, 0x00, 0x00, 0xBB, 0xFE, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x33, 0xFE, 0xCB, 0xBB, 0x0F, 0xF0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x50, 0xEF, 0xBC,
+  0xFF, 0x01, 0xD0, 0x94, 0x55, 0x00, 0x90, 0x01, 0x70, 0x02, 0x09, 0x0F, 0x50, 0x03, 0x0A, 0x1F, 0x09, 0x30, 0x04, 0x0B,
+  0x1F, 0x08, 0x01, 0x00, 0x10, 0x06, 0x0D, 0x0F, 0x0E, 0x07, 0x01, 0x20, 0x07, 0x0E, 0x0F, 0x0C, 0x05, 0x50, 0x1F, 0x07,
+  0x70, 0x07, 0x0E, 0x0F, 0x0C, 0x05, 0x50, 0x10, 0x06, 0x0D, 0x0F, 0x0E, 0x06, 0x01, 0x20, 0x30, 0x04, 0x0C, 0x1F, 0x08,
+  0x01, 0x00, 0x50, 0x03, 0x0A, 0x1F, 0x09, 0x70, 0x02, 0x09, 0x0F, 0x90, 0x01, 0xA2, 0xAF, 0xA5, 0xA0, 0xA2, 0xAF, 0xA5,
+  0x01, 0x90, 0x0F, 0x09, 0x02, 0x70, 0x09, 0x1F, 0x0A, 0x03, 0x50, 0x00, 0x01, 0x08, 0x1F, 0x0B, 0x04, 0x30, 0x20, 0x01,
+  0x07, 0x0E, 0x0F, 0x0D, 0x06, 0x10, 0x50, 0x05, 0x0C, 0x0F, 0x0E, 0x07, 0x70, 0x07, 0x1F, 0x50, 0x05, 0x0C, 0x0F, 0x0E,
+  0x07, 0x20, 0x01, 0x06, 0x0E, 0x0F, 0x0D, 0x06, 0x10, 0x00, 0x01, 0x08, 0x1F, 0x0C, 0x04, 0x30, 0x09, 0x1F, 0x0A, 0x03,
+  0x50, 0x0F, 0x09, 0x02, 0x70, 0x01, 0x90, 0x07, 0xAB, 0xDC, 0x40, 0x86, 0x00, 0x0A, 0xF6, 0xF8, 0x00, 0x02, 0xFE, 0xEE,
+  0x00, 0x01, 0xFF, 0x12, 0x00, 0x03, 0xFA, 0x00, 0x00, 0x09, 0xF2, 0x00, 0x00, 0x1F, 0x40, 0x00, 0x00, 0x86, 0x00, 0x00,
+  0x00, 0xA0, 0x00, 0x00, 0x02, 0x50, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,
+  0x0C, 0xC0, 0x00, 0x00, 0x00, 0x5B, 0xCB, 0xBB, 0xA3, 0x00, 0x00, 0x02, 0xDC, 0x30, 0x00, 0x03, 0xC9, 0x00, 0x03, 0xFB,
+  0x00, 0x00, 0x00, 0x00, 0xAB, 0x01, 0xEE, 0x10, 0x05, 0xDF, 0xA8, 0x80, 0xD6, 0x8F, 0x80, 0x07, 0xFA, 0x16, 0xF9, 0x05,
+  0xDD, 0xF3, 0x03, 0xFC, 0x00, 0x3F, 0x50, 0x1F, 0xFF, 0x10, 0xAF, 0x40, 0x06, 0xF1, 0x00, 0xFF, 0xF0, 0x0E, 0xF1, 0x00,
+  0xAC, 0x00, 0x3C, 0xEF, 0x20, 0xFF, 0x10, 0x2F, 0x80, 0x0A, 0x69, 0xF7, 0x0C, 0xF8, 0x38, 0xF8, 0x06, 0xB0, 0x2F, 0xE1,
+  0x2C, 0xD8, 0x14, 0xCB, 0x70, 0x00, 0x4F, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xE6, 0x10, 0x00, 0x38, 0x50,
+  0x00, 0x00, 0x06, 0xBE, 0xED, 0xDA, 0x40, 0x00, 0x60, 0x0A, 0x04, 0x60, 0x50, 0x02, 0x0F, 0x0B, 0x60, 0x50, 0x08, 0x1F,
+  0x02, 0x50, 0x50, 0x0E, 0x0B, 0x0F, 0x09, 0x50, 0x40, 0x05, 0x09, 0x03, 0x1F, 0x01, 0x40, 0x40, 0x0C, 0x03, 0x00, 0x0C,
+  0x0F, 0x07, 0x40, 0x30, 0x03, 0x0C, 0x10, 0x05, 0x0F, 0x0D, 0x40, 0x30, 0x0A, 0x05, 0x20, 0x0E, 0x0F, 0x04, 0x30, 0x20,
+  0x01, 0x0D, 0x30, 0x07, 0x0F, 0x0B, 0x30, 0x20, 0x07, 0x0F, 0x4E, 0x1F, 0x02, 0x20, 0x20, 0x0D, 0x01, 0x40, 0x0A, 0x0F,
+  0x09, 0x20, 0x10, 0x05, 0x0A, 0x50, 0x04, 0x1F, 0x01, 0x10, 0x10, 0x0C, 0x04, 0x60, 0x0D, 0x0F, 0x07, 0x10, 0x00, 0x04,
+  0x0F, 0x01, 0x60, 0x09, 0x0F, 0x0E, 0x01, 0x00, 0x07, 0x1F, 0x0A, 0x04, 0x30, 0x01, 0x07, 0x0D, 0x1F, 0x0C, 0x04, 0x18,
+  0xCF, 0xFE, 0xDE, 0xFD, 0x92, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x5F, 0xF4, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xD0, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x4F, 0xD0, 0x00, 0xFF, 0x00, 0x01, 0x5E, 0xF4, 0x00, 0x0F,
+  0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0xFF, 0x00, 0x03, 0x8F, 0xE2, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0xFF,
+  0x00, 0x00, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x05, 0xFB, 0x00, 0x1F, 0xF1,
+  0x00, 0x06, 0xFF, 0x21, 0x7C, 0xFF, 0xFD, 0xEF, 0xD9, 0x20, 0x20, 0x01, 0x08, 0x0C, 0x1E, 0x4F, 0x00, 0x10, 0x05, 0x0F,
+  0x0B, 0x04, 0x20, 0x04, 0x0C, 0x1F, 0x00, 0x00, 0x06, 0x0F, 0x09, 0x60, 0x0B, 0x0F, 0x00, 0x02, 0x0F, 0x0D, 0x70, 0x01,
+  0x0F, 0x00, 0x09, 0x0F, 0x06, 0x80, 0x09, 0x00, 0x0D, 0x0F, 0x02, 0xA0, 0x1F, 0xB0, 0x1F, 0xB0, 0x0E, 0x0F, 0x02, 0xA0,
+  0x0A, 0x0F, 0x06, 0xA0, 0x03, 0x0F, 0x0D, 0xA0, 0x00, 0x09, 0x0F, 0x09, 0x60, 0x01, 0x09, 0x02, 0x10, 0x08, 0x0F, 0x0D,
+  0x05, 0x01, 0x10, 0x03, 0x08, 0x0D, 0x05, 0x00, 0x20, 0x02, 0x09, 0x0D, 0x2F, 0x0C, 0x07, 0x01, 0x10, 0x07, 0x0C, 0x1F,
+  0x0E, 0x0D, 0x1E, 0x0D, 0x0A, 0x05, 0x30, 0x00, 0x01, 0x1F, 0x01, 0x10, 0x01, 0x04, 0x09, 0x0F, 0x0E, 0x04, 0x10, 0x10,
+  0x1F, 0x50, 0x02, 0x0E, 0x0F, 0x05, 0x00, 0x10, 0x1F, 0x60, 0x02, 0x1F, 0x02, 0x10, 0x1F, 0x70, 0x08, 0x0F, 0x09, 0x10,
+  0x1F, 0x70, 0x03, 0x0F, 0x0E, 0x10, 0x1F, 0x80, 0x1F, 0x10, 0x1F, 0x80, 0x1F, 0x10, 0x1F, 0x70, 0x02, 0x0F, 0x0D, 0x10,
+  0x1F, 0x70, 0x07, 0x0F, 0x09, 0x10, 0x1F, 0x60, 0x01, 0x0E, 0x0F, 0x02, 0x10, 0x1F, 0x50, 0x01, 0x0C, 0x0F, 0x05, 0x00,
+  0x00, 0x01, 0x1F, 0x01, 0x20, 0x03, 0x08, 0x0F, 0x0E, 0x05, 0x10, 0x07, 0x0C, 0x1F, 0x0E, 0x0D, 0x1E, 0x0D, 0x0A, 0x06,
+  0x30, 0x07, 0x0D, 0x1F, 0x0E, 0x2D, 0x0E, 0x2F, 0x10, 0x00, 0x01, 0x1F, 0x50, 0x05, 0x0F, 0x10, 0x10, 0x1F, 0x60, 0x0B,
+  0x10, 0x10, 0x1F, 0x90, 0x10, 0x1F, 0x40, 0x02, 0x08, 0x20, 0x10, 0x1F, 0x30, 0x01, 0x09, 0x08, 0x20, 0x10, 0x1F, 0x3E,
+  0x1F, 0x08, 0x20, 0x10, 0x1F, 0x30, 0x01, 0x09, 0x08, 0x20, 0x10, 0x1F, 0x40, 0x02, 0x08, 0x20, 0x10, 0x1F, 0x90, 0x10,
+  0x1F, 0x70, 0x06, 0x01, 0x10, 0x1F, 0x60, 0x03, 0x0D, 0x00, 0x00, 0x01, 0x1F, 0x01, 0x40, 0x05, 0x0E, 0x09, 0x00, 0x07,
+  0x0C, 0x2F, 0x2D, 0x0E, 0x2F, 0x05, 0x00, 0x07, 0x0D, 0x1F, 0x0E, 0x2D, 0x0E, 0x2F, 0x00, 0x01, 0x1F, 0x50, 0x04, 0x0F,
+  0x10, 0x1F, 0x60, 0x0A, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x40, 0x02, 0x08, 0x00, 0x10, 0x1F, 0x30, 0x01, 0x0A, 0x08, 0x00,
+  0x10, 0x1F, 0x3E, 0x1F, 0x08, 0x00, 0x10, 0x1F, 0x30, 0x01, 0x0A, 0x08, 0x00, 0x10, 0x1F, 0x40, 0x02, 0x08, 0x00, 0x10,
+  0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70, 0x00, 0x01, 0x1F, 0x01, 0x60, 0x07, 0x0C, 0x1F, 0x0C, 0x08, 0x01, 0x40,
+  0x00, 0x01, 0x8D, 0xFE, 0xFF, 0xFF, 0xC0, 0x00, 0x06, 0xFB, 0x40, 0x00, 0x4D, 0xFC, 0x00, 0x06, 0xF9, 0x00, 0x00, 0x00,
+  0x1D, 0xC0, 0x02, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x50, 0x0D, 0xF2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xAC, 0xCA, 0x4F, 0xF0, 0x00, 0x00, 0x00, 0x02, 0xFF, 0x20,
+  0xEF, 0x20, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x0A, 0xF6, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3F, 0xD0, 0x00, 0x00, 0x00,
+  0x0F, 0xF0, 0x00, 0x9F, 0x90, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F, 0xC5, 0x00, 0x01, 0x7F, 0xD0, 0x00, 0x00, 0x28,
+  0xCF, 0xED, 0xC9, 0x40, 0x00, 0x07, 0x0C, 0x1F, 0x0C, 0x07, 0x20, 0x07, 0x0C, 0x1F, 0x0C, 0x07, 0x00, 0x01, 0x1F, 0x01,
+  0x40, 0x01, 0x1F, 0x01, 0x00, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10,
+  0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0xAF, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0x1F,
+  0x60, 0x1F, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x10, 0x1F, 0x60, 0x1F, 0x10, 0x00, 0x01, 0x1F, 0x01, 0x40, 0x01, 0x1F,
+  0x01, 0x00, 0x07, 0x0C, 0x1F, 0x0D, 0x08, 0x20, 0x08, 0x0C, 0x1F, 0x0D, 0x07, 0x01, 0x08, 0x0C, 0x1F, 0x0C, 0x08, 0x01,
+  0x10, 0x01, 0x1F, 0x01, 0x10, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20,
+  0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x20, 0x1F, 0x20, 0x10, 0x01, 0x1F, 0x01, 0x10,
+  0x01, 0x08, 0x0C, 0x1F, 0x0C, 0x08, 0x01, 0x00, 0x8C, 0xFF, 0xC8, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x18, 0x20, 0xFC, 0x00, 0x7F, 0xA2, 0xF6, 0x00, 0x2C,
+  0xFC, 0x70, 0x00, 0x8C, 0xFF, 0xC8, 0x10, 0x5A, 0xFF, 0xC8, 0x10, 0x01, 0xFF, 0x10, 0x00, 0x03, 0xF6, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x2D, 0x50, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x04, 0xD4, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x6E, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x09, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x8F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x2E, 0xFD,
+  0x10, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x02, 0xEF, 0xC1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xFC, 0x10, 0x00, 0x01,
+  0xFF, 0x10, 0x00, 0x05, 0xFF, 0xD1, 0x00, 0x7C, 0xFF, 0xB7, 0x00, 0x48, 0xFF, 0xFE, 0x81, 0x07, 0x0D, 0x1F, 0x0C, 0x08,
+  0x60, 0x00, 0x01, 0x1F, 0x01, 0x70, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F,
+  0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x80, 0x10, 0x1F, 0x70, 0x06, 0x10, 0x1F, 0x60, 0x07, 0x06, 0x00,
+  0x01, 0x1F, 0x01, 0x30, 0x02, 0x09, 0x0F, 0x02, 0x07, 0x0C, 0x2F, 0x2E, 0x2F, 0x0D, 0x00, 0x18, 0xCF, 0xFA, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xFF, 0xC7, 0x00, 0x1F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0x10, 0x00, 0x0F, 0xFF, 0xA0, 0x00,
+  0x00, 0x00, 0x7C, 0xFF, 0x00, 0x00, 0x0F, 0x7F, 0xF2, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0x00, 0x00, 0x0F, 0x1F, 0xFA, 0x00,
+  0x00, 0x06, 0xC0, 0xFF, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x20, 0x00, 0x0D, 0x40, 0xFF, 0x00, 0x00, 0x0F, 0x01, 0xFF, 0xA0,
+  0x00, 0x5C, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x7F, 0xF2, 0x00, 0xD5, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xFA,
+  0x04, 0xD0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x07, 0xFF, 0x2C, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x01, 0xFF,
+  0xCD, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x7F, 0xF5, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0x30, 0x00, 0x1F,
+  0xD0, 0x00, 0x01, 0xFF, 0x10, 0x18, 0xDF, 0xE8, 0x10, 0x08, 0x60, 0x01, 0x8C, 0xFF, 0xD7, 0x18, 0xFF, 0xF2, 0x00, 0x00,
+  0x18, 0xEF, 0xE8, 0x10, 0x03, 0xFF, 0xD1, 0x00, 0x00, 0x03, 0xF3, 0x00, 0x00, 0x0F, 0xFF, 0xB0, 0x00, 0x00, 0x1F, 0x00,
+  0x00, 0x00, 0xF4, 0xFF, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0x50, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0,
+  0x09, 0xFF, 0x30, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x0B, 0xFE, 0x10, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1D, 0xFC,
+  0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x2F, 0xF9, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x4F, 0xF6, 0xF0, 0x00,
+  0x00, 0x0F, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x8F, 0xF0, 0x00, 0x00, 0x3F, 0x30,
+  0x00, 0x00, 0x00, 0xAF, 0x00, 0x01, 0x8D, 0xFD, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x02, 0x9D, 0xDC, 0xD9, 0x30,
+  0x00, 0x00, 0x7F, 0x71, 0x00, 0x18, 0xF8, 0x00, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x2F, 0xC0, 0x00, 0x00, 0x00,
+  0x0B, 0xF2, 0x9F, 0x50, 0x00, 0x00, 0x00, 0x06, 0xF9, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x02, 0xFD, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x9F, 0x60, 0x00,
+  0x00, 0x00, 0x06, 0xFA, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xF3, 0x08, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0x80, 0x00, 0x8F,
+  0x60, 0x00, 0x17, 0xF8, 0x00, 0x00, 0x03, 0xAD, 0xCC, 0xD9, 0x30, 0x00, 0x07, 0x0C, 0x1F, 0x0E, 0x0D, 0x1E, 0x0B, 0x06,
+  0x10, 0x00, 0x01, 0x1F, 0x20, 0x02, 0x07, 0x0F, 0x0E, 0x02, 0x10, 0x1F, 0x40, 0x06, 0x0F, 0x0B, 0x10, 0x1F, 0x40, 0x01,
+  0x1F, 0x10, 0x1F, 0x40, 0x01, 0x1F, 0x10, 0x1F, 0x40, 0x06, 0x0F, 0x09, 0x10, 0x1F, 0x20, 0x02, 0x08, 0x0F, 0x0C, 0x01,
+  0x10, 0x1F, 0x0D, 0x1E, 0x0D, 0x0A, 0x05, 0x10, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70,
+  0x00, 0x01, 0x1F, 0x01, 0x60, 0x06, 0x0C, 0x1F, 0x0D, 0x08, 0x03, 0x40, 0x00, 0x02, 0x9D, 0xDD, 0xD9, 0x20, 0x00, 0x00,
+  0x06, 0xF9, 0x10, 0x01, 0x8F, 0x60, 0x00, 0x05, 0xF7, 0x00, 0x00, 0x00, 0x8F, 0x50, 0x01, 0xFD, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0x10, 0x7F, 0x70, 0x00, 0x00, 0x00, 0x07, 0xF7, 0x0C, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x10, 0x00,
+  0x00, 0x00, 0x01, 0xFF, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x0D,
+  0xF2, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xD0, 0x9F, 0x60, 0x00, 0x00, 0x00, 0x07, 0xF9, 0x02, 0xFC, 0x00, 0x00, 0x00, 0x00,
+  0xDF, 0x20, 0x07, 0xF5, 0x00, 0x00, 0x00, 0x6F, 0x80, 0x00, 0x07, 0xF7, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x03, 0xAF,
+  0xBC, 0xEB, 0x40, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4D, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7A, 0xA8, 0x20, 0x7D, 0xFF, 0xED, 0xEF, 0xC8,
+  0x20, 0x00, 0x00, 0x1F, 0xF0, 0x00, 0x05, 0xEF, 0x40, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x04, 0xFC, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x37, 0xFD, 0x20, 0x00,
+  0x00, 0xFF, 0xDE, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x2F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x5F, 0xF9,
+  0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x8F, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xBF, 0xF2, 0x00, 0x00, 0x0F, 0xF0,
+  0x00, 0x01, 0xDF, 0xD0, 0x00, 0x02, 0xFF, 0x10, 0x00, 0x02, 0xFF, 0xA0, 0x07, 0xCF, 0xFC, 0x82, 0x00, 0x05, 0xFF, 0xB3,
+  0x00, 0x5D, 0xFF, 0xFF, 0xF3, 0x06, 0xF9, 0x00, 0x3D, 0xF4, 0x0E, 0xF1, 0x00, 0x01, 0xE6, 0x0F, 0xF3, 0x00, 0x00, 0x57,
+  0x0D, 0xFD, 0x20, 0x00, 0x05, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xD4, 0x00, 0x00, 0x01, 0x7F, 0xFF, 0x80,
+  0x00, 0x00, 0x01, 0xAF, 0xF6, 0x20, 0x00, 0x00, 0x09, 0xFE, 0x84, 0x00, 0x00, 0x01, 0xFF, 0x6E, 0x10, 0x00, 0x01, 0xFC,
+  0x4F, 0xD3, 0x00, 0x1B, 0xF3, 0x1F, 0xFF, 0xED, 0xEA, 0x20, 0xBF, 0x08, 0x0F, 0x07, 0x01, 0x10, 0x1F, 0x20, 0x03, 0x0E,
+  0x08, 0x0D, 0x30, 0x1F, 0x30, 0x06, 0x08, 0x05, 0x30, 0x1F, 0x30, 0x01, 0x05, 0x40, 0x1F, 0x50, 0x40, 0x1F, 0x50, 0x40,
+  0x1F, 0x50, 0x40, 0x1F, 0x50, 0x40, 0x1F, 0x50, 0x40, 0x1F, 0x50, 0x40, 0x1F, 0x50, 0x40, 0x1F, 0x50, 0x30, 0x01, 0x1F,
+  0x01, 0x40, 0x20, 0x07, 0x0C, 0x1F, 0x0C, 0x08, 0x02, 0x20, 0x08, 0x0D, 0x1F, 0x0C, 0x08, 0x20, 0x01, 0x08, 0x0E, 0x0F,
+  0x0E, 0x08, 0x00, 0x01, 0x1F, 0x01, 0x50, 0x03, 0x0F, 0x03, 0x00, 0x10, 0x1F, 0x70, 0x0F, 0x10, 0x10, 0x1F, 0x70, 0x0F,
+  0x10, 0x10, 0x1F, 0x70, 0x0F, 0x10, 0x10, 0x1F, 0x70, 0x0F, 0x10, 0x10, 0x1F, 0x70, 0x0F, 0x10, 0x10, 0x1F, 0x70, 0x0F,
+  0x10, 0x10, 0x1F, 0x70, 0x0F, 0x10, 0x10, 0x1F, 0x60, 0x01, 0x0F, 0x10, 0x10, 0x0D, 0x0F, 0x03, 0x50, 0x03, 0x0C, 0x10,
+  0x10, 0x08, 0x0F, 0x09, 0x50, 0x0A, 0x07, 0x10, 0x10, 0x01, 0x0D, 0x0F, 0x08, 0x02, 0x10, 0x04, 0x0A, 0x0C, 0x20, 0x20,
+  0x01, 0x07, 0x0D, 0x2F, 0x0D, 0x07, 0x01, 0x20, 0x01, 0x09, 0x2F, 0x09, 0x05, 0x30, 0x05, 0x0A, 0x0F, 0x0E, 0x07, 0x10,
+  0x07, 0x1F, 0x02, 0x50, 0x01, 0x0F, 0x04, 0x00, 0x20, 0x0E, 0x0F, 0x08, 0x50, 0x05, 0x0D, 0x10, 0x20, 0x07, 0x1F, 0x01,
+  0x40, 0x0C, 0x06, 0x10, 0x20, 0x01, 0x1F, 0x08, 0x30, 0x03, 0x0F, 0x20, 0x30, 0x07, 0x1F, 0x01, 0x20, 0x09, 0x08, 0x20,
+  0x30, 0x01, 0x1F, 0x07, 0x10, 0x01, 0x0F, 0x02, 0x20, 0x40, 0x08, 0x0F, 0x0E, 0x10, 0x07, 0x0B, 0x30, 0x40, 0x01, 0x1F,
+  0x06, 0x00, 0x0E, 0x04, 0x30, 0x50, 0x09, 0x0F, 0x0E, 0x05, 0x0D, 0x40, 0x50, 0x02, 0x2F, 0x07, 0x40, 0x60, 0x0A, 0x1F,
+  0x01, 0x40, 0x60, 0x02, 0x0F, 0x09, 0x50, 0x70, 0x0A, 0x02, 0x50, 0x8F, 0xFF, 0x93, 0x18, 0xFF, 0xFA, 0x50, 0x00, 0x8E,
+  0xFB, 0x20, 0x5F, 0xF1, 0x00, 0x05, 0xFF, 0x20, 0x00, 0x00, 0x9B, 0x00, 0x00, 0xEF, 0x70, 0x00, 0x0E, 0xF7, 0x00, 0x00,
+  0x0C, 0x50, 0x00, 0x07, 0xFD, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x02, 0xE0, 0x00, 0x00, 0x2F, 0xF4, 0x00, 0x07, 0xFF, 0x40,
+  0x00, 0x88, 0x00, 0x00, 0x00, 0xBF, 0xA0, 0x00, 0xDC, 0xFB, 0x00, 0x0E, 0x20, 0x00, 0x00, 0x05, 0xFF, 0x10, 0x4D, 0x3F,
+  0xF1, 0x04, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xF7, 0x0A, 0x60, 0xDF, 0x70, 0xA6, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xE1, 0xF1,
+  0x07, 0xFE, 0x1F, 0x10, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xBA, 0x00, 0x1F, 0xFB, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF,
+  0x40, 0x00, 0xAF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x04, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xF7, 0x00, 0x00, 0x0D, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x20, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x19, 0xEF,
+  0xFF, 0x95, 0x00, 0x4A, 0xFF, 0xB6, 0x00, 0x1D, 0xFF, 0x20, 0x00, 0x03, 0xF5, 0x00, 0x00, 0x02, 0xFF, 0xA0, 0x00, 0x1D,
+  0x60, 0x00, 0x00, 0x00, 0x4F, 0xF5, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0x18, 0xB0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xDF, 0xDD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xD6, 0xBF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x90, 0x1F, 0xFA, 0x00, 0x00, 0x00, 0x00,
+  0xAB, 0x00, 0x05, 0xFF, 0x50, 0x00, 0x00, 0x08, 0xD1, 0x00, 0x00, 0xBF, 0xF2, 0x00, 0x00, 0x6F, 0x30, 0x00, 0x00, 0x2F,
+  0xFD, 0x10, 0x3B, 0xFF, 0xA6, 0x00, 0x05, 0xAF, 0xFF, 0xD7, 0x04, 0x0C, 0x2F, 0x0A, 0x05, 0x20, 0x04, 0x0A, 0x1F, 0x0A,
+  0x02, 0x10, 0x0B, 0x1F, 0x03, 0x40, 0x02, 0x0F, 0x05, 0x10, 0x10, 0x01, 0x0D, 0x0F, 0x0C, 0x40, 0x0B, 0x08, 0x20, 0x20,
+  0x03, 0x1F, 0x07, 0x20, 0x06, 0x0C, 0x30, 0x30, 0x06, 0x1F, 0x02, 0x00, 0x01, 0x0E, 0x02, 0x30, 0x40, 0x0B, 0x0F, 0x0D,
+  0x00, 0x0B, 0x07, 0x40, 0x40, 0x01, 0x0E, 0x0F, 0x0B, 0x0C, 0x50, 0x50, 0x04, 0x1F, 0x02, 0x50, 0x60, 0x1F, 0x60, 0x60,
+  0x1F, 0x60, 0x60, 0x1F, 0x60, 0x60, 0x1F, 0x60, 0x50, 0x02, 0x1F, 0x01, 0x50, 0x30, 0x03, 0x08, 0x0C, 0x1F, 0x0C, 0x08,
+  0x02, 0x30, 0x02, 0x2F, 0x0E, 0x3D, 0x2F, 0x05, 0x04, 0x0E, 0x04, 0x40, 0x01, 0x0E, 0x0F, 0x0A, 0x00, 0x16, 0x50, 0x0A,
+  0x0F, 0x0E, 0x01, 0x00, 0x05, 0x01, 0x40, 0x06, 0x1F, 0x03, 0x10, 0x50, 0x03, 0x1F, 0x07, 0x20, 0x40, 0x01, 0x0D, 0x0F,
+  0x0B, 0x30, 0x40, 0x0A, 0x0F, 0x0E, 0x01, 0x30, 0x30, 0x06, 0x1F, 0x03, 0x40, 0x20, 0x03, 0x1F, 0x07, 0x50, 0x10, 0x01,
+  0x0D, 0x0F, 0x0B, 0x60, 0x10, 0x0A, 0x0F, 0x0E, 0x01, 0x50, 0x07, 0x00, 0x06, 0x1F, 0x04, 0x50, 0x01, 0x0B, 0x03, 0x1F,
+  0x08, 0x50, 0x02, 0x0C, 0x0A, 0x0D, 0x1F, 0x5D, 0x0E, 0x1F, 0x08, 0x1F, 0x0B, 0x09, 0x08, 0x1F, 0x20, 0x1F, 0x20, 0x1F,
+  0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F,
+  0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x01, 0x10, 0x1C, 0x0B, 0x09, 0x08, 0xDA, 0x00, 0x00, 0x08, 0xF0, 0x00, 0x00, 0x3F,
+  0x50, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x08, 0xF1, 0x00,
+  0x00, 0x3F, 0x50, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x08, 0xF1, 0x00, 0x00, 0x3F, 0x50, 0x00, 0x00, 0xDB, 0x00, 0x00, 0x08,
+  0xF1, 0x00, 0x00, 0x2F, 0x60, 0x08, 0x09, 0x0C, 0x1F, 0x10, 0x01, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F,
+  0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F, 0x20, 0x1F,
+  0x10, 0x01, 0x1F, 0x08, 0x09, 0x0A, 0x1C, 0x00, 0x00, 0xCF, 0x20, 0x00, 0x00, 0x04, 0xFF, 0x90, 0x00, 0x00, 0x0C, 0xC7,
+  0xF2, 0x00, 0x00, 0x4F, 0x40, 0xE9, 0x00, 0x00, 0xCC, 0x00, 0x7F, 0x20, 0x04, 0xF4, 0x00, 0x1E, 0x90, 0x0C, 0xC0, 0x00,
+  0x07, 0xF2, 0x4F, 0x40, 0x00, 0x01, 0xE9, 0xAF, 0xA2, 0xEA, 0x00, 0x06, 0xFC, 0x10, 0x01, 0xAC, 0x10, 0x00, 0x35, 0x18,
+  0xA9, 0xDB, 0x10, 0x0B, 0xF0, 0x02, 0xFB, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x02, 0x20, 0x03, 0xFF, 0x00, 0x00, 0x5A, 0x5F,
+  0xF0, 0x01, 0xCA, 0x00, 0xFF, 0x00, 0xBF, 0x10, 0x0F, 0xF0, 0x0F, 0xF1, 0x00, 0xFF, 0x00, 0xEF, 0xA5, 0x9F, 0xF6, 0x44,
+  0xEF, 0x91, 0x9F, 0xC2, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x9E, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1A,
+  0xFF, 0xB2, 0x00, 0x0F, 0xFB, 0x87, 0xDF, 0xE1, 0x00, 0xFF, 0x20, 0x00, 0xDF, 0x90, 0x0F, 0xF0, 0x00, 0x05, 0xFE, 0x00,
+  0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xA0, 0x0F, 0xF0, 0x00, 0x05,
+  0xF3, 0x00, 0xFF, 0x20, 0x02, 0xD6, 0x00, 0x03, 0xAE, 0xCB, 0xA3, 0x00, 0x00, 0x6C, 0xAC, 0xA1, 0x00, 0xAD, 0x10, 0x2F,
+  0xC0, 0x5F, 0x50, 0x00, 0xCE, 0x0C, 0xF1, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF2, 0x00, 0x00, 0x00, 0xEF,
+  0x70, 0x00, 0x02, 0x29, 0xFF, 0x30, 0x01, 0x90, 0x1E, 0xFF, 0xBA, 0xD3, 0x00, 0x2A, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0x00, 0x00, 0x00, 0x39, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x6C, 0xAA, 0x7F, 0xF0, 0x00, 0x8E, 0x10, 0x08, 0xFF,
+  0x00, 0x4F, 0x50, 0x00, 0x1F, 0xF0, 0x0B, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xF1, 0x00,
+  0x00, 0xFF, 0x00, 0xEF, 0x40, 0x00, 0x0F, 0xF0, 0x0A, 0xFB, 0x00, 0x00, 0xFF, 0x00, 0x2F, 0xFA, 0x33, 0x9F, 0xF9, 0x30,
+  0x2B, 0xFF, 0xB2, 0xE9, 0x30, 0x00, 0x7C, 0xCE, 0xB2, 0x00, 0xBB, 0x00, 0x2F, 0xE1, 0x6F, 0x30, 0x00, 0xAF, 0x7C, 0xFB,
+  0xBB, 0xBC, 0xE9, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0x00, 0x00, 0x00, 0xEF, 0x80, 0x00, 0x00, 0x59, 0xFF, 0x30, 0x00,
+  0x49, 0x1E, 0xFF, 0xA8, 0xBC, 0x10, 0x2A, 0xFF, 0xD8, 0x00, 0x00, 0x05, 0xBB, 0xE7, 0x00, 0x4F, 0x20, 0xCF, 0x00, 0xBF,
+  0x00, 0x12, 0x00, 0xEF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x9B, 0xFF, 0xBB, 0x50, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0x01, 0xFF, 0x10, 0x00, 0x5A, 0xFF, 0xA5, 0x00, 0x00, 0x6A, 0xBE, 0x92, 0x00, 0x00, 0x7F, 0x10, 0xAF, 0xFE,
+  0xE3, 0x1F, 0xD0, 0x04, 0xFC, 0x00, 0x02, 0xFE, 0x00, 0x1F, 0xF0, 0x00, 0x1F, 0xF1, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x80,
+  0x4F, 0x60, 0x00, 0x00, 0x6C, 0x9A, 0x40, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xDB, 0xBB, 0xBA, 0x60, 0x00,
+  0x8E, 0xEF, 0xFF, 0xFF, 0x90, 0x1D, 0x50, 0x00, 0x01, 0x7F, 0x0A, 0xF0, 0x00, 0x00, 0x01, 0xE0, 0xFF, 0x30, 0x00, 0x00,
+  0x88, 0x0B, 0xFE, 0x74, 0x46, 0xB8, 0x00, 0x07, 0xDF, 0xFD, 0x92, 0x00, 0x00, 0x00, 0x01, 0x05, 0x0A, 0x70, 0x02, 0x0A,
+  0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x70, 0x10, 0x1F, 0x00, 0x08, 0x0E, 0x0F, 0x0C, 0x01, 0x10,
+  0x10, 0x1F, 0x0A, 0x06, 0x03, 0x0B, 0x0F, 0x0A, 0x10, 0x10, 0x1F, 0x02, 0x10, 0x02, 0x0F, 0x0E, 0x10, 0x10, 0x1F, 0x30,
+  0x1F, 0x10, 0x10, 0x1F, 0x30, 0x1F, 0x10, 0x10, 0x1F, 0x30, 0x1F, 0x10, 0x10, 0x1F, 0x30, 0x1F, 0x10, 0x10, 0x1F, 0x30,
+  0x1F, 0x10, 0x00, 0x01, 0x1F, 0x01, 0x10, 0x01, 0x1F, 0x10, 0x02, 0x0A, 0x1F, 0x0A, 0x13, 0x0A, 0x1F, 0x0A, 0x02, 0x00,
+  0xCC, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9F, 0x00, 0x27, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x10, 0x29, 0xFF, 0xA4, 0x30, 0x1C, 0x30, 0x1E, 0x30, 0x11, 0x50, 0x50, 0x20, 0x03, 0x08, 0x0F, 0x10, 0x02, 0x08, 0x1F,
+  0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x1F, 0x30, 0x0F,
+  0x0E, 0x30, 0x0F, 0x0B, 0x06, 0x0F, 0x13, 0x0F, 0x04, 0x03, 0x0D, 0x0E, 0x0B, 0x05, 0x00, 0x02, 0x6A, 0x00, 0x00, 0x00,
+  0x00, 0x4A, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x3C, 0xF9, 0x50, 0x00, 0xFF, 0x00, 0x2C, 0x30, 0x00, 0x00, 0xFF, 0x03,
+  0xB1, 0x00, 0x00, 0x00, 0xFF, 0x5C, 0x10, 0x00, 0x00, 0x00, 0xFF, 0xEF, 0x20, 0x00, 0x00, 0x00, 0xFF, 0x4F, 0xD1, 0x00,
+  0x00, 0x00, 0xFF, 0x08, 0xFA, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xCF, 0x70, 0x00, 0x00, 0xFF, 0x00, 0x1E, 0xF4, 0x00, 0x4A,
+  0xFF, 0xA4, 0x2C, 0xFF, 0x93, 0x02, 0x6A, 0x00, 0x5A, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x4A, 0xFF, 0x94, 0x15, 0x9E, 0x06, 0xDF, 0xB1, 0x18, 0xEF, 0xB1, 0x00, 0x27,
+  0xFF, 0x96, 0x3A, 0xFA, 0xA5, 0x39, 0xF9, 0x00, 0x00, 0xFF, 0x10, 0x01, 0xFF, 0x10, 0x01, 0xFE, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x00, 0xFF, 0x00, 0x4A, 0xFF, 0x93, 0x3A, 0xFF, 0xB4, 0x3A, 0xFF, 0x93,
+  0x04, 0x9E, 0x07, 0xEF, 0xB1, 0x00, 0x26, 0xFF, 0x96, 0x4B, 0xFA, 0x00, 0x00, 0xFF, 0x20, 0x02, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x2A, 0xFF, 0x93, 0x2A, 0xFF, 0x92,
+  0x00, 0x6B, 0xAC, 0xD6, 0x00, 0x0B, 0xC1, 0x00, 0x6F, 0xB0, 0x6F, 0x40, 0x00, 0x0B, 0xF7, 0xDF, 0x00, 0x00, 0x04, 0xFD,
+  0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0xFF, 0xCF, 0x60, 0x00, 0x01, 0xFB, 0x6F, 0xC0, 0x00, 0x05, 0xF4,
+  0x0A, 0xF7, 0x00, 0x1D, 0x80, 0x00, 0x6D, 0xCA, 0xB5, 0x00, 0x03, 0x8E, 0x18, 0xEF, 0xC3, 0x03, 0x9F, 0xFA, 0x76, 0xBF,
+  0xF2, 0x00, 0xFF, 0x20, 0x00, 0xCF, 0xA0, 0x0F, 0xF0, 0x00, 0x04, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x1F, 0xF0, 0x0F, 0xF0,
+  0x00, 0x00, 0xFE, 0x00, 0xFF, 0x00, 0x00, 0x2F, 0xB0, 0x0F, 0xF0, 0x00, 0x06, 0xF4, 0x00, 0xFF, 0x60, 0x02, 0xE8, 0x00,
+  0x0F, 0xF7, 0xCB, 0xC6, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x1F, 0xF1, 0x00, 0x00, 0x00, 0x4B, 0xFF, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x99, 0xA7, 0xD0, 0x00, 0x8E,
+  0x10, 0x04, 0xFF, 0x00, 0x4F, 0x50, 0x00, 0x0F, 0xF0, 0x0B, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0,
+  0x0F, 0xF1, 0x00, 0x00, 0xFF, 0x00, 0xFF, 0x40, 0x00, 0x0F, 0xF0, 0x0B, 0xFC, 0x00, 0x01, 0xFF, 0x00, 0x3F, 0xFC, 0x67,
+  0xAF, 0xF0, 0x00, 0x4D, 0xFE, 0x81, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xDF, 0xFA, 0x20, 0x03, 0x8D, 0x1B, 0xF4,
+  0x38, 0xFF, 0x88, 0xF7, 0x00, 0xFF, 0x30, 0x10, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3B, 0xFF, 0xA4, 0x00, 0x02, 0x98, 0x9F, 0xF0,
+  0x0E, 0x20, 0x02, 0xF0, 0x2F, 0x30, 0x00, 0x80, 0x1F, 0xF7, 0x10, 0x00, 0x05, 0xFF, 0xE7, 0x00, 0x00, 0x2B, 0xFF, 0xE3,
+  0x11, 0x00, 0x4D, 0xFD, 0x37, 0x00, 0x02, 0xFF, 0x3E, 0x10, 0x02, 0xF9, 0x3F, 0xE9, 0x9C, 0x80, 0x00, 0x08, 0x00, 0x00,
+  0x05, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xBF, 0xFB, 0xB2, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0D, 0xF7, 0x46, 0x00, 0x5F,
+  0xF9, 0x00, 0x29, 0xFF, 0x00, 0x49, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x03, 0xFF, 0x00, 0x00, 0xCF, 0xC5, 0x78, 0xFF, 0x71, 0x00, 0x2C, 0xFE, 0x70,
+  0xE8, 0x40, 0x2A, 0xFF, 0x70, 0x01, 0x8F, 0x90, 0x0D, 0xF2, 0x00, 0x02, 0xD0, 0x00, 0x6F, 0x90, 0x00, 0x86, 0x00, 0x00,
+  0xFF, 0x10, 0x0D, 0x00, 0x00, 0x08, 0xF6, 0x05, 0x80, 0x00, 0x00, 0x1F, 0xD0, 0xB2, 0x00, 0x00, 0x00, 0xAF, 0x6B, 0x00,
+  0x00, 0x00, 0x03, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x3E, 0xFC, 0x31,
+  0xAF, 0xF9, 0x10, 0x3D, 0xE2, 0x07, 0xF9, 0x00, 0x0D, 0xF1, 0x00, 0x09, 0x60, 0x01, 0xFE, 0x00, 0x07, 0xF7, 0x00, 0x0D,
+  0x00, 0x00, 0xAF, 0x50, 0x07, 0xFD, 0x00, 0x59, 0x00, 0x00, 0x3F, 0xB0, 0x0D, 0xAF, 0x30, 0xB2, 0x00, 0x00, 0x0D, 0xF1,
+  0x68, 0x3F, 0x92, 0xC0, 0x00, 0x00, 0x06, 0xF7, 0xD1, 0x0D, 0xE9, 0x50, 0x00, 0x00, 0x01, 0xFF, 0x90, 0x07, 0xFE, 0x00,
+  0x00, 0x00, 0x00, 0x9F, 0x20, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x92, 0x00, 0x00, 0x4C, 0xFF, 0x71,
+  0x9F, 0x92, 0x00, 0x0D, 0xF4, 0x08, 0x70, 0x00, 0x00, 0x3F, 0xD3, 0xC0, 0x00, 0x00, 0x00, 0x9F, 0xF2, 0x00, 0x00, 0x00,
+  0x01, 0xEF, 0x20, 0x00, 0x00, 0x00, 0x2E, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0x3C, 0xF7, 0x00, 0x00, 0x07, 0x80, 0x2F, 0xF2,
+  0x00, 0x03, 0xD1, 0x00, 0x7F, 0xB0, 0x05, 0xEC, 0x20, 0x08, 0xFF, 0xB2, 0x2B, 0xFF, 0x71, 0x02, 0xAF, 0x40, 0x1F, 0xF2,
+  0x00, 0x07, 0x90, 0x00, 0xAF, 0x80, 0x00, 0xD3, 0x00, 0x03, 0xFE, 0x00, 0x2D, 0x00, 0x00, 0x0C, 0xF5, 0x07, 0x70, 0x00,
+  0x00, 0x5F, 0xB0, 0xD2, 0x00, 0x00, 0x00, 0xEF, 0x4C, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x60, 0x00, 0x00, 0x00, 0x1F, 0xF1,
+  0x00, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x40, 0x00, 0x00, 0x00, 0x01, 0xD0, 0x00, 0x00, 0x02, 0x20,
+  0xA7, 0x00, 0x00, 0x00, 0xFF, 0xED, 0x00, 0x00, 0x00, 0x09, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x0F, 0xCB, 0xBB, 0xEF, 0xE0,
+  0x0B, 0x00, 0x02, 0xFF, 0x30, 0x04, 0x00, 0x0C, 0xF8, 0x00, 0x00, 0x00, 0x7F, 0xD0, 0x00, 0x00, 0x02, 0xFF, 0x30, 0x00,
+  0x00, 0x0C, 0xF7, 0x00, 0x00, 0x00, 0x6F, 0xC0, 0x00, 0x00, 0x02, 0xFF, 0x20, 0x00, 0x35, 0x0C, 0xF6, 0x00, 0x00, 0xA3,
+  0x6F, 0xFB, 0xBB, 0xBD, 0xF1, 0x00, 0x2B, 0xD6, 0x00, 0xCF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00,
+  0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF6, 0x00, 0x5E, 0x70, 0x00, 0x04, 0xFA, 0x00, 0x00, 0xFF,
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x10, 0x00, 0x9F, 0x70, 0x00,
+  0x05, 0x96, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0xA2, 0x00,
+  0x04, 0xFB, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF,
+  0x10, 0x00, 0x7F, 0x70, 0x00, 0x07, 0xE4, 0x00, 0xAF, 0x40, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00,
+  0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFE, 0x00, 0x07, 0xF9, 0x00, 0x69, 0x50, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01,
+  0xAF, 0xFF, 0xB6, 0x24, 0xC4, 0x3C, 0x20, 0x3A, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x01, 0x43, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x6B, 0xCD, 0xA2, 0x01, 0xF1, 0xF0, 0x87, 0x00, 0x2D,
+  0xF4, 0x1F, 0x1F, 0x0F, 0x60, 0x00, 0x4F, 0xD1, 0xF1, 0xF0, 0xFE, 0x00, 0x01, 0xFF, 0x1F, 0x1F, 0x02, 0x20, 0x00, 0x2F,
+  0xD1, 0xF1, 0xF0, 0x00, 0x00, 0x06, 0xF7, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0xBD, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0x2F, 0x20,
+  0x1F, 0x1F, 0x00, 0x00, 0x09, 0x50, 0x01, 0xF1, 0xF0, 0x00, 0x00, 0xA0, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x26, 0x00, 0x01,
+  0xF1, 0xF0, 0x00, 0x01, 0x10, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x11, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x3F, 0xD0, 0x00, 0x1F,
+  0x1F, 0x00, 0x03, 0xFD, 0x00, 0x01, 0xF1, 0xF0, 0x00, 0x02, 0x10, 0x00, 0x1F, 0x1C, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xC0
 };
@@ -2,401 +2,207 @@
 #include "resources.h"
 
 const uint8_t FontWave[] = {
-  2,  /*font type*/
+  3,  /*font type: 4BPP, trimmed glyph boxes*/
   1, /*first car ID*/
-  13, /*number of car*/
+  13, /*last car ID*/
   29, /*font height*/
-  /*index table: glyph width, offset hl, lh, ll*/
-  0x28, 0x00, 0x00, 0x00,
-  0x28, 0x00, 0x02, 0x45,
-  0x28, 0x00, 0x04, 0x8A,
-  0x28, 0x00, 0x06, 0xCF,
-  0x28, 0x00, 0x09, 0x14,
-  0x28, 0x00, 0x0B, 0x59,
-  0x28, 0x00, 0x0D, 0x9E,
-  0x28, 0x00, 0x0F, 0xE3,
-  0x28, 0x00, 0x12, 0x28,
-  0x28, 0x00, 0x14, 0x6D,
-  0x28, 0x00, 0x16, 0xB2,
-  0x28, 0x00, 0x18, 0xF7,
-  0x28, 0x00, 0x1B, 0x3C,
-  /*glyph raw*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x10, 
-  0x02, 0xAC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCA, 0x20, 
-  0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 
-  0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 
-  0x01, 0x56, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x65, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 
-  0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 
-  0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xFF, 
-  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFE, 0x7E, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x80, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x0E, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xF8, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x50, 0x0B, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xFF, 0xA1, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0xF6, 0x00, 0x06, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFB, 0x10, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0x70, 0x00, 0x01, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xC1, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0xF5, 0x00, 0x00, 0x07, 0xFF, 0xFD, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0x80, 0x10, 0x00, 0x00, 0x8F, 0xF9, 0x00, 0x00, 0x5F, 0xFF, 0xD2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x19, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00, 0x05, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9F, 0xFF, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x20, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x73, 0xEF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x7F, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xDD, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x06, 0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x4F, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x1B, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x66, 0x66, 0x66, 0x66, 0x66, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xCD, 0xDD, 0xDC, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x11, 0x22, 0x22, 0x22, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xF2, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 
-  0x22, 0x21, 0x19, 0xCC, 0xCC, 0xCC, 0xDF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 
-  0xCC, 0xD2, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF2, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF2, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 
-  0x55, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x22, 0x21, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9C, 0xDD, 0xDE, 0xEE, 0xEE, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xE8, 0x44, 0x43, 0x33, 0x3E, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x19, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x17, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9F, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFD, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x70, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xE3, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xDF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFC, 0x32, 0x22, 0x22, 
-  0x22, 0x21, 0x00, 0x02, 0xEF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xED, 0xDD, 0xDD, 
-  0xDD, 0xD7, 0x00, 0x01, 0x57, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x7D, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x45, 0x55, 0x55, 
-  0x55, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x31, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xBD, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0xDC, 0x40, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC2, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF7, 
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFA, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xBF, 0xFE, 
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xC1, 0xBF, 0xFB, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xF9, 0x1F, 0xFF, 
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x20, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x07, 0xFF, 0xE3, 0x07, 0xFF, 
-  0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFA, 0x10, 0x2D, 0xFF, 0x70, 0x00, 0x00, 0x1B, 0xFF, 0xA0, 0x01, 0xFF, 
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF5, 0x00, 0x0A, 0xFF, 0xA1, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x01, 0xAF, 
-  0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xD2, 0x00, 0x05, 0xFF, 0xE2, 0x00, 0x00, 0x8F, 0xFD, 0x00, 0x00, 0x6F, 
-  0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x90, 0x00, 0x00, 0xFF, 0xF5, 0x00, 0x00, 0xEF, 0xF6, 0x00, 0x00, 0x3E, 
-  0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x40, 0x00, 0x00, 0xAF, 0xFA, 0x00, 0x04, 0xFF, 0xF1, 0x00, 0x00, 0x1C, 
-  0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x08, 
-  0xFF, 0xC2, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x50, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x03, 
-  0xFF, 0xF3, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xA0, 0x6F, 0xFD, 0x20, 0x00, 0x00, 0x00, 
-  0xEF, 0xF6, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 
-  0x9F, 0xFB, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF5, 0xCF, 0xF7, 0x00, 0x00, 0x00, 0x00, 
-  0x3F, 0xFF, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFC, 0xEF, 0xE3, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0xFF, 0x40, 0x00, 0x00, 0x7F, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 
-  0x0A, 0xFF, 0x90, 0x00, 0x00, 0xBF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xE0, 0x00, 0x02, 0xDF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFF, 0xF3, 0x00, 0x05, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xDF, 0xF6, 0x00, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0xAF, 0xFA, 0x00, 0x1C, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x7F, 0xFC, 0x10, 0x1B, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x5F, 0xFB, 0x20, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x6E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xF9, 0x07, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF3, 0x02, 0xEF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xA1, 0x01, 0xAF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x60, 0x00, 0x6F, 0xFD, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6F, 0xFE, 0x10, 0x00, 0x2E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x00, 0x00, 0x0B, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x06, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x70, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xE2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xF5, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF8, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFA, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x88, 0x88, 0x88, 
-  0x88, 0x88, 0x88, 0x82, 0x00, 0x00, 0x00, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x39, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xCB, 0xBB, 0xBB, 0xBB, 
-  0xBB, 0xBB, 0xBB, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x33, 0x33, 0x33, 
-  0x33, 0x33, 0x33, 0x33, 0x30, 0x00, 0x00, 0x00, 0x26, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xEE, 0xEE, 0xEE, 
-  0xEE, 0xEE, 0xEE, 0xEE, 0xC0, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x01, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEE, 0xEE, 
-  0xEE, 0xEE, 0xEE, 0xEE, 0xC0, 0x00, 0x00, 0x00, 0xCF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x44, 0x44, 
-  0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xF6, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xE3, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x18, 0xFF, 0xD0, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0x80, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFE, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xF7, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xF8, 0x10, 0x00, 0x00, 0x02, 0xFF, 0xF2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFC, 0x10, 0x00, 0x00, 0x08, 0xFF, 0xC1, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x20, 0x00, 0x00, 0x1E, 0xFF, 0x71, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x80, 0x00, 0x00, 0x5F, 0xFE, 0x40, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xE0, 0x00, 0x00, 0x9F, 0xFC, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xF4, 0x00, 0x02, 0xDF, 0xF8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFA, 0x00, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0x20, 0x0D, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xFF, 0x70, 0x5F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xC2, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFD, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xAC, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x15, 0xAC, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xEA, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x06, 0xCA, 0x41, 0x18, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0x81, 0x06, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x30, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x50, 0x03, 0xEF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x70, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x5F, 0xFE, 0x30, 0x01, 0xDF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0xAF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xE1, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0xBF, 0xF8, 0x00, 0x00, 0x6F, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xF4, 0x00, 
-  0x00, 0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x2F, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFE, 0xEF, 0xF7, 0x00, 
-  0x00, 0x00, 0x00, 0x05, 0xFF, 0xE0, 0x00, 0x00, 0x0D, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFA, 0x9F, 0xFA, 0x10, 
-  0x00, 0x00, 0x00, 0x0B, 0xFF, 0xA0, 0x00, 0x00, 0x08, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xF6, 0x5F, 0xFD, 0x20, 
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0x40, 0x00, 0x00, 0x03, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF2, 0x1F, 0xFF, 0x40, 
-  0x00, 0x00, 0x00, 0x6F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xF5, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xC0, 0x0D, 0xFF, 0x80, 
-  0x00, 0x00, 0x00, 0xCF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFB, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0x60, 0x07, 0xFF, 0xD0, 
-  0x00, 0x00, 0x02, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x00, 0x00, 0x4F, 0xFF, 0x10, 0x02, 0xFF, 0xF2, 
-  0x00, 0x00, 0x07, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0x60, 0x00, 0x00, 0xCF, 0xFA, 0x00, 0x00, 0xCF, 0xF8, 
-  0x00, 0x00, 0x1B, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xB0, 0x00, 0x02, 0xFF, 0xF3, 0x00, 0x00, 0x7F, 0xFE, 
-  0x00, 0x00, 0x3E, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xD3, 0x00, 0x08, 0xFF, 0xD2, 0x00, 0x00, 0x2F, 0xFF, 
-  0x40, 0x00, 0x7F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF6, 0x00, 0x2D, 0xFF, 0x81, 0x00, 0x00, 0x1B, 0xFF, 
-  0x90, 0x01, 0xCF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFB, 0x10, 0x6F, 0xFE, 0x30, 0x00, 0x00, 0x07, 0xFF, 
-  0xD2, 0x05, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x31, 0xCF, 0xFB, 0x00, 0x00, 0x00, 0x03, 0xEF, 
-  0xF6, 0x0E, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xC7, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0xBF, 
-  0xFB, 0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x4F, 
-  0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 
-  0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xBF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8C, 0xDC, 0x50, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFA, 0x6E, 0xFF, 0xD2, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x81, 0x04, 0xFF, 0xFB, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFA, 0x10, 0x00, 0x7F, 0xFF, 0x50, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xD2, 0x00, 0x01, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x50, 0x00, 0x00, 0x03, 0xEF, 0xF8, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFD, 0x30, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0x71, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xE1, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0xCF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB3, 0x00, 0x01, 0x9F, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x20, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x60, 0x00, 0x04, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xA0, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 
-  0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xDF, 0xFA, 
-  0x10, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 
-  0x30, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 
-  0xB0, 0x00, 0x00, 0x02, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 
-  0xF7, 0x00, 0x00, 0x1A, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 
-  0xFF, 0x30, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 
-  0xFF, 0xD2, 0x15, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 
-  0xFF, 0xFB, 0xAF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x9F, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0A, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x6B, 0xB7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x83, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFE, 
-  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 
-  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 
-  0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 
-  0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xFF, 
-  0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 
-  0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 
-  0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFC, 0xCF, 
-  0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFA, 0xAF, 
-  0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF9, 0x9F, 
-  0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8F, 0xF8, 0x8F, 
-  0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xF7, 0x7F, 
-  0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xF6, 0x6F, 
-  0xF9, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAF, 0xF5, 0x5F, 
-  0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xF4, 0x4F, 
-  0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xF3, 0x3F, 
-  0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xCF, 0xE2, 0x2E, 
-  0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0xDF, 0xE2, 0x2E, 
-  0xFD, 0x30, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9A, 0x31, 0x04, 0xEF, 0xC1, 0x1C, 
-  0xFE, 0x40, 0x13, 0xA9, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0xFF, 0xD3, 0x04, 0xFF, 0xB1, 0x1B, 
-  0xFF, 0x40, 0x3D, 0xFF, 0xB2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xA3, 0x01, 0x6F, 0xFF, 0xFA, 0x05, 0xFF, 0xA0, 0x0A, 
-  0xFF, 0x50, 0xAF, 0xFF, 0xF6, 0x10, 0x3A, 0x71, 0x00, 0x01, 0xAF, 0xFD, 0x21, 0xCF, 0xFF, 0xFF, 0x36, 0xFF, 0x90, 0x09, 
-  0xFF, 0x63, 0xFF, 0xFF, 0xFC, 0x12, 0xDF, 0xFB, 0x10, 0x17, 0xFF, 0xFF, 0x93, 0xFF, 0xEA, 0xFF, 0xA8, 0xFF, 0x70, 0x07, 
-  0xFF, 0x8A, 0xFF, 0xAE, 0xFF, 0x39, 0xFF, 0xFF, 0x71, 0x2D, 0xFF, 0xFF, 0xEB, 0xFF, 0x93, 0xEF, 0xFD, 0xFF, 0x50, 0x05, 
-  0xFF, 0xDF, 0xFE, 0x39, 0xFF, 0xBE, 0xFF, 0xFF, 0xD2, 0xAF, 0xFC, 0xAF, 0xFF, 0xFF, 0x41, 0x9F, 0xFF, 0xFF, 0x30, 0x03, 
-  0xFF, 0xFF, 0xFA, 0x14, 0xFF, 0xFF, 0xFA, 0xCF, 0xFA, 0xCF, 0xE4, 0x4E, 0xFF, 0xFC, 0x10, 0x4E, 0xFF, 0xFD, 0x00, 0x00, 
-  0xDF, 0xFF, 0xE4, 0x01, 0xCF, 0xFF, 0xE4, 0x4E, 0xFC, 0xCD, 0x51, 0x19, 0xFF, 0xF6, 0x10, 0x18, 0xFF, 0xF7, 0x00, 0x00, 
-  0x7F, 0xFF, 0x81, 0x01, 0x6F, 0xFF, 0x91, 0x15, 0xDC, 0x52, 0x10, 0x01, 0x9C, 0x71, 0x00, 0x01, 0x8C, 0x92, 0x00, 0x00, 
-  0x18, 0xC8, 0x10, 0x00, 0x17, 0xC9, 0x20, 0x01, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x66, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0xFF, 0xFA, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 
-  0xFF, 0xFC, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 
-  0xFF, 0xFD, 0x20, 0x38, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x1F, 
-  0xFF, 0xFF, 0x30, 0x8F, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x4F, 
-  0xFF, 0xFF, 0x50, 0xEF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x9F, 
-  0xFF, 0xFF, 0x75, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0xEF, 
-  0xFC, 0xFF, 0x9C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xEB, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x02, 0xFF, 
-  0xF6, 0xFF, 0xDF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xA8, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x07, 0xFF, 
-  0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x37, 0xFF, 0xC1, 0x1F, 0x93, 0x00, 0x0C, 0xFF, 
-  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x07, 0x9A, 0x20, 0x00, 0x3A, 0xEE, 0x06, 0xFF, 0xD1, 0x7F, 0xFF, 0x10, 0x1E, 0xFF, 
-  0x50, 0xCF, 0xFF, 0xEC, 0xFF, 0xB1, 0x0F, 0xFF, 0x60, 0x00, 0x01, 0x33, 0x04, 0xEF, 0xE2, 0xDF, 0xFF, 0x30, 0x5F, 0xFE, 
-  0x30, 0x9F, 0xFF, 0xC6, 0xFF, 0xD2, 0x4F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xE8, 0xFF, 0xFF, 0x70, 0x8F, 0xFC, 
-  0x10, 0x6F, 0xFF, 0x83, 0xFF, 0xE2, 0xBF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFD, 0xFF, 0xFF, 0xA0, 0xBF, 0xF9, 
-  0x00, 0x3E, 0xEE, 0x21, 0xEF, 0xF6, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xD1, 0xDF, 0xF5, 
-  0x00, 0x13, 0x33, 0x00, 0xDF, 0xFD, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xF4, 0xFF, 0xF1, 
-  0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0xEF, 0xFA, 0xFF, 0xC0, 
-  0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF7, 0xCF, 0xFF, 0xFF, 0x70, 
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFE, 0xBF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF1, 0xAF, 0xFF, 0xFF, 0x20, 
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF9, 0x7F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xA0, 0x8F, 0xFF, 0xFE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF2, 0x6F, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x08, 0x6B, 0x30, 0x6F, 0xFF, 0xF9, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0xDE, 0xC0, 0x4E, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x3E, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xFF, 0xE2, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0xFF, 0xB1, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xEE, 0x81, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x20, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x12, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x6F, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x04, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xFD, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xE7, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD2, 0xEF, 0xF8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x9F, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x06, 0xFA, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x05, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x8C, 0xEE, 0xEB, 
-  0x76, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xBF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xE6, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xDF, 0xFF, 0xFE, 
-  0xB7, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x23, 0x22, 
-  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xCB, 0x30, 0x1A, 0xCC, 0x30, 0x00, 0x5D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xFF, 0xB0, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xFF, 0xF5, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xDB, 0xFB, 0x10, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD2, 0xFF, 0x30, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x9F, 0xC0, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x3F, 0xF5, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x1A, 0xFD, 0x6F, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x03, 0xFF, 0xCF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x00, 0xAF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x03, 0xFE, 0x30, 0x2E, 0xD0, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x02, 0xFE, 0x30, 0x2F, 0xE0, 0x00, 0x05, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xC6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xEF, 0xFF, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xCF, 0xFF, 0xFF, 0xF9, 
-  0x56, 0x66, 0x66, 0x66, 0x66, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFB, 
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0xFF, 0xFF, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xF6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0xE6, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  /*index table: glyph width, box x, y, w, h, offset hl (bit 7: RLE), lh, ll*/
+  0x28, 0x01, 0x0B, 0x26, 0x05, 0x80, 0x00, 0x00, /*0x01*/
+  0x28, 0x00, 0x03, 0x28, 0x16, 0x80, 0x00, 0x1F, /*0x02*/
+  0x28, 0x00, 0x01, 0x28, 0x1A, 0x80, 0x01, 0x32, /*0x03*/
+  0x28, 0x01, 0x00, 0x25, 0x1C, 0x80, 0x02, 0x18, /*0x04*/
+  0x28, 0x00, 0x01, 0x27, 0x1A, 0x80, 0x03, 0x1D, /*0x05*/
+  0x28, 0x04, 0x01, 0x22, 0x1A, 0x80, 0x04, 0xAE, /*0x06*/
+  0x28, 0x03, 0x01, 0x22, 0x1A, 0x80, 0x05, 0xA5, /*0x07*/
+  0x28, 0x00, 0x01, 0x28, 0x1A, 0x80, 0x06, 0x97, /*0x08*/
+  0x28, 0x01, 0x01, 0x26, 0x1A, 0x80, 0x08, 0x2D, /*0x09*/
+  0x28, 0x00, 0x00, 0x28, 0x1D, 0x80, 0x09, 0x41, /*0x0A*/
+  0x28, 0x00, 0x01, 0x27, 0x1B, 0x80, 0x0A, 0xE4, /*0x0B*/
+  0x28, 0x07, 0x00, 0x16, 0x1D, 0x80, 0x0C, 0x80, /*0x0C*/
+  0x28, 0x03, 0x02, 0x1E, 0x1A, 0x80, 0x0D, 0x3B, /*0x0D*/
+  /*glyph boxes*/
+  0xF1, 0xF1, 0x51, 0x02, 0x0A, 0xFC, 0xFC, 0x1C, 0x0A, 0x02, 0x03, 0x0E, 0xFF, 0xFF, 0x1F, 0x0D, 0x02, 0x03, 0x0E, 0xFF,
+  0xFF, 0x1F, 0x0D, 0x02, 0x01, 0x05, 0xF6, 0xF6, 0x16, 0x05, 0x01, 0xF0, 0x00, 0x08, 0x01, 0xF0, 0x40, 0xE0, 0x01, 0x08,
+  0x0F, 0x0D, 0xF0, 0x00, 0x03, 0x09, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x07, 0x2F, 0x02, 0xE0, 0x03, 0x0E, 0x0F, 0x0B, 0x02,
+  0xD0, 0x07, 0x3F, 0x06, 0xD0, 0x03, 0x0D, 0x2F, 0x03, 0xC0, 0x06, 0x4F, 0x0A, 0xC0, 0x02, 0x0C, 0x2F, 0x06, 0x00, 0xB0,
+  0x05, 0x5F, 0x0C, 0x02, 0xA0, 0x01, 0x0B, 0x2F, 0x08, 0x10, 0xA0, 0x04, 0x0E, 0x1F, 0x0E, 0x07, 0x0E, 0x0F, 0x0E, 0x03,
+  0x90, 0x01, 0x0C, 0x2F, 0x08, 0x20, 0x90, 0x03, 0x3F, 0x04, 0x00, 0x0E, 0x1F, 0x06, 0x80, 0x01, 0x0B, 0x2F, 0x08, 0x01,
+  0x20, 0x80, 0x03, 0x3F, 0x05, 0x10, 0x0B, 0x1F, 0x09, 0x01, 0x60, 0x01, 0x08, 0x2F, 0x0A, 0x01, 0x30, 0x70, 0x03, 0x0D,
+  0x2F, 0x06, 0x20, 0x06, 0x1F, 0x0D, 0x01, 0x60, 0x08, 0x2F, 0x0B, 0x01, 0x40, 0x60, 0x01, 0x0D, 0x2F, 0x07, 0x30, 0x01,
+  0x2F, 0x02, 0x50, 0x08, 0x2F, 0x0C, 0x01, 0x50, 0x50, 0x01, 0x0D, 0x2F, 0x08, 0x50, 0x0D, 0x1F, 0x05, 0x40, 0x07, 0x2F,
+  0x0D, 0x01, 0x60, 0x40, 0x01, 0x0B, 0x2F, 0x08, 0x00, 0x01, 0x40, 0x08, 0x1F, 0x09, 0x30, 0x05, 0x2F, 0x0D, 0x02, 0x70,
+  0x30, 0x01, 0x09, 0x2F, 0x09, 0x70, 0x03, 0x1F, 0x0E, 0x20, 0x05, 0x2F, 0x0E, 0x03, 0x80, 0x30, 0x09, 0x2F, 0x0A, 0x01,
+  0x70, 0x01, 0x2F, 0x02, 0x00, 0x05, 0x3F, 0x03, 0x90, 0x20, 0x07, 0x2F, 0x0D, 0x01, 0x80, 0x01, 0x0C, 0x1F, 0x07, 0x03,
+  0x0E, 0x2F, 0x03, 0xA0, 0x10, 0x07, 0x2F, 0x0C, 0x01, 0x90, 0x01, 0x08, 0x1F, 0x1D, 0x2F, 0x05, 0xB0, 0x00, 0x06, 0x2F,
+  0x0C, 0x02, 0xB0, 0x05, 0x5F, 0x05, 0xC0, 0x04, 0x2F, 0x0E, 0x03, 0xC0, 0x03, 0x0E, 0x3F, 0x05, 0xD0, 0x01, 0x0B, 0x0F,
+  0x0E, 0x03, 0xD0, 0x01, 0x0C, 0x2F, 0x07, 0xE0, 0x00, 0x01, 0x09, 0x04, 0xF0, 0x07, 0x1F, 0x08, 0x01, 0xE0, 0x10, 0x01,
+  0xF0, 0x00, 0x01, 0x13, 0x01, 0xF0, 0x70, 0x02, 0x07, 0x96, 0x07, 0x01, 0xF0, 0x10, 0x70, 0x05, 0xBF, 0x01, 0xF0, 0x10,
+  0x70, 0x05, 0xBF, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x2F, 0x0C, 0x3D, 0x0C, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E,
+  0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F,
+  0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0,
+  0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70,
+  0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F,
+  0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50,
+  0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01,
+  0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10,
+  0x70, 0x05, 0x1F, 0x0E, 0x50, 0x2F, 0x01, 0xF0, 0x10, 0x11, 0x52, 0x06, 0x1F, 0x0E, 0x50, 0x2F, 0xF2, 0x12, 0x01, 0x01,
+  0x09, 0x5C, 0x0D, 0x1F, 0x0E, 0x50, 0x2F, 0xFC, 0x0C, 0x0D, 0x02, 0x01, 0x0C, 0x8F, 0x0E, 0x50, 0xFF, 0x4F, 0x02, 0x01,
+  0x0B, 0x8F, 0x0E, 0x50, 0xFF, 0x4F, 0x02, 0x01, 0x04, 0x95, 0x50, 0x06, 0xF5, 0x25, 0x06, 0x01, 0x80, 0x51, 0x22, 0x21,
+  0xF0, 0x70, 0x03, 0x09, 0x0C, 0x2D, 0x4E, 0x1C, 0xF0, 0x60, 0x05, 0x0E, 0xBF, 0x01, 0xE0, 0x50, 0x03, 0xDF, 0x02, 0xE0,
+  0x40, 0x01, 0x0E, 0x1F, 0x0E, 0x08, 0x24, 0x33, 0x0E, 0x1F, 0x02, 0xE0, 0x40, 0x0A, 0x2F, 0x04, 0x60, 0x01, 0x0D, 0x1F,
+  0x03, 0xE0, 0x30, 0x03, 0x0E, 0x1F, 0x07, 0x70, 0x01, 0x0C, 0x1F, 0x05, 0xE0, 0x30, 0x09, 0x1F, 0x0D, 0x02, 0x70, 0x01,
+  0x0A, 0x1F, 0x07, 0xE0, 0x20, 0x02, 0x0D, 0x1F, 0x08, 0x80, 0x01, 0x09, 0x1F, 0x0A, 0xE0, 0x20, 0x05, 0x2F, 0x02, 0x80,
+  0x01, 0x07, 0x1F, 0x0C, 0xE0, 0x20, 0x0A, 0x1F, 0x0B, 0xA0, 0x05, 0x1F, 0x0E, 0xE0, 0x20, 0x2F, 0x04, 0xA0, 0x04, 0x1F,
+  0x0E, 0x03, 0xD0, 0x10, 0x04, 0x2F, 0xB0, 0x02, 0x0D, 0x1F, 0x05, 0xD0, 0x10, 0x09, 0x1F, 0x0A, 0xB0, 0x01, 0x0C, 0x1F,
+  0x07, 0xD0, 0x10, 0x0D, 0x1F, 0x06, 0xC0, 0x0A, 0x1F, 0x0A, 0x01, 0xC0, 0x00, 0x01, 0x2F, 0x03, 0xC0, 0x06, 0x1F, 0x0D,
+  0x02, 0xC0, 0x00, 0x04, 0x1F, 0x0E, 0x02, 0xC0, 0x02, 0x2F, 0x04, 0xC0, 0x00, 0x07, 0x1F, 0x0B, 0x01, 0xD0, 0x0C, 0x1F,
+  0x08, 0xC0, 0x00, 0x09, 0x1F, 0x0A, 0x01, 0xD0, 0x06, 0x1F, 0x0E, 0x01, 0xB0, 0x00, 0x0B, 0x1F, 0x09, 0xE0, 0x01, 0x2F,
+  0x05, 0xB0, 0x00, 0x0C, 0x1F, 0x07, 0xF0, 0x09, 0x1F, 0x0D, 0xB0, 0x01, 0x0C, 0x1F, 0x06, 0xF0, 0x03, 0x2F, 0x07, 0xA0,
+  0x01, 0x0D, 0x1F, 0x05, 0xF0, 0x01, 0x0A, 0x1F, 0x0E, 0x03, 0x90, 0x02, 0x0D, 0x1F, 0x05, 0xF0, 0x00, 0x04, 0x2F, 0x0C,
+  0x03, 0x72, 0x01, 0x02, 0x0E, 0x1F, 0x04, 0xF0, 0x10, 0x08, 0x2F, 0x0E, 0x7D, 0x07, 0x01, 0x05, 0x17, 0x02, 0xF0, 0x20,
+  0x0A, 0xAF, 0x08, 0xF0, 0x60, 0x01, 0x00, 0x07, 0x0D, 0x8F, 0x08, 0xF0, 0x90, 0x02, 0x04, 0x75, 0x03, 0xA0, 0x02, 0x01,
+  0xD0, 0x01, 0x03, 0x01, 0x80, 0x80, 0x03, 0x0B, 0x0D, 0x0C, 0x04, 0xB0, 0x03, 0x0B, 0x0D, 0x0C, 0x04, 0x70, 0x70, 0x02,
+  0x0D, 0x3F, 0x01, 0x90, 0x02, 0x3F, 0x0C, 0x02, 0x60, 0x60, 0x01, 0x0A, 0x4F, 0x0B, 0x90, 0x0D, 0x4F, 0x07, 0x01, 0x50,
+  0x60, 0x04, 0x2F, 0x0A, 0x2F, 0x04, 0x70, 0x08, 0x2F, 0x0B, 0x1F, 0x0E, 0x01, 0x50, 0x60, 0x0D, 0x1F, 0x0C, 0x01, 0x0B,
+  0x1F, 0x0B, 0x60, 0x02, 0x0D, 0x1F, 0x09, 0x01, 0x2F, 0x07, 0x50, 0x50, 0x05, 0x2F, 0x02, 0x00, 0x06, 0x1F, 0x0E, 0x03,
+  0x50, 0x07, 0x1F, 0x0E, 0x03, 0x00, 0x07, 0x1F, 0x0E, 0x50, 0x50, 0x0C, 0x1F, 0x0A, 0x01, 0x00, 0x02, 0x0D, 0x1F, 0x07,
+  0x40, 0x01, 0x0B, 0x1F, 0x0A, 0x10, 0x01, 0x2F, 0x05, 0x40, 0x40, 0x03, 0x0E, 0x1F, 0x05, 0x20, 0x0A, 0x1F, 0x0A, 0x01,
+  0x30, 0x03, 0x2F, 0x04, 0x10, 0x01, 0x0A, 0x1F, 0x0B, 0x40, 0x40, 0x08, 0x1F, 0x0D, 0x02, 0x20, 0x05, 0x1F, 0x0E, 0x02,
+  0x30, 0x08, 0x1F, 0x0D, 0x30, 0x06, 0x1F, 0x0E, 0x02, 0x30, 0x30, 0x01, 0x0B, 0x1F, 0x09, 0x40, 0x2F, 0x05, 0x30, 0x0E,
+  0x1F, 0x06, 0x30, 0x03, 0x0E, 0x1F, 0x05, 0x30, 0x30, 0x03, 0x2F, 0x04, 0x40, 0x0A, 0x1F, 0x0A, 0x20, 0x04, 0x2F, 0x01,
+  0x30, 0x01, 0x0C, 0x1F, 0x09, 0x30, 0x30, 0x07, 0x1F, 0x0E, 0x50, 0x04, 0x2F, 0x20, 0x0B, 0x1F, 0x0A, 0x50, 0x08, 0x1F,
+  0x0C, 0x02, 0x20, 0x30, 0x0C, 0x1F, 0x08, 0x60, 0x2F, 0x05, 0x00, 0x01, 0x2F, 0x04, 0x50, 0x03, 0x2F, 0x03, 0x20, 0x20,
+  0x02, 0x2F, 0x02, 0x60, 0x09, 0x1F, 0x0A, 0x00, 0x06, 0x1F, 0x0D, 0x02, 0x60, 0x0E, 0x1F, 0x06, 0x20, 0x20, 0x07, 0x1F,
+  0x0D, 0x70, 0x05, 0x1F, 0x0E, 0x00, 0x0A, 0x1F, 0x0A, 0x01, 0x60, 0x09, 0x1F, 0x0B, 0x20, 0x20, 0x0D, 0x1F, 0x07, 0x70,
+  0x03, 0x0E, 0x1F, 0x05, 0x0C, 0x1F, 0x07, 0x70, 0x03, 0x2F, 0x20, 0x10, 0x03, 0x2F, 0x03, 0x70, 0x01, 0x0B, 0x1F, 0x0C,
+  0x0E, 0x0F, 0x0E, 0x03, 0x80, 0x2F, 0x04, 0x10, 0x10, 0x07, 0x1F, 0x0D, 0x02, 0x80, 0x09, 0x4F, 0x0D, 0x90, 0x0A, 0x1F,
+  0x09, 0x10, 0x10, 0x0B, 0x1F, 0x09, 0x01, 0x80, 0x06, 0x4F, 0x09, 0x90, 0x05, 0x1F, 0x0E, 0x10, 0x00, 0x02, 0x0D, 0x1F,
+  0x06, 0x90, 0x03, 0x0E, 0x3F, 0x03, 0x90, 0x03, 0x2F, 0x03, 0x00, 0x00, 0x05, 0x1F, 0x0E, 0x03, 0xA0, 0x0D, 0x2F, 0x0E,
+  0xA0, 0x02, 0x0D, 0x1F, 0x06, 0x00, 0x01, 0x08, 0x1F, 0x0C, 0xB0, 0x0A, 0x2F, 0x09, 0xA0, 0x01, 0x0A, 0x1F, 0x0A, 0x00,
+  0x01, 0x0C, 0x1F, 0x08, 0xB0, 0x06, 0x2F, 0x03, 0xB0, 0x07, 0x1F, 0x0C, 0x01, 0x01, 0x0B, 0x1F, 0x03, 0xB0, 0x03, 0x2F,
+  0x01, 0xB0, 0x05, 0x1F, 0x0B, 0x02, 0x10, 0x01, 0x05, 0xD0, 0x05, 0x06, 0x04, 0x01, 0xB0, 0x01, 0x03, 0x20, 0x80, 0x03,
+  0x06, 0x05, 0x01, 0xF0, 0x40, 0x70, 0x05, 0x0D, 0x1F, 0x09, 0x01, 0xF0, 0x30, 0x60, 0x02, 0x4F, 0x06, 0xF0, 0x30, 0x60,
+  0x0C, 0x5F, 0x01, 0xF0, 0x20, 0x50, 0x06, 0x2F, 0x06, 0x0E, 0x1F, 0x08, 0xF0, 0x20, 0x40, 0x01, 0x0E, 0x1F, 0x09, 0x00,
+  0x07, 0x1F, 0x0E, 0x01, 0xF0, 0x10, 0x40, 0x06, 0x2F, 0x03, 0x00, 0x02, 0x0E, 0x1F, 0x06, 0xF0, 0x10, 0x30, 0x01, 0x0B,
+  0x1F, 0x0A, 0x01, 0x00, 0x01, 0x0A, 0x1F, 0x0B, 0xF0, 0x10, 0x30, 0x03, 0x0E, 0x1F, 0x06, 0x20, 0x06, 0x1F, 0x0D, 0x03,
+  0xF0, 0x00, 0x20, 0x01, 0x06, 0x1F, 0x0E, 0x01, 0x20, 0x02, 0x0E, 0x1F, 0x05, 0xF0, 0x00, 0x20, 0x01, 0x0B, 0x1F, 0x0A,
+  0x40, 0x0B, 0x1F, 0x09, 0x01, 0xF0, 0x20, 0x02, 0x2F, 0x03, 0x40, 0x06, 0x1F, 0x0E, 0x01, 0xF0, 0x20, 0x07, 0x1F, 0x0D,
+  0x50, 0x01, 0x2F, 0x03, 0xF0, 0x20, 0x0D, 0x1F, 0x07, 0x60, 0x0B, 0x1F, 0x09, 0xF0, 0x10, 0x02, 0x2F, 0x02, 0x60, 0x06,
+  0x1F, 0x0E, 0xF0, 0x10, 0x08, 0x1F, 0x0C, 0x01, 0x60, 0x02, 0x2F, 0x02, 0xE0, 0x10, 0x0D, 0x1F, 0x08, 0x01, 0x60, 0x01,
+  0x0C, 0x1F, 0x07, 0xE0, 0x00, 0x03, 0x0E, 0x1F, 0x05, 0x70, 0x01, 0x08, 0x1F, 0x0C, 0xE0, 0x00, 0x06, 0x1F, 0x0D, 0x02,
+  0x80, 0x05, 0x1F, 0x0E, 0x02, 0xD0, 0x01, 0x0A, 0x1F, 0x0B, 0x90, 0x03, 0x0E, 0x1F, 0x05, 0xD0, 0x02, 0x0D, 0x1F, 0x07,
+  0x90, 0x01, 0x0C, 0x1F, 0x08, 0xD0, 0x03, 0x2F, 0x02, 0xA0, 0x0A, 0x1F, 0x0A, 0x01, 0xC0, 0x07, 0x1F, 0x0D, 0xB0, 0x06,
+  0x1F, 0x0E, 0xC8, 0x02, 0x0D, 0x1F, 0x08, 0xB0, 0x03, 0xFF, 0x04, 0x03, 0x09, 0x0F, 0x02, 0xC0, 0x0E, 0xEF, 0x04, 0xF0,
+  0x00, 0x05, 0x0C, 0xDB, 0x03, 0xF0, 0x10, 0xF3, 0x00, 0x02, 0x16, 0xD0, 0x0D, 0xDE, 0x0C, 0x05, 0x1F, 0x0E, 0xC0, 0x03,
+  0xEF, 0x0D, 0x01, 0x2F, 0x02, 0xB0, 0x07, 0x2F, 0xBE, 0x0C, 0x00, 0x0C, 0x1F, 0x06, 0xB0, 0x0B, 0x1F, 0x0B, 0xB4, 0x03,
+  0x00, 0x08, 0x1F, 0x0B, 0xA0, 0x02, 0x0D, 0x1F, 0x06, 0xC0, 0x00, 0x04, 0x2F, 0xA0, 0x04, 0x1F, 0x0E, 0x03, 0xC0, 0x00,
+  0x02, 0x0E, 0x1F, 0x04, 0x80, 0x01, 0x08, 0x1F, 0x0D, 0xD0, 0x00, 0x01, 0x0B, 0x1F, 0x08, 0x80, 0x01, 0x0C, 0x1F, 0x08,
+  0xD0, 0x10, 0x08, 0x1F, 0x0C, 0x01, 0x70, 0x02, 0x2F, 0x03, 0xD0, 0x10, 0x05, 0x1F, 0x0D, 0x03, 0x70, 0x07, 0x1F, 0x0E,
+  0xE0, 0x10, 0x02, 0x0E, 0x1F, 0x05, 0x70, 0x0D, 0x1F, 0x07, 0xE0, 0x20, 0x0C, 0x1F, 0x08, 0x01, 0x50, 0x02, 0x2F, 0x02,
+  0xE0, 0x20, 0x07, 0x1F, 0x0C, 0x01, 0x50, 0x08, 0x1F, 0x0C, 0x01, 0xE0, 0x20, 0x02, 0x2F, 0x02, 0x40, 0x01, 0x0E, 0x1F,
+  0x07, 0x01, 0xE0, 0x30, 0x0C, 0x1F, 0x08, 0x40, 0x05, 0x1F, 0x0E, 0x04, 0xF0, 0x30, 0x06, 0x1F, 0x0E, 0x40, 0x09, 0x1F,
+  0x0C, 0x01, 0xF0, 0x30, 0x01, 0x2F, 0x04, 0x20, 0x02, 0x0D, 0x1F, 0x08, 0xF0, 0x00, 0x30, 0x01, 0x0B, 0x1F, 0x0A, 0x20,
+  0x05, 0x2F, 0x02, 0xF0, 0x00, 0x40, 0x06, 0x1F, 0x0E, 0x02, 0x10, 0x0D, 0x1F, 0x0B, 0xF0, 0x10, 0x40, 0x03, 0x0D, 0x1F,
+  0x07, 0x00, 0x05, 0x2F, 0x03, 0xF0, 0x10, 0x50, 0x0A, 0x1F, 0x0C, 0x02, 0x0E, 0x1F, 0x0A, 0xF0, 0x20, 0x50, 0x04, 0x2F,
+  0x0D, 0x2F, 0x03, 0xF0, 0x20, 0x60, 0x0A, 0x4F, 0x08, 0x01, 0xF0, 0x20, 0x60, 0x01, 0x0D, 0x2F, 0x0C, 0x01, 0xF0, 0x30,
+  0x70, 0x02, 0x0A, 0x0C, 0x08, 0xF0, 0x50, 0x30, 0x01, 0xD0, 0x13, 0x01, 0xC0, 0x11, 0x20, 0x01, 0x05, 0x0A, 0x0C, 0x07,
+  0xC0, 0x04, 0x1E, 0x0A, 0xC0, 0x06, 0x0C, 0x0A, 0x04, 0x01, 0x01, 0x08, 0x1F, 0x0C, 0xC0, 0x08, 0x2F, 0xC0, 0x0C, 0x1F,
+  0x08, 0x01, 0x00, 0x06, 0x1F, 0x0D, 0x01, 0xB0, 0x0D, 0x2F, 0x03, 0xA0, 0x02, 0x0E, 0x1F, 0x05, 0x00, 0x00, 0x03, 0x0E,
+  0x0F, 0x0E, 0x04, 0xA0, 0x02, 0x3F, 0x07, 0xA0, 0x05, 0x1F, 0x0E, 0x03, 0x00, 0x00, 0x01, 0x0D, 0x1F, 0x07, 0xA0, 0x08,
+  0x3F, 0x0B, 0xA0, 0x08, 0x1F, 0x0C, 0x10, 0x10, 0x0A, 0x1F, 0x0A, 0x01, 0x90, 0x0D, 0x3F, 0x0E, 0x01, 0x80, 0x01, 0x0B,
+  0x1F, 0x08, 0x10, 0x10, 0x06, 0x1F, 0x0D, 0x02, 0x80, 0x03, 0x0E, 0x4F, 0x04, 0x80, 0x02, 0x2F, 0x04, 0x10, 0x10, 0x02,
+  0x2F, 0x03, 0x80, 0x06, 0x1F, 0x1E, 0x1F, 0x07, 0x80, 0x05, 0x1F, 0x0E, 0x20, 0x20, 0x0D, 0x1F, 0x07, 0x70, 0x01, 0x0A,
+  0x1F, 0x0A, 0x09, 0x1F, 0x0A, 0x01, 0x70, 0x0B, 0x1F, 0x0A, 0x20, 0x20, 0x08, 0x1F, 0x0B, 0x70, 0x02, 0x0D, 0x1F, 0x06,
+  0x05, 0x1F, 0x0D, 0x02, 0x60, 0x01, 0x2F, 0x04, 0x20, 0x20, 0x03, 0x2F, 0x01, 0x60, 0x04, 0x2F, 0x02, 0x01, 0x2F, 0x04,
+  0x60, 0x06, 0x1F, 0x0E, 0x30, 0x30, 0x0E, 0x1F, 0x05, 0x60, 0x08, 0x1F, 0x0C, 0x10, 0x0D, 0x1F, 0x08, 0x60, 0x0C, 0x1F,
+  0x09, 0x30, 0x30, 0x09, 0x1F, 0x0B, 0x60, 0x0E, 0x1F, 0x06, 0x10, 0x07, 0x1F, 0x0D, 0x50, 0x02, 0x2F, 0x04, 0x30, 0x30,
+  0x04, 0x2F, 0x01, 0x40, 0x04, 0x2F, 0x01, 0x10, 0x02, 0x2F, 0x02, 0x40, 0x07, 0x1F, 0x0D, 0x02, 0x30, 0x30, 0x02, 0x0D,
+  0x1F, 0x06, 0x40, 0x0C, 0x1F, 0x0A, 0x30, 0x0C, 0x1F, 0x08, 0x30, 0x01, 0x0B, 0x1F, 0x09, 0x01, 0x30, 0x30, 0x01, 0x0A,
+  0x1F, 0x0B, 0x30, 0x02, 0x2F, 0x03, 0x30, 0x07, 0x1F, 0x0E, 0x30, 0x03, 0x0E, 0x1F, 0x05, 0x40, 0x40, 0x06, 0x1F, 0x0D,
+  0x03, 0x20, 0x08, 0x1F, 0x0D, 0x02, 0x30, 0x02, 0x2F, 0x04, 0x20, 0x07, 0x1F, 0x0E, 0x02, 0x40, 0x40, 0x02, 0x0E, 0x1F,
+  0x06, 0x10, 0x02, 0x0D, 0x1F, 0x08, 0x01, 0x30, 0x01, 0x0B, 0x1F, 0x09, 0x10, 0x01, 0x0C, 0x1F, 0x0A, 0x50, 0x50, 0x0B,
+  0x1F, 0x0B, 0x01, 0x00, 0x06, 0x1F, 0x0E, 0x03, 0x50, 0x07, 0x1F, 0x0D, 0x02, 0x00, 0x05, 0x2F, 0x02, 0x50, 0x50, 0x04,
+  0x2F, 0x03, 0x01, 0x0C, 0x1F, 0x0B, 0x60, 0x03, 0x0E, 0x1F, 0x06, 0x00, 0x0E, 0x1F, 0x0A, 0x60, 0x60, 0x0C, 0x1F, 0x0C,
+  0x07, 0x2F, 0x03, 0x70, 0x0B, 0x1F, 0x0B, 0x09, 0x2F, 0x02, 0x60, 0x60, 0x04, 0x5F, 0x0A, 0x80, 0x04, 0x5F, 0x09, 0x01,
+  0x60, 0x60, 0x01, 0x0A, 0x3F, 0x0C, 0x01, 0x90, 0x09, 0x3F, 0x0D, 0x02, 0x70, 0x70, 0x02, 0x0C, 0x1F, 0x0D, 0x02, 0xB0,
+  0x0B, 0x1F, 0x0E, 0x03, 0x80, 0x80, 0x01, 0x06, 0x05, 0x01, 0xD0, 0x15, 0xA0, 0x90, 0x01, 0x02, 0x01, 0xF0, 0x80, 0x80,
+  0x08, 0x0C, 0x0D, 0x0C, 0x05, 0x00, 0x01, 0xF0, 0x50, 0x60, 0x02, 0x0C, 0x4F, 0x07, 0xF0, 0x60, 0x50, 0x01, 0x0B, 0x6F,
+  0x05, 0xF0, 0x50, 0x50, 0x0B, 0x2F, 0x0A, 0x06, 0x0E, 0x1F, 0x0D, 0x02, 0xF0, 0x40, 0x40, 0x09, 0x2F, 0x08, 0x01, 0x00,
+  0x04, 0x2F, 0x0B, 0xF0, 0x40, 0x30, 0x04, 0x2F, 0x0A, 0x01, 0x20, 0x07, 0x2F, 0x05, 0xF0, 0x30, 0x20, 0x01, 0x0C, 0x1F,
+  0x0D, 0x02, 0x20, 0x01, 0x00, 0x0B, 0x1F, 0x0E, 0x01, 0xF0, 0x20, 0x20, 0x06, 0x2F, 0x05, 0x50, 0x03, 0x0E, 0x1F, 0x08,
+  0xF0, 0x20, 0x10, 0x01, 0x2F, 0x0A, 0x60, 0x01, 0x09, 0x1F, 0x0D, 0x03, 0xF0, 0x10, 0x10, 0x0A, 0x2F, 0x01, 0x70, 0x03,
+  0x0E, 0x1F, 0x07, 0x01, 0xF0, 0x00, 0x00, 0x05, 0x2F, 0x06, 0x90, 0x09, 0x1F, 0x0E, 0x01, 0xC0, 0x01, 0x20, 0x02, 0x0C,
+  0x1F, 0x0C, 0x01, 0x90, 0x01, 0x2F, 0x0A, 0xC0, 0x07, 0x0B, 0x03, 0x00, 0x01, 0x09, 0x1F, 0x05, 0xB0, 0x08, 0x2F, 0x02,
+  0xA0, 0x02, 0x0E, 0x1F, 0x06, 0x10, 0x04, 0x09, 0xC0, 0x01, 0x0E, 0x1F, 0x0A, 0xA0, 0x08, 0x1F, 0x0E, 0x04, 0xF0, 0x10,
+  0x06, 0x2F, 0x04, 0x80, 0x02, 0x0E, 0x1F, 0x09, 0x00, 0xF0, 0x10, 0x02, 0x0D, 0x1F, 0x0A, 0x01, 0x70, 0x0A, 0x2F, 0x01,
+  0x00, 0xF0, 0x20, 0x07, 0x2F, 0x03, 0x60, 0x05, 0x2F, 0x06, 0x10, 0xF0, 0x20, 0x01, 0x0D, 0x1F, 0x0B, 0x50, 0x02, 0x0E,
+  0x1F, 0x0B, 0x20, 0xF0, 0x30, 0x04, 0x2F, 0x07, 0x30, 0x01, 0x0A, 0x1F, 0x0E, 0x03, 0x20, 0xF0, 0x40, 0x0A, 0x2F, 0x03,
+  0x20, 0x07, 0x2F, 0x08, 0x30, 0xF0, 0x40, 0x02, 0x0E, 0x1F, 0x0D, 0x02, 0x01, 0x05, 0x2F, 0x0C, 0x01, 0x30, 0xF0, 0x50,
+  0x06, 0x2F, 0x0B, 0x0A, 0x2F, 0x0E, 0x02, 0x40, 0xF0, 0x60, 0x09, 0x5F, 0x0E, 0x03, 0x50, 0xF0, 0x70, 0x0A, 0x3F, 0x0D,
+  0x02, 0x60, 0xF0, 0x80, 0x06, 0x1B, 0x07, 0x01, 0x70, 0xF0, 0x10, 0x03, 0x18, 0x03, 0xF0, 0x10, 0xF0, 0x00, 0x02, 0x0E,
+  0x1F, 0x0E, 0x02, 0xF0, 0x00, 0xF0, 0x00, 0x07, 0x3F, 0x07, 0xF0, 0x00, 0xF0, 0x00, 0x0B, 0x3F, 0x0B, 0xF0, 0x00, 0xF0,
+  0x01, 0x0C, 0x3F, 0x0C, 0x01, 0xF0, 0xF0, 0x02, 0x0D, 0x3F, 0x0D, 0x02, 0xF0, 0xF0, 0x03, 0x0E, 0x3F, 0x0E, 0x03, 0xF0,
+  0xF0, 0x04, 0x0E, 0x3F, 0x0E, 0x04, 0xF0, 0xF0, 0x05, 0x1F, 0x1C, 0x1F, 0x05, 0xF0, 0xF0, 0x06, 0x1F, 0x1A, 0x1F, 0x06,
+  0xF0, 0xF0, 0x07, 0x1F, 0x19, 0x1F, 0x07, 0xF0, 0xE0, 0x01, 0x08, 0x1F, 0x18, 0x1F, 0x08, 0x01, 0xE0, 0xE0, 0x01, 0x09,
+  0x1F, 0x17, 0x1F, 0x09, 0x01, 0xE0, 0xE0, 0x01, 0x09, 0x1F, 0x16, 0x1F, 0x09, 0x01, 0xE0, 0xE0, 0x01, 0x0A, 0x1F, 0x15,
+  0x1F, 0x0A, 0x01, 0xE0, 0xE0, 0x01, 0x0B, 0x1F, 0x14, 0x1F, 0x0B, 0x01, 0xE0, 0xE0, 0x01, 0x0C, 0x1F, 0x13, 0x1F, 0x0C,
+  0x02, 0xE0, 0xE0, 0x02, 0x0C, 0x0F, 0x0E, 0x12, 0x0E, 0x0F, 0x0C, 0x02, 0xE0, 0x90, 0x11, 0x20, 0x03, 0x0D, 0x0F, 0x0E,
+  0x12, 0x0E, 0x0F, 0x0D, 0x03, 0x20, 0x11, 0x90, 0x80, 0x02, 0x09, 0x0A, 0x03, 0x01, 0x00, 0x04, 0x0E, 0x0F, 0x0C, 0x11,
+  0x0C, 0x0F, 0x0E, 0x04, 0x00, 0x01, 0x03, 0x0A, 0x09, 0x02, 0x80, 0x70, 0x02, 0x0B, 0x1F, 0x0D, 0x03, 0x00, 0x04, 0x1F,
+  0x0B, 0x11, 0x0B, 0x1F, 0x04, 0x00, 0x03, 0x0D, 0x1F, 0x0B, 0x02, 0x70, 0x10, 0x01, 0x07, 0x0A, 0x03, 0x00, 0x01, 0x06,
+  0x3F, 0x0A, 0x00, 0x05, 0x1F, 0x0A, 0x10, 0x0A, 0x1F, 0x05, 0x00, 0x0A, 0x3F, 0x06, 0x01, 0x00, 0x03, 0x0A, 0x07, 0x01,
+  0x10, 0x00, 0x01, 0x0A, 0x1F, 0x0D, 0x02, 0x01, 0x0C, 0x4F, 0x03, 0x06, 0x1F, 0x09, 0x10, 0x09, 0x1F, 0x06, 0x03, 0x4F,
+  0x0C, 0x01, 0x02, 0x0D, 0x1F, 0x0B, 0x01, 0x00, 0x01, 0x07, 0x3F, 0x09, 0x03, 0x1F, 0x0E, 0x0A, 0x1F, 0x0A, 0x08, 0x1F,
+  0x07, 0x10, 0x07, 0x1F, 0x08, 0x0A, 0x1F, 0x0A, 0x0E, 0x1F, 0x03, 0x09, 0x3F, 0x07, 0x01, 0x02, 0x0D, 0x3F, 0x0E, 0x0B,
+  0x1F, 0x09, 0x03, 0x0E, 0x1F, 0x0D, 0x1F, 0x05, 0x10, 0x05, 0x1F, 0x0D, 0x1F, 0x0E, 0x03, 0x09, 0x1F, 0x0B, 0x0E, 0x3F,
+  0x0D, 0x02, 0x0A, 0x1F, 0x0C, 0x0A, 0x4F, 0x04, 0x01, 0x09, 0x4F, 0x03, 0x10, 0x03, 0x4F, 0x0A, 0x01, 0x04, 0x4F, 0x0A,
+  0x0C, 0x1F, 0x0A, 0x0C, 0x0F, 0x0E, 0x14, 0x0E, 0x2F, 0x0C, 0x01, 0x00, 0x04, 0x0E, 0x2F, 0x0D, 0x30, 0x0D, 0x2F, 0x0E,
+  0x04, 0x00, 0x01, 0x0C, 0x2F, 0x0E, 0x14, 0x0E, 0x0F, 0x0C, 0x0C, 0x0D, 0x05, 0x11, 0x09, 0x2F, 0x06, 0x01, 0x00, 0x01,
+  0x08, 0x2F, 0x07, 0x30, 0x07, 0x2F, 0x08, 0x01, 0x00, 0x01, 0x06, 0x2F, 0x09, 0x11, 0x05, 0x0D, 0x0C, 0x05, 0x02, 0x01,
+  0x10, 0x01, 0x09, 0x0C, 0x07, 0x01, 0x20, 0x01, 0x08, 0x0C, 0x09, 0x02, 0x30, 0x01, 0x08, 0x0C, 0x08, 0x01, 0x20, 0x01,
+  0x07, 0x0C, 0x09, 0x02, 0x10, 0x01, 0x02, 0x05, 0x30, 0x04, 0x06, 0x07, 0x03, 0xA0, 0x01, 0x26, 0x03, 0xE0, 0x30, 0x0D,
+  0x1F, 0x0A, 0xA0, 0x04, 0x2F, 0x0A, 0x01, 0xD0, 0x20, 0x03, 0x2F, 0x0C, 0x90, 0x01, 0x07, 0x2F, 0x0C, 0x02, 0xD0, 0x20,
+  0x0A, 0x2F, 0x0E, 0x90, 0x01, 0x0B, 0x2F, 0x0D, 0x02, 0x00, 0x03, 0x08, 0x03, 0x01, 0x80, 0x10, 0x01, 0x4F, 0x01, 0x80,
+  0x01, 0x4F, 0x03, 0x00, 0x08, 0x1F, 0x09, 0x80, 0x10, 0x07, 0x4F, 0x03, 0x80, 0x04, 0x4F, 0x05, 0x00, 0x0E, 0x1F, 0x0B,
+  0x80, 0x10, 0x0C, 0x4F, 0x05, 0x80, 0x09, 0x4F, 0x07, 0x05, 0x2F, 0x0E, 0x80, 0x00, 0x03, 0x0E, 0x4F, 0x07, 0x80, 0x0E,
+  0x1F, 0x0C, 0x1F, 0x09, 0x0C, 0x3F, 0x01, 0x70, 0x00, 0x07, 0x1F, 0x0E, 0x0B, 0x1F, 0x09, 0x70, 0x02, 0x2F, 0x06, 0x1F,
+  0x0D, 0x4F, 0x04, 0x70, 0x01, 0x0B, 0x1F, 0x0A, 0x08, 0x1F, 0x0B, 0x70, 0x07, 0x1F, 0x0C, 0x03, 0x7F, 0x07, 0x70, 0x02,
+  0x2F, 0x03, 0x07, 0x1F, 0x0C, 0x11, 0x0F, 0x09, 0x03, 0x20, 0x0C, 0x1F, 0x08, 0x00, 0x7F, 0x09, 0x10, 0x07, 0x09, 0x0A,
+  0x02, 0x10, 0x03, 0x0A, 0x1E, 0x00, 0x06, 0x1F, 0x0D, 0x01, 0x07, 0x2F, 0x01, 0x00, 0x01, 0x0E, 0x1F, 0x05, 0x00, 0x0C,
+  0x2F, 0x0E, 0x0C, 0x1F, 0x0B, 0x01, 0x00, 0x2F, 0x06, 0x10, 0x00, 0x01, 0x13, 0x00, 0x04, 0x0E, 0x0F, 0x0E, 0x02, 0x0D,
+  0x2F, 0x03, 0x00, 0x05, 0x1F, 0x0E, 0x03, 0x00, 0x09, 0x2F, 0x0C, 0x06, 0x1F, 0x0D, 0x02, 0x04, 0x2F, 0x08, 0x10, 0x40,
+  0x03, 0x0E, 0x0F, 0x0E, 0x08, 0x3F, 0x07, 0x00, 0x08, 0x1F, 0x0C, 0x01, 0x00, 0x06, 0x2F, 0x08, 0x03, 0x1F, 0x0E, 0x02,
+  0x0B, 0x2F, 0x0B, 0x10, 0x40, 0x01, 0x0E, 0x1F, 0x0D, 0x3F, 0x0A, 0x00, 0x0B, 0x1F, 0x09, 0x10, 0x03, 0x2E, 0x02, 0x01,
+  0x0E, 0x1F, 0x06, 0x4F, 0x10, 0x50, 0x0D, 0x6F, 0x0D, 0x01, 0x0D, 0x1F, 0x05, 0x10, 0x01, 0x23, 0x10, 0x0D, 0x1F, 0x0D,
+  0x4F, 0x02, 0x00, 0x50, 0x0B, 0x7F, 0x04, 0x2F, 0x01, 0x70, 0x09, 0x7F, 0x04, 0x00, 0x50, 0x09, 0x3F, 0x1E, 0x1F, 0x0A,
+  0x1F, 0x0C, 0x80, 0x06, 0x7F, 0x07, 0x00, 0x50, 0x06, 0x3F, 0x07, 0x0C, 0x4F, 0x07, 0x80, 0x03, 0x3F, 0x0E, 0x0B, 0x1F,
+  0x09, 0x00, 0x50, 0x04, 0x3F, 0x01, 0x0A, 0x4F, 0x02, 0x90, 0x3F, 0x09, 0x07, 0x1F, 0x0B, 0x00, 0x50, 0x02, 0x2F, 0x0A,
+  0x00, 0x08, 0x3F, 0x0E, 0xA0, 0x0C, 0x2F, 0x02, 0x06, 0x1F, 0x0D, 0x01, 0x60, 0x08, 0x06, 0x0B, 0x03, 0x00, 0x06, 0x3F,
+  0x09, 0xA0, 0x07, 0x0D, 0x0E, 0x0C, 0x00, 0x04, 0x0E, 0x0F, 0x0E, 0x03, 0xB0, 0x05, 0x3F, 0x04, 0xC0, 0x01, 0x02, 0x00,
+  0x03, 0x0E, 0x1F, 0x04, 0xB0, 0x03, 0x0E, 0x1F, 0x0E, 0x02, 0xF0, 0x01, 0x0E, 0x0F, 0x0E, 0x05, 0xB0, 0x02, 0x0D, 0x1F,
+  0x0B, 0x01, 0xF0, 0x00, 0x03, 0x01, 0x10, 0xC0, 0x0A, 0x1E, 0x08, 0x01, 0xF0, 0x40, 0xC0, 0x02, 0x13, 0x02, 0xF0, 0x50,
+  0xC0, 0x01, 0x02, 0x03, 0x50, 0xC0, 0x06, 0x0F, 0x0D, 0x50, 0xB0, 0x04, 0x2F, 0x06, 0x40, 0xB0, 0x05, 0x2F, 0x0B, 0x01,
+  0x30, 0xB0, 0x05, 0x3F, 0x05, 0x30, 0xB0, 0x05, 0x3F, 0x0D, 0x30, 0xB0, 0x05, 0x4F, 0x06, 0x20, 0xB0, 0x05, 0x5F, 0x01,
+  0x10, 0xB0, 0x05, 0x2F, 0x0D, 0x1F, 0x09, 0x10, 0xB0, 0x05, 0x1F, 0x0E, 0x07, 0x1F, 0x0E, 0x03, 0x00, 0xB0, 0x05, 0x1F,
+  0x0D, 0x02, 0x0E, 0x1F, 0x08, 0x01, 0xB0, 0x05, 0x1F, 0x0D, 0x00, 0x09, 0x1F, 0x0E, 0x02, 0xB0, 0x05, 0x1F, 0x0D, 0x00,
+  0x01, 0x2F, 0x08, 0xB0, 0x05, 0x1F, 0x0D, 0x10, 0x06, 0x0F, 0x0A, 0x03, 0xB0, 0x05, 0x1F, 0x0D, 0x20, 0x03, 0x10, 0xB0,
+  0x05, 0x1F, 0x0D, 0x50, 0xB0, 0x05, 0x1F, 0x0D, 0x50, 0xB0, 0x05, 0x1F, 0x0D, 0x50, 0x20, 0x01, 0x03, 0x08, 0x0C, 0x2E,
+  0x0B, 0x07, 0x06, 0x1F, 0x0D, 0x50, 0x10, 0x04, 0x0B, 0xAF, 0x0D, 0x50, 0x01, 0x05, 0xCF, 0x0D, 0x50, 0x01, 0xDF, 0x0D,
+  0x50, 0x06, 0xDF, 0x0E, 0x03, 0x40, 0x07, 0xEF, 0x04, 0x40, 0x02, 0xDF, 0x0E, 0x01, 0x40, 0x01, 0x09, 0xCF, 0x05, 0x50,
+  0x00, 0x01, 0x09, 0x0E, 0x8F, 0x0E, 0x06, 0x00, 0x01, 0x40, 0x20, 0x04, 0x09, 0x0D, 0x3F, 0x0E, 0x0B, 0x07, 0x03, 0x70,
+  0x30, 0x11, 0x12, 0x03, 0x12, 0x11, 0x80, 0xD0, 0x02, 0x0C, 0x0B, 0x03, 0x00, 0x01, 0x0A, 0x1C, 0x03, 0x20, 0x05, 0x0D,
+  0x07, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x1F, 0x0B, 0x20, 0x07, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03,
+  0x00, 0x02, 0x0E, 0x2F, 0x05, 0x10, 0x07, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x0B, 0x0F,
+  0x0B, 0x01, 0x00, 0x07, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x02, 0x1F, 0x03, 0x00, 0x07,
+  0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x00, 0x09, 0x0F, 0x0C, 0x00, 0x07, 0x0F, 0x09, 0xD0,
+  0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x00, 0x03, 0x1F, 0x05, 0x06, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03,
+  0x00, 0x02, 0x0E, 0x0D, 0x00, 0x01, 0x0A, 0x0F, 0x0D, 0x06, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E,
+  0x0D, 0x10, 0x03, 0x1F, 0x0C, 0x0F, 0x09, 0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x20, 0x0A, 0x2F, 0x09,
+  0xD0, 0x03, 0x0F, 0x0E, 0x03, 0x00, 0x02, 0x0E, 0x0D, 0x20, 0x02, 0x2F, 0x09, 0xD0, 0x02, 0x0F, 0x0E, 0x03, 0x00, 0x02,
+  0x0F, 0x0E, 0x30, 0x05, 0x1F, 0x07, 0xF0, 0x01, 0x20, 0x11, 0x70, 0xA0, 0x12, 0xF0, 0x00, 0x80, 0x01, 0x07, 0x0C, 0x06,
+  0xF0, 0x00, 0x70, 0x07, 0x0E, 0x1F, 0x06, 0xF0, 0x00, 0x40, 0x01, 0x05, 0x0E, 0x3F, 0x06, 0xF0, 0x00, 0x20, 0x02, 0x06,
+  0x0C, 0x5F, 0x09, 0x05, 0x86, 0x05, 0x01, 0x40, 0x00, 0x01, 0x07, 0x0D, 0xFF, 0x2F, 0x0D, 0x01, 0x40, 0x02, 0xFF, 0x5F,
+  0x0C, 0x01, 0x40, 0x00, 0x02, 0x0A, 0x0E, 0xFF, 0x2F, 0x0D, 0x01, 0x40, 0x20, 0x03, 0x09, 0x0E, 0x5F, 0x0B, 0x98, 0x07,
+  0x01, 0x40, 0x30, 0x01, 0x03, 0x08, 0x4F, 0x06, 0xF0, 0x00, 0x60, 0x01, 0x0A, 0x2F, 0x06, 0xF0, 0x00, 0x80, 0x03, 0x0A,
+  0x0E, 0x06, 0xF0, 0x00, 0xA0, 0x13, 0xF0, 0x00
 };
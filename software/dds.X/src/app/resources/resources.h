@@ -201,7 +201,9 @@ enum {
     G_DDS_MOD0,
     G_DDS_MOD1,
     G_DDS_MOD2,
-    G_DDS_MOD3
+    G_DDS_MOD3,
+
+    G_NB_IMG
 };
 
 
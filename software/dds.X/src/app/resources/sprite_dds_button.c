@@ -265,2364 +265,2042 @@ const uint8_t sprite_dds_button_lut[] = {
 
 const uint8_t sprite_dds_button[] = {
 
-  8, /*bpp*/
+  0x88, /*bpp: 8BPP, run-length encoded*/
   0x00, 0x29, /*width*/
   0x04, 0x7C, /*height*/
 
-  /*Sprite raw*/
+  /*Row index*/
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x04, 0x48, 0x00, 0x06, 0x05, 0x00, 0x08, 0x47, 0x00, 0x0A, 0x9D, 0x00, 0x0C, 
+  0x93, 0x00, 0x0E, 0xC3, 0x00, 0x10, 0x9A, 0x00, 0x12, 0xCD, 0x00, 0x15, 0x3F, 0x00, 0x17, 0x15, 0x00, 0x19, 0x97, 0x00, 
+  0x1B, 0x79, 0x00, 0x1D, 0xDC, 0x00, 0x20, 0x63, 0x00, 0x22, 0x30, 0x00, 0x24, 0xAC, 0x00, 0x26, 0xC0, 0x00, 0x28, 0xF8, 
+  0x00, 0x2B, 0x88, 0x00, 0x2D, 0x4C, 0x00, 0x2F, 0x8B, 0x00, 0x31, 0xC3, 0x00, 0x33, 0xCB, 0x00, 0x36, 0x44, 0x00, 0x38, 
+  0x0F, 0x00, 0x3A, 0x61, 0x00, 0x3C, 0xAF, 0x00, 0x3E, 0x9D, 0x00, 0x41, 0x1B, 0x00, 0x42, 0xFB, 0x00, 0x45, 0x48, 0x00, 
+  0x47, 0xB5, 0x00, 0x49, 0x7E, 0x00, 0x4C, 0x1A, 0x00, 0x4E, 0x13, 0x00, 0x50, 0x52, 0x00, 0x52, 0xC9, 0x00, 0x54, 0x9B, 
+  0x00, 0x57, 0x36, 0x00, 0x59, 0x66, 0x00, 0x5B, 0x75, 0x00, 0x5D, 0xFD, 0x00, 0x5F, 0xBE, 0x00, 0x62, 0x49, 0x00, 0x64, 
+  0x9D, 0x00, 0x66, 0x93, 0x00, 0x69, 0x17, 0x00, 0x6A, 0xF5, 0x00, 0x6D, 0x78, 0x00, 0x6F, 0xF0, 0x00, 0x71, 0xD4, 0x00, 
+  0x74, 0x0E, 0x00, 0x75, 0xFE, 0x00, 0x78, 0x6B, 0x00, 0x7A, 0xAA, 0x00, 0x7C, 0x7F, 0x00, 0x7E, 0xF1, 0x00, 0x81, 0x07, 
+  0x00, 0x83, 0x4D, 0x00, 0x85, 0xE6, 0x00, 0x87, 0xB9, 0x00, 0x8A, 0x21, 0x00, 0x8C, 0x6A, 0x00, 0x8E, 0x80, 0x00, 0x91, 
+  0x0E, 0x00, 0x92, 0xE8, 0x00, 0x95, 0x5E, 0x00, 0x97, 0xB9, 0x00, 0x99, 0xAC, 0x00, 0x9C, 0x3F, 
 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
-  0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x06, 0x07, 0x06, 0x05, 0x08, 0x04,
-  0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x07, 0x07, 0x0E, 0x0F, 0x02, 0x10, 0x02,
-  0x0D, 0x03, 0x11, 0x11, 0x11, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x06, 0x11, 0x02, 0x16, 0x01, 0x05, 0x17,
-  0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x19, 0x1C, 0x15, 0x08, 0x07, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 0x1E, 0x1F,
-  0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x15, 0x0E, 0x10, 0x0F, 0x14, 0x25, 0x26, 0x27,
-  0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 0x0B, 0x0C, 0x14, 0x17, 0x11,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x0E, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E,
-  0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x19, 0x1A, 0x30, 0x2B, 0x1F, 0x1D, 0x0C, 0x14,
-  0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A,
-  0x2E, 0x2E, 0x2E, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C,
-  0x13, 0x24, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x22,
-  0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 0x20, 0x2A, 0x2F, 0x2A, 0x29,
-  0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x15, 0x11, 0x05, 0x13, 0x14, 0x24, 0x1C,
-  0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30, 0x26, 0x2F, 0x2F, 0x2F,
-  0x29, 0x29, 0x29, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x34, 0x05, 0x2C, 0x31, 0x31, 0x1C,
-  0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32, 0x1F, 0x29, 0x28, 0x2F,
-  0x2F, 0x2F, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x00, 0x00, 0x00, 0x01, 0x1D, 0x0A, 0x08, 0x19, 0x22, 0x30, 0x1B,
-  0x31, 0x13, 0x13, 0x23, 0x33, 0x26, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x19, 0x1E, 0x2A, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x00, 0x00, 0x00, 0x06, 0x13, 0x06, 0x0C, 0x1F, 0x2B, 0x1F,
-  0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x2C, 0x30, 0x27, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x36, 0x2B, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x01, 0x13, 0x12, 0x34, 0x20, 0x27, 0x28,
-  0x27, 0x26, 0x38, 0x30, 0x1A, 0x23, 0x1C, 0x31, 0x1F, 0x2E, 0x39, 0x2E, 0x2A, 0x2B, 0x2B, 0x1E, 0x1A, 0x1F, 0x2E, 0x37,
-  0x37, 0x37, 0x37, 0x37, 0x2E, 0x2F, 0x29, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 0x2F,
-  0x2F, 0x2F, 0x26, 0x27, 0x13, 0x13, 0x0B, 0x0A, 0x0A, 0x0C, 0x14, 0x24, 0x24, 0x14, 0x1D, 0x1D, 0x0C, 0x0C, 0x14, 0x24,
-  0x24, 0x24, 0x24, 0x24, 0x14, 0x26, 0x2F, 0x29, 0x29, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x08, 0x1D, 0x07, 0x38, 0x2F,
-  0x37, 0x2E, 0x2F, 0x27, 0x39, 0x0E, 0x11, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-  0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x21, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2C, 0x24, 0x36, 0x03, 0x0A, 0x13, 0x12, 0x26,
-  0x2E, 0x39, 0x39, 0x29, 0x2E, 0x3A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x09, 0x34, 0x20, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 0x21, 0x35, 0x19, 0x0A, 0x14, 0x0C, 0x0C,
-  0x28, 0x37, 0x39, 0x39, 0x2F, 0x39, 0x3A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x09, 0x34, 0x20, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2F, 0x1D, 0x2D, 0x1C, 0x17, 0x0C,
-  0x1D, 0x2E, 0x39, 0x39, 0x39, 0x2E, 0x39, 0x3A, 0x0E, 0x11, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
-  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x20, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x1D, 0x23, 0x19, 0x1C,
-  0x0C, 0x24, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x14, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x24, 0x0C, 0x35,
-  0x14, 0x14, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x14, 0x2B, 0x37, 0x39, 0x37, 0x39, 0x37, 0x39, 0x1C, 0x2C, 0x1A,
-  0x17, 0x0C, 0x23, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x2F,
-  0x2B, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x3A, 0x3A, 0x39, 0x39, 0x3A, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x23, 0x23,
-  0x1B, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x37, 0x37, 0x37, 0x2E, 0x2E, 0x2F, 0x29,
-  0x26, 0x26, 0x33, 0x29, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x1C,
-  0x2C, 0x1B, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2B, 0x20, 0x20, 0x20, 0x20, 0x1F, 0x29, 0x29,
-  0x26, 0x19, 0x1E, 0x32, 0x1C, 0x1F, 0x2F, 0x37, 0x2B, 0x1F, 0x1F, 0x1F, 0x1F, 0x2E, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A,
-  0x14, 0x2D, 0x1A, 0x24, 0x1D, 0x14, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x39, 0x14, 0x08, 0x34, 0x34, 0x08, 0x14, 0x2E,
-  0x37, 0x14, 0x08, 0x34, 0x34, 0x08, 0x14, 0x30, 0x2A, 0x14, 0x08, 0x34, 0x34, 0x04, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x35, 0x19, 0x31, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2E, 0x24, 0x03, 0x09, 0x09, 0x03, 0x24,
-  0x39, 0x29, 0x0C, 0x03, 0x09, 0x09, 0x34, 0x24, 0x1C, 0x33, 0x1D, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x1F, 0x24, 0x36, 0x0A, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x14, 0x03, 0x16, 0x16, 0x03,
-  0x24, 0x2E, 0x21, 0x12, 0x03, 0x16, 0x09, 0x34, 0x38, 0x2C, 0x1C, 0x12, 0x03, 0x16, 0x09, 0x34, 0x20, 0x37, 0x37, 0x37,
-  0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x2F, 0x14, 0x11, 0x10, 0x10,
-  0x11, 0x24, 0x27, 0x1B, 0x0C, 0x11, 0x10, 0x10, 0x08, 0x20, 0x21, 0x23, 0x15, 0x11, 0x10, 0x10, 0x34, 0x20, 0x2F, 0x2F,
-  0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x29, 0x2A, 0x29, 0x2E, 0x1D, 0x0E, 0x04,
-  0x04, 0x0E, 0x1D, 0x1E, 0x1B, 0x0B, 0x0E, 0x04, 0x04, 0x11, 0x20, 0x27, 0x38, 0x15, 0x08, 0x08, 0x08, 0x0E, 0x30, 0x27,
-  0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 0x28, 0x28, 0x2F, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x26, 0x1A, 0x1B, 0x1F, 0x2A, 0x27, 0x2E, 0x39, 0x37, 0x2F, 0x26, 0x1B, 0x1C, 0x1C, 0x18, 0x22, 0x25,
-  0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x24, 0x1D, 0x2B, 0x2F, 0x29, 0x2F, 0x2F, 0x2E,
-  0x2E, 0x2F, 0x2F, 0x27, 0x38, 0x19, 0x38, 0x1F, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x28, 0x20, 0x18, 0x14, 0x17, 0x2D,
-  0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x00, 0x00, 0x00, 0x3B, 0x06, 0x23, 0x35, 0x31, 0x2E, 0x2E, 0x2F, 0x2F,
-  0x2F, 0x2E, 0x2F, 0x2A, 0x20, 0x1A, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E, 0x27, 0x30, 0x31, 0x1C,
-  0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x17, 0x1D, 0x1B, 0x2E, 0x2E,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2F, 0x2B, 0x33,
-  0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x2D, 0x1C, 0x35, 0x20,
-  0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A,
-  0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0E, 0x2D, 0x1C,
-  0x14, 0x30, 0x2E, 0x2E, 0x29, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E,
-  0x2F, 0x2B, 0x21, 0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-  0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x21, 0x1B, 0x19, 0x36, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x2F,
-  0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F,
-  0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x04, 0x23, 0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F,
-  0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 0x1A, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27, 0x27, 0x2B, 0x2B, 0x27,
-  0x27, 0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x14, 0x18, 0x2D, 0x17, 0x14, 0x1D, 0x0C, 0x1D, 0x14, 0x1C, 0x35,
-  0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24,
-  0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C,
-  0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
-  0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x07, 0x1D, 0x23, 0x31, 0x19,
-  0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0A, 0x19, 0x32, 0x36, 0x36, 0x1B,
-  0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0B, 0x19, 0x38, 0x33, 0x1B, 0x1A, 0x1B,
-  0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2C, 0x22, 0x22, 0x32, 0x1B, 0x33, 0x33,
-  0x1B, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31, 0x1D, 0x15, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1B, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32,
-  0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x17, 0x0B,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23,
-  0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18,
-  0x23, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x33, 0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07,
-  0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38,
-  0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1B, 0x21, 0x22, 0x2C, 0x07, 0x03, 0x0D,
-  0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38,
-  0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x14, 0x20, 0x25, 0x1A, 0x1D, 0x08, 0x16,
-  0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B,
-  0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x21, 0x36, 0x23, 0x0B, 0x0E,
-  0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D,
-  0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x32, 0x23, 0x12,
-  0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31,
-  0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x00, 0x00, 0x00, 0x03, 0x2B, 0x21, 0x33, 0x33, 0x2D,
-  0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 0x31,
-  0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38,
-  0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x15, 0x2C, 0x1A, 0x19, 0x1C, 0x1D, 0x1D, 0x15, 0x08, 0x12, 0x2D,
-  0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0x10, 0x25, 0x20, 0x36, 0x20,
-  0x38, 0x32, 0x18, 0x14, 0x24, 0x1D, 0x0A, 0x06, 0x0E, 0x0D, 0x11, 0x0C, 0x31, 0x2D, 0x1C, 0x1D, 0x13, 0x05, 0x05, 0x24,
-  0x2C, 0x2D, 0x2D, 0x2C, 0x23, 0x17, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x23, 0x09, 0x03, 0x1F, 0x1E, 0x30,
-  0x20, 0x30, 0x38, 0x18, 0x23, 0x19, 0x0B, 0x05, 0x05, 0x34, 0x08, 0x08, 0x05, 0x06, 0x06, 0x06, 0x05, 0x05, 0x34, 0x05,
-  0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x05, 0x1C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A, 0x0F, 0x08, 0x2B, 0x22,
-  0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x36, 0x0B, 0x0E, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D,
-  0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x0D, 0x34, 0x1C, 0x19, 0x36, 0x25, 0x20, 0x33, 0x19, 0x23, 0x1A, 0x05, 0x35, 0x26,
-  0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x22, 0x0C, 0x03, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x09, 0x34, 0x23, 0x1A, 0x36, 0x1E, 0x20, 0x25, 0x32, 0x1C, 0x19, 0x13, 0x2C,
-  0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x1E, 0x13, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
-  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x16, 0x34, 0x2C, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x33, 0x24, 0x18, 0x1C,
-  0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x21, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
-  0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x2D, 0x36, 0x22, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31,
-  0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x25, 0x19, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x17, 0x1C,
-  0x1C, 0x0C, 0x14, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x33, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x1C,
-  0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x21, 0x21, 0x21, 0x22, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x19,
-  0x31, 0x17, 0x13, 0x07, 0x1C, 0x32, 0x22, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x1E,
-  0x14, 0x2C, 0x1C, 0x18, 0x20, 0x1B, 0x25, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x19, 0x31, 0x2D,
-  0x31, 0x18, 0x15, 0x14, 0x17, 0x03, 0x12, 0x23, 0x1A, 0x36, 0x38, 0x22, 0x22, 0x30, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x1F,
-  0x22, 0x1D, 0x2C, 0x24, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x2C, 0x07, 0x15, 0x07, 0x07, 0x13,
-  0x18, 0x1A, 0x0C, 0x34, 0x06, 0x15, 0x34, 0x11, 0x05, 0x1D, 0x0C, 0x15, 0x15, 0x0A, 0x15, 0x1A, 0x22, 0x21, 0x26, 0x2B,
-  0x21, 0x36, 0x35, 0x2C, 0x1D, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x1C, 0x08, 0x0E, 0x0E, 0x08,
-  0x0B, 0x1A, 0x2D, 0x06, 0x08, 0x0E, 0x0E, 0x08, 0x08, 0x0D, 0x08, 0x05, 0x08, 0x0E, 0x0E, 0x08, 0x2D, 0x38, 0x21, 0x26,
-  0x27, 0x38, 0x2D, 0x14, 0x2D, 0x34, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x1C, 0x34, 0x09, 0x3B,
-  0x03, 0x0B, 0x1A, 0x0B, 0x08, 0x11, 0x3B, 0x3B, 0x03, 0x15, 0x08, 0x0D, 0x04, 0x11, 0x3B, 0x09, 0x34, 0x17, 0x36, 0x1E,
-  0x26, 0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19, 0x31, 0x1C, 0x34, 0x09,
-  0x3B, 0x03, 0x0B, 0x17, 0x34, 0x34, 0x11, 0x3B, 0x3B, 0x03, 0x0B, 0x13, 0x11, 0x11, 0x11, 0x3B, 0x09, 0x34, 0x24, 0x1B,
-  0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x17, 0x08,
-  0x0E, 0x0E, 0x08, 0x12, 0x12, 0x08, 0x05, 0x08, 0x0E, 0x0E, 0x08, 0x0B, 0x31, 0x0A, 0x08, 0x08, 0x0E, 0x0E, 0x34, 0x13,
-  0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x00, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 0x1B, 0x2C,
-  0x07, 0x15, 0x15, 0x07, 0x15, 0x05, 0x05, 0x07, 0x06, 0x06, 0x06, 0x07, 0x13, 0x1B, 0x24, 0x06, 0x08, 0x04, 0x04, 0x34,
-  0x0C, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x31, 0x30, 0x31, 0x1A, 0x32, 0x25, 0x25, 0x22,
-  0x32, 0x1B, 0x19, 0x19, 0x23, 0x15, 0x08, 0x06, 0x13, 0x35, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 0x0F, 0x0D,
-  0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x1B, 0x2C, 0x32, 0x36, 0x21,
-  0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 0x05,
-  0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x30, 0x31, 0x2C, 0x32,
-  0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C,
-  0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x32, 0x2C,
-  0x31, 0x32, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32,
-  0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x33,
-  0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A,
-  0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-  0x04, 0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B,
-  0x22, 0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25,
-  0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31, 0x19, 0x19, 0x18, 0x2D,
-  0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x05, 0x05,
-  0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x1D, 0x13, 0x0C, 0x12, 0x0A, 0x0A, 0x15,
-  0x07, 0x07, 0x07, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B,
-  0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x05, 0x0B, 0x0C,
-  0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43,
-  0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49,
-  0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x44, 0x47, 0x4A, 0x50, 0x50,
-  0x51, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x44, 0x48, 0x52, 0x50, 0x51, 0x51,
-  0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60,
-  0x61, 0x62, 0x63, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x2C, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x68, 0x4A, 0x50, 0x50, 0x60, 0x6D,
-  0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 0x6E, 0x6E, 0x5B, 0x6F, 0x70, 0x4C, 0x6A,
-  0x71, 0x72, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x51, 0x58, 0x64,
-  0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x36, 0x19, 0x1A, 0x30, 0x73, 0x74, 0x75,
-  0x53, 0x6A, 0x71, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x45, 0x49, 0x50, 0x57, 0x0A, 0x6E,
-  0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x77,
-  0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4D, 0x47, 0x50, 0x57, 0x0A, 0x7C,
-  0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x26, 0x21, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F,
-  0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 0x7C,
-  0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x19, 0x38, 0x26, 0x29,
-  0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E,
-  0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x25, 0x1A, 0x1B, 0x1F, 0x29,
-  0x28, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x00, 0x00, 0x00, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64,
-  0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0x1B, 0x1F, 0x2F, 0x2E, 0x2F, 0x28, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x2A,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F, 0x3F, 0x00, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x1E,
-  0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0x24, 0x17, 0x33, 0x2B, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x2B, 0x20, 0x1B, 0x1B, 0x26,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x3F, 0x75, 0x4C, 0x49, 0x6F,
-  0x90, 0x29, 0x2A, 0x2B, 0x22, 0x64, 0x91, 0x6E, 0x24, 0x6E, 0x25, 0x92, 0x8B, 0x8B, 0x90, 0x73, 0x73, 0x21, 0x1A, 0x21,
-  0x92, 0x2E, 0x2E, 0x2E, 0x2E, 0x8B, 0x2F, 0x2F, 0x29, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09, 0x81, 0x94, 0x4C, 0x49,
-  0x2B, 0x77, 0x2F, 0x2F, 0x90, 0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x97,
-  0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0x99, 0x87, 0x4F, 0x6A, 0x68,
-  0x9A, 0x9B, 0x37, 0x2E, 0x2E, 0x27, 0x9C, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xA0, 0x77, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x7A, 0x5F, 0xA1, 0x11, 0x6C, 0x54,
-  0x68, 0xA2, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x9C, 0x9D, 0x5E, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x9F, 0xA0, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0xA4,
-  0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x9C, 0x9F, 0x5E, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
-  0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x9F, 0xA0, 0x8B, 0x2E, 0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C,
-  0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x39, 0x9C, 0x9D, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E,
-  0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x9F, 0xA0, 0x8B, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0xA8, 0x54, 0x71,
-  0xA9, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0xA8, 0xAA, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96,
-  0x97, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x96, 0x39, 0x37, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D,
-  0x85, 0x99, 0xAB, 0x5E, 0x94, 0xA6, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0xA8, 0x39, 0x39, 0xA8, 0xA8, 0x39, 0xA8, 0x39,
-  0xA8, 0x8B, 0x26, 0x2E, 0xA8, 0xA8, 0x39, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xA8,
-  0x7D, 0x85, 0x99, 0x9A, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37, 0x2E, 0x37, 0x2E, 0x2E,
-  0x2F, 0x29, 0x27, 0x20, 0x33, 0x27, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0xA8, 0x8D, 0x71, 0xA9, 0xAB, 0x54, 0x69, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x28,
-  0x29, 0x78, 0xAA, 0xAC, 0x95, 0x95, 0xAD, 0x20, 0x2F, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0x78, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0xAE, 0x6A, 0x7E, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0xA8, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0,
-  0x78, 0x29, 0x9C, 0xAF, 0xB0, 0xB0, 0xB0, 0xB1, 0x17, 0x38, 0xB2, 0xAF, 0xB0, 0xB0, 0xAF, 0xA0, 0xA8, 0x39, 0x39, 0x39,
-  0x39, 0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x8B, 0xAF, 0x5E, 0x53, 0xB5,
-  0xB6, 0x78, 0x2E, 0x9C, 0x9D, 0x7E, 0x53, 0x9F, 0xA0, 0x1B, 0x24, 0xB7, 0x9D, 0x7E, 0x53, 0x9F, 0xA0, 0x8B, 0x39, 0x39,
-  0x39, 0x39, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F, 0x77, 0xAF, 0x6A, 0x7E,
-  0xB5, 0xB6, 0x78, 0x92, 0xB2, 0x9D, 0x5E, 0x53, 0x9F, 0xA0, 0x27, 0x6E, 0xB8, 0x9F, 0x5E, 0x53, 0x9F, 0xA0, 0x8B, 0x37,
-  0x37, 0x37, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x40, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x29, 0x29, 0x29, 0x77, 0xAF, 0xB5,
-  0x5E, 0x9E, 0xB6, 0x78, 0x27, 0xB9, 0x9F, 0xBA, 0x5E, 0x9F, 0xA0, 0x8B, 0x20, 0xBB, 0x9D, 0xBA, 0x5E, 0x9F, 0xA0, 0x77,
-  0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x8B, 0x9D,
-  0xAF, 0xAF, 0xAF, 0xB0, 0x78, 0x21, 0xB7, 0xAF, 0xAF, 0xAF, 0xAF, 0xA0, 0x8B, 0x2A, 0xB9, 0xAF, 0xAF, 0xAF, 0xAF, 0xA0,
-  0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0x76, 0x7D, 0x6A, 0x5F, 0x27, 0x29, 0x29, 0x28, 0x92,
-  0xA8, 0x8B, 0x8B, 0x8B, 0x8B, 0x2B, 0x32, 0x1A, 0x63, 0x90, 0x90, 0x77, 0x8B, 0x2E, 0x2E, 0x2B, 0x65, 0x1C, 0x24, 0x6E,
-  0x65, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0x87, 0xAB, 0x85, 0xBF, 0xBC, 0x92, 0x2F, 0x29,
-  0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x25, 0x19, 0x36, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x29, 0x20, 0x19, 0x1C,
-  0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x56, 0x71, 0x5F, 0x5F, 0x78, 0x92,
-  0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x29, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x2B, 0x2B, 0x2B, 0x29, 0x2F, 0x2E, 0x2E, 0x27, 0x25,
-  0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x85, 0x6A, 0x84,
-  0x28, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x37, 0x2F,
-  0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0x85,
-  0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E,
-  0x2E, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56,
-  0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F,
-  0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x29,
-  0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27,
-  0x29, 0x2E, 0x2E, 0x2E, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B,
-  0x27, 0x2F, 0x8B, 0x8B, 0x27, 0xC7, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA4, 0x89, 0x7A, 0x8D, 0x5F, 0x7F, 0x6B, 0xC4, 0x74, 0x90, 0x90, 0x90,
-  0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0xAB, 0x8F, 0x7A, 0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D,
-  0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B,
-  0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x41, 0xA4, 0xAB,
-  0xC2, 0xCA, 0xCA, 0xCA, 0xC3, 0xAB, 0x72, 0x4F, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x46, 0x6C,
-  0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x46, 0x55, 0xAB, 0x8F,
-  0x8F, 0x79, 0xC9, 0xC9, 0xC9, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE,
-  0xBE, 0xC1, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC1,
-  0xC9, 0xC4, 0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0xA9, 0xC9, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x40, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x6F, 0x8C, 0x8C, 0xBE, 0xCD,
-  0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x88, 0x79, 0xC9, 0x79, 0xC2, 0x4E,
-  0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3,
-  0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D, 0x0B, 0x15, 0x15, 0x0A, 0x35, 0xC6, 0xC9, 0x89,
-  0x80, 0x75, 0x6C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xD2, 0xD2, 0x8C, 0x6F, 0x17,
-  0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D,
-  0xC9, 0x89, 0x80, 0x9A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xBC, 0xD2, 0x8C, 0x5C, 0x0B,
-  0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B,
-  0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x15,
-  0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31,
-  0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0x9A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58, 0xD4, 0xD2, 0xA9, 0x35,
-  0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D,
-  0x2D, 0x1B, 0x38, 0x30, 0xD1, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xD4, 0xD4, 0x99, 0x2C,
-  0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C,
-  0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x00, 0x00, 0x00, 0x87, 0x88, 0xD5, 0x8C, 0xD3,
-  0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15,
-  0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x00, 0x00, 0x00, 0x7B, 0xB4, 0xD4, 0x99,
-  0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05,
-  0x1D, 0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00, 0x09, 0x88, 0xB4, 0xBE,
-  0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x15, 0x2C, 0x1A, 0x19, 0x1C, 0x1D, 0x1D, 0x15, 0x08,
-  0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8, 0x3F, 0x81, 0xA2, 0xD5,
-  0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0xD6, 0x07, 0xD7, 0x7B, 0xD7, 0xD8, 0x5B, 0x5B, 0xCF, 0xD9, 0xD8, 0x07,
-  0x06, 0xD9, 0xCF, 0x5B, 0xCF, 0xCF, 0xCF, 0xCF, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x71, 0x89, 0xCA, 0x87, 0x7B, 0xB4,
-  0xD2, 0xD4, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0xAD, 0xB6, 0xB6, 0xB6, 0xB6, 0xDA, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6,
-  0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0xB6, 0x97, 0x6E, 0x32, 0x30, 0x1E, 0x65, 0xC0, 0x7D, 0xA1, 0x76, 0x08,
-  0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0xDB, 0xB0, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5,
-  0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0xB5, 0x9F, 0x97, 0x91, 0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8,
-  0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0xAC, 0xB0, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E,
-  0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x91, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 0x89,
-  0xBD, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0xAC, 0xB0, 0x7E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
-  0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x9E, 0x97, 0x91, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A,
-  0x8F, 0xC3, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0xAC, 0xAF, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-  0x9D, 0x9D, 0x9D, 0x9D, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9D, 0x97, 0x65, 0x22, 0x20, 0x1F, 0x63, 0x64,
-  0x5F, 0x7A, 0xCA, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x6D, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9,
-  0xB9, 0xB9, 0xB7, 0xB8, 0xB7, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xB9, 0xAC, 0x22, 0x25, 0x1F, 0x26, 0x26,
-  0x1E, 0x8D, 0x7D, 0xCA, 0xD3, 0xD4, 0xC9, 0x21, 0x21, 0x21, 0x22, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x1B, 0x65, 0x91,
-  0x1A, 0x19, 0x6E, 0x17, 0x13, 0x07, 0x1C, 0x65, 0x38, 0x30, 0x30, 0x64, 0x30, 0x30, 0x30, 0x64, 0x22, 0x1E, 0x1F, 0x2B,
-  0x26, 0x64, 0x6A, 0x7D, 0x80, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x91, 0x1A, 0x1A, 0x6E, 0x19,
-  0x6E, 0x2D, 0x31, 0x31, 0x0A, 0x7C, 0x17, 0x03, 0x12, 0x23, 0x1A, 0x36, 0xD1, 0xD1, 0xD1, 0x64, 0x22, 0x22, 0x1E, 0x1F,
-  0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x97, 0xB1, 0xB1,
-  0xB1, 0xB1, 0x6E, 0x19, 0xD9, 0xDA, 0xB1, 0xB1, 0xDA, 0xDC, 0x05, 0x1D, 0xAD, 0xB1, 0xA0, 0xA0, 0xA0, 0xB9, 0x64, 0x21,
-  0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 0x66, 0x06, 0xD5, 0xA1, 0xD0, 0xD1, 0x30, 0x38, 0x1B, 0x19, 0x31, 0xCF, 0xB6, 0x9F,
-  0x9F, 0x9F, 0xAF, 0x91, 0x2D, 0xD6, 0xAF, 0x9F, 0x9F, 0xB0, 0xDC, 0x02, 0x04, 0xD6, 0xAF, 0x9F, 0x9F, 0x9F, 0xDD, 0xD1,
-  0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x7B, 0xB4, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0xCF, 0xB6,
-  0xB5, 0x53, 0x5E, 0xAF, 0x91, 0x0B, 0xDE, 0xB0, 0x53, 0x53, 0x9E, 0x98, 0x04, 0x0D, 0xDE, 0xB0, 0x53, 0x53, 0x9E, 0x97,
-  0x65, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22, 0x32, 0x19, 0x31, 0xCF,
-  0xB6, 0xB5, 0x53, 0x5E, 0xAF, 0x17, 0x34, 0xD6, 0xB0, 0x53, 0x53, 0x9E, 0x97, 0x7C, 0x11, 0xD7, 0xB0, 0x53, 0x53, 0x9E,
-  0x97, 0x91, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0x3F, 0xCF, 0xD4, 0x7A, 0xB3, 0x65, 0x30, 0x33, 0x1B, 0x19,
-  0xCF, 0xB6, 0x9F, 0x9F, 0x9F, 0xAF, 0x12, 0x08, 0xD6, 0xAF, 0x9F, 0x9F, 0x9F, 0x97, 0x6E, 0x0A, 0xDE, 0xAF, 0x9F, 0x9F,
-  0x9F, 0x98, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x00, 0x11, 0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38,
-  0x1B, 0x5B, 0x97, 0xB1, 0xB1, 0xB1, 0xB6, 0x05, 0x34, 0xD8, 0xB1, 0xB1, 0xB1, 0xB1, 0xB7, 0x91, 0x24, 0xD6, 0xDA, 0xDA,
-  0xDA, 0xDA, 0xDF, 0x6E, 0x25, 0x91, 0x35, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 0x87, 0xC6, 0x8C, 0x7A, 0xB3, 0x65, 0x25,
-  0x25, 0x22, 0x32, 0x1B, 0x6E, 0x18, 0x17, 0x0A, 0x08, 0x06, 0x7C, 0x7C, 0x7C, 0x7C, 0x6E, 0x19, 0x1A, 0x31, 0x13, 0x08,
-  0x0F, 0x0D, 0x05, 0x1D, 0x1A, 0x36, 0x05, 0x75, 0x7E, 0x54, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B,
-  0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17,
-  0x12, 0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x88, 0x8C, 0x7A,
-  0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B,
-  0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBC,
-  0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A,
-  0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x48, 0x4B, 0x53, 0x75, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31,
-  0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C,
-  0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32,
-  0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 0x0E, 0x0A, 0x24, 0x6E, 0x19, 0x19,
-  0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07,
-  0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 0x48, 0x48, 0x47, 0x68, 0x53, 0x43, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54, 0x53, 0x53, 0x4B, 0x47,
-  0x47, 0x47, 0x48, 0x48, 0x48, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xA4, 0x84, 0xBA, 0x5E, 0x7E,
-  0x53, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x4F, 0xA4,
-  0x75, 0x75, 0x94, 0x94, 0x94, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-  0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x06, 0x07,
-  0x06, 0x05, 0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x07, 0x07, 0x0E,
-  0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x11, 0x11, 0x11, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x06, 0x06, 0x11, 0x02,
-  0x16, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x19, 0x1C, 0x15, 0x08, 0x07, 0x12, 0x1D, 0x14, 0x15, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x08, 0x0D, 0x01,
-  0x03, 0x14, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24,
-  0x14, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x15, 0x0E, 0x10, 0x0F,
-  0x14, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 0x0B,
-  0x0C, 0x14, 0x17, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0A, 0x0E, 0x0D, 0x11,
-  0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x19, 0x1A, 0x30, 0x2B,
-  0x1F, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0A, 0x08, 0x0D, 0x04,
-  0x13, 0x19, 0x1F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26,
-  0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x05, 0x03, 0x08,
-  0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 0x20,
-  0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x15, 0x11, 0x05,
-  0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30,
-  0x26, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x34, 0x05,
-  0x2C, 0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32,
-  0x1F, 0x29, 0x28, 0x2F, 0x2F, 0x2F, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x00, 0x00, 0x00, 0x01, 0x1D, 0x0A, 0x08,
-  0x19, 0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x33, 0x26, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x19,
-  0x1E, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x00, 0x00, 0x00, 0x06, 0x13, 0x06,
-  0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 0x1C, 0x17, 0x13, 0x1C, 0x1B, 0x1E, 0x1F, 0x20, 0x20, 0x2B, 0x26, 0x2B, 0x1B, 0x2C,
-  0x2D, 0x30, 0x20, 0x20, 0x1F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x01, 0x13, 0x12,
-  0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 0x38, 0x22, 0x1B, 0x04, 0x34, 0x34, 0x34, 0x34, 0x08, 0x06, 0x1F, 0x26, 0x27, 0x0E,
-  0x34, 0x34, 0x34, 0x34, 0x08, 0x06, 0x2B, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x0D, 0x1D,
-  0x0A, 0x1D, 0x29, 0x2F, 0x2F, 0x2F, 0x26, 0x2B, 0x1F, 0x20, 0x04, 0x10, 0x09, 0x09, 0x09, 0x0D, 0x07, 0x1F, 0x26, 0x2B,
-  0x04, 0x10, 0x09, 0x09, 0x09, 0x0D, 0x07, 0x2B, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x08,
-  0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 0x2F, 0x27, 0x29, 0x2A, 0x2A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x26, 0x26,
-  0x26, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x2B, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2C, 0x24, 0x36, 0x03,
-  0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x29, 0x2E, 0x2E, 0x2E, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x26,
-  0x26, 0x21, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x2B, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 0x21, 0x35, 0x19,
-  0x0A, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x39, 0x2F, 0x39, 0x39, 0x39, 0x3A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07,
-  0x2B, 0x26, 0x22, 0x08, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x2B, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2F, 0x1D,
-  0x2D, 0x1C, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x3A, 0x0E, 0x10, 0x16, 0x16, 0x16, 0x0D,
-  0x07, 0x2B, 0x1F, 0x26, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x27, 0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0x39,
-  0x1D, 0x23, 0x19, 0x1C, 0x0C, 0x24, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x3A, 0x0E, 0x10, 0x16, 0x16, 0x16,
-  0x0D, 0x06, 0x36, 0x26, 0x2E, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x27, 0x37, 0x37, 0x37, 0x39, 0x37, 0x39, 0x37,
-  0x39, 0x1C, 0x2C, 0x1A, 0x17, 0x0C, 0x23, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x3A, 0x0E, 0x10, 0x16, 0x16,
-  0x16, 0x0D, 0x15, 0x2B, 0x26, 0x3A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x15, 0x2A, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x3A, 0x23, 0x23, 0x1B, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x39, 0x39, 0x39, 0x3A, 0x04, 0x10, 0x16,
-  0x16, 0x16, 0x0D, 0x15, 0x20, 0x26, 0x30, 0x08, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x15, 0x28, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x3A, 0x1C, 0x2C, 0x1B, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x3A, 0x04, 0x10,
-  0x16, 0x16, 0x16, 0x0D, 0x07, 0x1B, 0x27, 0x26, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x15, 0x2A, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x24, 0x1D, 0x14, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x39, 0x04,
-  0x10, 0x16, 0x16, 0x16, 0x0D, 0x06, 0x22, 0x2B, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x2A, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x19, 0x31, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x37,
-  0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x06, 0x21, 0x2B, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x27, 0x2E, 0x37,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x1F, 0x24, 0x36, 0x0A, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x28,
-  0x37, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x20, 0x2B, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x26, 0x2F,
-  0x2E, 0x37, 0x37, 0x37, 0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28,
-  0x28, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x20, 0x2B, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x07, 0x1E,
-  0x2B, 0x28, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x29, 0x2A, 0x29,
-  0x29, 0x29, 0x39, 0x04, 0x10, 0x09, 0x09, 0x09, 0x0D, 0x07, 0x20, 0x26, 0x37, 0x04, 0x10, 0x09, 0x09, 0x09, 0x0D, 0x06,
-  0x1A, 0x1E, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 0x28,
-  0x28, 0x2F, 0x2F, 0x39, 0x11, 0x08, 0x34, 0x34, 0x34, 0x34, 0x06, 0x1F, 0x26, 0x2E, 0x11, 0x08, 0x34, 0x34, 0x34, 0x34,
-  0x05, 0x23, 0x36, 0x30, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x00, 0x00, 0x2D, 0x24, 0x1D, 0x2B, 0x2F,
-  0x29, 0x2F, 0x2F, 0x2E, 0x37, 0x21, 0x20, 0x30, 0x31, 0x23, 0x19, 0x22, 0x26, 0x26, 0x2A, 0x21, 0x20, 0x1F, 0x21, 0x36,
-  0x23, 0x1D, 0x1C, 0x2D, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x00, 0x00, 0x00, 0x3B, 0x06, 0x23, 0x35, 0x31,
-  0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2E, 0x2F, 0x2A, 0x20, 0x1A, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E,
-  0x27, 0x30, 0x31, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x17,
-  0x1D, 0x1B, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2F,
-  0x2E, 0x2F, 0x2B, 0x33, 0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0x2D, 0x1C, 0x35, 0x20, 0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F,
-  0x2E, 0x2E, 0x2E, 0x2A, 0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 0x2E, 0x29, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A,
-  0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x21, 0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x21, 0x1B, 0x19, 0x36, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B,
-  0x2A, 0x2F, 0x2F, 0x2F, 0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26,
-  0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27,
-  0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 0x1A, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27,
-  0x27, 0x2B, 0x2B, 0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x14, 0x18, 0x2D, 0x17, 0x14, 0x1D, 0x0C,
-  0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F, 0x07, 0x23, 0x1A, 0x19,
-  0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0D,
-  0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x07,
-  0x1D, 0x23, 0x31, 0x19, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0A, 0x19,
-  0x32, 0x36, 0x36, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0B, 0x19, 0x38,
-  0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 0x04,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2C, 0x22, 0x22,
-  0x32, 0x1B, 0x33, 0x33, 0x1B, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31,
-  0x1D, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1B, 0x30, 0x38,
-  0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31,
-  0x1A, 0x18, 0x17, 0x0B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1E, 0x25, 0x38,
-  0x31, 0x1C, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D,
-  0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x33, 0x1E, 0x22,
-  0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B,
-  0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1B, 0x21, 0x22,
-  0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E,
-  0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x14, 0x20, 0x25,
-  0x1A, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04,
-  0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x21,
-  0x36, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08,
-  0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x17, 0x1F,
-  0x22, 0x32, 0x23, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05,
-  0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x00, 0x00, 0x00, 0x03, 0x2B,
-  0x21, 0x33, 0x33, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1B, 0x1A, 0x18, 0x1C, 0x1D, 0x14, 0x0B,
-  0x08, 0x05, 0x35, 0x18, 0x19, 0x1A, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0x09, 0x17,
-  0x1F, 0x22, 0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x0E, 0x08, 0x05, 0x15, 0x15, 0x07, 0x12, 0x1D, 0x1D,
-  0x15, 0x08, 0x05, 0x07, 0x15, 0x15, 0x15, 0x13, 0x31, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0x10,
-  0x25, 0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0x06, 0x34, 0x04, 0x0E, 0x0E, 0x0E, 0x08, 0x0A, 0x35,
-  0x1D, 0x06, 0x34, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x12, 0x2D, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x23, 0x09,
-  0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x05, 0x0D, 0x16, 0x16, 0x3B, 0x03, 0x0A,
-  0x35, 0x13, 0x08, 0x05, 0x09, 0x16, 0x16, 0x3B, 0x03, 0x12, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A,
-  0x0F, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x2C, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x03,
-  0x12, 0x35, 0x0A, 0x08, 0x05, 0x09, 0x16, 0x16, 0x16, 0x03, 0x12, 0x31, 0x31, 0x19, 0x36, 0x25, 0x20, 0x33, 0x19, 0x23,
-  0x1A, 0x05, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x19, 0x06, 0x0D, 0x16, 0x16, 0x16,
-  0x03, 0x12, 0x14, 0x05, 0x13, 0x05, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0B, 0x1A, 0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x25, 0x32,
-  0x1C, 0x19, 0x13, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x36, 0x06, 0x0D, 0x16, 0x16,
-  0x16, 0x03, 0x0B, 0x14, 0x12, 0x23, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0B, 0x1B, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20,
-  0x33, 0x24, 0x18, 0x1C, 0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x33, 0x06, 0x0D, 0x16,
-  0x16, 0x16, 0x11, 0x05, 0x14, 0x17, 0x24, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0C, 0x33, 0x36, 0x36, 0x22, 0x20, 0x1F,
-  0x1F, 0x22, 0x24, 0x31, 0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x30, 0x30, 0x36, 0x06, 0x0D,
-  0x16, 0x16, 0x16, 0x03, 0x0B, 0x24, 0x19, 0x18, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x13, 0x30, 0x30, 0x22, 0x25, 0x1F,
-  0x26, 0x26, 0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x21, 0x21, 0x21, 0x22, 0x36, 0x36, 0x36, 0x36, 0x32, 0x19, 0x06,
-  0x0D, 0x16, 0x16, 0x16, 0x11, 0x15, 0x1D, 0x07, 0x1D, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x13, 0x25, 0x30, 0x22, 0x1E,
-  0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x18, 0x20, 0x1B, 0x25, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x31,
-  0x06, 0x0D, 0x16, 0x16, 0x16, 0x11, 0x34, 0x14, 0x1C, 0x03, 0x05, 0x09, 0x16, 0x16, 0x16, 0x03, 0x13, 0x30, 0x22, 0x22,
-  0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x24, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x19,
-  0x2C, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x11, 0x07, 0x14, 0x18, 0x13, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0C, 0x38, 0x38,
-  0x22, 0x21, 0x26, 0x2B, 0x21, 0x36, 0x35, 0x2C, 0x1D, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x31,
-  0x2D, 0x23, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x11, 0x15, 0x14, 0x2D, 0x23, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0B, 0x1B,
-  0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 0x14, 0x2D, 0x34, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x2D,
-  0x2D, 0x2D, 0x2C, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x11, 0x15, 0x35, 0x23, 0x23, 0x34, 0x09, 0x16, 0x16, 0x16, 0x03, 0x0A,
-  0x2D, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19,
-  0x31, 0x31, 0x31, 0x2D, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x03, 0x15, 0x35, 0x17, 0x17, 0x34, 0x09, 0x16, 0x16, 0x16, 0x11,
-  0x06, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33,
-  0x1B, 0x19, 0x18, 0x18, 0x2D, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x11, 0x15, 0x35, 0x1C, 0x1C, 0x34, 0x09, 0x16, 0x16, 0x16,
-  0x11, 0x34, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x00, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33,
-  0x30, 0x38, 0x1B, 0x1A, 0x19, 0x2D, 0x06, 0x0F, 0x10, 0x10, 0x10, 0x11, 0x15, 0x1D, 0x24, 0x1C, 0x34, 0x10, 0x10, 0x10,
-  0x10, 0x11, 0x04, 0x05, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x31, 0x30, 0x31, 0x1A,
-  0x32, 0x25, 0x25, 0x22, 0x32, 0x1B, 0x2D, 0x34, 0x08, 0x34, 0x34, 0x34, 0x08, 0x07, 0x1D, 0x14, 0x14, 0x04, 0x08, 0x08,
-  0x08, 0x34, 0x34, 0x04, 0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x21, 0x1B,
-  0x2C, 0x32, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x19, 0x13, 0x05, 0x08, 0x0A, 0x1D, 0x14, 0x1D, 0x14, 0x23, 0x1A, 0x1B,
-  0x32, 0x23, 0x12, 0x34, 0x04, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C,
-  0x30, 0x31, 0x2C, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31,
-  0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17,
-  0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24,
-  0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3B, 0x04, 0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17,
-  0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36,
-  0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31,
-  0x19, 0x19, 0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A,
-  0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x1D, 0x13, 0x0C,
-  0x12, 0x0A, 0x0A, 0x15, 0x07, 0x07, 0x07, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x34, 0x1C, 0x1C,
-  0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
-  0x0F, 0x05, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-  0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46,
-  0x44, 0x47, 0x48, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x44,
-  0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x44, 0x48,
-  0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F,
-  0x55, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x45, 0x49,
-  0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 0x63, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x2C, 0x66, 0x67, 0x68,
-  0x69, 0x6A, 0x6B, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x68, 0x4A,
-  0x50, 0x50, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 0x6E, 0x6E, 0x5B,
-  0x6F, 0x70, 0x4C, 0x6A, 0x71, 0x72, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x4B, 0x4A,
-  0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x36, 0x19, 0x1A,
-  0x30, 0x73, 0x74, 0x75, 0x53, 0x6A, 0x71, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x45, 0x49,
-  0x50, 0x57, 0x0A, 0x6E, 0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19,
-  0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4D, 0x47,
-  0x50, 0x57, 0x0A, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x26, 0x21, 0x1A, 0x2C,
-  0x1B, 0x20, 0x2A, 0x2F, 0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x4B,
-  0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32,
-  0x19, 0x38, 0x26, 0x29, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x41, 0x4C,
-  0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x25,
-  0x1A, 0x1B, 0x1F, 0x29, 0x28, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x00, 0x00, 0x00, 0x87, 0x82,
-  0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0x1B, 0x1F, 0x2F, 0x2E, 0x2F, 0x28, 0x2B, 0x26, 0x26, 0x1F,
-  0x38, 0x19, 0x30, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F, 0x3F, 0x00, 0x3F, 0x56,
-  0x5E, 0x45, 0x8E, 0x1E, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0xD9, 0xAD, 0xDB, 0x95, 0xAA, 0xAA, 0xAA, 0x27, 0x73, 0x74,
-  0x95, 0xDB, 0xDB, 0x95, 0xAA, 0xAA, 0xA6, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x3F,
-  0x75, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x64, 0xB7, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0xA0, 0x90, 0x26,
-  0xB2, 0xAF, 0xB0, 0xB0, 0xB0, 0xB0, 0xAF, 0x9C, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09,
-  0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x27, 0x2B, 0x26, 0xB2, 0x9D, 0x7E, 0x53, 0x53, 0x53, 0x9F, 0xA0, 0x77,
-  0x26, 0xB2, 0x9F, 0x7E, 0x53, 0x53, 0x7E, 0x9F, 0x9C, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0x99,
-  0x87, 0x4F, 0x6A, 0x68, 0x9A, 0x9B, 0x37, 0x2E, 0x2E, 0x27, 0x29, 0x29, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0,
-  0x77, 0x26, 0xB2, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2F, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x7A, 0x5F,
-  0xA1, 0x11, 0x6C, 0x54, 0x68, 0xA2, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x2E, 0x2E, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F,
-  0xA0, 0x77, 0x26, 0xB2, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2,
-  0x54, 0x7A, 0xA3, 0xA4, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x39, 0xA8, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53,
-  0x9F, 0xA0, 0x2F, 0x73, 0xB9, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2F, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x8B,
-  0xA6, 0x5E, 0x7D, 0x5C, 0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E,
-  0x53, 0x9F, 0xA0, 0x90, 0x73, 0xB9, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2E, 0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37,
-  0x37, 0xA8, 0x54, 0x71, 0xA9, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x9C, 0x9D, 0x5E, 0x7E,
-  0x7E, 0x53, 0x9F, 0xA0, 0xD1, 0x73, 0xB2, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37,
-  0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0xAB, 0x5E, 0x94, 0xA6, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x9C, 0x9D, 0x5E,
-  0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x8B, 0x73, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x9A, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0xA8, 0x9C, 0x9D,
-  0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x2A, 0x20, 0xB9, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0xA8, 0x8D, 0x71, 0xA9, 0xAB, 0x54, 0x69, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x8B, 0x9C,
-  0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x30, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0xAE, 0x6A, 0x7E, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
-  0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x30, 0x2B, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0xA8, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F,
-  0x77, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xB1, 0x21, 0x2B, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2E,
-  0x2E, 0x37, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F,
-  0x29, 0x29, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x63, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0xB2,
-  0x77, 0x29, 0x2E, 0x37, 0x37, 0x37, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x40, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x29, 0x29,
-  0x29, 0x29, 0x77, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x73, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D,
-  0xB9, 0x20, 0x2B, 0x28, 0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F,
-  0x2A, 0x28, 0x2F, 0x2F, 0x9C, 0x9D, 0x7E, 0x53, 0x53, 0x53, 0x9F, 0xA0, 0x26, 0x2B, 0x9C, 0x9D, 0x7E, 0x53, 0x53, 0x7E,
-  0x9F, 0xB7, 0x32, 0x1E, 0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0x76, 0x7D, 0x6A, 0x5F, 0x27,
-  0x29, 0x29, 0x28, 0x2F, 0x8B, 0x9C, 0xAF, 0xB0, 0xB0, 0xB0, 0xAF, 0xAF, 0xA0, 0x73, 0x2B, 0xB2, 0xAF, 0xB0, 0xB0, 0xB0,
-  0xB0, 0xAF, 0xDF, 0x2C, 0x32, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0x87, 0xAB, 0x85, 0xBF,
-  0xBC, 0x92, 0x2F, 0x29, 0x2F, 0x8B, 0xA6, 0xAA, 0xAA, 0xAA, 0xAC, 0xAD, 0xDB, 0xE4, 0x2B, 0x26, 0x74, 0xAA, 0xAA, 0xAA,
-  0xAA, 0x95, 0xDB, 0x1C, 0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x56, 0x71,
-  0x5F, 0x5F, 0x78, 0x92, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x29, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x2B, 0x2B, 0x2B, 0x29, 0x2F,
-  0x2E, 0x2E, 0x27, 0x25, 0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0xAE, 0x85, 0x6A, 0x84, 0x28, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B, 0x2B, 0x26, 0x2B, 0x2A,
-  0x2F, 0x2F, 0x37, 0x2F, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xC2, 0x85, 0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B,
-  0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B,
-  0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x2B,
-  0x2B, 0x2B, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 0x26, 0x2B,
-  0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2E, 0x2E, 0x2E, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90,
-  0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x8B, 0x27, 0xC7, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA4, 0x89, 0x7A, 0x8D, 0x5F, 0x7F, 0x6B, 0xC4,
-  0x74, 0x90, 0x90, 0x90, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0xAB, 0x8F, 0x7A, 0x84, 0x8D,
-  0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x56, 0x72, 0x6B,
-  0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x87, 0x41, 0xA4, 0xAB, 0xC2, 0xCA, 0xCA, 0xCA, 0xC3, 0xAB, 0x72, 0x4F, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
-  0x46, 0x55, 0xAB, 0x8F, 0x8F, 0x79, 0xC9, 0xC9, 0xC9, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56,
-  0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAB,
-  0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xC4, 0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0xA9, 0xC9, 0xA1, 0x79, 0xC2,
-  0x75, 0x43, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x6F,
-  0x8C, 0x8C, 0xBE, 0xCD, 0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x88, 0x79,
-  0xC9, 0x79, 0xC2, 0x4E, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xCD,
-  0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D, 0x0B, 0x15, 0x15, 0x0A,
-  0x35, 0xC6, 0xC9, 0x89, 0x80, 0x75, 0x6C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xD2,
-  0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06,
-  0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xBC,
-  0xD2, 0x8C, 0x5C, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E,
-  0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA9,
-  0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04,
-  0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0x9A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58,
-  0xD4, 0xD2, 0xA9, 0x35, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A,
-  0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0xD1, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7B,
-  0xD4, 0xD4, 0x99, 0x2C, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D,
-  0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x00, 0x00, 0x00, 0x87,
-  0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35,
-  0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x00, 0x00, 0x00,
-  0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1A, 0x1A, 0x6E, 0x24, 0x1D,
-  0x14, 0x0B, 0x08, 0x05, 0x7C, 0x6E, 0x6E, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00,
-  0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0xDE, 0xDA, 0xDA, 0xB1, 0xB1, 0xB1, 0xB1, 0xDF,
-  0x7C, 0x1D, 0xD6, 0xDA, 0xDA, 0xB1, 0xB1, 0xB1, 0xB1, 0xAD, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8,
-  0x3F, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0xD6, 0xAF, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F,
-  0x98, 0x7C, 0x1D, 0xD6, 0xAF, 0x9F, 0x9F, 0x9F, 0x9F, 0xAF, 0xAD, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x71, 0x89,
-  0xCA, 0x87, 0x7B, 0xB4, 0xD2, 0xD4, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0xD8, 0xB0, 0x53, 0x53, 0x53, 0x53,
-  0x9E, 0x98, 0x7C, 0x13, 0xDE, 0xB0, 0x53, 0x53, 0x53, 0x53, 0xB0, 0xAD, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x65, 0xC0,
-  0x7D, 0xA1, 0x76, 0x08, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0xAD, 0xAF, 0x53, 0x7E, 0x7E,
-  0x53, 0x9E, 0x97, 0x7C, 0x0A, 0xDE, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAD, 0x2D, 0x31, 0x19, 0x36, 0x25, 0x20, 0xD1,
-  0xA9, 0x85, 0xA1, 0xC8, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0xDB, 0xB0, 0x53, 0x7E,
-  0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x05, 0xD9, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAD, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20,
-  0x64, 0xD3, 0xBA, 0x89, 0xBD, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0xAC, 0xB0, 0x53,
-  0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x12, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB, 0x1A, 0x1B, 0x1B, 0x33, 0x1E,
-  0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0xAC, 0xB0,
-  0x53, 0x7E, 0x7E, 0x53, 0x9E, 0xE5, 0x7C, 0x17, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB, 0x36, 0x36, 0x36, 0x22,
-  0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x30, 0x30, 0xAC,
-  0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x19, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAC, 0x22, 0x30, 0x22,
-  0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0xD3, 0xD4, 0xC9, 0x21, 0x21, 0x21, 0x22, 0x36, 0x36, 0x36, 0x36, 0x32,
-  0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x07, 0xD9, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAC, 0x30, 0x30,
-  0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x1A,
-  0x1A, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0xE5, 0x7C, 0x1C, 0xD7, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB, 0x22,
-  0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A,
-  0x19, 0x19, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x18, 0xD9, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB,
-  0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 0x66, 0x06, 0xD5, 0xA1, 0xD0, 0xD1, 0x30, 0x38, 0x1B, 0x19,
-  0x31, 0x31, 0x2D, 0xAD, 0xAF, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x2D, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0,
-  0xAD, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x7B, 0xB4, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B,
-  0x18, 0x2D, 0x2D, 0x2D, 0xAD, 0xAF, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x23, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53,
-  0xB0, 0xD9, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22,
-  0x32, 0x19, 0x31, 0x31, 0x31, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x1D, 0x17, 0xAD, 0xB0, 0x53, 0x7E, 0x7E,
-  0x53, 0xB0, 0xD8, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0x3F, 0xCF, 0xD4, 0x7A, 0xB3, 0x65,
-  0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x1C, 0xAD, 0xAF, 0x53, 0x7E,
-  0x7E, 0x53, 0xB0, 0xDE, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x00, 0x11, 0xB4, 0xA1, 0x8F,
-  0x32, 0x6D, 0x30, 0x38, 0x1B, 0x1A, 0x19, 0xAD, 0xB0, 0x5E, 0x6A, 0x6A, 0x5E, 0x9E, 0x97, 0x7C, 0x24, 0xAD, 0xB0, 0x5E,
-  0x6A, 0x6A, 0x5E, 0xB0, 0xD7, 0x05, 0x13, 0x18, 0x25, 0x91, 0x35, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 0x87, 0xC6, 0x8C,
-  0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x1B, 0xAD, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xB1, 0x7C, 0x14, 0xAD, 0xAF,
-  0xAF, 0xAF, 0xAF, 0xAF, 0xAF, 0xD7, 0x05, 0x35, 0x1A, 0x36, 0x05, 0x75, 0x7E, 0x54, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x7B,
-  0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x6E, 0x7C, 0x05, 0x04, 0x15, 0x7C, 0x7C, 0x1D, 0x14, 0x23,
-  0x6E, 0x91, 0x91, 0x17, 0x0A, 0x08, 0x04, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x88, 0x8C, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14,
-  0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D,
-  0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x48, 0x4B, 0x53, 0x75, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24,
-  0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C,
-  0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38,
-  0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x4F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 0x0E, 0x0A,
-  0x24, 0x6E, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D,
-  0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 0x48, 0x48, 0x47, 0x68, 0x53, 0x43, 0x40, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54,
-  0x53, 0x53, 0x4B, 0x47, 0x47, 0x47, 0x48, 0x48, 0x48, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xA4,
-  0x84, 0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x87, 0x4F, 0xA4, 0x75, 0x75, 0x94, 0x94, 0x94, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x03, 0x06, 0x07, 0x06, 0x05, 0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x0D, 0x07, 0x07, 0x0E, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x11, 0x11, 0x11, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15,
-  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-  0x06, 0x06, 0x11, 0x02, 0x16, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x19, 0x1C, 0x15, 0x08, 0x07, 0x12,
-  0x1D, 0x14, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x22, 0x1B, 0x23, 0x0C,
-  0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04,
-  0x15, 0x0E, 0x10, 0x0F, 0x14, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C,
-  0x2D, 0x1B, 0x2D, 0x0B, 0x0C, 0x14, 0x17, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-  0x0A, 0x0E, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B,
-  0x19, 0x1A, 0x30, 0x2B, 0x1F, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
-  0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22,
-  0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D,
-  0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E,
-  0x1A, 0x2D, 0x32, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x12, 0x15, 0x11, 0x05, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26,
-  0x1E, 0x1B, 0x19, 0x30, 0x26, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00,
-  0x04, 0x0B, 0x34, 0x05, 0x2C, 0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B,
-  0x1F, 0x22, 0x1A, 0x32, 0x1F, 0x29, 0x28, 0x2F, 0x2F, 0x2F, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x00, 0x00, 0x00,
-  0x01, 0x1D, 0x0A, 0x08, 0x19, 0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x33, 0x25, 0x37, 0x2E, 0x2F, 0x2A, 0x2B, 0x26,
-  0x26, 0x1F, 0x36, 0x19, 0x1E, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x00, 0x00,
-  0x00, 0x06, 0x13, 0x06, 0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x31, 0x04, 0x23, 0x27, 0x2E, 0x29, 0x27,
-  0x26, 0x26, 0x20, 0x1A, 0x36, 0x2B, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F,
-  0x00, 0x01, 0x13, 0x12, 0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 0x38, 0x22, 0x19, 0x17, 0x1C, 0x08, 0x08, 0x06, 0x17, 0x2E,
-  0x27, 0x26, 0x26, 0x30, 0x1A, 0x20, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x20, 0x35, 0x2D,
-  0x12, 0x09, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 0x2F, 0x2F, 0x2F, 0x26, 0x2B, 0x1F, 0x1E, 0x1B, 0x2C, 0x08, 0x10, 0x03, 0x04,
-  0x05, 0x32, 0x1F, 0x26, 0x36, 0x33, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x2A, 0x24,
-  0x17, 0x1B, 0x09, 0x08, 0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 0x2F, 0x27, 0x29, 0x2A, 0x2B, 0x20, 0x38, 0x08, 0x10, 0x16,
-  0x01, 0x0F, 0x08, 0x15, 0x18, 0x36, 0x26, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E,
-  0x2C, 0x24, 0x36, 0x03, 0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x29, 0x2E, 0x2E, 0x2E, 0x2F, 0x2A, 0x27, 0x04, 0x10,
-  0x16, 0x16, 0x16, 0x01, 0x11, 0x04, 0x0A, 0x20, 0x2F, 0x2E, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F,
-  0x37, 0x21, 0x35, 0x19, 0x0A, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x39, 0x2F, 0x39, 0x39, 0x39, 0x37, 0x2E, 0x39, 0x04,
-  0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x11, 0x05, 0x0C, 0x26, 0x2E, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x37, 0x2E,
-  0x2E, 0x2E, 0x2F, 0x1D, 0x2D, 0x1C, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A,
-  0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0D, 0x04, 0x04, 0x17, 0x2B, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x39,
-  0x2E, 0x37, 0x37, 0x39, 0x1D, 0x23, 0x19, 0x1C, 0x0C, 0x24, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x3A, 0x0E, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0D, 0x04, 0x06, 0x1C, 0x2E, 0x39, 0x37, 0x37,
-  0x39, 0x37, 0x39, 0x37, 0x39, 0x1C, 0x2C, 0x1A, 0x17, 0x0C, 0x23, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x3A, 0x0E, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x08, 0x34, 0x22, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x23, 0x23, 0x1B, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x39, 0x39, 0x39,
-  0x39, 0x37, 0x3A, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x11, 0x04, 0x1D, 0x2B,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x1C, 0x2C, 0x1B, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 0x37, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x03, 0x34, 0x0A, 0x25, 0x3A,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x24, 0x1D, 0x14, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x2F, 0x2F, 0x29, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x08, 0x07, 0x22, 0x2F, 0x39,
-  0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x19, 0x31, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E,
-  0x2F, 0x2F, 0x29, 0x28, 0x2A, 0x37, 0x04, 0x10, 0x16, 0x16, 0x16, 0x16, 0x01, 0x0D, 0x08, 0x06, 0x12, 0x36, 0x1F, 0x27,
-  0x2F, 0x2E, 0x2E, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x1F, 0x24, 0x36, 0x0A, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x28, 0x28, 0x28, 0x28, 0x39, 0x04, 0x10, 0x16, 0x16, 0x16, 0x0D, 0x04, 0x04, 0x31, 0x20, 0x2D, 0x1C, 0x1A,
-  0x25, 0x26, 0x2A, 0x2F, 0x2E, 0x37, 0x37, 0x37, 0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F,
-  0x29, 0x28, 0x2F, 0x28, 0x28, 0x29, 0x2F, 0x39, 0x04, 0x10, 0x16, 0x10, 0x0E, 0x05, 0x0C, 0x27, 0x37, 0x2F, 0x21, 0x17,
-  0x24, 0x18, 0x38, 0x20, 0x2B, 0x28, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x01, 0x1C, 0x14, 0x13, 0x2A,
-  0x2F, 0x29, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x2F, 0x39, 0x04, 0x0D, 0x0E, 0x04, 0x0C, 0x25, 0x2B, 0x28, 0x2F, 0x2E, 0x27,
-  0x33, 0x1C, 0x24, 0x2D, 0x36, 0x1E, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x3B, 0x0A, 0x23, 0x1D,
-  0x2D, 0x29, 0x2F, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x39, 0x0E, 0x34, 0x07, 0x23, 0x26, 0x2B, 0x26, 0x2A, 0x2F, 0x2E,
-  0x2F, 0x26, 0x1A, 0x24, 0x24, 0x2D, 0x36, 0x30, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x00, 0x00, 0x2D,
-  0x24, 0x1D, 0x2B, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x39, 0x08, 0x2C, 0x18, 0x22, 0x1F, 0x2B, 0x26, 0x27, 0x2F,
-  0x2F, 0x2E, 0x28, 0x20, 0x18, 0x14, 0x17, 0x2D, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x00, 0x00, 0x00, 0x3B,
-  0x06, 0x23, 0x35, 0x31, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2E, 0x2F, 0x2A, 0x20, 0x1B, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27,
-  0x2F, 0x2F, 0x2E, 0x2E, 0x27, 0x30, 0x31, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x24, 0x17, 0x1D, 0x1B, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26,
-  0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2F, 0x2B, 0x33, 0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0x2D, 0x1C, 0x35, 0x20, 0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B,
-  0x26, 0x27, 0x28, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 0x2E, 0x29, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B,
-  0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x21, 0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x21, 0x1B, 0x19, 0x36, 0x21, 0x26,
-  0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x2F, 0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20,
-  0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E,
-  0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 0x1A, 0x2D, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14,
-  0x2C, 0x25, 0x26, 0x27, 0x27, 0x2B, 0x2B, 0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x14, 0x18, 0x2D,
-  0x17, 0x14, 0x1D, 0x0C, 0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0F,
-  0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3B, 0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x09, 0x10, 0x07, 0x1D, 0x23, 0x31, 0x19, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x0D, 0x0A, 0x19, 0x32, 0x36, 0x36, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12,
-  0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x0B, 0x19, 0x38, 0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A,
-  0x31, 0x1C, 0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x02, 0x2C, 0x22, 0x22, 0x32, 0x1B, 0x33, 0x33, 0x1B, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D,
-  0x24, 0x18, 0x1A, 0x31, 0x1D, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x1B, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D, 0x0B, 0x15,
-  0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x17, 0x0B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A,
-  0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0D, 0x33, 0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05,
-  0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x1B, 0x21, 0x22, 0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D,
-  0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x14, 0x20, 0x25, 0x1A, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14,
-  0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x21, 0x21, 0x36, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D,
-  0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x00, 0x00,
-  0x00, 0x09, 0x17, 0x1F, 0x22, 0x32, 0x23, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x2C, 0x32, 0x19, 0x2D, 0x14,
-  0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x00,
-  0x00, 0x00, 0x03, 0x2B, 0x21, 0x33, 0x33, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x34, 0x08, 0x13, 0x2D, 0x18,
-  0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17,
-  0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x08, 0x08, 0x05,
-  0x0B, 0x1C, 0x1D, 0x1D, 0x15, 0x08, 0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C,
-  0x18, 0x06, 0x3B, 0x10, 0x25, 0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0x06, 0x0E, 0x0D, 0x08, 0x0D,
-  0x03, 0x04, 0x05, 0x0B, 0x1D, 0x05, 0x05, 0x1C, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A,
-  0x23, 0x19, 0x23, 0x09, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x15, 0x08, 0x34,
-  0x0D, 0x16, 0x01, 0x0F, 0x34, 0x05, 0x34, 0x1D, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E,
-  0x1B, 0x23, 0x2D, 0x1A, 0x0F, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x31, 0x1C, 0x0B,
-  0x05, 0x0D, 0x16, 0x16, 0x16, 0x01, 0x11, 0x08, 0x15, 0x23, 0x31, 0x2D, 0x23, 0x2C, 0x2C, 0x2D, 0x31, 0x19, 0x36, 0x25,
-  0x20, 0x33, 0x19, 0x23, 0x1A, 0x05, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x1B, 0x1A,
-  0x2C, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x10, 0x11, 0x05, 0x15, 0x1C, 0x31, 0x31, 0x18, 0x19, 0x1A, 0x1A, 0x36,
-  0x1E, 0x20, 0x25, 0x32, 0x1C, 0x19, 0x13, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x22,
-  0x38, 0x1A, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x0D, 0x04, 0x08, 0x0C, 0x2D, 0x1B, 0x1A, 0x1B, 0x1B,
-  0x33, 0x1E, 0x1F, 0x20, 0x33, 0x24, 0x18, 0x1C, 0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E,
-  0x25, 0x1E, 0x33, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x02, 0x08, 0x05, 0x0C, 0x36, 0x36,
-  0x36, 0x22, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x30,
-  0x30, 0x22, 0x30, 0x33, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x03, 0x08, 0x34,
-  0x2C, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x21, 0x21, 0x21, 0x22, 0x36, 0x36, 0x36,
-  0x36, 0x32, 0x32, 0x1B, 0x19, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x0E, 0x04,
-  0x12, 0x1A, 0x30, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x18, 0x20, 0x1B, 0x25, 0x25, 0x25, 0x38, 0x1B, 0x1B,
-  0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0x2D, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x01, 0x03, 0x34, 0x15,
-  0x2D, 0x25, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x24, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B,
-  0x1A, 0x1A, 0x19, 0x19, 0x31, 0x31, 0x23, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x03, 0x08, 0x05, 0x1C,
-  0x1A, 0x36, 0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0x36, 0x35, 0x2C, 0x1D, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38,
-  0x1B, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x2D, 0x2C, 0x06, 0x0D, 0x16, 0x16, 0x16, 0x16, 0x01, 0x0D, 0x08, 0x08, 0x08, 0x12,
-  0x24, 0x2C, 0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 0x14, 0x2D, 0x34, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30,
-  0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x18, 0x2D, 0x06, 0x0D, 0x16, 0x16, 0x09, 0x0D, 0x04, 0x08, 0x0C, 0x08, 0x0D,
-  0x0E, 0x07, 0x13, 0x1C, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x10, 0x21, 0x38, 0x31, 0x33,
-  0x33, 0x22, 0x32, 0x19, 0x31, 0x31, 0x31, 0x19, 0x18, 0x2D, 0x06, 0x0D, 0x16, 0x10, 0x0E, 0x05, 0x15, 0x2D, 0x1A, 0x13,
-  0x11, 0x02, 0x11, 0x05, 0x12, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0x3B, 0x2D, 0x21, 0x18,
-  0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 0x19, 0x19, 0x31, 0x06, 0x03, 0x0E, 0x08, 0x07, 0x13, 0x1C, 0x18, 0x1A,
-  0x2D, 0x0A, 0x03, 0x02, 0x03, 0x34, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x00, 0x11, 0x2B,
-  0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x2D, 0x05, 0x34, 0x34, 0x0A, 0x14, 0x1D, 0x24, 0x2D,
-  0x19, 0x1A, 0x24, 0x06, 0x0F, 0x02, 0x03, 0x05, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09,
-  0x31, 0x30, 0x31, 0x1A, 0x32, 0x25, 0x25, 0x22, 0x32, 0x1B, 0x19, 0x18, 0x1C, 0x05, 0x08, 0x06, 0x13, 0x1D, 0x1D, 0x14,
-  0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 0x0F, 0x0D, 0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0x21, 0x1B, 0x2C, 0x32, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D,
-  0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x1C, 0x30, 0x31, 0x2C, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35,
-  0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 0x3B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D,
-  0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14,
-  0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C,
-  0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x19,
-  0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04,
-  0x0E, 0x0A, 0x24, 0x31, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D,
-  0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x35, 0x1C,
-  0x24, 0x1D, 0x13, 0x0C, 0x12, 0x0A, 0x0A, 0x15, 0x07, 0x07, 0x07, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0F, 0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x09, 0x0F, 0x05, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
-  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x41, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4A, 0x48, 0x4B, 0x53,
-  0x54, 0x55, 0x56, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x44, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 0x4A,
-  0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 0x63, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65,
-  0x2C, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x6C, 0x68, 0x4A, 0x50, 0x50, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21,
-  0x32, 0x6E, 0x6E, 0x5B, 0x6F, 0x70, 0x4C, 0x6A, 0x71, 0x72, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26,
-  0x21, 0x36, 0x19, 0x1A, 0x30, 0x73, 0x74, 0x75, 0x53, 0x6A, 0x71, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x46, 0x45, 0x49, 0x50, 0x57, 0x0A, 0x6E, 0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25,
-  0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x4D, 0x47, 0x50, 0x57, 0x0A, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 0x26, 0x26,
-  0x26, 0x21, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26,
-  0x2B, 0x26, 0x20, 0x32, 0x19, 0x38, 0x26, 0x29, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x00, 0x00,
-  0x00, 0x00, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B,
-  0x26, 0x2B, 0x26, 0x25, 0x1A, 0x1B, 0x1F, 0x29, 0x28, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x00,
-  0x00, 0x00, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0xB7, 0xC7, 0x2F, 0x2E, 0x2F, 0x28,
-  0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F,
-  0x3F, 0x00, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x1E, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0x24, 0x98, 0x98, 0xB2, 0x2A, 0x2E,
-  0x29, 0x27, 0x26, 0x2B, 0x20, 0x1B, 0x1B, 0x26, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x8B, 0x7F, 0x5F,
-  0x8F, 0x7B, 0x00, 0x3F, 0x75, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x22, 0x1B, 0x23, 0x98, 0xE6, 0xE6, 0x97,
-  0xB2, 0x2E, 0x90, 0x26, 0x26, 0x1E, 0x19, 0x1E, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x92, 0x93,
-  0x6A, 0x85, 0x86, 0x09, 0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x27, 0x2B, 0x26, 0x21, 0x36, 0xB7, 0xE5, 0x7E,
-  0xE7, 0xE6, 0x97, 0x95, 0x74, 0x26, 0x22, 0x1B, 0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F,
-  0x78, 0x8D, 0x8D, 0x99, 0x87, 0x4F, 0x6A, 0x68, 0x9A, 0x9B, 0x37, 0x2E, 0x2E, 0x27, 0x29, 0x28, 0x27, 0x1F, 0xDD, 0xE5,
-  0x53, 0x7E, 0x5E, 0xE7, 0x97, 0xDD, 0xAC, 0x65, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F,
-  0x29, 0x8B, 0x7A, 0x5F, 0xA1, 0x11, 0x6C, 0x54, 0x68, 0xA2, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x2E, 0x2E, 0x2F, 0x29, 0xDD,
-  0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x54, 0xE5, 0xE6, 0xB7, 0x74, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2E, 0x2E,
-  0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0xA4, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x39, 0x39, 0x37, 0x39,
-  0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x54, 0xE5, 0x97, 0xB9, 0x78, 0x92, 0x77, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E,
-  0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C, 0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xBA, 0xE8, 0xE6, 0xB2, 0x78, 0x2E, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x39, 0x2E, 0x37, 0x37, 0xA8, 0x54, 0x71, 0xA9, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xBA, 0xE6, 0x97, 0xB2, 0x8B, 0x8B,
-  0x37, 0x37, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0xAB, 0x5E, 0x94, 0xA6, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0xB9, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0x7E, 0xE5, 0x98, 0xDD,
-  0xA6, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x9A, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37,
-  0x39, 0x37, 0x37, 0x39, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xBA, 0xE8, 0xE6, 0xB2,
-  0xA6, 0xA8, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0x8D, 0x71, 0xA9, 0xAB, 0x54, 0x69, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x54, 0xE5, 0x97, 0xB9, 0xA6,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0xAE, 0x6A, 0x7E, 0xA7, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x92, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x54, 0xE5, 0xE6, 0xB7, 0xC7, 0x29,
-  0x2E, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E,
-  0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x29, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0x7E, 0x5E, 0xE7, 0x97, 0xDD, 0xDB, 0x17, 0x1B,
-  0x20, 0x27, 0x29, 0x2F, 0x2E, 0x37, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x56, 0x84, 0x5E, 0x8F, 0xA8,
-  0x2F, 0x2F, 0x29, 0x2F, 0x29, 0x28, 0x28, 0x29, 0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0xE7, 0xE6, 0x97, 0x95, 0x28, 0x27, 0x31,
-  0x24, 0x19, 0x30, 0x1F, 0x2A, 0x29, 0x2E, 0x37, 0x37, 0x37, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x40, 0x6B, 0x6A, 0x7E,
-  0x8B, 0x2F, 0x29, 0x29, 0x29, 0x29, 0x2A, 0x28, 0x92, 0xDD, 0xE5, 0x7E, 0xBA, 0xE6, 0x97, 0xB9, 0x73, 0x2A, 0x2F, 0x2E,
-  0x20, 0x23, 0x24, 0x31, 0x33, 0x20, 0x2B, 0x28, 0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x3F, 0xBD, 0x8D,
-  0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x2F, 0x29, 0x29, 0x2E, 0xDD, 0x98, 0xE5, 0x97, 0xBB, 0x25, 0x2B, 0x26, 0x27, 0x2F,
-  0x2E, 0x2A, 0x22, 0x17, 0x24, 0x2C, 0x32, 0x1E, 0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0x76,
-  0x7D, 0x6A, 0x5F, 0x27, 0x29, 0x29, 0x28, 0x2F, 0x2E, 0x2F, 0x2E, 0xDD, 0x98, 0xB7, 0x5B, 0x91, 0x20, 0x2B, 0x2B, 0x27,
-  0x2F, 0x2E, 0x2E, 0x2B, 0x32, 0x1C, 0x24, 0x2C, 0x32, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00,
-  0x87, 0xAB, 0x85, 0xBF, 0xBC, 0x92, 0x2F, 0x29, 0x2F, 0x2E, 0x2E, 0x2E, 0xB2, 0x74, 0x25, 0x91, 0x36, 0x1F, 0x2B, 0x26,
-  0x2B, 0x29, 0x2F, 0x2E, 0x29, 0x20, 0x19, 0x1C, 0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x00, 0x00,
-  0x00, 0x00, 0x56, 0x71, 0x5F, 0x5F, 0x78, 0x92, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x92, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x2B,
-  0x2B, 0x2B, 0x29, 0x2F, 0x2E, 0x2E, 0x27, 0x25, 0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0xAE, 0x85, 0x6A, 0x84, 0x28, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B,
-  0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x37, 0x2F, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC2, 0x85, 0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20,
-  0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22,
-  0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x19, 0x1B,
-  0x25, 0x26, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B,
-  0x38, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2E, 0x2E, 0x2E, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6,
-  0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x8B, 0x27, 0xC7, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xA4, 0x89, 0x7A, 0x8D,
-  0x5F, 0x7F, 0x6B, 0xC4, 0x74, 0x90, 0x90, 0x90, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0xAB,
-  0x8F, 0x7A, 0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x00, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0x87, 0x41, 0xA4, 0xAB, 0xC2, 0xCA, 0xCA, 0xCA, 0xC3, 0xAB, 0x72, 0x4F, 0x87, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x87, 0x46, 0x55, 0xAB, 0x8F, 0x8F, 0x79, 0xC9, 0xC9, 0xC9, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43,
-  0x41, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA,
-  0x9A, 0xCE, 0xCC, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xC4, 0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0xA9,
-  0xC9, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x81, 0x6F, 0x8C, 0x8C, 0xBE, 0xCD, 0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14,
-  0x7C, 0x7C, 0x88, 0x79, 0xC9, 0x79, 0xC2, 0x4E, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x76, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x1D, 0x1D, 0x1D,
-  0x0B, 0x15, 0x15, 0x0A, 0x35, 0xC6, 0xC9, 0x89, 0x80, 0x75, 0x6C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x76, 0xD2, 0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12,
-  0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x7B, 0xBC, 0xD2, 0x8C, 0x5C, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15,
-  0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D,
-  0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0x9A, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x58, 0xD4, 0xD2, 0xA9, 0x35, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14,
-  0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0xD1, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D,
-  0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56,
-  0x00, 0x00, 0x00, 0x87, 0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0xD8, 0xAD, 0x91, 0x91,
-  0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F,
-  0xAB, 0x00, 0x00, 0x00, 0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0xDE, 0xE6, 0xB7,
-  0xCF, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D,
-  0x8F, 0xCA, 0x56, 0x00, 0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0xD7, 0x97,
-  0xE9, 0x97, 0xB7, 0xD9, 0x7C, 0x1D, 0x15, 0x08, 0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91,
-  0xC6, 0x7D, 0x89, 0xC8, 0x3F, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0x06, 0x0E, 0xD7,
-  0x97, 0x53, 0xBA, 0xE8, 0xE6, 0xDF, 0xD8, 0x05, 0x05, 0x1C, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30,
-  0x36, 0x5B, 0x71, 0x89, 0xCA, 0x87, 0x7B, 0xB4, 0xD2, 0xD4, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x15,
-  0xDE, 0x97, 0x53, 0x7E, 0x7E, 0xBA, 0xE8, 0x97, 0xEA, 0x35, 0x19, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2C, 0x18, 0x32,
-  0x30, 0x1E, 0x65, 0xC0, 0x7D, 0xA1, 0x76, 0x08, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x31,
-  0x1C, 0xD8, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x53, 0xE7, 0xE6, 0x98, 0xBB, 0x31, 0x2D, 0x23, 0x2C, 0x2C, 0x2D, 0x31, 0x19,
-  0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36,
-  0x1B, 0x1A, 0xCF, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0x5E, 0x8D, 0x98, 0x98, 0xBB, 0x2D, 0x6E, 0x18, 0x19, 0x1A,
-  0x1A, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 0x89, 0xBD, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30,
-  0x22, 0x22, 0x38, 0x5B, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xE9, 0xE6, 0x97, 0xAD, 0x1A, 0x1A,
-  0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E,
-  0x25, 0x1E, 0x25, 0x1E, 0xAC, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x54, 0xE7, 0x97, 0xB7,
-  0xDB, 0x36, 0x36, 0x22, 0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22,
-  0x30, 0x30, 0x30, 0x22, 0x30, 0xAC, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x8D,
-  0x98, 0x98, 0xDB, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0xD3, 0xD4, 0xC9, 0x21, 0x21, 0x21, 0x22, 0x36,
-  0x36, 0x36, 0x36, 0x32, 0x32, 0x1B, 0x5B, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0xBA, 0xE8,
-  0x98, 0xDB, 0x6D, 0x64, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38,
-  0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0xCF, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x6A, 0xE5, 0x97,
-  0xB7, 0x61, 0x22, 0x22, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25,
-  0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x31, 0x31, 0xCF, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x54, 0xE5, 0xE6, 0xDF,
-  0xCF, 0x91, 0x1B, 0x36, 0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 0x66, 0x06, 0xD5, 0xA1, 0xD0, 0xD1,
-  0x30, 0x38, 0x1B, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x2D, 0xCF, 0x97, 0x53, 0x7E, 0x7E, 0x7E, 0x54, 0xE7, 0x97, 0xDF, 0xD7,
-  0x04, 0x12, 0x24, 0x2C, 0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x7B, 0xB4, 0xC1, 0xCD,
-  0xD1, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x18, 0xCF, 0x97, 0x53, 0x53, 0x5E, 0xE9, 0xE6, 0x98, 0xDB, 0x17,
-  0x04, 0x0D, 0x0E, 0x07, 0x13, 0x1C, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x10, 0x93, 0xBE,
-  0x7A, 0xD1, 0x33, 0x22, 0x32, 0x19, 0x31, 0x31, 0x31, 0x19, 0x18, 0xCF, 0x97, 0x7E, 0xE7, 0x97, 0x98, 0xB8, 0x17, 0x19,
-  0x1A, 0x13, 0x11, 0x02, 0x11, 0x05, 0x12, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0x3F, 0xCF,
-  0xD4, 0x7A, 0xB3, 0x65, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 0x19, 0x19, 0x5B, 0x98, 0xE8, 0x98, 0xD8, 0x35, 0x1D, 0x1C,
-  0x31, 0x1A, 0x2D, 0x0A, 0x03, 0x02, 0x03, 0x34, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x00,
-  0x11, 0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0xCF, 0x98, 0xEA, 0x05, 0x0B, 0x35, 0x1D,
-  0x24, 0x2D, 0x19, 0x1A, 0x24, 0x06, 0x0F, 0x02, 0x03, 0x05, 0x13, 0x18, 0x25, 0x91, 0x35, 0x69, 0x54, 0x8D, 0x4F, 0x00,
-  0x00, 0x87, 0xC6, 0x8C, 0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x1B, 0x19, 0x18, 0x17, 0xD6, 0x04, 0x06, 0x13, 0x1D,
-  0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 0x0F, 0x0D, 0x05, 0x35, 0x1A, 0x36, 0x05, 0x75, 0x7E, 0x54, 0x9A, 0x00,
-  0x00, 0x00, 0x00, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13,
-  0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x88, 0x8C, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12,
-  0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4,
-  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15,
-  0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x48, 0x4B, 0x53, 0x75,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C,
-  0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A,
-  0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C,
-  0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69,
-  0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04,
-  0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54,
-  0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94,
-  0xA4, 0xE0, 0x0E, 0x0A, 0x24, 0x6E, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D,
-  0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x40, 0xBD, 0x7A, 0x8D,
-  0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 0x48, 0x48, 0x47, 0x68, 0x53, 0x43,
-  0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x56,
-  0xC2, 0x84, 0x5F, 0x54, 0x53, 0x53, 0x4B, 0x47, 0x47, 0x47, 0x48, 0x48, 0x48, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41,
-  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x56, 0xA4, 0x84, 0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00,
-  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x4F, 0xA4, 0x75, 0x75, 0x94, 0x94, 0x94, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x06, 0x15, 0x06, 0x05, 0x04, 0x0F, 0x02, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x06, 0x07, 0x06, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B,
-  0x06, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x0D, 0x07, 0x07, 0x04, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x11, 0x11, 0x11, 0x04, 0x08, 0x07,
-  0x12, 0x13, 0x14, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x06, 0x07, 0x0E, 0x0D, 0x16, 0x16, 0x08, 0x24, 0x2D, 0x18, 0x1A, 0x1B, 0x1B, 0x1A, 0x18, 0x24,
-  0x07, 0x08, 0x07, 0x0B, 0x1D, 0x14, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0F, 0x0A, 0x08, 0x0F, 0x01, 0x0F, 0x1D, 0x30, 0x20, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21,
-  0x22, 0x1B, 0x23, 0x0C, 0x15, 0x0A, 0x13, 0x24, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x09, 0x11, 0x0A, 0x04, 0x02, 0x0D, 0x35, 0x30, 0x26, 0x27, 0x2A, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26,
-  0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1A, 0x23, 0x12, 0x0C, 0x14, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0E, 0x12, 0x04, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B,
-  0x26, 0x1F, 0x1E, 0x32, 0x18, 0x18, 0x30, 0x27, 0x20, 0x1D, 0x0C, 0x14, 0x2C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0x12, 0x08, 0x0D, 0x0E, 0x0C, 0x19, 0x1F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2B, 0x20, 0x25, 0x22, 0x30,
-  0x25, 0x1E, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x29, 0x27, 0x17, 0x13, 0x24, 0x23, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x30, 0x2B, 0x28, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x26,
-  0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x27, 0x29, 0x29, 0x17, 0x13, 0x1C, 0x17, 0x01, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x0A, 0x15, 0x11, 0x34, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x22, 0x25, 0x27, 0x2F, 0x2F, 0x2F, 0x2A,
-  0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x22, 0x26, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2A, 0x14, 0x1D, 0x2C, 0x15, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x11, 0x0C, 0x05, 0x34, 0x23, 0x2D, 0x2D, 0x1C, 0x14, 0x35, 0x17, 0x1F, 0x2F, 0x2E, 0x2F, 0x2F,
-  0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x30, 0x1A, 0x32, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x2A, 0x2F, 0x2B, 0x1D, 0x24, 0x32,
-  0x0F, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0A, 0x08, 0x31, 0x38, 0x22, 0x1A, 0x2D, 0x1D, 0x13, 0x23, 0x19, 0x38, 0x26, 0x39,
-  0x2E, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x33, 0x19, 0x25, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x1B, 0x1D,
-  0x23, 0x24, 0x00, 0x00, 0x00, 0x05, 0x13, 0x06, 0x12, 0x20, 0x26, 0x1F, 0x25, 0x1A, 0x1D, 0x0A, 0x08, 0x04, 0x04, 0x0E,
-  0x05, 0x1A, 0x27, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x32, 0x2B, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x2E,
-  0x1D, 0x24, 0x31, 0x0F, 0x00, 0x01, 0x13, 0x12, 0x08, 0x1E, 0x27, 0x28, 0x27, 0x26, 0x14, 0x05, 0x04, 0x0D, 0x01, 0x01,
-  0x01, 0x0F, 0x08, 0x15, 0x20, 0x26, 0x26, 0x25, 0x19, 0x21, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29,
-  0x2F, 0x21, 0x35, 0x2D, 0x07, 0x3B, 0x0D, 0x1D, 0x0A, 0x13, 0x29, 0x2F, 0x2F, 0x2E, 0x1B, 0x08, 0x03, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x0E, 0x08, 0x1E, 0x26, 0x33, 0x36, 0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29,
-  0x29, 0x2F, 0x27, 0x24, 0x17, 0x2D, 0x09, 0x08, 0x1D, 0x15, 0x36, 0x2F, 0x2E, 0x37, 0x1F, 0x34, 0x0F, 0x16, 0x16, 0x01,
-  0x03, 0x11, 0x0F, 0x16, 0x16, 0x16, 0x0E, 0x0A, 0x20, 0x1B, 0x1F, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2E, 0x23, 0x1C, 0x36, 0x03, 0x0A, 0x13, 0x0A, 0x1F, 0x2E, 0x39, 0x39, 0x13, 0x04, 0x16, 0x16, 0x02,
-  0x34, 0x15, 0x0A, 0x06, 0x04, 0x01, 0x16, 0x01, 0x34, 0x2D, 0x33, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F,
-  0x2E, 0x2F, 0x2F, 0x2F, 0x37, 0x25, 0x14, 0x19, 0x15, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x27, 0x06, 0x0D, 0x16, 0x01,
-  0x04, 0x14, 0x27, 0x27, 0x1E, 0x15, 0x0E, 0x3B, 0x16, 0x03, 0x07, 0x27, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x29, 0x1D, 0x2D, 0x1C, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x39, 0x20, 0x08, 0x16, 0x16,
-  0x0F, 0x05, 0x39, 0x37, 0x2E, 0x2F, 0x21, 0x05, 0x02, 0x16, 0x10, 0x0E, 0x39, 0x2F, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x1D, 0x2C, 0x19, 0x17, 0x0C, 0x14, 0x37, 0x39, 0x39, 0x1A, 0x0E, 0x09,
-  0x09, 0x0E, 0x19, 0x39, 0x39, 0x39, 0x39, 0x2E, 0x0A, 0x11, 0x16, 0x01, 0x0E, 0x21, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x37,
-  0x3A, 0x3A, 0x3A, 0x3A, 0x3A, 0x37, 0x37, 0x37, 0x39, 0x24, 0x2C, 0x1A, 0x17, 0x0C, 0x23, 0x39, 0x39, 0x39, 0x23, 0x08,
-  0x34, 0x34, 0x04, 0x21, 0x39, 0x39, 0x39, 0x39, 0x39, 0x2D, 0x0E, 0x16, 0x16, 0x0E, 0x24, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x1F, 0x0E, 0x04, 0x04, 0x0E, 0x13, 0x3A, 0x39, 0x39, 0x3A, 0x23, 0x23, 0x1B, 0x17, 0x13, 0x17, 0x39, 0x39, 0x39, 0x2B,
-  0x1F, 0x1F, 0x1F, 0x1F, 0x2F, 0x37, 0x37, 0x37, 0x2E, 0x2E, 0x21, 0x0E, 0x01, 0x16, 0x11, 0x12, 0x37, 0x39, 0x39, 0x39,
-  0x39, 0x21, 0x08, 0x10, 0x10, 0x11, 0x23, 0x3A, 0x39, 0x39, 0x3A, 0x17, 0x2C, 0x1B, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E,
-  0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x26, 0x04, 0x10, 0x16, 0x0F, 0x06, 0x20, 0x2E, 0x37,
-  0x39, 0x3A, 0x1C, 0x0E, 0x16, 0x3B, 0x0E, 0x1B, 0x39, 0x39, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x17, 0x1D, 0x35, 0x2F, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x29, 0x39, 0x07, 0x0F, 0x16, 0x16, 0x08, 0x0C, 0x20,
-  0x27, 0x2E, 0x20, 0x08, 0x02, 0x16, 0x01, 0x34, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x35, 0x18, 0x2D, 0x13, 0x14, 0x1D, 0x2A,
-  0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x29, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x14, 0x08, 0x16, 0x16, 0x0D, 0x08,
-  0x12, 0x1A, 0x1A, 0x05, 0x0E, 0x01, 0x16, 0x03, 0x15, 0x29, 0x39, 0x39, 0x39, 0x2B, 0x14, 0x32, 0x0B, 0x06, 0x1C, 0x13,
-  0x1F, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x29, 0x2F, 0x2F, 0x2F, 0x20, 0x31, 0x05, 0x03, 0x16, 0x16,
-  0x02, 0x0E, 0x34, 0x08, 0x0F, 0x01, 0x16, 0x01, 0x04, 0x2D, 0x39, 0x37, 0x39, 0x39, 0x1B, 0x17, 0x30, 0x0E, 0x03, 0x17,
-  0x1D, 0x19, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x2F, 0x27, 0x1B, 0x38, 0x23, 0x08, 0x0D,
-  0x16, 0x16, 0x3B, 0x16, 0x3B, 0x16, 0x16, 0x01, 0x04, 0x12, 0x39, 0x2E, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0x10,
-  0x1C, 0x14, 0x13, 0x2E, 0x2F, 0x29, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x29, 0x1E, 0x19, 0x1E, 0x2B, 0x2C,
-  0x08, 0x11, 0x01, 0x3B, 0x16, 0x16, 0x3B, 0x0D, 0x04, 0x15, 0x1F, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09,
-  0x00, 0x0C, 0x17, 0x13, 0x1B, 0x2F, 0x29, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x26, 0x1B, 0x1B, 0x20, 0x2B,
-  0x2B, 0x19, 0x07, 0x34, 0x11, 0x03, 0x11, 0x08, 0x05, 0x0A, 0x33, 0x21, 0x1F, 0x2B, 0x29, 0x2E, 0x1A, 0x23, 0x33, 0x03,
-  0x00, 0x00, 0x01, 0x18, 0x14, 0x14, 0x27, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x30, 0x19, 0x33, 0x1F,
-  0x2B, 0x26, 0x2A, 0x27, 0x1E, 0x23, 0x1D, 0x1D, 0x1D, 0x1D, 0x1C, 0x1A, 0x1B, 0x22, 0x20, 0x2B, 0x21, 0x14, 0x19, 0x19,
-  0x01, 0x00, 0x00, 0x09, 0x12, 0x23, 0x1D, 0x36, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2E, 0x2F, 0x29, 0x1F, 0x1B, 0x19, 0x30,
-  0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x39, 0x39, 0x27, 0x38, 0x2C, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x17, 0x23, 0x30,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x1C, 0x1D, 0x1E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x27, 0x22, 0x19, 0x1B,
-  0x21, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2E, 0x2E, 0x29, 0x1F, 0x36, 0x17, 0x14, 0x1C, 0x2D, 0x32, 0x2D, 0x1C, 0x1B,
-  0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x2D, 0x1C, 0x14, 0x2B, 0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x20, 0x36, 0x1A,
-  0x33, 0x1F, 0x2B, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x2E, 0x2E, 0x27, 0x21, 0x19, 0x1C, 0x1C, 0x23, 0x23, 0x14, 0x2D,
-  0x36, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x06, 0x2D, 0x24, 0x1C, 0x2B, 0x37, 0x2E, 0x29, 0x26, 0x38, 0x19,
-  0x1B, 0x25, 0x26, 0x2B, 0x2B, 0x2B, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x37, 0x29, 0x26, 0x30, 0x19, 0x23, 0x24, 0x14, 0x23,
-  0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x2D, 0x1C, 0x24, 0x1F, 0x2E, 0x27, 0x21, 0x1B,
-  0x18, 0x32, 0x1E, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2A, 0x1F, 0x38, 0x17, 0x35, 0x17,
-  0x36, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x18, 0x1C, 0x14, 0x1B, 0x26, 0x30,
-  0x1A, 0x1B, 0x38, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2F, 0x1F, 0x17, 0x1D, 0x17,
-  0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x31, 0x23, 0x14, 0x14,
-  0x19, 0x1A, 0x36, 0x25, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x27, 0x36, 0x13, 0x35, 0x2C,
-  0x32, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2C, 0x19,
-  0x17, 0x14, 0x14, 0x17, 0x33, 0x26, 0x27, 0x27, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x28, 0x25, 0x23, 0x35, 0x13, 0x24, 0x1B,
-  0x17, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x0B, 0x2D, 0x31, 0x23, 0x24, 0x1D, 0x14, 0x23, 0x31, 0x1A, 0x1B, 0x19, 0x31, 0x17, 0x13, 0x0C, 0x1D, 0x24, 0x31, 0x19,
-  0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x06, 0x23, 0x1A, 0x18, 0x23, 0x24, 0x35, 0x1D, 0x1D, 0x1D, 0x1D, 0x35, 0x1C, 0x2D, 0x1B, 0x23, 0x04,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x03, 0x0A, 0x14, 0x2D, 0x18, 0x19, 0x18, 0x19, 0x19, 0x2D, 0x1C, 0x0A, 0x0D, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18, 0x1A, 0x19, 0x19, 0x31, 0x2C, 0x1C, 0x1D, 0x12,
-  0x05, 0x11, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x19, 0x1B, 0x36, 0x36, 0x32, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B,
-  0x1A, 0x2C, 0x1D, 0x12, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x33, 0x33, 0x1B, 0x1A, 0x1B, 0x1B, 0x1B, 0x18, 0x2D, 0x2D, 0x31, 0x18, 0x19,
-  0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 0x35, 0x1D, 0x24, 0x24,
-  0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35,
-  0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C, 0x19, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07,
-  0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x17, 0x13, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05,
-  0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 0x1B, 0x18, 0x23, 0x13, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C,
-  0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x19,
-  0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x17, 0x1A, 0x1A,
-  0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18,
-  0x23, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x18,
-  0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18,
-  0x2D, 0x2D, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x2B, 0x21, 0x33, 0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x0D, 0x11, 0x05,
-  0x0B, 0x1C, 0x2D, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36,
-  0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 0x19, 0x23, 0x0C, 0x05, 0x06, 0x08, 0x34, 0x08,
-  0x0E, 0x0E, 0x08, 0x05, 0x0A, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33,
-  0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x00, 0x10, 0x30, 0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x0B, 0x08, 0x04, 0x02,
-  0x16, 0x16, 0x16, 0x16, 0x0D, 0x04, 0x05, 0x13, 0x1D, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18,
-  0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x1C, 0x09, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x14, 0x05, 0x03, 0x16,
-  0x16, 0x16, 0x3B, 0x16, 0x16, 0x16, 0x01, 0x0E, 0x05, 0x0C, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C,
-  0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x05, 0x11, 0x09,
-  0x16, 0x01, 0x03, 0x04, 0x0E, 0x0F, 0x16, 0x16, 0x16, 0x08, 0x05, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D,
-  0x2D, 0x19, 0x36, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 0x1E, 0x13, 0x04, 0x01,
-  0x16, 0x01, 0x08, 0x06, 0x1D, 0x12, 0x08, 0x0E, 0x16, 0x16, 0x10, 0x08, 0x13, 0x19, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31,
-  0x19, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x25, 0x07, 0x11,
-  0x16, 0x16, 0x04, 0x15, 0x36, 0x32, 0x1A, 0x1C, 0x05, 0x03, 0x16, 0x16, 0x04, 0x12, 0x31, 0x2C, 0x2D, 0x31, 0x19, 0x19,
-  0x1A, 0x1A, 0x1A, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0x1A, 0x20, 0x36, 0x1F, 0x1F, 0x20, 0x33, 0x06,
-  0x02, 0x16, 0x10, 0x04, 0x1B, 0x1E, 0x30, 0x22, 0x38, 0x1D, 0x04, 0x01, 0x16, 0x03, 0x06, 0x2C, 0x18, 0x19, 0x1A, 0x1B,
-  0x1B, 0x1B, 0x1B, 0x32, 0x32, 0x38, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x32,
-  0x05, 0x02, 0x10, 0x0F, 0x06, 0x1E, 0x30, 0x25, 0x25, 0x25, 0x32, 0x04, 0x10, 0x16, 0x0F, 0x06, 0x32, 0x38, 0x22, 0x22,
-  0x22, 0x22, 0x1A, 0x19, 0x19, 0x19, 0x1A, 0x1E, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21,
-  0x1A, 0x04, 0x08, 0x08, 0x04, 0x15, 0x33, 0x1B, 0x32, 0x1B, 0x1A, 0x19, 0x08, 0x10, 0x16, 0x0D, 0x05, 0x1A, 0x22, 0x22,
-  0x30, 0x30, 0x30, 0x15, 0x08, 0x34, 0x34, 0x04, 0x31, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x17, 0x1A, 0x20, 0x1B, 0x1E, 0x30,
-  0x1E, 0x38, 0x33, 0x36, 0x36, 0x36, 0x32, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x18, 0x06, 0x0D, 0x16, 0x01, 0x05, 0x13, 0x31,
-  0x1B, 0x33, 0x38, 0x33, 0x07, 0x03, 0x09, 0x01, 0x04, 0x1B, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x1C, 0x1C, 0x20, 0x1B, 0x30,
-  0x30, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x1A, 0x0A, 0x03, 0x16, 0x3B, 0x04, 0x04,
-  0x07, 0x24, 0x31, 0x1A, 0x2D, 0x05, 0x10, 0x16, 0x10, 0x04, 0x20, 0x27, 0x20, 0x36, 0x35, 0x2C, 0x1D, 0x07, 0x1F, 0x1B,
-  0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x2D, 0x2D, 0x2D, 0x18, 0x19, 0x18, 0x07, 0x08, 0x16, 0x16, 0x02,
-  0x34, 0x11, 0x05, 0x0C, 0x1C, 0x06, 0x0E, 0x3B, 0x16, 0x03, 0x07, 0x2B, 0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x11, 0x1F,
-  0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x31, 0x18, 0x19, 0x19, 0x13, 0x08, 0x34, 0x03, 0x16,
-  0x16, 0x03, 0x05, 0x08, 0x34, 0x05, 0x04, 0x01, 0x16, 0x01, 0x08, 0x2D, 0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 0x0D,
-  0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0x15, 0x08,
-  0x10, 0x16, 0x16, 0x10, 0x11, 0x0E, 0x0F, 0x16, 0x16, 0x16, 0x0E, 0x07, 0x22, 0x1F, 0x30, 0x2D, 0x35, 0x24, 0x2C, 0x09,
-  0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D,
-  0x07, 0x08, 0x10, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x11, 0x08, 0x2C, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A,
-  0x09, 0x00, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x14, 0x05, 0x34, 0x0B,
-  0x35, 0x1D, 0x07, 0x34, 0x03, 0x10, 0x01, 0x01, 0x01, 0x0D, 0x08, 0x34, 0x0C, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C,
-  0x0F, 0x00, 0x00, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A, 0x08, 0x06,
-  0x0C, 0x1D, 0x1D, 0x14, 0x35, 0x06, 0x08, 0x04, 0x04, 0x08, 0x34, 0x11, 0x34, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x1D,
-  0x35, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08,
-  0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x1A, 0x2C, 0x1C, 0x0C, 0x07, 0x04, 0x11, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13,
-  0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x33, 0x2D, 0x2D, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08,
-  0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x16, 0x05, 0x0B,
-  0x1D, 0x0A, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x21, 0x1B, 0x23, 0x19, 0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A,
-  0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12,
-  0x0C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 0x23,
-  0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 0x0A,
-  0x0B, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18,
-  0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 0x01, 0x11, 0x0A,
-  0x12, 0x13, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 0x13,
-  0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 0x15,
-  0x12, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x19, 0x2C, 0x1C,
-  0x1D, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A,
-  0x0B, 0x13, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x23,
-  0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A,
-  0x0C, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x0A, 0x0A, 0x0B,
-  0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B,
-  0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35, 0x1D, 0x13, 0x13, 0x13, 0x13, 0x12, 0x05, 0x0F,
-  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x82, 0x43, 0x6C, 0x46,
-  0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x47, 0x4B,
-  0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52,
-  0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCC, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x8A, 0xC6, 0x59, 0x5A, 0x5B, 0x5A, 0x5A,
-  0x59, 0x8A, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x45, 0x49, 0x50, 0x51, 0x52, 0xE2, 0x61, 0x63, 0x63, 0x63, 0x1F, 0x20, 0x20, 0x20,
-  0x20, 0x21, 0x64, 0x65, 0x2C, 0xAB, 0x5D, 0x68, 0x7E, 0x6A, 0x6B, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x45, 0x49, 0x50, 0x51, 0xE2, 0x6D, 0x63, 0x73, 0x2A, 0x29, 0x2A, 0x27, 0x2B, 0x26,
-  0x2B, 0x26, 0x26, 0x21, 0x32, 0x2D, 0x6E, 0x5B, 0x6F, 0x45, 0x4C, 0x6A, 0x84, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x4B, 0x49, 0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26,
-  0x26, 0x2B, 0x2B, 0x26, 0x21, 0x32, 0x19, 0x1A, 0x22, 0x73, 0xA5, 0x94, 0x53, 0x6A, 0x7D, 0x76, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x70, 0x49, 0x50, 0x57, 0xA3, 0x6E, 0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E,
-  0x22, 0x30, 0x1E, 0x1E, 0x1E, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x77, 0x78, 0xC0, 0x7E, 0x5F, 0x8F, 0x81, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4D, 0x47, 0x52, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B,
-  0x27, 0x26, 0x26, 0x26, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x28, 0x71, 0x7E, 0x8D, 0xCA, 0x40,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4E, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E,
-  0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x2F, 0x2F, 0x2F, 0x29, 0x77, 0x27, 0x8D, 0x54, 0x85,
-  0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x46, 0x4C, 0x47, 0x52, 0x58, 0x6E, 0x18, 0x1C, 0x14, 0x14, 0x14, 0x1E, 0x77, 0x2E,
-  0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0xA7, 0x6A,
-  0x5F, 0xA1, 0x7B, 0x00, 0x00, 0x00, 0x3F, 0x4E, 0x4B, 0x4A, 0x60, 0xD1, 0x30, 0x32, 0x31, 0x14, 0x0B, 0x17, 0x32, 0xE4,
-  0x74, 0x78, 0x8B, 0x29, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x8B,
-  0xCD, 0x5E, 0x85, 0x8A, 0x3F, 0x00, 0x3F, 0x81, 0x5E, 0x68, 0x8E, 0xC7, 0x1F, 0x1F, 0x21, 0x36, 0x24, 0xD9, 0xDF, 0xB1,
-  0xE6, 0xE6, 0xE6, 0xB7, 0x9C, 0x2B, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29,
-  0x28, 0x8B, 0x6A, 0x5F, 0x8F, 0x7B, 0x00, 0x3F, 0x55, 0x53, 0x49, 0x8A, 0x73, 0x28, 0x27, 0x2B, 0x22, 0xB7, 0x97, 0xE5,
-  0x6A, 0x54, 0x54, 0x54, 0xE7, 0x97, 0xB7, 0x74, 0x2B, 0x21, 0x19, 0x25, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x29, 0x28, 0x92, 0xA2, 0x54, 0x7D, 0xE3, 0x3F, 0x40, 0x94, 0x4C, 0x49, 0x74, 0x77, 0x2F, 0x2F, 0x27, 0xB9, 0xE6, 0xBA,
-  0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0x5E, 0xE5, 0x97, 0x74, 0x22, 0x1B, 0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0xCD, 0x87, 0x56, 0x6A, 0x68, 0x67, 0x9B, 0x2E, 0x2E, 0x8B, 0x95, 0x97, 0x5F,
-  0x7E, 0x7E, 0x54, 0xE7, 0xE7, 0xBA, 0x53, 0x7E, 0x7E, 0xE5, 0xDD, 0x65, 0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29,
-  0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x8B, 0x71, 0x7F, 0xA1, 0x7B, 0x6C, 0x54, 0x68, 0xC4, 0x8B, 0x39, 0x37, 0x2E, 0x97, 0xE7,
-  0x53, 0x53, 0xBA, 0x97, 0x97, 0x97, 0x97, 0xE9, 0x7E, 0x7E, 0x54, 0xE6, 0xDB, 0x77, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29,
-  0x29, 0x29, 0x2E, 0x2F, 0x2F, 0x2F, 0x8B, 0xD5, 0x54, 0x7A, 0xA3, 0xA4, 0x5E, 0x68, 0xA5, 0x2E, 0x39, 0x39, 0x9C, 0xE6,
-  0x5E, 0x7E, 0xBA, 0x97, 0x9C, 0x27, 0x74, 0x5B, 0x98, 0xE5, 0x53, 0x7E, 0xE9, 0xDD, 0x28, 0x2F, 0x2F, 0x29, 0x29, 0x2F,
-  0x29, 0x2F, 0x2F, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0xA6, 0xBF, 0x7D, 0x5C, 0x55, 0x5E, 0x70, 0xA7, 0x2E, 0x39, 0x39, 0xDD,
-  0xE5, 0x7E, 0x7E, 0xE8, 0xB9, 0x37, 0x2E, 0x2F, 0x90, 0xAC, 0xE6, 0x54, 0x7E, 0xBA, 0x97, 0x78, 0x29, 0x29, 0x29, 0x2F,
-  0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37, 0x2E, 0xA8, 0x54, 0x71, 0xA9, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x37,
-  0xDD, 0xE7, 0x53, 0x5E, 0xE6, 0xAA, 0xA8, 0x39, 0x39, 0x37, 0x8B, 0x97, 0xBA, 0x7E, 0x7E, 0x97, 0x74, 0x2F, 0x2F, 0x2E,
-  0x2E, 0x2E, 0x39, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x37, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0x9A, 0x5E, 0x94, 0xA6, 0x39, 0x39,
-  0x92, 0x97, 0x97, 0x97, 0x97, 0xE6, 0xA6, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xB9, 0xE9, 0x53, 0x53, 0x97, 0xAA, 0xA8, 0x39,
-  0x39, 0x39, 0x39, 0x9C, 0xE6, 0xB1, 0xB1, 0xE6, 0xDD, 0x39, 0x39, 0xA8, 0x71, 0x71, 0xCD, 0x9A, 0x54, 0x4D, 0x78, 0x37,
-  0x39, 0x37, 0x78, 0x78, 0xAA, 0xAA, 0xAA, 0x37, 0x37, 0x37, 0x2E, 0x2E, 0x8B, 0xB2, 0xE9, 0x53, 0x53, 0xE8, 0x9C, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0xB2, 0xE8, 0x6A, 0x6A, 0xE8, 0xB9, 0x39, 0x39, 0xA8, 0x85, 0x71, 0xA9, 0xAB, 0x54, 0xBF, 0xA7,
-  0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x29, 0x95, 0xE6, 0x53, 0x7E, 0xE7, 0xDD,
-  0x8B, 0x37, 0x39, 0x39, 0x39, 0xDD, 0xE5, 0x7E, 0x7E, 0xE5, 0xB2, 0x39, 0xA8, 0xA8, 0x5F, 0x7D, 0xA9, 0xAE, 0x6A, 0x69,
-  0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2F, 0x74, 0x97, 0x54, 0x7E, 0x54,
-  0x98, 0xDB, 0x90, 0x2F, 0x8B, 0x74, 0x97, 0x6A, 0x7E, 0x54, 0xE6, 0xAA, 0xA8, 0x39, 0x39, 0x54, 0x7A, 0x5C, 0x72, 0xBA,
-  0x7E, 0x93, 0x8B, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2A, 0x29, 0x2F, 0x2F, 0x25, 0xB7, 0xE9, 0x7E,
-  0x7E, 0xE7, 0x98, 0xB9, 0xE4, 0xB2, 0xB1, 0xE7, 0x53, 0x7E, 0xE7, 0x97, 0xA8, 0x39, 0x39, 0xA7, 0x6A, 0xA1, 0x83, 0x76,
-  0x8D, 0x7E, 0xC9, 0x8B, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x26, 0x1B, 0xAC, 0xE6,
-  0x6A, 0x7E, 0x7E, 0xBA, 0xE8, 0x97, 0xE8, 0xBA, 0x7E, 0x7E, 0x6A, 0x98, 0x95, 0xA8, 0x39, 0xA8, 0xC1, 0x8D, 0x8C, 0x0E,
-  0x81, 0x6B, 0x6A, 0xBF, 0x8B, 0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x2F, 0x28, 0x33, 0x32, 0x2B,
-  0xB9, 0xE6, 0x54, 0x7E, 0x7E, 0x53, 0x53, 0x53, 0x7E, 0x53, 0x54, 0xE6, 0xDD, 0x28, 0x2E, 0x39, 0x2E, 0x71, 0x7D, 0xD2,
-  0x87, 0x3F, 0x66, 0x8D, 0x53, 0xB4, 0x77, 0x2F, 0x28, 0x28, 0x2F, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x1F, 0x1A, 0x30,
-  0x26, 0x74, 0xB9, 0xE6, 0xE7, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xE7, 0xE6, 0xB9, 0x27, 0x29, 0x2F, 0x2E, 0xA7, 0x8D, 0x89,
-  0x58, 0x87, 0x3F, 0x72, 0x7D, 0x54, 0x8D, 0x28, 0x29, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x27, 0x33, 0x1A,
-  0x21, 0x2B, 0x2B, 0x2A, 0xB2, 0x97, 0x97, 0xE5, 0xE7, 0xE9, 0x98, 0x97, 0xB7, 0x21, 0x1F, 0x2B, 0x28, 0x8B, 0xC9, 0x85,
-  0xBE, 0x76, 0x00, 0x00, 0x87, 0xC2, 0x8D, 0xBF, 0x93, 0x77, 0x29, 0x29, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19,
-  0x36, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x78, 0xAA, 0xB2, 0xB9, 0xB7, 0xB8, 0xD9, 0x19, 0x1B, 0x22, 0x20, 0x73, 0x93, 0x5F,
-  0x8F, 0xA9, 0x01, 0x00, 0x00, 0x3F, 0x6C, 0x71, 0x6A, 0x84, 0x92, 0x8B, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x26, 0x36,
-  0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x37, 0x90, 0x22, 0x2D, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x7D,
-  0x71, 0xBE, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x85, 0x54, 0x89, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x1E,
-  0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x33, 0x23, 0x14, 0x24, 0x2D, 0x65, 0x6F,
-  0x8D, 0xA1, 0x58, 0x87, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x7D, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F,
-  0x33, 0x1A, 0x36, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x20, 0x1A, 0x17, 0x1C, 0x17, 0x5C,
-  0x5F, 0x7A, 0x99, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x7A, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x29, 0x2B,
-  0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x6E, 0x88,
-  0x7F, 0x71, 0xD2, 0xE3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA4, 0x7A, 0x8D, 0x6A, 0xBC, 0x2F, 0x2A,
-  0x1F, 0x36, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x28, 0x73, 0x22, 0x6F,
-  0x6A, 0x84, 0xBE, 0xE3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA4, 0x8F, 0x85, 0x6A, 0x8F,
-  0xC7, 0x64, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x8B, 0x74, 0x8F,
-  0x7F, 0x6B, 0x8C, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA4, 0xC0, 0x7D,
-  0x8D, 0x54, 0x6F, 0x5B, 0x65, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2E, 0x8B, 0x78, 0xBC, 0x7F,
-  0xC5, 0x8F, 0xBE, 0xE0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F,
-  0xC2, 0x89, 0x71, 0x7F, 0x7F, 0x6B, 0xB3, 0x1F, 0x90, 0x90, 0x90, 0x90, 0x73, 0x90, 0x77, 0x77, 0xA2, 0x8F, 0x7F, 0x94,
-  0x84, 0xC9, 0x6F, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x87, 0xA4, 0xCA, 0x7A, 0x71, 0x8D, 0x54, 0x54, 0xC0, 0x79, 0xCD, 0xA9, 0xCD, 0x79, 0x8F, 0x94, 0x4D, 0x75, 0x6B,
-  0x79, 0xCD, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0x81, 0x72, 0xC2, 0x89, 0x89, 0x7D, 0x84, 0xC5, 0xC5, 0x75, 0x75, 0x75, 0xC5, 0x6B, 0xCA, 0xC1,
-  0x6F, 0xC8, 0x81, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x41, 0xAE, 0xC2, 0xCA, 0x79, 0x79, 0x79, 0xC9, 0xC9, 0x79, 0xC3, 0xBD,
-  0x4F, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x4E, 0x82, 0x44, 0xCC, 0xCB, 0x42,
-  0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x55, 0x9A, 0xC0, 0x8F, 0x79, 0xC9, 0xC9, 0xC9, 0x79, 0xCA, 0xC0,
-  0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0x99, 0xC1, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD,
-  0xC1, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAE, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xB3, 0xD3, 0x5B, 0xCF, 0x2C, 0x2C, 0x31,
-  0xCF, 0xCF, 0xC6, 0x6F, 0xA1, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC3, 0x8C, 0x8C, 0xBE, 0xCD, 0xD3, 0xD1, 0x65, 0x19, 0x2D, 0x1C, 0x35, 0x1D,
-  0x24, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x5C, 0x79, 0xC9, 0x79, 0x9A, 0x82, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13,
-  0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x0A, 0x35, 0xC6, 0x89, 0x79, 0x80, 0x75, 0x6C, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xD2, 0xD2, 0x8C, 0xCD, 0x1C, 0x17, 0x2C, 0x19, 0x31, 0x23, 0x24, 0x13, 0x0A,
-  0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xA9, 0xD2, 0x8C, 0x5C, 0x0B, 0x0A, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15,
-  0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x6D, 0x99, 0x89, 0xCA, 0x9A, 0x81, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x0A, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 0x0C, 0x14,
-  0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x6D, 0xC9, 0x8F, 0x8F, 0x9A,
-  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58, 0xD5, 0xD2, 0xCD, 0x35, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A,
-  0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x6D, 0x89, 0x89,
-  0x80, 0xA4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0C, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x17,
-  0x1A, 0x1A, 0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x5B,
-  0x7A, 0x89, 0xC0, 0x56, 0x3F, 0x00, 0x00, 0x87, 0x58, 0xD5, 0x8C, 0xD3, 0x17, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08,
-  0x0C, 0x6E, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22,
-  0x91, 0xCD, 0x7D, 0x8F, 0xBD, 0x3F, 0x00, 0x00, 0x81, 0xB4, 0xD4, 0x99, 0x6D, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x7B,
-  0xDE, 0xEA, 0xB8, 0xDB, 0x5B, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36,
-  0x22, 0x36, 0x1B, 0x7D, 0x8F, 0x80, 0x56, 0x00, 0x09, 0x88, 0xB4, 0x8C, 0xA2, 0xD1, 0x19, 0x23, 0x0C, 0x05, 0x07, 0xEA,
-  0x97, 0x97, 0xE5, 0xE5, 0xE8, 0x97, 0xB7, 0xD9, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D,
-  0x1A, 0x33, 0x22, 0x91, 0xB3, 0x7D, 0x89, 0x72, 0x00, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x33, 0x1B, 0x18, 0x35, 0x35, 0x98,
-  0xE6, 0xE7, 0x53, 0x53, 0x7E, 0x53, 0x6A, 0xE5, 0xB1, 0xB8, 0x7C, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C,
-  0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x84, 0x89, 0xC3, 0x87, 0x7B, 0xB4, 0xD2, 0xBC, 0x63, 0x30, 0x33, 0x18, 0x17, 0x98,
-  0xE8, 0xBF, 0x7E, 0x7E, 0x53, 0x53, 0x7E, 0x7E, 0x7E, 0xE7, 0x97, 0xD8, 0x08, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23,
-  0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x71, 0x7A, 0xA1, 0x56, 0x04, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0xB7,
-  0xE6, 0x7E, 0x7E, 0x7E, 0xBA, 0xE5, 0xE8, 0xE7, 0x54, 0x7E, 0x53, 0xE7, 0x97, 0x06, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23,
-  0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0xD1, 0x6F, 0x85, 0xA1, 0x72, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x21, 0x25, 0x5B,
-  0xB1, 0xBA, 0x7E, 0x53, 0xE5, 0xB1, 0xBB, 0xB8, 0xDF, 0xE6, 0x6A, 0x7E, 0x5E, 0xE6, 0xDF, 0x18, 0x31, 0x2C, 0x23, 0x2C,
-  0x2D, 0x31, 0x19, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0xD3, 0xBA, 0x89, 0xBD, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x21,
-  0xB7, 0xE8, 0x5E, 0x7E, 0xE7, 0x97, 0x6D, 0x65, 0x1A, 0x17, 0x98, 0xE8, 0x7E, 0x53, 0xE7, 0x97, 0x2C, 0x2C, 0x2D, 0x31,
-  0x19, 0x19, 0x1A, 0x1A, 0x1A, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x6D, 0x5F, 0x8F, 0xC3, 0xD3, 0xD5, 0xC1, 0x74, 0x1F, 0x20,
-  0x1E, 0xB7, 0xE9, 0x7E, 0x5E, 0xE8, 0xB7, 0x64, 0x30, 0x22, 0xD1, 0x5B, 0xE6, 0x6A, 0x7E, 0x6A, 0x97, 0xCF, 0x18, 0x19,
-  0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x32, 0x32, 0x38, 0x20, 0x1F, 0x1F, 0xD1, 0x5F, 0x7A, 0xCA, 0xD0, 0xD4, 0xC1, 0x74, 0x20,
-  0x20, 0x25, 0x97, 0xE7, 0x6A, 0xBA, 0xE6, 0x61, 0x30, 0x25, 0x25, 0x25, 0x64, 0xB7, 0xE7, 0x53, 0x53, 0x97, 0x5B, 0x38,
-  0x22, 0x22, 0x22, 0x22, 0x6D, 0x61, 0x61, 0x61, 0xAC, 0xE4, 0x26, 0x63, 0x64, 0x8D, 0x7D, 0xCA, 0xD3, 0xD4, 0xC9, 0x21,
-  0x1E, 0x21, 0x6D, 0x98, 0xE6, 0xB1, 0xB1, 0xE6, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x6E, 0xB7, 0xE9, 0x53, 0x53, 0x97, 0xDB,
-  0x22, 0x22, 0x30, 0x30, 0x64, 0xDB, 0xE6, 0x97, 0x97, 0x97, 0xDD, 0x2B, 0x26, 0x1E, 0x6A, 0x7D, 0x80, 0x5A, 0xD4, 0xA1,
-  0x25, 0x30, 0x1E, 0x38, 0x65, 0x65, 0x91, 0x91, 0x91, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x31, 0xBB, 0xE5, 0x53, 0x7E, 0xE9,
-  0xB8, 0x6E, 0x1B, 0x33, 0x38, 0x22, 0xB7, 0xE8, 0x53, 0x53, 0xE5, 0xB9, 0x2B, 0x26, 0x6D, 0x54, 0x71, 0xCA, 0xD9, 0xD5,
-  0xA1, 0x61, 0x30, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x1A, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x19, 0xAD, 0x98, 0x53, 0x7E,
-  0x8D, 0x98, 0x07, 0x24, 0x31, 0x1A, 0x32, 0xB7, 0xE9, 0x7E, 0x5E, 0xE8, 0xDB, 0x27, 0x20, 0xD3, 0x54, 0x85, 0x66, 0x06,
-  0xD5, 0xA1, 0xD0, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x2D, 0x2D, 0x2D, 0x18, 0x19, 0x18, 0xD6, 0x97, 0xBA,
-  0x7E, 0x5E, 0xE6, 0xDC, 0x05, 0x0C, 0x17, 0xBB, 0x98, 0xBF, 0x7E, 0x6A, 0xE6, 0xC7, 0x27, 0x64, 0x6F, 0x6A, 0x71, 0xC8,
-  0x11, 0xB4, 0xC1, 0xA9, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x31, 0x18, 0x19, 0x19, 0x13, 0x34, 0xDF,
-  0xE5, 0x7E, 0x7E, 0x6A, 0x98, 0xDF, 0xDF, 0x98, 0x98, 0xBA, 0x7E, 0x53, 0xE5, 0xB7, 0x73, 0x2B, 0x1B, 0xC5, 0x5F, 0x7D,
-  0x76, 0x0D, 0x93, 0xBE, 0x89, 0xD1, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06,
-  0xD8, 0x98, 0x85, 0x53, 0x7E, 0x7E, 0xE7, 0xE5, 0xE7, 0xBF, 0x7E, 0x7E, 0x85, 0x97, 0x61, 0x63, 0x30, 0xCF, 0x6A, 0x5F,
-  0x7D, 0x87, 0x3B, 0xD0, 0xD2, 0x7A, 0xD3, 0x32, 0x22, 0x33, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x18, 0x0B, 0x08,
-  0x0A, 0x1D, 0xB8, 0x98, 0xE7, 0x53, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x53, 0x8D, 0xE6, 0xBB, 0x1E, 0x1F, 0x2C, 0x88, 0x54,
-  0x5F, 0x55, 0x3F, 0x00, 0x05, 0xB4, 0xA1, 0x8F, 0x32, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x18, 0x14, 0x05,
-  0x34, 0x0B, 0x35, 0x1D, 0xB8, 0x97, 0xE5, 0x5F, 0x54, 0x5E, 0xBF, 0x6A, 0xE5, 0x97, 0xB8, 0x6E, 0x25, 0x33, 0x7C, 0x94,
-  0xBF, 0x8D, 0x4F, 0x00, 0x00, 0x87, 0xA2, 0xBE, 0x7A, 0xC4, 0x65, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A,
-  0x08, 0x06, 0x0C, 0x1D, 0x1D, 0x7C, 0xCF, 0xB7, 0xB1, 0xE6, 0xE6, 0xE6, 0xB1, 0xDC, 0xDE, 0x1D, 0x19, 0x30, 0x07, 0xE2,
-  0x53, 0x54, 0xC5, 0x40, 0x00, 0x00, 0x00, 0x0E, 0xD4, 0x89, 0x8F, 0x36, 0xD1, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D,
-  0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x6E, 0x19, 0xDB, 0xB8, 0xD8, 0x34, 0x11, 0x07, 0x24, 0x1A, 0x06, 0xE0,
-  0x70, 0x7E, 0x5F, 0x72, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xC6, 0xBE, 0x7D, 0x79, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17,
-  0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x6E, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3F,
-  0x67, 0x4C, 0x5E, 0x55, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD4, 0xA1, 0x71, 0xA9, 0x65, 0x30, 0x20, 0x1E, 0x36,
-  0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D,
-  0xEB, 0x68, 0x53, 0x7F, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x8C, 0x8F, 0x85, 0xA9, 0x91, 0x36, 0x21,
-  0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C,
-  0xEB, 0x68, 0x4C, 0x6A, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x86, 0xC1, 0x7D, 0x8D, 0x6F, 0x18,
-  0x6E, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 0x40,
-  0xEB, 0x47, 0x4B, 0x7E, 0xCB, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE3, 0xA1, 0x71, 0x8D,
-  0x84, 0x83, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x0A, 0xEC,
-  0x48, 0x47, 0x4B, 0x5E, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x86, 0x89,
-  0x85, 0x7F, 0x54, 0x55, 0xE0, 0x11, 0x05, 0x17, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x6E, 0x0A, 0x07, 0xA3, 0xE1,
-  0x49, 0x47, 0x4B, 0x69, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x76, 0x80, 0x85, 0x5F, 0x54, 0x69, 0x4D, 0x55, 0xDE, 0x0A, 0x0A, 0x0A, 0x05, 0x05, 0x05, 0x07, 0xA3, 0xE1, 0x8E, 0x48,
-  0x47, 0x68, 0x4C, 0x4D, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x87, 0xBD, 0x6B, 0x8D, 0x6A, 0xBF, 0x7E, 0x4B, 0x70, 0x67, 0x82, 0x67, 0xE1, 0x5D, 0x48, 0x49, 0x48, 0x47,
-  0x68, 0x4B, 0x4C, 0x4E, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xA4, 0x6B, 0xBA, 0x54, 0x7E, 0x53, 0x4B, 0x4B, 0x68, 0x68, 0x68, 0x68, 0x68, 0x4B,
-  0x53, 0x4D, 0xCB, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x6C, 0x55, 0xC5, 0x7F, 0x6A, 0x5E, 0x7E, 0x7E, 0x7E, 0xBF, 0x4D,
-  0x4E, 0x4F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x06, 0x15, 0x06, 0x05, 0x04,
-  0x0F, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x06, 0x07, 0x06, 0x05, 0x08, 0x08, 0x08, 0x08, 0x05, 0x07,
-  0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0D, 0x07, 0x07, 0x04, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x11, 0x11,
-  0x11, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x06, 0x07, 0x0E, 0x0D, 0x16, 0x16, 0x08, 0x24, 0x2D, 0x18, 0x1A, 0x1B,
-  0x1B, 0x1A, 0x18, 0x24, 0x07, 0x08, 0x07, 0x0B, 0x1D, 0x14, 0x07, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x08, 0x0F, 0x01, 0x0F, 0x1D, 0x30, 0x20, 0x1F, 0x1F, 0x1F, 0x20,
-  0x20, 0x20, 0x20, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x15, 0x0A, 0x13, 0x24, 0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x0A, 0x04, 0x02, 0x0D, 0x35, 0x30, 0x26, 0x27, 0x2A, 0x29, 0x2A, 0x27,
-  0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1A, 0x23, 0x12, 0x0C, 0x14, 0x17, 0x03, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x12, 0x04, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x28,
-  0x27, 0x26, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x32, 0x18, 0x18, 0x30, 0x27, 0x20, 0x1D, 0x0C, 0x14, 0x2C, 0x0F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x12, 0x08, 0x0D, 0x0E, 0x0C, 0x19, 0x1F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2B,
-  0x20, 0x25, 0x22, 0x30, 0x25, 0x1E, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x29, 0x27, 0x17, 0x13, 0x24, 0x23, 0x10,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x30, 0x2B, 0x28, 0x27, 0x20,
-  0x1F, 0x27, 0x27, 0x26, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x27, 0x29, 0x29, 0x17, 0x13, 0x1C,
-  0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0A, 0x15, 0x11, 0x34, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x22, 0x25, 0x27,
-  0x2F, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x22, 0x26, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2A, 0x14,
-  0x1D, 0x2C, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0C, 0x05, 0x34, 0x23, 0x2D, 0x2D, 0x1C, 0x14, 0x35, 0x17, 0x21,
-  0x1F, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x30, 0x1A, 0x32, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x2A, 0x2F,
-  0x2B, 0x1D, 0x24, 0x32, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x0A, 0x08, 0x31, 0x38, 0x22, 0x1A, 0x2D, 0x1D, 0x0C, 0x17,
-  0x15, 0x06, 0x2B, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x33, 0x19, 0x25, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2A, 0x2E, 0x1B, 0x1D, 0x23, 0x24, 0x00, 0x00, 0x00, 0x05, 0x13, 0x06, 0x12, 0x20, 0x26, 0x1F, 0x25, 0x1A, 0x24, 0x1C,
-  0x07, 0x04, 0x0E, 0x05, 0x2B, 0x2E, 0x29, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x32, 0x2B, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x29, 0x2E, 0x1D, 0x24, 0x31, 0x0F, 0x00, 0x01, 0x13, 0x12, 0x08, 0x1E, 0x27, 0x28, 0x27, 0x26, 0x36, 0x36,
-  0x07, 0x08, 0x01, 0x01, 0x0E, 0x07, 0x26, 0x2F, 0x27, 0x26, 0x26, 0x25, 0x19, 0x21, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x21, 0x35, 0x2D, 0x07, 0x3B, 0x0D, 0x1D, 0x0A, 0x13, 0x29, 0x2F, 0x2F, 0x2F, 0x2B, 0x1F,
-  0x0A, 0x04, 0x01, 0x16, 0x16, 0x16, 0x0E, 0x05, 0x26, 0x27, 0x26, 0x26, 0x33, 0x36, 0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x27, 0x24, 0x17, 0x2D, 0x09, 0x08, 0x1D, 0x15, 0x36, 0x2F, 0x2E, 0x2E, 0x2F, 0x26,
-  0x0A, 0x04, 0x01, 0x16, 0x16, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x1F, 0x26, 0x1F, 0x1B, 0x1F, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x23, 0x1C, 0x36, 0x03, 0x0A, 0x13, 0x0A, 0x1F, 0x2E, 0x39, 0x39, 0x2A,
-  0x12, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x06, 0x20, 0x1E, 0x36, 0x29, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x29, 0x29, 0x29, 0x2F, 0x2E, 0x2F, 0x2F, 0x2F, 0x37, 0x25, 0x14, 0x19, 0x15, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x2F,
-  0x0A, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x07, 0x0C, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x19, 0x2B, 0x2F, 0x2F, 0x2F, 0x29,
-  0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x29, 0x1D, 0x2D, 0x1C, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x2F,
-  0x0A, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x27, 0x29, 0x12, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x05, 0x2B, 0x2F, 0x29, 0x29,
-  0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2C, 0x2A, 0x37, 0x37, 0x37, 0x39, 0x1D, 0x2C, 0x19, 0x17, 0x0C, 0x14, 0x37, 0x39,
-  0x1D, 0x08, 0x10, 0x16, 0x16, 0x0E, 0x06, 0x27, 0x39, 0x39, 0x2F, 0x0B, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x15, 0x27, 0x2F,
-  0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x13, 0x08, 0x0A, 0x2F, 0x39, 0x37, 0x39, 0x24, 0x2C, 0x1A, 0x17, 0x0C, 0x23, 0x39,
-  0x39, 0x39, 0x12, 0x08, 0x01, 0x0E, 0x07, 0x2A, 0x39, 0x39, 0x39, 0x39, 0x2E, 0x12, 0x04, 0x01, 0x16, 0x16, 0x04, 0x12,
-  0x2F, 0x39, 0x39, 0x39, 0x39, 0x37, 0x14, 0x08, 0x0D, 0x04, 0x0A, 0x28, 0x39, 0x3A, 0x23, 0x23, 0x1B, 0x17, 0x13, 0x17,
-  0x39, 0x39, 0x39, 0x2F, 0x12, 0x08, 0x06, 0x27, 0x39, 0x37, 0x37, 0x37, 0x2E, 0x2E, 0x2A, 0x07, 0x04, 0x01, 0x16, 0x01,
-  0x04, 0x0A, 0x2F, 0x39, 0x39, 0x39, 0x13, 0x08, 0x10, 0x16, 0x01, 0x08, 0x0A, 0x3A, 0x3A, 0x17, 0x2C, 0x1B, 0x23, 0x13,
-  0x14, 0x2E, 0x37, 0x2E, 0x37, 0x37, 0x13, 0x27, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2B, 0x06, 0x04, 0x01,
-  0x16, 0x01, 0x04, 0x0A, 0x2F, 0x39, 0x14, 0x08, 0x02, 0x16, 0x16, 0x11, 0x05, 0x1F, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x17,
-  0x1D, 0x35, 0x2F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x29, 0x2F, 0x26, 0x33, 0x07,
-  0x04, 0x16, 0x16, 0x01, 0x04, 0x0A, 0x0B, 0x08, 0x10, 0x16, 0x3B, 0x11, 0x08, 0x1F, 0x39, 0x39, 0x39, 0x35, 0x18, 0x2D,
-  0x13, 0x14, 0x1D, 0x2A, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x29, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x29, 0x33, 0x20,
-  0x1F, 0x15, 0x04, 0x01, 0x16, 0x01, 0x04, 0x08, 0x02, 0x16, 0x16, 0x11, 0x05, 0x1F, 0x39, 0x39, 0x39, 0x2B, 0x14, 0x32,
-  0x0B, 0x06, 0x1C, 0x13, 0x1F, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x29, 0x2F, 0x2F, 0x2F, 0x20, 0x1B,
-  0x1F, 0x2B, 0x2B, 0x07, 0x04, 0x16, 0x16, 0x01, 0x01, 0x16, 0x09, 0x11, 0x08, 0x1F, 0x39, 0x37, 0x39, 0x39, 0x1B, 0x17,
-  0x30, 0x0E, 0x03, 0x17, 0x1D, 0x19, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x2F, 0x27, 0x1B,
-  0x33, 0x26, 0x2B, 0x29, 0x27, 0x15, 0x04, 0x01, 0x16, 0x16, 0x16, 0x11, 0x05, 0x20, 0x37, 0x2E, 0x2E, 0x39, 0x37, 0x23,
-  0x2D, 0x1E, 0x09, 0x10, 0x1C, 0x14, 0x13, 0x2E, 0x2F, 0x29, 0x2A, 0x29, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x29, 0x1E,
-  0x19, 0x1E, 0x2B, 0x26, 0x2A, 0x2E, 0x27, 0x07, 0x04, 0x16, 0x09, 0x11, 0x08, 0x1B, 0x27, 0x2A, 0x29, 0x2F, 0x2E, 0x27,
-  0x1C, 0x1A, 0x14, 0x09, 0x00, 0x0C, 0x17, 0x13, 0x1B, 0x2F, 0x29, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x26,
-  0x1B, 0x1B, 0x20, 0x2B, 0x26, 0x2A, 0x2F, 0x2E, 0x27, 0x07, 0x0E, 0x11, 0x05, 0x17, 0x38, 0x21, 0x1F, 0x2B, 0x29, 0x2E,
-  0x1A, 0x23, 0x33, 0x03, 0x00, 0x00, 0x01, 0x18, 0x14, 0x14, 0x27, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27,
-  0x30, 0x19, 0x33, 0x1F, 0x2B, 0x26, 0x27, 0x2F, 0x2E, 0x37, 0x26, 0x06, 0x08, 0x1D, 0x1C, 0x1A, 0x1B, 0x22, 0x20, 0x2B,
-  0x21, 0x14, 0x19, 0x19, 0x01, 0x00, 0x00, 0x09, 0x12, 0x23, 0x1D, 0x36, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2E, 0x2F, 0x29,
-  0x1F, 0x1B, 0x19, 0x30, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E, 0x1F, 0x19, 0x2C, 0x17, 0x24, 0x2C, 0x1A, 0x22,
-  0x21, 0x17, 0x23, 0x30, 0x04, 0x00, 0x00, 0x00, 0x00, 0x02, 0x17, 0x1C, 0x1D, 0x1E, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x27, 0x22, 0x19, 0x1B, 0x21, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x36, 0x17, 0x14, 0x1C, 0x2D,
-  0x32, 0x2D, 0x1C, 0x1B, 0x14, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x2D, 0x1C, 0x14, 0x2B, 0x39, 0x2E, 0x2F, 0x2F,
-  0x2A, 0x20, 0x36, 0x1A, 0x33, 0x1F, 0x2B, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x2E, 0x2E, 0x27, 0x21, 0x19, 0x1C, 0x1C,
-  0x23, 0x23, 0x14, 0x2D, 0x36, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x06, 0x2D, 0x24, 0x1C, 0x2B, 0x37, 0x2E,
-  0x29, 0x26, 0x38, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x2B, 0x2B, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x37, 0x29, 0x26, 0x30, 0x19,
-  0x23, 0x24, 0x14, 0x23, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x13, 0x2D, 0x1C, 0x24, 0x1F,
-  0x2E, 0x27, 0x21, 0x1B, 0x18, 0x32, 0x1E, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2A, 0x1F,
-  0x38, 0x17, 0x35, 0x17, 0x36, 0x05, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x18, 0x1C,
-  0x14, 0x1B, 0x26, 0x30, 0x1A, 0x1B, 0x38, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2F,
-  0x1F, 0x17, 0x1D, 0x17, 0x25, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
-  0x31, 0x23, 0x14, 0x14, 0x19, 0x1A, 0x36, 0x25, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x27,
-  0x36, 0x13, 0x35, 0x2C, 0x32, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x11, 0x2C, 0x19, 0x17, 0x14, 0x14, 0x17, 0x33, 0x26, 0x27, 0x27, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x28, 0x25, 0x23,
-  0x35, 0x13, 0x24, 0x1B, 0x17, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x0B, 0x2D, 0x31, 0x23, 0x24, 0x1D, 0x14, 0x23, 0x31, 0x1A, 0x1B, 0x19, 0x31, 0x17, 0x13, 0x0C,
-  0x1D, 0x24, 0x31, 0x19, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x06, 0x23, 0x1A, 0x18, 0x23, 0x24, 0x35, 0x1D, 0x1D, 0x1D, 0x1D, 0x35, 0x1C,
-  0x2D, 0x1B, 0x23, 0x04, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x03, 0x0A, 0x14, 0x2D, 0x18, 0x19, 0x18, 0x19, 0x19, 0x2D,
-  0x1C, 0x0A, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x05, 0x06, 0x34, 0x04,
-  0x11, 0x0D, 0x10, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18, 0x1A, 0x19, 0x19, 0x31,
-  0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x15, 0x19, 0x1B, 0x36, 0x36, 0x32, 0x1B, 0x1A, 0x1A, 0x1A,
-  0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x1D, 0x12, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x19, 0x33, 0x33, 0x1B, 0x1A, 0x1B, 0x1B, 0x1B, 0x18, 0x2D,
-  0x2D, 0x31, 0x18, 0x19, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C,
-  0x35, 0x1D, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x19, 0x31, 0x2D, 0x17,
-  0x14, 0x13, 0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C, 0x19, 0x31, 0x23, 0x24,
-  0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x17, 0x13, 0x0D, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B,
-  0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 0x1B, 0x18, 0x23, 0x13,
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12,
-  0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x22, 0x1A, 0x31,
-  0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08,
-  0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33,
-  0x18, 0x18, 0x17, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01,
-  0x15, 0x17, 0x1A, 0x1A, 0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22,
-  0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x00, 0x00, 0x00, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E,
-  0x02, 0x08, 0x0A, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36,
-  0x22, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x0B, 0x00, 0x00, 0x00, 0x0D, 0x2B, 0x21, 0x33, 0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D,
-  0x03, 0x0D, 0x08, 0x08, 0x0C, 0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18,
-  0x1A, 0x36, 0x22, 0x36, 0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 0x19, 0x23, 0x0C, 0x05,
-  0x07, 0x34, 0x08, 0x11, 0x0D, 0x08, 0x13, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31,
-  0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x00, 0x10, 0x30, 0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35,
-  0x24, 0x13, 0x05, 0x0E, 0x16, 0x16, 0x0F, 0x08, 0x14, 0x19, 0x23, 0x1D, 0x1D, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31,
-  0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x1C, 0x09, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18,
-  0x23, 0x1C, 0x05, 0x11, 0x16, 0x16, 0x16, 0x16, 0x0D, 0x34, 0x13, 0x2C, 0x1D, 0x13, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31,
-  0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30,
-  0x1A, 0x23, 0x05, 0x0E, 0x16, 0x16, 0x10, 0x0F, 0x16, 0x16, 0x03, 0x34, 0x1D, 0x35, 0x12, 0x05, 0x2C, 0x19, 0x18, 0x2D,
-  0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21,
-  0x1E, 0x2C, 0x05, 0x11, 0x16, 0x16, 0x01, 0x08, 0x08, 0x0D, 0x16, 0x16, 0x0F, 0x34, 0x0A, 0x06, 0x1D, 0x19, 0x31, 0x2C,
-  0x23, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x2C, 0x1F, 0x36, 0x1F, 0x20,
-  0x20, 0x1B, 0x05, 0x11, 0x16, 0x16, 0x10, 0x08, 0x0A, 0x14, 0x05, 0x0D, 0x16, 0x16, 0x03, 0x34, 0x06, 0x19, 0x31, 0x2C,
-  0x2D, 0x31, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1A, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0x1A, 0x20, 0x36, 0x1F,
-  0x1F, 0x1B, 0x05, 0x03, 0x16, 0x16, 0x10, 0x08, 0x0A, 0x30, 0x30, 0x1C, 0x04, 0x0D, 0x16, 0x16, 0x0F, 0x34, 0x0C, 0x2D,
-  0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x32, 0x1A, 0x06, 0x2D, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x33, 0x21, 0x32,
-  0x1F, 0x20, 0x14, 0x08, 0x0D, 0x16, 0x10, 0x08, 0x0A, 0x25, 0x30, 0x25, 0x21, 0x1C, 0x05, 0x0D, 0x16, 0x16, 0x03, 0x34,
-  0x2C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x30, 0x1B, 0x06, 0x08, 0x04, 0x1B, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21,
-  0x1B, 0x20, 0x1E, 0x20, 0x17, 0x08, 0x11, 0x04, 0x0A, 0x32, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x13, 0x08, 0x0D, 0x16, 0x16,
-  0x0F, 0x34, 0x23, 0x30, 0x30, 0x30, 0x30, 0x33, 0x06, 0x0E, 0x01, 0x03, 0x05, 0x36, 0x26, 0x1E, 0x14, 0x2C, 0x17, 0x1A,
-  0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x1D, 0x34, 0x0A, 0x32, 0x1B, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x18, 0x0B, 0x05, 0x0D,
-  0x16, 0x16, 0x11, 0x34, 0x23, 0x33, 0x38, 0x1B, 0x06, 0x04, 0x01, 0x16, 0x01, 0x08, 0x07, 0x2B, 0x22, 0x1D, 0x2C, 0x1C,
-  0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 0x1C, 0x19, 0x1A, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x19, 0x1C, 0x05,
-  0x08, 0x02, 0x16, 0x16, 0x03, 0x34, 0x14, 0x18, 0x06, 0x0E, 0x01, 0x16, 0x01, 0x04, 0x15, 0x1F, 0x20, 0x36, 0x35, 0x2C,
-  0x1D, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x2D, 0x2D, 0x2D, 0x18, 0x19, 0x18, 0x07,
-  0x0B, 0x15, 0x34, 0x02, 0x16, 0x16, 0x11, 0x34, 0x34, 0x04, 0x01, 0x16, 0x01, 0x08, 0x07, 0x1F, 0x27, 0x30, 0x18, 0x14,
-  0x2D, 0x06, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x31, 0x18, 0x19, 0x19, 0x13,
-  0x34, 0x13, 0x1D, 0x0A, 0x08, 0x02, 0x16, 0x16, 0x03, 0x0E, 0x01, 0x16, 0x01, 0x04, 0x07, 0x22, 0x26, 0x2B, 0x1B, 0x24,
-  0x24, 0x31, 0x03, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23,
-  0x05, 0x06, 0x1D, 0x1D, 0x2C, 0x0B, 0x34, 0x02, 0x16, 0x16, 0x16, 0x16, 0x01, 0x04, 0x06, 0x1A, 0x1E, 0x26, 0x30, 0x2D,
-  0x35, 0x24, 0x2C, 0x09, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x19, 0x19, 0x18,
-  0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x31, 0x0B, 0x08, 0x02, 0x16, 0x16, 0x01, 0x04, 0x05, 0x1D, 0x1A, 0x1E, 0x1F, 0x2C,
-  0x17, 0x1D, 0x1C, 0x0A, 0x09, 0x00, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x19, 0x18,
-  0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x1B, 0x0C, 0x34, 0x02, 0x01, 0x04, 0x08, 0x05, 0x13, 0x18, 0x25, 0x33,
-  0x14, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19,
-  0x23, 0x0A, 0x08, 0x06, 0x0C, 0x1D, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x0B, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x1D, 0x19, 0x30,
-  0x07, 0x12, 0x0C, 0x1D, 0x35, 0x01, 0x00, 0x00, 0x00, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A,
-  0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x12, 0x05, 0x08, 0x11, 0x07, 0x24, 0x1A,
-  0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1A, 0x33, 0x2D, 0x2D, 0x32, 0x22, 0x20, 0x1E, 0x38,
-  0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x31, 0x35, 0x0B, 0x0B, 0x1D, 0x2C,
-  0x0A, 0x16, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x21, 0x1B, 0x23, 0x19, 0x32, 0x30, 0x20,
-  0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31,
-  0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B,
-  0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22,
-  0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0C, 0x36, 0x2D, 0x1C,
-  0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33,
-  0x05, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x15, 0x1B,
-  0x2C, 0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D,
-  0x12, 0x05, 0x05, 0x15, 0x12, 0x1D, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0A, 0x19, 0x2C, 0x1C, 0x1D, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x2C, 0x12, 0x07,
-  0x0B, 0x15, 0x06, 0x0A, 0x0B, 0x13, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0x23, 0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 0x05, 0x05, 0x07, 0x15, 0x07,
-  0x06, 0x07, 0x15, 0x0A, 0x0C, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x07, 0x07, 0x06,
-  0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0A, 0x12,
-  0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35, 0x1D, 0x13, 0x13, 0x13,
-  0x13, 0x12, 0x05, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44,
-  0x82, 0x43, 0x6C, 0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x4A, 0x4A, 0x4A, 0x4A,
-  0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51,
-  0x52, 0x52, 0x52, 0x52, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xCC, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x8A, 0xC6, 0x59,
-  0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x8A, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x45, 0x49, 0x50, 0x51, 0x52, 0xE2, 0x61, 0x63, 0x63, 0x63,
-  0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x64, 0x65, 0x2C, 0xAB, 0x5D, 0x68, 0x7E, 0x6A, 0x6B, 0x56, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x45, 0x49, 0x50, 0x51, 0xE2, 0x6D, 0x63, 0x73, 0x2A, 0x29,
-  0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 0x2D, 0x6E, 0x5B, 0x6F, 0x45, 0x4C, 0x6A, 0x84, 0xE0, 0x3F, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x4B, 0x49, 0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F,
-  0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x21, 0x32, 0x19, 0x1A, 0x22, 0x73, 0xA5, 0x94, 0x53, 0x6A, 0x7D, 0x76,
-  0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x70, 0x49, 0x50, 0x57, 0xA3, 0x6E, 0x21, 0x27, 0x2E, 0x2E,
-  0x2E, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x1E, 0x1E, 0x1E, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x77, 0x78, 0xC0, 0x7E, 0x5F,
-  0x8F, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4D, 0x47, 0x52, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A,
-  0x2A, 0x20, 0x1F, 0x2B, 0x27, 0x26, 0x26, 0x26, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x28, 0x71,
-  0x7E, 0x8D, 0xCA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4E, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x18, 0x38,
-  0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x2F, 0x2F, 0x2F, 0x29, 0x77,
-  0x27, 0x8D, 0x54, 0x85, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x46, 0x4C, 0x47, 0x52, 0x58, 0x6E, 0x18, 0x1C, 0x14, 0x14,
-  0x7C, 0x61, 0x90, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E,
-  0x28, 0x2F, 0xA7, 0x6A, 0x5F, 0xA1, 0x7B, 0x00, 0x00, 0x00, 0x3F, 0x4E, 0x4B, 0x4A, 0x60, 0xD1, 0x30, 0x32, 0x31, 0x14,
-  0x0B, 0xD9, 0x98, 0xB9, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2A, 0x8B, 0xCD, 0x5E, 0x85, 0x8A, 0x3F, 0x00, 0x3F, 0x81, 0x5E, 0x68, 0x8E, 0xC7, 0x1F, 0x1F, 0x21, 0x36,
-  0x24, 0xD9, 0xB1, 0xE5, 0xE6, 0xB9, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x8B, 0x6A, 0x5F, 0x8F, 0x7B, 0x00, 0x3F, 0x55, 0x53, 0x49, 0x8A, 0x73, 0x28, 0x27, 0x2B,
-  0x22, 0xDB, 0x97, 0xE9, 0x7E, 0x6A, 0x98, 0xB9, 0x2F, 0x2F, 0x27, 0x26, 0x26, 0x21, 0x19, 0x25, 0x29, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x92, 0xA2, 0x54, 0x7D, 0xE3, 0x3F, 0x40, 0x94, 0x4C, 0x49, 0x74, 0x77, 0x2F, 0x2F,
-  0x90, 0xE4, 0xE6, 0xE7, 0x53, 0x7E, 0x53, 0xBA, 0x98, 0xB2, 0x2F, 0x27, 0x26, 0x26, 0x22, 0x1B, 0x27, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0xCD, 0x87, 0x56, 0x6A, 0x68, 0x67, 0x9B, 0x2E, 0x2E,
-  0x37, 0xE4, 0x97, 0xE7, 0x7E, 0x7E, 0x6A, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0x2A, 0x26, 0x26, 0x32, 0x20, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x8B, 0x71, 0x7F, 0xA1, 0x7B, 0x6C, 0x54, 0x68, 0xC4, 0x8B, 0x39,
-  0x39, 0x74, 0xB1, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB2, 0x2B, 0x20, 0x1B, 0x2A, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x29, 0x29, 0x29, 0x29, 0x2E, 0x2F, 0x2F, 0x2F, 0x8B, 0xD5, 0x54, 0x7A, 0xA3, 0xA4, 0x5E, 0x68, 0xA5, 0x2E,
-  0x39, 0xAA, 0x97, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB9, 0x98, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0x38, 0x74, 0x2F, 0x2F,
-  0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2F, 0x2F, 0x37, 0x37, 0x2E, 0x2E, 0x2E, 0xA6, 0xBF, 0x7D, 0x5C, 0x55, 0x5E, 0x70, 0xA7,
-  0x2E, 0xAA, 0xE6, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0xA8, 0x74, 0x97, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB7, 0x2F, 0x2F,
-  0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0xAA, 0xB2, 0xA8, 0x2E, 0x37, 0x2E, 0xA8, 0x54, 0x71, 0xA9, 0x9A, 0x5E, 0x4D,
-  0x78, 0xA6, 0x98, 0xE8, 0x7E, 0x7E, 0xBA, 0x98, 0xB2, 0x3A, 0x39, 0x39, 0x74, 0xE6, 0xE7, 0x53, 0x7E, 0x6A, 0xE6, 0xB9,
-  0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2E, 0x8B, 0x78, 0x97, 0x97, 0x9C, 0xA8, 0x37, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0x9A, 0x5E,
-  0x94, 0xA6, 0x39, 0xAA, 0x97, 0xE7, 0x6A, 0x98, 0xB9, 0x39, 0x39, 0x39, 0x39, 0x39, 0xAA, 0x97, 0xE7, 0x7E, 0x53, 0x8D,
-  0x98, 0x9C, 0x39, 0x39, 0x39, 0x39, 0x39, 0x78, 0x98, 0xE5, 0xBA, 0xE6, 0xB2, 0x39, 0x39, 0xA8, 0x71, 0x71, 0xCD, 0x9A,
-  0x54, 0x4D, 0x78, 0x37, 0x39, 0xAA, 0x98, 0xE6, 0xB2, 0x39, 0x8B, 0x37, 0x37, 0x37, 0x2E, 0x8B, 0x95, 0xE6, 0xE7, 0x53,
-  0x7E, 0xBA, 0x98, 0xB2, 0xA8, 0x39, 0x39, 0x78, 0x97, 0xE5, 0x7E, 0x7E, 0xE7, 0x97, 0xAA, 0xA8, 0xA8, 0x85, 0x71, 0xA9,
-  0xAB, 0x54, 0xBF, 0xA7, 0x2E, 0x37, 0x37, 0x95, 0xB9, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x77, 0x9C, 0x97,
-  0xE7, 0x7E, 0x7E, 0xE7, 0x98, 0x9C, 0x39, 0x78, 0x98, 0xE5, 0x53, 0x7E, 0x6A, 0xE6, 0xB9, 0x37, 0xA8, 0xA8, 0x5F, 0x7D,
-  0xA9, 0xAE, 0x6A, 0x69, 0xA7, 0x2E, 0x2E, 0x2E, 0x37, 0x2F, 0x2E, 0x2E, 0x2E, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x28, 0x27,
-  0xDB, 0xB1, 0xE7, 0x53, 0x7E, 0xBA, 0x98, 0xB9, 0x97, 0xE5, 0x7E, 0x7E, 0x6A, 0xE6, 0xB9, 0x39, 0x39, 0x39, 0x39, 0x54,
-  0x7A, 0x5C, 0x72, 0xBA, 0x7E, 0x93, 0x8B, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2A, 0x29, 0x2F, 0x2F,
-  0x30, 0x21, 0xAC, 0x97, 0xE7, 0x7E, 0x7E, 0xE7, 0x98, 0xE5, 0x53, 0x7E, 0x54, 0xE6, 0xDD, 0x37, 0x3A, 0x39, 0x39, 0xA7,
-  0x6A, 0xA1, 0x83, 0x76, 0x8D, 0x7E, 0xC9, 0x8B, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x28, 0x2F, 0x2F, 0x2F,
-  0x26, 0x1A, 0x1F, 0x2B, 0x95, 0xE6, 0xE7, 0x53, 0x7E, 0x5F, 0x7E, 0x7E, 0x54, 0xE6, 0xB9, 0x2E, 0x37, 0x37, 0x39, 0xA8,
-  0xC1, 0x8D, 0x8C, 0x0E, 0x81, 0x6B, 0x6A, 0xBF, 0x8B, 0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x2F,
-  0x28, 0x33, 0x32, 0x26, 0x2B, 0x77, 0x95, 0x97, 0xE7, 0x7E, 0x7E, 0x7E, 0x54, 0xE6, 0xDD, 0x28, 0x2E, 0x2F, 0x2E, 0x39,
-  0x2E, 0x71, 0x7D, 0xD2, 0x87, 0x3F, 0x66, 0x8D, 0x53, 0xB4, 0x77, 0x2F, 0x28, 0x28, 0x2F, 0x29, 0x29, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x1F, 0x1A, 0x30, 0x26, 0x26, 0x27, 0x2F, 0x9C, 0xE6, 0xE7, 0x53, 0x54, 0xE6, 0xB7, 0x21, 0x90, 0x2A, 0x29, 0x2F,
-  0x2E, 0xA7, 0x8D, 0x89, 0x58, 0x87, 0x3F, 0x72, 0x7D, 0x54, 0x8D, 0x28, 0x29, 0x28, 0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x27, 0x33, 0x1A, 0x21, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x95, 0x97, 0xE7, 0xE6, 0x98, 0x2C, 0x36, 0x21, 0x1F, 0x2B,
-  0x28, 0x8B, 0xC9, 0x85, 0xBE, 0x76, 0x00, 0x00, 0x87, 0xC2, 0x8D, 0xBF, 0x93, 0x77, 0x29, 0x29, 0x2F, 0x2E, 0x2E, 0x2F,
-  0x2F, 0x2A, 0x21, 0x19, 0x36, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x8B, 0x95, 0xB1, 0xB7, 0x24, 0x1C, 0x19, 0x1B, 0x22,
-  0x20, 0x73, 0x93, 0x5F, 0x8F, 0xA9, 0x01, 0x00, 0x00, 0x3F, 0x6C, 0x71, 0x6A, 0x84, 0x92, 0x8B, 0x2F, 0x2F, 0x2F, 0x2E,
-  0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x8B, 0x95, 0x6D, 0x2D, 0x17, 0x24, 0x2C,
-  0x1A, 0x22, 0x21, 0x7D, 0x71, 0xBE, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x85, 0x54, 0x89, 0x2E, 0x2E, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x77, 0x26, 0x33, 0x23, 0x14,
-  0x24, 0x2D, 0x65, 0x6F, 0x8D, 0xA1, 0x58, 0x87, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x7D, 0x85, 0x6A, 0xD4, 0x8B, 0x2E,
-  0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x36, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x20, 0x1A,
-  0x17, 0x1C, 0x17, 0x5C, 0x5F, 0x7A, 0x99, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x7A, 0x85, 0x6A, 0xD4,
-  0x8B, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x37, 0x2F, 0x2B,
-  0x25, 0x1A, 0x6E, 0x88, 0x7F, 0x71, 0xD2, 0xE3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA4, 0x7A, 0x8D,
-  0x6A, 0xBC, 0x2F, 0x2A, 0x1F, 0x36, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E,
-  0x28, 0x73, 0x22, 0x6F, 0x6A, 0x84, 0xBE, 0xE3, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA4,
-  0x8F, 0x85, 0x6A, 0x8F, 0xC7, 0x64, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2F, 0x2E, 0x37,
-  0x37, 0x8B, 0x74, 0x8F, 0x7F, 0x6B, 0x8C, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0xA4, 0xC0, 0x7D, 0x8D, 0x54, 0x6F, 0x5B, 0x65, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2E,
-  0x8B, 0x78, 0xBC, 0x7F, 0xC5, 0x8F, 0xBE, 0xE0, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x4F, 0xC2, 0x89, 0x71, 0x7F, 0x7F, 0x6B, 0xB3, 0x1F, 0x90, 0x90, 0x90, 0x90, 0x73, 0x90, 0x77, 0x77,
-  0xA2, 0x8F, 0x7F, 0x94, 0x84, 0xC9, 0x6F, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0xA4, 0xCA, 0x7A, 0x71, 0x8D, 0x54, 0x54, 0xC0, 0x79, 0xCD, 0xA9, 0xCD, 0x79, 0x8F,
-  0x94, 0x4D, 0x75, 0x6B, 0x79, 0xCD, 0xBD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0x72, 0xC2, 0x89, 0x89, 0x7D, 0x84, 0xC5, 0xC5, 0x75, 0x75, 0x75,
-  0xC5, 0x6B, 0xCA, 0xC1, 0x6F, 0xC8, 0x81, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x41, 0xAE, 0xC2, 0xCA, 0x79, 0x79, 0x79, 0xC9,
-  0xC9, 0x79, 0xC3, 0xBD, 0x4F, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x4E, 0x82,
-  0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x55, 0x9A, 0xC0, 0x8F, 0x79, 0xC9, 0xC9,
-  0xC9, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0x99, 0xC1, 0xCD, 0xCD,
-  0xCD, 0xCD, 0xCD, 0xCD, 0xC1, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAE, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xB3, 0xD3, 0x5B,
-  0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0x6F, 0xA1, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xC3, 0x8C, 0x8C, 0xBE, 0xCD, 0xD3, 0xD1, 0x65, 0x19,
-  0x2D, 0x1C, 0x35, 0x1D, 0x24, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x5C, 0x79, 0xC9, 0x79, 0x9A, 0x82, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x19, 0x31,
-  0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x0A, 0x35, 0xC6, 0x89, 0x79, 0x80, 0x75, 0x6C, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xD2, 0xD2, 0x8C, 0xCD, 0x1C, 0x17, 0x2C, 0x19, 0x31,
-  0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A,
-  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xA9, 0xD2, 0x8C, 0x5C, 0x0B, 0x0A, 0x15, 0x1D, 0x1C,
-  0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x6D, 0x99, 0x89,
-  0xCA, 0x9A, 0x81, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x0A, 0x11, 0x0D, 0x0E, 0x05,
-  0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x6D,
-  0xC9, 0x8F, 0x8F, 0x9A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58, 0xD5, 0xD2, 0xCD, 0x35, 0x34, 0x16, 0x09, 0x16,
-  0x01, 0x08, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22,
-  0x38, 0x6D, 0x89, 0x89, 0x80, 0xA4, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0C, 0x0E, 0x0D, 0x3C,
-  0x3D, 0x01, 0x0A, 0xAD, 0x1A, 0x1A, 0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36,
-  0x30, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x3F, 0x00, 0x00, 0x87, 0x58, 0xD5, 0x8C, 0xD3, 0x17, 0x12, 0x05, 0x03,
-  0x3E, 0x3E, 0x02, 0xDC, 0x97, 0xBB, 0x91, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18,
-  0x1A, 0x36, 0x22, 0x22, 0x91, 0xCD, 0x7D, 0x8F, 0xBD, 0x3F, 0x00, 0x00, 0x81, 0xB4, 0xD4, 0x99, 0x6D, 0x2C, 0x1D, 0x15,
-  0x03, 0x0D, 0x03, 0xEA, 0xE6, 0xE7, 0xE6, 0xBB, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19,
-  0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x7D, 0x8F, 0x80, 0x56, 0x00, 0x09, 0x88, 0xB4, 0x8C, 0xA2, 0xD1, 0x19, 0x23,
-  0x0C, 0x05, 0x07, 0xDC, 0xE6, 0x6A, 0x53, 0xBA, 0x97, 0xBB, 0x19, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19,
-  0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xB3, 0x7D, 0x89, 0x72, 0x00, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x33, 0x1B,
-  0x18, 0x35, 0x14, 0xDF, 0xE6, 0xBA, 0x7E, 0x7E, 0x53, 0xBA, 0xE6, 0xBB, 0x17, 0x1D, 0x1D, 0x06, 0x05, 0x24, 0x18, 0x19,
-  0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x84, 0x89, 0xC3, 0x87, 0x7B, 0xB4, 0xD2, 0xBC, 0x63, 0x30,
-  0x33, 0x18, 0x17, 0xB7, 0xE6, 0x6A, 0x7E, 0x53, 0xBA, 0x7E, 0x7E, 0xBA, 0x97, 0xBB, 0x7C, 0x13, 0x34, 0x0C, 0x18, 0x19,
-  0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x71, 0x7A, 0xA1, 0x56, 0x04, 0xB4, 0x8C, 0xC7, 0x20,
-  0x1E, 0x30, 0x1A, 0xB7, 0xE6, 0xBA, 0x7E, 0x7E, 0xE9, 0x97, 0xBA, 0x7E, 0x7E, 0x8D, 0xB1, 0xB8, 0x12, 0x05, 0x2C, 0x19,
-  0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0xD1, 0x6F, 0x85, 0xA1, 0x72, 0x83, 0xB4, 0xBE, 0xC7,
-  0x20, 0x21, 0x25, 0xB7, 0xE6, 0x6A, 0x7E, 0x53, 0xE9, 0xB1, 0xBB, 0x97, 0xE7, 0x7E, 0x7E, 0x8D, 0x97, 0xD6, 0x1D, 0x19,
-  0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x1A, 0x65, 0x1E, 0x20, 0x30, 0xD3, 0xBA, 0x89, 0xBD, 0xC6, 0xD5, 0xC1,
-  0xC7, 0x20, 0x21, 0xB9, 0xE6, 0x6A, 0x7E, 0x7E, 0xE9, 0x97, 0xDB, 0x65, 0xBB, 0x98, 0xBA, 0x7E, 0x7E, 0x8D, 0xB1, 0xBB,
-  0x31, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x1A, 0x1A, 0x91, 0xBB, 0xDB, 0x1E, 0x1F, 0x21, 0x6D, 0x5F, 0x8F, 0xC3, 0xD3, 0xD5,
-  0xC1, 0x74, 0x63, 0xAC, 0xE6, 0xE7, 0x53, 0x53, 0xE9, 0xB1, 0xAC, 0x25, 0x30, 0x64, 0xDB, 0x98, 0xE7, 0x53, 0x7E, 0x8D,
-  0x97, 0xBB, 0x19, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x32, 0xB7, 0x97, 0x97, 0xAC, 0x1F, 0x63, 0xD1, 0x5F, 0x7A, 0xCA, 0xD0,
-  0xD4, 0xC1, 0x74, 0x20, 0x63, 0xDB, 0x97, 0x85, 0xE9, 0x97, 0xAC, 0x64, 0x30, 0x25, 0x25, 0x25, 0xDB, 0x97, 0xBA, 0x7E,
-  0x7E, 0x8D, 0xB1, 0xDB, 0x64, 0x22, 0x22, 0x22, 0x22, 0xDB, 0x98, 0x8D, 0xE7, 0x98, 0xAC, 0x26, 0x64, 0x8D, 0x7D, 0xCA,
-  0xD3, 0xD4, 0xC9, 0x21, 0x1E, 0x21, 0x30, 0xDB, 0xE6, 0x98, 0xDB, 0x36, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x19, 0xBB, 0x97,
-  0xE7, 0x7E, 0x7E, 0xE7, 0x97, 0xDB, 0x64, 0x30, 0x30, 0xB7, 0x98, 0xBA, 0x53, 0x53, 0xE5, 0x98, 0x74, 0x1E, 0x6A, 0x7D,
-  0x80, 0x5A, 0xD4, 0xA1, 0x25, 0x30, 0x1E, 0x38, 0x65, 0xDB, 0x5B, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x31,
-  0xDF, 0x97, 0xBA, 0x53, 0x53, 0xE7, 0xE6, 0xDB, 0x38, 0xDB, 0x98, 0x8D, 0x53, 0x7E, 0xE7, 0x97, 0x95, 0x73, 0x6D, 0x54,
-  0x71, 0xCA, 0xD9, 0xD5, 0xA1, 0x61, 0x30, 0x25, 0x38, 0x1B, 0x91, 0x1A, 0x1A, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x19,
-  0x1C, 0x15, 0xB8, 0x98, 0xBA, 0x53, 0x7E, 0xE7, 0x97, 0xB7, 0x98, 0xBA, 0x53, 0x53, 0xE7, 0xE6, 0xAC, 0x90, 0x20, 0xD3,
-  0x54, 0x85, 0x66, 0x06, 0xD5, 0xA1, 0xD0, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x2D, 0x2D, 0x2D, 0x18, 0x19,
-  0x18, 0x07, 0x12, 0x35, 0xDF, 0x98, 0xBA, 0x7E, 0x53, 0xE7, 0x98, 0x8D, 0x53, 0x7E, 0xE7, 0x97, 0xAC, 0x26, 0x27, 0x64,
-  0x6F, 0x6A, 0x71, 0xC8, 0x11, 0xB4, 0xC1, 0xA9, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x31, 0x31, 0x18, 0x19,
-  0x19, 0x13, 0x34, 0x13, 0x1D, 0x6E, 0xBB, 0x98, 0x8D, 0x53, 0x7E, 0x54, 0x53, 0x53, 0xE7, 0xE6, 0xDB, 0x1E, 0x26, 0x2B,
-  0x1B, 0xC5, 0x5F, 0x7D, 0x76, 0x0D, 0x93, 0xBE, 0x89, 0xD1, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19,
-  0x19, 0x23, 0x05, 0x06, 0x1D, 0x1D, 0x17, 0x19, 0xB7, 0x98, 0xBA, 0x53, 0x7E, 0x7E, 0xE7, 0x97, 0xBB, 0x1B, 0x1E, 0x26,
-  0x30, 0xCF, 0x6A, 0x5F, 0x7D, 0x87, 0x3B, 0xD0, 0xD2, 0x7A, 0xD3, 0x32, 0x22, 0x33, 0x1B, 0x18, 0x18, 0x18, 0x18, 0x19,
-  0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0xBB, 0x98, 0x8D, 0x53, 0xE7, 0xB1, 0xEA, 0x14, 0x19, 0x1E,
-  0x1F, 0x2C, 0x88, 0x54, 0x5F, 0x55, 0x3F, 0x00, 0x05, 0xB4, 0xA1, 0x8F, 0x32, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19,
-  0x19, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x1A, 0x91, 0xDF, 0x98, 0xE9, 0x97, 0xDE, 0x05, 0x13, 0x18,
-  0x25, 0x33, 0x7C, 0x94, 0xBF, 0x8D, 0x4F, 0x00, 0x00, 0x87, 0xA2, 0xBE, 0x7A, 0xC4, 0x65, 0x25, 0x30, 0x33, 0x1B, 0x1A,
-  0x19, 0x19, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x1D, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x2D, 0xB8, 0x97, 0xDE, 0x0D, 0x05, 0x1D,
-  0x19, 0x30, 0x07, 0xE2, 0x53, 0x54, 0xC5, 0x40, 0x00, 0x00, 0x00, 0x0E, 0xD4, 0x89, 0x8F, 0x36, 0xD1, 0x1E, 0x25, 0x38,
-  0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x1C, 0xD6, 0x04, 0x0E, 0x07,
-  0x24, 0x1A, 0x06, 0xE0, 0x70, 0x7E, 0x5F, 0x72, 0x3F, 0x00, 0x00, 0x00, 0x01, 0xC6, 0xBE, 0x7D, 0x79, 0x32, 0x22, 0x20,
-  0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x7C, 0x0B, 0x0B,
-  0x1D, 0x2C, 0x0A, 0x3F, 0x67, 0x4C, 0x5E, 0x55, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xD4, 0xA1, 0x71, 0xA9, 0x65,
-  0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17,
-  0x2C, 0x31, 0x0A, 0x3D, 0xEB, 0x68, 0x53, 0x7F, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x8C, 0x8F, 0x85,
-  0xA9, 0x91, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33,
-  0x38, 0x22, 0x06, 0x3C, 0xEB, 0x68, 0x4C, 0x6A, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x86, 0xC1,
-  0x7D, 0x8D, 0x6F, 0x18, 0x6E, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E,
-  0x20, 0x33, 0x05, 0x40, 0xEB, 0x47, 0x4B, 0x7E, 0xCB, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0xE3, 0xA1, 0x71, 0x8D, 0x84, 0x83, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F,
-  0x30, 0x1D, 0x0A, 0xEC, 0x48, 0x47, 0x4B, 0x5E, 0xCB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0x86, 0x89, 0x85, 0x7F, 0x54, 0x55, 0xE0, 0x11, 0x05, 0x17, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B, 0x6E,
-  0x0A, 0x07, 0xA3, 0xE1, 0x49, 0x47, 0x4B, 0x69, 0x42, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0x76, 0x80, 0x85, 0x5F, 0x54, 0x69, 0x4D, 0x55, 0xDE, 0x0A, 0x0A, 0x0A, 0x05, 0x05, 0x05, 0x07,
-  0xA3, 0xE1, 0x8E, 0x48, 0x47, 0x68, 0x4C, 0x4D, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xBD, 0x6B, 0x8D, 0x6A, 0xBF, 0x7E, 0x4B, 0x70, 0x67, 0x82, 0x67, 0xE1, 0x5D,
-  0x48, 0x49, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0x4E, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xA4, 0x6B, 0xBA, 0x54, 0x7E, 0x53, 0x4B, 0x4B, 0x68, 0x68,
-  0x68, 0x68, 0x68, 0x4B, 0x53, 0x4D, 0xCB, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x87, 0x6C, 0x55, 0xC5, 0x7F, 0x6A, 0x5E, 0x7E,
-  0x7E, 0x7E, 0xBF, 0x4D, 0x4E, 0x4F, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x02, 0x0F, 0x0E, 0x34, 0x05,
-  0x07, 0x06, 0x05, 0x08, 0x03, 0x0D, 0x01, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x34, 0x07, 0x07, 0x05, 0x08, 0x04,
-  0x08, 0x08, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x02, 0x08, 0x0A, 0x08, 0x03, 0x0D, 0x10, 0x02,
-  0x0D, 0x0F, 0x11, 0x11, 0x11, 0x04, 0x08, 0x06, 0x12, 0x13, 0x14, 0x0A, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x04, 0x0D, 0x16, 0x3B, 0x0E, 0x1D,
-  0x2D, 0x18, 0x19, 0x1B, 0x1B, 0x1A, 0x18, 0x1C, 0x15, 0x34, 0x06, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x07, 0x06, 0x03, 0x01, 0x02, 0x0A, 0x33, 0x20,
-  0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x30, 0x1B, 0x2C, 0x13, 0x15, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x3B, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x0A, 0x34, 0x0D, 0x01, 0x12, 0x36, 0x1F, 0x2B,
-  0x2A, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x2D, 0x2D, 0x1A, 0x2D, 0x12, 0x0C, 0x14, 0x17, 0x11,
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x0B, 0x34, 0x0F, 0x0D, 0x35, 0x30, 0x2B, 0x2F,
-  0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x1E, 0x32, 0x18, 0x1A, 0x22, 0x2B, 0x26, 0x1D, 0x0C, 0x14,
-  0x2C, 0x03, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x05, 0x0F, 0x03, 0x0A, 0x2C, 0x21, 0x27,
-  0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x1E, 0x1E, 0x1E, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x28, 0x27, 0x2C,
-  0x0C, 0x24, 0x31, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x12, 0x07, 0x11, 0x11, 0x15, 0x13, 0x31, 0x33,
-  0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B, 0x27, 0x26, 0x26, 0x26, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29,
-  0x29, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x05, 0x12, 0x08, 0x0E, 0x0C, 0x1D, 0x24, 0x1C,
-  0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x2F, 0x2F, 0x2F,
-  0x29, 0x2F, 0x2A, 0x1C, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x07, 0x0E, 0x14, 0x2C, 0x18, 0x1C,
-  0x14, 0x14, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 0x2F,
-  0x2F, 0x2E, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1B, 0x0F, 0x3B, 0x00, 0x00, 0x09, 0x06, 0x0B, 0x08, 0x35, 0x38, 0x30, 0x32,
-  0x31, 0x14, 0x0B, 0x1C, 0x32, 0x1F, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x32, 0x1D, 0x23, 0x24, 0x00, 0x00, 0x00, 0x10, 0x14, 0x15, 0x05, 0x25, 0x1F, 0x1F,
-  0x1E, 0x36, 0x24, 0x1C, 0x24, 0x23, 0x38, 0x27, 0x2E, 0x2E, 0x26, 0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2E, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x3B, 0x0A, 0x13, 0x05, 0x17, 0x2B, 0x28,
-  0x27, 0x2B, 0x38, 0x33, 0x1A, 0x23, 0x24, 0x2C, 0x1E, 0x2E, 0x1A, 0x0B, 0x27, 0x26, 0x26, 0x21, 0x19, 0x25, 0x28, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x07, 0x3B, 0x01, 0x13, 0x0B, 0x34, 0x2B, 0x29,
-  0x2F, 0x2F, 0x27, 0x26, 0x26, 0x1E, 0x1B, 0x23, 0x24, 0x18, 0x2C, 0x08, 0x12, 0x2A, 0x26, 0x26, 0x22, 0x1B, 0x27, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x2A, 0x1C, 0x17, 0x1A, 0x09, 0x0D, 0x35, 0x0A, 0x13, 0x2E,
-  0x2E, 0x2E, 0x2E, 0x27, 0x28, 0x2A, 0x27, 0x1F, 0x33, 0x2D, 0x15, 0x08, 0x08, 0x12, 0x28, 0x26, 0x26, 0x32, 0x20, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2C, 0x24, 0x32, 0x03, 0x03, 0x35, 0x0A, 0x38,
-  0x2E, 0x39, 0x37, 0x2E, 0x28, 0x2E, 0x2F, 0x2F, 0x28, 0x20, 0x0A, 0x08, 0x02, 0x11, 0x12, 0x28, 0x26, 0x20, 0x1B, 0x2A,
-  0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x29, 0x2E, 0x2F, 0x2F, 0x2F, 0x37, 0x1E, 0x35, 0x19, 0x12, 0x05, 0x1D, 0x12,
-  0x26, 0x2E, 0x39, 0x39, 0x2F, 0x2E, 0x39, 0x37, 0x39, 0x1F, 0x07, 0x04, 0x01, 0x3B, 0x0E, 0x05, 0x12, 0x0A, 0x15, 0x15,
-  0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x0A, 0x1F, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x29, 0x1D, 0x2D, 0x17, 0x0A, 0x1D,
-  0x0B, 0x2B, 0x2E, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x25, 0x08, 0x0E, 0x16, 0x16, 0x3B, 0x03, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x08, 0x20, 0x2E, 0x39, 0x2E, 0x37, 0x2E, 0x39, 0x1D, 0x23, 0x18, 0x0C,
-  0x1D, 0x0C, 0x2A, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x31, 0x34, 0x03, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x3B, 0x3B, 0x3B,
-  0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x09, 0x34, 0x1F, 0x37, 0x39, 0x37, 0x37, 0x37, 0x3A, 0x1C, 0x23, 0x1B,
-  0x1D, 0x1D, 0x1D, 0x2F, 0x39, 0x39, 0x39, 0x37, 0x2E, 0x14, 0x04, 0x0F, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x09, 0x34, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x2C, 0x23,
-  0x1B, 0x13, 0x1D, 0x1D, 0x28, 0x37, 0x39, 0x39, 0x37, 0x2F, 0x0C, 0x08, 0x0D, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x39, 0x39, 0x39, 0x3A, 0x23,
-  0x2C, 0x1B, 0x0C, 0x35, 0x13, 0x27, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x3A, 0x1C, 0x34, 0x0F, 0x16, 0x16, 0x16, 0x16, 0x3B,
-  0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x3B, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x39, 0x39, 0x39, 0x3A,
-  0x14, 0x2D, 0x1A, 0x0A, 0x14, 0x13, 0x2B, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x32, 0x04, 0x11, 0x3B, 0x16, 0x3B,
-  0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x08, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x35, 0x18, 0x2D, 0x0E, 0x1C, 0x13, 0x1F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x29, 0x2F, 0x25, 0x06, 0x0E, 0x01,
-  0x3B, 0x0E, 0x05, 0x15, 0x0A, 0x0A, 0x0A, 0x15, 0x06, 0x07, 0x15, 0x0A, 0x0A, 0x0A, 0x15, 0x26, 0x39, 0x39, 0x39, 0x39,
-  0x3A, 0x27, 0x14, 0x1B, 0x0C, 0x0F, 0x17, 0x13, 0x1A, 0x39, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28, 0x1F, 0x15,
-  0x04, 0x01, 0x11, 0x15, 0x20, 0x26, 0x27, 0x28, 0x1F, 0x23, 0x1C, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x2F, 0x39, 0x37, 0x37,
-  0x39, 0x3A, 0x32, 0x1C, 0x30, 0x0E, 0x02, 0x1C, 0x14, 0x1D, 0x39, 0x2F, 0x29, 0x28, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x2F,
-  0x2A, 0x0B, 0x08, 0x04, 0x0A, 0x26, 0x2B, 0x2A, 0x2E, 0x2F, 0x1E, 0x17, 0x1C, 0x19, 0x30, 0x1F, 0x27, 0x29, 0x2E, 0x2F,
-  0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0x3B, 0x1D, 0x1C, 0x13, 0x20, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x28, 0x29, 0x2F,
-  0x2F, 0x2E, 0x2A, 0x24, 0x08, 0x0A, 0x26, 0x26, 0x27, 0x2F, 0x2E, 0x27, 0x36, 0x1C, 0x1C, 0x31, 0x33, 0x20, 0x2B, 0x2A,
-  0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 0x3B, 0x11, 0x2D, 0x35, 0x1C, 0x28, 0x29, 0x28, 0x28, 0x2F, 0x2F, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x27, 0x33, 0x13, 0x12, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2F, 0x26, 0x1A, 0x24, 0x1C, 0x2D, 0x36, 0x21,
-  0x1F, 0x2B, 0x28, 0x2E, 0x1B, 0x23, 0x33, 0x11, 0x00, 0x00, 0x09, 0x14, 0x1C, 0x1D, 0x20, 0x2F, 0x29, 0x29, 0x2F, 0x2E,
-  0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x36, 0x30, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x28, 0x21, 0x31, 0x24, 0x1C, 0x19,
-  0x1B, 0x22, 0x20, 0x2B, 0x20, 0x14, 0x18, 0x1B, 0x01, 0x00, 0x00, 0x00, 0x03, 0x2C, 0x14, 0x17, 0x2F, 0x2E, 0x2F, 0x2F,
-  0x2F, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x28, 0x2F, 0x2E, 0x2E, 0x27, 0x22, 0x2D, 0x17,
-  0x24, 0x2C, 0x1A, 0x22, 0x21, 0x23, 0x23, 0x22, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x16, 0x13, 0x23, 0x35, 0x19, 0x2E, 0x2E,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x33,
-  0x23, 0x14, 0x24, 0x2D, 0x1B, 0x31, 0x1C, 0x1B, 0x24, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x2C, 0x17, 0x35, 0x1E,
-  0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x32, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A,
-  0x20, 0x1A, 0x17, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x11, 0x2D, 0x1C,
-  0x14, 0x1E, 0x37, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x37,
-  0x2F, 0x2B, 0x25, 0x1A, 0x23, 0x1C, 0x14, 0x23, 0x1E, 0x34, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x06,
-  0x31, 0x17, 0x35, 0x30, 0x2F, 0x2A, 0x1F, 0x32, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x28, 0x2F, 0x2F,
-  0x2E, 0x2E, 0x28, 0x26, 0x22, 0x17, 0x35, 0x17, 0x36, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x08, 0x31, 0x23, 0x14, 0x2D, 0x1F, 0x1E, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x28, 0x2F,
-  0x2E, 0x37, 0x37, 0x2E, 0x26, 0x23, 0x35, 0x17, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3B, 0x08, 0x2D, 0x2D, 0x24, 0x35, 0x31, 0x19, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x27, 0x2F,
-  0x2E, 0x2E, 0x2E, 0x2A, 0x38, 0x1D, 0x35, 0x2C, 0x32, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x35, 0x1A, 0x23, 0x14, 0x35, 0x1C, 0x1A, 0x1F, 0x27, 0x27, 0x27, 0x2B, 0x2B, 0x27,
-  0x29, 0x29, 0x1E, 0x2C, 0x35, 0x13, 0x14, 0x1A, 0x2C, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x17, 0x18, 0x23, 0x24, 0x1D, 0x1D, 0x23, 0x31, 0x1A, 0x32, 0x1A,
-  0x31, 0x23, 0x1D, 0x0C, 0x13, 0x14, 0x2D, 0x19, 0x0B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x04, 0x14, 0x1A, 0x18, 0x2C, 0x1C, 0x14, 0x1D, 0x1D,
-  0x1D, 0x1D, 0x35, 0x1C, 0x2D, 0x1B, 0x2C, 0x06, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0D, 0x07, 0x35, 0x2C, 0x18, 0x18,
-  0x18, 0x18, 0x19, 0x31, 0x1C, 0x0A, 0x0F, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x02, 0x0F, 0x04, 0x34,
-  0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18,
-  0x1A, 0x19, 0x18, 0x31, 0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x15, 0x18, 0x1B, 0x36, 0x36, 0x32,
-  0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x08, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x15, 0x18, 0x33, 0x33, 0x1B, 0x1A, 0x1B,
-  0x1B, 0x1B, 0x18, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B, 0x36, 0x33,
-  0x32, 0x19, 0x2D, 0x1C, 0x35, 0x35, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07, 0x10, 0x3B,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32,
-  0x18, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 0x35, 0x35, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B,
-  0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C,
-  0x18, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18,
-  0x17, 0x13, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15,
-  0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38,
-  0x1B, 0x18, 0x23, 0x13, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D,
-  0x0E, 0x34, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x35, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x32, 0x33,
-  0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 0x16,
-  0x09, 0x3B, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B,
-  0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E,
-  0x0D, 0x3C, 0x3D, 0x16, 0x15, 0x17, 0x1A, 0x1A, 0x18, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x34, 0x0C, 0x2C, 0x2D,
-  0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x3B, 0x00, 0x00, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 0x12,
-  0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31,
-  0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x0B, 0x00, 0x00, 0x3B, 0x0D, 0x2B, 0x21, 0x33, 0x33, 0x2C,
-  0x1D, 0x15, 0x03, 0x0D, 0x03, 0x10, 0x0F, 0x05, 0x24, 0x1A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31,
-  0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38,
-  0x18, 0x23, 0x0C, 0x34, 0x07, 0x34, 0x11, 0x10, 0x0F, 0x0A, 0x2D, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C,
-  0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x3B, 0x10, 0x30, 0x1F, 0x33, 0x20,
-  0x33, 0x1B, 0x18, 0x35, 0x14, 0x1D, 0x0A, 0x05, 0x11, 0x02, 0x11, 0x13, 0x1A, 0x2D, 0x1C, 0x35, 0x1D, 0x06, 0x34, 0x24,
-  0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x1C, 0x09, 0x03, 0x1F, 0x1E, 0x30,
-  0x20, 0x30, 0x33, 0x18, 0x23, 0x31, 0x2D, 0x1C, 0x0C, 0x07, 0x0E, 0x02, 0x04, 0x14, 0x05, 0x35, 0x35, 0x13, 0x34, 0x0C,
-  0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0x08, 0x2B, 0x22,
-  0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1A, 0x1B, 0x1A, 0x18, 0x2C, 0x14, 0x12, 0x08, 0x0F, 0x08, 0x08, 0x14, 0x35, 0x12, 0x05,
-  0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x18, 0x32, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05, 0x13, 0x26,
-  0x33, 0x1F, 0x20, 0x21, 0x25, 0x1B, 0x33, 0x33, 0x33, 0x32, 0x1B, 0x18, 0x2C, 0x15, 0x34, 0x0F, 0x08, 0x1C, 0x35, 0x06,
-  0x35, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x18, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x2C,
-  0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x22, 0x36, 0x13, 0x08, 0x03, 0x09, 0x34, 0x14, 0x13,
-  0x15, 0x2C, 0x23, 0x1C, 0x17, 0x23, 0x2C, 0x2D, 0x2D, 0x31, 0x31, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24,
-  0x1A, 0x20, 0x32, 0x1F, 0x1F, 0x20, 0x1E, 0x22, 0x25, 0x1E, 0x25, 0x25, 0x30, 0x0A, 0x08, 0x02, 0x3B, 0x09, 0x34, 0x05,
-  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x33, 0x38, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31,
-  0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x25, 0x36, 0x06, 0x04, 0x10, 0x3B, 0x16, 0x3B, 0x02,
-  0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0F, 0x04, 0x25, 0x25, 0x1F, 0x26, 0x1F, 0x1E, 0x1C,
-  0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21, 0x30, 0x33, 0x36, 0x33, 0x2C, 0x05, 0x0E, 0x01, 0x3B, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x10, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x26, 0x1E,
-  0x14, 0x2C, 0x17, 0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x1B, 0x1B, 0x17, 0x04, 0x0E, 0x3B, 0x16, 0x16, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x10, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x1F,
-  0x22, 0x35, 0x2C, 0x1C, 0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 0x1A, 0x18, 0x0B, 0x08, 0x0F, 0x3B, 0x16, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x10, 0x04, 0x1E, 0x21, 0x26, 0x2B,
-  0x20, 0x32, 0x35, 0x2C, 0x1D, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x0B, 0x34, 0x0F, 0x16,
-  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x02, 0x04, 0x30, 0x1E, 0x26,
-  0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D, 0x14, 0x34,
-  0x11, 0x16, 0x16, 0x3B, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x38, 0x1E,
-  0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18,
-  0x1C, 0x05, 0x0E, 0x01, 0x09, 0x34, 0x07, 0x15, 0x12, 0x0C, 0x0C, 0x15, 0x08, 0x11, 0x04, 0x34, 0x06, 0x15, 0x0A, 0x1B,
-  0x1E, 0x26, 0x30, 0x2D, 0x35, 0x24, 0x2C, 0x09, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x18, 0x18, 0x18,
-  0x18, 0x1A, 0x2D, 0x07, 0x08, 0x01, 0x34, 0x0B, 0x35, 0x17, 0x18, 0x1B, 0x23, 0x07, 0x0F, 0x0D, 0x11, 0x05, 0x0A, 0x14,
-  0x19, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A, 0x09, 0x3B, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 0x1A,
-  0x18, 0x19, 0x19, 0x18, 0x14, 0x34, 0x08, 0x08, 0x0C, 0x35, 0x24, 0x2D, 0x1A, 0x1A, 0x35, 0x34, 0x0D, 0x0D, 0x11, 0x05,
-  0x13, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33,
-  0x1B, 0x1A, 0x18, 0x18, 0x23, 0x0A, 0x08, 0x34, 0x08, 0x0C, 0x1D, 0x14, 0x2C, 0x18, 0x1A, 0x2D, 0x0B, 0x04, 0x0D, 0x0D,
-  0x34, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x35, 0x35, 0x16, 0x00, 0x00, 0x3B, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E,
-  0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x0A, 0x0C, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x1C, 0x0A, 0x08,
-  0x0E, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x3B, 0x00, 0x00, 0x00, 0x16, 0x1A, 0x33, 0x2D, 0x2D, 0x32,
-  0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x14,
-  0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3B, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x1E, 0x1B, 0x23,
-  0x19, 0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B,
-  0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x22,
-  0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A,
-  0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-  0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A,
-  0x36, 0x1E, 0x20, 0x33, 0x34, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x32, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38,
-  0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 0x15, 0x12, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3B, 0x0A, 0x18, 0x2C, 0x1C, 0x35, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x1B, 0x1B, 0x1B, 0x1B, 0x1B,
-  0x1B, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 0x0B, 0x13, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x23, 0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 0x05,
-  0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x07,
-  0x07, 0x07, 0x07, 0x06, 0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B,
-  0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35,
-  0x1D, 0x13, 0x13, 0x13, 0x13, 0x12, 0x05, 0x0F, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x02, 0x0F, 0x0E,
-  0x34, 0x05, 0x07, 0x06, 0x05, 0x08, 0x03, 0x0D, 0x01, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x34, 0x07, 0x07, 0x05,
-  0x08, 0x04, 0x08, 0x08, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0F, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x02, 0x08, 0x0A, 0x08, 0x03, 0x0D,
-  0x10, 0x02, 0x0D, 0x0F, 0x11, 0x11, 0x11, 0x04, 0x08, 0x06, 0x12, 0x13, 0x14, 0x0A, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x04, 0x0D, 0x16, 0x3B,
-  0x0E, 0x1D, 0x2D, 0x18, 0x19, 0x1B, 0x1B, 0x1A, 0x18, 0x1C, 0x15, 0x34, 0x06, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x07, 0x06, 0x03, 0x01, 0x02, 0x0A,
-  0x33, 0x20, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x30, 0x1B, 0x2C, 0x13, 0x15, 0x0A, 0x13, 0x24, 0x14, 0x0D,
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x0A, 0x34, 0x0D, 0x01, 0x12, 0x36,
-  0x1F, 0x2B, 0x2A, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x2D, 0x2D, 0x1A, 0x2D, 0x12, 0x0C, 0x14,
-  0x17, 0x11, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x0B, 0x34, 0x0F, 0x0D, 0x35, 0x30,
-  0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x1E, 0x32, 0x18, 0x1A, 0x22, 0x2B, 0x26, 0x1D,
-  0x0C, 0x14, 0x2C, 0x03, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x05, 0x0F, 0x03, 0x0A, 0x2C,
-  0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x1E, 0x1E, 0x1E, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x28,
-  0x27, 0x2C, 0x0C, 0x24, 0x31, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x12, 0x07, 0x11, 0x11, 0x15, 0x13,
-  0x31, 0x33, 0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B, 0x27, 0x26, 0x26, 0x26, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F,
-  0x2A, 0x29, 0x29, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x05, 0x12, 0x08, 0x0E, 0x0C, 0x1D,
-  0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x2F,
-  0x2F, 0x2F, 0x29, 0x2F, 0x2A, 0x1C, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x0C, 0x07, 0x0E, 0x14, 0x2C,
-  0x18, 0x1C, 0x14, 0x14, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28,
-  0x28, 0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1B, 0x0F, 0x3B, 0x00, 0x00, 0x09, 0x06, 0x0B, 0x08, 0x35, 0x38,
-  0x30, 0x32, 0x31, 0x14, 0x0B, 0x1C, 0x32, 0x1F, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x32, 0x1D, 0x23, 0x24, 0x00, 0x00, 0x00, 0x10, 0x14, 0x15, 0x05, 0x25,
-  0x1F, 0x1F, 0x1E, 0x36, 0x24, 0x1C, 0x24, 0x23, 0x38, 0x27, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2E, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x3B, 0x0A, 0x13, 0x05, 0x17,
-  0x2B, 0x28, 0x27, 0x2B, 0x38, 0x33, 0x1A, 0x23, 0x24, 0x2C, 0x1E, 0x2F, 0x2E, 0x2F, 0x27, 0x26, 0x26, 0x21, 0x19, 0x25,
-  0x28, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x07, 0x3B, 0x01, 0x13, 0x0B, 0x34,
-  0x2B, 0x29, 0x2F, 0x2F, 0x27, 0x26, 0x26, 0x1E, 0x1B, 0x23, 0x24, 0x18, 0x26, 0x2E, 0x2F, 0x27, 0x26, 0x26, 0x22, 0x1B,
-  0x27, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x2A, 0x1C, 0x17, 0x1A, 0x09, 0x0D, 0x35, 0x0A,
-  0x13, 0x2E, 0x2E, 0x2E, 0x2E, 0x27, 0x28, 0x2A, 0x27, 0x1F, 0x33, 0x2C, 0x24, 0x1A, 0x2A, 0x2E, 0x2A, 0x26, 0x26, 0x32,
-  0x20, 0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2C, 0x24, 0x32, 0x03, 0x03, 0x35,
-  0x0A, 0x38, 0x2E, 0x39, 0x37, 0x2E, 0x28, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x25, 0x31, 0x1C, 0x30, 0x2E, 0x28, 0x2B, 0x20,
-  0x1B, 0x2A, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x29, 0x29, 0x29, 0x2E, 0x2F, 0x2F, 0x2F, 0x37, 0x1E, 0x35, 0x19, 0x12, 0x05,
-  0x1D, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x2F, 0x2E, 0x39, 0x39, 0x39, 0x39, 0x37, 0x29, 0x26, 0x1A, 0x1C, 0x1F, 0x37, 0x27,
-  0x30, 0x26, 0x2E, 0x2F, 0x29, 0x2F, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x29, 0x1D, 0x2D, 0x17,
-  0x0A, 0x1D, 0x0B, 0x2B, 0x2E, 0x39, 0x39, 0x2E, 0x39, 0x3A, 0x32, 0x24, 0x1C, 0x24, 0x14, 0x1B, 0x2A, 0x33, 0x1D, 0x14,
-  0x35, 0x0C, 0x14, 0x26, 0x29, 0x2F, 0x1A, 0x14, 0x24, 0x24, 0x14, 0x2B, 0x2E, 0x39, 0x2E, 0x37, 0x2E, 0x39, 0x1D, 0x23,
-  0x18, 0x0C, 0x1D, 0x0C, 0x2A, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x24, 0x0E, 0x03, 0x03, 0x0E, 0x24, 0x39, 0x37, 0x14,
-  0x0E, 0x03, 0x03, 0x08, 0x20, 0x2F, 0x37, 0x24, 0x0E, 0x03, 0x03, 0x08, 0x1F, 0x37, 0x39, 0x37, 0x37, 0x37, 0x3A, 0x1C,
-  0x23, 0x1B, 0x1D, 0x1D, 0x1D, 0x2F, 0x39, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x03, 0x1C, 0x3A, 0x3A,
-  0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A,
-  0x2C, 0x23, 0x1B, 0x13, 0x1D, 0x1D, 0x28, 0x37, 0x39, 0x39, 0x37, 0x37, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x03, 0x24, 0x39,
-  0x37, 0x24, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x39, 0x39, 0x39,
-  0x3A, 0x23, 0x2C, 0x1B, 0x0C, 0x35, 0x13, 0x27, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x39, 0x24, 0x0E, 0x03, 0x03, 0x0E, 0x14,
-  0x2E, 0x2F, 0x14, 0x0E, 0x03, 0x03, 0x08, 0x30, 0x2F, 0x39, 0x24, 0x0E, 0x03, 0x03, 0x08, 0x1F, 0x39, 0x3A, 0x39, 0x39,
-  0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x0A, 0x14, 0x13, 0x2B, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x37, 0x1B, 0x14, 0x24, 0x14, 0x14,
-  0x1A, 0x2F, 0x2E, 0x19, 0x0C, 0x35, 0x24, 0x1D, 0x1C, 0x1E, 0x2A, 0x1B, 0x24, 0x24, 0x24, 0x24, 0x27, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x35, 0x18, 0x2D, 0x0E, 0x1C, 0x13, 0x1F, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2E, 0x2E, 0x2E, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x1E, 0x21, 0x27, 0x2E, 0x2F, 0x18, 0x17, 0x33, 0x26, 0x2F, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x3A, 0x27, 0x14, 0x1B, 0x0C, 0x0F, 0x17, 0x13, 0x1A, 0x39, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x28,
-  0x28, 0x2F, 0x2F, 0x2F, 0x26, 0x1A, 0x1F, 0x2B, 0x28, 0x2E, 0x26, 0x23, 0x1C, 0x1B, 0x21, 0x2B, 0x28, 0x2F, 0x2E, 0x39,
-  0x37, 0x37, 0x39, 0x3A, 0x32, 0x1C, 0x30, 0x0E, 0x02, 0x1C, 0x14, 0x1D, 0x39, 0x2F, 0x29, 0x28, 0x2F, 0x29, 0x2A, 0x28,
-  0x29, 0x2F, 0x2F, 0x2F, 0x28, 0x33, 0x32, 0x26, 0x2B, 0x2A, 0x2E, 0x2F, 0x1E, 0x17, 0x1C, 0x19, 0x30, 0x1F, 0x27, 0x29,
-  0x2E, 0x2F, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0x3B, 0x1D, 0x1C, 0x13, 0x20, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x28,
-  0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x1F, 0x1A, 0x30, 0x26, 0x26, 0x27, 0x2F, 0x2E, 0x27, 0x36, 0x1C, 0x1C, 0x31, 0x33, 0x20,
-  0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 0x3B, 0x11, 0x2D, 0x35, 0x1C, 0x28, 0x29, 0x28, 0x28, 0x2F,
-  0x2F, 0x2F, 0x2F, 0x2F, 0x2F, 0x27, 0x33, 0x1A, 0x21, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2F, 0x26, 0x1A, 0x24, 0x1C, 0x2D,
-  0x36, 0x21, 0x1F, 0x2B, 0x28, 0x2E, 0x1B, 0x23, 0x33, 0x11, 0x00, 0x00, 0x09, 0x14, 0x1C, 0x1D, 0x20, 0x2F, 0x29, 0x29,
-  0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x32, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x28, 0x21, 0x31, 0x24,
-  0x1C, 0x19, 0x1B, 0x22, 0x20, 0x2B, 0x20, 0x14, 0x18, 0x1B, 0x01, 0x00, 0x00, 0x00, 0x03, 0x2C, 0x14, 0x17, 0x2F, 0x2E,
-  0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x28, 0x2F, 0x2E, 0x2E, 0x27, 0x22,
-  0x2D, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x23, 0x23, 0x22, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x16, 0x13, 0x23, 0x35, 0x19,
-  0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x29,
-  0x26, 0x33, 0x23, 0x14, 0x24, 0x2D, 0x1B, 0x31, 0x1C, 0x1B, 0x24, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x2C, 0x17,
-  0x35, 0x1E, 0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x32, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E,
-  0x2E, 0x2A, 0x20, 0x1A, 0x17, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x11,
-  0x2D, 0x1C, 0x14, 0x1E, 0x37, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F,
-  0x2E, 0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x23, 0x1C, 0x14, 0x23, 0x1E, 0x34, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x06, 0x31, 0x17, 0x35, 0x30, 0x2F, 0x2A, 0x1F, 0x32, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x28,
-  0x2F, 0x2F, 0x2E, 0x2E, 0x28, 0x26, 0x22, 0x17, 0x35, 0x17, 0x36, 0x06, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3B, 0x08, 0x31, 0x23, 0x14, 0x2D, 0x1F, 0x1E, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27,
-  0x28, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x26, 0x23, 0x35, 0x17, 0x30, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x2D, 0x2D, 0x24, 0x35, 0x31, 0x19, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
-  0x27, 0x2F, 0x2E, 0x2E, 0x2E, 0x2A, 0x38, 0x1D, 0x35, 0x2C, 0x32, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x35, 0x1A, 0x23, 0x14, 0x35, 0x1C, 0x1A, 0x1F, 0x27, 0x27, 0x27, 0x2B,
-  0x2B, 0x27, 0x29, 0x29, 0x1E, 0x2C, 0x35, 0x13, 0x14, 0x1A, 0x2C, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x05, 0x17, 0x18, 0x23, 0x24, 0x1D, 0x1D, 0x23, 0x31, 0x1A,
-  0x32, 0x1A, 0x31, 0x23, 0x1D, 0x0C, 0x13, 0x14, 0x2D, 0x19, 0x0B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x04, 0x14, 0x1A, 0x18, 0x2C, 0x1C, 0x14,
-  0x1D, 0x1D, 0x1D, 0x1D, 0x35, 0x1C, 0x2D, 0x1B, 0x2C, 0x06, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0D, 0x07, 0x35, 0x2C,
-  0x18, 0x18, 0x18, 0x18, 0x19, 0x31, 0x1C, 0x0A, 0x0F, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x02, 0x0F,
-  0x04, 0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x06, 0x13, 0x17,
-  0x2D, 0x18, 0x1A, 0x19, 0x18, 0x31, 0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x15, 0x18, 0x1B, 0x36,
-  0x36, 0x32, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x08, 0x10, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x15, 0x18, 0x33, 0x33, 0x1B,
-  0x1A, 0x1B, 0x1B, 0x1B, 0x18, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B,
-  0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 0x35, 0x35, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07,
-  0x10, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A,
-  0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 0x35, 0x35, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18,
-  0x1C, 0x0B, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C,
-  0x17, 0x2C, 0x18, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36,
-  0x1A, 0x18, 0x17, 0x13, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B,
-  0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A,
-  0x36, 0x38, 0x1B, 0x18, 0x23, 0x13, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x19, 0x21, 0x30, 0x2C, 0x15,
-  0x11, 0x0D, 0x0E, 0x34, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x35, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31,
-  0x32, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1D, 0x20, 0x25, 0x1A, 0x1D,
-  0x34, 0x16, 0x09, 0x3B, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D,
-  0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x21, 0x33, 0x23,
-  0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x16, 0x15, 0x17, 0x1A, 0x1A, 0x18, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x34, 0x0C,
-  0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x3B, 0x00, 0x00, 0x09, 0x35, 0x1F, 0x30, 0x1B,
-  0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15,
-  0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x0B, 0x00, 0x00, 0x3B, 0x0D, 0x2B, 0x21, 0x33,
-  0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x10, 0x0F, 0x05, 0x24, 0x1A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B, 0x34, 0x34,
-  0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0x09, 0x17, 0x1F, 0x22,
-  0x30, 0x38, 0x18, 0x23, 0x0C, 0x34, 0x07, 0x34, 0x11, 0x10, 0x0F, 0x0A, 0x2D, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08,
-  0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x3B, 0x10, 0x30, 0x1F,
-  0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x14, 0x1D, 0x0A, 0x05, 0x11, 0x02, 0x11, 0x13, 0x1A, 0x18, 0x23, 0x35, 0x1D, 0x06,
-  0x34, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x1C, 0x09, 0x03, 0x1F,
-  0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x23, 0x31, 0x2D, 0x1C, 0x0C, 0x07, 0x0E, 0x02, 0x04, 0x23, 0x1A, 0x2C, 0x35, 0x13,
-  0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0x08,
-  0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1A, 0x1B, 0x1A, 0x18, 0x2C, 0x14, 0x12, 0x08, 0x02, 0x07, 0x18, 0x2D, 0x1D,
-  0x12, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x18, 0x32, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05,
-  0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 0x25, 0x1B, 0x33, 0x33, 0x33, 0x32, 0x1B, 0x18, 0x23, 0x1D, 0x34, 0x0D, 0x13, 0x18,
-  0x35, 0x06, 0x35, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x18, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19,
-  0x0C, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x22, 0x33, 0x32, 0x1A, 0x23, 0x15, 0x11,
-  0x23, 0x35, 0x0A, 0x19, 0x31, 0x2C, 0x2D, 0x31, 0x19, 0x1A, 0x1A, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24,
-  0x18, 0x24, 0x1A, 0x20, 0x32, 0x1F, 0x1F, 0x20, 0x1E, 0x22, 0x25, 0x1E, 0x25, 0x31, 0x23, 0x2C, 0x23, 0x17, 0x1A, 0x1B,
-  0x14, 0x07, 0x0C, 0x13, 0x1D, 0x1D, 0x19, 0x19, 0x1A, 0x1C, 0x24, 0x1C, 0x24, 0x24, 0x36, 0x38, 0x20, 0x1F, 0x1F, 0x22,
-  0x24, 0x31, 0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x25, 0x15, 0x08, 0x04, 0x04, 0x04, 0x23,
-  0x30, 0x36, 0x06, 0x08, 0x04, 0x04, 0x04, 0x25, 0x22, 0x36, 0x05, 0x04, 0x04, 0x04, 0x0E, 0x25, 0x25, 0x1F, 0x26, 0x1F,
-  0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21, 0x30, 0x33, 0x36, 0x36, 0x33, 0x15, 0x04, 0x01, 0x10, 0x04,
-  0x24, 0x19, 0x23, 0x06, 0x0F, 0x01, 0x02, 0x04, 0x1E, 0x22, 0x36, 0x06, 0x0F, 0x01, 0x02, 0x04, 0x1E, 0x1E, 0x1F, 0x2B,
-  0x26, 0x1E, 0x14, 0x2C, 0x17, 0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x1B, 0x1B, 0x1B, 0x1B, 0x15, 0x0E, 0x3B, 0x01,
-  0x04, 0x35, 0x31, 0x2D, 0x06, 0x0D, 0x3B, 0x10, 0x08, 0x18, 0x1B, 0x1B, 0x06, 0x0D, 0x3B, 0x10, 0x04, 0x1E, 0x1E, 0x1F,
-  0x2B, 0x1F, 0x22, 0x35, 0x2C, 0x1C, 0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x1A, 0x15, 0x08, 0x0E,
-  0x04, 0x08, 0x35, 0x19, 0x17, 0x34, 0x04, 0x0E, 0x04, 0x34, 0x15, 0x24, 0x23, 0x06, 0x04, 0x0E, 0x04, 0x04, 0x1E, 0x21,
-  0x26, 0x2B, 0x20, 0x32, 0x35, 0x2C, 0x1D, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x12, 0x07,
-  0x07, 0x15, 0x07, 0x1C, 0x18, 0x15, 0x05, 0x06, 0x07, 0x15, 0x06, 0x0D, 0x34, 0x0B, 0x07, 0x07, 0x07, 0x15, 0x07, 0x30,
-  0x1E, 0x26, 0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x2D, 0x2D,
-  0x31, 0x18, 0x19, 0x1A, 0x19, 0x13, 0x34, 0x13, 0x35, 0x2C, 0x1A, 0x1C, 0x11, 0x0D, 0x08, 0x0A, 0x35, 0x23, 0x31, 0x1A,
-  0x32, 0x1E, 0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D,
-  0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0x1D, 0x35, 0x17, 0x19, 0x19, 0x0B, 0x03, 0x0D, 0x0E, 0x06, 0x0C, 0x14,
-  0x2C, 0x1B, 0x1E, 0x26, 0x30, 0x2D, 0x35, 0x24, 0x2C, 0x09, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x18,
-  0x18, 0x18, 0x18, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x23, 0x07, 0x0F, 0x0D, 0x11, 0x05,
-  0x0A, 0x14, 0x19, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A, 0x09, 0x3B, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33,
-  0x1B, 0x1A, 0x18, 0x19, 0x19, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x1A, 0x1A, 0x35, 0x34, 0x0D, 0x0D,
-  0x11, 0x05, 0x13, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25,
-  0x30, 0x33, 0x1B, 0x1A, 0x18, 0x18, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x35, 0x1D, 0x14, 0x2C, 0x18, 0x1A, 0x2D, 0x0B, 0x04,
-  0x0D, 0x0D, 0x34, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x35, 0x35, 0x16, 0x00, 0x00, 0x3B, 0x0E, 0x21, 0x1A, 0x2D, 0x36,
-  0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x1C,
-  0x0A, 0x08, 0x0E, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x3B, 0x00, 0x00, 0x00, 0x16, 0x1A, 0x33, 0x2D,
-  0x2D, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B,
-  0x18, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3B, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x1E,
-  0x1B, 0x23, 0x19, 0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19,
-  0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B,
-  0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31,
-  0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3B, 0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23,
-  0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x34, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x32, 0x1B, 0x1B, 0x19, 0x1A,
-  0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 0x15, 0x12, 0x35, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0A, 0x18, 0x2C, 0x1C, 0x35, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x1B, 0x1B, 0x1B,
-  0x1B, 0x1B, 0x1B, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 0x0B, 0x13, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x23, 0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15,
-  0x06, 0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 0x0B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A,
-  0x0A, 0x07, 0x07, 0x07, 0x07, 0x06, 0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C,
-  0x0B, 0x0B, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x03, 0x15, 0x13,
-  0x35, 0x35, 0x1D, 0x13, 0x13, 0x13, 0x13, 0x12, 0x05, 0x0F, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3B, 0x01, 0x02,
-  0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x03, 0x06, 0x07,
-  0x06, 0x34, 0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x0D, 0x07, 0x07, 0x0E,
-  0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x11, 0x11, 0x11, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x3B, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x10, 0x06, 0x06, 0x11, 0x02,
-  0x3B, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1B, 0x1B, 0x19, 0x1C, 0x15, 0x08, 0x07, 0x12, 0x1D, 0x14, 0x15, 0x09,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0A, 0x08, 0x0D, 0x01,
-  0x03, 0x14, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24,
-  0x14, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x04, 0x15, 0x0E, 0x10, 0x0F,
-  0x14, 0x25, 0x26, 0x27, 0x28, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 0x0B,
-  0x0C, 0x14, 0x17, 0x11, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x08, 0x0A, 0x0E, 0x0D, 0x11,
-  0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x18, 0x1A, 0x30, 0x2B,
-  0x1F, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x11, 0x0A, 0x08, 0x0D, 0x04,
-  0x13, 0x19, 0x1F, 0x2A, 0x2E, 0x2E, 0x2E, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26,
-  0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x13, 0x05, 0x03, 0x08,
-  0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 0x20,
-  0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x15, 0x11, 0x05,
-  0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30,
-  0x26, 0x2F, 0x2F, 0x2F, 0x29, 0x29, 0x29, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x0B, 0x34, 0x05,
-  0x2C, 0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x28, 0x2B, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32,
-  0x25, 0x2F, 0x28, 0x2F, 0x2F, 0x2F, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x3B, 0x00, 0x00, 0x01, 0x1D, 0x0A, 0x08,
-  0x19, 0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x22, 0x23, 0x34, 0x38, 0x2E, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x1A,
-  0x13, 0x05, 0x20, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x00, 0x00, 0x3B, 0x06, 0x13, 0x06,
-  0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x0B, 0x04, 0x04, 0x05, 0x1F, 0x2F, 0x27, 0x26, 0x26, 0x20, 0x1B,
-  0x24, 0x08, 0x0E, 0x04, 0x22, 0x2E, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x01, 0x13, 0x12,
-  0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 0x38, 0x22, 0x1A, 0x15, 0x34, 0x0D, 0x16, 0x11, 0x06, 0x2B, 0x27, 0x26, 0x26, 0x25,
-  0x14, 0x34, 0x0D, 0x16, 0x03, 0x34, 0x19, 0x39, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x0D, 0x1D,
-  0x0A, 0x1D, 0x29, 0x2F, 0x2F, 0x2F, 0x26, 0x2B, 0x1F, 0x12, 0x08, 0x02, 0x3B, 0x16, 0x16, 0x0E, 0x15, 0x26, 0x26, 0x26,
-  0x31, 0x34, 0x03, 0x16, 0x16, 0x3B, 0x0F, 0x04, 0x31, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x08,
-  0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 0x2F, 0x27, 0x29, 0x2A, 0x36, 0x0E, 0x0F, 0x3B, 0x16, 0x16, 0x16, 0x04, 0x0A, 0x27,
-  0x22, 0x34, 0x03, 0x16, 0x16, 0x16, 0x3B, 0x11, 0x05, 0x26, 0x29, 0x2F, 0x2F, 0x2F, 0x2F, 0x2E, 0x2C, 0x24, 0x36, 0x03,
-  0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x29, 0x2E, 0x2E, 0x2E, 0x37, 0x1B, 0x34, 0x0D, 0x16, 0x16, 0x16, 0x01, 0x04,
-  0x12, 0x07, 0x0E, 0x16, 0x16, 0x16, 0x16, 0x11, 0x05, 0x1F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 0x1E, 0x35, 0x19,
-  0x0A, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x39, 0x2F, 0x39, 0x39, 0x39, 0x37, 0x2E, 0x23, 0x04, 0x02, 0x3B, 0x16, 0x16,
-  0x10, 0x34, 0x0E, 0x16, 0x16, 0x16, 0x3B, 0x03, 0x04, 0x1E, 0x2F, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2F, 0x1D,
-  0x2D, 0x1C, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x24, 0x34, 0x10, 0x16,
-  0x16, 0x3B, 0x10, 0x01, 0x16, 0x16, 0x16, 0x0F, 0x34, 0x33, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0x39,
-  0x35, 0x23, 0x19, 0x1C, 0x0C, 0x24, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x0C, 0x04,
-  0x01, 0x16, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x0D, 0x04, 0x31, 0x2E, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37, 0x39, 0x37,
-  0x3A, 0x1C, 0x2C, 0x1A, 0x17, 0x0C, 0x23, 0x39, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x12, 0x04, 0x01, 0x16, 0x16, 0x16, 0x16, 0x02, 0x34, 0x23, 0x3A, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x3A, 0x23, 0x23, 0x1B, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x37, 0x37, 0x37,
-  0x39, 0x18, 0x34, 0x02, 0x16, 0x16, 0x16, 0x3B, 0x03, 0x34, 0x1F, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A, 0x39,
-  0x39, 0x39, 0x3A, 0x1C, 0x2C, 0x1B, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 0x37, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F,
-  0x2F, 0x36, 0x0E, 0x0F, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x11, 0x34, 0x27, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x3A,
-  0x39, 0x39, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x24, 0x1D, 0x14, 0x29, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x2F, 0x29,
-  0x29, 0x1E, 0x05, 0x03, 0x16, 0x16, 0x16, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x0E, 0x15, 0x2A, 0x37, 0x37, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0x35, 0x18, 0x31, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x28,
-  0x28, 0x1F, 0x08, 0x11, 0x09, 0x16, 0x16, 0x16, 0x11, 0x0F, 0x3B, 0x16, 0x16, 0x16, 0x04, 0x12, 0x28, 0x2E, 0x2E, 0x37,
-  0x39, 0x39, 0x39, 0x39, 0x3A, 0x1F, 0x24, 0x36, 0x0A, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x28,
-  0x28, 0x26, 0x07, 0x0E, 0x16, 0x16, 0x16, 0x16, 0x11, 0x08, 0x34, 0x0F, 0x3B, 0x16, 0x16, 0x01, 0x04, 0x0B, 0x27, 0x2F,
-  0x2E, 0x37, 0x37, 0x37, 0x39, 0x39, 0x18, 0x23, 0x1E, 0x11, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x28, 0x28, 0x2F, 0x28,
-  0x28, 0x27, 0x15, 0x0E, 0x3B, 0x16, 0x16, 0x3B, 0x0F, 0x34, 0x36, 0x17, 0x08, 0x02, 0x3B, 0x16, 0x3B, 0x10, 0x08, 0x14,
-  0x2B, 0x28, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x28, 0x2A, 0x28,
-  0x29, 0x27, 0x12, 0x08, 0x01, 0x16, 0x16, 0x3B, 0x03, 0x34, 0x32, 0x2B, 0x28, 0x2C, 0x08, 0x10, 0x3B, 0x16, 0x3B, 0x02,
-  0x08, 0x1D, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 0x28,
-  0x28, 0x2F, 0x2E, 0x22, 0x05, 0x11, 0x16, 0x3B, 0x0D, 0x08, 0x1C, 0x27, 0x26, 0x2A, 0x2F, 0x13, 0x04, 0x01, 0x3B, 0x10,
-  0x08, 0x06, 0x1B, 0x25, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x00, 0x3B, 0x2D, 0x24, 0x35, 0x2B, 0x2F,
-  0x29, 0x2F, 0x2F, 0x2E, 0x37, 0x1F, 0x06, 0x04, 0x0D, 0x08, 0x24, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x0C, 0x04, 0x0D,
-  0x08, 0x06, 0x1C, 0x31, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x00, 0x00, 0x00, 0x3B, 0x06, 0x23, 0x35, 0x31,
-  0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2B, 0x07, 0x08, 0x12, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2A, 0x0A,
-  0x34, 0x0C, 0x19, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x3B, 0x00, 0x00, 0x00, 0x01, 0x24, 0x17,
-  0x1D, 0x1B, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x2F, 0x2B, 0x36, 0x13, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x2E,
-  0x27, 0x2C, 0x26, 0x33, 0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0F,
-  0x2D, 0x1C, 0x35, 0x20, 0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F,
-  0x2E, 0x2E, 0x39, 0x2A, 0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 0x2E, 0x28, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A,
-  0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x1E, 0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3B, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x1E, 0x1B, 0x18, 0x32, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B,
-  0x2A, 0x2F, 0x2F, 0x2F, 0x37, 0x37, 0x28, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26,
-  0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x04, 0x23, 0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27,
-  0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 0x1A, 0x2D, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27,
-  0x27, 0x2B, 0x2B, 0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x35, 0x2C, 0x32, 0x07, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 0x14, 0x18, 0x2D, 0x17, 0x14, 0x1D, 0x0C,
-  0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x16, 0x0F, 0x07, 0x23, 0x1A, 0x19,
-  0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09, 0x0D,
-  0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01,
-  0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x10, 0x07,
-  0x1D, 0x23, 0x31, 0x18, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x35, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0D, 0x0A, 0x19,
-  0x32, 0x36, 0x36, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x0B, 0x19, 0x38,
-  0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x18, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 0x04,
-  0x16, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x02, 0x2C, 0x22, 0x22,
-  0x32, 0x1B, 0x33, 0x33, 0x1B, 0x18, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31,
-  0x35, 0x15, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x1B, 0x30, 0x38,
-  0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x35, 0x35, 0x35, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31,
-  0x1A, 0x18, 0x17, 0x0B, 0x0F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x1E, 0x25, 0x38,
-  0x31, 0x1C, 0x1C, 0x23, 0x18, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D,
-  0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x33, 0x1E, 0x22,
-  0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B,
-  0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1B, 0x21, 0x22,
-  0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E,
-  0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x14, 0x20, 0x25,
-  0x1A, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04,
-  0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1E, 0x1E,
-  0x36, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08,
-  0x05, 0x13, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x3B, 0x00, 0x00, 0x09, 0x17, 0x1F,
-  0x22, 0x32, 0x23, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x0B, 0x32, 0x1A, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05,
-  0x08, 0x0A, 0x12, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x13, 0x00, 0x00, 0x3B, 0x03, 0x2B,
-  0x1E, 0x33, 0x33, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x34, 0x08, 0x0A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B,
-  0x08, 0x05, 0x06, 0x08, 0x0A, 0x31, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0x09, 0x17,
-  0x1F, 0x22, 0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x04, 0x08, 0x0D, 0x34, 0x0B, 0x1A, 0x1C, 0x1D, 0x35,
-  0x15, 0x08, 0x05, 0x34, 0x0D, 0x04, 0x07, 0x2C, 0x31, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0x10,
-  0x25, 0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x0A, 0x34, 0x08, 0x01, 0x3B, 0x02, 0x08, 0x13, 0x23, 0x35,
-  0x1D, 0x06, 0x34, 0x08, 0x0D, 0x3B, 0x01, 0x04, 0x05, 0x17, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x23, 0x09,
-  0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x07, 0x08, 0x01, 0x16, 0x16, 0x16, 0x0D, 0x34, 0x13,
-  0x35, 0x13, 0x34, 0x34, 0x0F, 0x16, 0x16, 0x16, 0x01, 0x08, 0x06, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A,
-  0x0F, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x31, 0x05, 0x0E, 0x16, 0x16, 0x16, 0x3B, 0x0F,
-  0x08, 0x0B, 0x0A, 0x08, 0x03, 0x3B, 0x16, 0x16, 0x16, 0x11, 0x05, 0x23, 0x31, 0x19, 0x36, 0x25, 0x20, 0x33, 0x19, 0x23,
-  0x1A, 0x05, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x18, 0x05, 0x0E, 0x16, 0x16, 0x16,
-  0x16, 0x03, 0x34, 0x34, 0x11, 0x16, 0x16, 0x16, 0x16, 0x11, 0x05, 0x23, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x25, 0x32,
-  0x1C, 0x19, 0x13, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x22, 0x18, 0x34, 0x03, 0x16,
-  0x16, 0x16, 0x3B, 0x11, 0x0E, 0x3B, 0x16, 0x16, 0x3B, 0x03, 0x34, 0x1C, 0x1B, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20,
-  0x33, 0x24, 0x18, 0x1C, 0x1B, 0x20, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 0x1E, 0x18, 0x34,
-  0x03, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x03, 0x34, 0x17, 0x32, 0x32, 0x32, 0x32, 0x32, 0x22, 0x20, 0x1F,
-  0x1F, 0x22, 0x24, 0x31, 0x17, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x30, 0x30, 0x22, 0x30, 0x25,
-  0x1C, 0x08, 0x0D, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x0D, 0x08, 0x14, 0x25, 0x22, 0x22, 0x22, 0x30, 0x22, 0x25, 0x1F,
-  0x26, 0x26, 0x1E, 0x1C, 0x2D, 0x23, 0x1B, 0x21, 0x1B, 0x21, 0x1E, 0x1E, 0x22, 0x36, 0x36, 0x36, 0x36, 0x32, 0x32, 0x1B,
-  0x1B, 0x1B, 0x14, 0x34, 0x0F, 0x3B, 0x16, 0x16, 0x3B, 0x0D, 0x34, 0x1C, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x22, 0x1E,
-  0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x18, 0x20, 0x1B, 0x25, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x1A, 0x1A, 0x1A,
-  0x19, 0x18, 0x31, 0x0B, 0x08, 0x10, 0x16, 0x16, 0x16, 0x16, 0x10, 0x08, 0x0C, 0x32, 0x33, 0x38, 0x22, 0x22, 0x22, 0x22,
-  0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x35, 0x2C, 0x24, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x18,
-  0x31, 0x31, 0x2D, 0x12, 0x08, 0x10, 0x3B, 0x16, 0x16, 0x16, 0x16, 0x3B, 0x10, 0x08, 0x12, 0x19, 0x1B, 0x32, 0x33, 0x38,
-  0x22, 0x1E, 0x26, 0x2B, 0x21, 0x32, 0x35, 0x2C, 0x1D, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x31, 0x31,
-  0x2D, 0x2D, 0x31, 0x1D, 0x34, 0x0D, 0x3B, 0x16, 0x16, 0x01, 0x01, 0x16, 0x16, 0x3B, 0x0D, 0x08, 0x0B, 0x2C, 0x18, 0x1A,
-  0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 0x14, 0x2D, 0x34, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x2D,
-  0x2D, 0x2D, 0x31, 0x1D, 0x08, 0x0D, 0x3B, 0x16, 0x16, 0x16, 0x04, 0x08, 0x16, 0x16, 0x16, 0x3B, 0x0D, 0x08, 0x0A, 0x1C,
-  0x2C, 0x18, 0x32, 0x1E, 0x26, 0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19,
-  0x31, 0x31, 0x18, 0x1C, 0x34, 0x03, 0x3B, 0x16, 0x16, 0x16, 0x0E, 0x05, 0x05, 0x04, 0x16, 0x16, 0x16, 0x3B, 0x03, 0x34,
-  0x0A, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33,
-  0x1B, 0x19, 0x18, 0x1C, 0x34, 0x03, 0x3B, 0x16, 0x16, 0x3B, 0x11, 0x34, 0x13, 0x24, 0x05, 0x0E, 0x3B, 0x16, 0x16, 0x3B,
-  0x0F, 0x34, 0x07, 0x1D, 0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x3B, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33,
-  0x30, 0x38, 0x1B, 0x19, 0x15, 0x08, 0x10, 0x3B, 0x16, 0x16, 0x11, 0x34, 0x13, 0x1D, 0x24, 0x17, 0x05, 0x11, 0x16, 0x16,
-  0x3B, 0x10, 0x08, 0x34, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x09, 0x31, 0x30, 0x31, 0x1A,
-  0x32, 0x25, 0x25, 0x22, 0x32, 0x1A, 0x12, 0x08, 0x0D, 0x09, 0x0F, 0x08, 0x0B, 0x35, 0x1D, 0x14, 0x2C, 0x17, 0x08, 0x03,
-  0x09, 0x02, 0x08, 0x04, 0x34, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1E, 0x1B,
-  0x2C, 0x32, 0x36, 0x1E, 0x1E, 0x22, 0x32, 0x1A, 0x0A, 0x08, 0x03, 0x34, 0x07, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1C,
-  0x34, 0x11, 0x08, 0x34, 0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x3B, 0x00, 0x00, 0x00, 0x3B, 0x1C,
-  0x30, 0x31, 0x2C, 0x32, 0x33, 0x20, 0x1E, 0x22, 0x32, 0x1C, 0x06, 0x34, 0x34, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31,
-  0x1A, 0x14, 0x04, 0x0B, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x35, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 0x20, 0x1E, 0x36, 0x1C, 0x0A, 0x05, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17,
-  0x2D, 0x19, 0x32, 0x23, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3B, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24,
-  0x23, 0x31, 0x19, 0x1A, 0x32, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3B, 0x04, 0x32, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17,
-  0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x18, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x18, 0x32, 0x38, 0x36, 0x32,
-  0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31,
-  0x19, 0x18, 0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A,
-  0x07, 0x07, 0x05, 0x05, 0x05, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x35, 0x13, 0x0C,
-  0x12, 0x0A, 0x0A, 0x15, 0x07, 0x07, 0x07, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x0F, 0x34, 0x1C, 0x1C,
-  0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x09,
-  0x0F, 0x34, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F,
-  0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x82, 0xCC, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46,
-  0x44, 0x47, 0x48, 0x49, 0x4A, 0x4A, 0x4A, 0x4A, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x41, 0x43,
-  0x48, 0x4A, 0x50, 0x50, 0x51, 0x51, 0x51, 0x51, 0x52, 0x52, 0x52, 0x52, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0xED, 0x56, 0x3F,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x44, 0x48,
-  0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0xE1, 0x4A, 0x48, 0x4B, 0x5E, 0x5F,
-  0x55, 0x3F, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x46, 0x45, 0x49,
-  0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 0x63, 0x1F, 0x1F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x91, 0xEE, 0xBD, 0x67, 0x68,
-  0x69, 0x6A, 0x6B, 0x56, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x68, 0x4A,
-  0x50, 0x51, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x6E, 0x6E, 0x5B,
-  0x6F, 0x70, 0x4C, 0x6A, 0x71, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x6C, 0x4B, 0x4A,
-  0x50, 0x52, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x18, 0x1A,
-  0x30, 0x73, 0x74, 0xC5, 0x53, 0x6A, 0x71, 0x76, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x70, 0x49,
-  0x50, 0xEB, 0x0A, 0x6E, 0x21, 0x27, 0x2E, 0x2E, 0x2E, 0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19,
-  0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4D, 0x47,
-  0x50, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x26, 0x21, 0x1A, 0x2C,
-  0x1B, 0x20, 0x2A, 0x2F, 0x28, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x82, 0x4B,
-  0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32,
-  0x18, 0x38, 0x26, 0x28, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00, 0x41, 0x4C,
-  0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x78, 0x8B, 0x92, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x25,
-  0x1A, 0x32, 0xC7, 0x29, 0x28, 0x2F, 0x2F, 0x2F, 0x28, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x3B, 0x00, 0x00, 0x87, 0x82,
-  0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0xEF, 0x96, 0xF0, 0x9C, 0x8B, 0x28, 0x2B, 0x26, 0x26, 0x1F,
-  0x38, 0x19, 0xA0, 0xF0, 0xF1, 0x92, 0x2F, 0x2F, 0x2F, 0x2F, 0x28, 0x8B, 0x8C, 0x7E, 0x8D, 0x5C, 0x3F, 0x00, 0x3F, 0x56,
-  0x5E, 0x45, 0x8E, 0x21, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0xD9, 0x97, 0xF2, 0xF3, 0xF0, 0xAA, 0x77, 0x27, 0x26, 0x2B,
-  0x20, 0x91, 0xB7, 0xF0, 0xF3, 0xF2, 0xF1, 0x92, 0x2F, 0x2F, 0x2F, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x3F,
-  0xED, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x22, 0xEF, 0xB6, 0xF0, 0xB5, 0x7E, 0xF3, 0xF0, 0x78, 0x27, 0x26,
-  0x26, 0x1E, 0xB7, 0xF0, 0xF4, 0x53, 0xF5, 0xF0, 0xF6, 0x8B, 0x2F, 0x2F, 0x28, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09,
-  0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x27, 0x2B, 0x74, 0xF7, 0xF0, 0xF8, 0x53, 0x7E, 0x7E, 0xF3, 0xF9, 0x78,
-  0x26, 0x26, 0xAC, 0xF0, 0xF5, 0x53, 0x7E, 0x4C, 0xF4, 0xF2, 0xF6, 0x77, 0x2F, 0x29, 0x28, 0x2F, 0x78, 0x8D, 0x8D, 0x99,
-  0x87, 0x4F, 0x6A, 0x68, 0xFA, 0x9B, 0x37, 0x2E, 0x2E, 0x27, 0x29, 0x28, 0x9C, 0xF2, 0xF4, 0x53, 0x7E, 0x7E, 0x7E, 0xAF,
-  0xF9, 0x73, 0xC7, 0xF0, 0xF5, 0x7E, 0x7E, 0x7E, 0x53, 0xF3, 0xF0, 0x78, 0x29, 0x2F, 0x2F, 0x2F, 0x29, 0x8B, 0x7A, 0x5F,
-  0xA1, 0x11, 0x6C, 0x54, 0x68, 0xFB, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x2E, 0x2E, 0x92, 0xFC, 0xF0, 0xF4, 0x53, 0x7E, 0x7E,
-  0x5E, 0xF2, 0xF7, 0xF9, 0xF3, 0x7E, 0x7E, 0x7E, 0x7E, 0xF3, 0xF0, 0xAA, 0x77, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2,
-  0x54, 0x7A, 0xA3, 0xAE, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x39, 0x39, 0x37, 0x8B, 0xF6, 0xF2, 0xB5, 0x7E,
-  0x7E, 0x53, 0xF8, 0xF0, 0xF3, 0x7E, 0x7E, 0x7E, 0x53, 0xF5, 0xF2, 0xF1, 0x2F, 0x2E, 0x2E, 0x2E, 0x37, 0x2E, 0x2E, 0x8B,
-  0xA6, 0x5E, 0x7D, 0x5C, 0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0xF7, 0xF0,
-  0xF8, 0x53, 0x7E, 0x7E, 0xF8, 0x5E, 0x7E, 0x7E, 0x53, 0xF4, 0xF0, 0x9C, 0x8B, 0x2E, 0x2E, 0x2E, 0x2E, 0x39, 0x2E, 0x37,
-  0x37, 0xA8, 0x54, 0x71, 0xA9, 0xFA, 0x5E, 0x70, 0x78, 0x37, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37,
-  0xF7, 0xF2, 0x5E, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x53, 0xB5, 0xF2, 0xF6, 0x2E, 0x2E, 0x37, 0x37, 0x37, 0x37, 0x39, 0x37,
-  0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0xFA, 0x5E, 0x94, 0xA6, 0x39, 0x39, 0x39, 0x37, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0xF9, 0xF2, 0x5E, 0x7E, 0x7E, 0x7E, 0x7E, 0xF8, 0xF0, 0xF6, 0xA8, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x39, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0xFA, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x37, 0x37, 0x37,
-  0x2E, 0x37, 0x8B, 0xF6, 0xF0, 0xB5, 0x53, 0x7E, 0x7E, 0x7E, 0xF5, 0xF0, 0xA7, 0xA8, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x3A, 0x39, 0x39, 0x39, 0xA8, 0x8D, 0x71, 0xA9, 0xAB, 0x54, 0x69, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E,
-  0x2E, 0x2F, 0x92, 0x9C, 0xF2, 0xF4, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0x4C, 0xF3, 0xF0, 0x78, 0x39, 0x39, 0x39, 0x39, 0x39,
-  0x39, 0x3A, 0x39, 0x39, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0xAE, 0x6A, 0x7E, 0xA7, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F,
-  0x2F, 0x29, 0x77, 0xF1, 0xF0, 0xF5, 0x7E, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0xF3, 0xF9, 0xA6, 0x37, 0x39, 0x39,
-  0x39, 0x39, 0x39, 0x39, 0x39, 0xA8, 0x39, 0x54, 0x7A, 0x88, 0x72, 0x8D, 0x53, 0x93, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F,
-  0x29, 0x28, 0x28, 0xA7, 0xF0, 0xF3, 0x4C, 0x7E, 0x7E, 0x7E, 0xF3, 0xF4, 0x53, 0x7E, 0x7E, 0x7E, 0xF2, 0xF9, 0x28, 0x2F,
-  0x2E, 0x37, 0x39, 0x39, 0x39, 0x39, 0xA8, 0x93, 0x5F, 0xA1, 0xA3, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F,
-  0x29, 0x28, 0x28, 0x78, 0xF9, 0xF3, 0x7E, 0x7E, 0x7E, 0x7E, 0xF3, 0xF0, 0xF0, 0xF4, 0x53, 0x7E, 0x7E, 0x5E, 0xF2, 0xF7,
-  0x27, 0x29, 0x2E, 0x37, 0x37, 0x37, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x81, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x29, 0x28,
-  0x29, 0x28, 0x77, 0x2A, 0xF9, 0xF3, 0x53, 0x7E, 0x7E, 0x53, 0xF4, 0xF0, 0x9C, 0xF6, 0xF0, 0xF8, 0x7E, 0x7E, 0x7E, 0xF8,
-  0xF2, 0x96, 0x2B, 0x28, 0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F,
-  0x2A, 0x28, 0x2F, 0x28, 0xF9, 0xF2, 0x5E, 0x7E, 0x7E, 0x7E, 0xF5, 0xF0, 0x9C, 0x73, 0x77, 0xF6, 0xF0, 0xF8, 0x7E, 0x7E,
-  0x7E, 0xB5, 0xF0, 0xF7, 0x73, 0x27, 0x2A, 0x2F, 0x8B, 0xF1, 0x8D, 0xA1, 0x86, 0x87, 0x3B, 0x76, 0x7D, 0x6A, 0x5F, 0xA6,
-  0x28, 0x28, 0x28, 0x2F, 0x8B, 0xF1, 0xF0, 0xF3, 0x5E, 0x53, 0xB5, 0xF0, 0x96, 0x73, 0x2B, 0x27, 0x28, 0xF7, 0xF2, 0xF8,
-  0x7E, 0xF8, 0xF2, 0xB0, 0x61, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0x87, 0xAB, 0x85, 0xBF,
-  0xBC, 0x92, 0x2F, 0x29, 0x2F, 0x2E, 0x8B, 0xAA, 0xF0, 0x9D, 0xF4, 0xF0, 0x96, 0x63, 0x2B, 0x26, 0x2B, 0x29, 0x28, 0xF7,
-  0xF2, 0xB5, 0xF2, 0xB6, 0xD9, 0x6E, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x16, 0x00, 0x00, 0x00, 0x56, 0x71,
-  0x5F, 0x5F, 0x78, 0x92, 0x2F, 0x2F, 0x2F, 0x2E, 0x2E, 0x78, 0xF9, 0xF0, 0xA0, 0x30, 0x26, 0x2B, 0x2B, 0x2B, 0x28, 0x92,
-  0xA6, 0xF9, 0xF0, 0xF7, 0x6E, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x30, 0x84, 0x7D, 0xBE, 0x7B, 0x3F, 0x00, 0x00, 0x00, 0x3B,
-  0xAE, 0x85, 0x6A, 0x84, 0x28, 0x2E, 0x2E, 0x2F, 0x2F, 0x2F, 0x90, 0xE4, 0xFD, 0x19, 0x1E, 0x2B, 0x2B, 0x26, 0x2B, 0x2A,
-  0x2F, 0x92, 0x78, 0xF6, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xC2, 0x85, 0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x91, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B,
-  0x2A, 0x2F, 0x2E, 0x2E, 0x8B, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B,
-  0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 0x6E, 0x66, 0x7F, 0x8F, 0x8C, 0x7B, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x18, 0x1B, 0x25, 0x26, 0x2B, 0x2B,
-  0x2B, 0x2B, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 0x26, 0x2B,
-  0x2B, 0x26, 0x2B, 0x27, 0x28, 0x2E, 0x2E, 0x2E, 0x8B, 0x8B, 0xFB, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90,
-  0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x8B, 0xA6, 0x93, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x40, 0xAE, 0x89, 0x7A, 0x8D, 0x5F, 0x7F, 0x6B, 0xFB,
-  0x74, 0x90, 0x90, 0x90, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xC1, 0xC8, 0x40, 0x3B, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x56, 0xAB, 0x8F, 0x7A, 0x84, 0x8D,
-  0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x87, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3B, 0x56, 0x72, 0x6B,
-  0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x3B, 0x3B, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x87, 0x41, 0x72, 0xAB, 0xC2, 0xCA, 0xCA, 0xCA, 0xC3, 0xAB, 0xC8, 0x4F, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-  0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x82, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
-  0x46, 0x55, 0xFA, 0x8F, 0x8F, 0x79, 0xC9, 0xC9, 0xC9, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x82, 0x43, 0x41, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x56,
-  0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0xCD, 0xCD, 0xCD, 0xCD, 0xCD, 0xC9, 0xC9, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xAB,
-  0xC9, 0xBE, 0x99, 0xC9, 0xC9, 0xB3, 0x5B, 0x5B, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCF, 0xC6, 0x5C, 0xC9, 0xA1, 0x79, 0xC2,
-  0x75, 0xCC, 0x40, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x81, 0x6F,
-  0x8C, 0x8C, 0xC1, 0xCD, 0xD3, 0xD1, 0x91, 0x18, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x88, 0x79,
-  0xC9, 0x79, 0xFA, 0x4E, 0x46, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x76, 0xCD,
-  0xD2, 0xBE, 0xCD, 0xD3, 0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x35, 0x35, 0x35, 0x0B, 0x15, 0x15, 0x12,
-  0x14, 0xC6, 0xC9, 0x89, 0x80, 0xED, 0x6C, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x76, 0xD2,
-  0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x18, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06,
-  0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7B, 0xBC,
-  0xD2, 0xBE, 0x5C, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E,
-  0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xA9,
-  0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04,
-  0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0xFA, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x58,
-  0xD4, 0xD2, 0xCD, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A,
-  0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x64, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x87, 0x00, 0x00, 0x00, 0x00, 0x7B,
-  0xD4, 0xD4, 0x99, 0xEE, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x19, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D,
-  0x07, 0x08, 0x05, 0x13, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x3B, 0x00, 0x00, 0x87,
-  0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0xB6, 0xB9, 0x91, 0x2D, 0x14, 0x1D, 0x35,
-  0x0C, 0x05, 0x04, 0x0A, 0xAF, 0xDB, 0x6E, 0x18, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x00, 0x00, 0x3B,
-  0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x7B, 0x9F, 0xF2, 0xF0, 0xDB, 0x31, 0x1C, 0x35,
-  0x14, 0x0B, 0x08, 0x05, 0xB6, 0xF0, 0xF0, 0xBB, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00,
-  0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0xD7, 0x9D, 0xF2, 0xF8, 0xF5, 0xF0, 0xDB, 0x17,
-  0x1D, 0x35, 0x15, 0x04, 0xDA, 0xF0, 0x5E, 0xF5, 0xF0, 0xDD, 0xFE, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8,
-  0x3F, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x83, 0xF0, 0x9D, 0x7E, 0x7E, 0x7E, 0xF3, 0xF0,
-  0xEE, 0x7C, 0x1D, 0x06, 0xE9, 0xF0, 0xF8, 0x7E, 0x53, 0xF5, 0xF2, 0xFD, 0xEE, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x71, 0x89,
-  0xCA, 0x87, 0x7B, 0x93, 0xD2, 0xBC, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0x6E, 0xBB, 0xF0, 0xF5, 0x53, 0x7E, 0x7E, 0x7E,
-  0xAF, 0xF9, 0x35, 0x0C, 0xDC, 0xF0, 0xB5, 0x53, 0x7E, 0x7E, 0x5E, 0xF0, 0xB6, 0xEE, 0x18, 0x32, 0x30, 0x1E, 0x91, 0xC0,
-  0x7D, 0xA1, 0x76, 0x08, 0x93, 0xBE, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x6E, 0xB7, 0xF0, 0xF4, 0x53, 0x7E,
-  0x7E, 0x5E, 0xF2, 0xB6, 0xDC, 0xF0, 0xB5, 0x53, 0x7E, 0x53, 0x5E, 0xF2, 0xB6, 0x6E, 0x6E, 0x19, 0x36, 0x25, 0x20, 0xD1,
-  0xA9, 0x85, 0xA1, 0xC8, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x32, 0xFD, 0xF0, 0xB5,
-  0x7E, 0x7E, 0x53, 0xF8, 0xF0, 0xF0, 0xF5, 0x7E, 0x7E, 0x7E, 0x5E, 0x9D, 0xF9, 0xEE, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20,
-  0x64, 0xD3, 0xBA, 0x89, 0xBD, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0x30, 0x22, 0x22, 0xFF, 0xA0,
-  0xF0, 0xF8, 0x53, 0x7E, 0x7E, 0xF8, 0xF5, 0x53, 0x7E, 0x7E, 0x7E, 0xF3, 0xF9, 0x5B, 0x91, 0x1A, 0x1B, 0x1B, 0x33, 0x1E,
-  0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 0x1E,
-  0x22, 0xA0, 0xF2, 0xF8, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xF3, 0xF0, 0xDB, 0x91, 0x32, 0x32, 0x32, 0x32, 0x22,
-  0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x30, 0x30, 0x22,
-  0x30, 0x30, 0x64, 0xF9, 0xF2, 0x5E, 0x7E, 0x7E, 0x7E, 0x7E, 0x53, 0xF4, 0xF0, 0xAC, 0x64, 0x22, 0x22, 0x22, 0x30, 0x22,
-  0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0xD3, 0xD4, 0xC9, 0x21, 0x1E, 0x1E, 0x22, 0x36, 0x36, 0x36, 0x36, 0x32,
-  0x32, 0x1B, 0x1B, 0x1B, 0x5B, 0xF0, 0xF3, 0x7E, 0x7E, 0x7E, 0x7E, 0xB5, 0xF0, 0xB9, 0x64, 0x30, 0x30, 0x30, 0x30, 0x30,
-  0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38, 0x1B, 0x1B, 0x1B, 0x1A,
-  0x1A, 0x1A, 0x19, 0x18, 0x31, 0xA0, 0xF2, 0x5E, 0x53, 0x7E, 0x7E, 0x7E, 0x4C, 0xF3, 0xF0, 0x5B, 0x33, 0x38, 0x22, 0x22,
-  0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A,
-  0x19, 0x18, 0x31, 0x31, 0x2D, 0xA0, 0xF0, 0xF8, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x7E, 0x7E, 0xF3, 0xF9, 0x5B, 0x1B, 0x32,
-  0x33, 0x38, 0x22, 0x1E, 0x26, 0x2B, 0x1E, 0xD3, 0x54, 0x71, 0x66, 0x06, 0xB4, 0xA1, 0xD0, 0x64, 0x30, 0x38, 0x1B, 0x18,
-  0x31, 0x31, 0x2D, 0x2D, 0x6E, 0xDD, 0xF0, 0xB5, 0x53, 0x7E, 0x7E, 0xF8, 0xF4, 0x53, 0x7E, 0x7E, 0x7E, 0xAF, 0xAF, 0xEE,
-  0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x7B, 0x93, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B,
-  0x18, 0x2D, 0x2D, 0x2D, 0x6E, 0xFD, 0xF0, 0xB5, 0x53, 0x7E, 0x53, 0x5E, 0xF0, 0xF0, 0xF4, 0x7E, 0x7E, 0x7E, 0x5E, 0xF2,
-  0xB6, 0x17, 0x2C, 0x18, 0x32, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22,
-  0x32, 0x19, 0x31, 0x31, 0x6E, 0xBB, 0xF0, 0xF5, 0x7E, 0x7E, 0x7E, 0x5E, 0xF2, 0xB6, 0x97, 0xF0, 0xB5, 0x53, 0x7E, 0x7E,
-  0xF8, 0xF0, 0xE6, 0x7C, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0x87, 0xCF, 0xD4, 0x7A, 0xB3, 0x91,
-  0x30, 0x33, 0x1B, 0x19, 0x18, 0xBB, 0xF0, 0xF4, 0x7E, 0x7E, 0x7E, 0x53, 0xF3, 0xAF, 0x35, 0x17, 0xFD, 0xF0, 0xB5, 0x7E,
-  0x7E, 0x7E, 0xF8, 0xF2, 0xE6, 0x35, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x3B, 0x11, 0xB4, 0xA1, 0x8F,
-  0x32, 0x6D, 0x30, 0x38, 0x1B, 0x1A, 0xB7, 0xF0, 0xF3, 0x7E, 0x7E, 0x7E, 0xF3, 0xAF, 0xD9, 0x1D, 0x24, 0xEE, 0xA0, 0xF2,
-  0xF8, 0x7E, 0x7E, 0xB5, 0xF0, 0xDA, 0x1D, 0x18, 0x25, 0x91, 0x1D, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 0x87, 0xC6, 0xBE,
-  0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x91, 0xDB, 0xF0, 0x9D, 0x7E, 0xF5, 0xF0, 0xEA, 0x35, 0x1D, 0x14, 0x2C, 0x18,
-  0xA0, 0xF2, 0x5E, 0xF5, 0xF0, 0xDC, 0x34, 0x7C, 0x1A, 0x36, 0x34, 0xED, 0x7E, 0x54, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x7B,
-  0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x1E, 0x1E, 0x22, 0x32, 0x1A, 0xEE, 0xAF, 0xF0, 0xF0, 0xEA, 0x7C, 0x35, 0x1D, 0x14, 0x23,
-  0x18, 0x19, 0xF9, 0xF0, 0xF0, 0xDC, 0x04, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x3B, 0x00, 0x00, 0x00,
-  0x3F, 0x88, 0xBE, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x1E, 0x22, 0x32, 0x17, 0xD6, 0xAF, 0xDC, 0x12, 0x1D, 0x35, 0x1D, 0x14,
-  0x17, 0x31, 0x91, 0x5B, 0xF9, 0xBB, 0x7C, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4, 0x87, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x87, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x1E, 0x36, 0x1C, 0x0A, 0x05, 0x07, 0x0C, 0x1D, 0x35, 0x1D,
-  0x14, 0x17, 0x2D, 0x19, 0x1B, 0x65, 0x6E, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x8E, 0x4B, 0x53, 0x75, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3B, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24,
-  0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x32, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x56, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xC1, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C,
-  0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x18, 0x11, 0x4F, 0x8E, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x18, 0x32, 0x38,
-  0x36, 0x32, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 0x12, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x41, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 0x0E, 0x12,
-  0x24, 0x6E, 0x19, 0x18, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x8E, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x81, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D,
-  0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 0x8E, 0x48, 0x47, 0x68, 0x53, 0xCC, 0x40, 0x3F, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54,
-  0x7E, 0x53, 0x4B, 0x47, 0x47, 0x47, 0x48, 0x49, 0x48, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x16, 0x56, 0xA4,
-  0x84, 0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x4B, 0x4B, 0x4B, 0x4B, 0x4C, 0x53, 0x4D, 0xCC, 0x41, 0x00, 0x3F, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0x87, 0x4F, 0xA4, 0xED, 0x75, 0x94, 0x94, 0x94, 0x4D, 0xCE, 0xCB, 0x41, 0x87, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  /*Sprite runs*/
+  0x0D, 0x8C, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x03, 
+  0x06, 0x07, 0x06, 0x05, 0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x0A, 0x08, 0x8A, 
+  0x01, 0x0D, 0x07, 0x07, 0x0E, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x87, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 
+  0x15, 0x02, 0x09, 0x07, 0x8B, 0x10, 0x06, 0x06, 0x11, 0x02, 0x16, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x42, 0x1B, 0x89, 
+  0x19, 0x1C, 0x15, 0x08, 0x07, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x07, 0x06, 0x87, 0x0F, 0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 
+  0x1E, 0x43, 0x1F, 0x43, 0x20, 0x8A, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x06, 0x04, 0x9D, 
+  0x09, 0x04, 0x15, 0x0E, 0x10, 0x0F, 0x14, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 
+  0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 0x0B, 0x0C, 0x14, 0x17, 0x11, 0x05, 0x04, 0x9E, 0x08, 0x0A, 0x0E, 0x0D, 0x11, 0x2C, 0x1E, 
+  0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x19, 0x1A, 0x30, 0x2B, 0x1F, 0x1D, 
+  0x0C, 0x14, 0x2C, 0x03, 0x04, 0x03, 0x88, 0x11, 0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A, 0x42, 0x2E, 0x94, 0x2B, 
+  0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 
+  0x03, 0x02, 0xA2, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 
+  0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x02, 0x01, 
+  0x99, 0x01, 0x12, 0x15, 0x11, 0x05, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 
+  0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30, 0x26, 0x42, 0x2F, 0x42, 0x29, 0x84, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x01, 0x01, 0x9A, 
+  0x04, 0x0B, 0x34, 0x05, 0x2C, 0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 
+  0x1F, 0x22, 0x1A, 0x32, 0x1F, 0x29, 0x28, 0x42, 0x2F, 0x86, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x01, 0x00, 0x99, 
+  0x01, 0x1D, 0x0A, 0x08, 0x19, 0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x33, 0x26, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 
+  0x26, 0x1F, 0x36, 0x19, 0x1E, 0x2A, 0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x01, 0x00, 0x98, 0x06, 0x13, 
+  0x06, 0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x2C, 0x30, 0x27, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x20, 
+  0x1A, 0x36, 0x2B, 0x46, 0x2F, 0x86, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x99, 0x01, 0x13, 0x12, 0x34, 0x20, 
+  0x27, 0x28, 0x27, 0x26, 0x38, 0x30, 0x1A, 0x23, 0x1C, 0x31, 0x1F, 0x2E, 0x39, 0x2E, 0x2A, 0x2B, 0x2B, 0x1E, 0x1A, 0x1F, 
+  0x2E, 0x44, 0x37, 0x89, 0x2E, 0x2F, 0x29, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x84, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 
+  0x42, 0x2F, 0x90, 0x26, 0x27, 0x13, 0x13, 0x0B, 0x0A, 0x0A, 0x0C, 0x14, 0x24, 0x24, 0x14, 0x1D, 0x1D, 0x0C, 0x0C, 0x14, 
+  0x44, 0x24, 0x8A, 0x14, 0x26, 0x2F, 0x29, 0x29, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x8B, 0x08, 0x1D, 0x07, 0x38, 0x2F, 
+  0x37, 0x2E, 0x2F, 0x27, 0x39, 0x0E, 0x11, 0x51, 0x03, 0x81, 0x08, 0x21, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 0x36, 0x03, 
+  0x8B, 0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x29, 0x2E, 0x3A, 0x04, 0x10, 0x50, 0x16, 0x8B, 0x09, 0x34, 0x20, 0x2E, 
+  0x2E, 0x2F, 0x2F, 0x37, 0x21, 0x35, 0x19, 0x0A, 0x8B, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x39, 0x2F, 0x39, 0x3A, 0x04, 
+  0x10, 0x50, 0x16, 0x84, 0x09, 0x34, 0x20, 0x2E, 0x37, 0x42, 0x2E, 0x83, 0x2F, 0x1D, 0x2D, 0x1C, 0x83, 0x17, 0x0C, 0x1D, 
+  0x2E, 0x42, 0x39, 0x84, 0x2E, 0x39, 0x3A, 0x0E, 0x11, 0x51, 0x03, 0x8A, 0x08, 0x20, 0x2E, 0x39, 0x2E, 0x37, 0x37, 0x39, 
+  0x1D, 0x23, 0x19, 0x82, 0x1C, 0x0C, 0x24, 0x43, 0x39, 0x83, 0x37, 0x39, 0x3A, 0x14, 0x46, 0x1C, 0x84, 0x24, 0x0C, 0x35, 
+  0x14, 0x14, 0x46, 0x24, 0x8A, 0x14, 0x2B, 0x37, 0x39, 0x37, 0x39, 0x37, 0x39, 0x1C, 0x2C, 0x1A, 0x82, 0x17, 0x0C, 0x23, 
+  0x43, 0x39, 0x82, 0x37, 0x39, 0x39, 0x46, 0x3A, 0x83, 0x39, 0x39, 0x2F, 0x2B, 0x43, 0x39, 0x42, 0x3A, 0x82, 0x39, 0x39, 
+  0x3A, 0x45, 0x39, 0x83, 0x3A, 0x23, 0x23, 0x1B, 0x87, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x43, 0x39, 0x42, 
+  0x37, 0x87, 0x2E, 0x2E, 0x2F, 0x29, 0x26, 0x26, 0x33, 0x29, 0x4D, 0x39, 0x83, 0x3A, 0x1C, 0x2C, 0x1B, 0x86, 0x23, 0x13, 
+  0x14, 0x2E, 0x37, 0x2E, 0x37, 0x42, 0x2E, 0x80, 0x2B, 0x43, 0x20, 0x8B, 0x1F, 0x29, 0x29, 0x26, 0x19, 0x1E, 0x32, 0x1C, 
+  0x1F, 0x2F, 0x37, 0x2B, 0x43, 0x1F, 0x80, 0x2E, 0x44, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x24, 0x1D, 0x14, 0x29, 
+  0x44, 0x2E, 0x96, 0x39, 0x14, 0x08, 0x34, 0x34, 0x08, 0x14, 0x2E, 0x37, 0x14, 0x08, 0x34, 0x34, 0x08, 0x14, 0x30, 0x2A, 
+  0x14, 0x08, 0x34, 0x34, 0x04, 0x1F, 0x45, 0x39, 0x82, 0x35, 0x19, 0x31, 0x9F, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 
+  0x2E, 0x2F, 0x2E, 0x24, 0x03, 0x09, 0x09, 0x03, 0x24, 0x39, 0x29, 0x0C, 0x03, 0x09, 0x09, 0x34, 0x24, 0x1C, 0x33, 0x1D, 
+  0x03, 0x09, 0x09, 0x34, 0x1F, 0x44, 0x39, 0x83, 0x1F, 0x24, 0x36, 0x0A, 0x84, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x44, 0x2F, 
+  0x95, 0x14, 0x03, 0x16, 0x16, 0x03, 0x24, 0x2E, 0x21, 0x12, 0x03, 0x16, 0x09, 0x34, 0x38, 0x2C, 0x1C, 0x12, 0x03, 0x16, 
+  0x09, 0x34, 0x20, 0x42, 0x37, 0x85, 0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0xA8, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x29, 
+  0x28, 0x2F, 0x2F, 0x14, 0x11, 0x10, 0x10, 0x11, 0x24, 0x27, 0x1B, 0x0C, 0x11, 0x10, 0x10, 0x08, 0x20, 0x21, 0x23, 0x15, 
+  0x11, 0x10, 0x10, 0x34, 0x20, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x9A, 0x01, 0x1C, 0x14, 0x13, 0x2A, 
+  0x2F, 0x29, 0x2A, 0x29, 0x2E, 0x1D, 0x0E, 0x04, 0x04, 0x0E, 0x1D, 0x1E, 0x1B, 0x0B, 0x0E, 0x04, 0x04, 0x11, 0x20, 0x27, 
+  0x38, 0x15, 0x42, 0x08, 0x8A, 0x0E, 0x30, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x89, 0x3B, 0x0A, 0x23, 
+  0x1D, 0x2D, 0x29, 0x2F, 0x28, 0x28, 0x2F, 0x44, 0x39, 0x98, 0x26, 0x1A, 0x1B, 0x1F, 0x2A, 0x27, 0x2E, 0x39, 0x37, 0x2F, 
+  0x26, 0x1B, 0x1C, 0x1C, 0x18, 0x22, 0x25, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x01, 0xA4, 0x2D, 0x24, 
+  0x1D, 0x2B, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x38, 0x19, 0x38, 0x1F, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 
+  0x2E, 0x28, 0x20, 0x18, 0x14, 0x17, 0x2D, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x01, 0x00, 0x86, 0x3B, 0x06, 
+  0x23, 0x35, 0x31, 0x2E, 0x2E, 0x42, 0x2F, 0x9B, 0x2E, 0x2F, 0x2A, 0x20, 0x1A, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 
+  0x2F, 0x2E, 0x2E, 0x27, 0x30, 0x31, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x01, 0x01, 0x86, 0x01, 
+  0x24, 0x17, 0x1D, 0x1B, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 
+  0x2F, 0x2E, 0x2F, 0x2B, 0x33, 0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x01, 0x02, 0x94, 0x0F, 0x2D, 
+  0x1C, 0x35, 0x20, 0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x42, 
+  0x2E, 0x8A, 0x2A, 0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x02, 0x02, 0xA1, 0x3B, 0x0E, 0x2D, 0x1C, 
+  0x14, 0x30, 0x2E, 0x2E, 0x29, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 
+  0x2F, 0x2B, 0x21, 0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x03, 0x04, 0x91, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 
+  0x21, 0x1B, 0x19, 0x36, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x42, 0x2F, 0x89, 0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 
+  0x14, 0x2D, 0x32, 0x0D, 0x04, 0x05, 0x9C, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 
+  0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x05, 0x06, 0x9A, 0x04, 
+  0x23, 0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 
+  0x1C, 0x13, 0x24, 0x1A, 0x2D, 0x10, 0x06, 0x07, 0x98, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27, 
+  0x27, 0x2B, 0x2B, 0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x07, 0x08, 0x96, 0x09, 0x11, 0x14, 
+  0x18, 0x2D, 0x17, 0x14, 0x1D, 0x0C, 0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 
+  0x08, 0x0A, 0x91, 0x01, 0x0F, 0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 
+  0x0D, 0x0B, 0x0C, 0x8D, 0x3B, 0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x0D, 0x0D, 
+  0x8C, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x10, 0x07, 
+  0x1D, 0x23, 0x31, 0x19, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x0A, 0x09, 0x87, 0x0D, 
+  0x0A, 0x19, 0x32, 0x36, 0x36, 0x1B, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x09, 0x07, 0x97, 
+  0x3B, 0x0B, 0x19, 0x38, 0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A, 
+  0x31, 0x1C, 0x12, 0x04, 0x08, 0x06, 0x9A, 0x02, 0x2C, 0x22, 0x22, 0x32, 0x1B, 0x33, 0x33, 0x1B, 0x19, 0x2C, 0x1C, 0x35, 
+  0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31, 0x1D, 0x15, 0x02, 0x06, 0x05, 0x8E, 0x03, 0x1B, 0x30, 
+  0x38, 0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x1D, 0x8A, 0x0B, 0x15, 0x15, 0x12, 0x14, 
+  0x31, 0x1A, 0x18, 0x17, 0x0B, 0x0F, 0x05, 0x04, 0x9E, 0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23, 0x19, 0x31, 0x23, 
+  0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 
+  0x04, 0x03, 0xA0, 0x0D, 0x33, 0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 
+  0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x03, 0x02, 0xA2, 0x3B, 
+  0x1B, 0x21, 0x22, 0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 
+  0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x01, 0xA4, 0x3B, 0x14, 0x20, 
+  0x25, 0x1A, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 
+  0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x21, 
+  0x36, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 
+  0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x01, 0x00, 0xA5, 0x09, 0x17, 0x1F, 
+  0x22, 0x32, 0x23, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 
+  0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x01, 0x00, 0xA6, 0x03, 0x2B, 
+  0x21, 0x33, 0x33, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 
+  0x08, 0x05, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0xA8, 0x09, 
+  0x17, 0x1F, 0x22, 0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x15, 0x2C, 0x1A, 0x19, 0x1C, 0x1D, 
+  0x1D, 0x15, 0x08, 0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 
+  0xA8, 0x10, 0x25, 0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x1D, 0x0A, 0x06, 0x0E, 0x0D, 0x11, 0x0C, 0x31, 0x2D, 
+  0x1C, 0x1D, 0x13, 0x05, 0x05, 0x24, 0x2C, 0x2D, 0x2D, 0x2C, 0x23, 0x17, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 
+  0x23, 0x09, 0x90, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x19, 0x0B, 0x05, 0x05, 0x34, 0x08, 0x08, 0x05, 
+  0x42, 0x06, 0x83, 0x05, 0x05, 0x34, 0x05, 0x45, 0x06, 0x8A, 0x05, 0x1C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A, 
+  0x0F, 0x8B, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x36, 0x0B, 0x0E, 0x51, 0x0D, 0x8A, 0x34, 0x1C, 0x19, 
+  0x36, 0x25, 0x20, 0x33, 0x19, 0x23, 0x1A, 0x05, 0x8B, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x22, 0x0C, 
+  0x03, 0x50, 0x16, 0x8B, 0x09, 0x34, 0x23, 0x1A, 0x36, 0x1E, 0x20, 0x25, 0x32, 0x1C, 0x19, 0x13, 0x8B, 0x2C, 0x1F, 0x36, 
+  0x1F, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x1E, 0x13, 0x11, 0x50, 0x01, 0x8B, 0x16, 0x34, 0x2C, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 
+  0x33, 0x24, 0x18, 0x1C, 0x8A, 0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x21, 0x0C, 0x52, 0x04, 0x8A, 0x08, 
+  0x2D, 0x36, 0x22, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x8A, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 
+  0x25, 0x19, 0x45, 0x23, 0x84, 0x17, 0x1C, 0x1C, 0x0C, 0x14, 0x48, 0x23, 0x89, 0x33, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 
+  0x1C, 0x2D, 0x23, 0x82, 0x1B, 0x21, 0x1B, 0x42, 0x21, 0x80, 0x22, 0x44, 0x36, 0x8C, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x19, 
+  0x31, 0x17, 0x13, 0x07, 0x1C, 0x32, 0x22, 0x46, 0x30, 0x88, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x82, 
+  0x18, 0x20, 0x1B, 0x42, 0x25, 0x80, 0x38, 0x44, 0x1B, 0x9C, 0x1A, 0x1A, 0x19, 0x31, 0x2D, 0x31, 0x18, 0x15, 0x14, 0x17, 
+  0x03, 0x12, 0x23, 0x1A, 0x36, 0x38, 0x22, 0x22, 0x30, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x24, 0xA8, 
+  0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x2C, 0x07, 0x15, 0x07, 0x07, 0x13, 0x18, 0x1A, 0x0C, 0x34, 
+  0x06, 0x15, 0x34, 0x11, 0x05, 0x1D, 0x0C, 0x15, 0x15, 0x0A, 0x15, 0x1A, 0x22, 0x21, 0x26, 0x2B, 0x21, 0x36, 0x35, 0x2C, 
+  0x1D, 0xA8, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x1C, 0x08, 0x0E, 0x0E, 0x08, 0x0B, 0x1A, 0x2D, 
+  0x06, 0x08, 0x0E, 0x0E, 0x08, 0x08, 0x0D, 0x08, 0x05, 0x08, 0x0E, 0x0E, 0x08, 0x2D, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 
+  0x14, 0x2D, 0x34, 0xA8, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0x1C, 0x34, 0x09, 0x3B, 0x03, 0x0B, 
+  0x1A, 0x0B, 0x08, 0x11, 0x3B, 0x3B, 0x03, 0x15, 0x08, 0x0D, 0x04, 0x11, 0x3B, 0x09, 0x34, 0x17, 0x36, 0x1E, 0x26, 0x26, 
+  0x1A, 0x14, 0x24, 0x31, 0x0F, 0x98, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19, 0x31, 0x1C, 0x34, 0x09, 0x3B, 
+  0x03, 0x0B, 0x17, 0x34, 0x34, 0x11, 0x3B, 0x3B, 0x03, 0x0B, 0x13, 0x42, 0x11, 0x8C, 0x3B, 0x09, 0x34, 0x24, 0x1B, 0x1E, 
+  0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0xA8, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x17, 0x08, 
+  0x0E, 0x0E, 0x08, 0x12, 0x12, 0x08, 0x05, 0x08, 0x0E, 0x0E, 0x08, 0x0B, 0x31, 0x0A, 0x08, 0x08, 0x0E, 0x0E, 0x34, 0x13, 
+  0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x00, 0x91, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 0x1B, 
+  0x2C, 0x07, 0x15, 0x15, 0x07, 0x15, 0x05, 0x05, 0x07, 0x42, 0x06, 0x91, 0x07, 0x13, 0x1B, 0x24, 0x06, 0x08, 0x04, 0x04, 
+  0x34, 0x0C, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0xA5, 0x09, 0x31, 0x30, 0x31, 0x1A, 0x32, 0x25, 
+  0x25, 0x22, 0x32, 0x1B, 0x19, 0x19, 0x23, 0x15, 0x08, 0x06, 0x13, 0x35, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 
+  0x0F, 0x0D, 0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x1B, 0x2C, 0x32, 0x36, 
+  0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 
+  0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x01, 0x02, 0xA3, 0x1C, 0x30, 0x31, 0x2C, 0x32, 0x33, 
+  0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 
+  0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 0x3B, 0x01, 0x02, 0xA2, 0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 
+  0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 
+  0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x02, 0x03, 0xA0, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 
+  0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 
+  0x0A, 0x0C, 0x35, 0x02, 0x03, 0x03, 0x9F, 0x3B, 0x04, 0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 
+  0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x04, 
+  0x04, 0x9D, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 
+  0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x05, 0x06, 0x9A, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 
+  0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 
+  0x12, 0x10, 0x06, 0x07, 0x8B, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x42, 0x05, 0x89, 
+  0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x07, 0x08, 0x8B, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x1D, 0x13, 
+  0x0C, 0x12, 0x0A, 0x0A, 0x15, 0x42, 0x07, 0x87, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x08, 0x0B, 0x90, 0x0F, 
+  0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x0B, 0x0D, 0x8D, 0x09, 
+  0x0F, 0x05, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x41, 
+  0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 0x44, 0x47, 
+  0x48, 0x49, 0x43, 0x4A, 0x88, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x3F, 0x0A, 0x08, 0x8A, 0x3F, 0x41, 0x44, 
+  0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x43, 0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x08, 
+  0x07, 0x98, 0x3F, 0x44, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 
+  0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x3F, 0x07, 0x05, 0x8C, 0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 
+  0x63, 0x1F, 0x1F, 0x44, 0x20, 0x89, 0x64, 0x65, 0x2C, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56, 0x06, 0x04, 0x9E, 0x3F, 
+  0x6C, 0x68, 0x4A, 0x50, 0x50, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 
+  0x6E, 0x6E, 0x5B, 0x6F, 0x70, 0x4C, 0x6A, 0x71, 0x72, 0x3F, 0x04, 0x03, 0x9F, 0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x51, 0x58, 
+  0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x36, 0x19, 0x1A, 0x30, 0x73, 0x74, 
+  0x75, 0x53, 0x6A, 0x71, 0x76, 0x04, 0x03, 0x88, 0x46, 0x45, 0x49, 0x50, 0x57, 0x0A, 0x6E, 0x21, 0x27, 0x42, 0x2E, 0x95, 
+  0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 
+  0x7B, 0x3F, 0x02, 0x02, 0x90, 0x3F, 0x4D, 0x47, 0x50, 0x57, 0x0A, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 
+  0x27, 0x2B, 0x42, 0x26, 0x8E, 0x21, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 
+  0x02, 0x01, 0xA4, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x19, 0x38, 0x26, 0x29, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 
+  0x01, 0x01, 0x9A, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x25, 0x1A, 0x1B, 0x1F, 0x29, 0x28, 0x42, 0x2F, 0x86, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 
+  0x01, 0x00, 0x99, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0x1B, 0x1F, 0x2F, 0x2E, 0x2F, 
+  0x28, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x2A, 0x45, 0x2F, 0x86, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F, 0x3F, 0x00, 
+  0x99, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x1E, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0x24, 0x17, 0x33, 0x2B, 0x2E, 0x2F, 0x29, 
+  0x27, 0x26, 0x2B, 0x20, 0x1B, 0x1B, 0x26, 0x46, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x99, 0x3F, 
+  0x75, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x64, 0x91, 0x6E, 0x24, 0x6E, 0x25, 0x92, 0x8B, 0x8B, 0x90, 0x73, 
+  0x73, 0x21, 0x1A, 0x21, 0x92, 0x43, 0x2E, 0x8A, 0x8B, 0x2F, 0x2F, 0x29, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09, 0x8F, 
+  0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x90, 0x95, 0x96, 0x96, 0x97, 0x98, 0x98, 0x97, 0x45, 0x96, 0x81, 0x97, 
+  0x97, 0x46, 0x96, 0x89, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0x99, 0x87, 0x8A, 0x4F, 0x6A, 0x68, 0x9A, 0x9B, 
+  0x37, 0x2E, 0x2E, 0x27, 0x9C, 0x9D, 0x51, 0x9E, 0x82, 0x9F, 0xA0, 0x77, 0x42, 0x2F, 0x85, 0x29, 0x8B, 0x7A, 0x5F, 0xA1, 
+  0x11, 0x8B, 0x6C, 0x54, 0x68, 0xA2, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x9C, 0x9D, 0x5E, 0x50, 0x53, 0x8B, 0x9F, 0xA0, 0x2F, 
+  0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0x8B, 0xA4, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x9C, 
+  0x9F, 0x5E, 0x50, 0x53, 0x8B, 0x9F, 0xA0, 0x8B, 0x2E, 0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C, 0x8A, 0x55, 0x5E, 
+  0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x39, 0x9C, 0x9D, 0x51, 0x9E, 0x8B, 0x9F, 0xA0, 0x8B, 0x2E, 0x39, 0x2E, 0x37, 0x37, 
+  0xA8, 0x54, 0x71, 0xA9, 0x89, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0xA8, 0xAA, 0x48, 0x96, 0x80, 0x97, 0x4A, 
+  0x96, 0x89, 0x39, 0x37, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0x83, 0xAB, 0x5E, 0x94, 0xA6, 0x42, 0x39, 0x91, 
+  0x37, 0x39, 0x39, 0xA8, 0x39, 0x39, 0xA8, 0xA8, 0x39, 0xA8, 0x39, 0xA8, 0x8B, 0x26, 0x2E, 0xA8, 0xA8, 0x39, 0x45, 0xA8, 
+  0x44, 0x39, 0x84, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x89, 0x9A, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x42, 
+  0x37, 0x89, 0x2E, 0x37, 0x2E, 0x2E, 0x2F, 0x29, 0x27, 0x20, 0x33, 0x27, 0x4D, 0x39, 0x83, 0xA8, 0x8D, 0x71, 0xA9, 0x83, 
+  0xAB, 0x54, 0x69, 0xA7, 0x44, 0x2E, 0x80, 0x37, 0x44, 0xAA, 0x8A, 0x28, 0x29, 0x78, 0xAA, 0xAC, 0x95, 0x95, 0xAD, 0x20, 
+  0x2F, 0xA6, 0x43, 0xAA, 0x80, 0x78, 0x44, 0x39, 0x84, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0x83, 0xAE, 0x6A, 0x7E, 0xA7, 0x44, 
+  0x2E, 0x81, 0xA8, 0xAF, 0x43, 0xB0, 0x83, 0x78, 0x29, 0x9C, 0xAF, 0x42, 0xB0, 0x89, 0xB1, 0x17, 0x38, 0xB2, 0xAF, 0xB0, 
+  0xB0, 0xAF, 0xA0, 0xA8, 0x43, 0x39, 0x84, 0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x9F, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E, 0x2F, 
+  0x2E, 0x2F, 0x8B, 0xAF, 0x5E, 0x53, 0xB5, 0xB6, 0x78, 0x2E, 0x9C, 0x9D, 0x7E, 0x53, 0x9F, 0xA0, 0x1B, 0x24, 0xB7, 0x9D, 
+  0x7E, 0x53, 0x9F, 0xA0, 0x8B, 0x43, 0x39, 0x84, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x9F, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 
+  0x2F, 0x29, 0x2F, 0x77, 0xAF, 0x6A, 0x7E, 0xB5, 0xB6, 0x78, 0x92, 0xB2, 0x9D, 0x5E, 0x53, 0x9F, 0xA0, 0x27, 0x6E, 0xB8, 
+  0x9F, 0x5E, 0x53, 0x9F, 0xA0, 0x8B, 0x42, 0x37, 0x85, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x85, 0x40, 0x6B, 0x6A, 0x7E, 
+  0x8B, 0x2F, 0x42, 0x29, 0x9F, 0x77, 0xAF, 0xB5, 0x5E, 0x9E, 0xB6, 0x78, 0x27, 0xB9, 0x9F, 0xBA, 0x5E, 0x9F, 0xA0, 0x8B, 
+  0x20, 0xBB, 0x9D, 0xBA, 0x5E, 0x9F, 0xA0, 0x77, 0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x8A, 0x3F, 0xBD, 
+  0x8D, 0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x8B, 0x9D, 0x42, 0xAF, 0x83, 0xB0, 0x78, 0x21, 0xB7, 0x43, 0xAF, 0x83, 0xA0, 
+  0x8B, 0x2A, 0xB9, 0x43, 0xAF, 0x8A, 0xA0, 0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0x89, 0x76, 
+  0x7D, 0x6A, 0x5F, 0x27, 0x29, 0x29, 0x28, 0x92, 0xA8, 0x43, 0x8B, 0x98, 0x2B, 0x32, 0x1A, 0x63, 0x90, 0x90, 0x77, 0x8B, 
+  0x2E, 0x2E, 0x2B, 0x65, 0x1C, 0x24, 0x6E, 0x65, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0xA5, 
+  0x87, 0xAB, 0x85, 0xBF, 0xBC, 0x92, 0x2F, 0x29, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x25, 0x19, 0x36, 0x1F, 0x2B, 0x26, 
+  0x2B, 0x29, 0x2F, 0x2E, 0x29, 0x20, 0x19, 0x1C, 0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x01, 0x01, 
+  0x85, 0x56, 0x71, 0x5F, 0x5F, 0x78, 0x92, 0x42, 0x2F, 0x87, 0x2E, 0x2E, 0x29, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x42, 0x2B, 
+  0x91, 0x29, 0x2F, 0x2E, 0x2E, 0x27, 0x25, 0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F, 0x00, 
+  0x02, 0x86, 0xAE, 0x85, 0x6A, 0x84, 0x28, 0x2E, 0x2E, 0x42, 0x2F, 0x99, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B, 0x2B, 0x26, 
+  0x2B, 0x2A, 0x2F, 0x2F, 0x37, 0x2F, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x01, 0x02, 
+  0x94, 0x3F, 0xC2, 0x85, 0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 
+  0x2A, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x02, 0x02, 0xA1, 0x3F, 
+  0x56, 0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 
+  0x2F, 0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81, 0x03, 0x03, 0x8D, 0x3F, 0x4F, 0xC0, 0x85, 
+  0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x19, 0x1B, 0x25, 0x26, 0x43, 0x2B, 0x8D, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 
+  0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76, 0x04, 0x04, 0x92, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 
+  0x38, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x42, 0x2E, 0x87, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 
+  0x05, 0x05, 0x9B, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 
+  0x2F, 0x8B, 0x8B, 0x27, 0xC7, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x06, 0x07, 0x89, 0x40, 0xA4, 0x89, 0x7A, 0x8D, 0x5F, 
+  0x7F, 0x6B, 0xC4, 0x74, 0x42, 0x90, 0x8B, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40, 0x07, 
+  0x08, 0x96, 0x3F, 0x46, 0xAB, 0x8F, 0x7A, 0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 
+  0xC0, 0xC9, 0x8A, 0x4F, 0x3F, 0x08, 0x09, 0x80, 0x3F, 0x00, 0x90, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 
+  0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x0B, 0x0C, 0x85, 0x3F, 0x87, 0x41, 0xA4, 0xAB, 0xC2, 0x42, 0xCA, 0x85, 
+  0xC3, 0xAB, 0x72, 0x4F, 0x87, 0x3F, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 
+  0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x86, 0x87, 0x46, 0x55, 0xAB, 0x8F, 0x8F, 0x79, 0x42, 0xC9, 0x88, 0x79, 
+  0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x0A, 0x08, 0x87, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0x44, 
+  0xCD, 0x43, 0xC9, 0x84, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x09, 0x07, 0x99, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xC4, 
+  0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0xA9, 0xC9, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x40, 0x3F, 0x06, 0x06, 
+  0x9B, 0x81, 0x6F, 0x8C, 0x8C, 0xBE, 0xCD, 0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 
+  0x7C, 0x88, 0x79, 0xC9, 0x79, 0xC2, 0x4E, 0x46, 0x3F, 0x05, 0x05, 0x8E, 0x76, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 
+  0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x1D, 0x8B, 0x0B, 0x15, 0x15, 0x0A, 0x35, 0xC6, 0xC9, 0x89, 0x80, 0x75, 
+  0x6C, 0x3F, 0x04, 0x04, 0x9E, 0x76, 0xD2, 0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 
+  0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x04, 0x03, 0xA0, 0x7B, 
+  0xBC, 0xD2, 0x8C, 0x5C, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 
+  0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x03, 0x02, 0xA2, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 
+  0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 
+  0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0x9A, 0x40, 0x02, 0x01, 0xA4, 0x3F, 0x58, 0xD4, 0xD2, 0xA9, 0x35, 0x08, 
+  0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 
+  0x1B, 0x38, 0x30, 0xD1, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x3F, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0B, 0x0E, 
+  0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 
+  0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x01, 0x00, 0xA5, 0x87, 0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 
+  0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 
+  0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x01, 0x00, 0xA6, 0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 
+  0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 0x31, 
+  0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00, 0xA8, 0x09, 0x88, 0xB4, 0xBE, 0xD0, 
+  0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x15, 0x2C, 0x1A, 0x19, 0x1C, 0x1D, 0x1D, 0x15, 0x08, 0x12, 
+  0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8, 0x3F, 0x9A, 0x81, 0xA2, 0xD5, 
+  0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0xD6, 0x07, 0xD7, 0x7B, 0xD7, 0xD8, 0x5B, 0x5B, 0xCF, 0xD9, 0xD8, 0x07, 
+  0x06, 0xD9, 0xCF, 0x5B, 0x43, 0xCF, 0x89, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x71, 0x89, 0xCA, 0x87, 0x8A, 0x7B, 0xB4, 
+  0xD2, 0xD4, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0xAD, 0x43, 0xB6, 0x80, 0xDA, 0x4E, 0xB6, 0x89, 0x97, 0x6E, 0x32, 0x30, 
+  0x1E, 0x65, 0xC0, 0x7D, 0xA1, 0x76, 0x8B, 0x08, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0xDB, 0xB0, 0x51, 
+  0xB5, 0x8A, 0x9F, 0x97, 0x91, 0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8, 0x8C, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 
+  0x1E, 0x32, 0x38, 0x38, 0xAC, 0xB0, 0x53, 0x4F, 0x7E, 0x8B, 0x53, 0x9E, 0x97, 0x91, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 
+  0x89, 0xBD, 0x8C, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x30, 0x30, 0xAC, 0xB0, 0x7E, 0x50, 0x5E, 0x8A, 0x9E, 
+  0x97, 0x91, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0x8C, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x30, 0x25, 
+  0x1E, 0xAC, 0xAF, 0x9D, 0x44, 0x9F, 0x43, 0x9D, 0x47, 0x9F, 0x8A, 0x9D, 0x97, 0x65, 0x22, 0x20, 0x1F, 0x63, 0x64, 0x5F, 
+  0x7A, 0xCA, 0x8A, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x6D, 0x47, 0xB9, 0x82, 0xB7, 0xB8, 0xB7, 
+  0x48, 0xB9, 0x89, 0xAC, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0x82, 0xD3, 0xD4, 0xC9, 0x42, 0x21, 0x80, 
+  0x22, 0x44, 0x36, 0x8F, 0x32, 0x1B, 0x65, 0x91, 0x1A, 0x19, 0x6E, 0x17, 0x13, 0x07, 0x1C, 0x65, 0x38, 0x30, 0x30, 0x64, 
+  0x42, 0x30, 0x89, 0x64, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0x86, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 
+  0x38, 0x42, 0x1B, 0x90, 0x91, 0x1A, 0x1A, 0x6E, 0x19, 0x6E, 0x2D, 0x31, 0x31, 0x0A, 0x7C, 0x17, 0x03, 0x12, 0x23, 0x1A, 
+  0x36, 0x42, 0xD1, 0x8A, 0x64, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0x8B, 0xD9, 0xD5, 0xC9, 0x61, 
+  0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x97, 0x43, 0xB1, 0x8B, 0x6E, 0x19, 0xD9, 0xDA, 0xB1, 0xB1, 0xDA, 0xDC, 0x05, 
+  0x1D, 0xAD, 0xB1, 0x42, 0xA0, 0x89, 0xB9, 0x64, 0x21, 0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 0x66, 0x8B, 0x06, 0xD5, 0xA1, 
+  0xD0, 0xD1, 0x30, 0x38, 0x1B, 0x19, 0x31, 0xCF, 0xB6, 0x42, 0x9F, 0x8C, 0xAF, 0x91, 0x2D, 0xD6, 0xAF, 0x9F, 0x9F, 0xB0, 
+  0xDC, 0x02, 0x04, 0xD6, 0xAF, 0x42, 0x9F, 0x89, 0xDD, 0xD1, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0xA8, 0x7B, 
+  0xB4, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x2D, 0xCF, 0xB6, 0xB5, 0x53, 0x5E, 0xAF, 0x91, 0x0B, 0xDE, 0xB0, 0x53, 
+  0x53, 0x9E, 0x98, 0x04, 0x0D, 0xDE, 0xB0, 0x53, 0x53, 0x9E, 0x97, 0x65, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 
+  0xA8, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22, 0x32, 0x19, 0x31, 0xCF, 0xB6, 0xB5, 0x53, 0x5E, 0xAF, 0x17, 0x34, 0xD6, 
+  0xB0, 0x53, 0x53, 0x9E, 0x97, 0x7C, 0x11, 0xD7, 0xB0, 0x53, 0x53, 0x9E, 0x97, 0x91, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 
+  0x6B, 0x87, 0x8B, 0x3F, 0xCF, 0xD4, 0x7A, 0xB3, 0x65, 0x30, 0x33, 0x1B, 0x19, 0xCF, 0xB6, 0x42, 0x9F, 0x84, 0xAF, 0x12, 
+  0x08, 0xD6, 0xAF, 0x42, 0x9F, 0x84, 0x97, 0x6E, 0x0A, 0xDE, 0xAF, 0x42, 0x9F, 0x89, 0x98, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 
+  0xBF, 0x7F, 0xA4, 0x3F, 0x00, 0x8A, 0x11, 0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38, 0x1B, 0x5B, 0x97, 0x42, 0xB1, 0x83, 
+  0xB6, 0x05, 0x34, 0xD8, 0x43, 0xB1, 0x83, 0xB7, 0x91, 0x24, 0xD6, 0x43, 0xDA, 0x88, 0xDF, 0x6E, 0x25, 0x91, 0x35, 0x69, 
+  0x54, 0x8D, 0x4F, 0x00, 0x00, 0x90, 0x87, 0xC6, 0x8C, 0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x1B, 0x6E, 0x18, 0x17, 
+  0x0A, 0x08, 0x06, 0x43, 0x7C, 0x90, 0x6E, 0x19, 0x1A, 0x31, 0x13, 0x08, 0x0F, 0x0D, 0x05, 0x1D, 0x1A, 0x36, 0x05, 0x75, 
+  0x7E, 0x54, 0x9A, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 
+  0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 
+  0x7E, 0xBA, 0x4F, 0x01, 0x01, 0xA4, 0x3F, 0x88, 0x8C, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 
+  0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 
+  0x54, 0xA4, 0x3F, 0x01, 0x02, 0xA2, 0x3F, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 
+  0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x48, 0x4B, 0x53, 0x75, 
+  0x40, 0x02, 0x03, 0xA1, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 
+  0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x46, 0x3F, 0x02, 0x03, 
+  0xA0, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 
+  0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x03, 0x04, 0x9D, 0x3F, 0x76, 0xC1, 
+  0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 
+  0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x4F, 0x05, 0x06, 0x9B, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 0x0E, 0x0A, 
+  0x24, 0x6E, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 0x05, 0x06, 
+  0x9A, 0x3F, 0x40, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 
+  0x48, 0x48, 0x47, 0x68, 0x53, 0x43, 0x40, 0x3F, 0x06, 0x08, 0x88, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54, 0x53, 0x53, 0x4B, 
+  0x42, 0x47, 0x43, 0x48, 0x86, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x08, 0x0B, 0x87, 0x56, 0xA4, 0x84, 0xBA, 0x5E, 
+  0x7E, 0x53, 0x4C, 0x43, 0x4B, 0x84, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00, 0x80, 0x3F, 0x09, 0x0C, 0x85, 0x3F, 0x87, 0x4F, 
+  0xA4, 0x75, 0x75, 0x42, 0x94, 0x85, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x0C, 0x0D, 0x8C, 0x01, 0x02, 0x03, 0x04, 0x05, 
+  0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x03, 0x06, 0x07, 0x06, 0x05, 0x08, 0x04, 0x08, 
+  0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x0A, 0x08, 0x8A, 0x01, 0x0D, 0x07, 0x07, 0x0E, 0x0F, 0x02, 
+  0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x87, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x09, 0x07, 0x8B, 0x10, 0x06, 
+  0x06, 0x11, 0x02, 0x16, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x42, 0x1B, 0x89, 0x19, 0x1C, 0x15, 0x08, 0x07, 0x12, 0x1D, 
+  0x14, 0x15, 0x09, 0x07, 0x06, 0x87, 0x0F, 0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 0x1E, 0x43, 0x1F, 0x43, 0x20, 0x8A, 0x21, 
+  0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x06, 0x04, 0x9D, 0x09, 0x04, 0x15, 0x0E, 0x10, 0x0F, 0x14, 
+  0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 0x0B, 0x0C, 
+  0x14, 0x17, 0x11, 0x05, 0x04, 0x9E, 0x08, 0x0A, 0x0E, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 
+  0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x19, 0x1A, 0x30, 0x2B, 0x1F, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x04, 0x03, 0x88, 
+  0x11, 0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A, 0x42, 0x2E, 0x94, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 
+  0x22, 0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 0x03, 0x02, 0xA2, 0x0D, 0x13, 0x05, 0x03, 
+  0x08, 0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 
+  0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x02, 0x01, 0x99, 0x01, 0x12, 0x15, 0x11, 0x05, 0x13, 
+  0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30, 0x26, 
+  0x42, 0x2F, 0x42, 0x29, 0x84, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x01, 0x01, 0x9A, 0x04, 0x0B, 0x34, 0x05, 0x2C, 0x31, 0x31, 
+  0x1C, 0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32, 0x1F, 0x29, 0x28, 
+  0x42, 0x2F, 0x86, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x01, 0x00, 0x99, 0x01, 0x1D, 0x0A, 0x08, 0x19, 0x22, 0x30, 
+  0x1B, 0x31, 0x13, 0x13, 0x23, 0x33, 0x26, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x19, 0x1E, 0x2A, 0x45, 
+  0x2F, 0x85, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x01, 0x00, 0x9B, 0x06, 0x13, 0x06, 0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 
+  0x1C, 0x17, 0x13, 0x1C, 0x1B, 0x1E, 0x1F, 0x20, 0x20, 0x2B, 0x26, 0x2B, 0x1B, 0x2C, 0x2D, 0x30, 0x20, 0x20, 0x1F, 0x43, 
+  0x2F, 0x86, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x8C, 0x01, 0x13, 0x12, 0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 
+  0x38, 0x22, 0x1B, 0x04, 0x43, 0x34, 0x85, 0x08, 0x06, 0x1F, 0x26, 0x27, 0x0E, 0x43, 0x34, 0x82, 0x08, 0x06, 0x2B, 0x42, 
+  0x2F, 0x87, 0x29, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x84, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 0x42, 0x2F, 0x85, 0x26, 
+  0x2B, 0x1F, 0x20, 0x04, 0x10, 0x42, 0x09, 0x86, 0x0D, 0x07, 0x1F, 0x26, 0x2B, 0x04, 0x10, 0x42, 0x09, 0x82, 0x0D, 0x07, 
+  0x2B, 0x42, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x8D, 0x08, 0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 
+  0x2F, 0x27, 0x29, 0x2A, 0x2A, 0x04, 0x10, 0x42, 0x16, 0x81, 0x0D, 0x07, 0x42, 0x26, 0x81, 0x04, 0x10, 0x42, 0x16, 0x84, 
+  0x0D, 0x07, 0x2B, 0x29, 0x29, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 0x36, 0x03, 0x87, 0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 
+  0x39, 0x29, 0x42, 0x2E, 0x82, 0x39, 0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x07, 0x26, 0x26, 0x21, 0x04, 0x10, 0x42, 0x16, 
+  0x8D, 0x0D, 0x07, 0x2B, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 0x21, 0x35, 0x19, 0x0A, 0x87, 0x14, 0x0C, 0x0C, 0x28, 
+  0x37, 0x39, 0x39, 0x2F, 0x42, 0x39, 0x82, 0x3A, 0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x07, 0x2B, 0x26, 0x22, 0x08, 0x10, 
+  0x42, 0x16, 0x82, 0x0D, 0x07, 0x2B, 0x42, 0x2E, 0x80, 0x37, 0x42, 0x2E, 0x83, 0x2F, 0x1D, 0x2D, 0x1C, 0x83, 0x17, 0x0C, 
+  0x1D, 0x2E, 0x42, 0x39, 0x80, 0x2E, 0x42, 0x39, 0x82, 0x3A, 0x0E, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x07, 0x2B, 0x1F, 0x26, 
+  0x04, 0x10, 0x42, 0x16, 0x82, 0x0D, 0x07, 0x27, 0x42, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x1D, 0x23, 0x19, 0x82, 
+  0x1C, 0x0C, 0x24, 0x43, 0x39, 0x80, 0x37, 0x42, 0x39, 0x82, 0x3A, 0x0E, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x06, 0x36, 0x26, 
+  0x2E, 0x04, 0x10, 0x42, 0x16, 0x82, 0x0D, 0x07, 0x27, 0x42, 0x37, 0x87, 0x39, 0x37, 0x39, 0x37, 0x39, 0x1C, 0x2C, 0x1A, 
+  0x82, 0x17, 0x0C, 0x23, 0x43, 0x39, 0x80, 0x37, 0x42, 0x39, 0x82, 0x3A, 0x0E, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x15, 0x2B, 
+  0x26, 0x3A, 0x04, 0x10, 0x42, 0x16, 0x82, 0x0D, 0x15, 0x2A, 0x46, 0x39, 0x83, 0x3A, 0x23, 0x23, 0x1B, 0x87, 0x23, 0x13, 
+  0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x42, 0x39, 0x82, 0x3A, 0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x15, 0x20, 0x26, 0x30, 
+  0x08, 0x10, 0x42, 0x16, 0x82, 0x0D, 0x15, 0x28, 0x46, 0x39, 0x83, 0x3A, 0x1C, 0x2C, 0x1B, 0x86, 0x23, 0x13, 0x14, 0x2E, 
+  0x37, 0x2E, 0x37, 0x43, 0x2E, 0x82, 0x3A, 0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x07, 0x1B, 0x27, 0x26, 0x04, 0x10, 0x42, 
+  0x16, 0x82, 0x0D, 0x15, 0x2A, 0x46, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x24, 0x1D, 0x14, 0x29, 0x45, 0x2E, 0x83, 
+  0x2F, 0x39, 0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x06, 0x22, 0x2B, 0x39, 0x04, 0x10, 0x42, 0x16, 0x82, 0x0D, 0x07, 0x2A, 
+  0x47, 0x39, 0x82, 0x35, 0x19, 0x31, 0x8D, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x37, 0x04, 
+  0x10, 0x42, 0x16, 0x86, 0x0D, 0x06, 0x21, 0x2B, 0x39, 0x04, 0x10, 0x42, 0x16, 0x84, 0x0D, 0x07, 0x27, 0x2E, 0x37, 0x44, 
+  0x39, 0x83, 0x1F, 0x24, 0x36, 0x0A, 0x84, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x43, 0x2F, 0x84, 0x28, 0x28, 0x37, 0x04, 0x10, 
+  0x42, 0x16, 0x86, 0x0D, 0x07, 0x20, 0x2B, 0x39, 0x04, 0x10, 0x42, 0x16, 0x84, 0x0D, 0x07, 0x26, 0x2F, 0x2E, 0x42, 0x37, 
+  0x85, 0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0x8D, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28, 0x28, 0x39, 
+  0x04, 0x10, 0x42, 0x16, 0x86, 0x0D, 0x07, 0x20, 0x2B, 0x39, 0x04, 0x10, 0x42, 0x16, 0x8D, 0x0D, 0x07, 0x1E, 0x2B, 0x28, 
+  0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x87, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x29, 0x2A, 0x42, 0x29, 
+  0x82, 0x39, 0x04, 0x10, 0x42, 0x09, 0x86, 0x0D, 0x07, 0x20, 0x26, 0x37, 0x04, 0x10, 0x42, 0x09, 0x8D, 0x0D, 0x06, 0x1A, 
+  0x1E, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x8D, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 0x28, 
+  0x28, 0x2F, 0x2F, 0x39, 0x11, 0x08, 0x43, 0x34, 0x85, 0x06, 0x1F, 0x26, 0x2E, 0x11, 0x08, 0x43, 0x34, 0x8B, 0x05, 0x23, 
+  0x36, 0x30, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x01, 0xA4, 0x2D, 0x24, 0x1D, 0x2B, 0x2F, 0x29, 0x2F, 
+  0x2F, 0x2E, 0x37, 0x21, 0x20, 0x30, 0x31, 0x23, 0x19, 0x22, 0x26, 0x26, 0x2A, 0x21, 0x20, 0x1F, 0x21, 0x36, 0x23, 0x1D, 
+  0x1C, 0x2D, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x01, 0x00, 0x86, 0x3B, 0x06, 0x23, 0x35, 0x31, 0x2E, 0x2E, 
+  0x42, 0x2F, 0x9B, 0x2E, 0x2F, 0x2A, 0x20, 0x1A, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E, 0x27, 0x30, 
+  0x31, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x01, 0x01, 0x86, 0x01, 0x24, 0x17, 0x1D, 0x1B, 0x2E, 
+  0x2E, 0x43, 0x2F, 0x99, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2F, 0x2B, 0x33, 
+  0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x01, 0x02, 0x94, 0x0F, 0x2D, 0x1C, 0x35, 0x20, 0x37, 0x2E, 
+  0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x20, 0x1B, 
+  0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x02, 0x02, 0xA1, 0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 0x2E, 0x29, 
+  0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x21, 0x1B, 0x2C, 
+  0x14, 0x14, 0x31, 0x38, 0x02, 0x03, 0x04, 0x91, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x21, 0x1B, 0x19, 0x36, 0x21, 
+  0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x42, 0x2F, 0x89, 0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 0x04, 
+  0x05, 0x9C, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 
+  0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x05, 0x06, 0x9A, 0x04, 0x23, 0x31, 0x1C, 0x1D, 0x1C, 
+  0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 0x1A, 0x2D, 
+  0x10, 0x06, 0x07, 0x98, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27, 0x27, 0x2B, 0x2B, 0x27, 0x27, 
+  0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x07, 0x08, 0x96, 0x09, 0x11, 0x14, 0x18, 0x2D, 0x17, 0x14, 0x1D, 
+  0x0C, 0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x08, 0x0A, 0x91, 0x01, 0x0F, 
+  0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x0B, 0x0C, 0x8D, 0x3B, 
+  0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x0D, 0x0D, 0x8C, 0x01, 0x02, 0x03, 0x04, 
+  0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x10, 0x07, 0x1D, 0x23, 0x31, 0x19, 0x1A, 
+  0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x0A, 0x09, 0x87, 0x0D, 0x0A, 0x19, 0x32, 0x36, 0x36, 
+  0x1B, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x09, 0x07, 0x97, 0x3B, 0x0B, 0x19, 0x38, 0x33, 
+  0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 0x04, 0x08, 
+  0x06, 0x9A, 0x02, 0x2C, 0x22, 0x22, 0x32, 0x1B, 0x33, 0x33, 0x1B, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 
+  0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31, 0x1D, 0x15, 0x02, 0x06, 0x05, 0x8E, 0x03, 0x1B, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 
+  0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x1D, 0x8A, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x17, 0x0B, 
+  0x0F, 0x05, 0x04, 0x9E, 0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 
+  0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x04, 0x03, 0xA0, 0x0D, 0x33, 
+  0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 
+  0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x03, 0x02, 0xA2, 0x3B, 0x1B, 0x21, 0x22, 0x2C, 0x07, 
+  0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 
+  0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x01, 0xA4, 0x3B, 0x14, 0x20, 0x25, 0x1A, 0x1D, 0x08, 0x16, 
+  0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 
+  0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x21, 0x36, 0x23, 0x0B, 0x0E, 0x0D, 
+  0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 
+  0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x01, 0x00, 0xA5, 0x09, 0x17, 0x1F, 0x22, 0x32, 0x23, 0x12, 0x06, 
+  0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 
+  0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x01, 0x00, 0xA6, 0x03, 0x2B, 0x21, 0x33, 0x33, 0x2D, 0x35, 
+  0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x05, 0x14, 0x1B, 0x1A, 0x18, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x35, 0x18, 0x19, 
+  0x1A, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0x99, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 
+  0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x0E, 0x08, 0x05, 0x15, 0x15, 0x07, 0x12, 0x1D, 0x1D, 0x15, 0x08, 0x05, 0x07, 
+  0x42, 0x15, 0x8B, 0x13, 0x31, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0x8E, 0x10, 0x25, 0x20, 0x36, 
+  0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0x06, 0x34, 0x04, 0x42, 0x0E, 0x85, 0x08, 0x0A, 0x35, 0x1D, 0x06, 0x34, 
+  0x43, 0x0E, 0x8C, 0x08, 0x12, 0x2D, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x23, 0x09, 0xA8, 0x03, 0x1F, 0x1E, 
+  0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x05, 0x0D, 0x16, 0x16, 0x3B, 0x03, 0x0A, 0x35, 0x13, 0x08, 
+  0x05, 0x09, 0x16, 0x16, 0x3B, 0x03, 0x12, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A, 0x0F, 0x8E, 0x08, 
+  0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x2C, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x03, 0x12, 0x35, 
+  0x0A, 0x08, 0x05, 0x09, 0x42, 0x16, 0x8C, 0x03, 0x12, 0x31, 0x31, 0x19, 0x36, 0x25, 0x20, 0x33, 0x19, 0x23, 0x1A, 0x05, 
+  0x8E, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x19, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x03, 
+  0x12, 0x14, 0x05, 0x13, 0x05, 0x09, 0x42, 0x16, 0x81, 0x03, 0x0B, 0x42, 0x1A, 0x87, 0x36, 0x1E, 0x20, 0x25, 0x32, 0x1C, 
+  0x19, 0x13, 0x87, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x83, 0x22, 0x36, 0x06, 0x0D, 0x42, 0x16, 
+  0x86, 0x03, 0x0B, 0x14, 0x12, 0x23, 0x34, 0x09, 0x42, 0x16, 0x81, 0x03, 0x0B, 0x42, 0x1B, 0x87, 0x33, 0x1E, 0x1F, 0x20, 
+  0x33, 0x24, 0x18, 0x1C, 0x8E, 0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x33, 0x06, 0x0D, 
+  0x42, 0x16, 0x86, 0x11, 0x05, 0x14, 0x17, 0x24, 0x34, 0x09, 0x42, 0x16, 0x8C, 0x03, 0x0C, 0x33, 0x36, 0x36, 0x22, 0x20, 
+  0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x88, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x42, 0x30, 0x82, 0x36, 
+  0x06, 0x0D, 0x42, 0x16, 0x86, 0x03, 0x0B, 0x24, 0x19, 0x18, 0x34, 0x09, 0x42, 0x16, 0x8C, 0x03, 0x13, 0x30, 0x30, 0x22, 
+  0x25, 0x1F, 0x26, 0x26, 0x1E, 0x1C, 0x2D, 0x23, 0x82, 0x1B, 0x21, 0x1B, 0x42, 0x21, 0x80, 0x22, 0x43, 0x36, 0x83, 0x32, 
+  0x19, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x15, 0x1D, 0x07, 0x1D, 0x34, 0x09, 0x42, 0x16, 0x8C, 0x03, 0x13, 0x25, 0x30, 
+  0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x82, 0x18, 0x20, 0x1B, 0x42, 0x25, 0x80, 0x38, 0x42, 0x1B, 0x84, 
+  0x1A, 0x1A, 0x31, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x34, 0x14, 0x1C, 0x03, 0x05, 0x09, 0x42, 0x16, 0x8C, 0x03, 0x13, 
+  0x30, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x24, 0x8E, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 
+  0x1A, 0x1A, 0x19, 0x19, 0x2C, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x07, 0x14, 0x18, 0x13, 0x34, 0x09, 0x42, 0x16, 0x8C, 
+  0x03, 0x0C, 0x38, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0x36, 0x35, 0x2C, 0x1D, 0x8E, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 
+  0x38, 0x1B, 0x19, 0x31, 0x31, 0x2D, 0x23, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x15, 0x14, 0x2D, 0x23, 0x34, 0x09, 0x42, 
+  0x16, 0x8C, 0x03, 0x0B, 0x1B, 0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 0x14, 0x2D, 0x34, 0x88, 0x03, 0x1F, 0x32, 0x1B, 
+  0x38, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x82, 0x2C, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x15, 0x35, 0x23, 0x23, 0x34, 
+  0x09, 0x42, 0x16, 0x8C, 0x03, 0x0A, 0x2D, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x88, 0x10, 0x21, 
+  0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19, 0x42, 0x31, 0x82, 0x2D, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x03, 0x15, 0x35, 0x17, 
+  0x17, 0x34, 0x09, 0x42, 0x16, 0x8C, 0x11, 0x06, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0x8E, 
+  0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 0x2D, 0x06, 0x0D, 0x42, 0x16, 0x86, 0x11, 0x15, 
+  0x35, 0x1C, 0x1C, 0x34, 0x09, 0x42, 0x16, 0x8C, 0x11, 0x34, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 
+  0x3B, 0x00, 0x8D, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 0x1B, 0x1A, 0x19, 0x2D, 0x06, 0x0F, 0x42, 0x10, 0x85, 
+  0x11, 0x15, 0x1D, 0x24, 0x1C, 0x34, 0x43, 0x10, 0x8B, 0x11, 0x04, 0x05, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 
+  0x0F, 0x00, 0x00, 0x8D, 0x09, 0x31, 0x30, 0x31, 0x1A, 0x32, 0x25, 0x25, 0x22, 0x32, 0x1B, 0x2D, 0x34, 0x08, 0x42, 0x34, 
+  0x85, 0x08, 0x07, 0x1D, 0x14, 0x14, 0x04, 0x42, 0x08, 0x8B, 0x34, 0x34, 0x04, 0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 
+  0x35, 0x13, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x1B, 0x2C, 0x32, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x19, 0x13, 0x05, 0x08, 
+  0x0A, 0x1D, 0x14, 0x1D, 0x14, 0x23, 0x1A, 0x1B, 0x32, 0x23, 0x12, 0x34, 0x04, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 
+  0x1C, 0x03, 0x01, 0x02, 0xA3, 0x1C, 0x30, 0x31, 0x2C, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 
+  0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 
+  0x3B, 0x01, 0x02, 0xA2, 0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 
+  0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x02, 
+  0x03, 0xA0, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 
+  0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x03, 0x03, 0x9F, 0x3B, 0x04, 
+  0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 
+  0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x04, 0x04, 0x9D, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 
+  0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 
+  0x0B, 0x1D, 0x0D, 0x05, 0x06, 0x9A, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31, 0x19, 0x19, 
+  0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x06, 0x07, 0x8B, 0x01, 0x12, 0x1A, 0x1C, 
+  0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x42, 0x05, 0x89, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 
+  0x01, 0x07, 0x08, 0x8B, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x1D, 0x13, 0x0C, 0x12, 0x0A, 0x0A, 0x15, 0x42, 0x07, 0x87, 0x15, 
+  0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x08, 0x0B, 0x90, 0x0F, 0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 
+  0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x0B, 0x0D, 0x8D, 0x09, 0x0F, 0x05, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 
+  0x04, 0x0D, 0x09, 0x3B, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 
+  0x41, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x43, 0x4A, 0x88, 0x49, 0x48, 0x47, 0x4B, 
+  0x4C, 0x4D, 0x4E, 0x4F, 0x3F, 0x0A, 0x08, 0x8A, 0x3F, 0x41, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x43, 
+  0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x08, 0x07, 0x98, 0x3F, 0x44, 0x48, 0x52, 0x50, 0x51, 0x51, 
+  0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x3F, 0x07, 0x05, 
+  0x8C, 0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 0x63, 0x1F, 0x1F, 0x44, 0x20, 0x89, 0x64, 0x65, 0x2C, 
+  0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56, 0x06, 0x04, 0x9E, 0x3F, 0x6C, 0x68, 0x4A, 0x50, 0x50, 0x60, 0x6D, 0x63, 0x27, 
+  0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 0x6E, 0x6E, 0x5B, 0x6F, 0x70, 0x4C, 0x6A, 0x71, 0x72, 
+  0x3F, 0x04, 0x03, 0x9F, 0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 
+  0x26, 0x2B, 0x26, 0x26, 0x21, 0x36, 0x19, 0x1A, 0x30, 0x73, 0x74, 0x75, 0x53, 0x6A, 0x71, 0x76, 0x04, 0x03, 0x88, 0x46, 
+  0x45, 0x49, 0x50, 0x57, 0x0A, 0x6E, 0x21, 0x27, 0x42, 0x2E, 0x95, 0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 
+  0x1B, 0x19, 0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 0x02, 0x02, 0x90, 0x3F, 0x4D, 0x47, 0x50, 
+  0x57, 0x0A, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 0x42, 0x26, 0x8E, 0x21, 0x1A, 0x2C, 0x1B, 
+  0x20, 0x2A, 0x2F, 0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x02, 0x01, 0xA4, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 
+  0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x19, 0x38, 0x26, 
+  0x29, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x01, 0x01, 0x9A, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E, 
+  0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x25, 0x1A, 0x1B, 0x1F, 0x29, 
+  0x28, 0x42, 0x2F, 0x86, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x01, 0x00, 0x99, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64, 
+  0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0x1B, 0x1F, 0x2F, 0x2E, 0x2F, 0x28, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x2A, 
+  0x45, 0x2F, 0x86, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F, 0x3F, 0x00, 0x8F, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x1E, 0x26, 0x26, 
+  0x21, 0x36, 0x1C, 0x17, 0xD9, 0xAD, 0xDB, 0x95, 0x42, 0xAA, 0x89, 0x27, 0x73, 0x74, 0x95, 0xDB, 0xDB, 0x95, 0xAA, 0xAA, 
+  0xA6, 0x43, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x8C, 0x3F, 0x75, 0x4C, 0x49, 0x6F, 0x90, 0x29, 
+  0x2A, 0x2B, 0x22, 0x64, 0xB7, 0xAF, 0x43, 0xB0, 0x85, 0xAF, 0xA0, 0x90, 0x26, 0xB2, 0xAF, 0x43, 0xB0, 0x81, 0xAF, 0x9C, 
+  0x43, 0x2F, 0x87, 0x29, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09, 0x8D, 0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 
+  0x27, 0x2B, 0x26, 0xB2, 0x9D, 0x7E, 0x42, 0x53, 0x8B, 0x9F, 0xA0, 0x77, 0x26, 0xB2, 0x9F, 0x7E, 0x53, 0x53, 0x7E, 0x9F, 
+  0x9C, 0x43, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0x99, 0x87, 0x9F, 0x4F, 0x6A, 0x68, 0x9A, 0x9B, 0x37, 0x2E, 
+  0x2E, 0x27, 0x29, 0x29, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x77, 0x26, 0xB2, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 
+  0x9D, 0x9C, 0x2F, 0x29, 0x29, 0x42, 0x2F, 0x85, 0x29, 0x8B, 0x7A, 0x5F, 0xA1, 0x11, 0xA8, 0x6C, 0x54, 0x68, 0xA2, 0x2E, 
+  0x39, 0x39, 0x2E, 0x2F, 0x2E, 0x2E, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x77, 0x26, 0xB2, 0x9D, 0x5E, 0x7E, 
+  0x7E, 0x5E, 0x9D, 0x9C, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0x9D, 0xA4, 0x5E, 0x45, 
+  0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 0x39, 0xA8, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x2F, 0x73, 0xB9, 0x9D, 
+  0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2F, 0x42, 0x2E, 0x87, 0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C, 0x87, 0x55, 
+  0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 0x2E, 0x42, 0x39, 0x91, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x90, 0x73, 
+  0xB9, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0xA8, 0x54, 0x71, 0xA9, 0x87, 
+  0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0x42, 0x39, 0x91, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0xD1, 
+  0x73, 0xB2, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x43, 0x37, 0x87, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 
+  0x83, 0xAB, 0x5E, 0x94, 0xA6, 0x42, 0x39, 0x80, 0x37, 0x42, 0x39, 0x91, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 
+  0x8B, 0x73, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x46, 0x39, 0x84, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x9C, 0x9A, 
+  0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0xA8, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x2A, 0x20, 
+  0xB9, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x47, 0x39, 0x83, 0xA8, 0x8D, 0x71, 0xA9, 0x83, 0xAB, 0x54, 0x69, 0xA7, 
+  0x45, 0x2E, 0x92, 0x8B, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x30, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 
+  0x9D, 0x9C, 0x46, 0x39, 0x84, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0x83, 0xAE, 0x6A, 0x7E, 0xA7, 0x46, 0x2E, 0x92, 0x9C, 0x9D, 
+  0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x30, 0x2B, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0xA8, 0x45, 0x39, 0x84, 
+  0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x9F, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x77, 0x9C, 0x9F, 0x5E, 
+  0x7E, 0x7E, 0x53, 0x9F, 0xB1, 0x21, 0x2B, 0x9C, 0x9D, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0x9C, 0x2E, 0x2E, 0x37, 0x43, 0x39, 
+  0x84, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x9F, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F, 0x29, 0x29, 0x9C, 0x9F, 
+  0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x63, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0xB2, 0x77, 0x29, 0x2E, 0x42, 
+  0x37, 0x85, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x85, 0x40, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x43, 0x29, 0x9E, 0x77, 0x9C, 
+  0x9D, 0x5E, 0x7E, 0x7E, 0x53, 0x9F, 0xA0, 0x73, 0x2B, 0x9C, 0x9F, 0x5E, 0x7E, 0x7E, 0x5E, 0x9D, 0xB9, 0x20, 0x2B, 0x28, 
+  0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x8D, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x2F, 
+  0x2F, 0x9C, 0x9D, 0x7E, 0x42, 0x53, 0x97, 0x9F, 0xA0, 0x26, 0x2B, 0x9C, 0x9D, 0x7E, 0x53, 0x53, 0x7E, 0x9F, 0xB7, 0x32, 
+  0x1E, 0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0x8B, 0x76, 0x7D, 0x6A, 0x5F, 0x27, 0x29, 0x29, 
+  0x28, 0x2F, 0x8B, 0x9C, 0xAF, 0x42, 0xB0, 0x86, 0xAF, 0xAF, 0xA0, 0x73, 0x2B, 0xB2, 0xAF, 0x43, 0xB0, 0x8C, 0xAF, 0xDF, 
+  0x2C, 0x32, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0x8A, 0x87, 0xAB, 0x85, 0xBF, 0xBC, 0x92, 
+  0x2F, 0x29, 0x2F, 0x8B, 0xA6, 0x42, 0xAA, 0x86, 0xAC, 0xAD, 0xDB, 0xE4, 0x2B, 0x26, 0x74, 0x43, 0xAA, 0x8C, 0x95, 0xDB, 
+  0x1C, 0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x01, 0x01, 0x85, 0x56, 0x71, 0x5F, 0x5F, 0x78, 0x92, 
+  0x42, 0x2F, 0x87, 0x2E, 0x2E, 0x29, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x42, 0x2B, 0x91, 0x29, 0x2F, 0x2E, 0x2E, 0x27, 0x25, 
+  0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F, 0x00, 0x02, 0x86, 0xAE, 0x85, 0x6A, 0x84, 0x28, 
+  0x2E, 0x2E, 0x42, 0x2F, 0x99, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x37, 0x2F, 0x2B, 
+  0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x01, 0x02, 0x94, 0x3F, 0xC2, 0x85, 0x6A, 0xC1, 0x8B, 
+  0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x1F, 
+  0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x02, 0x02, 0xA1, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 0xA1, 0x2E, 0x2E, 
+  0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x27, 0x21, 0x1B, 
+  0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81, 0x03, 0x03, 0x8D, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 0x32, 0x19, 
+  0x1B, 0x25, 0x26, 0x43, 0x2B, 0x8D, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 0x99, 0x76, 
+  0x04, 0x04, 0x92, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 
+  0x27, 0x29, 0x42, 0x2E, 0x87, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x05, 0x05, 0x9B, 0x3F, 0x4F, 0xC2, 0x7A, 
+  0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x8B, 0x27, 0xC7, 0x6B, 0x94, 
+  0x84, 0xA1, 0x6F, 0x81, 0x06, 0x07, 0x89, 0x40, 0xA4, 0x89, 0x7A, 0x8D, 0x5F, 0x7F, 0x6B, 0xC4, 0x74, 0x42, 0x90, 0x8B, 
+  0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40, 0x07, 0x08, 0x96, 0x3F, 0x46, 0xAB, 0x8F, 0x7A, 
+  0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x3F, 0x08, 0x09, 
+  0x80, 0x3F, 0x00, 0x90, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 
+  0x56, 0x0B, 0x0C, 0x85, 0x3F, 0x87, 0x41, 0xA4, 0xAB, 0xC2, 0x42, 0xCA, 0x85, 0xC3, 0xAB, 0x72, 0x4F, 0x87, 0x3F, 0x0C, 
+  0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 
+  0x0A, 0x86, 0x87, 0x46, 0x55, 0xAB, 0x8F, 0x8F, 0x79, 0x42, 0xC9, 0x88, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 
+  0x3F, 0x0A, 0x08, 0x87, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0x44, 0xCD, 0x43, 0xC9, 0x84, 0xCA, 0x9A, 0xCE, 
+  0xCC, 0x46, 0x09, 0x07, 0x99, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xC4, 0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 
+  0xCF, 0xC6, 0xA9, 0xC9, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x40, 0x3F, 0x06, 0x06, 0x9B, 0x81, 0x6F, 0x8C, 0x8C, 0xBE, 0xCD, 
+  0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x88, 0x79, 0xC9, 0x79, 0xC2, 0x4E, 
+  0x46, 0x3F, 0x05, 0x05, 0x8E, 0x76, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 
+  0x42, 0x1D, 0x8B, 0x0B, 0x15, 0x15, 0x0A, 0x35, 0xC6, 0xC9, 0x89, 0x80, 0x75, 0x6C, 0x3F, 0x04, 0x04, 0x9E, 0x76, 0xD2, 
+  0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 
+  0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x04, 0x03, 0xA0, 0x7B, 0xBC, 0xD2, 0x8C, 0x5C, 0x0B, 0x15, 0x07, 
+  0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 
+  0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x03, 0x02, 0xA2, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 
+  0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 
+  0xCA, 0x9A, 0x40, 0x02, 0x01, 0xA4, 0x3F, 0x58, 0xD4, 0xD2, 0xA9, 0x35, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 
+  0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0xD1, 0x38, 0x79, 0x8F, 
+  0x80, 0xA4, 0x3F, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 
+  0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 
+  0x89, 0xC0, 0x56, 0x01, 0x00, 0xA5, 0x87, 0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 
+  0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 
+  0xA9, 0x7D, 0x8F, 0xAB, 0x01, 0x00, 0xA6, 0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 
+  0x05, 0x14, 0x1A, 0x1A, 0x6E, 0x24, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x7C, 0x6E, 0x6E, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 
+  0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00, 0x8E, 0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 
+  0xDE, 0xDA, 0xDA, 0x43, 0xB1, 0x85, 0xDF, 0x7C, 0x1D, 0xD6, 0xDA, 0xDA, 0x43, 0xB1, 0x8B, 0xAD, 0x2D, 0x2D, 0x1A, 0x33, 
+  0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8, 0x3F, 0x8D, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 
+  0xD6, 0xAF, 0x44, 0x9F, 0x84, 0x98, 0x7C, 0x1D, 0xD6, 0xAF, 0x43, 0x9F, 0x8C, 0xAF, 0xAD, 0x2C, 0x2C, 0x18, 0x36, 0x30, 
+  0x36, 0x5B, 0x71, 0x89, 0xCA, 0x87, 0x8D, 0x7B, 0xB4, 0xD2, 0xD4, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0xD8, 
+  0xB0, 0x43, 0x53, 0x85, 0x9E, 0x98, 0x7C, 0x13, 0xDE, 0xB0, 0x43, 0x53, 0x8C, 0xB0, 0xAD, 0x2C, 0x2C, 0x18, 0x32, 0x30, 
+  0x1E, 0x65, 0xC0, 0x7D, 0xA1, 0x76, 0xA8, 0x08, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0xAD, 
+  0xAF, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x0A, 0xDE, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAD, 0x2D, 0x31, 0x19, 
+  0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8, 0xA8, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 
+  0x36, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x05, 0xD9, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAD, 0x19, 
+  0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 0x89, 0xBD, 0x87, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x42, 
+  0x30, 0x9D, 0x22, 0xAC, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x12, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 
+  0xDB, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0x9D, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 
+  0x30, 0x25, 0x1E, 0x25, 0x1E, 0xAC, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0xE5, 0x7C, 0x17, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 
+  0x53, 0xB0, 0xDB, 0x42, 0x36, 0x87, 0x22, 0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0x88, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 
+  0x20, 0x1E, 0x22, 0x22, 0x42, 0x30, 0x9C, 0xAC, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x7C, 0x19, 0xDB, 0xB0, 0x53, 
+  0x7E, 0x7E, 0x53, 0xB0, 0xAC, 0x22, 0x30, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0x82, 0xD3, 0xD4, 0xC9, 
+  0x42, 0x21, 0x80, 0x22, 0x43, 0x36, 0x9D, 0x32, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x07, 0xD9, 0xB0, 
+  0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAC, 0x30, 0x30, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0x86, 0xCF, 0xD4, 
+  0xA1, 0x61, 0x25, 0x25, 0x38, 0x42, 0x1B, 0x93, 0x1A, 0x1A, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0xE5, 0x7C, 0x1C, 
+  0xD7, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB, 0x42, 0x22, 0x87, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0xA8, 
+  0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 
+  0x7C, 0x18, 0xD9, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDB, 0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 
+  0x66, 0xA8, 0x06, 0xD5, 0xA1, 0xD0, 0xD1, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x31, 0x2D, 0xAD, 0xAF, 0x53, 0x7E, 0x7E, 0x53, 
+  0x9E, 0x97, 0x7C, 0x2D, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xAD, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 
+  0x6A, 0x71, 0x72, 0x88, 0x7B, 0xB4, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0xAD, 0xAF, 0x53, 0x7E, 
+  0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x23, 0xDB, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xD9, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 
+  0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x88, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22, 0x32, 0x19, 0x42, 0x31, 0x9C, 0xAD, 0xB0, 
+  0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x97, 0x1D, 0x17, 0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xD8, 0x1D, 0x23, 0x1B, 0x1E, 
+  0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0xA8, 0x3F, 0xCF, 0xD4, 0x7A, 0xB3, 0x65, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 
+  0xAD, 0xB0, 0x53, 0x7E, 0x7E, 0x53, 0x9E, 0x98, 0x7C, 0x1C, 0xAD, 0xAF, 0x53, 0x7E, 0x7E, 0x53, 0xB0, 0xDE, 0x15, 0x1D, 
+  0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x00, 0xA6, 0x11, 0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38, 0x1B, 
+  0x1A, 0x19, 0xAD, 0xB0, 0x5E, 0x6A, 0x6A, 0x5E, 0x9E, 0x97, 0x7C, 0x24, 0xAD, 0xB0, 0x5E, 0x6A, 0x6A, 0x5E, 0xB0, 0xD7, 
+  0x05, 0x13, 0x18, 0x25, 0x91, 0x35, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 0x8B, 0x87, 0xC6, 0x8C, 0x7A, 0xB3, 0x65, 0x25, 
+  0x25, 0x22, 0x32, 0x1B, 0xAD, 0x45, 0xAF, 0x83, 0xB1, 0x7C, 0x14, 0xAD, 0x45, 0xAF, 0x89, 0xD7, 0x05, 0x35, 0x1A, 0x36, 
+  0x05, 0x75, 0x7E, 0x54, 0x9A, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x21, 0x1E, 0x22, 0x36, 0x1A, 0x6E, 
+  0x7C, 0x05, 0x04, 0x15, 0x7C, 0x7C, 0x1D, 0x14, 0x23, 0x6E, 0x91, 0x91, 0x17, 0x0A, 0x08, 0x04, 0x15, 0x1C, 0x19, 0x11, 
+  0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x01, 0x01, 0xA4, 0x3F, 0x88, 0x8C, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 0x32, 0x1C, 
+  0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x40, 
+  0x45, 0x53, 0x54, 0xA4, 0x3F, 0x01, 0x02, 0xA2, 0x3F, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 0x1C, 0x0A, 
+  0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x48, 0x4B, 
+  0x53, 0x75, 0x40, 0x02, 0x03, 0xA1, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 
+  0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x46, 0x3F, 
+  0x02, 0x03, 0xA0, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 
+  0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x03, 0x04, 0x9D, 0x3F, 
+  0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 0x20, 0x25, 
+  0x17, 0x7C, 0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x4F, 0x05, 0x06, 0x9B, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 
+  0x0E, 0x0A, 0x24, 0x6E, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 
+  0x05, 0x06, 0x9A, 0x3F, 0x40, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 
+  0xE1, 0x8E, 0x48, 0x48, 0x47, 0x68, 0x53, 0x43, 0x40, 0x3F, 0x06, 0x08, 0x88, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54, 0x53, 
+  0x53, 0x4B, 0x42, 0x47, 0x43, 0x48, 0x86, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x08, 0x0B, 0x87, 0x56, 0xA4, 0x84, 
+  0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x43, 0x4B, 0x84, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00, 0x80, 0x3F, 0x09, 0x0C, 0x85, 0x3F, 
+  0x87, 0x4F, 0xA4, 0x75, 0x75, 0x42, 0x94, 0x85, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x0C, 0x0D, 0x8C, 0x01, 0x02, 0x03, 
+  0x04, 0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x03, 0x06, 0x07, 0x06, 0x05, 0x08, 
+  0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x0A, 0x08, 0x8A, 0x01, 0x0D, 0x07, 0x07, 0x0E, 
+  0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x87, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x09, 0x07, 0x8B, 
+  0x10, 0x06, 0x06, 0x11, 0x02, 0x16, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x42, 0x1B, 0x89, 0x19, 0x1C, 0x15, 0x08, 0x07, 
+  0x12, 0x1D, 0x14, 0x15, 0x09, 0x07, 0x06, 0x87, 0x0F, 0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 0x1E, 0x43, 0x1F, 0x43, 0x20, 
+  0x8A, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x06, 0x04, 0x9D, 0x09, 0x04, 0x15, 0x0E, 0x10, 
+  0x0F, 0x14, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1B, 0x2D, 
+  0x0B, 0x0C, 0x14, 0x17, 0x11, 0x05, 0x04, 0x9E, 0x08, 0x0A, 0x0E, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 
+  0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x19, 0x1A, 0x30, 0x2B, 0x1F, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x04, 
+  0x03, 0x88, 0x11, 0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A, 0x42, 0x2E, 0x94, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 
+  0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C, 0x13, 0x24, 0x31, 0x02, 0x03, 0x02, 0xA2, 0x0D, 0x13, 
+  0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 
+  0x2D, 0x32, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x02, 0x01, 0x99, 0x01, 0x12, 0x15, 0x11, 
+  0x05, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 
+  0x30, 0x26, 0x42, 0x2F, 0x42, 0x29, 0x84, 0x24, 0x1D, 0x23, 0x12, 0x09, 0x01, 0x01, 0x9A, 0x04, 0x0B, 0x34, 0x05, 0x2C, 
+  0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x29, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32, 0x1F, 
+  0x29, 0x28, 0x42, 0x2F, 0x86, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1A, 0x03, 0x01, 0x00, 0x99, 0x01, 0x1D, 0x0A, 0x08, 0x19, 
+  0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x33, 0x25, 0x37, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x19, 0x1E, 
+  0x2A, 0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x36, 0x1D, 0x23, 0x17, 0x01, 0x00, 0x98, 0x06, 0x13, 0x06, 0x0C, 0x1F, 0x2B, 0x1F, 
+  0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x31, 0x04, 0x23, 0x27, 0x2E, 0x29, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x36, 0x2B, 0x46, 0x2F, 
+  0x86, 0x29, 0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x99, 0x01, 0x13, 0x12, 0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 0x38, 
+  0x22, 0x19, 0x17, 0x1C, 0x08, 0x08, 0x06, 0x17, 0x2E, 0x27, 0x26, 0x26, 0x30, 0x1A, 0x20, 0x29, 0x46, 0x2F, 0x87, 0x29, 
+  0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x84, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 0x42, 0x2F, 0x90, 0x26, 0x2B, 0x1F, 0x1E, 
+  0x1B, 0x2C, 0x08, 0x10, 0x03, 0x04, 0x05, 0x32, 0x1F, 0x26, 0x36, 0x33, 0x2A, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x2A, 
+  0x24, 0x17, 0x1B, 0x09, 0x98, 0x08, 0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 0x2F, 0x27, 0x29, 0x2A, 0x2B, 0x20, 0x38, 0x08, 
+  0x10, 0x16, 0x01, 0x0F, 0x08, 0x15, 0x18, 0x36, 0x26, 0x2E, 0x43, 0x2F, 0x42, 0x29, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 
+  0x36, 0x03, 0x87, 0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x29, 0x42, 0x2E, 0x84, 0x2F, 0x2A, 0x27, 0x04, 0x10, 0x42, 
+  0x16, 0x87, 0x01, 0x11, 0x04, 0x0A, 0x20, 0x2F, 0x2E, 0x2F, 0x42, 0x29, 0x8A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 
+  0x21, 0x35, 0x19, 0x0A, 0x87, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x39, 0x2F, 0x42, 0x39, 0x84, 0x37, 0x2E, 0x39, 0x04, 
+  0x10, 0x44, 0x16, 0x88, 0x01, 0x11, 0x05, 0x0C, 0x26, 0x2E, 0x29, 0x2F, 0x2F, 0x42, 0x2E, 0x80, 0x37, 0x42, 0x2E, 0x83, 
+  0x2F, 0x1D, 0x2D, 0x1C, 0x83, 0x17, 0x0C, 0x1D, 0x2E, 0x42, 0x39, 0x80, 0x2E, 0x44, 0x39, 0x82, 0x3A, 0x04, 0x10, 0x46, 
+  0x16, 0x85, 0x0D, 0x04, 0x04, 0x17, 0x2B, 0x37, 0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x1D, 0x23, 0x19, 0x82, 
+  0x1C, 0x0C, 0x24, 0x43, 0x39, 0x80, 0x37, 0x44, 0x39, 0x82, 0x3A, 0x0E, 0x10, 0x48, 0x16, 0x8F, 0x0D, 0x04, 0x06, 0x1C, 
+  0x2E, 0x39, 0x37, 0x37, 0x39, 0x37, 0x39, 0x37, 0x39, 0x1C, 0x2C, 0x1A, 0x82, 0x17, 0x0C, 0x23, 0x43, 0x39, 0x80, 0x37, 
+  0x44, 0x39, 0x82, 0x3A, 0x0E, 0x10, 0x4A, 0x16, 0x83, 0x03, 0x08, 0x34, 0x22, 0x45, 0x39, 0x83, 0x3A, 0x23, 0x23, 0x1B, 
+  0x87, 0x23, 0x13, 0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x43, 0x39, 0x83, 0x37, 0x3A, 0x04, 0x10, 0x49, 0x16, 0x84, 0x01, 
+  0x11, 0x04, 0x1D, 0x2B, 0x45, 0x39, 0x83, 0x3A, 0x1C, 0x2C, 0x1B, 0x86, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 0x37, 0x45, 
+  0x2E, 0x82, 0x39, 0x04, 0x10, 0x47, 0x16, 0x85, 0x01, 0x03, 0x34, 0x0A, 0x25, 0x3A, 0x46, 0x39, 0x83, 0x3A, 0x14, 0x2D, 
+  0x1A, 0x83, 0x24, 0x1D, 0x14, 0x29, 0x45, 0x2E, 0x85, 0x2F, 0x2F, 0x29, 0x39, 0x04, 0x10, 0x46, 0x16, 0x86, 0x03, 0x08, 
+  0x07, 0x22, 0x2F, 0x39, 0x37, 0x47, 0x39, 0x82, 0x35, 0x19, 0x31, 0x8F, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 
+  0x2F, 0x2F, 0x29, 0x28, 0x2A, 0x37, 0x04, 0x10, 0x43, 0x16, 0x8B, 0x01, 0x0D, 0x08, 0x06, 0x12, 0x36, 0x1F, 0x27, 0x2F, 
+  0x2E, 0x2E, 0x37, 0x44, 0x39, 0x83, 0x1F, 0x24, 0x36, 0x0A, 0x84, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x43, 0x2F, 0x43, 0x28, 
+  0x82, 0x39, 0x04, 0x10, 0x42, 0x16, 0x8C, 0x0D, 0x04, 0x04, 0x31, 0x20, 0x2D, 0x1C, 0x1A, 0x25, 0x26, 0x2A, 0x2F, 0x2E, 
+  0x42, 0x37, 0x85, 0x39, 0x39, 0x19, 0x23, 0x1E, 0x11, 0xA8, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28, 
+  0x28, 0x29, 0x2F, 0x39, 0x04, 0x10, 0x16, 0x10, 0x0E, 0x05, 0x0C, 0x27, 0x37, 0x2F, 0x21, 0x17, 0x24, 0x18, 0x38, 0x20, 
+  0x2B, 0x28, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 0x31, 0x22, 0x09, 0x87, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x29, 0x2A, 
+  0x43, 0x29, 0x9C, 0x2F, 0x39, 0x04, 0x0D, 0x0E, 0x04, 0x0C, 0x25, 0x2B, 0x28, 0x2F, 0x2E, 0x27, 0x33, 0x1C, 0x24, 0x2D, 
+  0x36, 0x1E, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 0x2B, 0x1C, 0x1B, 0x12, 0x09, 0x88, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 
+  0x28, 0x28, 0x43, 0x2F, 0x9A, 0x39, 0x0E, 0x34, 0x07, 0x23, 0x26, 0x2B, 0x26, 0x2A, 0x2F, 0x2E, 0x2F, 0x26, 0x1A, 0x24, 
+  0x24, 0x2D, 0x36, 0x30, 0x20, 0x2B, 0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x01, 0xA4, 0x2D, 0x24, 0x1D, 0x2B, 0x2F, 
+  0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x39, 0x08, 0x2C, 0x18, 0x22, 0x1F, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x28, 0x20, 
+  0x18, 0x14, 0x17, 0x2D, 0x1A, 0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x01, 0x00, 0x86, 0x3B, 0x06, 0x23, 0x35, 0x31, 
+  0x2E, 0x2E, 0x42, 0x2F, 0x9B, 0x2E, 0x2F, 0x2A, 0x20, 0x1B, 0x1A, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E, 
+  0x27, 0x30, 0x31, 0x1C, 0x24, 0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x01, 0x01, 0x86, 0x01, 0x24, 0x17, 0x1D, 
+  0x1B, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x2B, 0x22, 0x19, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2F, 
+  0x2B, 0x33, 0x23, 0x14, 0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x01, 0x02, 0x94, 0x0F, 0x2D, 0x1C, 0x35, 0x20, 
+  0x37, 0x2E, 0x2F, 0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 
+  0x20, 0x1B, 0x23, 0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x02, 0x02, 0xA1, 0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 
+  0x2E, 0x29, 0x1F, 0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x21, 
+  0x1B, 0x2C, 0x14, 0x14, 0x31, 0x38, 0x02, 0x03, 0x04, 0x91, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x21, 0x1B, 0x19, 
+  0x36, 0x21, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x42, 0x2F, 0x89, 0x37, 0x37, 0x29, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 
+  0x0D, 0x04, 0x05, 0x9C, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 
+  0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x05, 0x06, 0x9A, 0x04, 0x23, 0x31, 0x1C, 
+  0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 0x13, 0x24, 
+  0x1A, 0x2D, 0x10, 0x06, 0x07, 0x98, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27, 0x27, 0x2B, 0x2B, 
+  0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x1D, 0x2C, 0x36, 0x07, 0x01, 0x07, 0x08, 0x96, 0x09, 0x11, 0x14, 0x18, 0x2D, 0x17, 
+  0x14, 0x1D, 0x0C, 0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 0x3B, 0x08, 0x0A, 0x91, 
+  0x01, 0x0F, 0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 0x17, 0x05, 0x0D, 0x0B, 0x0C, 
+  0x8D, 0x3B, 0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 0x02, 0x09, 0x0D, 0x0D, 0x8C, 0x01, 0x02, 
+  0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x10, 0x07, 0x1D, 0x23, 0x31, 
+  0x19, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x1D, 0x12, 0x05, 0x0E, 0x10, 0x3B, 0x0A, 0x09, 0x87, 0x0D, 0x0A, 0x19, 0x32, 
+  0x36, 0x36, 0x1B, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x04, 0x10, 0x09, 0x07, 0x97, 0x3B, 0x0B, 0x19, 
+  0x38, 0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 0x2C, 0x31, 0x31, 0x19, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 
+  0x04, 0x08, 0x06, 0x9A, 0x02, 0x2C, 0x22, 0x22, 0x32, 0x1B, 0x33, 0x33, 0x1B, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 
+  0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 0x1A, 0x31, 0x1D, 0x15, 0x02, 0x06, 0x05, 0x8E, 0x03, 0x1B, 0x30, 0x38, 0x1B, 0x1A, 
+  0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x1D, 0x8A, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 
+  0x17, 0x0B, 0x0F, 0x05, 0x04, 0x9E, 0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 
+  0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x04, 0x03, 0xA0, 
+  0x0D, 0x33, 0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 
+  0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x03, 0x02, 0xA2, 0x3B, 0x1B, 0x21, 0x22, 
+  0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 
+  0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x01, 0xA4, 0x3B, 0x14, 0x20, 0x25, 0x1A, 0x1D, 
+  0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 
+  0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x21, 0x36, 0x23, 0x0B, 
+  0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 
+  0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x01, 0x00, 0xA5, 0x09, 0x17, 0x1F, 0x22, 0x32, 0x23, 
+  0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x2C, 0x32, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 
+  0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x19, 0x2D, 0x2D, 0x13, 0x01, 0x00, 0xA6, 0x03, 0x2B, 0x21, 0x33, 0x33, 
+  0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x34, 0x08, 0x13, 0x2D, 0x18, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 
+  0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0xA8, 0x09, 0x17, 0x1F, 0x22, 
+  0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x02, 0x0F, 0x08, 0x08, 0x05, 0x0B, 0x1C, 0x1D, 0x1D, 0x15, 0x08, 
+  0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0xA8, 0x10, 0x25, 
+  0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x12, 0x06, 0x0E, 0x0D, 0x08, 0x0D, 0x03, 0x04, 0x05, 0x0B, 0x1D, 
+  0x05, 0x05, 0x1C, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x23, 0x09, 0xA8, 
+  0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x15, 0x08, 0x34, 0x0D, 0x16, 0x01, 0x0F, 
+  0x34, 0x05, 0x34, 0x1D, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 0x1A, 
+  0x0F, 0x90, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x31, 0x1C, 0x0B, 0x05, 0x0D, 0x42, 
+  0x16, 0x94, 0x01, 0x11, 0x08, 0x15, 0x23, 0x31, 0x2D, 0x23, 0x2C, 0x2C, 0x2D, 0x31, 0x19, 0x36, 0x25, 0x20, 0x33, 0x19, 
+  0x23, 0x1A, 0x05, 0x90, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x1B, 0x1A, 0x2C, 0x06, 
+  0x0D, 0x44, 0x16, 0x92, 0x10, 0x11, 0x05, 0x15, 0x1C, 0x31, 0x31, 0x18, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x25, 0x32, 
+  0x1C, 0x19, 0x13, 0x87, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x85, 0x22, 0x22, 0x38, 0x1A, 0x06, 
+  0x0D, 0x45, 0x16, 0x91, 0x3B, 0x0D, 0x04, 0x08, 0x0C, 0x2D, 0x1B, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x33, 0x24, 
+  0x18, 0x1C, 0x90, 0x1B, 0x20, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 0x1E, 0x33, 0x06, 0x0D, 
+  0x47, 0x16, 0x84, 0x01, 0x02, 0x08, 0x05, 0x0C, 0x42, 0x36, 0x87, 0x22, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x88, 
+  0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x42, 0x30, 0x84, 0x22, 0x30, 0x33, 0x06, 0x0D, 0x49, 0x16, 0x8D, 
+  0x3B, 0x03, 0x08, 0x34, 0x2C, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x1C, 0x2D, 0x23, 0x82, 0x1B, 0x21, 0x1B, 0x42, 0x21, 
+  0x80, 0x22, 0x43, 0x36, 0x85, 0x32, 0x32, 0x1B, 0x19, 0x06, 0x0D, 0x49, 0x16, 0x8D, 0x01, 0x0E, 0x04, 0x12, 0x1A, 0x30, 
+  0x1E, 0x1F, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x1C, 0x82, 0x18, 0x20, 0x1B, 0x42, 0x25, 0x80, 0x38, 0x42, 0x1B, 0x42, 0x1A, 
+  0x83, 0x19, 0x2D, 0x06, 0x0D, 0x47, 0x16, 0x8F, 0x01, 0x03, 0x34, 0x15, 0x2D, 0x25, 0x22, 0x22, 0x1E, 0x1F, 0x2B, 0x1F, 
+  0x22, 0x1D, 0x2C, 0x24, 0x90, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x31, 0x31, 0x23, 
+  0x06, 0x0D, 0x46, 0x16, 0x90, 0x03, 0x08, 0x05, 0x1C, 0x1A, 0x36, 0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0x36, 0x35, 
+  0x2C, 0x1D, 0x8A, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x31, 0x42, 0x2D, 0x82, 0x2C, 0x06, 0x0D, 
+  0x43, 0x16, 0x81, 0x01, 0x0D, 0x42, 0x08, 0x8E, 0x12, 0x24, 0x2C, 0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 0x2D, 
+  0x14, 0x2D, 0x34, 0x88, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 0x18, 0x2D, 0x06, 
+  0x0D, 0x16, 0x16, 0x09, 0x0D, 0x04, 0x08, 0x0C, 0x08, 0x0D, 0x0E, 0x07, 0x13, 0x1C, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 
+  0x1A, 0x14, 0x24, 0x31, 0x0F, 0x88, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19, 0x42, 0x31, 0x9C, 0x19, 0x18, 
+  0x2D, 0x06, 0x0D, 0x16, 0x10, 0x0E, 0x05, 0x15, 0x2D, 0x1A, 0x13, 0x11, 0x02, 0x11, 0x05, 0x12, 0x1D, 0x23, 0x1B, 0x1E, 
+  0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0xA8, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 
+  0x19, 0x19, 0x31, 0x06, 0x03, 0x0E, 0x08, 0x07, 0x13, 0x1C, 0x18, 0x1A, 0x2D, 0x0A, 0x03, 0x02, 0x03, 0x34, 0x15, 0x1D, 
+  0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0x00, 0x89, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 0x1B, 
+  0x1A, 0x42, 0x19, 0x99, 0x2D, 0x05, 0x34, 0x34, 0x0A, 0x14, 0x1D, 0x24, 0x2D, 0x19, 0x1A, 0x24, 0x06, 0x0F, 0x02, 0x03, 
+  0x05, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0xA5, 0x09, 0x31, 0x30, 0x31, 0x1A, 0x32, 0x25, 
+  0x25, 0x22, 0x32, 0x1B, 0x19, 0x18, 0x1C, 0x05, 0x08, 0x06, 0x13, 0x1D, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 
+  0x0F, 0x0D, 0x05, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x01, 0x01, 0xA4, 0x03, 0x21, 0x1B, 0x2C, 0x32, 0x36, 
+  0x21, 0x1E, 0x22, 0x36, 0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 
+  0x05, 0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x01, 0x02, 0xA3, 0x1C, 0x30, 0x31, 0x2C, 0x32, 0x33, 
+  0x20, 0x21, 0x22, 0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 
+  0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x1D, 0x05, 0x3B, 0x01, 0x02, 0xA2, 0x09, 0x22, 0x32, 0x2C, 0x31, 0x32, 0x38, 
+  0x20, 0x21, 0x36, 0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 
+  0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x02, 0x03, 0xA0, 0x0F, 0x33, 0x19, 0x23, 0x2C, 0x1A, 0x1A, 0x1E, 0x36, 
+  0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x11, 
+  0x0A, 0x0C, 0x35, 0x02, 0x03, 0x03, 0x9F, 0x3B, 0x04, 0x36, 0x31, 0x17, 0x17, 0x31, 0x14, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 
+  0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x0F, 0x34, 0x0A, 0x0B, 0x13, 0x0D, 0x04, 
+  0x04, 0x9D, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 
+  0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x05, 0x06, 0x9A, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 
+  0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0B, 0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 
+  0x12, 0x10, 0x06, 0x07, 0x8B, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x42, 0x05, 0x89, 
+  0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x07, 0x08, 0x8B, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x1D, 0x13, 
+  0x0C, 0x12, 0x0A, 0x0A, 0x15, 0x42, 0x07, 0x87, 0x15, 0x0A, 0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x08, 0x0B, 0x90, 0x0F, 
+  0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x0B, 0x0D, 0x8D, 0x09, 
+  0x0F, 0x05, 0x0B, 0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x41, 
+  0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 0x44, 0x47, 
+  0x48, 0x49, 0x43, 0x4A, 0x88, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x3F, 0x0A, 0x08, 0x8A, 0x3F, 0x41, 0x44, 
+  0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x43, 0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x08, 
+  0x07, 0x98, 0x3F, 0x44, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0x5D, 
+  0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x3F, 0x07, 0x05, 0x8C, 0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 
+  0x63, 0x1F, 0x1F, 0x44, 0x20, 0x89, 0x64, 0x65, 0x2C, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56, 0x06, 0x04, 0x9E, 0x3F, 
+  0x6C, 0x68, 0x4A, 0x50, 0x50, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 
+  0x6E, 0x6E, 0x5B, 0x6F, 0x70, 0x4C, 0x6A, 0x71, 0x72, 0x3F, 0x04, 0x03, 0x9F, 0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x51, 0x58, 
+  0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x36, 0x19, 0x1A, 0x30, 0x73, 0x74, 
+  0x75, 0x53, 0x6A, 0x71, 0x76, 0x04, 0x03, 0x88, 0x46, 0x45, 0x49, 0x50, 0x57, 0x0A, 0x6E, 0x21, 0x27, 0x42, 0x2E, 0x95, 
+  0x27, 0x20, 0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 
+  0x7B, 0x3F, 0x02, 0x02, 0x90, 0x3F, 0x4D, 0x47, 0x50, 0x57, 0x0A, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 
+  0x27, 0x2B, 0x42, 0x26, 0x8E, 0x21, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x29, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 
+  0x02, 0x01, 0xA4, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x19, 0x38, 0x26, 0x29, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 
+  0x01, 0x01, 0x9A, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x25, 0x1A, 0x1B, 0x1F, 0x29, 0x28, 0x42, 0x2F, 0x86, 0x29, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 
+  0x01, 0x00, 0x99, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0xB7, 0xC7, 0x2F, 0x2E, 0x2F, 
+  0x28, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x2A, 0x45, 0x2F, 0x86, 0x29, 0x8B, 0x8C, 0x7E, 0x8D, 0x6F, 0x3F, 0x00, 
+  0x99, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x1E, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0x24, 0x98, 0x98, 0xB2, 0x2A, 0x2E, 0x29, 
+  0x27, 0x26, 0x2B, 0x20, 0x1B, 0x1B, 0x26, 0x46, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 0x8F, 0x7B, 0x00, 0x99, 0x3F, 
+  0x75, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x22, 0x1B, 0x23, 0x98, 0xE6, 0xE6, 0x97, 0xB2, 0x2E, 0x90, 0x26, 
+  0x26, 0x1E, 0x19, 0x1E, 0x29, 0x46, 0x2F, 0x87, 0x29, 0x28, 0x92, 0x93, 0x6A, 0x85, 0x86, 0x09, 0x98, 0x81, 0x94, 0x4C, 
+  0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x27, 0x2B, 0x26, 0x21, 0x36, 0xB7, 0xE5, 0x7E, 0xE7, 0xE6, 0x97, 0x95, 0x74, 0x26, 0x22, 
+  0x1B, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0x99, 0x87, 0x97, 0x4F, 0x6A, 0x68, 0x9A, 0x9B, 0x37, 
+  0x2E, 0x2E, 0x27, 0x29, 0x28, 0x27, 0x1F, 0xDD, 0xE5, 0x53, 0x7E, 0x5E, 0xE7, 0x97, 0xDD, 0xAC, 0x65, 0x20, 0x44, 0x2F, 
+  0x42, 0x29, 0x42, 0x2F, 0x85, 0x29, 0x8B, 0x7A, 0x5F, 0xA1, 0x11, 0x8F, 0x6C, 0x54, 0x68, 0xA2, 0x2E, 0x39, 0x39, 0x2E, 
+  0x2F, 0x2E, 0x2E, 0x2F, 0x29, 0xDD, 0xE5, 0x53, 0x42, 0x7E, 0x84, 0x54, 0xE5, 0xE6, 0xB7, 0x74, 0x42, 0x2F, 0x42, 0x29, 
+  0x8A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0x8F, 0xA4, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 
+  0x2F, 0x37, 0x39, 0x39, 0x37, 0x39, 0xDD, 0xE5, 0x53, 0x44, 0x7E, 0x88, 0x54, 0xE5, 0x97, 0xB9, 0x78, 0x92, 0x77, 0x2F, 
+  0x2F, 0x42, 0x2E, 0x87, 0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C, 0x87, 0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 
+  0x2E, 0x44, 0x39, 0x82, 0xDD, 0xE5, 0x53, 0x46, 0x7E, 0x84, 0xBA, 0xE8, 0xE6, 0xB2, 0x78, 0x44, 0x2E, 0x87, 0x39, 0x2E, 
+  0x37, 0x37, 0xA8, 0x54, 0x71, 0xA9, 0x87, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x39, 0x37, 0x44, 0x39, 0x82, 0xDD, 0xE5, 
+  0x53, 0x48, 0x7E, 0x8F, 0xBA, 0xE6, 0x97, 0xB2, 0x8B, 0x8B, 0x37, 0x37, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 
+  0x83, 0xAB, 0x5E, 0x94, 0xA6, 0x42, 0x39, 0x80, 0x37, 0x44, 0x39, 0x82, 0xB9, 0xE5, 0x53, 0x48, 0x7E, 0x85, 0x53, 0x7E, 
+  0xE5, 0x98, 0xDD, 0xA6, 0x44, 0x39, 0x84, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x8F, 0x9A, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 
+  0x37, 0x37, 0x39, 0x37, 0x37, 0x39, 0xDD, 0xE5, 0x53, 0x48, 0x7E, 0x85, 0xBA, 0xE8, 0xE6, 0xB2, 0xA6, 0xA8, 0x45, 0x39, 
+  0x83, 0xA8, 0x8D, 0x71, 0xA9, 0x83, 0xAB, 0x54, 0x69, 0xA7, 0x48, 0x2E, 0x82, 0xDD, 0xE5, 0x53, 0x46, 0x7E, 0x84, 0x54, 
+  0xE5, 0x97, 0xB9, 0xA6, 0x47, 0x39, 0x84, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0x83, 0xAE, 0x6A, 0x7E, 0xA7, 0x45, 0x2E, 0x85, 
+  0x2F, 0x2F, 0x92, 0xDD, 0xE5, 0x53, 0x44, 0x7E, 0x87, 0x54, 0xE5, 0xE6, 0xB7, 0xC7, 0x29, 0x2E, 0x37, 0x46, 0x39, 0x84, 
+  0xA8, 0x3A, 0x54, 0x7A, 0xB3, 0x8F, 0x72, 0x8D, 0x53, 0xB4, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x29, 0xDD, 
+  0xE5, 0x53, 0x42, 0x7E, 0x8C, 0x5E, 0xE7, 0x97, 0xDD, 0xDB, 0x17, 0x1B, 0x20, 0x27, 0x29, 0x2F, 0x2E, 0x37, 0x43, 0x39, 
+  0x84, 0xA8, 0xB4, 0x5F, 0xA1, 0xA3, 0x9F, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F, 0x29, 0x28, 0x28, 0x29, 
+  0xDD, 0xE5, 0x53, 0x7E, 0x7E, 0xE7, 0xE6, 0x97, 0x95, 0x28, 0x27, 0x31, 0x24, 0x19, 0x30, 0x1F, 0x2A, 0x29, 0x2E, 0x42, 
+  0x37, 0x85, 0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x85, 0x40, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x43, 0x29, 0x9E, 0x2A, 0x28, 
+  0x92, 0xDD, 0xE5, 0x7E, 0xBA, 0xE6, 0x97, 0xB9, 0x73, 0x2A, 0x2F, 0x2E, 0x20, 0x23, 0x24, 0x31, 0x33, 0x20, 0x2B, 0x28, 
+  0x2E, 0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0xA8, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x2F, 
+  0x29, 0x29, 0x2E, 0xDD, 0x98, 0xE5, 0x97, 0xBB, 0x25, 0x2B, 0x26, 0x27, 0x2F, 0x2E, 0x2A, 0x22, 0x17, 0x24, 0x2C, 0x32, 
+  0x1E, 0x26, 0x27, 0x2A, 0x2F, 0x8B, 0xA7, 0x8D, 0xA1, 0xA3, 0x3F, 0x00, 0xA6, 0x76, 0x7D, 0x6A, 0x5F, 0x27, 0x29, 0x29, 
+  0x28, 0x2F, 0x2E, 0x2F, 0x2E, 0xDD, 0x98, 0xB7, 0x5B, 0x91, 0x20, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2E, 0x2B, 0x32, 0x1C, 
+  0x24, 0x2C, 0x32, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0x88, 0x87, 0xAB, 0x85, 0xBF, 0xBC, 
+  0x92, 0x2F, 0x29, 0x2F, 0x42, 0x2E, 0x99, 0xB2, 0x74, 0x25, 0x91, 0x36, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x29, 
+  0x20, 0x19, 0x1C, 0x1C, 0x31, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x01, 0x01, 0x85, 0x56, 0x71, 0x5F, 0x5F, 
+  0x78, 0x92, 0x42, 0x2F, 0x87, 0x2E, 0x2E, 0x92, 0x1F, 0x32, 0x19, 0x30, 0x26, 0x42, 0x2B, 0x91, 0x29, 0x2F, 0x2E, 0x2E, 
+  0x27, 0x25, 0x19, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x25, 0x84, 0x7D, 0x8C, 0x11, 0x3F, 0x00, 0x02, 0x86, 0xAE, 0x85, 0x6A, 
+  0x84, 0x28, 0x2E, 0x2E, 0x42, 0x2F, 0x99, 0x27, 0x25, 0x19, 0x1A, 0x21, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2F, 0x37, 
+  0x2F, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x01, 0x02, 0x94, 0x3F, 0xC2, 0x85, 0x6A, 
+  0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x1A, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x42, 0x2E, 0x8A, 
+  0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x02, 0x02, 0xA1, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 0xA1, 
+  0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x27, 
+  0x21, 0x1B, 0x6E, 0xC3, 0x7F, 0x8F, 0x8C, 0x81, 0x03, 0x03, 0x8D, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 0x77, 0x63, 
+  0x32, 0x19, 0x1B, 0x25, 0x26, 0x43, 0x2B, 0x8D, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 0x7F, 0x8F, 
+  0x99, 0x76, 0x04, 0x04, 0x92, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 0x26, 0x2B, 0x2B, 
+  0x26, 0x2B, 0x27, 0x29, 0x42, 0x2E, 0x87, 0x8B, 0x8B, 0xC4, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x05, 0x05, 0x9B, 0x3F, 0x4F, 
+  0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 0x8B, 0x27, 0xC7, 
+  0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x06, 0x07, 0x89, 0x40, 0xA4, 0x89, 0x7A, 0x8D, 0x5F, 0x7F, 0x6B, 0xC4, 0x74, 0x42, 
+  0x90, 0x8B, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xBE, 0xC8, 0x40, 0x07, 0x08, 0x96, 0x3F, 0x46, 0xAB, 
+  0x8F, 0x7A, 0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x3F, 
+  0x08, 0x09, 0x80, 0x3F, 0x00, 0x90, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 0x6B, 0x6B, 0xC0, 0x79, 0xC9, 
+  0x79, 0xC8, 0x56, 0x0B, 0x0C, 0x85, 0x3F, 0x87, 0x41, 0xA4, 0xAB, 0xC2, 0x42, 0xCA, 0x85, 0xC3, 0xAB, 0x72, 0x4F, 0x87, 
+  0x3F, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x82, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 
+  0x3F, 0x0B, 0x0A, 0x86, 0x87, 0x46, 0x55, 0xAB, 0x8F, 0x8F, 0x79, 0x42, 0xC9, 0x88, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 
+  0x43, 0x41, 0x3F, 0x0A, 0x08, 0x87, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0xBE, 0xC1, 0x44, 0xCD, 0x43, 0xC9, 0x84, 0xCA, 
+  0x9A, 0xCE, 0xCC, 0x46, 0x09, 0x07, 0x99, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xC4, 0x5A, 0x5B, 0xCF, 0x2C, 0x2C, 
+  0x31, 0xCF, 0xCF, 0xC6, 0xA9, 0xC9, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x40, 0x3F, 0x06, 0x06, 0x9B, 0x81, 0x6F, 0x8C, 0x8C, 
+  0xBE, 0xCD, 0xD0, 0xD1, 0x65, 0x19, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x88, 0x79, 0xC9, 0x79, 
+  0xC2, 0x4E, 0x46, 0x3F, 0x05, 0x05, 0x8E, 0x76, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 
+  0x13, 0x13, 0x42, 0x1D, 0x8B, 0x0B, 0x15, 0x15, 0x0A, 0x35, 0xC6, 0xC9, 0x89, 0x80, 0x75, 0x6C, 0x3F, 0x04, 0x04, 0x9E, 
+  0x76, 0xD2, 0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x19, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 
+  0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x04, 0x03, 0xA0, 0x7B, 0xBC, 0xD2, 0x8C, 0x5C, 0x0B, 
+  0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 
+  0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x03, 0x02, 0xA2, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 
+  0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 
+  0xCD, 0x7A, 0xCA, 0x9A, 0x40, 0x02, 0x01, 0xA4, 0x3F, 0x58, 0xD4, 0xD2, 0xA9, 0x35, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 
+  0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0xD1, 0x38, 
+  0x79, 0x8F, 0x80, 0xA4, 0x3F, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 
+  0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 
+  0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x01, 0x00, 0xA5, 0x87, 0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 
+  0x08, 0xD8, 0xAD, 0x91, 0x91, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x15, 0x17, 0x31, 0x18, 0x19, 0x1A, 0x36, 0x38, 
+  0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x01, 0x00, 0xA6, 0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 
+  0x02, 0x0D, 0xDE, 0xE6, 0xB7, 0xCF, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x08, 0x05, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x31, 0x1A, 
+  0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00, 0xA8, 0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 
+  0x15, 0x05, 0x11, 0x02, 0xD7, 0x97, 0xE9, 0x97, 0xB7, 0xD9, 0x7C, 0x1D, 0x15, 0x08, 0x12, 0x2D, 0x18, 0x19, 0x19, 0x31, 
+  0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 0xC8, 0x3F, 0xA8, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 
+  0x14, 0x24, 0x35, 0x12, 0x06, 0x0E, 0xD7, 0x97, 0x53, 0xBA, 0xE8, 0xE6, 0xDF, 0xD8, 0x05, 0x05, 0x1C, 0x18, 0x19, 0x18, 
+  0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x71, 0x89, 0xCA, 0x87, 0xA8, 0x7B, 0xB4, 0xD2, 0xD4, 0x63, 0x30, 
+  0x38, 0x18, 0x23, 0x18, 0x2D, 0x17, 0x13, 0x15, 0xDE, 0x97, 0x53, 0x7E, 0x7E, 0xBA, 0xE8, 0x97, 0xEA, 0x35, 0x19, 0x19, 
+  0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x65, 0xC0, 0x7D, 0xA1, 0x76, 0x90, 0x08, 0xB4, 0x8C, 0xC7, 
+  0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x19, 0x31, 0x1C, 0xD8, 0x97, 0x53, 0x42, 0x7E, 0x94, 0x53, 0xE7, 0xE6, 0x98, 
+  0xBB, 0x31, 0x2D, 0x23, 0x2C, 0x2C, 0x2D, 0x31, 0x19, 0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8, 0x90, 0x83, 0xB4, 
+  0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x1B, 0x1A, 0xCF, 0x97, 0x53, 0x43, 0x7E, 0x93, 0x53, 0x5E, 
+  0x8D, 0x98, 0x98, 0xBB, 0x2D, 0x6E, 0x18, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 0x89, 0xBD, 0x87, 0xC6, 
+  0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x85, 0x22, 0x22, 0x38, 0x5B, 0x97, 0x53, 0x47, 0x7E, 0x8F, 0xE9, 
+  0xE6, 0x97, 0xAD, 0x1A, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0x90, 0xD3, 0xD4, 0xC1, 0x74, 
+  0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 0x1E, 0xAC, 0x97, 0x53, 0x48, 0x7E, 0x8E, 0x54, 0xE7, 0x97, 0xB7, 
+  0xDB, 0x36, 0x36, 0x22, 0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0x88, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 
+  0x22, 0x42, 0x30, 0x84, 0x22, 0x30, 0xAC, 0x97, 0x53, 0x4A, 0x7E, 0x8C, 0x8D, 0x98, 0x98, 0xDB, 0x22, 0x25, 0x1F, 0x26, 
+  0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0x82, 0xD3, 0xD4, 0xC9, 0x42, 0x21, 0x80, 0x22, 0x43, 0x36, 0x85, 0x32, 0x32, 0x1B, 0x5B, 
+  0x97, 0x53, 0x47, 0x7E, 0x8F, 0x53, 0xBA, 0xE8, 0x98, 0xDB, 0x6D, 0x64, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 
+  0x80, 0x86, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38, 0x42, 0x1B, 0x42, 0x1A, 0x83, 0x19, 0xCF, 0x97, 0x53, 0x46, 0x7E, 
+  0x84, 0x6A, 0xE5, 0x97, 0xB7, 0x61, 0x43, 0x22, 0x87, 0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0x90, 0xD9, 0xD5, 
+  0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x19, 0x31, 0x31, 0xCF, 0x97, 0x53, 0x44, 0x7E, 0x92, 0x54, 0xE5, 
+  0xE6, 0xDF, 0xCF, 0x91, 0x1B, 0x36, 0x33, 0x38, 0x22, 0x21, 0x26, 0x2B, 0x21, 0xD3, 0x54, 0x71, 0x66, 0x8A, 0x06, 0xD5, 
+  0xA1, 0xD0, 0xD1, 0x30, 0x38, 0x1B, 0x19, 0x31, 0x31, 0x42, 0x2D, 0x82, 0xCF, 0x97, 0x53, 0x42, 0x7E, 0x94, 0x54, 0xE7, 
+  0x97, 0xDF, 0xD7, 0x04, 0x12, 0x24, 0x2C, 0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x88, 
+  0x7B, 0xB4, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 0x18, 0xCF, 0x97, 0x53, 0x53, 0x5E, 0xE9, 
+  0xE6, 0x98, 0xDB, 0x17, 0x04, 0x0D, 0x0E, 0x07, 0x13, 0x1C, 0x2C, 0x18, 0x36, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 
+  0x4F, 0x88, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 0x22, 0x32, 0x19, 0x42, 0x31, 0x9C, 0x19, 0x18, 0xCF, 0x97, 0x7E, 0xE7, 
+  0x97, 0x98, 0xB8, 0x17, 0x19, 0x1A, 0x13, 0x11, 0x02, 0x11, 0x05, 0x12, 0x1D, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 
+  0x5F, 0x6B, 0x87, 0xA8, 0x3F, 0xCF, 0xD4, 0x7A, 0xB3, 0x65, 0x30, 0x33, 0x1B, 0x19, 0x18, 0x18, 0x19, 0x19, 0x5B, 0x98, 
+  0xE8, 0x98, 0xD8, 0x35, 0x1D, 0x1C, 0x31, 0x1A, 0x2D, 0x0A, 0x03, 0x02, 0x03, 0x34, 0x15, 0x1D, 0x19, 0x1E, 0x20, 0x6E, 
+  0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x00, 0x89, 0x11, 0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38, 0x1B, 0x1A, 0x42, 0x19, 0x99, 
+  0xCF, 0x98, 0xEA, 0x05, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x19, 0x1A, 0x24, 0x06, 0x0F, 0x02, 0x03, 0x05, 0x13, 0x18, 0x25, 
+  0x91, 0x35, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 0xA5, 0x87, 0xC6, 0x8C, 0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x1B, 
+  0x19, 0x18, 0x17, 0xD6, 0x04, 0x06, 0x13, 0x1D, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x31, 0x13, 0x34, 0x0F, 0x0D, 0x05, 0x35, 
+  0x1A, 0x36, 0x05, 0x75, 0x7E, 0x54, 0x9A, 0x01, 0x01, 0xA4, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x21, 0x1E, 0x22, 0x36, 
+  0x1A, 0x31, 0x0C, 0x05, 0x08, 0x0A, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x17, 0x12, 0x05, 0x08, 0x15, 0x1C, 
+  0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x01, 0x01, 0xA4, 0x3F, 0x88, 0x8C, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x21, 0x22, 
+  0x32, 0x1C, 0x15, 0x08, 0x05, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x1B, 0x19, 0x1C, 0x13, 0x13, 0x24, 0x18, 
+  0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4, 0x3F, 0x01, 0x02, 0xA2, 0x3F, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x21, 0x36, 
+  0x1C, 0x0A, 0x06, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x1A, 0x1B, 0x32, 0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 
+  0x48, 0x4B, 0x53, 0x75, 0x40, 0x02, 0x03, 0xA1, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 
+  0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x36, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 
+  0x46, 0x3F, 0x02, 0x03, 0xA0, 0x3F, 0xE0, 0xBE, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 
+  0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x19, 0x11, 0x4F, 0x48, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x03, 0x04, 
+  0x9D, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 0x8D, 0x66, 0x06, 0x04, 0x0B, 0x19, 0x32, 0x38, 0x36, 0x36, 0x32, 0x32, 0x33, 0x25, 
+  0x20, 0x25, 0x17, 0x7C, 0x0A, 0xE1, 0x48, 0x47, 0x4B, 0x54, 0x4F, 0x05, 0x06, 0x9B, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 
+  0xA4, 0xE0, 0x0E, 0x0A, 0x24, 0x6E, 0x19, 0x19, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x48, 0x48, 0x68, 0x4C, 0x4D, 
+  0x46, 0x3F, 0x05, 0x06, 0x9A, 0x3F, 0x40, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 
+  0xDE, 0xE3, 0xE1, 0x8E, 0x48, 0x48, 0x47, 0x68, 0x53, 0x43, 0x40, 0x3F, 0x06, 0x08, 0x88, 0x87, 0x56, 0xC2, 0x84, 0x5F, 
+  0x54, 0x53, 0x53, 0x4B, 0x42, 0x47, 0x43, 0x48, 0x86, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x08, 0x0B, 0x87, 0x56, 
+  0xA4, 0x84, 0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x43, 0x4B, 0x84, 0x4C, 0x53, 0x4D, 0x43, 0x41, 0x00, 0x80, 0x3F, 0x09, 0x0C, 
+  0x85, 0x3F, 0x87, 0x4F, 0xA4, 0x75, 0x75, 0x42, 0x94, 0x85, 0x4D, 0xCE, 0xCB, 0x41, 0x3F, 0x3F, 0x0C, 0x0D, 0x8C, 0x01, 
+  0x02, 0x0F, 0x04, 0x34, 0x06, 0x15, 0x06, 0x05, 0x04, 0x0F, 0x02, 0x01, 0x0D, 0x0A, 0x85, 0x09, 0x0F, 0x06, 0x07, 0x06, 
+  0x05, 0x43, 0x08, 0x88, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x0A, 0x08, 0x8A, 0x01, 0x0D, 0x07, 0x07, 
+  0x04, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x87, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x09, 0x07, 
+  0x98, 0x01, 0x06, 0x07, 0x0E, 0x0D, 0x16, 0x16, 0x08, 0x24, 0x2D, 0x18, 0x1A, 0x1B, 0x1B, 0x1A, 0x18, 0x24, 0x07, 0x08, 
+  0x07, 0x0B, 0x1D, 0x14, 0x07, 0x09, 0x07, 0x06, 0x88, 0x0F, 0x0A, 0x08, 0x0F, 0x01, 0x0F, 0x1D, 0x30, 0x20, 0x42, 0x1F, 
+  0x43, 0x20, 0x8A, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x15, 0x0A, 0x13, 0x24, 0x24, 0x02, 0x06, 0x04, 0x9D, 0x09, 0x11, 0x0A, 
+  0x04, 0x02, 0x0D, 0x35, 0x30, 0x26, 0x27, 0x2A, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 
+  0x1A, 0x23, 0x12, 0x0C, 0x14, 0x17, 0x03, 0x05, 0x04, 0x9E, 0x0E, 0x12, 0x04, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 
+  0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x32, 0x18, 0x18, 0x30, 0x27, 0x20, 0x1D, 0x0C, 0x14, 0x2C, 
+  0x0F, 0x04, 0x03, 0x88, 0x03, 0x12, 0x08, 0x0D, 0x0E, 0x0C, 0x19, 0x1F, 0x2A, 0x42, 0x2E, 0x94, 0x2B, 0x20, 0x25, 0x22, 
+  0x30, 0x25, 0x1E, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x29, 0x27, 0x17, 0x13, 0x24, 0x23, 0x10, 0x03, 0x02, 0x8F, 
+  0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x30, 0x2B, 0x28, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x42, 0x26, 0x8F, 0x1F, 
+  0x1E, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x27, 0x29, 0x29, 0x17, 0x13, 0x1C, 0x17, 0x01, 0x02, 0x01, 0x8C, 0x01, 0x0A, 
+  0x15, 0x11, 0x34, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x22, 0x25, 0x27, 0x42, 0x2F, 0x89, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 
+  0x1B, 0x19, 0x22, 0x26, 0x42, 0x2F, 0x87, 0x29, 0x29, 0x2A, 0x14, 0x1D, 0x2C, 0x15, 0x09, 0x01, 0x01, 0xA4, 0x11, 0x0C, 
+  0x05, 0x34, 0x23, 0x2D, 0x2D, 0x1C, 0x14, 0x35, 0x17, 0x1F, 0x2F, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x30, 
+  0x1A, 0x32, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x2A, 0x2F, 0x2B, 0x1D, 0x24, 0x32, 0x0F, 0x01, 0x01, 0x98, 0x1D, 0x0A, 
+  0x08, 0x31, 0x38, 0x22, 0x1A, 0x2D, 0x1D, 0x13, 0x23, 0x19, 0x38, 0x26, 0x39, 0x2E, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x33, 
+  0x19, 0x25, 0x2A, 0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x1B, 0x1D, 0x23, 0x24, 0x01, 0x00, 0x98, 0x05, 0x13, 0x06, 0x12, 0x20, 
+  0x26, 0x1F, 0x25, 0x1A, 0x1D, 0x0A, 0x08, 0x04, 0x04, 0x0E, 0x05, 0x1A, 0x27, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x32, 0x2B, 
+  0x47, 0x2F, 0x85, 0x29, 0x2E, 0x1D, 0x24, 0x31, 0x0F, 0x00, 0x8C, 0x01, 0x13, 0x12, 0x08, 0x1E, 0x27, 0x28, 0x27, 0x26, 
+  0x14, 0x05, 0x04, 0x0D, 0x42, 0x01, 0x89, 0x0F, 0x08, 0x15, 0x20, 0x26, 0x26, 0x25, 0x19, 0x21, 0x29, 0x46, 0x2F, 0x87, 
+  0x29, 0x29, 0x2F, 0x21, 0x35, 0x2D, 0x07, 0x3B, 0x8A, 0x0D, 0x1D, 0x0A, 0x13, 0x29, 0x2F, 0x2F, 0x2E, 0x1B, 0x08, 0x03, 
+  0x46, 0x16, 0x86, 0x0E, 0x08, 0x1E, 0x26, 0x33, 0x36, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x27, 0x24, 0x17, 0x2D, 
+  0x09, 0x8F, 0x08, 0x1D, 0x15, 0x36, 0x2F, 0x2E, 0x37, 0x1F, 0x34, 0x0F, 0x16, 0x16, 0x01, 0x03, 0x11, 0x0F, 0x42, 0x16, 
+  0x85, 0x0E, 0x0A, 0x20, 0x1B, 0x1F, 0x2E, 0x43, 0x2F, 0x81, 0x29, 0x29, 0x44, 0x2F, 0x84, 0x2E, 0x23, 0x1C, 0x36, 0x03, 
+  0x97, 0x0A, 0x13, 0x0A, 0x1F, 0x2E, 0x39, 0x39, 0x13, 0x04, 0x16, 0x16, 0x02, 0x34, 0x15, 0x0A, 0x06, 0x04, 0x01, 0x16, 
+  0x01, 0x34, 0x2D, 0x33, 0x29, 0x43, 0x2F, 0x42, 0x29, 0x81, 0x2F, 0x2E, 0x42, 0x2F, 0x84, 0x37, 0x25, 0x14, 0x19, 0x15, 
+  0x96, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 0x27, 0x06, 0x0D, 0x16, 0x01, 0x04, 0x14, 0x27, 0x27, 0x1E, 0x15, 0x0E, 0x3B, 
+  0x16, 0x03, 0x07, 0x27, 0x42, 0x2F, 0x81, 0x29, 0x29, 0x43, 0x2F, 0x44, 0x2E, 0x83, 0x29, 0x1D, 0x2D, 0x1C, 0x99, 0x17, 
+  0x0C, 0x1D, 0x2E, 0x39, 0x39, 0x20, 0x08, 0x16, 0x16, 0x0F, 0x05, 0x39, 0x37, 0x2E, 0x2F, 0x21, 0x05, 0x02, 0x16, 0x10, 
+  0x0E, 0x39, 0x2F, 0x29, 0x29, 0x42, 0x2F, 0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x1D, 0x2C, 0x19, 0x8B, 0x17, 
+  0x0C, 0x14, 0x37, 0x39, 0x39, 0x1A, 0x0E, 0x09, 0x09, 0x0E, 0x19, 0x43, 0x39, 0x86, 0x2E, 0x0A, 0x11, 0x16, 0x01, 0x0E, 
+  0x21, 0x42, 0x2F, 0x82, 0x2E, 0x2E, 0x37, 0x44, 0x3A, 0x42, 0x37, 0x83, 0x39, 0x24, 0x2C, 0x1A, 0x82, 0x17, 0x0C, 0x23, 
+  0x42, 0x39, 0x85, 0x23, 0x08, 0x34, 0x34, 0x04, 0x21, 0x44, 0x39, 0x85, 0x2D, 0x0E, 0x16, 0x16, 0x0E, 0x24, 0x44, 0x39, 
+  0x8C, 0x1F, 0x0E, 0x04, 0x04, 0x0E, 0x13, 0x3A, 0x39, 0x39, 0x3A, 0x23, 0x23, 0x1B, 0x82, 0x17, 0x13, 0x17, 0x42, 0x39, 
+  0x80, 0x2B, 0x43, 0x1F, 0x80, 0x2F, 0x42, 0x37, 0x88, 0x2E, 0x2E, 0x21, 0x0E, 0x01, 0x16, 0x11, 0x12, 0x37, 0x43, 0x39, 
+  0x8C, 0x21, 0x08, 0x10, 0x10, 0x11, 0x23, 0x3A, 0x39, 0x39, 0x3A, 0x17, 0x2C, 0x1B, 0x86, 0x23, 0x13, 0x14, 0x2E, 0x37, 
+  0x2E, 0x37, 0x45, 0x2E, 0x42, 0x2F, 0x91, 0x29, 0x26, 0x04, 0x10, 0x16, 0x0F, 0x06, 0x20, 0x2E, 0x37, 0x39, 0x3A, 0x1C, 
+  0x0E, 0x16, 0x3B, 0x0E, 0x1B, 0x42, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x17, 0x1D, 0x35, 0x2F, 0x46, 0x2E, 0x96, 
+  0x2F, 0x2F, 0x29, 0x28, 0x28, 0x29, 0x39, 0x07, 0x0F, 0x16, 0x16, 0x08, 0x0C, 0x20, 0x27, 0x2E, 0x20, 0x08, 0x02, 0x16, 
+  0x01, 0x34, 0x1F, 0x43, 0x39, 0x82, 0x35, 0x18, 0x2D, 0x83, 0x13, 0x14, 0x1D, 0x2A, 0x43, 0x2E, 0x99, 0x2F, 0x2F, 0x29, 
+  0x29, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x2F, 0x14, 0x08, 0x16, 0x16, 0x0D, 0x08, 0x12, 0x1A, 0x1A, 0x05, 0x0E, 0x01, 0x16, 
+  0x03, 0x15, 0x29, 0x42, 0x39, 0x83, 0x2B, 0x14, 0x32, 0x0B, 0x84, 0x06, 0x1C, 0x13, 0x1F, 0x2E, 0x43, 0x2F, 0x80, 0x29, 
+  0x42, 0x28, 0x80, 0x29, 0x42, 0x2F, 0x97, 0x20, 0x31, 0x05, 0x03, 0x16, 0x16, 0x02, 0x0E, 0x34, 0x08, 0x0F, 0x01, 0x16, 
+  0x01, 0x04, 0x2D, 0x39, 0x37, 0x39, 0x39, 0x1B, 0x17, 0x30, 0x0E, 0x8C, 0x03, 0x17, 0x1D, 0x19, 0x37, 0x2F, 0x29, 0x28, 
+  0x2F, 0x28, 0x2A, 0x28, 0x29, 0x42, 0x2F, 0x98, 0x27, 0x1B, 0x38, 0x23, 0x08, 0x0D, 0x16, 0x16, 0x3B, 0x16, 0x3B, 0x16, 
+  0x16, 0x01, 0x04, 0x12, 0x39, 0x2E, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0x87, 0x10, 0x1C, 0x14, 0x13, 0x2E, 0x2F, 
+  0x29, 0x2A, 0x43, 0x29, 0x42, 0x2F, 0x99, 0x29, 0x1E, 0x19, 0x1E, 0x2B, 0x2C, 0x08, 0x11, 0x01, 0x3B, 0x16, 0x16, 0x3B, 
+  0x0D, 0x04, 0x15, 0x1F, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 0x00, 0x87, 0x0C, 0x17, 0x13, 0x1B, 0x2F, 
+  0x29, 0x28, 0x28, 0x45, 0x2F, 0x98, 0x26, 0x1B, 0x1B, 0x20, 0x2B, 0x2B, 0x19, 0x07, 0x34, 0x11, 0x03, 0x11, 0x08, 0x05, 
+  0x0A, 0x33, 0x21, 0x1F, 0x2B, 0x29, 0x2E, 0x1A, 0x23, 0x33, 0x03, 0x00, 0x00, 0x97, 0x01, 0x18, 0x14, 0x14, 0x27, 0x2F, 
+  0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x30, 0x19, 0x33, 0x1F, 0x2B, 0x26, 0x2A, 0x27, 0x1E, 0x23, 0x43, 0x1D, 
+  0x8A, 0x1C, 0x1A, 0x1B, 0x22, 0x20, 0x2B, 0x21, 0x14, 0x19, 0x19, 0x01, 0x00, 0x00, 0x86, 0x09, 0x12, 0x23, 0x1D, 0x36, 
+  0x2E, 0x2E, 0x42, 0x2F, 0x9B, 0x2E, 0x2F, 0x29, 0x1F, 0x1B, 0x19, 0x30, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x39, 0x39, 
+  0x27, 0x38, 0x2C, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x17, 0x23, 0x30, 0x04, 0x01, 0x01, 0x86, 0x02, 0x17, 0x1C, 0x1D, 
+  0x1E, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x27, 0x22, 0x19, 0x1B, 0x21, 0x2B, 0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2E, 0x2E, 0x29, 
+  0x1F, 0x36, 0x17, 0x14, 0x1C, 0x2D, 0x32, 0x2D, 0x1C, 0x1B, 0x14, 0x09, 0x01, 0x02, 0x94, 0x34, 0x2D, 0x1C, 0x14, 0x2B, 
+  0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x20, 0x36, 0x1A, 0x33, 0x1F, 0x2B, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x42, 0x2E, 0x8A, 0x27, 
+  0x21, 0x19, 0x1C, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x36, 0x02, 0x02, 0x02, 0x8E, 0x3B, 0x06, 0x2D, 0x24, 0x1C, 0x2B, 0x37, 
+  0x2E, 0x29, 0x26, 0x38, 0x19, 0x1B, 0x25, 0x26, 0x42, 0x2B, 0x8F, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x37, 0x29, 0x26, 0x30, 
+  0x19, 0x23, 0x24, 0x14, 0x23, 0x21, 0x08, 0x03, 0x03, 0xA0, 0x01, 0x13, 0x2D, 0x1C, 0x24, 0x1F, 0x2E, 0x27, 0x21, 0x1B, 
+  0x18, 0x32, 0x1E, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2A, 0x1F, 0x38, 0x17, 0x35, 0x17, 
+  0x36, 0x05, 0x09, 0x03, 0x04, 0x9D, 0x01, 0x12, 0x18, 0x1C, 0x14, 0x1B, 0x26, 0x30, 0x1A, 0x1B, 0x38, 0x20, 0x26, 0x2B, 
+  0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2F, 0x1F, 0x17, 0x1D, 0x17, 0x25, 0x05, 0x05, 0x06, 0x89, 0x12, 
+  0x31, 0x23, 0x14, 0x14, 0x19, 0x1A, 0x36, 0x25, 0x1F, 0x44, 0x2B, 0x81, 0x2A, 0x2F, 0x42, 0x2E, 0x87, 0x27, 0x36, 0x13, 
+  0x35, 0x2C, 0x32, 0x08, 0x09, 0x05, 0x07, 0x88, 0x11, 0x2C, 0x19, 0x17, 0x14, 0x14, 0x17, 0x33, 0x26, 0x42, 0x27, 0x8C, 
+  0x2B, 0x27, 0x2A, 0x2F, 0x28, 0x25, 0x23, 0x35, 0x13, 0x24, 0x1B, 0x17, 0x0D, 0x07, 0x08, 0x96, 0x01, 0x0B, 0x2D, 0x31, 
+  0x23, 0x24, 0x1D, 0x14, 0x23, 0x31, 0x1A, 0x1B, 0x19, 0x31, 0x17, 0x13, 0x0C, 0x1D, 0x24, 0x31, 0x19, 0x12, 0x09, 0x08, 
+  0x0A, 0x87, 0x02, 0x06, 0x23, 0x1A, 0x18, 0x23, 0x24, 0x35, 0x43, 0x1D, 0x86, 0x35, 0x1C, 0x2D, 0x1B, 0x23, 0x04, 0x10, 
+  0x0A, 0x0B, 0x8F, 0x3B, 0x09, 0x03, 0x0A, 0x14, 0x2D, 0x18, 0x19, 0x18, 0x19, 0x19, 0x2D, 0x1C, 0x0A, 0x0D, 0x09, 0x0C, 
+  0x0D, 0x8C, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x10, 
+  0x06, 0x13, 0x17, 0x2D, 0x18, 0x1A, 0x19, 0x19, 0x31, 0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 0x02, 0x3B, 0x0A, 0x09, 0x87, 
+  0x0D, 0x15, 0x19, 0x1B, 0x36, 0x36, 0x32, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 0x1A, 0x2C, 0x1D, 0x12, 0x08, 0x10, 0x09, 0x08, 
+  0x85, 0x15, 0x19, 0x33, 0x33, 0x1B, 0x1A, 0x42, 0x1B, 0x8E, 0x18, 0x2D, 0x2D, 0x31, 0x18, 0x19, 0x31, 0x31, 0x1A, 0x1A, 
+  0x31, 0x24, 0x12, 0x0E, 0x09, 0x07, 0x06, 0x9A, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 
+  0x35, 0x1D, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07, 0x10, 0x06, 0x05, 0x9C, 0x0F, 0x1A, 
+  0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x12, 
+  0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x05, 0x04, 0x9E, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C, 0x19, 0x31, 
+  0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x17, 0x13, 
+  0x0D, 0x04, 0x03, 0xA0, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 
+  0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 0x1B, 0x18, 0x23, 0x13, 0x01, 0x03, 0x03, 0xA1, 
+  0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 
+  0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x02, 0xA3, 0x1D, 0x20, 0x25, 
+  0x1A, 0x1D, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 
+  0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 0x09, 0x01, 0x01, 0xA4, 0x0F, 0x1E, 0x21, 0x33, 
+  0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x17, 0x1A, 0x1A, 0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 
+  0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x01, 0x00, 0xA5, 0x09, 0x35, 0x1F, 0x30, 
+  0x1B, 0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x18, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 
+  0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x0B, 0x01, 0x00, 0xA6, 0x0D, 0x2B, 0x21, 
+  0x33, 0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x0D, 0x11, 0x05, 0x0B, 0x1C, 0x2D, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 
+  0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0xA7, 0x09, 0x17, 
+  0x1F, 0x22, 0x30, 0x38, 0x19, 0x23, 0x0C, 0x05, 0x06, 0x08, 0x34, 0x08, 0x0E, 0x0E, 0x08, 0x05, 0x0A, 0x1C, 0x1D, 0x35, 
+  0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x00, 0x8C, 
+  0x10, 0x30, 0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x0B, 0x08, 0x04, 0x02, 0x43, 0x16, 0x97, 0x0D, 0x04, 0x05, 0x13, 
+  0x1D, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x1C, 0x09, 
+  0x8A, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x14, 0x05, 0x03, 0x42, 0x16, 0x80, 0x3B, 0x42, 0x16, 0x96, 0x01, 
+  0x0E, 0x05, 0x0C, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 
+  0x19, 0x0D, 0x90, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x05, 0x11, 0x09, 0x16, 0x01, 0x03, 0x04, 0x0E, 0x0F, 
+  0x42, 0x16, 0x94, 0x08, 0x05, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0x33, 
+  0x18, 0x23, 0x1A, 0x05, 0x9D, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 0x1E, 0x13, 0x04, 0x01, 0x16, 0x01, 0x08, 0x06, 0x1D, 
+  0x12, 0x08, 0x0E, 0x16, 0x16, 0x10, 0x08, 0x13, 0x19, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x42, 0x19, 0x87, 0x36, 0x1E, 
+  0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x9C, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x25, 0x07, 0x11, 0x16, 0x16, 0x04, 0x15, 
+  0x36, 0x32, 0x1A, 0x1C, 0x05, 0x03, 0x16, 0x16, 0x04, 0x12, 0x31, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x42, 0x1A, 0x88, 0x1B, 
+  0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0x9A, 0x1A, 0x20, 0x36, 0x1F, 0x1F, 0x20, 0x33, 0x06, 0x02, 0x16, 0x10, 
+  0x04, 0x1B, 0x1E, 0x30, 0x22, 0x38, 0x1D, 0x04, 0x01, 0x16, 0x03, 0x06, 0x2C, 0x18, 0x19, 0x1A, 0x43, 0x1B, 0x89, 0x32, 
+  0x32, 0x38, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x8D, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x32, 0x05, 0x02, 0x10, 
+  0x0F, 0x06, 0x1E, 0x30, 0x42, 0x25, 0x87, 0x32, 0x04, 0x10, 0x16, 0x0F, 0x06, 0x32, 0x38, 0x43, 0x22, 0x80, 0x1A, 0x42, 
+  0x19, 0x87, 0x1A, 0x1E, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 0x23, 0x99, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21, 0x1A, 0x04, 0x08, 
+  0x08, 0x04, 0x15, 0x33, 0x1B, 0x32, 0x1B, 0x1A, 0x19, 0x08, 0x10, 0x16, 0x0D, 0x05, 0x1A, 0x22, 0x22, 0x42, 0x30, 0x8B, 
+  0x15, 0x08, 0x34, 0x34, 0x04, 0x31, 0x2B, 0x26, 0x1E, 0x14, 0x2C, 0x17, 0x87, 0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 
+  0x33, 0x42, 0x36, 0x9D, 0x32, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x18, 0x06, 0x0D, 0x16, 0x01, 0x05, 0x13, 0x31, 0x1B, 0x33, 
+  0x38, 0x33, 0x07, 0x03, 0x09, 0x01, 0x04, 0x1B, 0x2B, 0x1F, 0x22, 0x1D, 0x2C, 0x1C, 0x87, 0x1C, 0x20, 0x1B, 0x30, 0x30, 
+  0x25, 0x38, 0x1B, 0x42, 0x1A, 0x9D, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x1A, 0x0A, 0x03, 0x16, 0x3B, 0x04, 0x04, 0x07, 
+  0x24, 0x31, 0x1A, 0x2D, 0x05, 0x10, 0x16, 0x10, 0x04, 0x20, 0x27, 0x20, 0x36, 0x35, 0x2C, 0x1D, 0x8B, 0x07, 0x1F, 0x1B, 
+  0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x42, 0x2D, 0x99, 0x18, 0x19, 0x18, 0x07, 0x08, 0x16, 0x16, 0x02, 
+  0x34, 0x11, 0x05, 0x0C, 0x1C, 0x06, 0x0E, 0x3B, 0x16, 0x03, 0x07, 0x2B, 0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x88, 0x11, 
+  0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 0x31, 0x18, 0x19, 0x19, 0x13, 0x08, 0x34, 0x03, 
+  0x16, 0x16, 0x03, 0x05, 0x08, 0x34, 0x05, 0x04, 0x01, 0x16, 0x01, 0x08, 0x2D, 0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 
+  0x9B, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 
+  0x15, 0x08, 0x10, 0x16, 0x16, 0x10, 0x11, 0x0E, 0x0F, 0x42, 0x16, 0x89, 0x0E, 0x07, 0x22, 0x1F, 0x30, 0x2D, 0x35, 0x24, 
+  0x2C, 0x09, 0x88, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x43, 0x18, 0x89, 0x19, 0x19, 0x18, 0x0B, 0x08, 
+  0x0A, 0x1D, 0x07, 0x08, 0x10, 0x46, 0x16, 0x8A, 0x11, 0x08, 0x2C, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A, 0x09, 0x00, 
+  0x89, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x42, 0x19, 0x8A, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 
+  0x1D, 0x07, 0x34, 0x03, 0x10, 0x42, 0x01, 0x8B, 0x0D, 0x08, 0x34, 0x0C, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C, 0x0F, 
+  0x00, 0x00, 0xA6, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A, 0x08, 0x06, 
+  0x0C, 0x1D, 0x1D, 0x14, 0x35, 0x06, 0x08, 0x04, 0x04, 0x08, 0x34, 0x11, 0x34, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x1D, 
+  0x35, 0x01, 0x00, 0x01, 0xA4, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 
+  0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x1A, 0x2C, 0x1C, 0x0C, 0x07, 0x04, 0x11, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13, 
+  0x1C, 0x0E, 0x01, 0x01, 0xA4, 0x01, 0x1A, 0x33, 0x2D, 0x2D, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 
+  0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x16, 0x05, 0x0B, 0x1D, 
+  0x0A, 0x3B, 0x01, 0x02, 0xA2, 0x0D, 0x21, 0x1B, 0x23, 0x19, 0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 
+  0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 
+  0x02, 0x02, 0xA1, 0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 
+  0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x03, 0x03, 0xA0, 
+  0x3B, 0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 
+  0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 0x09, 0x03, 0x04, 0x9D, 0x3B, 0x15, 0x1B, 0x2C, 
+  0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 
+  0x05, 0x05, 0x15, 0x12, 0x1D, 0x08, 0x05, 0x06, 0x8A, 0x0A, 0x19, 0x2C, 0x1C, 0x1D, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 
+  0x45, 0x1B, 0x8A, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 0x0B, 0x13, 0x11, 0x09, 0x05, 0x07, 0x98, 0x03, 0x23, 0x2D, 
+  0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 
+  0x0B, 0x02, 0x07, 0x08, 0x8A, 0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x43, 0x07, 0x86, 0x06, 
+  0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x09, 0x0A, 0x92, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 
+  0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x0A, 0x0C, 0x86, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35, 0x1D, 0x43, 0x13, 
+  0x83, 0x12, 0x05, 0x0F, 0x09, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x82, 0x43, 
+  0x6C, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x43, 0x4A, 0x88, 0x49, 0x48, 0x47, 
+  0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x0A, 0x08, 0x8A, 0x3F, 0x46, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 
+  0x43, 0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 0x3F, 0x08, 0x07, 0x99, 0x3F, 0xCC, 0x48, 0x52, 0x50, 0x51, 
+  0x51, 0x57, 0x8A, 0xC6, 0x59, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x8A, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x87, 0x3F, 
+  0x06, 0x05, 0x88, 0x3F, 0x81, 0x45, 0x49, 0x50, 0x51, 0x52, 0xE2, 0x61, 0x42, 0x63, 0x80, 0x1F, 0x43, 0x20, 0x8A, 0x21, 
+  0x64, 0x65, 0x2C, 0xAB, 0x5D, 0x68, 0x7E, 0x6A, 0x6B, 0x56, 0x06, 0x05, 0x9D, 0x41, 0x45, 0x49, 0x50, 0x51, 0xE2, 0x6D, 
+  0x63, 0x73, 0x2A, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x21, 0x32, 0x2D, 0x6E, 0x5B, 0x6F, 0x45, 0x4C, 0x6A, 
+  0x84, 0xE0, 0x3F, 0x04, 0x03, 0xA0, 0x3F, 0x41, 0x4B, 0x49, 0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 
+  0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x21, 0x32, 0x19, 0x1A, 0x22, 0x73, 0xA5, 0x94, 0x53, 0x6A, 0x7D, 0x76, 0x3F, 0x03, 
+  0x03, 0x88, 0x46, 0x70, 0x49, 0x50, 0x57, 0xA3, 0x6E, 0x21, 0x27, 0x42, 0x2E, 0x84, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x42, 
+  0x1E, 0x8C, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x77, 0x78, 0xC0, 0x7E, 0x5F, 0x8F, 0x81, 0x03, 0x02, 0x8F, 0x3F, 0x4D, 
+  0x47, 0x52, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B, 0x27, 0x42, 0x26, 0x8F, 0x1F, 0x21, 0x1A, 
+  0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x28, 0x71, 0x7E, 0x8D, 0xCA, 0x40, 0x02, 0x01, 0x99, 0x3F, 0x4E, 0x4B, 0x4A, 
+  0x52, 0x83, 0x7C, 0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 
+  0x33, 0x1F, 0x42, 0x2F, 0x87, 0x29, 0x77, 0x27, 0x8D, 0x54, 0x85, 0x86, 0x87, 0x01, 0x01, 0x87, 0x46, 0x4C, 0x47, 0x52, 
+  0x58, 0x6E, 0x18, 0x1C, 0x42, 0x14, 0x99, 0x1E, 0x77, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 
+  0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0xA7, 0x6A, 0x5F, 0xA1, 0x7B, 0x01, 0x00, 0x99, 0x3F, 0x4E, 0x4B, 0x4A, 
+  0x60, 0xD1, 0x30, 0x32, 0x31, 0x14, 0x0B, 0x17, 0x32, 0xE4, 0x74, 0x78, 0x8B, 0x29, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 
+  0x30, 0x27, 0x45, 0x2F, 0x86, 0x2A, 0x8B, 0xCD, 0x5E, 0x85, 0x8A, 0x3F, 0x00, 0x8D, 0x3F, 0x81, 0x5E, 0x68, 0x8E, 0xC7, 
+  0x1F, 0x1F, 0x21, 0x36, 0x24, 0xD9, 0xDF, 0xB1, 0x42, 0xE6, 0x88, 0xB7, 0x9C, 0x2B, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 
+  0x46, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x6A, 0x5F, 0x8F, 0x7B, 0x00, 0x8D, 0x3F, 0x55, 0x53, 0x49, 0x8A, 0x73, 0x28, 0x27, 
+  0x2B, 0x22, 0xB7, 0x97, 0xE5, 0x6A, 0x42, 0x54, 0x88, 0xE7, 0x97, 0xB7, 0x74, 0x2B, 0x21, 0x19, 0x25, 0x29, 0x46, 0x2F, 
+  0x87, 0x29, 0x28, 0x92, 0xA2, 0x54, 0x7D, 0xE3, 0x3F, 0x8C, 0x40, 0x94, 0x4C, 0x49, 0x74, 0x77, 0x2F, 0x2F, 0x27, 0xB9, 
+  0xE6, 0xBA, 0x53, 0x43, 0x7E, 0x87, 0x53, 0x5E, 0xE5, 0x97, 0x74, 0x22, 0x1B, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 
+  0x78, 0x8D, 0x8D, 0xCD, 0x87, 0x97, 0x56, 0x6A, 0x68, 0x67, 0x9B, 0x2E, 0x2E, 0x8B, 0x95, 0x97, 0x5F, 0x7E, 0x7E, 0x54, 
+  0xE7, 0xE7, 0xBA, 0x53, 0x7E, 0x7E, 0xE5, 0xDD, 0x65, 0x20, 0x44, 0x2F, 0x42, 0x29, 0x43, 0x2F, 0x84, 0x8B, 0x71, 0x7F, 
+  0xA1, 0x7B, 0x8C, 0x6C, 0x54, 0x68, 0xC4, 0x8B, 0x39, 0x37, 0x2E, 0x97, 0xE7, 0x53, 0x53, 0xBA, 0x43, 0x97, 0x86, 0xE9, 
+  0x7E, 0x7E, 0x54, 0xE6, 0xDB, 0x77, 0x43, 0x2F, 0x43, 0x29, 0x80, 0x2E, 0x42, 0x2F, 0x84, 0x8B, 0xD5, 0x54, 0x7A, 0xA3, 
+  0xA1, 0xA4, 0x5E, 0x68, 0xA5, 0x2E, 0x39, 0x39, 0x9C, 0xE6, 0x5E, 0x7E, 0xBA, 0x97, 0x9C, 0x27, 0x74, 0x5B, 0x98, 0xE5, 
+  0x53, 0x7E, 0xE9, 0xDD, 0x28, 0x2F, 0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x37, 0x42, 0x2E, 0x83, 0xA6, 0xBF, 
+  0x7D, 0x5C, 0x97, 0x55, 0x5E, 0x70, 0xA7, 0x2E, 0x39, 0x39, 0xDD, 0xE5, 0x7E, 0x7E, 0xE8, 0xB9, 0x37, 0x2E, 0x2F, 0x90, 
+  0xAC, 0xE6, 0x54, 0x7E, 0xBA, 0x97, 0x78, 0x42, 0x29, 0x81, 0x2F, 0x2F, 0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x2E, 0xA8, 
+  0x54, 0x71, 0xA9, 0x99, 0x9A, 0x5E, 0x4D, 0x78, 0x37, 0x39, 0x37, 0xDD, 0xE7, 0x53, 0x5E, 0xE6, 0xAA, 0xA8, 0x39, 0x39, 
+  0x37, 0x8B, 0x97, 0xBA, 0x7E, 0x7E, 0x97, 0x74, 0x2F, 0x2F, 0x42, 0x2E, 0x80, 0x39, 0x44, 0xA8, 0x85, 0x37, 0x37, 0xA8, 
+  0x8D, 0x85, 0x99, 0x86, 0x9A, 0x5E, 0x94, 0xA6, 0x39, 0x39, 0x92, 0x43, 0x97, 0x81, 0xE6, 0xA6, 0x43, 0x39, 0x87, 0xA8, 
+  0xB9, 0xE9, 0x53, 0x53, 0x97, 0xAA, 0xA8, 0x43, 0x39, 0x8B, 0x9C, 0xE6, 0xB1, 0xB1, 0xE6, 0xDD, 0x39, 0x39, 0xA8, 0x71, 
+  0x71, 0xCD, 0x88, 0x9A, 0x54, 0x4D, 0x78, 0x37, 0x39, 0x37, 0x78, 0x78, 0x42, 0xAA, 0x42, 0x37, 0x88, 0x2E, 0x2E, 0x8B, 
+  0xB2, 0xE9, 0x53, 0x53, 0xE8, 0x9C, 0x44, 0x39, 0x8B, 0xB2, 0xE8, 0x6A, 0x6A, 0xE8, 0xB9, 0x39, 0x39, 0xA8, 0x85, 0x71, 
+  0xA9, 0x85, 0xAB, 0x54, 0xBF, 0xA7, 0x2E, 0x37, 0x47, 0x2E, 0x8B, 0x2F, 0x2F, 0x29, 0x29, 0x95, 0xE6, 0x53, 0x7E, 0xE7, 
+  0xDD, 0x8B, 0x37, 0x42, 0x39, 0x8B, 0xDD, 0xE5, 0x7E, 0x7E, 0xE5, 0xB2, 0x39, 0xA8, 0xA8, 0x5F, 0x7D, 0xA9, 0x83, 0xAE, 
+  0x6A, 0x69, 0xA7, 0x47, 0x2E, 0x9C, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2F, 0x74, 0x97, 0x54, 0x7E, 0x54, 0x98, 0xDB, 0x90, 
+  0x2F, 0x8B, 0x74, 0x97, 0x6A, 0x7E, 0x54, 0xE6, 0xAA, 0xA8, 0x39, 0x39, 0x54, 0x7A, 0x5C, 0x84, 0x72, 0xBA, 0x7E, 0x93, 
+  0x8B, 0x43, 0x2E, 0x9F, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2A, 0x29, 0x2F, 0x2F, 0x25, 0xB7, 0xE9, 0x7E, 0x7E, 0xE7, 0x98, 
+  0xB9, 0xE4, 0xB2, 0xB1, 0xE7, 0x53, 0x7E, 0xE7, 0x97, 0xA8, 0x39, 0x39, 0xA7, 0x6A, 0xA1, 0x83, 0x85, 0x76, 0x8D, 0x7E, 
+  0xC9, 0x8B, 0x2E, 0x42, 0x2F, 0x80, 0x29, 0x43, 0x28, 0x42, 0x2F, 0x97, 0x26, 0x1B, 0xAC, 0xE6, 0x6A, 0x7E, 0x7E, 0xBA, 
+  0xE8, 0x97, 0xE8, 0xBA, 0x7E, 0x7E, 0x6A, 0x98, 0x95, 0xA8, 0x39, 0xA8, 0xC1, 0x8D, 0x8C, 0x0E, 0x8C, 0x81, 0x6B, 0x6A, 
+  0xBF, 0x8B, 0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x42, 0x2F, 0x88, 0x28, 0x33, 0x32, 0x2B, 0xB9, 0xE6, 0x54, 
+  0x7E, 0x7E, 0x42, 0x53, 0x8C, 0x7E, 0x53, 0x54, 0xE6, 0xDD, 0x28, 0x2E, 0x39, 0x2E, 0x71, 0x7D, 0xD2, 0x87, 0x8B, 0x3F, 
+  0x66, 0x8D, 0x53, 0xB4, 0x77, 0x2F, 0x28, 0x28, 0x2F, 0x29, 0x29, 0x43, 0x2F, 0x87, 0x1F, 0x1A, 0x30, 0x26, 0x74, 0xB9, 
+  0xE6, 0xE7, 0x44, 0x7E, 0x8B, 0xE7, 0xE6, 0xB9, 0x27, 0x29, 0x2F, 0x2E, 0xA7, 0x8D, 0x89, 0x58, 0x87, 0x88, 0x3F, 0x72, 
+  0x7D, 0x54, 0x8D, 0x28, 0x29, 0x28, 0x28, 0x45, 0x2F, 0x98, 0x27, 0x33, 0x1A, 0x21, 0x2B, 0x2B, 0x2A, 0xB2, 0x97, 0x97, 
+  0xE5, 0xE7, 0xE9, 0x98, 0x97, 0xB7, 0x21, 0x1F, 0x2B, 0x28, 0x8B, 0xC9, 0x85, 0xBE, 0x76, 0x00, 0x00, 0xA6, 0x87, 0xC2, 
+  0x8D, 0xBF, 0x93, 0x77, 0x29, 0x29, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x36, 0x1F, 0x2B, 0x26, 0x2B, 0x29, 
+  0x78, 0xAA, 0xB2, 0xB9, 0xB7, 0xB8, 0xD9, 0x19, 0x1B, 0x22, 0x20, 0x73, 0x93, 0x5F, 0x8F, 0xA9, 0x01, 0x00, 0x00, 0x86, 
+  0x3F, 0x6C, 0x71, 0x6A, 0x84, 0x92, 0x8B, 0x42, 0x2F, 0x9B, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 0x2B, 0x26, 
+  0x2B, 0x29, 0x2F, 0x2E, 0x37, 0x90, 0x22, 0x2D, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x7D, 0x71, 0xBE, 0xE3, 0x01, 0x02, 
+  0x85, 0x66, 0x85, 0x54, 0x89, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 
+  0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x33, 0x23, 0x14, 0x24, 0x2D, 0x65, 0x6F, 0x8D, 0xA1, 0x58, 0x87, 0x01, 0x01, 0x95, 0x3F, 
+  0x81, 0x7D, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x36, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 
+  0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x20, 0x1A, 0x17, 0x1C, 0x17, 0x5C, 0x5F, 0x7A, 0x99, 0x81, 0x02, 0x02, 0x8E, 0x3F, 0x6C, 
+  0x7A, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x43, 0x2B, 0x8F, 0x2A, 0x2F, 0x2F, 0x2E, 
+  0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x6E, 0x88, 0x7F, 0x71, 0xD2, 0xE3, 0x3F, 0x02, 0x03, 0xA0, 0x3F, 0xA4, 0x7A, 0x8D, 0x6A, 
+  0xBC, 0x2F, 0x2A, 0x1F, 0x36, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x28, 
+  0x73, 0x22, 0x6F, 0x6A, 0x84, 0xBE, 0xE3, 0x87, 0x03, 0x04, 0x9D, 0x3F, 0xA4, 0x8F, 0x85, 0x6A, 0x8F, 0xC7, 0x64, 0x1B, 
+  0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x8B, 0x74, 0x8F, 0x7F, 0x6B, 0x8C, 
+  0xE3, 0x05, 0x05, 0x8A, 0x3F, 0xA4, 0xC0, 0x7D, 0x8D, 0x54, 0x6F, 0x5B, 0x65, 0x22, 0x1F, 0x44, 0x2B, 0x8C, 0x27, 0x2F, 
+  0x2E, 0x2E, 0x8B, 0x78, 0xBC, 0x7F, 0xC5, 0x8F, 0xBE, 0xE0, 0x87, 0x05, 0x06, 0x89, 0x3F, 0x4F, 0xC2, 0x89, 0x71, 0x7F, 
+  0x7F, 0x6B, 0xB3, 0x1F, 0x43, 0x90, 0x8B, 0x73, 0x90, 0x77, 0x77, 0xA2, 0x8F, 0x7F, 0x94, 0x84, 0xC9, 0x6F, 0x56, 0x07, 
+  0x07, 0x97, 0x3F, 0x87, 0xA4, 0xCA, 0x7A, 0x71, 0x8D, 0x54, 0x54, 0xC0, 0x79, 0xCD, 0xA9, 0xCD, 0x79, 0x8F, 0x94, 0x4D, 
+  0x75, 0x6B, 0x79, 0xCD, 0xBD, 0x3F, 0x08, 0x09, 0x89, 0x3F, 0x81, 0x72, 0xC2, 0x89, 0x89, 0x7D, 0x84, 0xC5, 0xC5, 0x42, 
+  0x75, 0x87, 0xC5, 0x6B, 0xCA, 0xC1, 0x6F, 0xC8, 0x81, 0x3F, 0x09, 0x0B, 0x85, 0x3F, 0x87, 0x41, 0xAE, 0xC2, 0xCA, 0x42, 
+  0x79, 0x87, 0xC9, 0xC9, 0x79, 0xC3, 0xBD, 0x4F, 0x87, 0x3F, 0x0B, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 
+  0x4E, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x86, 0x3F, 0x46, 0x55, 0x9A, 0xC0, 0x8F, 0x79, 
+  0x42, 0xC9, 0x88, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x0A, 0x08, 0x87, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 
+  0xBE, 0x99, 0xC1, 0x45, 0xCD, 0x88, 0xC1, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x3F, 0x08, 0x07, 0x99, 0x3F, 0xAE, 
+  0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xB3, 0xD3, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 0x6F, 0xA1, 0xA1, 0x79, 0xC2, 
+  0x75, 0x43, 0x3F, 0x3F, 0x06, 0x06, 0x9B, 0x81, 0xC3, 0x8C, 0x8C, 0xBE, 0xCD, 0xD3, 0xD1, 0x65, 0x19, 0x2D, 0x1C, 0x35, 
+  0x1D, 0x24, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x5C, 0x79, 0xC9, 0x79, 0x9A, 0x82, 0x46, 0x3F, 0x05, 0x04, 0x9E, 0x3F, 0x56, 
+  0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 
+  0x0A, 0x35, 0xC6, 0x89, 0x79, 0x80, 0x75, 0x6C, 0x3F, 0x04, 0x04, 0x9E, 0x76, 0xD2, 0xD2, 0x8C, 0xCD, 0x1C, 0x17, 0x2C, 
+  0x19, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 
+  0x80, 0x9A, 0x41, 0x04, 0x03, 0xA1, 0x81, 0xA9, 0xD2, 0x8C, 0x5C, 0x0B, 0x0A, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 
+  0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x6D, 0x99, 0x89, 0xCA, 0x9A, 0x81, 0x3F, 
+  0x02, 0x02, 0xA2, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x0A, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 
+  0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x6D, 0xC9, 0x8F, 0x8F, 0x9A, 0x40, 0x02, 0x01, 
+  0xA4, 0x3F, 0x58, 0xD5, 0xD2, 0xCD, 0x35, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x19, 0x2C, 0x14, 0x1D, 
+  0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x6D, 0x89, 0x89, 0x80, 0xA4, 0x3F, 0x01, 0x01, 
+  0xA5, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0C, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x17, 0x1A, 0x1A, 0x19, 0x2C, 0x14, 0x1D, 
+  0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x3F, 0x00, 
+  0x00, 0xA6, 0x87, 0x58, 0xD5, 0x8C, 0xD3, 0x17, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x6E, 0x1B, 0x19, 0x2D, 
+  0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x91, 0xCD, 0x7D, 0x8F, 0xBD, 
+  0x3F, 0x00, 0x00, 0xA6, 0x81, 0xB4, 0xD4, 0x99, 0x6D, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x7B, 0xDE, 0xEA, 0xB8, 0xDB, 
+  0x5B, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x7D, 
+  0x8F, 0x80, 0x56, 0x00, 0xA7, 0x09, 0x88, 0xB4, 0x8C, 0xA2, 0xD1, 0x19, 0x23, 0x0C, 0x05, 0x07, 0xEA, 0x97, 0x97, 0xE5, 
+  0xE5, 0xE8, 0x97, 0xB7, 0xD9, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 
+  0x91, 0xB3, 0x7D, 0x89, 0x72, 0x00, 0xA8, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x33, 0x1B, 0x18, 0x35, 0x35, 0x98, 0xE6, 0xE7, 
+  0x53, 0x53, 0x7E, 0x53, 0x6A, 0xE5, 0xB1, 0xB8, 0x7C, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 
+  0x36, 0x30, 0x36, 0x5B, 0x84, 0x89, 0xC3, 0x87, 0x8F, 0x7B, 0xB4, 0xD2, 0xBC, 0x63, 0x30, 0x33, 0x18, 0x17, 0x98, 0xE8, 
+  0xBF, 0x7E, 0x7E, 0x53, 0x53, 0x42, 0x7E, 0x95, 0xE7, 0x97, 0xD8, 0x08, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 
+  0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x71, 0x7A, 0xA1, 0x56, 0x89, 0x04, 0xB4, 0x8C, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0xB7, 
+  0xE6, 0x42, 0x7E, 0x9B, 0xBA, 0xE5, 0xE8, 0xE7, 0x54, 0x7E, 0x53, 0xE7, 0x97, 0x06, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 
+  0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0xD1, 0x6F, 0x85, 0xA1, 0x72, 0x9D, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x21, 0x25, 
+  0x5B, 0xB1, 0xBA, 0x7E, 0x53, 0xE5, 0xB1, 0xBB, 0xB8, 0xDF, 0xE6, 0x6A, 0x7E, 0x5E, 0xE6, 0xDF, 0x18, 0x31, 0x2C, 0x23, 
+  0x2C, 0x2D, 0x31, 0x42, 0x19, 0x87, 0x36, 0x1E, 0x20, 0x30, 0xD3, 0xBA, 0x89, 0xBD, 0x9C, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 
+  0x20, 0x21, 0xB7, 0xE8, 0x5E, 0x7E, 0xE7, 0x97, 0x6D, 0x65, 0x1A, 0x17, 0x98, 0xE8, 0x7E, 0x53, 0xE7, 0x97, 0x2C, 0x2C, 
+  0x2D, 0x31, 0x19, 0x19, 0x42, 0x1A, 0x88, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x6D, 0x5F, 0x8F, 0xC3, 0x9A, 0xD3, 0xD5, 0xC1, 
+  0x74, 0x1F, 0x20, 0x1E, 0xB7, 0xE9, 0x7E, 0x5E, 0xE8, 0xB7, 0x64, 0x30, 0x22, 0xD1, 0x5B, 0xE6, 0x6A, 0x7E, 0x6A, 0x97, 
+  0xCF, 0x18, 0x19, 0x1A, 0x43, 0x1B, 0x89, 0x32, 0x32, 0x38, 0x20, 0x1F, 0x1F, 0xD1, 0x5F, 0x7A, 0xCA, 0x8D, 0xD0, 0xD4, 
+  0xC1, 0x74, 0x20, 0x20, 0x25, 0x97, 0xE7, 0x6A, 0xBA, 0xE6, 0x61, 0x30, 0x42, 0x25, 0x87, 0x64, 0xB7, 0xE7, 0x53, 0x53, 
+  0x97, 0x5B, 0x38, 0x43, 0x22, 0x80, 0x6D, 0x42, 0x61, 0x87, 0xAC, 0xE4, 0x26, 0x63, 0x64, 0x8D, 0x7D, 0xCA, 0x9E, 0xD3, 
+  0xD4, 0xC9, 0x21, 0x1E, 0x21, 0x6D, 0x98, 0xE6, 0xB1, 0xB1, 0xE6, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x6E, 0xB7, 0xE9, 0x53, 
+  0x53, 0x97, 0xDB, 0x22, 0x22, 0x30, 0x30, 0x64, 0xDB, 0xE6, 0x42, 0x97, 0x86, 0xDD, 0x2B, 0x26, 0x1E, 0x6A, 0x7D, 0x80, 
+  0x88, 0x5A, 0xD4, 0xA1, 0x25, 0x30, 0x1E, 0x38, 0x65, 0x65, 0x42, 0x91, 0x9C, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x31, 0xBB, 
+  0xE5, 0x53, 0x7E, 0xE9, 0xB8, 0x6E, 0x1B, 0x33, 0x38, 0x22, 0xB7, 0xE8, 0x53, 0x53, 0xE5, 0xB9, 0x2B, 0x26, 0x6D, 0x54, 
+  0x71, 0xCA, 0x87, 0xD9, 0xD5, 0xA1, 0x61, 0x30, 0x25, 0x38, 0x1B, 0x42, 0x1A, 0x9D, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 
+  0x19, 0xAD, 0x98, 0x53, 0x7E, 0x8D, 0x98, 0x07, 0x24, 0x31, 0x1A, 0x32, 0xB7, 0xE9, 0x7E, 0x5E, 0xE8, 0xDB, 0x27, 0x20, 
+  0xD3, 0x54, 0x85, 0x66, 0x8B, 0x06, 0xD5, 0xA1, 0xD0, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x42, 0x2D, 0x99, 
+  0x18, 0x19, 0x18, 0xD6, 0x97, 0xBA, 0x7E, 0x5E, 0xE6, 0xDC, 0x05, 0x0C, 0x17, 0xBB, 0x98, 0xBF, 0x7E, 0x6A, 0xE6, 0xC7, 
+  0x27, 0x64, 0x6F, 0x6A, 0x71, 0xC8, 0x88, 0x11, 0xB4, 0xC1, 0xA9, 0xD1, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 
+  0x31, 0x18, 0x19, 0x19, 0x13, 0x34, 0xDF, 0xE5, 0x7E, 0x7E, 0x6A, 0x98, 0xDF, 0xDF, 0x98, 0x98, 0xBA, 0x7E, 0x53, 0xE5, 
+  0xB7, 0x73, 0x2B, 0x1B, 0xC5, 0x5F, 0x7D, 0x76, 0xA8, 0x0D, 0x93, 0xBE, 0x89, 0xD1, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 
+  0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0xD8, 0x98, 0x85, 0x53, 0x7E, 0x7E, 0xE7, 0xE5, 0xE7, 0xBF, 0x7E, 0x7E, 
+  0x85, 0x97, 0x61, 0x63, 0x30, 0xCF, 0x6A, 0x5F, 0x7D, 0x87, 0x88, 0x3B, 0xD0, 0xD2, 0x7A, 0xD3, 0x32, 0x22, 0x33, 0x1B, 
+  0x43, 0x18, 0x9B, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0xB8, 0x98, 0xE7, 0x53, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x53, 
+  0x8D, 0xE6, 0xBB, 0x1E, 0x1F, 0x2C, 0x88, 0x54, 0x5F, 0x55, 0x3F, 0x00, 0x89, 0x05, 0xB4, 0xA1, 0x8F, 0x32, 0x38, 0x30, 
+  0x33, 0x1B, 0x1A, 0x42, 0x19, 0x99, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0xB8, 0x97, 0xE5, 0x5F, 0x54, 0x5E, 0xBF, 
+  0x6A, 0xE5, 0x97, 0xB8, 0x6E, 0x25, 0x33, 0x7C, 0x94, 0xBF, 0x8D, 0x4F, 0x00, 0x00, 0x97, 0x87, 0xA2, 0xBE, 0x7A, 0xC4, 
+  0x65, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x1D, 0x1D, 0x7C, 0xCF, 0xB7, 0xB1, 0x42, 
+  0xE6, 0x8B, 0xB1, 0xDC, 0xDE, 0x1D, 0x19, 0x30, 0x07, 0xE2, 0x53, 0x54, 0xC5, 0x40, 0x00, 0x01, 0xA5, 0x0E, 0xD4, 0x89, 
+  0x8F, 0x36, 0xD1, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x6E, 0x19, 
+  0xDB, 0xB8, 0xD8, 0x34, 0x11, 0x07, 0x24, 0x1A, 0x06, 0xE0, 0x70, 0x7E, 0x5F, 0x72, 0x3F, 0x00, 0x01, 0xA4, 0x01, 0xC6, 
+  0xBE, 0x7D, 0x79, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 
+  0x1A, 0x1B, 0x6E, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3F, 0x67, 0x4C, 0x5E, 0x55, 0x3F, 0x01, 0x02, 0xA2, 0x0D, 0xD4, 
+  0xA1, 0x71, 0xA9, 0x65, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 
+  0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0xEB, 0x68, 0x53, 0x7F, 0x46, 0x02, 0x02, 0xA2, 0x3F, 0xE0, 0x8C, 0x8F, 
+  0x85, 0xA9, 0x91, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 
+  0x33, 0x38, 0x22, 0x06, 0x3C, 0xEB, 0x68, 0x4C, 0x6A, 0x42, 0x3F, 0x02, 0x03, 0xA0, 0x3B, 0x86, 0xC1, 0x7D, 0x8D, 0x6F, 
+  0x18, 0x6E, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 
+  0x40, 0xEB, 0x47, 0x4B, 0x7E, 0xCB, 0x3F, 0x03, 0x04, 0x9D, 0x3F, 0xE3, 0xA1, 0x71, 0x8D, 0x84, 0x83, 0x06, 0x05, 0x1C, 
+  0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x0A, 0xEC, 0x48, 0x47, 0x4B, 0x5E, 0xCB, 
+  0x05, 0x05, 0x8B, 0x3F, 0x86, 0x89, 0x85, 0x7F, 0x54, 0x55, 0xE0, 0x11, 0x05, 0x17, 0x1A, 0x45, 0x1B, 0x8A, 0x6E, 0x0A, 
+  0x07, 0xA3, 0xE1, 0x49, 0x47, 0x4B, 0x69, 0x42, 0x3F, 0x05, 0x06, 0x89, 0x3F, 0x76, 0x80, 0x85, 0x5F, 0x54, 0x69, 0x4D, 
+  0x55, 0xDE, 0x42, 0x0A, 0x42, 0x05, 0x89, 0x07, 0xA3, 0xE1, 0x8E, 0x48, 0x47, 0x68, 0x4C, 0x4D, 0x46, 0x07, 0x08, 0x96, 
+  0x87, 0xBD, 0x6B, 0x8D, 0x6A, 0xBF, 0x7E, 0x4B, 0x70, 0x67, 0x82, 0x67, 0xE1, 0x5D, 0x48, 0x49, 0x48, 0x47, 0x68, 0x4B, 
+  0x4C, 0x4E, 0x3F, 0x08, 0x09, 0x89, 0x3F, 0x81, 0xA4, 0x6B, 0xBA, 0x54, 0x7E, 0x53, 0x4B, 0x4B, 0x44, 0x68, 0x85, 0x4B, 
+  0x53, 0x4D, 0xCB, 0x46, 0x3F, 0x09, 0x0B, 0x87, 0x3F, 0x87, 0x6C, 0x55, 0xC5, 0x7F, 0x6A, 0x5E, 0x42, 0x7E, 0x85, 0xBF, 
+  0x4D, 0x4E, 0x4F, 0x3F, 0x3F, 0x0B, 0x0D, 0x8C, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x06, 0x15, 0x06, 0x05, 0x04, 0x0F, 0x02, 
+  0x01, 0x0D, 0x0A, 0x85, 0x09, 0x0F, 0x06, 0x07, 0x06, 0x05, 0x43, 0x08, 0x88, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 
+  0x0D, 0x09, 0x0A, 0x08, 0x8A, 0x01, 0x0D, 0x07, 0x07, 0x04, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x87, 0x04, 
+  0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x09, 0x07, 0x98, 0x01, 0x06, 0x07, 0x0E, 0x0D, 0x16, 0x16, 0x08, 0x24, 0x2D, 
+  0x18, 0x1A, 0x1B, 0x1B, 0x1A, 0x18, 0x24, 0x07, 0x08, 0x07, 0x0B, 0x1D, 0x14, 0x07, 0x09, 0x07, 0x06, 0x88, 0x0F, 0x0A, 
+  0x08, 0x0F, 0x01, 0x0F, 0x1D, 0x30, 0x20, 0x42, 0x1F, 0x43, 0x20, 0x8A, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x15, 0x0A, 0x13, 
+  0x24, 0x24, 0x02, 0x06, 0x04, 0x9D, 0x09, 0x11, 0x0A, 0x04, 0x02, 0x0D, 0x35, 0x30, 0x26, 0x27, 0x2A, 0x29, 0x2A, 0x27, 
+  0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 0x2C, 0x2D, 0x1A, 0x23, 0x12, 0x0C, 0x14, 0x17, 0x03, 0x05, 0x04, 0x9E, 0x0E, 
+  0x12, 0x04, 0x0D, 0x11, 0x2C, 0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x32, 
+  0x18, 0x18, 0x30, 0x27, 0x20, 0x1D, 0x0C, 0x14, 0x2C, 0x0F, 0x04, 0x03, 0x88, 0x03, 0x12, 0x08, 0x0D, 0x0E, 0x0C, 0x19, 
+  0x1F, 0x2A, 0x42, 0x2E, 0x94, 0x2B, 0x20, 0x25, 0x22, 0x30, 0x25, 0x1E, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x29, 
+  0x27, 0x17, 0x13, 0x24, 0x23, 0x10, 0x03, 0x02, 0x8F, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x30, 0x2B, 0x28, 
+  0x27, 0x20, 0x1F, 0x27, 0x27, 0x42, 0x26, 0x8F, 0x1F, 0x1E, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x27, 0x29, 0x29, 0x17, 
+  0x13, 0x1C, 0x17, 0x01, 0x02, 0x01, 0x8C, 0x01, 0x0A, 0x15, 0x11, 0x34, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x22, 0x25, 0x27, 
+  0x42, 0x2F, 0x89, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x22, 0x26, 0x42, 0x2F, 0x87, 0x29, 0x29, 0x2A, 0x14, 
+  0x1D, 0x2C, 0x15, 0x09, 0x01, 0x01, 0xA4, 0x11, 0x0C, 0x05, 0x34, 0x23, 0x2D, 0x2D, 0x1C, 0x14, 0x35, 0x17, 0x21, 0x1F, 
+  0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x30, 0x1A, 0x32, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x2A, 0x2F, 0x2B, 
+  0x1D, 0x24, 0x32, 0x0F, 0x01, 0x01, 0x98, 0x1D, 0x0A, 0x08, 0x31, 0x38, 0x22, 0x1A, 0x2D, 0x1D, 0x0C, 0x17, 0x15, 0x06, 
+  0x2B, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x33, 0x19, 0x25, 0x2A, 0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x1B, 0x1D, 0x23, 
+  0x24, 0x01, 0x00, 0x98, 0x05, 0x13, 0x06, 0x12, 0x20, 0x26, 0x1F, 0x25, 0x1A, 0x24, 0x1C, 0x07, 0x04, 0x0E, 0x05, 0x2B, 
+  0x2E, 0x29, 0x27, 0x26, 0x26, 0x20, 0x1A, 0x32, 0x2B, 0x47, 0x2F, 0x85, 0x29, 0x2E, 0x1D, 0x24, 0x31, 0x0F, 0x00, 0x99, 
+  0x01, 0x13, 0x12, 0x08, 0x1E, 0x27, 0x28, 0x27, 0x26, 0x36, 0x36, 0x07, 0x08, 0x01, 0x01, 0x0E, 0x07, 0x26, 0x2F, 0x27, 
+  0x26, 0x26, 0x25, 0x19, 0x21, 0x29, 0x46, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x21, 0x35, 0x2D, 0x07, 0x3B, 0x84, 0x0D, 0x1D, 
+  0x0A, 0x13, 0x29, 0x42, 0x2F, 0x84, 0x2B, 0x1F, 0x0A, 0x04, 0x01, 0x42, 0x16, 0x88, 0x0E, 0x05, 0x26, 0x27, 0x26, 0x26, 
+  0x33, 0x36, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x27, 0x24, 0x17, 0x2D, 0x09, 0x98, 0x08, 0x1D, 0x15, 0x36, 0x2F, 
+  0x2E, 0x2E, 0x2F, 0x26, 0x0A, 0x04, 0x01, 0x16, 0x16, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x1F, 0x26, 0x1F, 0x1B, 0x1F, 0x2E, 
+  0x43, 0x2F, 0x81, 0x29, 0x29, 0x44, 0x2F, 0x84, 0x2E, 0x23, 0x1C, 0x36, 0x03, 0x97, 0x0A, 0x13, 0x0A, 0x1F, 0x2E, 0x39, 
+  0x39, 0x2A, 0x12, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x06, 0x20, 0x1E, 0x36, 0x29, 0x43, 0x2F, 
+  0x42, 0x29, 0x81, 0x2F, 0x2E, 0x42, 0x2F, 0x84, 0x37, 0x25, 0x14, 0x19, 0x15, 0x96, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 
+  0x2F, 0x0A, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x07, 0x0C, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x19, 0x2B, 0x42, 0x2F, 0x81, 
+  0x29, 0x29, 0x43, 0x2F, 0x80, 0x37, 0x43, 0x2E, 0x83, 0x29, 0x1D, 0x2D, 0x1C, 0x99, 0x17, 0x0C, 0x1D, 0x2E, 0x39, 0x2F, 
+  0x0A, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x07, 0x27, 0x29, 0x12, 0x04, 0x01, 0x16, 0x16, 0x0E, 0x05, 0x2B, 0x2F, 0x29, 0x29, 
+  0x42, 0x2F, 0x84, 0x2E, 0x2E, 0x2F, 0x2C, 0x2A, 0x42, 0x37, 0x83, 0x39, 0x1D, 0x2C, 0x19, 0x99, 0x17, 0x0C, 0x14, 0x37, 
+  0x39, 0x1D, 0x08, 0x10, 0x16, 0x16, 0x0E, 0x06, 0x27, 0x39, 0x39, 0x2F, 0x0B, 0x04, 0x01, 0x16, 0x01, 0x0E, 0x15, 0x27, 
+  0x2F, 0x2F, 0x44, 0x2E, 0x89, 0x13, 0x08, 0x0A, 0x2F, 0x39, 0x37, 0x39, 0x24, 0x2C, 0x1A, 0x82, 0x17, 0x0C, 0x23, 0x42, 
+  0x39, 0x85, 0x12, 0x08, 0x01, 0x0E, 0x07, 0x2A, 0x43, 0x39, 0x88, 0x2E, 0x12, 0x04, 0x01, 0x16, 0x16, 0x04, 0x12, 0x2F, 
+  0x43, 0x39, 0x8B, 0x37, 0x14, 0x08, 0x0D, 0x04, 0x0A, 0x28, 0x39, 0x3A, 0x23, 0x23, 0x1B, 0x82, 0x17, 0x13, 0x17, 0x42, 
+  0x39, 0x85, 0x2F, 0x12, 0x08, 0x06, 0x27, 0x39, 0x42, 0x37, 0x8A, 0x2E, 0x2E, 0x2A, 0x07, 0x04, 0x01, 0x16, 0x01, 0x04, 
+  0x0A, 0x2F, 0x42, 0x39, 0x8B, 0x13, 0x08, 0x10, 0x16, 0x01, 0x08, 0x0A, 0x3A, 0x3A, 0x17, 0x2C, 0x1B, 0x89, 0x23, 0x13, 
+  0x14, 0x2E, 0x37, 0x2E, 0x37, 0x37, 0x13, 0x27, 0x42, 0x2E, 0x42, 0x2F, 0x98, 0x29, 0x28, 0x2B, 0x06, 0x04, 0x01, 0x16, 
+  0x01, 0x04, 0x0A, 0x2F, 0x39, 0x14, 0x08, 0x02, 0x16, 0x16, 0x11, 0x05, 0x1F, 0x39, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x17, 
+  0x1D, 0x35, 0x2F, 0x46, 0x2E, 0x97, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x29, 0x2F, 0x26, 0x33, 0x07, 0x04, 0x16, 0x16, 0x01, 
+  0x04, 0x0A, 0x0B, 0x08, 0x10, 0x16, 0x3B, 0x11, 0x08, 0x1F, 0x42, 0x39, 0x82, 0x35, 0x18, 0x2D, 0x83, 0x13, 0x14, 0x1D, 
+  0x2A, 0x43, 0x2E, 0x99, 0x2F, 0x2F, 0x29, 0x29, 0x28, 0x2A, 0x28, 0x29, 0x2F, 0x29, 0x33, 0x20, 0x1F, 0x15, 0x04, 0x01, 
+  0x16, 0x01, 0x04, 0x08, 0x02, 0x16, 0x16, 0x11, 0x05, 0x1F, 0x42, 0x39, 0x83, 0x2B, 0x14, 0x32, 0x0B, 0x84, 0x06, 0x1C, 
+  0x13, 0x1F, 0x2E, 0x43, 0x2F, 0x80, 0x29, 0x42, 0x28, 0x80, 0x29, 0x42, 0x2F, 0x97, 0x20, 0x1B, 0x1F, 0x2B, 0x2B, 0x07, 
+  0x04, 0x16, 0x16, 0x01, 0x01, 0x16, 0x09, 0x11, 0x08, 0x1F, 0x39, 0x37, 0x39, 0x39, 0x1B, 0x17, 0x30, 0x0E, 0x8C, 0x03, 
+  0x17, 0x1D, 0x19, 0x37, 0x2F, 0x29, 0x28, 0x2F, 0x28, 0x2A, 0x28, 0x29, 0x42, 0x2F, 0x89, 0x27, 0x1B, 0x33, 0x26, 0x2B, 
+  0x29, 0x27, 0x15, 0x04, 0x01, 0x42, 0x16, 0x8B, 0x11, 0x05, 0x20, 0x37, 0x2E, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 
+  0x87, 0x10, 0x1C, 0x14, 0x13, 0x2E, 0x2F, 0x29, 0x2A, 0x43, 0x29, 0x42, 0x2F, 0x99, 0x29, 0x1E, 0x19, 0x1E, 0x2B, 0x26, 
+  0x2A, 0x2E, 0x27, 0x07, 0x04, 0x16, 0x09, 0x11, 0x08, 0x1B, 0x27, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 
+  0x00, 0x87, 0x0C, 0x17, 0x13, 0x1B, 0x2F, 0x29, 0x28, 0x28, 0x45, 0x2F, 0x98, 0x26, 0x1B, 0x1B, 0x20, 0x2B, 0x26, 0x2A, 
+  0x2F, 0x2E, 0x27, 0x07, 0x0E, 0x11, 0x05, 0x17, 0x38, 0x21, 0x1F, 0x2B, 0x29, 0x2E, 0x1A, 0x23, 0x33, 0x03, 0x00, 0x00, 
+  0xA6, 0x01, 0x18, 0x14, 0x14, 0x27, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x27, 0x30, 0x19, 0x33, 0x1F, 0x2B, 
+  0x26, 0x27, 0x2F, 0x2E, 0x37, 0x26, 0x06, 0x08, 0x1D, 0x1C, 0x1A, 0x1B, 0x22, 0x20, 0x2B, 0x21, 0x14, 0x19, 0x19, 0x01, 
+  0x00, 0x00, 0x86, 0x09, 0x12, 0x23, 0x1D, 0x36, 0x2E, 0x2E, 0x42, 0x2F, 0x9B, 0x2E, 0x2F, 0x29, 0x1F, 0x1B, 0x19, 0x30, 
+  0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2E, 0x2E, 0x1F, 0x19, 0x2C, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x17, 0x23, 0x30, 
+  0x04, 0x01, 0x01, 0x86, 0x02, 0x17, 0x1C, 0x1D, 0x1E, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x27, 0x22, 0x19, 0x1B, 0x21, 0x2B, 
+  0x2B, 0x26, 0x27, 0x29, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x36, 0x17, 0x14, 0x1C, 0x2D, 0x32, 0x2D, 0x1C, 0x1B, 0x14, 0x09, 
+  0x01, 0x02, 0x94, 0x34, 0x2D, 0x1C, 0x14, 0x2B, 0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x20, 0x36, 0x1A, 0x33, 0x1F, 0x2B, 0x2B, 
+  0x26, 0x2B, 0x29, 0x2F, 0x42, 0x2E, 0x8A, 0x27, 0x21, 0x19, 0x1C, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x36, 0x02, 0x02, 0x02, 
+  0x8E, 0x3B, 0x06, 0x2D, 0x24, 0x1C, 0x2B, 0x37, 0x2E, 0x29, 0x26, 0x38, 0x19, 0x1B, 0x25, 0x26, 0x42, 0x2B, 0x8F, 0x27, 
+  0x28, 0x2F, 0x2F, 0x2E, 0x37, 0x29, 0x26, 0x30, 0x19, 0x23, 0x24, 0x14, 0x23, 0x21, 0x08, 0x03, 0x03, 0xA0, 0x01, 0x13, 
+  0x2D, 0x1C, 0x24, 0x1F, 0x2E, 0x27, 0x21, 0x1B, 0x18, 0x32, 0x1E, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x29, 0x2F, 0x2F, 
+  0x2E, 0x2E, 0x2A, 0x1F, 0x38, 0x17, 0x35, 0x17, 0x36, 0x05, 0x09, 0x03, 0x04, 0x9D, 0x01, 0x12, 0x18, 0x1C, 0x14, 0x1B, 
+  0x26, 0x30, 0x1A, 0x1B, 0x38, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2F, 0x1F, 0x17, 
+  0x1D, 0x17, 0x25, 0x05, 0x05, 0x06, 0x89, 0x12, 0x31, 0x23, 0x14, 0x14, 0x19, 0x1A, 0x36, 0x25, 0x1F, 0x44, 0x2B, 0x81, 
+  0x2A, 0x2F, 0x42, 0x2E, 0x87, 0x27, 0x36, 0x13, 0x35, 0x2C, 0x32, 0x08, 0x09, 0x05, 0x07, 0x88, 0x11, 0x2C, 0x19, 0x17, 
+  0x14, 0x14, 0x17, 0x33, 0x26, 0x42, 0x27, 0x8C, 0x2B, 0x27, 0x2A, 0x2F, 0x28, 0x25, 0x23, 0x35, 0x13, 0x24, 0x1B, 0x17, 
+  0x0D, 0x07, 0x08, 0x96, 0x01, 0x0B, 0x2D, 0x31, 0x23, 0x24, 0x1D, 0x14, 0x23, 0x31, 0x1A, 0x1B, 0x19, 0x31, 0x17, 0x13, 
+  0x0C, 0x1D, 0x24, 0x31, 0x19, 0x12, 0x09, 0x08, 0x0A, 0x87, 0x02, 0x06, 0x23, 0x1A, 0x18, 0x23, 0x24, 0x35, 0x43, 0x1D, 
+  0x86, 0x35, 0x1C, 0x2D, 0x1B, 0x23, 0x04, 0x10, 0x0A, 0x0B, 0x8F, 0x3B, 0x09, 0x03, 0x0A, 0x14, 0x2D, 0x18, 0x19, 0x18, 
+  0x19, 0x19, 0x2D, 0x1C, 0x0A, 0x0D, 0x09, 0x0C, 0x0D, 0x8C, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 
+  0x0D, 0x10, 0x01, 0x0D, 0x0A, 0x92, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18, 0x1A, 0x19, 0x19, 0x31, 0x2C, 0x1C, 0x1D, 
+  0x12, 0x05, 0x11, 0x02, 0x3B, 0x0A, 0x09, 0x87, 0x0D, 0x15, 0x19, 0x1B, 0x36, 0x36, 0x32, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 
+  0x1A, 0x2C, 0x1D, 0x12, 0x08, 0x10, 0x09, 0x08, 0x85, 0x15, 0x19, 0x33, 0x33, 0x1B, 0x1A, 0x42, 0x1B, 0x8E, 0x18, 0x2D, 
+  0x2D, 0x31, 0x18, 0x19, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x07, 0x06, 0x9A, 0x10, 0x17, 0x22, 0x22, 
+  0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 0x35, 0x1D, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 
+  0x1D, 0x07, 0x10, 0x06, 0x05, 0x9C, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13, 
+  0x13, 0x35, 0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x05, 0x04, 0x9E, 0x0F, 0x30, 
+  0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C, 0x19, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 
+  0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x17, 0x13, 0x0D, 0x04, 0x03, 0xA0, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 
+  0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 
+  0x1B, 0x18, 0x23, 0x13, 0x01, 0x03, 0x03, 0xA1, 0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 0x0C, 
+  0x14, 0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 
+  0x0C, 0x01, 0x02, 0x02, 0xA3, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x19, 
+  0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 
+  0x09, 0x01, 0x01, 0xA4, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x17, 0x1A, 0x1A, 0x19, 
+  0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 
+  0x0D, 0x01, 0x00, 0xA5, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0A, 0x31, 0x1B, 
+  0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 
+  0x2D, 0x0B, 0x01, 0x00, 0xA6, 0x0D, 0x2B, 0x21, 0x33, 0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x0D, 0x08, 0x08, 0x0C, 
+  0x1A, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 
+  0x2C, 0x31, 0x17, 0x0D, 0x00, 0xA7, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 0x19, 0x23, 0x0C, 0x05, 0x07, 0x34, 0x08, 0x11, 
+  0x0D, 0x08, 0x13, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 
+  0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x00, 0xA8, 0x10, 0x30, 0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x24, 0x13, 0x05, 
+  0x0E, 0x16, 0x16, 0x0F, 0x08, 0x14, 0x19, 0x23, 0x1D, 0x1D, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 
+  0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x19, 0x1C, 0x09, 0x8B, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x23, 0x1C, 
+  0x05, 0x11, 0x43, 0x16, 0x98, 0x0D, 0x34, 0x13, 0x2C, 0x1D, 0x13, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 
+  0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0xA8, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x23, 
+  0x05, 0x0E, 0x16, 0x16, 0x10, 0x0F, 0x16, 0x16, 0x03, 0x34, 0x1D, 0x35, 0x12, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 
+  0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05, 0x9D, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 0x1E, 
+  0x2C, 0x05, 0x11, 0x16, 0x16, 0x01, 0x08, 0x08, 0x0D, 0x16, 0x16, 0x0F, 0x34, 0x0A, 0x06, 0x1D, 0x19, 0x31, 0x2C, 0x23, 
+  0x2C, 0x2D, 0x31, 0x42, 0x19, 0x87, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0xA8, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 
+  0x20, 0x1B, 0x05, 0x11, 0x16, 0x16, 0x10, 0x08, 0x0A, 0x14, 0x05, 0x0D, 0x16, 0x16, 0x03, 0x34, 0x06, 0x19, 0x31, 0x2C, 
+  0x2D, 0x31, 0x19, 0x19, 0x1A, 0x1A, 0x1B, 0x1A, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0x9A, 0x1A, 0x20, 0x36, 
+  0x1F, 0x1F, 0x1B, 0x05, 0x03, 0x16, 0x16, 0x10, 0x08, 0x0A, 0x30, 0x30, 0x1C, 0x04, 0x0D, 0x16, 0x16, 0x0F, 0x34, 0x0C, 
+  0x2D, 0x18, 0x19, 0x1A, 0x42, 0x1B, 0x8A, 0x32, 0x1A, 0x06, 0x2D, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x97, 0x33, 
+  0x21, 0x32, 0x1F, 0x20, 0x14, 0x08, 0x0D, 0x16, 0x10, 0x08, 0x0A, 0x25, 0x30, 0x25, 0x21, 0x1C, 0x05, 0x0D, 0x16, 0x16, 
+  0x03, 0x34, 0x2C, 0x44, 0x22, 0x8B, 0x30, 0x1B, 0x06, 0x08, 0x04, 0x1B, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 0x23, 0x98, 0x1B, 
+  0x21, 0x1B, 0x20, 0x1E, 0x20, 0x17, 0x08, 0x11, 0x04, 0x0A, 0x32, 0x32, 0x1B, 0x32, 0x1B, 0x1A, 0x13, 0x08, 0x0D, 0x16, 
+  0x16, 0x0F, 0x34, 0x23, 0x43, 0x30, 0x8B, 0x33, 0x06, 0x0E, 0x01, 0x03, 0x05, 0x36, 0x26, 0x1E, 0x14, 0x2C, 0x17, 0xA8, 
+  0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x1D, 0x34, 0x0A, 0x32, 0x1B, 0x1A, 0x19, 0x19, 0x31, 0x2D, 0x18, 0x0B, 0x05, 
+  0x0D, 0x16, 0x16, 0x11, 0x34, 0x23, 0x33, 0x38, 0x1B, 0x06, 0x04, 0x01, 0x16, 0x01, 0x08, 0x07, 0x2B, 0x22, 0x1D, 0x2C, 
+  0x1C, 0xA8, 0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 0x1C, 0x19, 0x1A, 0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x19, 
+  0x1C, 0x05, 0x08, 0x02, 0x16, 0x16, 0x03, 0x34, 0x14, 0x18, 0x06, 0x0E, 0x01, 0x16, 0x01, 0x04, 0x15, 0x1F, 0x20, 0x36, 
+  0x35, 0x2C, 0x1D, 0x8B, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x31, 0x42, 0x2D, 0x99, 0x18, 
+  0x19, 0x18, 0x07, 0x0B, 0x15, 0x34, 0x02, 0x16, 0x16, 0x11, 0x34, 0x34, 0x04, 0x01, 0x16, 0x01, 0x08, 0x07, 0x1F, 0x27, 
+  0x30, 0x18, 0x14, 0x2D, 0x06, 0x88, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 0x31, 
+  0x18, 0x19, 0x19, 0x13, 0x34, 0x13, 0x1D, 0x0A, 0x08, 0x02, 0x16, 0x16, 0x03, 0x0E, 0x01, 0x16, 0x01, 0x04, 0x07, 0x22, 
+  0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 0x98, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 
+  0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0x1D, 0x1D, 0x2C, 0x0B, 0x34, 0x02, 0x43, 0x16, 0x8B, 0x01, 0x04, 0x06, 0x1A, 
+  0x1E, 0x26, 0x30, 0x2D, 0x35, 0x24, 0x2C, 0x09, 0x88, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x43, 0x18, 
+  0x9B, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x31, 0x0B, 0x08, 0x02, 0x16, 0x16, 0x01, 0x04, 0x05, 0x1D, 
+  0x1A, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A, 0x09, 0x00, 0x89, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 
+  0x1A, 0x42, 0x19, 0x99, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x1B, 0x0C, 0x34, 0x02, 0x01, 0x04, 0x08, 
+  0x05, 0x13, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0x98, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 
+  0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x1D, 0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x0B, 0x42, 0x08, 
+  0x8A, 0x0F, 0x05, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x1D, 0x35, 0x01, 0x00, 0x01, 0xA4, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 
+  0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x12, 
+  0x05, 0x08, 0x11, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x01, 0x01, 0xA4, 0x01, 0x1A, 0x33, 0x2D, 0x2D, 
+  0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x31, 
+  0x35, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x16, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x01, 0x02, 0xA2, 0x0D, 0x21, 0x1B, 0x23, 0x19, 
+  0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 
+  0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x02, 0x02, 0xA1, 0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 
+  0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 
+  0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x03, 0x03, 0xA0, 0x3B, 0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 
+  0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 0x01, 0x11, 0x0A, 0x12, 
+  0x13, 0x0E, 0x09, 0x03, 0x04, 0x9D, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 
+  0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 0x15, 0x12, 0x1D, 0x08, 0x05, 0x06, 0x8A, 0x0A, 
+  0x19, 0x2C, 0x1C, 0x1D, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x45, 0x1B, 0x8A, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 
+  0x0B, 0x13, 0x11, 0x09, 0x05, 0x07, 0x98, 0x03, 0x23, 0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 
+  0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 0x0B, 0x02, 0x07, 0x08, 0x8A, 0x09, 0x0A, 0x1C, 0x17, 0x35, 
+  0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x43, 0x07, 0x86, 0x06, 0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x09, 0x0A, 0x92, 0x10, 
+  0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x0A, 0x0C, 
+  0x86, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35, 0x1D, 0x43, 0x13, 0x83, 0x12, 0x05, 0x0F, 0x09, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 
+  0x40, 0x41, 0x42, 0x43, 0x44, 0x44, 0x45, 0x44, 0x82, 0x43, 0x6C, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 
+  0x44, 0x47, 0x48, 0x49, 0x43, 0x4A, 0x88, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x0A, 0x08, 0x8A, 0x3F, 
+  0x46, 0x44, 0x47, 0x4A, 0x50, 0x50, 0x51, 0x50, 0x51, 0x51, 0x43, 0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0x55, 0x56, 
+  0x3F, 0x08, 0x07, 0x99, 0x3F, 0xCC, 0x48, 0x52, 0x50, 0x51, 0x51, 0x57, 0x8A, 0xC6, 0x59, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 
+  0x8A, 0x5D, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 0x55, 0x87, 0x3F, 0x06, 0x05, 0x88, 0x3F, 0x81, 0x45, 0x49, 0x50, 0x51, 0x52, 
+  0xE2, 0x61, 0x42, 0x63, 0x80, 0x1F, 0x43, 0x20, 0x8A, 0x21, 0x64, 0x65, 0x2C, 0xAB, 0x5D, 0x68, 0x7E, 0x6A, 0x6B, 0x56, 
+  0x06, 0x05, 0x9D, 0x41, 0x45, 0x49, 0x50, 0x51, 0xE2, 0x6D, 0x63, 0x73, 0x2A, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 
+  0x26, 0x21, 0x32, 0x2D, 0x6E, 0x5B, 0x6F, 0x45, 0x4C, 0x6A, 0x84, 0xE0, 0x3F, 0x04, 0x03, 0xA0, 0x3F, 0x41, 0x4B, 0x49, 
+  0x50, 0x51, 0x58, 0x64, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x21, 0x32, 0x19, 0x1A, 
+  0x22, 0x73, 0xA5, 0x94, 0x53, 0x6A, 0x7D, 0x76, 0x3F, 0x03, 0x03, 0x88, 0x46, 0x70, 0x49, 0x50, 0x57, 0xA3, 0x6E, 0x21, 
+  0x27, 0x42, 0x2E, 0x84, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x42, 0x1E, 0x8C, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x77, 0x78, 
+  0xC0, 0x7E, 0x5F, 0x8F, 0x81, 0x03, 0x02, 0x8F, 0x3F, 0x4D, 0x47, 0x52, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x2A, 
+  0x20, 0x1F, 0x2B, 0x27, 0x42, 0x26, 0x8F, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x28, 0x71, 0x7E, 
+  0x8D, 0xCA, 0x40, 0x02, 0x01, 0x99, 0x3F, 0x4E, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 
+  0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x42, 0x2F, 0x87, 0x29, 0x77, 0x27, 0x8D, 0x54, 
+  0x85, 0x86, 0x87, 0x01, 0x01, 0xA4, 0x46, 0x4C, 0x47, 0x52, 0x58, 0x6E, 0x18, 0x1C, 0x14, 0x14, 0x7C, 0x61, 0x90, 0x2E, 
+  0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0xA7, 0x6A, 
+  0x5F, 0xA1, 0x7B, 0x01, 0x00, 0x99, 0x3F, 0x4E, 0x4B, 0x4A, 0x60, 0xD1, 0x30, 0x32, 0x31, 0x14, 0x0B, 0xD9, 0x98, 0xB9, 
+  0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 0x45, 0x2F, 0x86, 0x2A, 0x8B, 0xCD, 0x5E, 0x85, 
+  0x8A, 0x3F, 0x00, 0x99, 0x3F, 0x81, 0x5E, 0x68, 0x8E, 0xC7, 0x1F, 0x1F, 0x21, 0x36, 0x24, 0xD9, 0xB1, 0xE5, 0xE6, 0xB9, 
+  0x2E, 0x2F, 0x29, 0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x46, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x6A, 0x5F, 0x8F, 0x7B, 
+  0x00, 0x99, 0x3F, 0x55, 0x53, 0x49, 0x8A, 0x73, 0x28, 0x27, 0x2B, 0x22, 0xDB, 0x97, 0xE9, 0x7E, 0x6A, 0x98, 0xB9, 0x2F, 
+  0x2F, 0x27, 0x26, 0x26, 0x21, 0x19, 0x25, 0x29, 0x46, 0x2F, 0x87, 0x29, 0x28, 0x92, 0xA2, 0x54, 0x7D, 0xE3, 0x3F, 0x98, 
+  0x40, 0x94, 0x4C, 0x49, 0x74, 0x77, 0x2F, 0x2F, 0x90, 0xE4, 0xE6, 0xE7, 0x53, 0x7E, 0x53, 0xBA, 0x98, 0xB2, 0x2F, 0x27, 
+  0x26, 0x26, 0x22, 0x1B, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x29, 0x2F, 0x78, 0x8D, 0x8D, 0xCD, 0x87, 0x97, 0x56, 0x6A, 0x68, 
+  0x67, 0x9B, 0x2E, 0x2E, 0x37, 0xE4, 0x97, 0xE7, 0x7E, 0x7E, 0x6A, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0x2A, 0x26, 0x26, 0x32, 
+  0x20, 0x44, 0x2F, 0x42, 0x29, 0x43, 0x2F, 0x84, 0x8B, 0x71, 0x7F, 0xA1, 0x7B, 0x97, 0x6C, 0x54, 0x68, 0xC4, 0x8B, 0x39, 
+  0x39, 0x74, 0xB1, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB2, 0x2B, 0x20, 0x1B, 0x2A, 0x43, 0x2F, 
+  0x43, 0x29, 0x80, 0x2E, 0x42, 0x2F, 0x84, 0x8B, 0xD5, 0x54, 0x7A, 0xA3, 0x96, 0xA4, 0x5E, 0x68, 0xA5, 0x2E, 0x39, 0xAA, 
+  0x97, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB9, 0x98, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0x38, 0x74, 0x42, 0x2F, 0x87, 0x29, 
+  0x29, 0x2F, 0x29, 0x2F, 0x2F, 0x37, 0x37, 0x42, 0x2E, 0x83, 0xA6, 0xBF, 0x7D, 0x5C, 0x97, 0x55, 0x5E, 0x70, 0xA7, 0x2E, 
+  0xAA, 0xE6, 0xE7, 0x53, 0x7E, 0x6A, 0x98, 0xB9, 0xA8, 0x74, 0x97, 0xE7, 0x7E, 0x7E, 0xBA, 0x98, 0xB7, 0x2F, 0x2F, 0x42, 
+  0x29, 0x8D, 0x2F, 0x2F, 0x2E, 0x2E, 0xAA, 0xB2, 0xA8, 0x2E, 0x37, 0x2E, 0xA8, 0x54, 0x71, 0xA9, 0x96, 0x9A, 0x5E, 0x4D, 
+  0x78, 0xA6, 0x98, 0xE8, 0x7E, 0x7E, 0xBA, 0x98, 0xB2, 0x3A, 0x39, 0x39, 0x74, 0xE6, 0xE7, 0x53, 0x7E, 0x6A, 0xE6, 0xB9, 
+  0x42, 0x2F, 0x42, 0x2E, 0x8B, 0x8B, 0x78, 0x97, 0x97, 0x9C, 0xA8, 0x37, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0x8A, 0x9A, 0x5E, 
+  0x94, 0xA6, 0x39, 0xAA, 0x97, 0xE7, 0x6A, 0x98, 0xB9, 0x44, 0x39, 0x87, 0xAA, 0x97, 0xE7, 0x7E, 0x53, 0x8D, 0x98, 0x9C, 
+  0x44, 0x39, 0x8B, 0x78, 0x98, 0xE5, 0xBA, 0xE6, 0xB2, 0x39, 0x39, 0xA8, 0x71, 0x71, 0xCD, 0x8B, 0x9A, 0x54, 0x4D, 0x78, 
+  0x37, 0x39, 0xAA, 0x98, 0xE6, 0xB2, 0x39, 0x8B, 0x42, 0x37, 0x99, 0x2E, 0x8B, 0x95, 0xE6, 0xE7, 0x53, 0x7E, 0xBA, 0x98, 
+  0xB2, 0xA8, 0x39, 0x39, 0x78, 0x97, 0xE5, 0x7E, 0x7E, 0xE7, 0x97, 0xAA, 0xA8, 0xA8, 0x85, 0x71, 0xA9, 0x88, 0xAB, 0x54, 
+  0xBF, 0xA7, 0x2E, 0x37, 0x37, 0x95, 0xB9, 0x44, 0x2E, 0x9A, 0x2F, 0x2F, 0x29, 0x77, 0x9C, 0x97, 0xE7, 0x7E, 0x7E, 0xE7, 
+  0x98, 0x9C, 0x39, 0x78, 0x98, 0xE5, 0x53, 0x7E, 0x6A, 0xE6, 0xB9, 0x37, 0xA8, 0xA8, 0x5F, 0x7D, 0xA9, 0x83, 0xAE, 0x6A, 
+  0x69, 0xA7, 0x42, 0x2E, 0x81, 0x37, 0x2F, 0x42, 0x2E, 0x82, 0x2F, 0x29, 0x29, 0x42, 0x28, 0x8F, 0x27, 0xDB, 0xB1, 0xE7, 
+  0x53, 0x7E, 0xBA, 0x98, 0xB9, 0x97, 0xE5, 0x7E, 0x7E, 0x6A, 0xE6, 0xB9, 0x43, 0x39, 0x82, 0x54, 0x7A, 0x5C, 0x84, 0x72, 
+  0xBA, 0x7E, 0x93, 0x8B, 0x43, 0x2E, 0x9F, 0x2F, 0x29, 0x29, 0x28, 0x28, 0x2A, 0x29, 0x2F, 0x2F, 0x30, 0x21, 0xAC, 0x97, 
+  0xE7, 0x7E, 0x7E, 0xE7, 0x98, 0xE5, 0x53, 0x7E, 0x54, 0xE6, 0xDD, 0x37, 0x3A, 0x39, 0x39, 0xA7, 0x6A, 0xA1, 0x83, 0x85, 
+  0x76, 0x8D, 0x7E, 0xC9, 0x8B, 0x2E, 0x42, 0x2F, 0x80, 0x29, 0x43, 0x28, 0x42, 0x2F, 0x97, 0x26, 0x1A, 0x1F, 0x2B, 0x95, 
+  0xE6, 0xE7, 0x53, 0x7E, 0x5F, 0x7E, 0x7E, 0x54, 0xE6, 0xB9, 0x2E, 0x37, 0x37, 0x39, 0xA8, 0xC1, 0x8D, 0x8C, 0x0E, 0x8C, 
+  0x81, 0x6B, 0x6A, 0xBF, 0x8B, 0x2F, 0x29, 0x29, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x42, 0x2F, 0x88, 0x28, 0x33, 0x32, 0x26, 
+  0x2B, 0x77, 0x95, 0x97, 0xE7, 0x42, 0x7E, 0x8C, 0x54, 0xE6, 0xDD, 0x28, 0x2E, 0x2F, 0x2E, 0x39, 0x2E, 0x71, 0x7D, 0xD2, 
+  0x87, 0x8B, 0x3F, 0x66, 0x8D, 0x53, 0xB4, 0x77, 0x2F, 0x28, 0x28, 0x2F, 0x29, 0x29, 0x43, 0x2F, 0x98, 0x1F, 0x1A, 0x30, 
+  0x26, 0x26, 0x27, 0x2F, 0x9C, 0xE6, 0xE7, 0x53, 0x54, 0xE6, 0xB7, 0x21, 0x90, 0x2A, 0x29, 0x2F, 0x2E, 0xA7, 0x8D, 0x89, 
+  0x58, 0x87, 0x88, 0x3F, 0x72, 0x7D, 0x54, 0x8D, 0x28, 0x29, 0x28, 0x28, 0x45, 0x2F, 0x98, 0x27, 0x33, 0x1A, 0x21, 0x2B, 
+  0x2B, 0x27, 0x2F, 0x8B, 0x95, 0x97, 0xE7, 0xE6, 0x98, 0x2C, 0x36, 0x21, 0x1F, 0x2B, 0x28, 0x8B, 0xC9, 0x85, 0xBE, 0x76, 
+  0x00, 0x00, 0xA6, 0x87, 0xC2, 0x8D, 0xBF, 0x93, 0x77, 0x29, 0x29, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x36, 
+  0x1F, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x8B, 0x95, 0xB1, 0xB7, 0x24, 0x1C, 0x19, 0x1B, 0x22, 0x20, 0x73, 0x93, 0x5F, 0x8F, 
+  0xA9, 0x01, 0x00, 0x00, 0x86, 0x3F, 0x6C, 0x71, 0x6A, 0x84, 0x92, 0x8B, 0x42, 0x2F, 0x9B, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 
+  0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x8B, 0x95, 0x6D, 0x2D, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x7D, 
+  0x71, 0xBE, 0xE3, 0x01, 0x02, 0x85, 0x66, 0x85, 0x54, 0x89, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 
+  0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x77, 0x26, 0x33, 0x23, 0x14, 0x24, 0x2D, 0x65, 0x6F, 0x8D, 0xA1, 0x58, 
+  0x87, 0x01, 0x01, 0x95, 0x3F, 0x81, 0x7D, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x36, 0x20, 
+  0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x20, 0x1A, 0x17, 0x1C, 0x17, 0x5C, 0x5F, 0x7A, 0x99, 0x81, 
+  0x02, 0x02, 0x8E, 0x3F, 0x6C, 0x7A, 0x85, 0x6A, 0xD4, 0x8B, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x43, 0x2B, 
+  0x8F, 0x2A, 0x2F, 0x2F, 0x2E, 0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x6E, 0x88, 0x7F, 0x71, 0xD2, 0xE3, 0x3F, 0x02, 0x03, 0xA0, 
+  0x3F, 0xA4, 0x7A, 0x8D, 0x6A, 0xBC, 0x2F, 0x2A, 0x1F, 0x36, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x29, 
+  0x2F, 0x2F, 0x2E, 0x2E, 0x28, 0x73, 0x22, 0x6F, 0x6A, 0x84, 0xBE, 0xE3, 0x87, 0x03, 0x04, 0x9D, 0x3F, 0xA4, 0x8F, 0x85, 
+  0x6A, 0x8F, 0xC7, 0x64, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x8B, 
+  0x74, 0x8F, 0x7F, 0x6B, 0x8C, 0xE3, 0x05, 0x05, 0x8A, 0x3F, 0xA4, 0xC0, 0x7D, 0x8D, 0x54, 0x6F, 0x5B, 0x65, 0x22, 0x1F, 
+  0x44, 0x2B, 0x8C, 0x27, 0x2F, 0x2E, 0x2E, 0x8B, 0x78, 0xBC, 0x7F, 0xC5, 0x8F, 0xBE, 0xE0, 0x87, 0x05, 0x06, 0x89, 0x3F, 
+  0x4F, 0xC2, 0x89, 0x71, 0x7F, 0x7F, 0x6B, 0xB3, 0x1F, 0x43, 0x90, 0x8B, 0x73, 0x90, 0x77, 0x77, 0xA2, 0x8F, 0x7F, 0x94, 
+  0x84, 0xC9, 0x6F, 0x56, 0x07, 0x07, 0x97, 0x3F, 0x87, 0xA4, 0xCA, 0x7A, 0x71, 0x8D, 0x54, 0x54, 0xC0, 0x79, 0xCD, 0xA9, 
+  0xCD, 0x79, 0x8F, 0x94, 0x4D, 0x75, 0x6B, 0x79, 0xCD, 0xBD, 0x3F, 0x08, 0x09, 0x89, 0x3F, 0x81, 0x72, 0xC2, 0x89, 0x89, 
+  0x7D, 0x84, 0xC5, 0xC5, 0x42, 0x75, 0x87, 0xC5, 0x6B, 0xCA, 0xC1, 0x6F, 0xC8, 0x81, 0x3F, 0x09, 0x0B, 0x85, 0x3F, 0x87, 
+  0x41, 0xAE, 0xC2, 0xCA, 0x42, 0x79, 0x87, 0xC9, 0xC9, 0x79, 0xC3, 0xBD, 0x4F, 0x87, 0x3F, 0x0B, 0x0B, 0x90, 0x3F, 0x3F, 
+  0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x4E, 0x82, 0x44, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x86, 0x3F, 0x46, 
+  0x55, 0x9A, 0xC0, 0x8F, 0x79, 0x42, 0xC9, 0x88, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x44, 0x43, 0x41, 0x3F, 0x0A, 0x08, 0x87, 
+  0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0x99, 0xC1, 0x45, 0xCD, 0x88, 0xC1, 0xC9, 0xC9, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x3F, 
+  0x08, 0x07, 0x99, 0x3F, 0xAE, 0xC9, 0xBE, 0x99, 0xC1, 0xC9, 0xB3, 0xD3, 0x5B, 0xCF, 0x2C, 0x2C, 0x31, 0xCF, 0xCF, 0xC6, 
+  0x6F, 0xA1, 0xA1, 0x79, 0xC2, 0x75, 0x43, 0x3F, 0x3F, 0x06, 0x06, 0x9B, 0x81, 0xC3, 0x8C, 0x8C, 0xBE, 0xCD, 0xD3, 0xD1, 
+  0x65, 0x19, 0x2D, 0x1C, 0x35, 0x1D, 0x24, 0x24, 0x1C, 0x14, 0x7C, 0x7C, 0x5C, 0x79, 0xC9, 0x79, 0x9A, 0x82, 0x46, 0x3F, 
+  0x05, 0x04, 0x9E, 0x3F, 0x56, 0xCD, 0xD2, 0x8C, 0xCD, 0xD3, 0x6D, 0x65, 0x19, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x35, 
+  0x35, 0x1D, 0x0B, 0x0A, 0x15, 0x0A, 0x35, 0xC6, 0x89, 0x79, 0x80, 0x75, 0x6C, 0x3F, 0x04, 0x04, 0x9E, 0x76, 0xD2, 0xD2, 
+  0x8C, 0xCD, 0x1C, 0x17, 0x2C, 0x19, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 
+  0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x04, 0x03, 0xA1, 0x81, 0xA9, 0xD2, 0x8C, 0x5C, 0x0B, 0x0A, 0x15, 0x1D, 
+  0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x6D, 0x99, 
+  0x89, 0xCA, 0x9A, 0x81, 0x3F, 0x02, 0x02, 0xA2, 0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x0A, 0x11, 0x0D, 0x0E, 0x05, 0x15, 0x12, 
+  0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x1D, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x36, 0x33, 0x33, 0x6D, 0xC9, 0x8F, 
+  0x8F, 0x9A, 0x40, 0x02, 0x01, 0xA4, 0x3F, 0x58, 0xD5, 0xD2, 0xCD, 0x35, 0x34, 0x16, 0x09, 0x16, 0x01, 0x08, 0x1C, 0x1A, 
+  0x19, 0x19, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x6D, 0x89, 0x89, 
+  0x80, 0xA4, 0x3F, 0x01, 0x01, 0xA5, 0x7B, 0xD4, 0xD4, 0x99, 0x2C, 0x0C, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x0A, 0xAD, 0x1A, 
+  0x1A, 0x19, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x05, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x5B, 0x7A, 
+  0x89, 0xC0, 0x56, 0x3F, 0x00, 0x00, 0xA6, 0x87, 0x58, 0xD5, 0x8C, 0xD3, 0x17, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0xDC, 
+  0x97, 0xBB, 0x91, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 
+  0x91, 0xCD, 0x7D, 0x8F, 0xBD, 0x3F, 0x00, 0x00, 0xA6, 0x81, 0xB4, 0xD4, 0x99, 0x6D, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 
+  0xEA, 0xE6, 0xE7, 0xE6, 0xBB, 0x19, 0x31, 0x1C, 0x1D, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 
+  0x36, 0x22, 0x36, 0x1B, 0x7D, 0x8F, 0x80, 0x56, 0x00, 0xA7, 0x09, 0x88, 0xB4, 0x8C, 0xA2, 0xD1, 0x19, 0x23, 0x0C, 0x05, 
+  0x07, 0xDC, 0xE6, 0x6A, 0x53, 0xBA, 0x97, 0xBB, 0x19, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 
+  0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xB3, 0x7D, 0x89, 0x72, 0x00, 0xA8, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x33, 0x1B, 0x18, 
+  0x35, 0x14, 0xDF, 0xE6, 0xBA, 0x7E, 0x7E, 0x53, 0xBA, 0xE6, 0xBB, 0x17, 0x1D, 0x1D, 0x06, 0x05, 0x24, 0x18, 0x19, 0x18, 
+  0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x5B, 0x84, 0x89, 0xC3, 0x87, 0xA8, 0x7B, 0xB4, 0xD2, 0xBC, 0x63, 0x30, 
+  0x33, 0x18, 0x17, 0xB7, 0xE6, 0x6A, 0x7E, 0x53, 0xBA, 0x7E, 0x7E, 0xBA, 0x97, 0xBB, 0x7C, 0x13, 0x34, 0x0C, 0x18, 0x19, 
+  0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x71, 0x7A, 0xA1, 0x56, 0xA8, 0x04, 0xB4, 0x8C, 0xC7, 
+  0x20, 0x1E, 0x30, 0x1A, 0xB7, 0xE6, 0xBA, 0x7E, 0x7E, 0xE9, 0x97, 0xBA, 0x7E, 0x7E, 0x8D, 0xB1, 0xB8, 0x12, 0x05, 0x2C, 
+  0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x19, 0x36, 0x25, 0x20, 0xD1, 0x6F, 0x85, 0xA1, 0x72, 0xA8, 0x83, 0xB4, 
+  0xBE, 0xC7, 0x20, 0x21, 0x25, 0xB7, 0xE6, 0x6A, 0x7E, 0x53, 0xE9, 0xB1, 0xBB, 0x97, 0xE7, 0x7E, 0x7E, 0x8D, 0x97, 0xD6, 
+  0x1D, 0x19, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x1A, 0x65, 0x1E, 0x20, 0x30, 0xD3, 0xBA, 0x89, 0xBD, 0xA8, 
+  0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x21, 0xB9, 0xE6, 0x6A, 0x7E, 0x7E, 0xE9, 0x97, 0xDB, 0x65, 0xBB, 0x98, 0xBA, 0x7E, 0x7E, 
+  0x8D, 0xB1, 0xBB, 0x31, 0x2C, 0x2D, 0x31, 0x19, 0x19, 0x1A, 0x1A, 0x91, 0xBB, 0xDB, 0x1E, 0x1F, 0x21, 0x6D, 0x5F, 0x8F, 
+  0xC3, 0x9A, 0xD3, 0xD5, 0xC1, 0x74, 0x63, 0xAC, 0xE6, 0xE7, 0x53, 0x53, 0xE9, 0xB1, 0xAC, 0x25, 0x30, 0x64, 0xDB, 0x98, 
+  0xE7, 0x53, 0x7E, 0x8D, 0x97, 0xBB, 0x19, 0x19, 0x1A, 0x42, 0x1B, 0x8A, 0x32, 0xB7, 0x97, 0x97, 0xAC, 0x1F, 0x63, 0xD1, 
+  0x5F, 0x7A, 0xCA, 0x8D, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x63, 0xDB, 0x97, 0x85, 0xE9, 0x97, 0xAC, 0x64, 0x30, 0x42, 0x25, 
+  0x88, 0xDB, 0x97, 0xBA, 0x7E, 0x7E, 0x8D, 0xB1, 0xDB, 0x64, 0x43, 0x22, 0x8A, 0xDB, 0x98, 0x8D, 0xE7, 0x98, 0xAC, 0x26, 
+  0x64, 0x8D, 0x7D, 0xCA, 0xA8, 0xD3, 0xD4, 0xC9, 0x21, 0x1E, 0x21, 0x30, 0xDB, 0xE6, 0x98, 0xDB, 0x36, 0x32, 0x1B, 0x32, 
+  0x1B, 0x1A, 0x19, 0xBB, 0x97, 0xE7, 0x7E, 0x7E, 0xE7, 0x97, 0xDB, 0x64, 0x30, 0x30, 0xB7, 0x98, 0xBA, 0x53, 0x53, 0xE5, 
+  0x98, 0x74, 0x1E, 0x6A, 0x7D, 0x80, 0xA8, 0x5A, 0xD4, 0xA1, 0x25, 0x30, 0x1E, 0x38, 0x65, 0xDB, 0x5B, 0x1B, 0x1A, 0x1A, 
+  0x19, 0x19, 0x31, 0x2D, 0x2D, 0x31, 0xDF, 0x97, 0xBA, 0x53, 0x53, 0xE7, 0xE6, 0xDB, 0x38, 0xDB, 0x98, 0x8D, 0x53, 0x7E, 
+  0xE7, 0x97, 0x95, 0x73, 0x6D, 0x54, 0x71, 0xCA, 0xA8, 0xD9, 0xD5, 0xA1, 0x61, 0x30, 0x25, 0x38, 0x1B, 0x91, 0x1A, 0x1A, 
+  0x19, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x19, 0x1C, 0x15, 0xB8, 0x98, 0xBA, 0x53, 0x7E, 0xE7, 0x97, 0xB7, 0x98, 0xBA, 0x53, 
+  0x53, 0xE7, 0xE6, 0xAC, 0x90, 0x20, 0xD3, 0x54, 0x85, 0x66, 0x8B, 0x06, 0xD5, 0xA1, 0xD0, 0x22, 0x30, 0x38, 0x1B, 0x19, 
+  0x18, 0x18, 0x31, 0x42, 0x2D, 0x99, 0x18, 0x19, 0x18, 0x07, 0x12, 0x35, 0xDF, 0x98, 0xBA, 0x7E, 0x53, 0xE7, 0x98, 0x8D, 
+  0x53, 0x7E, 0xE7, 0x97, 0xAC, 0x26, 0x27, 0x64, 0x6F, 0x6A, 0x71, 0xC8, 0x88, 0x11, 0xB4, 0xC1, 0xA9, 0xD1, 0x30, 0x38, 
+  0x1B, 0x18, 0x42, 0x2D, 0x9C, 0x31, 0x31, 0x18, 0x19, 0x19, 0x13, 0x34, 0x13, 0x1D, 0x6E, 0xBB, 0x98, 0x8D, 0x53, 0x7E, 
+  0x54, 0x53, 0x53, 0xE7, 0xE6, 0xDB, 0x1E, 0x26, 0x2B, 0x1B, 0xC5, 0x5F, 0x7D, 0x76, 0xA8, 0x0D, 0x93, 0xBE, 0x89, 0xD1, 
+  0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0x1D, 0x1D, 0x17, 0x19, 0xB7, 0x98, 
+  0xBA, 0x53, 0x7E, 0x7E, 0xE7, 0x97, 0xBB, 0x1B, 0x1E, 0x26, 0x30, 0xCF, 0x6A, 0x5F, 0x7D, 0x87, 0x88, 0x3B, 0xD0, 0xD2, 
+  0x7A, 0xD3, 0x32, 0x22, 0x33, 0x1B, 0x43, 0x18, 0x9B, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 
+  0xBB, 0x98, 0x8D, 0x53, 0xE7, 0xB1, 0xEA, 0x14, 0x19, 0x1E, 0x1F, 0x2C, 0x88, 0x54, 0x5F, 0x55, 0x3F, 0x00, 0x89, 0x05, 
+  0xB4, 0xA1, 0x8F, 0x32, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x42, 0x19, 0x99, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 
+  0x2D, 0x1A, 0x91, 0xDF, 0x98, 0xE9, 0x97, 0xDE, 0x05, 0x13, 0x18, 0x25, 0x33, 0x7C, 0x94, 0xBF, 0x8D, 0x4F, 0x00, 0x00, 
+  0xA6, 0x87, 0xA2, 0xBE, 0x7A, 0xC4, 0x65, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x19, 0x19, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x1D, 
+  0x1D, 0x14, 0x2C, 0x19, 0x1A, 0x2D, 0xB8, 0x97, 0xDE, 0x0D, 0x05, 0x1D, 0x19, 0x30, 0x07, 0xE2, 0x53, 0x54, 0xC5, 0x40, 
+  0x00, 0x01, 0xA5, 0x0E, 0xD4, 0x89, 0x8F, 0x36, 0xD1, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 
+  0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x1C, 0xD6, 0x04, 0x0E, 0x07, 0x24, 0x1A, 0x06, 0xE0, 0x70, 0x7E, 0x5F, 0x72, 
+  0x3F, 0x00, 0x01, 0xA4, 0x01, 0xC6, 0xBE, 0x7D, 0x79, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 
+  0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x7C, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3F, 0x67, 0x4C, 0x5E, 0x55, 
+  0x3F, 0x01, 0x02, 0xA2, 0x0D, 0xD4, 0xA1, 0x71, 0xA9, 0x65, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 
+  0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0xEB, 0x68, 0x53, 0x7F, 0x46, 0x02, 
+  0x02, 0xA2, 0x3F, 0xE0, 0x8C, 0x8F, 0x85, 0xA9, 0x91, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 
+  0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0xEB, 0x68, 0x4C, 0x6A, 0x42, 0x3F, 0x02, 0x03, 0xA0, 
+  0x3B, 0x86, 0xC1, 0x7D, 0x8D, 0x6F, 0x18, 0x6E, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 
+  0x1A, 0x36, 0x1E, 0x20, 0x33, 0x05, 0x40, 0xEB, 0x47, 0x4B, 0x7E, 0xCB, 0x3F, 0x03, 0x04, 0x9D, 0x3F, 0xE3, 0xA1, 0x71, 
+  0x8D, 0x84, 0x83, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x36, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x0A, 
+  0xEC, 0x48, 0x47, 0x4B, 0x5E, 0xCB, 0x05, 0x05, 0x8B, 0x3F, 0x86, 0x89, 0x85, 0x7F, 0x54, 0x55, 0xE0, 0x11, 0x05, 0x17, 
+  0x1A, 0x45, 0x1B, 0x8A, 0x6E, 0x0A, 0x07, 0xA3, 0xE1, 0x49, 0x47, 0x4B, 0x69, 0x42, 0x3F, 0x05, 0x06, 0x89, 0x3F, 0x76, 
+  0x80, 0x85, 0x5F, 0x54, 0x69, 0x4D, 0x55, 0xDE, 0x42, 0x0A, 0x42, 0x05, 0x89, 0x07, 0xA3, 0xE1, 0x8E, 0x48, 0x47, 0x68, 
+  0x4C, 0x4D, 0x46, 0x07, 0x08, 0x96, 0x87, 0xBD, 0x6B, 0x8D, 0x6A, 0xBF, 0x7E, 0x4B, 0x70, 0x67, 0x82, 0x67, 0xE1, 0x5D, 
+  0x48, 0x49, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0x4E, 0x3F, 0x08, 0x09, 0x89, 0x3F, 0x81, 0xA4, 0x6B, 0xBA, 0x54, 0x7E, 0x53, 
+  0x4B, 0x4B, 0x44, 0x68, 0x85, 0x4B, 0x53, 0x4D, 0xCB, 0x46, 0x3F, 0x09, 0x0B, 0x87, 0x3F, 0x87, 0x6C, 0x55, 0xC5, 0x7F, 
+  0x6A, 0x5E, 0x42, 0x7E, 0x85, 0xBF, 0x4D, 0x4E, 0x4F, 0x3F, 0x3F, 0x0B, 0x0C, 0x8F, 0x3B, 0x01, 0x02, 0x0F, 0x0E, 0x34, 
+  0x05, 0x07, 0x06, 0x05, 0x08, 0x03, 0x0D, 0x01, 0x3B, 0x3B, 0x0B, 0x0A, 0x92, 0x3B, 0x10, 0x34, 0x07, 0x07, 0x05, 0x08, 
+  0x04, 0x08, 0x08, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0F, 0x09, 0x0A, 0x08, 0x8A, 0x3B, 0x02, 0x08, 0x0A, 0x08, 
+  0x03, 0x0D, 0x10, 0x02, 0x0D, 0x0F, 0x42, 0x11, 0x88, 0x04, 0x08, 0x06, 0x12, 0x13, 0x14, 0x0A, 0x0D, 0x3B, 0x08, 0x08, 
+  0x97, 0x08, 0x07, 0x04, 0x0D, 0x16, 0x3B, 0x0E, 0x1D, 0x2D, 0x18, 0x19, 0x1B, 0x1B, 0x1A, 0x18, 0x1C, 0x15, 0x34, 0x06, 
+  0x12, 0x1D, 0x14, 0x15, 0x09, 0x07, 0x05, 0x89, 0x3B, 0x01, 0x07, 0x06, 0x03, 0x01, 0x02, 0x0A, 0x33, 0x20, 0x42, 0x1F, 
+  0x43, 0x20, 0x8B, 0x21, 0x30, 0x1B, 0x2C, 0x13, 0x15, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x3B, 0x05, 0x04, 0x9E, 0x3B, 0x0D, 
+  0x0A, 0x34, 0x0D, 0x01, 0x12, 0x36, 0x1F, 0x2B, 0x2A, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x2D, 
+  0x2D, 0x1A, 0x2D, 0x12, 0x0C, 0x14, 0x17, 0x11, 0x3B, 0x04, 0x03, 0xA0, 0x3B, 0x0D, 0x0B, 0x34, 0x0F, 0x0D, 0x35, 0x30, 
+  0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x2B, 0x26, 0x1E, 0x32, 0x18, 0x1A, 0x22, 0x2B, 0x26, 0x1D, 
+  0x0C, 0x14, 0x2C, 0x03, 0x3B, 0x03, 0x03, 0x88, 0x01, 0x12, 0x05, 0x0F, 0x03, 0x0A, 0x2C, 0x21, 0x27, 0x42, 0x2E, 0x84, 
+  0x27, 0x20, 0x1E, 0x22, 0x30, 0x42, 0x1E, 0x8D, 0x30, 0x1B, 0x19, 0x38, 0x1F, 0x27, 0x28, 0x27, 0x2C, 0x0C, 0x24, 0x31, 
+  0x02, 0x3B, 0x02, 0x02, 0x8F, 0x3B, 0x12, 0x07, 0x11, 0x11, 0x15, 0x13, 0x31, 0x33, 0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B, 
+  0x27, 0x42, 0x26, 0x8F, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x29, 0x23, 0x13, 0x1C, 0x23, 0x01, 
+  0x02, 0x01, 0x99, 0x3B, 0x05, 0x12, 0x08, 0x0E, 0x0C, 0x1D, 0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x42, 0x2F, 0x87, 0x29, 0x2F, 0x2A, 0x1C, 0x1D, 0x23, 0x12, 0x09, 
+  0x01, 0x01, 0x87, 0x02, 0x0C, 0x07, 0x0E, 0x14, 0x2C, 0x18, 0x1C, 0x42, 0x14, 0x9A, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 
+  0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1B, 0x0F, 
+  0x3B, 0x00, 0x00, 0x99, 0x09, 0x06, 0x0B, 0x08, 0x35, 0x38, 0x30, 0x32, 0x31, 0x14, 0x0B, 0x1C, 0x32, 0x1F, 0x2F, 0x2E, 
+  0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x32, 0x1D, 0x23, 0x24, 0x01, 
+  0x00, 0x98, 0x10, 0x14, 0x15, 0x05, 0x25, 0x1F, 0x1F, 0x1E, 0x36, 0x24, 0x1C, 0x24, 0x23, 0x38, 0x27, 0x2E, 0x2E, 0x26, 
+  0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x46, 0x2F, 0x86, 0x29, 0x28, 0x2E, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x99, 0x3B, 
+  0x0A, 0x13, 0x05, 0x17, 0x2B, 0x28, 0x27, 0x2B, 0x38, 0x33, 0x1A, 0x23, 0x24, 0x2C, 0x1E, 0x2E, 0x1A, 0x0B, 0x27, 0x26, 
+  0x26, 0x21, 0x19, 0x25, 0x28, 0x46, 0x2F, 0x87, 0x28, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x07, 0x3B, 0x98, 0x01, 0x13, 0x0B, 
+  0x34, 0x2B, 0x29, 0x2F, 0x2F, 0x27, 0x26, 0x26, 0x1E, 0x1B, 0x23, 0x24, 0x18, 0x2C, 0x08, 0x12, 0x2A, 0x26, 0x26, 0x22, 
+  0x1B, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x28, 0x2F, 0x2A, 0x1C, 0x17, 0x1A, 0x09, 0x83, 0x0D, 0x35, 0x0A, 0x13, 0x43, 0x2E, 
+  0x8F, 0x27, 0x28, 0x2A, 0x27, 0x1F, 0x33, 0x2D, 0x15, 0x08, 0x08, 0x12, 0x28, 0x26, 0x26, 0x32, 0x20, 0x44, 0x2F, 0x42, 
+  0x29, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 0x32, 0x03, 0x97, 0x03, 0x35, 0x0A, 0x38, 0x2E, 0x39, 0x37, 0x2E, 0x28, 0x2E, 
+  0x2F, 0x2F, 0x28, 0x20, 0x0A, 0x08, 0x02, 0x11, 0x12, 0x28, 0x26, 0x20, 0x1B, 0x2A, 0x42, 0x2F, 0x80, 0x29, 0x42, 0x28, 
+  0x81, 0x29, 0x2E, 0x42, 0x2F, 0x84, 0x37, 0x1E, 0x35, 0x19, 0x12, 0x96, 0x05, 0x1D, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x2F, 
+  0x2E, 0x39, 0x37, 0x39, 0x1F, 0x07, 0x04, 0x01, 0x3B, 0x0E, 0x05, 0x12, 0x0A, 0x15, 0x15, 0x46, 0x12, 0x83, 0x0A, 0x1F, 
+  0x2E, 0x37, 0x42, 0x2E, 0x83, 0x29, 0x1D, 0x2D, 0x17, 0x87, 0x0A, 0x1D, 0x0B, 0x2B, 0x2E, 0x39, 0x39, 0x2E, 0x42, 0x39, 
+  0x86, 0x25, 0x08, 0x0E, 0x16, 0x16, 0x3B, 0x03, 0x4B, 0x11, 0x8A, 0x08, 0x20, 0x2E, 0x39, 0x2E, 0x37, 0x2E, 0x39, 0x1D, 
+  0x23, 0x18, 0x8C, 0x0C, 0x1D, 0x0C, 0x2A, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x31, 0x34, 0x03, 0x43, 0x16, 0x4B, 0x3B, 
+  0x84, 0x09, 0x34, 0x1F, 0x37, 0x39, 0x42, 0x37, 0x83, 0x3A, 0x1C, 0x23, 0x1B, 0x42, 0x1D, 0x80, 0x2F, 0x42, 0x39, 0x85, 
+  0x37, 0x2E, 0x14, 0x04, 0x0F, 0x3B, 0x4F, 0x16, 0x82, 0x09, 0x34, 0x1F, 0x44, 0x39, 0x83, 0x3A, 0x2C, 0x23, 0x1B, 0x8C, 
+  0x13, 0x1D, 0x1D, 0x28, 0x37, 0x39, 0x39, 0x37, 0x2F, 0x0C, 0x08, 0x0D, 0x3B, 0x4F, 0x16, 0x84, 0x09, 0x34, 0x1F, 0x39, 
+  0x3A, 0x42, 0x39, 0x83, 0x3A, 0x23, 0x2C, 0x1B, 0x85, 0x0C, 0x35, 0x13, 0x27, 0x2E, 0x37, 0x42, 0x2E, 0x83, 0x3A, 0x1C, 
+  0x34, 0x0F, 0x43, 0x16, 0x4B, 0x3B, 0x84, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x42, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 
+  0x0A, 0x14, 0x13, 0x2B, 0x46, 0x2E, 0x86, 0x32, 0x04, 0x11, 0x3B, 0x16, 0x3B, 0x0F, 0x4B, 0x03, 0x81, 0x08, 0x1F, 0x45, 
+  0x39, 0x82, 0x35, 0x18, 0x2D, 0x83, 0x0E, 0x1C, 0x13, 0x1F, 0x44, 0x2E, 0x8A, 0x2F, 0x29, 0x2F, 0x25, 0x06, 0x0E, 0x01, 
+  0x3B, 0x0E, 0x05, 0x15, 0x42, 0x0A, 0x83, 0x15, 0x06, 0x07, 0x15, 0x42, 0x0A, 0x81, 0x15, 0x26, 0x43, 0x39, 0x84, 0x3A, 
+  0x27, 0x14, 0x1B, 0x0C, 0x85, 0x0F, 0x17, 0x13, 0x1A, 0x39, 0x2E, 0x42, 0x2F, 0x80, 0x29, 0x42, 0x28, 0x9B, 0x1F, 0x15, 
+  0x04, 0x01, 0x11, 0x15, 0x20, 0x26, 0x27, 0x28, 0x1F, 0x23, 0x1C, 0x1A, 0x25, 0x26, 0x27, 0x28, 0x2F, 0x39, 0x37, 0x37, 
+  0x39, 0x3A, 0x32, 0x1C, 0x30, 0x0E, 0xA8, 0x02, 0x1C, 0x14, 0x1D, 0x39, 0x2F, 0x29, 0x28, 0x2F, 0x29, 0x2A, 0x28, 0x29, 
+  0x2F, 0x2A, 0x0B, 0x08, 0x04, 0x0A, 0x26, 0x2B, 0x2A, 0x2E, 0x2F, 0x1E, 0x17, 0x1C, 0x19, 0x30, 0x1F, 0x27, 0x29, 0x2E, 
+  0x2F, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0xA8, 0x3B, 0x1D, 0x1C, 0x13, 0x20, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x28, 
+  0x29, 0x2F, 0x2F, 0x2E, 0x2A, 0x24, 0x08, 0x0A, 0x26, 0x26, 0x27, 0x2F, 0x2E, 0x27, 0x36, 0x1C, 0x1C, 0x31, 0x33, 0x20, 
+  0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 0x88, 0x3B, 0x11, 0x2D, 0x35, 0x1C, 0x28, 0x29, 0x28, 0x28, 
+  0x45, 0x2F, 0x98, 0x27, 0x33, 0x13, 0x12, 0x2B, 0x2B, 0x27, 0x2F, 0x2E, 0x2F, 0x26, 0x1A, 0x24, 0x1C, 0x2D, 0x36, 0x21, 
+  0x1F, 0x2B, 0x28, 0x2E, 0x1B, 0x23, 0x33, 0x11, 0x00, 0x00, 0xA6, 0x09, 0x14, 0x1C, 0x1D, 0x20, 0x2F, 0x29, 0x29, 0x2F, 
+  0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x36, 0x30, 0x2B, 0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x28, 0x21, 0x31, 0x24, 0x1C, 
+  0x19, 0x1B, 0x22, 0x20, 0x2B, 0x20, 0x14, 0x18, 0x1B, 0x01, 0x00, 0x01, 0x85, 0x03, 0x2C, 0x14, 0x17, 0x2F, 0x2E, 0x42, 
+  0x2F, 0x9C, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 0x2B, 0x26, 0x2B, 0x28, 0x2F, 0x2E, 0x2E, 0x27, 0x22, 0x2D, 
+  0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x23, 0x23, 0x22, 0x05, 0x3B, 0x00, 0x01, 0x86, 0x16, 0x13, 0x23, 0x35, 0x19, 0x2E, 
+  0x2E, 0x43, 0x2F, 0x99, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x33, 
+  0x23, 0x14, 0x24, 0x2D, 0x1B, 0x31, 0x1C, 0x1B, 0x24, 0x09, 0x01, 0x01, 0x95, 0x3B, 0x10, 0x2C, 0x17, 0x35, 0x1E, 0x39, 
+  0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x32, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x20, 
+  0x1A, 0x17, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x32, 0x0D, 0x02, 0x02, 0x8E, 0x3B, 0x11, 0x2D, 0x1C, 0x14, 0x1E, 0x37, 0x2E, 
+  0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x43, 0x2B, 0x8F, 0x2A, 0x2F, 0x2F, 0x2E, 0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x23, 
+  0x1C, 0x14, 0x23, 0x1E, 0x34, 0x3B, 0x02, 0x03, 0xA0, 0x3B, 0x06, 0x31, 0x17, 0x35, 0x30, 0x2F, 0x2A, 0x1F, 0x32, 0x18, 
+  0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x2E, 0x28, 0x26, 0x22, 0x17, 0x35, 0x17, 0x36, 
+  0x06, 0x09, 0x03, 0x04, 0x9D, 0x3B, 0x08, 0x31, 0x23, 0x14, 0x2D, 0x1F, 0x1E, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 
+  0x26, 0x2B, 0x27, 0x28, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x26, 0x23, 0x35, 0x17, 0x30, 0x15, 0x05, 0x05, 0x8A, 0x3B, 0x08, 
+  0x2D, 0x2D, 0x24, 0x35, 0x31, 0x19, 0x1B, 0x22, 0x1F, 0x44, 0x2B, 0x81, 0x27, 0x2F, 0x42, 0x2E, 0x87, 0x2A, 0x38, 0x1D, 
+  0x35, 0x2C, 0x32, 0x34, 0x09, 0x05, 0x06, 0x89, 0x3B, 0x0D, 0x35, 0x1A, 0x23, 0x14, 0x35, 0x1C, 0x1A, 0x1F, 0x42, 0x27, 
+  0x8C, 0x2B, 0x2B, 0x27, 0x29, 0x29, 0x1E, 0x2C, 0x35, 0x13, 0x14, 0x1A, 0x2C, 0x0D, 0x07, 0x08, 0x96, 0x09, 0x05, 0x17, 
+  0x18, 0x23, 0x24, 0x1D, 0x1D, 0x23, 0x31, 0x1A, 0x32, 0x1A, 0x31, 0x23, 0x1D, 0x0C, 0x13, 0x14, 0x2D, 0x19, 0x0B, 0x3B, 
+  0x08, 0x09, 0x88, 0x3B, 0x01, 0x04, 0x14, 0x1A, 0x18, 0x2C, 0x1C, 0x14, 0x43, 0x1D, 0x87, 0x35, 0x1C, 0x2D, 0x1B, 0x2C, 
+  0x06, 0x02, 0x3B, 0x09, 0x0B, 0x85, 0x3B, 0x09, 0x0D, 0x07, 0x35, 0x2C, 0x43, 0x18, 0x86, 0x19, 0x31, 0x1C, 0x0A, 0x0F, 
+  0x09, 0x3B, 0x0B, 0x0C, 0x8E, 0x3B, 0x01, 0x02, 0x0F, 0x04, 0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x3B, 
+  0x0C, 0x0A, 0x92, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18, 0x1A, 0x19, 0x18, 0x31, 0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 
+  0x02, 0x3B, 0x0A, 0x08, 0x88, 0x3B, 0x0D, 0x15, 0x18, 0x1B, 0x36, 0x36, 0x32, 0x1B, 0x45, 0x1A, 0x87, 0x1B, 0x1A, 0x2C, 
+  0x35, 0x12, 0x08, 0x10, 0x3B, 0x08, 0x07, 0x86, 0x3B, 0x15, 0x18, 0x33, 0x33, 0x1B, 0x1A, 0x42, 0x1B, 0x8E, 0x18, 0x2D, 
+  0x2D, 0x31, 0x18, 0x18, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 0x12, 0x0E, 0x09, 0x07, 0x05, 0x9C, 0x3B, 0x10, 0x17, 0x22, 
+  0x22, 0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 0x35, 0x35, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 
+  0x2D, 0x1D, 0x07, 0x10, 0x3B, 0x05, 0x04, 0x8F, 0x3B, 0x0F, 0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 
+  0x17, 0x14, 0x13, 0x13, 0x42, 0x35, 0x8B, 0x0B, 0x0A, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x3B, 0x04, 
+  0x03, 0xA0, 0x3B, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 0x2C, 0x18, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 
+  0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x17, 0x13, 0x0D, 0x3B, 0x03, 0x03, 0xA1, 0x10, 0x32, 
+  0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 
+  0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 0x1B, 0x18, 0x23, 0x13, 0x01, 0x3B, 0x02, 0x02, 0xA2, 0x3B, 0x19, 0x21, 0x30, 0x2C, 
+  0x15, 0x11, 0x0D, 0x0E, 0x34, 0x15, 0x12, 0x0C, 0x14, 0x23, 0x1C, 0x35, 0x1D, 0x35, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 
+  0x31, 0x32, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x01, 0xA4, 0x3B, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 
+  0x16, 0x09, 0x3B, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 
+  0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 0x09, 0x01, 0x01, 0xA5, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E, 
+  0x0D, 0x3C, 0x3D, 0x16, 0x15, 0x17, 0x1A, 0x1A, 0x18, 0x2C, 0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x34, 0x0C, 0x2C, 0x2D, 
+  0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x3B, 0x00, 0x00, 0xA5, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 
+  0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x31, 0x1B, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 
+  0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x0B, 0x01, 0xA7, 0x3B, 0x0D, 0x2B, 0x21, 0x33, 0x33, 
+  0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x10, 0x0F, 0x05, 0x24, 0x1A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B, 0x34, 0x34, 0x1D, 
+  0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 0x2C, 0x31, 0x17, 0x0D, 0x00, 0xA8, 0x09, 0x17, 0x1F, 0x22, 
+  0x30, 0x38, 0x18, 0x23, 0x0C, 0x34, 0x07, 0x34, 0x11, 0x10, 0x0F, 0x0A, 0x2D, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 
+  0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x3B, 0xA8, 0x10, 0x30, 
+  0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x14, 0x1D, 0x0A, 0x05, 0x11, 0x02, 0x11, 0x13, 0x1A, 0x2D, 0x1C, 0x35, 0x1D, 
+  0x06, 0x34, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x1C, 0x09, 0xA8, 
+  0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x23, 0x31, 0x2D, 0x1C, 0x0C, 0x07, 0x0E, 0x02, 0x04, 0x14, 0x05, 0x35, 
+  0x35, 0x13, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 
+  0x0D, 0xA8, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1A, 0x1B, 0x1A, 0x18, 0x2C, 0x14, 0x12, 0x08, 0x0F, 0x08, 
+  0x08, 0x14, 0x35, 0x12, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 0x23, 0x2C, 0x2D, 0x2D, 0x18, 0x32, 0x25, 0x20, 0x33, 0x18, 
+  0x23, 0x1A, 0x05, 0x87, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 0x25, 0x1B, 0x42, 0x33, 0x9D, 0x32, 0x1B, 0x18, 0x2C, 0x15, 
+  0x34, 0x0F, 0x08, 0x1C, 0x35, 0x06, 0x35, 0x18, 0x31, 0x2C, 0x23, 0x2C, 0x2D, 0x31, 0x18, 0x19, 0x19, 0x36, 0x1E, 0x20, 
+  0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x87, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x9D, 0x22, 0x22, 0x36, 
+  0x13, 0x08, 0x03, 0x09, 0x34, 0x14, 0x13, 0x15, 0x2C, 0x23, 0x1C, 0x17, 0x23, 0x2C, 0x2D, 0x2D, 0x31, 0x31, 0x1B, 0x33, 
+  0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0x92, 0x1A, 0x20, 0x32, 0x1F, 0x1F, 0x20, 0x1E, 0x22, 0x25, 0x1E, 0x25, 0x25, 
+  0x30, 0x0A, 0x08, 0x02, 0x3B, 0x09, 0x34, 0x4B, 0x05, 0x89, 0x08, 0x33, 0x38, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 
+  0x91, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x25, 0x36, 0x06, 0x04, 0x10, 0x3B, 0x16, 0x3B, 0x4B, 
+  0x02, 0x8A, 0x0F, 0x04, 0x25, 0x25, 0x1F, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 0x23, 0x8E, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21, 
+  0x30, 0x33, 0x36, 0x33, 0x2C, 0x05, 0x0E, 0x01, 0x3B, 0x4E, 0x16, 0x8A, 0x10, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 
+  0x14, 0x2C, 0x17, 0x8C, 0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x1B, 0x1B, 0x17, 0x04, 0x0E, 0x3B, 0x50, 0x16, 0x8A, 
+  0x10, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x35, 0x2C, 0x1C, 0x8D, 0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 
+  0x1A, 0x18, 0x0B, 0x08, 0x0F, 0x3B, 0x4F, 0x16, 0x8A, 0x10, 0x04, 0x1E, 0x21, 0x26, 0x2B, 0x20, 0x32, 0x35, 0x2C, 0x1D, 
+  0x8D, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x0B, 0x34, 0x0F, 0x4F, 0x16, 0x8A, 0x02, 0x04, 
+  0x30, 0x1E, 0x26, 0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x88, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x42, 
+  0x2D, 0x85, 0x14, 0x34, 0x11, 0x16, 0x16, 0x3B, 0x4D, 0x04, 0x88, 0x38, 0x1E, 0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 
+  0xA8, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 0x2D, 0x2D, 0x31, 0x18, 0x1C, 0x05, 0x0E, 0x01, 0x09, 0x34, 
+  0x07, 0x15, 0x12, 0x0C, 0x0C, 0x15, 0x08, 0x11, 0x04, 0x34, 0x06, 0x15, 0x0A, 0x1B, 0x1E, 0x26, 0x30, 0x2D, 0x35, 0x24, 
+  0x2C, 0x09, 0x88, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 0x33, 0x1B, 0x43, 0x18, 0x9B, 0x1A, 0x2D, 0x07, 0x08, 0x01, 
+  0x34, 0x0B, 0x35, 0x17, 0x18, 0x1B, 0x23, 0x07, 0x0F, 0x0D, 0x11, 0x05, 0x0A, 0x14, 0x19, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 
+  0x1C, 0x0A, 0x09, 0xA7, 0x3B, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 0x38, 0x30, 0x33, 0x1B, 0x1A, 0x18, 0x19, 0x19, 0x18, 0x14, 
+  0x34, 0x08, 0x08, 0x0C, 0x35, 0x24, 0x2D, 0x1A, 0x1A, 0x35, 0x34, 0x0D, 0x0D, 0x11, 0x05, 0x13, 0x18, 0x25, 0x33, 0x14, 
+  0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0xA6, 0x09, 0x38, 0x38, 0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x18, 0x18, 
+  0x23, 0x0A, 0x08, 0x34, 0x08, 0x0C, 0x1D, 0x14, 0x2C, 0x18, 0x1A, 0x2D, 0x0B, 0x04, 0x0D, 0x0D, 0x34, 0x1D, 0x19, 0x30, 
+  0x07, 0x12, 0x0C, 0x35, 0x35, 0x16, 0x00, 0x00, 0xA6, 0x3B, 0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E, 0x25, 0x38, 0x1B, 
+  0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x0A, 0x0C, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1A, 0x1C, 0x0A, 0x08, 0x0E, 0x07, 0x24, 
+  0x1A, 0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x3B, 0x00, 0x01, 0xA4, 0x16, 0x1A, 0x33, 0x2D, 0x2D, 0x32, 0x22, 0x20, 0x1E, 
+  0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x14, 0x0B, 0x0B, 0x1D, 
+  0x2C, 0x0A, 0x3B, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x01, 0x01, 0xA3, 0x3B, 0x0D, 0x1E, 0x1B, 0x23, 0x19, 0x32, 0x30, 0x20, 
+  0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 
+  0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x02, 0x02, 0xA2, 0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 
+  0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 
+  0x0A, 0x0B, 0x24, 0x11, 0x3B, 0x02, 0x03, 0xA0, 0x3B, 0x0C, 0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 
+  0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 0x1E, 0x20, 0x33, 0x34, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 
+  0x09, 0x03, 0x04, 0x9D, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x32, 0x1B, 0x1B, 0x19, 
+  0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 0x15, 0x12, 0x35, 0x08, 0x05, 0x05, 0x8B, 0x3B, 0x0A, 0x18, 
+  0x2C, 0x1C, 0x35, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x45, 0x1B, 0x8A, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 0x0B, 
+  0x13, 0x11, 0x09, 0x05, 0x06, 0x99, 0x3B, 0x03, 0x23, 0x2D, 0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 
+  0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 0x0B, 0x02, 0x07, 0x07, 0x8B, 0x3B, 0x09, 0x0A, 0x1C, 0x17, 
+  0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x43, 0x07, 0x87, 0x06, 0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x3B, 0x08, 0x09, 
+  0x94, 0x3B, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 0x0B, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 
+  0x10, 0x3B, 0x09, 0x0B, 0x87, 0x3B, 0x09, 0x03, 0x15, 0x13, 0x35, 0x35, 0x1D, 0x43, 0x13, 0x84, 0x12, 0x05, 0x0F, 0x09, 
+  0x3B, 0x0B, 0x0C, 0x8F, 0x3B, 0x01, 0x02, 0x0F, 0x0E, 0x34, 0x05, 0x07, 0x06, 0x05, 0x08, 0x03, 0x0D, 0x01, 0x3B, 0x3B, 
+  0x0B, 0x0A, 0x92, 0x3B, 0x10, 0x34, 0x07, 0x07, 0x05, 0x08, 0x04, 0x08, 0x08, 0x05, 0x06, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 
+  0x0F, 0x09, 0x0A, 0x08, 0x8A, 0x3B, 0x02, 0x08, 0x0A, 0x08, 0x03, 0x0D, 0x10, 0x02, 0x0D, 0x0F, 0x42, 0x11, 0x88, 0x04, 
+  0x08, 0x06, 0x12, 0x13, 0x14, 0x0A, 0x0D, 0x3B, 0x08, 0x08, 0x97, 0x08, 0x07, 0x04, 0x0D, 0x16, 0x3B, 0x0E, 0x1D, 0x2D, 
+  0x18, 0x19, 0x1B, 0x1B, 0x1A, 0x18, 0x1C, 0x15, 0x34, 0x06, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x07, 0x05, 0x89, 0x3B, 0x01, 
+  0x07, 0x06, 0x03, 0x01, 0x02, 0x0A, 0x33, 0x20, 0x42, 0x1F, 0x43, 0x20, 0x8B, 0x21, 0x30, 0x1B, 0x2C, 0x13, 0x15, 0x0A, 
+  0x13, 0x24, 0x14, 0x0D, 0x3B, 0x05, 0x04, 0x9E, 0x3B, 0x0D, 0x0A, 0x34, 0x0D, 0x01, 0x12, 0x36, 0x1F, 0x2B, 0x2A, 0x28, 
+  0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x2D, 0x2D, 0x1A, 0x2D, 0x12, 0x0C, 0x14, 0x17, 0x11, 0x3B, 0x04, 
+  0x03, 0xA0, 0x3B, 0x0D, 0x0B, 0x34, 0x0F, 0x0D, 0x35, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 
+  0x2B, 0x26, 0x1E, 0x32, 0x18, 0x1A, 0x22, 0x2B, 0x26, 0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x3B, 0x03, 0x03, 0x88, 0x01, 0x12, 
+  0x05, 0x0F, 0x03, 0x0A, 0x2C, 0x21, 0x27, 0x42, 0x2E, 0x84, 0x27, 0x20, 0x1E, 0x22, 0x30, 0x42, 0x1E, 0x8D, 0x30, 0x1B, 
+  0x19, 0x38, 0x1F, 0x27, 0x28, 0x27, 0x2C, 0x0C, 0x24, 0x31, 0x02, 0x3B, 0x02, 0x02, 0x8F, 0x3B, 0x12, 0x07, 0x11, 0x11, 
+  0x15, 0x13, 0x31, 0x33, 0x1F, 0x2A, 0x2A, 0x20, 0x1F, 0x2B, 0x27, 0x42, 0x26, 0x8F, 0x1F, 0x21, 0x1A, 0x2D, 0x1B, 0x20, 
+  0x2A, 0x2F, 0x2A, 0x29, 0x29, 0x23, 0x13, 0x1C, 0x23, 0x01, 0x02, 0x01, 0x99, 0x3B, 0x05, 0x12, 0x08, 0x0E, 0x0C, 0x1D, 
+  0x24, 0x1C, 0x18, 0x38, 0x30, 0x2B, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x20, 0x32, 0x18, 0x33, 0x1F, 0x42, 
+  0x2F, 0x87, 0x29, 0x2F, 0x2A, 0x1C, 0x1D, 0x23, 0x12, 0x09, 0x01, 0x01, 0x87, 0x02, 0x0C, 0x07, 0x0E, 0x14, 0x2C, 0x18, 
+  0x1C, 0x42, 0x14, 0x9A, 0x1E, 0x2A, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1A, 0x1B, 0x1F, 0x28, 0x28, 
+  0x2F, 0x2F, 0x2E, 0x28, 0x2F, 0x27, 0x35, 0x24, 0x1B, 0x0F, 0x3B, 0x00, 0x00, 0x99, 0x09, 0x06, 0x0B, 0x08, 0x35, 0x38, 
+  0x30, 0x32, 0x31, 0x14, 0x0B, 0x1C, 0x32, 0x1F, 0x2F, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0x30, 0x27, 
+  0x45, 0x2F, 0x85, 0x2A, 0x2E, 0x32, 0x1D, 0x23, 0x24, 0x01, 0x00, 0x98, 0x10, 0x14, 0x15, 0x05, 0x25, 0x1F, 0x1F, 0x1E, 
+  0x36, 0x24, 0x1C, 0x24, 0x23, 0x38, 0x27, 0x2E, 0x2F, 0x29, 0x27, 0x26, 0x2B, 0x1F, 0x1B, 0x1B, 0x26, 0x46, 0x2F, 0x86, 
+  0x29, 0x28, 0x2E, 0x35, 0x24, 0x31, 0x0F, 0x00, 0x99, 0x3B, 0x0A, 0x13, 0x05, 0x17, 0x2B, 0x28, 0x27, 0x2B, 0x38, 0x33, 
+  0x1A, 0x23, 0x24, 0x2C, 0x1E, 0x2F, 0x2E, 0x2F, 0x27, 0x26, 0x26, 0x21, 0x19, 0x25, 0x28, 0x46, 0x2F, 0x87, 0x28, 0x28, 
+  0x2F, 0x20, 0x35, 0x2D, 0x07, 0x3B, 0x98, 0x01, 0x13, 0x0B, 0x34, 0x2B, 0x29, 0x2F, 0x2F, 0x27, 0x26, 0x26, 0x1E, 0x1B, 
+  0x23, 0x24, 0x18, 0x26, 0x2E, 0x2F, 0x27, 0x26, 0x26, 0x22, 0x1B, 0x27, 0x47, 0x2F, 0x87, 0x29, 0x28, 0x2F, 0x2A, 0x1C, 
+  0x17, 0x1A, 0x09, 0x83, 0x0D, 0x35, 0x0A, 0x13, 0x43, 0x2E, 0x8F, 0x27, 0x28, 0x2A, 0x27, 0x1F, 0x33, 0x2C, 0x24, 0x1A, 
+  0x2A, 0x2E, 0x2A, 0x26, 0x26, 0x32, 0x20, 0x44, 0x2F, 0x42, 0x29, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 0x32, 0x03, 0x97, 
+  0x03, 0x35, 0x0A, 0x38, 0x2E, 0x39, 0x37, 0x2E, 0x28, 0x2E, 0x2F, 0x2F, 0x2A, 0x2B, 0x25, 0x31, 0x1C, 0x30, 0x2E, 0x28, 
+  0x2B, 0x20, 0x1B, 0x2A, 0x43, 0x2F, 0x80, 0x28, 0x42, 0x29, 0x80, 0x2E, 0x42, 0x2F, 0x84, 0x37, 0x1E, 0x35, 0x19, 0x12, 
+  0x88, 0x05, 0x1D, 0x12, 0x26, 0x2E, 0x39, 0x39, 0x2F, 0x2E, 0x43, 0x39, 0x8D, 0x37, 0x29, 0x26, 0x1A, 0x1C, 0x1F, 0x37, 
+  0x27, 0x30, 0x26, 0x2E, 0x2F, 0x29, 0x2F, 0x42, 0x2E, 0x83, 0x37, 0x2E, 0x2E, 0x37, 0x42, 0x2E, 0x83, 0x29, 0x1D, 0x2D, 
+  0x17, 0xA8, 0x0A, 0x1D, 0x0B, 0x2B, 0x2E, 0x39, 0x39, 0x2E, 0x39, 0x3A, 0x32, 0x24, 0x1C, 0x24, 0x14, 0x1B, 0x2A, 0x33, 
+  0x1D, 0x14, 0x35, 0x0C, 0x14, 0x26, 0x29, 0x2F, 0x1A, 0x14, 0x24, 0x24, 0x14, 0x2B, 0x2E, 0x39, 0x2E, 0x37, 0x2E, 0x39, 
+  0x1D, 0x23, 0x18, 0xA1, 0x0C, 0x1D, 0x0C, 0x2A, 0x37, 0x39, 0x39, 0x37, 0x39, 0x3A, 0x24, 0x0E, 0x03, 0x03, 0x0E, 0x24, 
+  0x39, 0x37, 0x14, 0x0E, 0x03, 0x03, 0x08, 0x20, 0x2F, 0x37, 0x24, 0x0E, 0x03, 0x03, 0x08, 0x1F, 0x37, 0x39, 0x42, 0x37, 
+  0x83, 0x3A, 0x1C, 0x23, 0x1B, 0x42, 0x1D, 0x80, 0x2F, 0x42, 0x39, 0x98, 0x37, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x03, 
+  0x1C, 0x3A, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x44, 0x39, 0x83, 
+  0x3A, 0x2C, 0x23, 0x1B, 0xA1, 0x13, 0x1D, 0x1D, 0x28, 0x37, 0x39, 0x39, 0x37, 0x37, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x03, 
+  0x24, 0x39, 0x37, 0x24, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x1C, 0x03, 0x09, 0x09, 0x34, 0x1F, 0x39, 0x3A, 0x42, 
+  0x39, 0x83, 0x3A, 0x23, 0x2C, 0x1B, 0x85, 0x0C, 0x35, 0x13, 0x27, 0x2E, 0x37, 0x42, 0x2E, 0x98, 0x39, 0x24, 0x0E, 0x03, 
+  0x03, 0x0E, 0x14, 0x2E, 0x2F, 0x14, 0x0E, 0x03, 0x03, 0x08, 0x30, 0x2F, 0x39, 0x24, 0x0E, 0x03, 0x03, 0x08, 0x1F, 0x39, 
+  0x3A, 0x42, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x0A, 0x14, 0x13, 0x2B, 0x44, 0x2E, 0x91, 0x37, 0x1B, 0x14, 0x24, 
+  0x14, 0x14, 0x1A, 0x2F, 0x2E, 0x19, 0x0C, 0x35, 0x24, 0x1D, 0x1C, 0x1E, 0x2A, 0x1B, 0x43, 0x24, 0x80, 0x27, 0x45, 0x39, 
+  0x82, 0x35, 0x18, 0x2D, 0x83, 0x0E, 0x1C, 0x13, 0x1F, 0x44, 0x2E, 0x80, 0x2F, 0x42, 0x2E, 0x44, 0x2F, 0x8A, 0x1E, 0x21, 
+  0x27, 0x2E, 0x2F, 0x18, 0x17, 0x33, 0x26, 0x2F, 0x37, 0x46, 0x39, 0x84, 0x3A, 0x27, 0x14, 0x1B, 0x0C, 0x85, 0x0F, 0x17, 
+  0x13, 0x1A, 0x39, 0x2E, 0x42, 0x2F, 0x80, 0x29, 0x43, 0x28, 0x42, 0x2F, 0x97, 0x26, 0x1A, 0x1F, 0x2B, 0x28, 0x2E, 0x26, 
+  0x23, 0x1C, 0x1B, 0x21, 0x2B, 0x28, 0x2F, 0x2E, 0x39, 0x37, 0x37, 0x39, 0x3A, 0x32, 0x1C, 0x30, 0x0E, 0x8C, 0x02, 0x1C, 
+  0x14, 0x1D, 0x39, 0x2F, 0x29, 0x28, 0x2F, 0x29, 0x2A, 0x28, 0x29, 0x42, 0x2F, 0x98, 0x28, 0x33, 0x32, 0x26, 0x2B, 0x2A, 
+  0x2E, 0x2F, 0x1E, 0x17, 0x1C, 0x19, 0x30, 0x1F, 0x27, 0x29, 0x2E, 0x2F, 0x2E, 0x39, 0x37, 0x23, 0x2D, 0x1E, 0x09, 0x8B, 
+  0x3B, 0x1D, 0x1C, 0x13, 0x20, 0x2F, 0x2F, 0x28, 0x28, 0x2F, 0x28, 0x29, 0x43, 0x2F, 0x98, 0x1F, 0x1A, 0x30, 0x26, 0x26, 
+  0x27, 0x2F, 0x2E, 0x27, 0x36, 0x1C, 0x1C, 0x31, 0x33, 0x20, 0x2B, 0x2A, 0x29, 0x2F, 0x2E, 0x27, 0x1C, 0x1A, 0x14, 0x09, 
+  0x88, 0x3B, 0x11, 0x2D, 0x35, 0x1C, 0x28, 0x29, 0x28, 0x28, 0x45, 0x2F, 0x98, 0x27, 0x33, 0x1A, 0x21, 0x2B, 0x2B, 0x27, 
+  0x2F, 0x2E, 0x2F, 0x26, 0x1A, 0x24, 0x1C, 0x2D, 0x36, 0x21, 0x1F, 0x2B, 0x28, 0x2E, 0x1B, 0x23, 0x33, 0x11, 0x00, 0x00, 
+  0xA6, 0x09, 0x14, 0x1C, 0x1D, 0x20, 0x2F, 0x29, 0x29, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x2A, 0x21, 0x19, 0x32, 0x1F, 0x2B, 
+  0x26, 0x2B, 0x29, 0x2F, 0x2E, 0x28, 0x21, 0x31, 0x24, 0x1C, 0x19, 0x1B, 0x22, 0x20, 0x2B, 0x20, 0x14, 0x18, 0x1B, 0x01, 
+  0x00, 0x01, 0x85, 0x03, 0x2C, 0x14, 0x17, 0x2F, 0x2E, 0x42, 0x2F, 0x9C, 0x2E, 0x2E, 0x2F, 0x26, 0x36, 0x19, 0x22, 0x26, 
+  0x2B, 0x26, 0x2B, 0x28, 0x2F, 0x2E, 0x2E, 0x27, 0x22, 0x2D, 0x17, 0x24, 0x2C, 0x1A, 0x22, 0x21, 0x23, 0x23, 0x22, 0x05, 
+  0x3B, 0x00, 0x01, 0x86, 0x16, 0x13, 0x23, 0x35, 0x19, 0x2E, 0x2E, 0x43, 0x2F, 0x99, 0x2A, 0x1E, 0x1A, 0x1A, 0x1E, 0x26, 
+  0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x29, 0x26, 0x33, 0x23, 0x14, 0x24, 0x2D, 0x1B, 0x31, 0x1C, 0x1B, 0x24, 0x09, 
+  0x01, 0x01, 0x95, 0x3B, 0x10, 0x2C, 0x17, 0x35, 0x1E, 0x39, 0x2E, 0x2F, 0x2F, 0x2A, 0x1F, 0x33, 0x1A, 0x32, 0x20, 0x2B, 
+  0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x42, 0x2E, 0x8A, 0x2A, 0x20, 0x1A, 0x17, 0x1C, 0x23, 0x23, 0x14, 0x2D, 0x32, 0x0D, 0x02, 
+  0x02, 0x8E, 0x3B, 0x11, 0x2D, 0x1C, 0x14, 0x1E, 0x37, 0x2E, 0x29, 0x2B, 0x30, 0x1A, 0x1A, 0x22, 0x1F, 0x43, 0x2B, 0x8F, 
+  0x2A, 0x2F, 0x2F, 0x2E, 0x37, 0x2F, 0x2B, 0x25, 0x1A, 0x23, 0x1C, 0x14, 0x23, 0x1E, 0x34, 0x3B, 0x02, 0x03, 0xA0, 0x3B, 
+  0x06, 0x31, 0x17, 0x35, 0x30, 0x2F, 0x2A, 0x1F, 0x32, 0x18, 0x1A, 0x30, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x28, 0x2F, 
+  0x2F, 0x2E, 0x2E, 0x28, 0x26, 0x22, 0x17, 0x35, 0x17, 0x36, 0x06, 0x09, 0x03, 0x04, 0x9D, 0x3B, 0x08, 0x31, 0x23, 0x14, 
+  0x2D, 0x1F, 0x1E, 0x1B, 0x1A, 0x36, 0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x28, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x26, 
+  0x23, 0x35, 0x17, 0x30, 0x15, 0x05, 0x05, 0x8A, 0x3B, 0x08, 0x2D, 0x2D, 0x24, 0x35, 0x31, 0x19, 0x1B, 0x22, 0x1F, 0x44, 
+  0x2B, 0x81, 0x27, 0x2F, 0x42, 0x2E, 0x87, 0x2A, 0x38, 0x1D, 0x35, 0x2C, 0x32, 0x34, 0x09, 0x05, 0x06, 0x89, 0x3B, 0x0D, 
+  0x35, 0x1A, 0x23, 0x14, 0x35, 0x1C, 0x1A, 0x1F, 0x42, 0x27, 0x8C, 0x2B, 0x2B, 0x27, 0x29, 0x29, 0x1E, 0x2C, 0x35, 0x13, 
+  0x14, 0x1A, 0x2C, 0x0D, 0x07, 0x08, 0x96, 0x09, 0x05, 0x17, 0x18, 0x23, 0x24, 0x1D, 0x1D, 0x23, 0x31, 0x1A, 0x32, 0x1A, 
+  0x31, 0x23, 0x1D, 0x0C, 0x13, 0x14, 0x2D, 0x19, 0x0B, 0x3B, 0x08, 0x09, 0x88, 0x3B, 0x01, 0x04, 0x14, 0x1A, 0x18, 0x2C, 
+  0x1C, 0x14, 0x43, 0x1D, 0x87, 0x35, 0x1C, 0x2D, 0x1B, 0x2C, 0x06, 0x02, 0x3B, 0x09, 0x0B, 0x85, 0x3B, 0x09, 0x0D, 0x07, 
+  0x35, 0x2C, 0x43, 0x18, 0x86, 0x19, 0x31, 0x1C, 0x0A, 0x0F, 0x09, 0x3B, 0x0B, 0x0C, 0x8E, 0x3B, 0x01, 0x02, 0x0F, 0x04, 
+  0x34, 0x05, 0x06, 0x34, 0x04, 0x11, 0x0D, 0x10, 0x01, 0x3B, 0x0C, 0x0A, 0x92, 0x09, 0x10, 0x06, 0x13, 0x17, 0x2D, 0x18, 
+  0x1A, 0x19, 0x18, 0x31, 0x2C, 0x1C, 0x1D, 0x12, 0x05, 0x11, 0x02, 0x3B, 0x0A, 0x08, 0x88, 0x3B, 0x0D, 0x15, 0x18, 0x1B, 
+  0x36, 0x36, 0x32, 0x1B, 0x45, 0x1A, 0x87, 0x1B, 0x1A, 0x2C, 0x35, 0x12, 0x08, 0x10, 0x3B, 0x08, 0x07, 0x86, 0x3B, 0x15, 
+  0x18, 0x33, 0x33, 0x1B, 0x1A, 0x42, 0x1B, 0x8E, 0x18, 0x2D, 0x2D, 0x31, 0x18, 0x18, 0x31, 0x31, 0x1A, 0x1A, 0x31, 0x24, 
+  0x12, 0x0E, 0x09, 0x07, 0x05, 0x9C, 0x3B, 0x10, 0x17, 0x22, 0x22, 0x32, 0x1B, 0x36, 0x33, 0x32, 0x19, 0x2D, 0x1C, 0x35, 
+  0x35, 0x24, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x2D, 0x1D, 0x07, 0x10, 0x3B, 0x05, 0x04, 0x8F, 0x3B, 0x0F, 
+  0x1A, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 0x2D, 0x17, 0x14, 0x13, 0x13, 0x42, 0x35, 0x8B, 0x0B, 0x0A, 0x15, 
+  0x12, 0x14, 0x31, 0x1A, 0x18, 0x1C, 0x0B, 0x0F, 0x3B, 0x04, 0x03, 0xA0, 0x3B, 0x0F, 0x30, 0x1E, 0x38, 0x18, 0x1C, 0x17, 
+  0x2C, 0x18, 0x31, 0x23, 0x24, 0x13, 0x0A, 0x06, 0x07, 0x12, 0x0B, 0x0C, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 
+  0x18, 0x17, 0x13, 0x0D, 0x3B, 0x03, 0x03, 0xA1, 0x10, 0x32, 0x1E, 0x22, 0x23, 0x0B, 0x15, 0x15, 0x1D, 0x1C, 0x14, 0x0B, 
+  0x0A, 0x15, 0x07, 0x05, 0x06, 0x15, 0x07, 0x05, 0x04, 0x04, 0x05, 0x0B, 0x17, 0x1A, 0x36, 0x38, 0x1B, 0x18, 0x23, 0x13, 
+  0x01, 0x3B, 0x02, 0x02, 0xA2, 0x3B, 0x19, 0x21, 0x30, 0x2C, 0x15, 0x11, 0x0D, 0x0E, 0x34, 0x15, 0x12, 0x0C, 0x14, 0x23, 
+  0x1C, 0x35, 0x1D, 0x35, 0x13, 0x0A, 0x04, 0x0F, 0x0E, 0x0B, 0x31, 0x32, 0x33, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 
+  0x02, 0x01, 0xA4, 0x3B, 0x1D, 0x20, 0x25, 0x1A, 0x1D, 0x34, 0x16, 0x09, 0x3B, 0x01, 0x08, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 
+  0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x06, 0x1D, 0x2D, 0x1B, 0x38, 0x22, 0x38, 0x33, 0x18, 0x18, 0x17, 0x34, 0x09, 
+  0x01, 0x01, 0xA5, 0x0F, 0x1E, 0x21, 0x33, 0x23, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x16, 0x15, 0x17, 0x1A, 0x1A, 0x18, 0x2C, 
+  0x14, 0x1D, 0x35, 0x1D, 0x15, 0x08, 0x34, 0x0C, 0x2C, 0x2D, 0x19, 0x36, 0x30, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 
+  0x3B, 0x00, 0x00, 0xA5, 0x09, 0x35, 0x1F, 0x30, 0x1B, 0x23, 0x12, 0x05, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0C, 0x31, 0x1B, 
+  0x19, 0x2D, 0x14, 0x1D, 0x35, 0x13, 0x06, 0x08, 0x15, 0x1C, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x22, 0x22, 0x1B, 0x18, 0x2D, 
+  0x2D, 0x0B, 0x01, 0xA7, 0x3B, 0x0D, 0x2B, 0x21, 0x33, 0x33, 0x2C, 0x1D, 0x15, 0x03, 0x0D, 0x03, 0x10, 0x0F, 0x05, 0x24, 
+  0x1A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B, 0x34, 0x34, 0x1D, 0x31, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x36, 0x22, 0x36, 0x1B, 
+  0x2C, 0x31, 0x17, 0x0D, 0x00, 0xA8, 0x09, 0x17, 0x1F, 0x22, 0x30, 0x38, 0x18, 0x23, 0x0C, 0x34, 0x07, 0x34, 0x11, 0x10, 
+  0x0F, 0x0A, 0x2D, 0x1A, 0x18, 0x1C, 0x1D, 0x35, 0x0A, 0x08, 0x0A, 0x2C, 0x18, 0x19, 0x19, 0x31, 0x2D, 0x2D, 0x1A, 0x33, 
+  0x22, 0x1B, 0x19, 0x2D, 0x18, 0x08, 0x3B, 0xA8, 0x10, 0x30, 0x1F, 0x33, 0x20, 0x33, 0x1B, 0x18, 0x35, 0x14, 0x1D, 0x0A, 
+  0x05, 0x11, 0x02, 0x11, 0x13, 0x1A, 0x18, 0x23, 0x35, 0x1D, 0x06, 0x34, 0x24, 0x18, 0x19, 0x18, 0x31, 0x2D, 0x2C, 0x2C, 
+  0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x1C, 0x09, 0xA8, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x33, 0x18, 0x23, 0x31, 
+  0x2D, 0x1C, 0x0C, 0x07, 0x0E, 0x02, 0x04, 0x23, 0x1A, 0x2C, 0x35, 0x13, 0x34, 0x0C, 0x18, 0x19, 0x18, 0x31, 0x2C, 0x23, 
+  0x23, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x31, 0x19, 0x0D, 0xA8, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 
+  0x1A, 0x1B, 0x1A, 0x18, 0x2C, 0x14, 0x12, 0x08, 0x02, 0x07, 0x18, 0x2D, 0x1D, 0x12, 0x05, 0x2C, 0x19, 0x18, 0x2D, 0x2C, 
+  0x23, 0x2C, 0x2D, 0x2D, 0x18, 0x32, 0x25, 0x20, 0x33, 0x18, 0x23, 0x1A, 0x05, 0x87, 0x13, 0x26, 0x33, 0x1F, 0x20, 0x21, 
+  0x25, 0x1B, 0x42, 0x33, 0x9D, 0x32, 0x1B, 0x18, 0x23, 0x1D, 0x34, 0x0D, 0x13, 0x18, 0x35, 0x06, 0x35, 0x18, 0x31, 0x2C, 
+  0x23, 0x2C, 0x2D, 0x31, 0x18, 0x19, 0x19, 0x36, 0x1E, 0x20, 0x30, 0x1B, 0x1C, 0x19, 0x0C, 0x87, 0x2C, 0x1F, 0x36, 0x1F, 
+  0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x90, 0x22, 0x22, 0x33, 0x32, 0x1A, 0x23, 0x15, 0x11, 0x23, 0x35, 0x0A, 0x19, 0x31, 
+  0x2C, 0x2D, 0x31, 0x19, 0x42, 0x1A, 0x89, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x21, 0x36, 0x24, 0x18, 0x24, 0xA8, 0x1A, 0x20, 
+  0x32, 0x1F, 0x1F, 0x20, 0x1E, 0x22, 0x25, 0x1E, 0x25, 0x31, 0x23, 0x2C, 0x23, 0x17, 0x1A, 0x1B, 0x14, 0x07, 0x0C, 0x13, 
+  0x1D, 0x1D, 0x19, 0x19, 0x1A, 0x1C, 0x24, 0x1C, 0x24, 0x24, 0x36, 0x38, 0x20, 0x1F, 0x1F, 0x22, 0x24, 0x31, 0x17, 0x8C, 
+  0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x30, 0x25, 0x15, 0x08, 0x42, 0x04, 0x84, 0x23, 0x30, 0x36, 0x06, 
+  0x08, 0x42, 0x04, 0x83, 0x25, 0x22, 0x36, 0x05, 0x42, 0x04, 0x89, 0x0E, 0x25, 0x25, 0x1F, 0x26, 0x1F, 0x1E, 0x1C, 0x2D, 
+  0x23, 0xA8, 0x1B, 0x21, 0x1B, 0x20, 0x1E, 0x21, 0x30, 0x33, 0x36, 0x36, 0x33, 0x15, 0x04, 0x01, 0x10, 0x04, 0x24, 0x19, 
+  0x23, 0x06, 0x0F, 0x01, 0x02, 0x04, 0x1E, 0x22, 0x36, 0x06, 0x0F, 0x01, 0x02, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 
+  0x14, 0x2C, 0x17, 0x86, 0x1A, 0x20, 0x1B, 0x1E, 0x30, 0x1E, 0x38, 0x43, 0x1B, 0x9D, 0x15, 0x0E, 0x3B, 0x01, 0x04, 0x35, 
+  0x31, 0x2D, 0x06, 0x0D, 0x3B, 0x10, 0x08, 0x18, 0x1B, 0x1B, 0x06, 0x0D, 0x3B, 0x10, 0x04, 0x1E, 0x1E, 0x1F, 0x2B, 0x1F, 
+  0x22, 0x35, 0x2C, 0x1C, 0x87, 0x1C, 0x20, 0x1B, 0x30, 0x30, 0x25, 0x38, 0x1B, 0x42, 0x1A, 0x9D, 0x15, 0x08, 0x0E, 0x04, 
+  0x08, 0x35, 0x19, 0x17, 0x34, 0x04, 0x0E, 0x04, 0x34, 0x15, 0x24, 0x23, 0x06, 0x04, 0x0E, 0x04, 0x04, 0x1E, 0x21, 0x26, 
+  0x2B, 0x20, 0x32, 0x35, 0x2C, 0x1D, 0x9A, 0x07, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x19, 0x18, 0x18, 0x12, 0x07, 
+  0x07, 0x15, 0x07, 0x1C, 0x18, 0x15, 0x05, 0x06, 0x07, 0x15, 0x06, 0x0D, 0x34, 0x0B, 0x42, 0x07, 0x8A, 0x15, 0x07, 0x30, 
+  0x1E, 0x26, 0x27, 0x30, 0x18, 0x14, 0x2D, 0x06, 0x88, 0x11, 0x1F, 0x32, 0x32, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 
+  0x9C, 0x31, 0x18, 0x19, 0x1A, 0x19, 0x13, 0x34, 0x13, 0x35, 0x2C, 0x1A, 0x1C, 0x11, 0x0D, 0x08, 0x0A, 0x35, 0x23, 0x31, 
+  0x1A, 0x32, 0x1E, 0x26, 0x2B, 0x1B, 0x24, 0x24, 0x31, 0x03, 0xA8, 0x0D, 0x20, 0x38, 0x18, 0x33, 0x38, 0x38, 0x32, 0x19, 
+  0x2D, 0x2D, 0x31, 0x18, 0x18, 0x19, 0x19, 0x23, 0x05, 0x06, 0x1D, 0x35, 0x17, 0x19, 0x19, 0x0B, 0x03, 0x0D, 0x0E, 0x06, 
+  0x0C, 0x14, 0x2C, 0x1B, 0x1E, 0x26, 0x30, 0x2D, 0x35, 0x24, 0x2C, 0x09, 0x88, 0x3B, 0x36, 0x25, 0x31, 0x1B, 0x32, 0x22, 
+  0x33, 0x1B, 0x43, 0x18, 0x9B, 0x19, 0x19, 0x18, 0x0B, 0x08, 0x0A, 0x1D, 0x1D, 0x1C, 0x18, 0x1A, 0x23, 0x07, 0x0F, 0x0D, 
+  0x11, 0x05, 0x0A, 0x14, 0x19, 0x1E, 0x1F, 0x2C, 0x17, 0x1D, 0x1C, 0x0A, 0x09, 0xA7, 0x3B, 0x05, 0x2B, 0x1B, 0x31, 0x1B, 
+  0x38, 0x30, 0x33, 0x1B, 0x1A, 0x18, 0x19, 0x19, 0x18, 0x14, 0x05, 0x34, 0x0B, 0x35, 0x1D, 0x24, 0x2D, 0x1A, 0x1A, 0x35, 
+  0x34, 0x0D, 0x0D, 0x11, 0x05, 0x13, 0x18, 0x25, 0x33, 0x14, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0xA6, 0x09, 0x38, 0x38, 
+  0x2D, 0x1A, 0x32, 0x25, 0x30, 0x33, 0x1B, 0x1A, 0x18, 0x18, 0x23, 0x0A, 0x08, 0x06, 0x0C, 0x35, 0x1D, 0x14, 0x2C, 0x18, 
+  0x1A, 0x2D, 0x0B, 0x04, 0x0D, 0x0D, 0x34, 0x1D, 0x19, 0x30, 0x07, 0x12, 0x0C, 0x35, 0x35, 0x16, 0x00, 0x00, 0xA6, 0x3B, 
+  0x0E, 0x21, 0x1A, 0x2D, 0x36, 0x22, 0x1E, 0x25, 0x38, 0x1B, 0x1A, 0x31, 0x1D, 0x05, 0x08, 0x15, 0x13, 0x35, 0x1D, 0x14, 
+  0x23, 0x18, 0x1A, 0x1A, 0x1C, 0x0A, 0x08, 0x0E, 0x07, 0x24, 0x1A, 0x06, 0x0E, 0x12, 0x13, 0x1C, 0x0E, 0x3B, 0x00, 0x01, 
+  0xA4, 0x16, 0x1A, 0x33, 0x2D, 0x2D, 0x32, 0x22, 0x20, 0x1E, 0x38, 0x1B, 0x17, 0x0A, 0x08, 0x34, 0x0A, 0x1D, 0x35, 0x1D, 
+  0x14, 0x23, 0x18, 0x1A, 0x1B, 0x18, 0x14, 0x0B, 0x0B, 0x1D, 0x2C, 0x0A, 0x3B, 0x05, 0x0B, 0x1D, 0x0A, 0x3B, 0x01, 0x01, 
+  0xA3, 0x3B, 0x0D, 0x1E, 0x1B, 0x23, 0x19, 0x32, 0x30, 0x20, 0x1E, 0x36, 0x24, 0x0A, 0x34, 0x06, 0x0B, 0x1D, 0x35, 0x1D, 
+  0x35, 0x17, 0x31, 0x19, 0x1B, 0x1B, 0x31, 0x17, 0x2C, 0x31, 0x0A, 0x3D, 0x03, 0x12, 0x0C, 0x1D, 0x02, 0x02, 0x02, 0xA2, 
+  0x3B, 0x08, 0x22, 0x18, 0x17, 0x31, 0x1B, 0x36, 0x21, 0x36, 0x23, 0x13, 0x12, 0x0B, 0x1D, 0x14, 0x14, 0x35, 0x14, 0x17, 
+  0x31, 0x1A, 0x1A, 0x1B, 0x33, 0x38, 0x22, 0x06, 0x3C, 0x10, 0x0A, 0x0B, 0x24, 0x11, 0x3B, 0x02, 0x03, 0xA0, 0x3B, 0x0C, 
+  0x36, 0x2D, 0x1C, 0x2D, 0x18, 0x2C, 0x18, 0x31, 0x17, 0x1C, 0x17, 0x23, 0x23, 0x17, 0x1C, 0x1C, 0x23, 0x31, 0x1A, 0x36, 
+  0x1E, 0x20, 0x33, 0x34, 0x01, 0x11, 0x0A, 0x12, 0x13, 0x0E, 0x09, 0x03, 0x04, 0x9D, 0x3B, 0x15, 0x1B, 0x2C, 0x1C, 0x1C, 
+  0x13, 0x06, 0x05, 0x1C, 0x1A, 0x1B, 0x32, 0x1B, 0x1B, 0x19, 0x1A, 0x1B, 0x38, 0x1E, 0x1F, 0x30, 0x1D, 0x12, 0x05, 0x05, 
+  0x15, 0x12, 0x35, 0x08, 0x05, 0x05, 0x8B, 0x3B, 0x0A, 0x18, 0x2C, 0x1C, 0x35, 0x12, 0x08, 0x11, 0x05, 0x1C, 0x1A, 0x45, 
+  0x1B, 0x8A, 0x2C, 0x12, 0x07, 0x0B, 0x15, 0x06, 0x0A, 0x0B, 0x13, 0x11, 0x09, 0x05, 0x06, 0x99, 0x3B, 0x03, 0x23, 0x2D, 
+  0x24, 0x35, 0x13, 0x12, 0x07, 0x07, 0x0A, 0x15, 0x15, 0x06, 0x05, 0x05, 0x07, 0x15, 0x07, 0x06, 0x07, 0x15, 0x0A, 0x0C, 
+  0x0B, 0x02, 0x07, 0x07, 0x8B, 0x3B, 0x09, 0x0A, 0x1C, 0x17, 0x35, 0x1D, 0x13, 0x0B, 0x12, 0x0A, 0x0A, 0x43, 0x07, 0x87, 
+  0x06, 0x07, 0x0A, 0x0A, 0x0B, 0x0B, 0x05, 0x3B, 0x08, 0x09, 0x94, 0x3B, 0x10, 0x08, 0x24, 0x17, 0x14, 0x13, 0x0C, 0x0B, 
+  0x0B, 0x12, 0x12, 0x0A, 0x12, 0x12, 0x0B, 0x13, 0x0B, 0x08, 0x10, 0x3B, 0x09, 0x0B, 0x87, 0x3B, 0x09, 0x03, 0x15, 0x13, 
+  0x35, 0x35, 0x1D, 0x43, 0x13, 0x84, 0x12, 0x05, 0x0F, 0x09, 0x3B, 0x0B, 0x0B, 0x90, 0x3B, 0x3B, 0x01, 0x02, 0x03, 0x04, 
+  0x05, 0x06, 0x07, 0x06, 0x05, 0x08, 0x03, 0x02, 0x01, 0x3B, 0x3B, 0x0B, 0x0A, 0x92, 0x09, 0x03, 0x06, 0x07, 0x06, 0x34, 
+  0x08, 0x04, 0x08, 0x08, 0x05, 0x07, 0x0A, 0x0B, 0x0C, 0x0B, 0x06, 0x0D, 0x09, 0x0A, 0x08, 0x8A, 0x16, 0x0D, 0x07, 0x07, 
+  0x0E, 0x0F, 0x02, 0x10, 0x02, 0x0D, 0x03, 0x42, 0x11, 0x88, 0x04, 0x08, 0x07, 0x12, 0x13, 0x14, 0x15, 0x02, 0x3B, 0x08, 
+  0x06, 0x8C, 0x3B, 0x10, 0x06, 0x06, 0x11, 0x02, 0x3B, 0x01, 0x05, 0x17, 0x18, 0x19, 0x1A, 0x42, 0x1B, 0x89, 0x19, 0x1C, 
+  0x15, 0x08, 0x07, 0x12, 0x1D, 0x14, 0x15, 0x09, 0x07, 0x06, 0x87, 0x0F, 0x0A, 0x08, 0x0D, 0x01, 0x03, 0x14, 0x1E, 0x43, 
+  0x1F, 0x43, 0x20, 0x8B, 0x21, 0x22, 0x1B, 0x23, 0x0C, 0x0A, 0x0A, 0x13, 0x24, 0x14, 0x0D, 0x3B, 0x05, 0x04, 0x9E, 0x09, 
+  0x04, 0x15, 0x0E, 0x10, 0x0F, 0x14, 0x25, 0x26, 0x27, 0x28, 0x28, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x1F, 0x1E, 0x1B, 
+  0x2C, 0x2D, 0x1B, 0x2D, 0x0B, 0x0C, 0x14, 0x17, 0x11, 0x3B, 0x04, 0x03, 0xA0, 0x3B, 0x08, 0x0A, 0x0E, 0x0D, 0x11, 0x2C, 
+  0x1E, 0x27, 0x2E, 0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x1B, 0x18, 0x1A, 0x30, 0x2B, 0x1F, 
+  0x1D, 0x0C, 0x14, 0x2C, 0x03, 0x3B, 0x03, 0x02, 0x89, 0x3B, 0x11, 0x0A, 0x08, 0x0D, 0x04, 0x13, 0x19, 0x1F, 0x2A, 0x42, 
+  0x2E, 0x95, 0x2B, 0x21, 0x1E, 0x30, 0x25, 0x1E, 0x1E, 0x25, 0x22, 0x1A, 0x19, 0x22, 0x26, 0x2B, 0x2A, 0x27, 0x2C, 0x13, 
+  0x24, 0x31, 0x02, 0x3B, 0x02, 0x01, 0xA3, 0x3B, 0x0D, 0x13, 0x05, 0x03, 0x08, 0x0A, 0x14, 0x18, 0x22, 0x2B, 0x2A, 0x2B, 
+  0x20, 0x26, 0x27, 0x27, 0x2B, 0x26, 0x26, 0x1F, 0x1E, 0x1A, 0x2D, 0x32, 0x20, 0x2A, 0x2F, 0x2A, 0x29, 0x2F, 0x23, 0x13, 
+  0x1C, 0x23, 0x01, 0x02, 0x01, 0x99, 0x01, 0x12, 0x15, 0x11, 0x05, 0x13, 0x14, 0x24, 0x1C, 0x1A, 0x33, 0x1E, 0x27, 0x2E, 
+  0x2F, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x26, 0x1E, 0x1B, 0x19, 0x30, 0x26, 0x42, 0x2F, 0x42, 0x29, 0x84, 0x24, 0x1D, 0x23, 
+  0x12, 0x09, 0x01, 0x00, 0x9B, 0x3B, 0x04, 0x0B, 0x34, 0x05, 0x2C, 0x31, 0x31, 0x1C, 0x14, 0x13, 0x23, 0x20, 0x28, 0x2B, 
+  0x2E, 0x2F, 0x2A, 0x2B, 0x26, 0x2B, 0x1F, 0x22, 0x1A, 0x32, 0x25, 0x2F, 0x28, 0x42, 0x2F, 0x87, 0x28, 0x2F, 0x27, 0x35, 
+  0x24, 0x1A, 0x03, 0x3B, 0x00, 0x00, 0x9B, 0x01, 0x1D, 0x0A, 0x08, 0x19, 0x22, 0x30, 0x1B, 0x31, 0x13, 0x13, 0x23, 0x22, 
+  0x23, 0x34, 0x38, 0x2E, 0x2A, 0x2B, 0x26, 0x26, 0x1F, 0x36, 0x1A, 0x13, 0x05, 0x20, 0x2E, 0x43, 0x2F, 0x85, 0x2A, 0x2E, 
+  0x36, 0x1D, 0x23, 0x17, 0x01, 0x9D, 0x3B, 0x06, 0x13, 0x06, 0x0C, 0x1F, 0x2B, 0x1F, 0x1E, 0x19, 0x1C, 0x1C, 0x24, 0x0B, 
+  0x04, 0x04, 0x05, 0x1F, 0x2F, 0x27, 0x26, 0x26, 0x20, 0x1B, 0x24, 0x08, 0x0E, 0x04, 0x22, 0x2E, 0x42, 0x2F, 0x86, 0x29, 
+  0x28, 0x37, 0x35, 0x24, 0x31, 0x0F, 0x00, 0xA8, 0x01, 0x13, 0x12, 0x34, 0x20, 0x27, 0x28, 0x27, 0x26, 0x38, 0x22, 0x1A, 
+  0x15, 0x34, 0x0D, 0x16, 0x11, 0x06, 0x2B, 0x27, 0x26, 0x26, 0x25, 0x14, 0x34, 0x0D, 0x16, 0x03, 0x34, 0x19, 0x39, 0x2F, 
+  0x2F, 0x28, 0x28, 0x2F, 0x20, 0x35, 0x2D, 0x12, 0x09, 0x84, 0x0D, 0x1D, 0x0A, 0x1D, 0x29, 0x42, 0x2F, 0x8A, 0x26, 0x2B, 
+  0x1F, 0x12, 0x08, 0x02, 0x3B, 0x16, 0x16, 0x0E, 0x15, 0x42, 0x26, 0x92, 0x31, 0x34, 0x03, 0x16, 0x16, 0x3B, 0x0F, 0x04, 
+  0x31, 0x2F, 0x2F, 0x29, 0x28, 0x2F, 0x2A, 0x24, 0x17, 0x1B, 0x09, 0x8E, 0x08, 0x1D, 0x07, 0x38, 0x2F, 0x37, 0x2E, 0x2F, 
+  0x27, 0x29, 0x2A, 0x36, 0x0E, 0x0F, 0x3B, 0x42, 0x16, 0x85, 0x04, 0x0A, 0x27, 0x22, 0x34, 0x03, 0x42, 0x16, 0x84, 0x3B, 
+  0x11, 0x05, 0x26, 0x29, 0x43, 0x2F, 0x84, 0x2E, 0x2C, 0x24, 0x36, 0x03, 0x87, 0x0A, 0x13, 0x12, 0x26, 0x2E, 0x39, 0x39, 
+  0x29, 0x42, 0x2E, 0x83, 0x37, 0x1B, 0x34, 0x0D, 0x42, 0x16, 0x84, 0x01, 0x04, 0x12, 0x07, 0x0E, 0x43, 0x16, 0x8D, 0x11, 
+  0x05, 0x1F, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x37, 0x1E, 0x35, 0x19, 0x0A, 0x87, 0x14, 0x0C, 0x0C, 0x28, 0x37, 0x39, 
+  0x39, 0x2F, 0x42, 0x39, 0x8A, 0x37, 0x2E, 0x23, 0x04, 0x02, 0x3B, 0x16, 0x16, 0x10, 0x34, 0x0E, 0x42, 0x16, 0x84, 0x3B, 
+  0x03, 0x04, 0x1E, 0x2F, 0x42, 0x2E, 0x80, 0x37, 0x42, 0x2E, 0x83, 0x2F, 0x1D, 0x2D, 0x1C, 0x83, 0x17, 0x0C, 0x1D, 0x2E, 
+  0x42, 0x39, 0x80, 0x2E, 0x44, 0x39, 0x88, 0x3A, 0x24, 0x34, 0x10, 0x16, 0x16, 0x3B, 0x10, 0x01, 0x42, 0x16, 0x83, 0x0F, 
+  0x34, 0x33, 0x37, 0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0x39, 0x35, 0x23, 0x19, 0x82, 0x1C, 0x0C, 0x24, 0x43, 0x39, 
+  0x80, 0x37, 0x45, 0x39, 0x83, 0x37, 0x0C, 0x04, 0x01, 0x44, 0x16, 0x85, 0x3B, 0x0D, 0x04, 0x31, 0x2E, 0x2E, 0x43, 0x37, 
+  0x87, 0x39, 0x37, 0x39, 0x37, 0x3A, 0x1C, 0x2C, 0x1A, 0x82, 0x17, 0x0C, 0x23, 0x43, 0x39, 0x80, 0x37, 0x47, 0x39, 0x82, 
+  0x12, 0x04, 0x01, 0x43, 0x16, 0x83, 0x02, 0x34, 0x23, 0x3A, 0x49, 0x39, 0x83, 0x3A, 0x23, 0x23, 0x1B, 0x87, 0x23, 0x13, 
+  0x1C, 0x39, 0x39, 0x37, 0x39, 0x37, 0x43, 0x39, 0x42, 0x37, 0x83, 0x39, 0x18, 0x34, 0x02, 0x42, 0x16, 0x83, 0x3B, 0x03, 
+  0x34, 0x1F, 0x46, 0x39, 0x80, 0x3A, 0x42, 0x39, 0x83, 0x3A, 0x1C, 0x2C, 0x1B, 0x86, 0x23, 0x13, 0x14, 0x2E, 0x37, 0x2E, 
+  0x37, 0x45, 0x2E, 0x85, 0x2F, 0x2F, 0x36, 0x0E, 0x0F, 0x3B, 0x43, 0x16, 0x83, 0x3B, 0x11, 0x34, 0x27, 0x45, 0x39, 0x80, 
+  0x3A, 0x42, 0x39, 0x83, 0x3A, 0x14, 0x2D, 0x1A, 0x83, 0x24, 0x1D, 0x14, 0x29, 0x45, 0x2E, 0x86, 0x2F, 0x2F, 0x29, 0x29, 
+  0x1E, 0x05, 0x03, 0x42, 0x16, 0x80, 0x3B, 0x43, 0x16, 0x84, 0x0E, 0x15, 0x2A, 0x37, 0x37, 0x47, 0x39, 0x82, 0x35, 0x18, 
+  0x31, 0x90, 0x0B, 0x14, 0x1D, 0x27, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0x1F, 0x08, 0x11, 0x09, 0x42, 
+  0x16, 0x82, 0x11, 0x0F, 0x3B, 0x42, 0x16, 0x85, 0x04, 0x12, 0x28, 0x2E, 0x2E, 0x37, 0x43, 0x39, 0x84, 0x3A, 0x1F, 0x24, 
+  0x36, 0x0A, 0x84, 0x34, 0x1C, 0x13, 0x21, 0x2E, 0x43, 0x2F, 0x42, 0x28, 0x82, 0x26, 0x07, 0x0E, 0x43, 0x16, 0x8C, 0x11, 
+  0x08, 0x34, 0x0F, 0x3B, 0x16, 0x16, 0x01, 0x04, 0x0B, 0x27, 0x2F, 0x2E, 0x42, 0x37, 0x85, 0x39, 0x39, 0x18, 0x23, 0x1E, 
+  0x11, 0xA8, 0x0D, 0x17, 0x1D, 0x2D, 0x37, 0x2F, 0x28, 0x28, 0x2F, 0x28, 0x28, 0x27, 0x15, 0x0E, 0x3B, 0x16, 0x16, 0x3B, 
+  0x0F, 0x34, 0x36, 0x17, 0x08, 0x02, 0x3B, 0x16, 0x3B, 0x10, 0x08, 0x14, 0x2B, 0x28, 0x2F, 0x2F, 0x2E, 0x39, 0x2E, 0x17, 
+  0x31, 0x22, 0x09, 0xA8, 0x01, 0x1C, 0x14, 0x13, 0x2A, 0x2F, 0x28, 0x2A, 0x28, 0x29, 0x27, 0x12, 0x08, 0x01, 0x16, 0x16, 
+  0x3B, 0x03, 0x34, 0x32, 0x2B, 0x28, 0x2C, 0x08, 0x10, 0x3B, 0x16, 0x3B, 0x02, 0x08, 0x1D, 0x2B, 0x27, 0x2A, 0x2F, 0x37, 
+  0x2B, 0x1C, 0x1B, 0x12, 0x09, 0xA7, 0x3B, 0x0A, 0x23, 0x1D, 0x2D, 0x29, 0x2F, 0x28, 0x28, 0x2F, 0x2E, 0x22, 0x05, 0x11, 
+  0x16, 0x3B, 0x0D, 0x08, 0x1C, 0x27, 0x26, 0x2A, 0x2F, 0x13, 0x04, 0x01, 0x3B, 0x10, 0x08, 0x06, 0x1B, 0x25, 0x20, 0x2B, 
+  0x2A, 0x2E, 0x2C, 0x2C, 0x33, 0x03, 0x00, 0x00, 0xA5, 0x3B, 0x2D, 0x24, 0x35, 0x2B, 0x2F, 0x29, 0x2F, 0x2F, 0x2E, 0x37, 
+  0x1F, 0x06, 0x04, 0x0D, 0x08, 0x24, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x0C, 0x04, 0x0D, 0x08, 0x06, 0x1C, 0x31, 0x1A, 
+  0x38, 0x20, 0x26, 0x38, 0x24, 0x1A, 0x2C, 0x01, 0x00, 0x86, 0x3B, 0x06, 0x23, 0x35, 0x31, 0x2E, 0x2E, 0x42, 0x2F, 0x9C, 
+  0x2E, 0x2E, 0x2B, 0x07, 0x08, 0x12, 0x25, 0x26, 0x2B, 0x26, 0x27, 0x2F, 0x2F, 0x2A, 0x0A, 0x34, 0x0C, 0x19, 0x1C, 0x24, 
+  0x23, 0x19, 0x38, 0x25, 0x1C, 0x2C, 0x25, 0x03, 0x3B, 0x00, 0x01, 0x86, 0x01, 0x24, 0x17, 0x1D, 0x1B, 0x2E, 0x2E, 0x43, 
+  0x2F, 0x99, 0x2B, 0x36, 0x13, 0x1B, 0x20, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x2E, 0x27, 0x2C, 0x26, 0x33, 0x23, 0x14, 
+  0x1C, 0x2C, 0x1A, 0x17, 0x1C, 0x36, 0x0A, 0x09, 0x01, 0x01, 0xA3, 0x3B, 0x0F, 0x2D, 0x1C, 0x35, 0x20, 0x37, 0x2E, 0x2F, 
+  0x2F, 0x27, 0x1E, 0x1B, 0x1B, 0x22, 0x1F, 0x2B, 0x2B, 0x26, 0x27, 0x28, 0x2F, 0x2E, 0x2E, 0x39, 0x2A, 0x20, 0x1B, 0x23, 
+  0x1C, 0x17, 0x1C, 0x24, 0x19, 0x18, 0x01, 0x02, 0x02, 0xA2, 0x3B, 0x0E, 0x2D, 0x1C, 0x14, 0x30, 0x2E, 0x2E, 0x28, 0x1F, 
+  0x33, 0x19, 0x1B, 0x25, 0x26, 0x2B, 0x27, 0x2B, 0x27, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x2B, 0x1E, 0x1B, 0x2C, 0x14, 
+  0x14, 0x31, 0x38, 0x02, 0x3B, 0x02, 0x03, 0x92, 0x3B, 0x06, 0x31, 0x17, 0x35, 0x33, 0x29, 0x27, 0x1E, 0x1B, 0x18, 0x32, 
+  0x1E, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x42, 0x2F, 0x89, 0x37, 0x37, 0x28, 0x26, 0x38, 0x24, 0x14, 0x2D, 0x32, 0x0D, 
+  0x04, 0x04, 0x9E, 0x3B, 0x04, 0x31, 0x23, 0x14, 0x17, 0x30, 0x30, 0x1A, 0x1B, 0x22, 0x20, 0x26, 0x2B, 0x2B, 0x26, 0x2B, 
+  0x2A, 0x29, 0x2F, 0x2E, 0x37, 0x37, 0x2E, 0x36, 0x14, 0x14, 0x31, 0x32, 0x0F, 0x3B, 0x04, 0x05, 0x9B, 0x3B, 0x04, 0x23, 
+  0x31, 0x1C, 0x1D, 0x1C, 0x18, 0x32, 0x1E, 0x1F, 0x2B, 0x27, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 0x27, 0x1F, 0x1C, 
+  0x13, 0x24, 0x1A, 0x2D, 0x10, 0x06, 0x06, 0x9A, 0x3B, 0x02, 0x0C, 0x1A, 0x2D, 0x1C, 0x14, 0x14, 0x2C, 0x25, 0x26, 0x27, 
+  0x27, 0x2B, 0x2B, 0x27, 0x27, 0x1E, 0x2C, 0x35, 0x13, 0x35, 0x2C, 0x32, 0x07, 0x01, 0x3B, 0x06, 0x08, 0x96, 0x09, 0x11, 
+  0x14, 0x18, 0x2D, 0x17, 0x14, 0x1D, 0x0C, 0x1D, 0x14, 0x1C, 0x35, 0x13, 0x0B, 0x0C, 0x13, 0x14, 0x2C, 0x19, 0x1C, 0x0F, 
+  0x3B, 0x08, 0x09, 0x94, 0x3B, 0x16, 0x0F, 0x07, 0x23, 0x1A, 0x19, 0x2C, 0x17, 0x1C, 0x24, 0x24, 0x1C, 0x23, 0x18, 0x32, 
+  0x17, 0x05, 0x0D, 0x3B, 0x3B, 0x09, 0x0C, 0x8E, 0x3B, 0x09, 0x0D, 0x34, 0x0C, 0x14, 0x1C, 0x23, 0x1C, 0x24, 0x0C, 0x34, 
+  0x02, 0x09, 0x3B, 0x0C, 0x0C, 0x8E, 0x3B, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x05, 0x04, 0x11, 0x0D, 0x10, 0x01, 
+  0x3B, 0x0C, 0x0A, 0x92, 0x09, 0x10, 0x07, 0x1D, 0x23, 0x31, 0x18, 0x1A, 0x1A, 0x19, 0x31, 0x2C, 0x17, 0x35, 0x12, 0x05, 
+  0x0E, 0x10, 0x3B, 0x0A, 0x08, 0x88, 0x3B, 0x0D, 0x0A, 0x19, 0x32, 0x36, 0x36, 0x1B, 0x1B, 0x45, 0x1A, 0x86, 0x1B, 0x1A, 
+  0x2C, 0x35, 0x12, 0x04, 0x10, 0x09, 0x07, 0x99, 0x3B, 0x0B, 0x19, 0x38, 0x33, 0x1B, 0x1A, 0x1B, 0x32, 0x1A, 0x31, 0x2D, 
+  0x2C, 0x31, 0x31, 0x18, 0x31, 0x31, 0x19, 0x1A, 0x31, 0x1C, 0x12, 0x04, 0x16, 0x3B, 0x06, 0x05, 0x9C, 0x3B, 0x02, 0x2C, 
+  0x22, 0x22, 0x32, 0x1B, 0x33, 0x33, 0x1B, 0x18, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 0x1D, 0x1D, 0x24, 0x18, 
+  0x1A, 0x31, 0x35, 0x15, 0x02, 0x3B, 0x05, 0x04, 0x8F, 0x3B, 0x03, 0x1B, 0x30, 0x38, 0x1B, 0x1A, 0x36, 0x32, 0x18, 0x31, 
+  0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x35, 0x8B, 0x0B, 0x15, 0x15, 0x12, 0x14, 0x31, 0x1A, 0x18, 0x17, 0x0B, 0x0F, 0x3B, 
+  0x04, 0x03, 0xA0, 0x3B, 0x03, 0x1E, 0x25, 0x38, 0x31, 0x1C, 0x1C, 0x23, 0x18, 0x31, 0x23, 0x14, 0x0C, 0x0A, 0x06, 0x07, 
+  0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x31, 0x36, 0x1A, 0x18, 0x23, 0x13, 0x0D, 0x3B, 0x03, 0x03, 0xA1, 0x0D, 
+  0x33, 0x1E, 0x22, 0x17, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 0x15, 0x07, 0x05, 0x0E, 
+  0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x38, 0x1B, 0x18, 0x2C, 0x1D, 0x02, 0x3B, 0x02, 0x02, 0xA2, 0x3B, 0x1B, 0x21, 0x22, 
+  0x2C, 0x07, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 0x0A, 0x04, 0x03, 0x0E, 
+  0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0x1A, 0x31, 0x23, 0x0C, 0x01, 0x02, 0x01, 0xA4, 0x3B, 0x14, 0x20, 0x25, 0x1A, 0x1D, 
+  0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 0x34, 0x04, 0x07, 0x1D, 
+  0x2D, 0x1B, 0x38, 0x30, 0x22, 0x38, 0x18, 0x18, 0x23, 0x34, 0x09, 0x01, 0x01, 0xA5, 0x03, 0x1E, 0x1E, 0x36, 0x23, 0x0B, 
+  0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x1A, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 0x08, 0x05, 0x13, 0x2C, 
+  0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x32, 0x2D, 0x18, 0x23, 0x0D, 0x3B, 0x00, 0x00, 0xA5, 0x09, 0x17, 0x1F, 0x22, 0x32, 
+  0x23, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0x0B, 0x32, 0x1A, 0x2D, 0x14, 0x1D, 0x35, 0x0C, 0x05, 0x08, 0x0A, 
+  0x12, 0x31, 0x18, 0x18, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0x18, 0x2D, 0x2D, 0x13, 0x01, 0xA7, 0x3B, 0x03, 0x2B, 0x1E, 0x33, 
+  0x33, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x0D, 0x34, 0x08, 0x0A, 0x19, 0x31, 0x1C, 0x35, 0x14, 0x0B, 0x08, 0x05, 
+  0x06, 0x08, 0x0A, 0x31, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x1B, 0x2C, 0x18, 0x17, 0x0D, 0x00, 0xA8, 0x09, 0x17, 0x1F, 
+  0x22, 0x30, 0x38, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0x11, 0x04, 0x08, 0x0D, 0x34, 0x0B, 0x1A, 0x1C, 0x1D, 0x35, 0x15, 
+  0x08, 0x05, 0x34, 0x0D, 0x04, 0x07, 0x2C, 0x31, 0x2D, 0x1A, 0x33, 0x22, 0x1B, 0x1A, 0x2C, 0x18, 0x06, 0x3B, 0xA8, 0x10, 
+  0x25, 0x20, 0x36, 0x20, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x0A, 0x34, 0x08, 0x01, 0x3B, 0x02, 0x08, 0x13, 0x23, 0x35, 
+  0x1D, 0x06, 0x34, 0x08, 0x0D, 0x3B, 0x01, 0x04, 0x05, 0x17, 0x2C, 0x18, 0x36, 0x30, 0x36, 0x1A, 0x23, 0x18, 0x23, 0x09, 
+  0x8D, 0x03, 0x1F, 0x1E, 0x30, 0x20, 0x30, 0x38, 0x18, 0x23, 0x18, 0x2D, 0x07, 0x08, 0x01, 0x42, 0x16, 0x87, 0x0D, 0x34, 
+  0x13, 0x35, 0x13, 0x34, 0x34, 0x0F, 0x42, 0x16, 0x8C, 0x01, 0x08, 0x06, 0x2C, 0x18, 0x32, 0x30, 0x1E, 0x1B, 0x23, 0x2D, 
+  0x1A, 0x0F, 0x8D, 0x08, 0x2B, 0x22, 0x20, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x31, 0x05, 0x0E, 0x42, 0x16, 0x87, 
+  0x3B, 0x0F, 0x08, 0x0B, 0x0A, 0x08, 0x03, 0x3B, 0x42, 0x16, 0x8C, 0x11, 0x05, 0x23, 0x31, 0x19, 0x36, 0x25, 0x20, 0x33, 
+  0x19, 0x23, 0x1A, 0x05, 0x8E, 0x35, 0x26, 0x33, 0x1F, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 0x36, 0x18, 0x05, 0x0E, 
+  0x43, 0x16, 0x83, 0x03, 0x34, 0x34, 0x11, 0x43, 0x16, 0x8D, 0x11, 0x05, 0x23, 0x19, 0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x25, 
+  0x32, 0x1C, 0x19, 0x13, 0x87, 0x2C, 0x1F, 0x36, 0x1F, 0x20, 0x20, 0x1E, 0x38, 0x42, 0x30, 0x84, 0x22, 0x22, 0x18, 0x34, 
+  0x03, 0x42, 0x16, 0x95, 0x3B, 0x11, 0x0E, 0x3B, 0x16, 0x16, 0x3B, 0x03, 0x34, 0x1C, 0x1B, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 
+  0x1F, 0x20, 0x33, 0x24, 0x18, 0x1C, 0x91, 0x1B, 0x20, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 
+  0x1E, 0x18, 0x34, 0x03, 0x3B, 0x45, 0x16, 0x83, 0x3B, 0x03, 0x34, 0x17, 0x44, 0x32, 0x87, 0x22, 0x20, 0x1F, 0x1F, 0x22, 
+  0x24, 0x31, 0x17, 0x88, 0x33, 0x21, 0x32, 0x1F, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x42, 0x30, 0x86, 0x22, 0x30, 0x25, 0x1C, 
+  0x08, 0x0D, 0x3B, 0x43, 0x16, 0x84, 0x3B, 0x0D, 0x08, 0x14, 0x25, 0x42, 0x22, 0x89, 0x30, 0x22, 0x25, 0x1F, 0x26, 0x26, 
+  0x1E, 0x1C, 0x2D, 0x23, 0x86, 0x1B, 0x21, 0x1B, 0x21, 0x1E, 0x1E, 0x22, 0x43, 0x36, 0x81, 0x32, 0x32, 0x42, 0x1B, 0x89, 
+  0x14, 0x34, 0x0F, 0x3B, 0x16, 0x16, 0x3B, 0x0D, 0x34, 0x1C, 0x45, 0x30, 0x88, 0x22, 0x1E, 0x1F, 0x2B, 0x26, 0x1E, 0x14, 
+  0x2C, 0x1C, 0x82, 0x18, 0x20, 0x1B, 0x42, 0x25, 0x80, 0x38, 0x42, 0x1B, 0x42, 0x1A, 0x85, 0x19, 0x18, 0x31, 0x0B, 0x08, 
+  0x10, 0x43, 0x16, 0x85, 0x10, 0x08, 0x0C, 0x32, 0x33, 0x38, 0x43, 0x22, 0x87, 0x1E, 0x1F, 0x2B, 0x1F, 0x22, 0x35, 0x2C, 
+  0x24, 0x92, 0x14, 0x20, 0x1B, 0x30, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 0x18, 0x31, 0x31, 0x2D, 0x12, 0x08, 0x10, 
+  0x3B, 0x43, 0x16, 0x91, 0x3B, 0x10, 0x08, 0x12, 0x19, 0x1B, 0x32, 0x33, 0x38, 0x22, 0x1E, 0x26, 0x2B, 0x21, 0x32, 0x35, 
+  0x2C, 0x1D, 0xA8, 0x06, 0x1F, 0x1B, 0x22, 0x22, 0x30, 0x38, 0x1B, 0x18, 0x31, 0x31, 0x2D, 0x2D, 0x31, 0x1D, 0x34, 0x0D, 
+  0x3B, 0x16, 0x16, 0x01, 0x01, 0x16, 0x16, 0x3B, 0x0D, 0x08, 0x0B, 0x2C, 0x18, 0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0x38, 
+  0x2D, 0x14, 0x2D, 0x34, 0x88, 0x03, 0x1F, 0x32, 0x1B, 0x38, 0x30, 0x38, 0x1B, 0x18, 0x42, 0x2D, 0x84, 0x31, 0x1D, 0x08, 
+  0x0D, 0x3B, 0x42, 0x16, 0x81, 0x04, 0x08, 0x42, 0x16, 0x8F, 0x3B, 0x0D, 0x08, 0x0A, 0x1C, 0x2C, 0x18, 0x32, 0x1E, 0x26, 
+  0x26, 0x1A, 0x14, 0x24, 0x31, 0x0F, 0x8F, 0x10, 0x21, 0x38, 0x31, 0x33, 0x33, 0x22, 0x32, 0x19, 0x31, 0x31, 0x18, 0x1C, 
+  0x34, 0x03, 0x3B, 0x42, 0x16, 0x83, 0x0E, 0x05, 0x05, 0x04, 0x42, 0x16, 0x8E, 0x3B, 0x03, 0x34, 0x0A, 0x1D, 0x23, 0x1B, 
+  0x1E, 0x26, 0x33, 0x2D, 0x1D, 0x24, 0x17, 0x09, 0xA8, 0x3B, 0x2D, 0x21, 0x18, 0x1A, 0x1B, 0x30, 0x33, 0x1B, 0x19, 0x18, 
+  0x1C, 0x34, 0x03, 0x3B, 0x16, 0x16, 0x3B, 0x11, 0x34, 0x13, 0x24, 0x05, 0x0E, 0x3B, 0x16, 0x16, 0x3B, 0x0F, 0x34, 0x07, 
+  0x1D, 0x19, 0x1E, 0x20, 0x23, 0x1C, 0x1D, 0x1C, 0x05, 0x3B, 0xA7, 0x3B, 0x11, 0x2B, 0x1B, 0x2D, 0x1B, 0x33, 0x30, 0x38, 
+  0x1B, 0x19, 0x15, 0x08, 0x10, 0x3B, 0x16, 0x16, 0x11, 0x34, 0x13, 0x1D, 0x24, 0x17, 0x05, 0x11, 0x16, 0x16, 0x3B, 0x10, 
+  0x08, 0x34, 0x13, 0x18, 0x25, 0x1B, 0x1D, 0x13, 0x1D, 0x1C, 0x0F, 0x00, 0x00, 0xA5, 0x09, 0x31, 0x30, 0x31, 0x1A, 0x32, 
+  0x25, 0x25, 0x22, 0x32, 0x1A, 0x12, 0x08, 0x0D, 0x09, 0x0F, 0x08, 0x0B, 0x35, 0x1D, 0x14, 0x2C, 0x17, 0x08, 0x03, 0x09, 
+  0x02, 0x08, 0x04, 0x34, 0x35, 0x1A, 0x36, 0x34, 0x12, 0x0C, 0x35, 0x13, 0x01, 0x01, 0xA5, 0x03, 0x1E, 0x1B, 0x2C, 0x32, 
+  0x36, 0x1E, 0x1E, 0x22, 0x32, 0x1A, 0x0A, 0x08, 0x03, 0x34, 0x07, 0x1D, 0x35, 0x1D, 0x14, 0x23, 0x18, 0x1C, 0x34, 0x11, 
+  0x08, 0x34, 0x08, 0x15, 0x1C, 0x19, 0x11, 0x04, 0x12, 0x13, 0x1C, 0x03, 0x3B, 0x00, 0x01, 0xA4, 0x3B, 0x1C, 0x30, 0x31, 
+  0x2C, 0x32, 0x33, 0x20, 0x1E, 0x22, 0x32, 0x1C, 0x06, 0x34, 0x34, 0x12, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x31, 0x1A, 0x14, 
+  0x04, 0x0B, 0x13, 0x13, 0x24, 0x18, 0x0F, 0x3B, 0x07, 0x0C, 0x35, 0x05, 0x3B, 0x01, 0x02, 0xA2, 0x09, 0x22, 0x32, 0x2C, 
+  0x31, 0x32, 0x38, 0x20, 0x1E, 0x36, 0x1C, 0x0A, 0x05, 0x15, 0x0C, 0x1D, 0x35, 0x1D, 0x14, 0x17, 0x2D, 0x19, 0x32, 0x23, 
+  0x19, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x04, 0x0B, 0x13, 0x13, 0x01, 0x02, 0x02, 0xA2, 0x3B, 0x0F, 0x33, 0x19, 0x23, 0x2C, 
+  0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 0x23, 0x31, 0x19, 0x1A, 0x32, 0x30, 0x25, 
+  0x1B, 0x0F, 0x3E, 0x11, 0x0A, 0x0C, 0x35, 0x02, 0x3B, 0x02, 0x03, 0xA0, 0x3B, 0x04, 0x32, 0x31, 0x17, 0x17, 0x31, 0x14, 
+  0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 0x22, 0x20, 0x20, 0x18, 0x11, 0x0F, 0x34, 
+  0x0A, 0x0B, 0x13, 0x0D, 0x3B, 0x03, 0x04, 0x8D, 0x3B, 0x03, 0x1B, 0x2D, 0x1C, 0x24, 0x13, 0x06, 0x04, 0x0B, 0x18, 0x32, 
+  0x38, 0x36, 0x42, 0x32, 0x8C, 0x33, 0x25, 0x20, 0x25, 0x17, 0x0C, 0x12, 0x05, 0x06, 0x0A, 0x0B, 0x1D, 0x0D, 0x05, 0x05, 
+  0x9C, 0x3B, 0x03, 0x2D, 0x2D, 0x1C, 0x14, 0x13, 0x05, 0x04, 0x0E, 0x0A, 0x24, 0x31, 0x19, 0x18, 0x18, 0x2D, 0x14, 0x0B, 
+  0x06, 0x0A, 0x12, 0x06, 0x07, 0x0A, 0x0C, 0x12, 0x10, 0x3B, 0x05, 0x06, 0x8C, 0x3B, 0x01, 0x12, 0x1A, 0x1C, 0x14, 0x1D, 
+  0x0C, 0x12, 0x0A, 0x0A, 0x07, 0x07, 0x42, 0x05, 0x8A, 0x07, 0x07, 0x06, 0x06, 0x07, 0x0A, 0x12, 0x13, 0x08, 0x01, 0x3B, 
+  0x06, 0x08, 0x8B, 0x09, 0x0F, 0x35, 0x1C, 0x24, 0x35, 0x13, 0x0C, 0x12, 0x0A, 0x0A, 0x15, 0x42, 0x07, 0x87, 0x15, 0x0A, 
+  0x0A, 0x0B, 0x0C, 0x0A, 0x0D, 0x3B, 0x08, 0x09, 0x80, 0x3B, 0x00, 0x90, 0x0F, 0x34, 0x1C, 0x1C, 0x14, 0x13, 0x0C, 0x0B, 
+  0x0B, 0x12, 0x12, 0x0B, 0x0C, 0x13, 0x0C, 0x08, 0x0D, 0x00, 0x80, 0x3B, 0x09, 0x0C, 0x8E, 0x3B, 0x09, 0x0F, 0x34, 0x0B, 
+  0x0C, 0x13, 0x13, 0x0C, 0x0B, 0x15, 0x04, 0x0D, 0x09, 0x3B, 0x0C, 0x0B, 0x90, 0x3F, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 
+  0x44, 0x45, 0x44, 0x82, 0xCC, 0x42, 0x41, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x85, 0x3F, 0x46, 0x44, 0x47, 0x48, 0x49, 0x43, 
+  0x4A, 0x88, 0x49, 0x48, 0x47, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x87, 0x0A, 0x08, 0x86, 0x3F, 0x41, 0x43, 0x48, 0x4A, 0x50, 
+  0x50, 0x43, 0x51, 0x43, 0x52, 0x87, 0x4A, 0x48, 0x4B, 0x53, 0x54, 0xED, 0x56, 0x3F, 0x08, 0x07, 0x99, 0x3F, 0x44, 0x48, 
+  0x52, 0x50, 0x51, 0x51, 0x57, 0x58, 0x59, 0x5A, 0x5A, 0x5B, 0x5A, 0x5A, 0x59, 0x5C, 0xE1, 0x4A, 0x48, 0x4B, 0x5E, 0x5F, 
+  0x55, 0x3F, 0x3B, 0x06, 0x05, 0x8C, 0x3F, 0x46, 0x45, 0x49, 0x50, 0x51, 0x52, 0x60, 0x61, 0x62, 0x63, 0x1F, 0x1F, 0x44, 
+  0x20, 0x8A, 0x64, 0x91, 0xEE, 0xBD, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x56, 0x3B, 0x05, 0x04, 0x9E, 0x3F, 0x6C, 0x68, 0x4A, 
+  0x50, 0x51, 0x60, 0x6D, 0x63, 0x27, 0x28, 0x29, 0x2A, 0x27, 0x2B, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x6E, 0x6E, 0x5B, 
+  0x6F, 0x70, 0x4C, 0x6A, 0x71, 0xE0, 0x3F, 0x04, 0x03, 0xA0, 0x3F, 0x6C, 0x4B, 0x4A, 0x50, 0x52, 0x58, 0x64, 0x2B, 0x2F, 
+  0x2E, 0x2F, 0x2F, 0x28, 0x27, 0x26, 0x26, 0x2B, 0x26, 0x26, 0x1E, 0x32, 0x18, 0x1A, 0x30, 0x73, 0x74, 0xC5, 0x53, 0x6A, 
+  0x71, 0x76, 0x3B, 0x03, 0x03, 0x88, 0x46, 0x70, 0x49, 0x50, 0xEB, 0x0A, 0x6E, 0x21, 0x27, 0x42, 0x2E, 0x95, 0x27, 0x20, 
+  0x1E, 0x30, 0x30, 0x1E, 0x25, 0x1E, 0x22, 0x1B, 0x19, 0x22, 0x26, 0x27, 0x77, 0x78, 0x79, 0x53, 0x5F, 0x7A, 0x7B, 0x3F, 
+  0x02, 0x02, 0x90, 0x3F, 0x4D, 0x47, 0x50, 0x57, 0x15, 0x7C, 0x31, 0x33, 0x1F, 0x2A, 0x27, 0x20, 0x1F, 0x27, 0x27, 0x2B, 
+  0x42, 0x26, 0x8E, 0x21, 0x1A, 0x2C, 0x1B, 0x20, 0x2A, 0x2F, 0x28, 0x77, 0x2F, 0x7D, 0x7E, 0x7F, 0x80, 0x81, 0x02, 0x01, 
+  0xA4, 0x3F, 0x82, 0x4B, 0x4A, 0x52, 0x83, 0x7C, 0x24, 0x1C, 0x31, 0x36, 0x22, 0x2B, 0x2E, 0x2E, 0x2F, 0x2A, 0x2B, 0x26, 
+  0x2B, 0x26, 0x20, 0x32, 0x18, 0x38, 0x26, 0x28, 0x2F, 0x2F, 0x29, 0x77, 0x28, 0x84, 0x54, 0x85, 0x86, 0x87, 0x01, 0x01, 
+  0x9A, 0x41, 0x4C, 0x48, 0x52, 0x88, 0x6E, 0x19, 0x1C, 0x24, 0x35, 0x14, 0x1E, 0x2A, 0x78, 0x8B, 0x92, 0x2A, 0x2B, 0x26, 
+  0x2B, 0x26, 0x25, 0x1A, 0x32, 0xC7, 0x29, 0x28, 0x42, 0x2F, 0x87, 0x28, 0x29, 0x78, 0x6A, 0x5F, 0x89, 0x7B, 0x3B, 0x00, 
+  0x00, 0x9B, 0x87, 0x82, 0x4B, 0x4A, 0x8A, 0x64, 0x30, 0x36, 0x18, 0x14, 0x0C, 0x1C, 0xEF, 0x96, 0xF0, 0x9C, 0x8B, 0x28, 
+  0x2B, 0x26, 0x26, 0x1F, 0x38, 0x19, 0xA0, 0xF0, 0xF1, 0x92, 0x43, 0x2F, 0x86, 0x28, 0x8B, 0x8C, 0x7E, 0x8D, 0x5C, 0x3F, 
+  0x00, 0x9D, 0x3F, 0x56, 0x5E, 0x45, 0x8E, 0x21, 0x26, 0x26, 0x21, 0x36, 0x1C, 0x17, 0xD9, 0x97, 0xF2, 0xF3, 0xF0, 0xAA, 
+  0x77, 0x27, 0x26, 0x2B, 0x20, 0x91, 0xB7, 0xF0, 0xF3, 0xF2, 0xF1, 0x92, 0x42, 0x2F, 0x86, 0x29, 0x28, 0x8B, 0x7F, 0x5F, 
+  0x8F, 0x7B, 0x00, 0xA8, 0x3F, 0xED, 0x4C, 0x49, 0x6F, 0x90, 0x29, 0x2A, 0x2B, 0x22, 0x22, 0xEF, 0xB6, 0xF0, 0xB5, 0x7E, 
+  0xF3, 0xF0, 0x78, 0x27, 0x26, 0x26, 0x1E, 0xB7, 0xF0, 0xF4, 0x53, 0xF5, 0xF0, 0xF6, 0x8B, 0x2F, 0x2F, 0x28, 0x28, 0x92, 
+  0x93, 0x6A, 0x85, 0x86, 0x09, 0xA8, 0x81, 0x94, 0x4C, 0x49, 0x2B, 0x77, 0x2F, 0x2F, 0x27, 0x2B, 0x74, 0xF7, 0xF0, 0xF8, 
+  0x53, 0x7E, 0x7E, 0xF3, 0xF9, 0x78, 0x26, 0x26, 0xAC, 0xF0, 0xF5, 0x53, 0x7E, 0x4C, 0xF4, 0xF2, 0xF6, 0x77, 0x2F, 0x29, 
+  0x28, 0x2F, 0x78, 0x8D, 0x8D, 0x99, 0x87, 0x8E, 0x4F, 0x6A, 0x68, 0xFA, 0x9B, 0x37, 0x2E, 0x2E, 0x27, 0x29, 0x28, 0x9C, 
+  0xF2, 0xF4, 0x53, 0x42, 0x7E, 0x85, 0xAF, 0xF9, 0x73, 0xC7, 0xF0, 0xF5, 0x42, 0x7E, 0x84, 0x53, 0xF3, 0xF0, 0x78, 0x29, 
+  0x42, 0x2F, 0x85, 0x29, 0x8B, 0x7A, 0x5F, 0xA1, 0x11, 0x96, 0x6C, 0x54, 0x68, 0xFB, 0x2E, 0x39, 0x39, 0x2E, 0x2F, 0x2E, 
+  0x2E, 0x92, 0xFC, 0xF0, 0xF4, 0x53, 0x7E, 0x7E, 0x5E, 0xF2, 0xF7, 0xF9, 0xF3, 0x43, 0x7E, 0x8D, 0xF3, 0xF0, 0xAA, 0x77, 
+  0x2F, 0x2E, 0x2E, 0x2F, 0x2F, 0x8B, 0xA2, 0x54, 0x7A, 0xA3, 0x95, 0xAE, 0x5E, 0x45, 0xA5, 0x2E, 0x39, 0x39, 0x2F, 0x37, 
+  0x39, 0x39, 0x37, 0x8B, 0xF6, 0xF2, 0xB5, 0x7E, 0x7E, 0x53, 0xF8, 0xF0, 0xF3, 0x42, 0x7E, 0x84, 0x53, 0xF5, 0xF2, 0xF1, 
+  0x2F, 0x42, 0x2E, 0x87, 0x37, 0x2E, 0x2E, 0x8B, 0xA6, 0x5E, 0x7D, 0x5C, 0x87, 0x55, 0x5E, 0x70, 0xA7, 0x37, 0x39, 0x39, 
+  0x2E, 0x44, 0x39, 0x8F, 0xA8, 0xF7, 0xF0, 0xF8, 0x53, 0x7E, 0x7E, 0xF8, 0x5E, 0x7E, 0x7E, 0x53, 0xF4, 0xF0, 0x9C, 0x8B, 
+  0x43, 0x2E, 0x87, 0x39, 0x2E, 0x37, 0x37, 0xA8, 0x54, 0x71, 0xA9, 0x87, 0xFA, 0x5E, 0x70, 0x78, 0x37, 0x39, 0x39, 0x37, 
+  0x45, 0x39, 0x8E, 0x37, 0xF7, 0xF2, 0x5E, 0x7E, 0x7E, 0x53, 0x7E, 0x7E, 0x53, 0xB5, 0xF2, 0xF6, 0x2E, 0x2E, 0x43, 0x37, 
+  0x87, 0x39, 0x37, 0x39, 0x37, 0xA8, 0x8D, 0x85, 0x99, 0x83, 0xFA, 0x5E, 0x94, 0xA6, 0x42, 0x39, 0x80, 0x37, 0x47, 0x39, 
+  0x82, 0xF9, 0xF2, 0x5E, 0x43, 0x7E, 0x83, 0xF8, 0xF0, 0xF6, 0xA8, 0x48, 0x39, 0x84, 0xA8, 0xA8, 0x7D, 0x85, 0x99, 0x89, 
+  0xFA, 0x54, 0x69, 0x78, 0x37, 0x39, 0x39, 0x37, 0x37, 0x39, 0x42, 0x37, 0x86, 0x2E, 0x37, 0x8B, 0xF6, 0xF0, 0xB5, 0x53, 
+  0x42, 0x7E, 0x83, 0xF5, 0xF0, 0xA7, 0xA8, 0x45, 0x39, 0x80, 0x3A, 0x42, 0x39, 0x83, 0xA8, 0x8D, 0x71, 0xA9, 0x83, 0xAB, 
+  0x54, 0x69, 0xA7, 0x48, 0x2E, 0x85, 0x2F, 0x92, 0x9C, 0xF2, 0xF4, 0x53, 0x43, 0x7E, 0x83, 0x4C, 0xF3, 0xF0, 0x78, 0x45, 
+  0x39, 0x87, 0x3A, 0x39, 0x39, 0xA8, 0xA8, 0x6A, 0x7D, 0xA9, 0x83, 0xAE, 0x6A, 0x7E, 0xA7, 0x45, 0x2E, 0x86, 0x2F, 0x2F, 
+  0x29, 0x77, 0xF1, 0xF0, 0xF5, 0x42, 0x7E, 0x80, 0x53, 0x43, 0x7E, 0x83, 0xF3, 0xF9, 0xA6, 0x37, 0x46, 0x39, 0x84, 0xA8, 
+  0x39, 0x54, 0x7A, 0x88, 0x90, 0x72, 0x8D, 0x53, 0x93, 0x2E, 0x2E, 0x2F, 0x2E, 0x2F, 0x2F, 0x29, 0x28, 0x28, 0xA7, 0xF0, 
+  0xF3, 0x4C, 0x42, 0x7E, 0x82, 0xF3, 0xF4, 0x53, 0x42, 0x7E, 0x85, 0xF2, 0xF9, 0x28, 0x2F, 0x2E, 0x37, 0x43, 0x39, 0x84, 
+  0xA8, 0x93, 0x5F, 0xA1, 0xA3, 0x8E, 0x56, 0x84, 0x5E, 0x8F, 0xA8, 0x2F, 0x2F, 0x29, 0x2F, 0x29, 0x28, 0x28, 0x78, 0xF9, 
+  0xF3, 0x43, 0x7E, 0x8C, 0xF3, 0xF0, 0xF0, 0xF4, 0x53, 0x7E, 0x7E, 0x5E, 0xF2, 0xF7, 0x27, 0x29, 0x2E, 0x42, 0x37, 0x85, 
+  0x39, 0xA8, 0x89, 0x85, 0x8C, 0x7B, 0x97, 0x81, 0x6B, 0x6A, 0x7E, 0x8B, 0x2F, 0x29, 0x28, 0x29, 0x28, 0x77, 0x2A, 0xF9, 
+  0xF3, 0x53, 0x7E, 0x7E, 0x53, 0xF4, 0xF0, 0x9C, 0xF6, 0xF0, 0xF8, 0x42, 0x7E, 0x8D, 0xF8, 0xF2, 0x96, 0x2B, 0x28, 0x2E, 
+  0x2F, 0x2E, 0x39, 0xA6, 0x85, 0x7A, 0xBC, 0x87, 0x8D, 0x3F, 0xBD, 0x8D, 0x7E, 0xBC, 0x92, 0x2F, 0x2A, 0x28, 0x2F, 0x28, 
+  0xF9, 0xF2, 0x5E, 0x42, 0x7E, 0x87, 0xF5, 0xF0, 0x9C, 0x73, 0x77, 0xF6, 0xF0, 0xF8, 0x42, 0x7E, 0x8C, 0xB5, 0xF0, 0xF7, 
+  0x73, 0x27, 0x2A, 0x2F, 0x8B, 0xF1, 0x8D, 0xA1, 0x86, 0x87, 0x85, 0x3B, 0x76, 0x7D, 0x6A, 0x5F, 0xA6, 0x42, 0x28, 0x9E, 
+  0x2F, 0x8B, 0xF1, 0xF0, 0xF3, 0x5E, 0x53, 0xB5, 0xF0, 0x96, 0x73, 0x2B, 0x27, 0x28, 0xF7, 0xF2, 0xF8, 0x7E, 0xF8, 0xF2, 
+  0xB0, 0x61, 0x30, 0x20, 0x26, 0x2A, 0x8B, 0x8F, 0x71, 0xBE, 0x7B, 0x00, 0x00, 0xA6, 0x87, 0xAB, 0x85, 0xBF, 0xBC, 0x92, 
+  0x2F, 0x29, 0x2F, 0x2E, 0x8B, 0xAA, 0xF0, 0x9D, 0xF4, 0xF0, 0x96, 0x63, 0x2B, 0x26, 0x2B, 0x29, 0x28, 0xF7, 0xF2, 0xB5, 
+  0xF2, 0xB6, 0xD9, 0x6E, 0x1A, 0x33, 0x21, 0x73, 0xBC, 0x7F, 0x89, 0xB3, 0x16, 0x00, 0x01, 0x85, 0x56, 0x71, 0x5F, 0x5F, 
+  0x78, 0x92, 0x42, 0x2F, 0x87, 0x2E, 0x2E, 0x78, 0xF9, 0xF0, 0xA0, 0x30, 0x26, 0x42, 0x2B, 0x91, 0x28, 0x92, 0xA6, 0xF9, 
+  0xF0, 0xF7, 0x6E, 0x1C, 0x14, 0x23, 0x19, 0x33, 0x30, 0x84, 0x7D, 0xBE, 0x7B, 0x3F, 0x00, 0x01, 0x87, 0x3B, 0xAE, 0x85, 
+  0x6A, 0x84, 0x28, 0x2E, 0x2E, 0x42, 0x2F, 0x99, 0x90, 0xE4, 0xFD, 0x19, 0x1E, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x92, 
+  0x78, 0xF6, 0x2B, 0x22, 0x2C, 0x14, 0x24, 0x2C, 0x91, 0xC0, 0x8D, 0xC1, 0x86, 0x87, 0x01, 0x02, 0xA2, 0x3F, 0xC2, 0x85, 
+  0x6A, 0xC1, 0x8B, 0x8B, 0x2F, 0x2F, 0x27, 0x20, 0x36, 0x91, 0x33, 0x20, 0x2B, 0x2B, 0x26, 0x2B, 0x2A, 0x2F, 0x2E, 0x2E, 
+  0x8B, 0x2A, 0x1F, 0x32, 0x23, 0x1C, 0x17, 0xC3, 0x7F, 0x89, 0xA9, 0x81, 0x02, 0x02, 0xA2, 0x3F, 0x56, 0xC0, 0x85, 0x6A, 
+  0xA1, 0x2E, 0x2E, 0x29, 0x26, 0x22, 0x19, 0x1A, 0x22, 0x26, 0x2B, 0x27, 0x2B, 0x2B, 0x2A, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 
+  0x27, 0x21, 0x1B, 0x6E, 0x66, 0x7F, 0x8F, 0x8C, 0x7B, 0x3B, 0x02, 0x03, 0x8D, 0x3F, 0x4F, 0xC0, 0x85, 0x6A, 0x8F, 0x78, 
+  0x77, 0x63, 0x32, 0x18, 0x1B, 0x25, 0x26, 0x43, 0x2B, 0x8E, 0x27, 0x28, 0x2F, 0x2F, 0x2E, 0x2E, 0x2F, 0x73, 0x6D, 0x6B, 
+  0x7F, 0x8F, 0x99, 0x76, 0x3B, 0x03, 0x04, 0x92, 0x3F, 0x4F, 0xC0, 0x7D, 0x7F, 0x8D, 0xBC, 0x64, 0x91, 0x1B, 0x38, 0x21, 
+  0x26, 0x2B, 0x2B, 0x26, 0x2B, 0x27, 0x28, 0x42, 0x2E, 0x87, 0x8B, 0x8B, 0xFB, 0xC5, 0x7F, 0x8F, 0x99, 0x76, 0x05, 0x05, 
+  0x9C, 0x3F, 0x4F, 0xC2, 0x7A, 0x84, 0x6A, 0xC5, 0xC6, 0x5B, 0x64, 0x63, 0x90, 0x2B, 0x27, 0x2B, 0x2B, 0x27, 0x2F, 0x8B, 
+  0x8B, 0xA6, 0x93, 0x6B, 0x94, 0x84, 0xA1, 0x6F, 0x81, 0x3B, 0x05, 0x06, 0x8A, 0x3B, 0x40, 0xAE, 0x89, 0x7A, 0x8D, 0x5F, 
+  0x7F, 0x6B, 0xFB, 0x74, 0x42, 0x90, 0x8C, 0x73, 0x90, 0x27, 0x93, 0x8F, 0xC5, 0x7F, 0xC5, 0x8F, 0xC1, 0xC8, 0x40, 0x3B, 
+  0x06, 0x08, 0x96, 0x87, 0x56, 0xAB, 0x8F, 0x7A, 0x84, 0x8D, 0x6A, 0x69, 0x94, 0x8D, 0x84, 0xC5, 0x94, 0x69, 0x4D, 0x75, 
+  0x9A, 0xC0, 0xC9, 0x8A, 0x4F, 0x87, 0x08, 0x09, 0x94, 0x3F, 0x3B, 0x56, 0x72, 0x6B, 0x89, 0x89, 0x8F, 0x6B, 0x84, 0x84, 
+  0x6B, 0x6B, 0xC0, 0x79, 0xC9, 0x79, 0xC8, 0x56, 0x3B, 0x3B, 0x09, 0x0C, 0x85, 0x3F, 0x87, 0x41, 0x72, 0xAB, 0xC2, 0x42, 
+  0xCA, 0x85, 0xC3, 0xAB, 0xC8, 0x4F, 0x87, 0x3F, 0x0C, 0x0B, 0x86, 0x3F, 0x3F, 0x40, 0x46, 0x6C, 0xCB, 0x4E, 0x42, 0x82, 
+  0x86, 0xCC, 0xCB, 0x42, 0x46, 0x40, 0x3F, 0x3F, 0x0B, 0x0A, 0x86, 0x87, 0x46, 0x55, 0xFA, 0x8F, 0x8F, 0x79, 0x42, 0xC9, 
+  0x88, 0x79, 0xCA, 0xC0, 0x9A, 0x75, 0x82, 0x43, 0x41, 0x3F, 0x0A, 0x08, 0x87, 0x3F, 0x56, 0xAE, 0x89, 0xC1, 0xBE, 0xBE, 
+  0xC1, 0x44, 0xCD, 0x43, 0xC9, 0x84, 0xCA, 0x9A, 0xCE, 0xCC, 0x46, 0x09, 0x07, 0x89, 0x3F, 0xAB, 0xC9, 0xBE, 0x99, 0xC9, 
+  0xC9, 0xB3, 0x5B, 0x5B, 0x44, 0xEE, 0x8A, 0xCF, 0xC6, 0x5C, 0xC9, 0xA1, 0x79, 0xC2, 0x75, 0xCC, 0x40, 0x3F, 0x06, 0x05, 
+  0x9C, 0x3B, 0x81, 0x6F, 0x8C, 0x8C, 0xC1, 0xCD, 0xD3, 0xD1, 0x91, 0x18, 0x2C, 0x1C, 0x35, 0x1D, 0x14, 0x24, 0x1C, 0x14, 
+  0x7C, 0x7C, 0x88, 0x79, 0xC9, 0x79, 0xFA, 0x4E, 0x46, 0x3F, 0x05, 0x04, 0x8F, 0x3B, 0x76, 0xCD, 0xD2, 0xBE, 0xCD, 0xD3, 
+  0x6D, 0x65, 0x18, 0x31, 0x2D, 0x17, 0x35, 0x13, 0x13, 0x42, 0x35, 0x8B, 0x0B, 0x15, 0x15, 0x12, 0x14, 0xC6, 0xC9, 0x89, 
+  0x80, 0xED, 0x6C, 0x3F, 0x04, 0x03, 0xA0, 0x3B, 0x76, 0xD2, 0xD2, 0x8C, 0x6F, 0x17, 0x1C, 0x23, 0x18, 0x31, 0x23, 0x14, 
+  0x0C, 0x0A, 0x06, 0x07, 0x0A, 0x12, 0x0B, 0x0A, 0x07, 0x06, 0x0A, 0x1D, 0x6E, 0x6D, 0xC9, 0x89, 0x80, 0x9A, 0x41, 0x3B, 
+  0x03, 0x03, 0xA1, 0x7B, 0xBC, 0xD2, 0xBE, 0x5C, 0x0B, 0x15, 0x07, 0x1D, 0x1C, 0x35, 0x12, 0x0A, 0x15, 0x15, 0x05, 0x06, 
+  0x15, 0x07, 0x05, 0x0E, 0x0E, 0x05, 0x0B, 0x17, 0x1B, 0x36, 0x6D, 0xA9, 0x8F, 0xCA, 0x9A, 0x56, 0x3B, 0x02, 0x02, 0xA2, 
+  0x3F, 0xA9, 0xD4, 0x8C, 0x5C, 0x15, 0x03, 0x0D, 0x0E, 0x08, 0x07, 0x12, 0x13, 0x24, 0x23, 0x17, 0x14, 0x1D, 0x35, 0x1D, 
+  0x0A, 0x04, 0x03, 0x0E, 0x0B, 0x31, 0x36, 0x38, 0x33, 0x22, 0xCD, 0x7A, 0xCA, 0xFA, 0x40, 0x02, 0x01, 0xA4, 0x3F, 0x58, 
+  0xD4, 0xD2, 0xCD, 0x1D, 0x08, 0x16, 0x09, 0x09, 0x01, 0x34, 0x1C, 0x1A, 0x19, 0x18, 0x2C, 0x14, 0x1D, 0x14, 0x1D, 0x0A, 
+  0x34, 0x04, 0x07, 0x1D, 0x2D, 0x1B, 0x38, 0x30, 0x64, 0x38, 0x79, 0x8F, 0x80, 0xA4, 0x87, 0x01, 0x01, 0xA5, 0x7B, 0xD4, 
+  0xD4, 0x99, 0xEE, 0x0B, 0x0E, 0x0D, 0x3C, 0x3D, 0x01, 0x15, 0x1C, 0x19, 0x1A, 0x19, 0x2D, 0x14, 0x1D, 0x35, 0x1D, 0x07, 
+  0x08, 0x05, 0x13, 0x2C, 0x2D, 0x18, 0x36, 0x22, 0x22, 0x36, 0x5B, 0x7A, 0x89, 0xC0, 0x56, 0x3B, 0x00, 0x00, 0xA5, 0x87, 
+  0x88, 0xD5, 0x8C, 0xD3, 0x6E, 0x12, 0x06, 0x03, 0x3E, 0x3E, 0x02, 0x08, 0x0B, 0xB6, 0xB9, 0x91, 0x2D, 0x14, 0x1D, 0x35, 
+  0x0C, 0x05, 0x04, 0x0A, 0xAF, 0xDB, 0x6E, 0x18, 0x1A, 0x36, 0x38, 0x22, 0x1B, 0xA9, 0x7D, 0x8F, 0xAB, 0x01, 0xA7, 0x3B, 
+  0x7B, 0xB4, 0xD4, 0x99, 0x6D, 0x2D, 0x35, 0x0A, 0x03, 0x0F, 0x11, 0x02, 0x7B, 0x9F, 0xF2, 0xF0, 0xDB, 0x31, 0x1C, 0x35, 
+  0x14, 0x0B, 0x08, 0x05, 0xB6, 0xF0, 0xF0, 0xBB, 0x19, 0x31, 0x1A, 0x36, 0x38, 0x36, 0x91, 0x7D, 0x8F, 0xCA, 0x56, 0x00, 
+  0xA8, 0x09, 0x88, 0xB4, 0xBE, 0xD0, 0xD1, 0x19, 0x2C, 0x0C, 0x06, 0x15, 0x05, 0xD7, 0x9D, 0xF2, 0xF8, 0xF5, 0xF0, 0xDB, 
+  0x17, 0x1D, 0x35, 0x15, 0x04, 0xDA, 0xF0, 0x5E, 0xF5, 0xF0, 0xDD, 0xFE, 0x2D, 0x1A, 0x33, 0x22, 0x91, 0xC6, 0x7D, 0x89, 
+  0xC8, 0x3F, 0x8D, 0x81, 0xA2, 0xD5, 0xBE, 0x63, 0x38, 0x32, 0x18, 0x14, 0x24, 0x35, 0x83, 0xF0, 0x9D, 0x42, 0x7E, 0x97, 
+  0xF3, 0xF0, 0xEE, 0x7C, 0x1D, 0x06, 0xE9, 0xF0, 0xF8, 0x7E, 0x53, 0xF5, 0xF2, 0xFD, 0xEE, 0x18, 0x36, 0x30, 0x36, 0x5B, 
+  0x71, 0x89, 0xCA, 0x87, 0x8E, 0x7B, 0x93, 0xD2, 0xBC, 0x63, 0x30, 0x38, 0x18, 0x23, 0x18, 0x6E, 0xBB, 0xF0, 0xF5, 0x53, 
+  0x42, 0x7E, 0x96, 0xAF, 0xF9, 0x35, 0x0C, 0xDC, 0xF0, 0xB5, 0x53, 0x7E, 0x7E, 0x5E, 0xF0, 0xB6, 0xEE, 0x18, 0x32, 0x30, 
+  0x1E, 0x91, 0xC0, 0x7D, 0xA1, 0x76, 0xA8, 0x08, 0x93, 0xBE, 0xC7, 0x20, 0x1E, 0x30, 0x1A, 0x1B, 0x32, 0x1B, 0x6E, 0xB7, 
+  0xF0, 0xF4, 0x53, 0x7E, 0x7E, 0x5E, 0xF2, 0xB6, 0xDC, 0xF0, 0xB5, 0x53, 0x7E, 0x53, 0x5E, 0xF2, 0xB6, 0x6E, 0x6E, 0x19, 
+  0x36, 0x25, 0x20, 0xD1, 0xA9, 0x85, 0xA1, 0xC8, 0x96, 0x83, 0xB4, 0xBE, 0xC7, 0x20, 0x20, 0x1E, 0x32, 0x38, 0x38, 0x33, 
+  0x36, 0x32, 0xFD, 0xF0, 0xB5, 0x7E, 0x7E, 0x53, 0xF8, 0xF0, 0xF0, 0xF5, 0x42, 0x7E, 0x8E, 0x5E, 0x9D, 0xF9, 0xEE, 0x19, 
+  0x1A, 0x1A, 0x36, 0x1E, 0x20, 0x64, 0xD3, 0xBA, 0x89, 0xBD, 0x87, 0xC6, 0xD5, 0xC1, 0xC7, 0x20, 0x20, 0x1E, 0x38, 0x42, 
+  0x30, 0x8B, 0x22, 0x22, 0xFF, 0xA0, 0xF0, 0xF8, 0x53, 0x7E, 0x7E, 0xF8, 0xF5, 0x53, 0x42, 0x7E, 0x8E, 0xF3, 0xF9, 0x5B, 
+  0x91, 0x1A, 0x1B, 0x1B, 0x33, 0x1E, 0x1F, 0x20, 0x6D, 0x6A, 0x8F, 0xC3, 0x91, 0xD3, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 
+  0x30, 0x25, 0x1E, 0x25, 0x1E, 0x25, 0x1E, 0x22, 0xA0, 0xF2, 0xF8, 0x46, 0x7E, 0x83, 0xF3, 0xF0, 0xDB, 0x91, 0x43, 0x32, 
+  0x87, 0x22, 0x20, 0x1F, 0x63, 0x64, 0x5F, 0x7A, 0xCA, 0x88, 0xD0, 0xD4, 0xC1, 0x74, 0x20, 0x20, 0x1E, 0x22, 0x22, 0x42, 
+  0x30, 0x86, 0x22, 0x30, 0x30, 0x64, 0xF9, 0xF2, 0x5E, 0x43, 0x7E, 0x84, 0x53, 0xF4, 0xF0, 0xAC, 0x64, 0x42, 0x22, 0x89, 
+  0x30, 0x22, 0x25, 0x1F, 0x26, 0x26, 0x1E, 0x8D, 0x7D, 0xCA, 0x86, 0xD3, 0xD4, 0xC9, 0x21, 0x1E, 0x1E, 0x22, 0x43, 0x36, 
+  0x81, 0x32, 0x32, 0x42, 0x1B, 0x82, 0x5B, 0xF0, 0xF3, 0x43, 0x7E, 0x83, 0xB5, 0xF0, 0xB9, 0x64, 0x44, 0x30, 0x88, 0x22, 
+  0x1E, 0x1F, 0x2B, 0x26, 0x64, 0x6A, 0x7D, 0x80, 0x86, 0xCF, 0xD4, 0xA1, 0x61, 0x25, 0x25, 0x38, 0x42, 0x1B, 0x42, 0x1A, 
+  0x86, 0x19, 0x18, 0x31, 0xA0, 0xF2, 0x5E, 0x53, 0x42, 0x7E, 0x85, 0x4C, 0xF3, 0xF0, 0x5B, 0x33, 0x38, 0x43, 0x22, 0x87, 
+  0x1E, 0x1F, 0x2B, 0x63, 0x6D, 0x5E, 0x71, 0x80, 0x94, 0xD9, 0xD5, 0xC9, 0x61, 0x22, 0x25, 0x38, 0x1B, 0x1A, 0x1A, 0x19, 
+  0x18, 0x31, 0x31, 0x2D, 0xA0, 0xF0, 0xF8, 0x7E, 0x7E, 0x53, 0x43, 0x7E, 0x8F, 0xF3, 0xF9, 0x5B, 0x1B, 0x32, 0x33, 0x38, 
+  0x22, 0x1E, 0x26, 0x2B, 0x1E, 0xD3, 0x54, 0x71, 0x66, 0x96, 0x06, 0xB4, 0xA1, 0xD0, 0x64, 0x30, 0x38, 0x1B, 0x18, 0x31, 
+  0x31, 0x2D, 0x2D, 0x6E, 0xDD, 0xF0, 0xB5, 0x53, 0x7E, 0x7E, 0xF8, 0xF4, 0x53, 0x42, 0x7E, 0x8E, 0xAF, 0xAF, 0xEE, 0x18, 
+  0x1A, 0x1B, 0x38, 0x21, 0x26, 0x27, 0xD1, 0x6F, 0x6A, 0x71, 0x72, 0x88, 0x7B, 0x93, 0xC1, 0xCD, 0xD1, 0x30, 0x38, 0x1B, 
+  0x18, 0x42, 0x2D, 0x8A, 0x6E, 0xFD, 0xF0, 0xB5, 0x53, 0x7E, 0x53, 0x5E, 0xF0, 0xF0, 0xF4, 0x42, 0x7E, 0x8E, 0x5E, 0xF2, 
+  0xB6, 0x17, 0x2C, 0x18, 0x32, 0x1E, 0x26, 0x26, 0x1A, 0x7F, 0x5F, 0x7D, 0x4F, 0x8E, 0x10, 0x93, 0xBE, 0x7A, 0xD1, 0x33, 
+  0x22, 0x32, 0x19, 0x31, 0x31, 0x6E, 0xBB, 0xF0, 0xF5, 0x42, 0x7E, 0x96, 0x5E, 0xF2, 0xB6, 0x97, 0xF0, 0xB5, 0x53, 0x7E, 
+  0x7E, 0xF8, 0xF0, 0xE6, 0x7C, 0x23, 0x1B, 0x1E, 0x26, 0x33, 0xCF, 0x6A, 0x5F, 0x6B, 0x87, 0x8D, 0x87, 0xCF, 0xD4, 0x7A, 
+  0xB3, 0x91, 0x30, 0x33, 0x1B, 0x19, 0x18, 0xBB, 0xF0, 0xF4, 0x42, 0x7E, 0x87, 0x53, 0xF3, 0xAF, 0x35, 0x17, 0xFD, 0xF0, 
+  0xB5, 0x42, 0x7E, 0x8C, 0xF8, 0xF2, 0xE6, 0x35, 0x19, 0x1E, 0x20, 0x6E, 0x8A, 0xBF, 0x7F, 0xA4, 0x3F, 0x8D, 0x3B, 0x11, 
+  0xB4, 0xA1, 0x8F, 0x32, 0x6D, 0x30, 0x38, 0x1B, 0x1A, 0xB7, 0xF0, 0xF3, 0x42, 0x7E, 0x96, 0xF3, 0xAF, 0xD9, 0x1D, 0x24, 
+  0xEE, 0xA0, 0xF2, 0xF8, 0x7E, 0x7E, 0xB5, 0xF0, 0xDA, 0x1D, 0x18, 0x25, 0x91, 0x1D, 0x69, 0x54, 0x8D, 0x4F, 0x00, 0x00, 
+  0xA5, 0x87, 0xC6, 0xBE, 0x7A, 0xB3, 0x65, 0x25, 0x25, 0x22, 0x32, 0x91, 0xDB, 0xF0, 0x9D, 0x7E, 0xF5, 0xF0, 0xEA, 0x35, 
+  0x1D, 0x14, 0x2C, 0x18, 0xA0, 0xF2, 0x5E, 0xF5, 0xF0, 0xDC, 0x34, 0x7C, 0x1A, 0x36, 0x34, 0xED, 0x7E, 0x54, 0x9A, 0x01, 
+  0x01, 0xA5, 0x7B, 0xD4, 0xA1, 0x7D, 0x5B, 0x36, 0x1E, 0x1E, 0x22, 0x32, 0x1A, 0xEE, 0xAF, 0xF0, 0xF0, 0xEA, 0x7C, 0x35, 
+  0x1D, 0x14, 0x23, 0x18, 0x19, 0xF9, 0xF0, 0xF0, 0xDC, 0x04, 0x15, 0x1C, 0x19, 0x11, 0xE0, 0x4B, 0x7E, 0xBA, 0x4F, 0x3B, 
+  0x00, 0x01, 0xA4, 0x3F, 0x88, 0xBE, 0x7A, 0x8F, 0x32, 0x33, 0x20, 0x1E, 0x22, 0x32, 0x17, 0xD6, 0xAF, 0xDC, 0x12, 0x1D, 
+  0x35, 0x1D, 0x14, 0x17, 0x31, 0x91, 0x5B, 0xF9, 0xBB, 0x7C, 0x13, 0x24, 0x18, 0x0F, 0x40, 0x45, 0x53, 0x54, 0xA4, 0x87, 
+  0x01, 0x02, 0xA2, 0x87, 0xBC, 0xC1, 0x71, 0x6F, 0x65, 0x38, 0x20, 0x1E, 0x36, 0x1C, 0x0A, 0x05, 0x07, 0x0C, 0x1D, 0x35, 
+  0x1D, 0x14, 0x17, 0x2D, 0x19, 0x1B, 0x65, 0x6E, 0x2D, 0x18, 0x31, 0x0F, 0x3D, 0x8E, 0x4B, 0x53, 0x75, 0x40, 0x02, 0x02, 
+  0xA2, 0x3B, 0x7B, 0x8C, 0x89, 0x85, 0x8F, 0x1A, 0x1A, 0x1E, 0x36, 0x2C, 0x1D, 0x0C, 0x13, 0x14, 0x24, 0x24, 0x14, 0x24, 
+  0x23, 0x31, 0x19, 0x1A, 0x32, 0x30, 0x25, 0x1B, 0x0F, 0x3E, 0x8E, 0x68, 0x4C, 0x6A, 0x56, 0x3F, 0x02, 0x03, 0xA0, 0x3F, 
+  0xE0, 0xC1, 0x7A, 0x85, 0x84, 0xCF, 0x7C, 0x17, 0x2C, 0x2C, 0x23, 0x2C, 0x2D, 0x2C, 0x2C, 0x17, 0x17, 0x2C, 0x18, 0x1B, 
+  0x22, 0x20, 0x20, 0x18, 0x11, 0x4F, 0x8E, 0x68, 0x4B, 0x69, 0x46, 0x3F, 0x03, 0x04, 0x8D, 0x3F, 0x76, 0xC1, 0x7D, 0x8D, 
+  0x8D, 0x66, 0x06, 0x04, 0x0B, 0x18, 0x32, 0x38, 0x36, 0x42, 0x32, 0x8C, 0x33, 0x25, 0x20, 0x25, 0x17, 0x7C, 0x12, 0xE1, 
+  0x48, 0x47, 0x4B, 0x54, 0x41, 0x05, 0x05, 0x9C, 0x3B, 0x76, 0x79, 0x7D, 0x8D, 0x6A, 0x94, 0xA4, 0xE0, 0x0E, 0x12, 0x24, 
+  0x6E, 0x19, 0x18, 0x18, 0x2D, 0x14, 0x0C, 0x06, 0xA3, 0xE2, 0x8E, 0x48, 0x68, 0x4C, 0x4D, 0x46, 0x3F, 0x05, 0x06, 0x9A, 
+  0x3F, 0x81, 0xBD, 0x7A, 0x8D, 0x6A, 0xBF, 0x69, 0x4D, 0xAE, 0x86, 0x07, 0x07, 0x05, 0x05, 0xDE, 0xE3, 0xE1, 0x8E, 0x8E, 
+  0x48, 0x47, 0x68, 0x53, 0xCC, 0x40, 0x3F, 0x06, 0x08, 0x88, 0x87, 0x56, 0xC2, 0x84, 0x5F, 0x54, 0x7E, 0x53, 0x4B, 0x42, 
+  0x47, 0x8A, 0x48, 0x49, 0x48, 0x48, 0x47, 0x68, 0x4B, 0x4C, 0xCE, 0x41, 0x3F, 0x08, 0x09, 0x89, 0x3B, 0x16, 0x56, 0xA4, 
+  0x84, 0xBA, 0x5E, 0x7E, 0x53, 0x4C, 0x43, 0x4B, 0x84, 0x4C, 0x53, 0x4D, 0xCC, 0x41, 0x00, 0x80, 0x3F, 0x09, 0x0C, 0x85, 
+  0x3F, 0x87, 0x4F, 0xA4, 0xED, 0x75, 0x42, 0x94, 0x85, 0x4D, 0xCE, 0xCB, 0x41, 0x87, 0x3F, 0x0C
 };
@@ -211,59 +211,44 @@ const uint8_t sprite_in_out_lut[] = {
 
 const uint8_t sprite_in_out[] = {
 
-  8, /*bpp*/
+  0x88, /*bpp: 8BPP, run-length encoded*/
   0x00, 0x11, /*width*/
   0x00, 0x38, /*height*/
 
-  /*Sprite raw*/
+  /*Row index*/
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xA7, 0x00, 0x01, 0x53, 0x00, 0x01, 0xFC, 
 
-  0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x04, 0x00, 0x05, 0x03, 
-  0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x07, 0x07, 
-  0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0D, 0x0E, 0x0F, 0x00, 0x10, 0x11, 0x02, 0x07, 0x07, 0x07, 0x07, 0x07, 
-  0x07, 0x07, 0x07, 0x07, 0x12, 0x13, 0x14, 0x00, 0x00, 0x00, 0x15, 0x16, 0x17, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-  0x07, 0x02, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x07, 0x03, 0x19, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1A, 0x1B, 0x1C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x1B, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x02, 0x1D, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0F, 0x03, 0x1E, 0x07, 0x07, 0x07, 0x07, 0x0D, 0x1F, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x10, 0x19, 0x13, 0x07, 0x07, 0x07, 0x21, 0x02, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x04, 
-  0x22, 0x07, 0x0A, 0x1B, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x09, 0x08, 0x24, 0x25, 
-  0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x26, 0x1B, 0x02, 0x27, 0x10, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x0B, 0x29, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x05, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 
-  0x2C, 0x2D, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0x30, 0x31, 0x00, 0x32, 0x33, 0x34, 0x35, 
-  0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x37, 0x38, 0x2E, 0x39, 0x00, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3E, 0x3E, 
-  0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45, 0x46, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 
-  0x3E, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x00, 0x00, 0x4C, 0x4D, 0x4E, 0x4F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x50, 
-  0x51, 0x52, 0x00, 0x00, 0x00, 0x53, 0x54, 0x55, 0x56, 0x47, 0x3E, 0x3E, 0x3E, 0x3E, 0x3D, 0x57, 0x58, 0x59, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4B, 0x5A, 0x5B, 0x5C, 0x3E, 0x3E, 0x3E, 0x3E, 0x5D, 0x5E, 0x5F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x53, 0x61, 0x62, 0x63, 0x64, 0x3E, 0x3E, 0x65, 0x66, 0x67, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x69, 
-  0x6A, 0x6B, 0x3E, 0x3D, 0x6C, 0x6D, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x70, 0x71, 0x72, 
-  0x73, 0x74, 0x75, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x39, 0x76, 0x77, 0x78, 0x79, 0x7A, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x7B, 0x7C, 0x7D, 0x7E, 0x43, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x81, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x83, 0x84, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x2A, 0x05, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0F, 0x29, 0x0B, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x27, 0x02, 0x1B, 
-  0x26, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x25, 0x24, 0x08, 0x09, 0x10, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x1B, 0x0A, 0x0F, 0x22, 0x04, 0x0F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x02, 0x21, 0x07, 0x07, 0x14, 0x13, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x20, 0x1F, 0x0D, 0x07, 0x07, 0x07, 0x07, 0x1E, 0x03, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1D, 
-  0x02, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x1B, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1B, 0x1A, 0x07, 0x07, 
-  0x07, 0x07, 0x07, 0x07, 0x19, 0x03, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x02, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 
-  0x07, 0x07, 0x17, 0x16, 0x15, 0x00, 0x00, 0x00, 0x14, 0x13, 0x12, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x14, 
-  0x02, 0x11, 0x10, 0x00, 0x0F, 0x0E, 0x0D, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0C, 0x0B, 0x0A, 
-  0x00, 0x09, 0x08, 0x11, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x06, 0x03, 0x05, 0x00, 0x04, 0x02, 
-  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x43, 0x85, 0x86, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x88, 
-  0x89, 0x8A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x8B, 0x8C, 0x8D, 0x8E, 0x4B, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x54, 0x8F, 0x90, 0x91, 0x92, 0x68, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x43, 0x9A, 0x9B, 0x9C, 0x3D, 0x3D, 0x9D, 0x9E, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xA0, 0xA1, 0xA2, 0x4F, 0x3E, 0x3E, 0xA3, 0xA4, 0xA5, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xA6, 0xA7, 0xA8, 
-  0x3E, 0x3E, 0x3E, 0x3E, 0x77, 0xA9, 0xAA, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0xAC, 0x38, 0x47, 0x3E, 0x3E, 0x3E, 
-  0x3E, 0x3E, 0xAD, 0xAE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xB1, 0xB2, 0x64, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x5C, 
-  0xB3, 0xB4, 0xB5, 0x00, 0x00, 0x43, 0xB6, 0xB7, 0xB8, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x47, 0xB9, 0xBA, 0xBB, 
-  0x53, 0x00, 0xBC, 0xBD, 0x57, 0xBE, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0xBF, 0xC0, 0xC1, 0x00, 0x00, 0xC2, 
-  0xC3, 0xC4, 0x35, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x34, 0x9D, 0xC5, 0xC6, 0x00, 0xC7, 0x2C, 0x2D, 0x2E, 
-  0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2E, 0x2F, 0xC8, 0xC9  
+  /*Sprite runs*/
+  0x00, 0x81, 0x01, 0x02, 0x4B, 0x03, 0x81, 0x02, 0x04, 0x00, 0x82, 0x05, 0x03, 0x06, 0x4A, 0x07, 0x81, 0x08, 0x09, 0x00, 
+  0x82, 0x0A, 0x0B, 0x0C, 0x49, 0x07, 0x82, 0x0D, 0x0E, 0x0F, 0x00, 0x82, 0x10, 0x11, 0x02, 0x48, 0x07, 0x82, 0x12, 0x13, 
+  0x14, 0x00, 0x01, 0x82, 0x15, 0x16, 0x17, 0x47, 0x07, 0x82, 0x02, 0x18, 0x10, 0x00, 0x02, 0x82, 0x07, 0x03, 0x19, 0x45, 
+  0x07, 0x82, 0x1A, 0x1B, 0x1C, 0x01, 0x03, 0x81, 0x17, 0x1B, 0x45, 0x07, 0x82, 0x02, 0x1D, 0x10, 0x01, 0x03, 0x82, 0x0F, 
+  0x03, 0x1E, 0x43, 0x07, 0x82, 0x0D, 0x1F, 0x20, 0x02, 0x03, 0x82, 0x10, 0x19, 0x13, 0x42, 0x07, 0x82, 0x21, 0x02, 0x14, 
+  0x03, 0x04, 0x86, 0x0F, 0x04, 0x22, 0x07, 0x0A, 0x1B, 0x23, 0x04, 0x04, 0x86, 0x10, 0x09, 0x08, 0x24, 0x25, 0x01, 0x10, 
+  0x04, 0x05, 0x85, 0x20, 0x26, 0x1B, 0x02, 0x27, 0x10, 0x04, 0x06, 0x83, 0x28, 0x0B, 0x29, 0x0F, 0x05, 0x06, 0x82, 0x10, 
+  0x05, 0x2A, 0x06, 0x00, 0x82, 0x2B, 0x2C, 0x2D, 0x49, 0x2E, 0x82, 0x2F, 0x30, 0x31, 0x00, 0x83, 0x32, 0x33, 0x34, 0x35, 
+  0x47, 0x36, 0x83, 0x37, 0x38, 0x2E, 0x39, 0x00, 0x83, 0x3A, 0x3B, 0x3C, 0x3D, 0x47, 0x3E, 0x83, 0x3F, 0x40, 0x41, 0x42, 
+  0x00, 0x83, 0x43, 0x44, 0x45, 0x46, 0x46, 0x3E, 0x84, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x01, 0x83, 0x4C, 0x4D, 0x4E, 0x4F, 
+  0x45, 0x3E, 0x83, 0x3F, 0x50, 0x51, 0x52, 0x00, 0x01, 0x84, 0x53, 0x54, 0x55, 0x56, 0x47, 0x43, 0x3E, 0x83, 0x3D, 0x57, 
+  0x58, 0x59, 0x01, 0x02, 0x83, 0x4B, 0x5A, 0x5B, 0x5C, 0x43, 0x3E, 0x83, 0x5D, 0x5E, 0x5F, 0x60, 0x01, 0x02, 0x8A, 0x53, 
+  0x61, 0x62, 0x63, 0x64, 0x3E, 0x3E, 0x65, 0x66, 0x67, 0x68, 0x02, 0x03, 0x88, 0x60, 0x69, 0x6A, 0x6B, 0x3E, 0x3D, 0x6C, 
+  0x6D, 0x6E, 0x03, 0x04, 0x87, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x4B, 0x03, 0x04, 0x86, 0x43, 0x39, 0x76, 0x77, 
+  0x78, 0x79, 0x7A, 0x04, 0x05, 0x85, 0x68, 0x7B, 0x7C, 0x7D, 0x7E, 0x43, 0x04, 0x06, 0x83, 0x7F, 0x80, 0x81, 0x82, 0x05, 
+  0x06, 0x83, 0x43, 0x83, 0x84, 0x4B, 0x05, 0x07, 0x82, 0x2A, 0x05, 0x10, 0x05, 0x06, 0x83, 0x0F, 0x29, 0x0B, 0x28, 0x05, 
+  0x05, 0x85, 0x10, 0x27, 0x02, 0x1B, 0x26, 0x20, 0x04, 0x05, 0x86, 0x10, 0x01, 0x25, 0x24, 0x08, 0x09, 0x10, 0x03, 0x05, 
+  0x86, 0x23, 0x1B, 0x0A, 0x0F, 0x22, 0x04, 0x0F, 0x03, 0x04, 0x88, 0x14, 0x02, 0x21, 0x07, 0x07, 0x14, 0x13, 0x19, 0x10, 
+  0x02, 0x03, 0x82, 0x20, 0x1F, 0x0D, 0x43, 0x07, 0x82, 0x1E, 0x03, 0x0F, 0x02, 0x02, 0x83, 0x10, 0x1D, 0x02, 0x06, 0x44, 
+  0x07, 0x81, 0x1B, 0x17, 0x02, 0x02, 0x82, 0x1C, 0x1B, 0x1A, 0x45, 0x07, 0x82, 0x19, 0x03, 0x07, 0x01, 0x01, 0x82, 0x10, 
+  0x18, 0x02, 0x47, 0x07, 0x82, 0x17, 0x16, 0x15, 0x00, 0x01, 0x82, 0x14, 0x13, 0x12, 0x47, 0x07, 0x83, 0x14, 0x02, 0x11, 
+  0x10, 0x00, 0x82, 0x0F, 0x0E, 0x0D, 0x49, 0x07, 0x82, 0x0C, 0x0B, 0x0A, 0x00, 0x82, 0x09, 0x08, 0x11, 0x49, 0x07, 0x82, 
+  0x06, 0x03, 0x05, 0x00, 0x81, 0x04, 0x02, 0x4B, 0x03, 0x81, 0x02, 0x01, 0x06, 0x83, 0x43, 0x85, 0x86, 0x4B, 0x05, 0x06, 
+  0x83, 0x87, 0x88, 0x89, 0x8A, 0x05, 0x05, 0x85, 0x68, 0x8B, 0x8C, 0x8D, 0x8E, 0x4B, 0x04, 0x04, 0x86, 0x4B, 0x54, 0x8F, 
+  0x90, 0x91, 0x92, 0x68, 0x04, 0x04, 0x87, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x43, 0x03, 0x03, 0x88, 0x43, 0x9A, 
+  0x9B, 0x9C, 0x3D, 0x3D, 0x9D, 0x9E, 0x9F, 0x03, 0x03, 0x89, 0xA0, 0xA1, 0xA2, 0x4F, 0x3E, 0x3E, 0xA3, 0xA4, 0xA5, 0x68, 
+  0x02, 0x02, 0x83, 0x43, 0xA6, 0xA7, 0xA8, 0x43, 0x3E, 0x83, 0x77, 0xA9, 0xAA, 0x43, 0x01, 0x02, 0x83, 0xAB, 0xAC, 0x38, 
+  0x47, 0x44, 0x3E, 0x82, 0xAD, 0xAE, 0xAF, 0x01, 0x01, 0x83, 0xB0, 0xB1, 0xB2, 0x64, 0x45, 0x3E, 0x83, 0x5C, 0xB3, 0xB4, 
+  0xB5, 0x00, 0x00, 0x83, 0x43, 0xB6, 0xB7, 0xB8, 0x46, 0x3E, 0x84, 0x47, 0xB9, 0xBA, 0xBB, 0x53, 0x00, 0x83, 0xBC, 0xBD, 
+  0x57, 0xBE, 0x47, 0x3E, 0x82, 0xBF, 0xC0, 0xC1, 0x00, 0x00, 0x83, 0xC2, 0xC3, 0xC4, 0x35, 0x47, 0x36, 0x83, 0x34, 0x9D, 
+  0xC5, 0xC6, 0x00, 0x82, 0xC7, 0x2C, 0x2D, 0x49, 0x2E, 0x82, 0x2F, 0xC8, 0xC9
 };
 
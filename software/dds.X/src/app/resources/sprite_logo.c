@@ -211,472 +211,238 @@ const uint8_t sprite_logo_lut[] = {
 
 const uint8_t sprite_logo[] = {
 
-  8, /*bpp*/
+  0x88, /*bpp: 8BPP, run-length encoded*/
   0x00, 0xA5, /*width*/
   0x00, 0x38, /*height*/
 
-  /*Sprite raw*/
+  /*Row index*/
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x00, 0x0B, 0xA5, 0x00, 0x0E, 0xF3, 
 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x02, 0x03, 0x04, 0x05, 0x06, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x07, 0x07, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x11, 
-  0x12, 0x13, 0x14, 0x15, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x16, 0x17, 0x18, 0x18, 0x19, 0x1A, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1C, 0x1D, 0x1D, 0x1E, 0x1F, 0x07, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0x21, 0x18, 0x18, 0x17, 0x22, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x0E, 0x18, 0x18, 
-  0x24, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x25, 0x18, 0x18, 0x18, 0x1D, 
-  0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x27, 0x18, 0x18, 0x28, 0x29, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x23, 0x0E, 0x18, 0x18, 0x2A, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 
-  0x25, 0x18, 0x18, 0x18, 0x12, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x2D, 0x18, 0x18, 0x2E, 0x2F, 0x1B, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x18, 0x18, 0x32, 0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x34, 0x24, 0x18, 0x18, 0x18, 0x35, 0x36, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x37, 
-  0x18, 0x18, 0x18, 0x38, 0x2C, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3A, 0x18, 0x18, 0x3B, 0x3C, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x3D, 0x2E, 0x18, 0x18, 0x3E, 0x3F, 0x00, 0x07, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0B, 0x1D, 0x2E, 0x18, 0x18, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x18, 0x18, 
-  0x17, 0x43, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x44, 0x45, 0x18, 0x18, 0x46, 
-  0x47, 0x48, 0x49, 0x4A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x4B, 0x17, 0x18, 0x18, 0x4C, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x4D, 0x21, 0x18, 0x18, 0x28, 0x4E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x4F, 0x50, 
-  0x2D, 0x2E, 0x18, 0x18, 0x28, 0x31, 0x51, 0x52, 0x53, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x54, 0x55, 0x18, 0x18, 0x55, 0x56, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x57, 0x18, 0x18, 0x2E, 0x58, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x5A, 0x5B, 0x5C, 0x5D, 0x17, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x28, 0x5E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 
-  0x4C, 0x18, 0x18, 0x18, 0x60, 0x01, 0x00, 0x00, 0x00, 0x08, 0x0B, 0x41, 0x61, 0x18, 0x18, 0x18, 0x62, 0x63, 0x00, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x52, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x65, 0x53, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x26, 0x42, 0x18, 0x18, 0x18, 0x3D, 0x66, 0x66, 0x05, 0x67, 0x44, 0x58, 0x68, 0x0E, 0x18, 0x18, 
-  0x18, 0x68, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0x69, 0x6A, 0x6B, 0x1A, 0x00, 0x01, 0x36, 0x1B, 0x1B, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x6C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x31, 
-  0x6D, 0x58, 0x6E, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0B, 0x36, 0x01, 0x00, 0x01, 0x0B, 0x1B, 0x1B, 0x70, 0x00, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-  0x59, 0x1B, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x36, 0x70, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x07, 0x59, 0x71, 0x02, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x42, 0x18, 0x18, 0x18, 0x55, 0x72, 0x73, 0x0E, 0x52, 0x45, 
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x74, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x35, 0x0E, 0x5D, 0x76, 0x3F, 0x05, 0x77, 0x78, 0x58, 0x56, 0x1A, 0x00, 
-  0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x13, 0x46, 0x2D, 
-  0x78, 0x4C, 0x18, 0x18, 0x2F, 0x71, 0x59, 0x0B, 0x01, 0x00, 0x00, 0x00, 0x01, 0x63, 0x64, 0x77, 0x6E, 0x1A, 0x0B, 0x79, 
-  0x1D, 0x78, 0x78, 0x7A, 0x41, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x7B, 0x5B, 0x78, 0x7C, 0x1A, 0x01, 0x08, 0x07, 0x08, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x01, 0x66, 0x7D, 0x7E, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1B, 0x7F, 0x43, 
-  0x58, 0x38, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x81, 0x18, 0x18, 0x18, 0x18, 
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x4C, 0x7B, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x08, 0x0B, 0x0B, 0x0B, 0x0B, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x4D, 0x82, 0x18, 0x74, 0x83, 0x81, 0x0E, 0x18, 
-  0x18, 0x18, 0x0E, 0x1D, 0x41, 0x00, 0x00, 0x07, 0x0B, 0x0B, 0x0B, 0x08, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 
-  0x00, 0x08, 0x69, 0x41, 0x1B, 0x71, 0x68, 0x18, 0x18, 0x24, 0x84, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x85, 0x0D, 
-  0x18, 0x27, 0x7B, 0x86, 0x4C, 0x18, 0x18, 0x18, 0x17, 0x24, 0x03, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x49, 0x2E, 0x18, 0x42, 0x79, 0x4E, 0x35, 0x35, 0x7D, 0x87, 0x06, 
-  0x34, 0x07, 0x00, 0x01, 0x01, 0x00, 0x34, 0x6D, 0x18, 0x51, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x05, 0x88, 0x45, 0x18, 0x89, 0x8A, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 
-  0x8B, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x2E, 0x18, 0x18, 0x18, 0x55, 0x4B, 0x00, 0x00, 
-  0x01, 0x00, 0x00, 0x34, 0x03, 0x1C, 0x8C, 0x8D, 0x8D, 0x12, 0x4B, 0x8E, 0x00, 0x00, 0x01, 0x01, 0x00, 0x39, 0x8F, 0x18, 
-  0x28, 0x90, 0x45, 0x18, 0x18, 0x18, 0x18, 0x18, 0x17, 0x37, 0x09, 0x00, 0x91, 0x0C, 0x8C, 0x8C, 0x30, 0x01, 0x00, 0x07, 
-  0x84, 0x92, 0x64, 0x93, 0x41, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x63, 0x61, 0x18, 0x18, 0x94, 0x95, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x3C, 0x96, 0x18, 0x2A, 0x3D, 0x55, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x94, 0x1F, 0x01, 0x00, 0x01, 
-  0x00, 0x00, 0x07, 0x34, 0x8E, 0x71, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x98, 0x18, 0x18, 0x0D, 0x82, 0x65, 
-  0x18, 0x18, 0x18, 0x17, 0x2A, 0x6D, 0x80, 0x4F, 0x00, 0x01, 0x00, 0x4D, 0x5D, 0x18, 0x51, 0x54, 0x00, 0x00, 0x07, 0x02, 
-  0x1A, 0x00, 0x00, 0x01, 0x01, 0x00, 0x6F, 0x24, 0x18, 0x18, 0x3B, 0x67, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x07, 0x10, 0x2E, 0x18, 0x18, 0x18, 0x45, 0x55, 0x4C, 0x74, 0x99, 0x38, 0x58, 0x6E, 0x4C, 0x18, 
-  0x18, 0x18, 0x29, 0x01, 0x00, 0x00, 0x0B, 0x92, 0x3D, 0x32, 0x17, 0x17, 0x3B, 0x55, 0x45, 0x52, 0x6D, 0x9A, 0x07, 0x00, 
-  0x00, 0x00, 0x7F, 0x0D, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x52, 0x29, 0x0B, 0x48, 0x96, 0x18, 
-  0x18, 0x11, 0x01, 0x1A, 0x67, 0x3E, 0x90, 0x55, 0x96, 0x42, 0x5B, 0x50, 0x01, 0x00, 0x00, 0x07, 0x7C, 0x18, 0x18, 0x42, 
-  0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x9C, 0x18, 0x18, 0x2E, 0x18, 0x18, 0x18, 0x2E, 0x2E, 0x18, 0x18, 
-  0x2E, 0x9D, 0x75, 0x00, 0x01, 0x63, 0x92, 0x86, 0x9E, 0x9F, 0x99, 0x77, 0xA0, 0x02, 0x01, 0x00, 0x01, 0x00, 0x71, 0x14, 
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3B, 0x7A, 0x0B, 0x00, 0x00, 0x1A, 0x8B, 0x72, 0x35, 
-  0x09, 0x2C, 0x92, 0x60, 0x3E, 0xA1, 0x7B, 0x70, 0x00, 0x00, 0x0B, 0x7C, 0x45, 0x18, 0x2E, 0x57, 0x09, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x0E, 0x18, 0x18, 0x2E, 0x19, 0xA3, 0x85, 0x7B, 0x26, 
-  0x1A, 0x59, 0x26, 0x27, 0x18, 0x18, 0x18, 0xA4, 0x0B, 0x00, 0x0B, 0x53, 0xA5, 0x18, 0x45, 0x6D, 0x22, 0x30, 0xA3, 0x78, 
-  0x55, 0x18, 0xA6, 0x8A, 0x00, 0x00, 0x00, 0xA2, 0x0F, 0x18, 0x18, 0x18, 0x3B, 0xA7, 0x6D, 0x6D, 0xA7, 0x3B, 0x18, 0x18, 
-  0x82, 0x8A, 0xA8, 0x55, 0x18, 0x2E, 0x4E, 0x26, 0x8C, 0x31, 0x18, 0x18, 0x18, 0x18, 0x18, 0x45, 0x9E, 0x5A, 0x00, 0x00, 
-  0x00, 0xA9, 0x18, 0x18, 0x3B, 0x9B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x9C, 0x18, 0x18, 0x18, 0x18, 0x0D, 
-  0x19, 0xAA, 0x5B, 0x24, 0x0E, 0x18, 0x3B, 0xAB, 0x00, 0x84, 0x1D, 0xAC, 0x2E, 0x18, 0x18, 0x18, 0x18, 0x96, 0xAD, 0x41, 
-  0x00, 0x01, 0x00, 0x33, 0x74, 0x18, 0x18, 0x18, 0x18, 0x45, 0x31, 0x0D, 0x0F, 0x18, 0x18, 0x18, 0x18, 0xAC, 0x93, 0x07, 
-  0x00, 0x00, 0x63, 0x5A, 0xAE, 0x00, 0x0A, 0x5B, 0x0E, 0x18, 0x45, 0x82, 0x93, 0x07, 0x00, 0x91, 0x82, 0x18, 0x18, 0x3B, 
-  0x05, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x9C, 0x18, 0x18, 0x45, 
-  0xAF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x58, 0x18, 0x18, 0x18, 0x24, 0x34, 0x00, 0xB0, 0xB1, 0x18, 0x18, 0x3D, 
-  0x41, 0x01, 0x00, 0x01, 0x71, 0xB2, 0x18, 0x65, 0x10, 0x36, 0x00, 0x00, 0xB3, 0x52, 0x18, 0x18, 0x2A, 0x53, 0x02, 0x1B, 
-  0x1B, 0x02, 0x67, 0x27, 0x45, 0x38, 0x20, 0x12, 0x18, 0x18, 0x2E, 0xB4, 0x7D, 0x17, 0x18, 0x18, 0x18, 0x45, 0x45, 0x18, 
-  0x18, 0x2E, 0xA4, 0x1B, 0x00, 0x01, 0xA9, 0x18, 0x18, 0x9C, 0x30, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x9C, 
-  0x18, 0x18, 0x18, 0x82, 0x47, 0x1A, 0x0B, 0x36, 0x71, 0xB5, 0x94, 0x8D, 0x1A, 0x09, 0x35, 0x17, 0x18, 0x18, 0x55, 0x3B, 
-  0x55, 0x2E, 0x18, 0x17, 0x12, 0x1A, 0x00, 0x01, 0x56, 0x52, 0x18, 0x18, 0x18, 0x96, 0x35, 0x03, 0xB6, 0x53, 0x24, 0x28, 
-  0x18, 0x18, 0x18, 0xAA, 0x1B, 0x00, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x71, 0x77, 0x52, 0x18, 0x18, 0x46, 0x93, 0x36, 
-  0x11, 0x55, 0x18, 0x2E, 0x5B, 0x1A, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x85, 0x0D, 0x18, 0x18, 0x45, 0x86, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB7, 0x2E, 0x18, 0x18, 0x99, 0x84, 0x97, 
-  0xB8, 0x28, 0x18, 0x32, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAB, 0x9C, 0x18, 0x3A, 0x5A, 0x00, 0x07, 0xB7, 0x45, 0x18, 
-  0x55, 0x7E, 0x97, 0x00, 0x00, 0x00, 0x00, 0x07, 0x85, 0x57, 0x30, 0x97, 0x8C, 0x18, 0x18, 0x2E, 0x89, 0x31, 0x18, 0x45, 
-  0x46, 0x5C, 0x6E, 0x7D, 0x27, 0x45, 0x18, 0x5D, 0x50, 0x00, 0x00, 0x11, 0x45, 0x18, 0x55, 0x1C, 0x00, 0x00, 0x00, 0x01, 
-  0x70, 0x00, 0x01, 0x9B, 0x9C, 0x18, 0x18, 0x2A, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2B, 0x8A, 0x01, 0xA2, 0x96, 
-  0x18, 0x28, 0xB9, 0x83, 0x92, 0xA3, 0x6D, 0x52, 0x18, 0x4C, 0x7F, 0x00, 0x97, 0xA4, 0x45, 0x18, 0x18, 0x51, 0x7C, 0x1A, 
-  0x00, 0x00, 0x00, 0x66, 0x42, 0x18, 0x18, 0x18, 0xBA, 0x95, 0x00, 0x09, 0x04, 0xBB, 0x49, 0x95, 0x00, 0x00, 0x3F, 0xBB, 
-  0x88, 0x18, 0x18, 0x3A, 0xA4, 0x5D, 0x18, 0x18, 0x8F, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x40, 0x18, 0x18, 0x18, 0x6D, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0F, 
-  0x18, 0x18, 0xAC, 0x7B, 0x26, 0x9D, 0x18, 0x18, 0x90, 0x10, 0x11, 0x11, 0x11, 0x11, 0x4E, 0x8C, 0x0F, 0x18, 0x96, 0x6B, 
-  0x00, 0x97, 0xAA, 0x18, 0x18, 0xAC, 0x66, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x97, 0x71, 0x08, 0x07, 0x35, 0x18, 0x18, 
-  0x18, 0x2E, 0x18, 0x65, 0x78, 0xBC, 0x2C, 0x70, 0x0B, 0x7B, 0x42, 0x18, 0x0E, 0x4B, 0x01, 0x00, 0x3C, 0x3B, 0x18, 0x18, 
-  0x8B, 0x07, 0x00, 0x00, 0x1A, 0x49, 0x50, 0x07, 0x9B, 0x9C, 0x18, 0x18, 0x61, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x36, 0x8C, 0x45, 0x18, 0x13, 0x41, 0x07, 0x01, 0x07, 0x8E, 0x5B, 0x45, 0x18, 0x8D, 0x36, 0x34, 0x9E, 0x18, 
-  0x18, 0x18, 0x57, 0x02, 0x00, 0x00, 0x00, 0x00, 0x09, 0xA7, 0x18, 0x18, 0x18, 0x89, 0x8E, 0x00, 0x8A, 0x9F, 0x2E, 0xAC, 
-  0xB6, 0x00, 0x00, 0x01, 0x0B, 0xB3, 0x2A, 0x2E, 0x18, 0x45, 0x18, 0x18, 0x28, 0x7C, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x94, 0x18, 0x18, 0x18, 0x24, 0x09, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0xBD, 0x3B, 0x18, 0x18, 0x51, 0x1F, 0x66, 0x74, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 
-  0x18, 0x18, 0x18, 0x18, 0xB4, 0x01, 0x34, 0x19, 0x18, 0x18, 0x99, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x18, 0xB9, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8D, 0x18, 0x65, 0x1C, 0x01, 
-  0x00, 0x7B, 0x4C, 0x18, 0x18, 0xAA, 0x0B, 0x00, 0x00, 0x9A, 0x6C, 0x68, 0x6B, 0x30, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x27, 0x18, 0x0F, 0xA0, 0x00, 0x00, 0x01, 0x00, 0x00, 0x66, 0xA5, 0x18, 
-  0xA6, 0xAE, 0x50, 0x6C, 0x18, 0x18, 0x45, 0x49, 0x07, 0x00, 0x00, 0x01, 0x00, 0xAE, 0xA7, 0x18, 0x18, 0x18, 0x62, 0x34, 
-  0x00, 0xBE, 0x5D, 0x18, 0x88, 0x2B, 0x00, 0x00, 0x01, 0x00, 0x70, 0x30, 0x14, 0x18, 0x18, 0x18, 0x18, 0x45, 0x35, 0xAE, 
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x6D, 0x18, 0x18, 0x18, 
-  0x99, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x3A, 0x18, 0x18, 0x52, 0x67, 0x03, 0x32, 0x18, 0x18, 0x31, 0x9F, 
-  0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x9F, 0x7E, 0x01, 0xBE, 0x72, 0x18, 0x18, 0x2D, 0x59, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x52, 0x5E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0xA8, 0x55, 0x17, 0x1C, 0x01, 0x00, 0xB6, 0x0D, 0x18, 0x18, 0x6C, 0xA8, 0x5A, 0x92, 0x5C, 0x45, 0x18, 0xBF, 0x6A, 0x9C, 
-  0x18, 0x18, 0x8B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x4C, 0x18, 0x73, 0x2B, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x0A, 0x82, 0x18, 0x14, 0x34, 0x6B, 0x96, 0x18, 0x18, 0x31, 0x92, 0x00, 0x01, 0x00, 0x00, 0x00, 0xBE, 0x82, 
-  0x18, 0x18, 0x18, 0x7D, 0x0B, 0x00, 0x47, 0x96, 0x18, 0xC0, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xA4, 0x18, 0x18, 
-  0x18, 0x18, 0x18, 0x96, 0x12, 0x26, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x0B, 0x12, 0x18, 0x18, 0x18, 0x0D, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x94, 0x18, 0x18, 0x45, 0x7C, 0x43, 
-  0x65, 0x18, 0x55, 0x16, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x8E, 0x1A, 0x00, 0x8A, 0x73, 0x18, 0x45, 
-  0x1D, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x32, 0x33, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x0E, 0x17, 0x1C, 0x01, 0x00, 0x95, 0x14, 0x18, 0x18, 0x18, 0x0E, 0x6C, 0x31, 0x2E, 
-  0x18, 0x4C, 0xA0, 0xBD, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x18, 
-  0x99, 0x71, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x9F, 0x18, 0x89, 0x41, 0x6E, 0x18, 0x18, 0x18, 0x94, 0x8E, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x03, 0x90, 0x18, 0x18, 0x65, 0xA3, 0x07, 0x01, 0x4B, 0x28, 0x18, 0x13, 0x2C, 0x00, 0x00, 0x00, 0x01, 
-  0x00, 0x26, 0xC0, 0x18, 0x18, 0x14, 0x24, 0x45, 0x18, 0x17, 0xA1, 0x76, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x44, 0x2E, 0x18, 0x18, 0x3B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xB9, 
-  0x18, 0x18, 0x2E, 0x10, 0xAB, 0x3B, 0x18, 0x0E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x6A, 0x0E, 0x18, 0x55, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 
-  0x18, 0x18, 0x0E, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0x28, 0x17, 0x1C, 0x01, 0x00, 0x97, 0xC2, 0x65, 0x18, 
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x4C, 0x22, 0x59, 0x9B, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x15, 0x32, 0x18, 0x99, 0x84, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1F, 0x32, 0x18, 0x14, 0x8A, 0x19, 0x18, 0x18, 
-  0x18, 0x5B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x17, 0x18, 0x18, 0x96, 0x93, 0x01, 0x01, 0x4B, 0x65, 0x18, 0x13, 
-  0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x51, 0x18, 0x45, 0x1C, 0x66, 0xA6, 0x18, 0x18, 0x45, 0x38, 0x5A, 0x00, 0x00, 
-  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x54, 0x55, 0x18, 0x18, 0x55, 0xC3, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0B, 0x77, 0x18, 0x18, 0x18, 0x62, 0x1F, 0xAC, 0x18, 0x0E, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x83, 0x45, 0x18, 0x0F, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x18, 0x5B, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x57, 0x18, 0x17, 0xC3, 0x01, 
-  0x00, 0x00, 0x41, 0x8C, 0x6C, 0x0F, 0x52, 0x96, 0xA5, 0x6D, 0x05, 0x59, 0x00, 0x9B, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x32, 0x18, 0xBA, 0x95, 0x00, 0x00, 0x01, 0x00, 0x0B, 0x6E, 0x45, 0x18, 
-  0x2D, 0x9A, 0xA5, 0x18, 0x18, 0x55, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1D, 0x18, 0x18, 0x18, 0x42, 0x41, 0x00, 
-  0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xC4, 0x45, 0x18, 0x0D, 0x9A, 0x00, 0x6B, 0xB1, 0x18, 
-  0x18, 0x45, 0x3D, 0x91, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x52, 0x18, 0x18, 
-  0x18, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x29, 0x45, 0x18, 0x18, 0x3E, 0x92, 0xAC, 0x18, 0x28, 0xA9, 0x07, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xC2, 0x2E, 0x18, 0xAC, 0x7B, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3B, 0x87, 0x1A, 0x00, 0x00, 0x36, 0xA3, 
-  0x3B, 0x18, 0x90, 0x30, 0x01, 0x00, 0x01, 0x00, 0x4F, 0xB0, 0xA0, 0x67, 0x23, 0x50, 0x02, 0x07, 0x00, 0x01, 0x9B, 0x9C, 
-  0x18, 0x18, 0x8B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0x8F, 0x18, 0x88, 0x03, 0x00, 0x00, 0x00, 
-  0x00, 0x75, 0x9F, 0x18, 0x45, 0x4E, 0x05, 0x0E, 0x18, 0x18, 0x74, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3E, 0x18, 
-  0x18, 0x18, 0x13, 0xAE, 0x00, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x66, 0xB1, 0x18, 0x18, 0x14, 
-  0x71, 0x00, 0x0B, 0x80, 0x2A, 0x18, 0x18, 0x45, 0xB9, 0x5A, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x03, 0x32, 0x18, 0x18, 0x18, 0x1E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x79, 0x5D, 0x9D, 0x6D, 0x6E, 0x85, 
-  0xAC, 0x18, 0x18, 0x25, 0x26, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x4A, 0xBD, 0x76, 0x84, 0x1A, 0xB2, 0x65, 0x65, 0xB1, 
-  0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3B, 
-  0xC5, 0x53, 0x05, 0x7D, 0x74, 0x18, 0x18, 0x24, 0x26, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x00, 0x01, 0x9B, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x1A, 0x3D, 0x18, 
-  0x2E, 0x13, 0x5F, 0x26, 0x26, 0x92, 0x38, 0x45, 0x18, 0x5D, 0x7B, 0x29, 0x45, 0x18, 0x18, 0x25, 0x71, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x39, 0x46, 0x18, 0x18, 0x18, 0xB8, 0x07, 0x00, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x00, 0x00, 0x00, 0x70, 
-  0xA9, 0x28, 0x18, 0x2E, 0x35, 0x70, 0x00, 0x00, 0x08, 0xA0, 0x74, 0x18, 0x18, 0x45, 0xC6, 0x85, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x9F, 0x18, 0x2E, 0x65, 0x81, 0xAE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 
-  0xBC, 0x26, 0x63, 0x59, 0x0A, 0x68, 0x18, 0x18, 0x17, 0xC2, 0x0B, 0x00, 0x01, 0x00, 0x00, 0x9A, 0xBA, 0x3B, 0x8F, 0xBF, 
-  0x8E, 0x30, 0xC3, 0x49, 0xC2, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 
-  0x55, 0x94, 0x0F, 0x18, 0x18, 0x18, 0x52, 0x0E, 0x2E, 0x18, 0x18, 0x51, 0x5E, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x9B, 0x3B, 0x18, 0x45, 0x10, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x70, 0x43, 0x0E, 0x18, 0x45, 0xAC, 0x40, 0x40, 0x74, 0x2E, 0x18, 0x55, 0xA9, 0xAE, 0x58, 0x18, 0x18, 0x18, 
-  0x77, 0x36, 0x00, 0x00, 0x00, 0x01, 0x01, 0x47, 0x0E, 0x18, 0x18, 0x65, 0x16, 0x01, 0x00, 0x01, 0x4B, 0x65, 0x18, 0x13, 
-  0x1A, 0x00, 0x01, 0x00, 0x26, 0x68, 0x18, 0x18, 0x52, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x6E, 0x73, 0x46, 0x61, 0xA9, 
-  0x33, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x77, 0xB4, 0x16, 0xA8, 0x5A, 0x08, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x44, 0x65, 0x18, 0x18, 0x6C, 0x23, 0x97, 0x01, 0x70, 0xBC, 
-  0x3D, 0x18, 0x18, 0x18, 0x25, 0x02, 0x00, 0x00, 0x01, 0x97, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x08, 0x35, 0x18, 0x18, 0x0D, 0x30, 0x8B, 0x0F, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x4C, 0x29, 0x1B, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x1C, 0x7E, 0x49, 0x66, 0x01, 0x01, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x84, 0x57, 0x45, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x45, 0x13, 0x20, 
-  0x0B, 0xA0, 0x81, 0x9F, 0x88, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x08, 0x7C, 0x45, 0x18, 0x18, 0x3B, 0x9B, 0x00, 0x00, 
-  0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x00, 0x00, 0x01, 0xA2, 0x9C, 0x18, 0x18, 0xAC, 0xB0, 0x00, 0x00, 0x00, 0x01, 0x00, 
-  0x1A, 0x4A, 0x39, 0x4F, 0x07, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1B, 0x08, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x7B, 0x46, 0x18, 0x18, 0x18, 
-  0xA5, 0x29, 0x30, 0xC7, 0x40, 0x45, 0x18, 0x18, 0x17, 0xC8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x02, 0x16, 0x9D, 0x4C, 0x4C, 0x4C, 0x3A, 0x57, 
-  0x05, 0x4F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x1D, 0xA5, 0x45, 0x18, 0x18, 
-  0x45, 0x72, 0x1E, 0x76, 0x01, 0x00, 0x01, 0x63, 0xBE, 0x15, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1B, 0x37, 0x18, 0x18, 
-  0x18, 0x8F, 0x76, 0x00, 0x00, 0x01, 0x4B, 0x65, 0x18, 0x38, 0x1A, 0x00, 0x00, 0x0B, 0x8C, 0x2E, 0x18, 0x18, 0x68, 0x0A, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 
-  0x01, 0x97, 0x2C, 0x1B, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x70, 0x05, 0x73, 0x2E, 0x18, 0x18, 0x65, 0x96, 0x55, 0x18, 0x18, 0x18, 0x2E, 0x3E, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x00, 0x08, 0x20, 
-  0x7B, 0x7B, 0x06, 0x8A, 0x63, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 
-  0x36, 0x06, 0x4E, 0x86, 0x1D, 0x7A, 0x7B, 0x36, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x1A, 0x8C, 0x72, 0x0E, 0x45, 0xC0, 0x3F, 0x00, 0x01, 0x01, 0x4B, 0x65, 0x18, 0x3D, 0x2C, 0x00, 0x00, 0x26, 0x24, 
-  0xA5, 0x24, 0x12, 0x6B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x47, 0x6D, 0x32, 0x45, 0x18, 0x18, 0x18, 0x18, 0x2E, 0x51, 0xC6, 0x7F, 0x07, 
-  0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 
-  0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x07, 0x97, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x1A, 0x50, 0x23, 0x7C, 0x83, 0x1B, 0x00, 0x00, 0x08, 0x7A, 0x18, 0x18, 0xAF, 
-  0x70, 0x00, 0x00, 0x2C, 0x03, 0xBC, 0x02, 0x0B, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x02, 0x92, 0x29, 0x1D, 0x24, 0x89, 0x19, 
-  0xB4, 0x47, 0x0A, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
-  0x00, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x07, 0x70, 0x08, 0x01, 0x00, 0x00, 
-  0x70, 0x56, 0x94, 0x40, 0xA0, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x01, 0x70, 0x02, 0x71, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x1B, 0x71, 0x71, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x35, 0x18, 0x18, 
-  0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x08, 0x8C, 0x18, 0x18, 0x0D, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xAF, 0xA5, 0xB1, 0x99, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x5A, 0x5A, 0x8A, 0x36, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-  0xAC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x64, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x20, 0x32, 
-  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x1E, 0x64, 0x00, 0x00, 0x03, 0x18, 0x64, 0x00, 0x00, 0x03, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x62, 0x18, 0xC8, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x18, 0x18, 0x18, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x64, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xC8, 0x00, 0x00, 0x5E, 0x8C, 0xC8, 0x00, 0x00, 0x5E, 0xC8, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-  0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x2C, 0x00, 0x07, 0x62, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x5C, 0x7B, 0x3D, 0x0B, 0x00, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x1E, 
-  0x8C, 0x18, 0x18, 0x64, 0x00, 0x20, 0x32, 0x02, 0x4C, 0x18, 0x55, 0x66, 0x25, 0xA7, 0x55, 0x2C, 0x20, 0x96, 0x18, 0x18, 
-  0x64, 0x00, 0x20, 0x25, 0xA7, 0x55, 0xAA, 0x64, 0x00, 0x20, 0xC6, 0x0B, 0x00, 0x00, 0x20, 0xC6, 0x0B, 0x07, 0x5C, 0x6A, 
-  0xC6, 0x0B, 0x07, 0x5C, 0x66, 0x00, 0x20, 0x96, 0x18, 0x18, 0x64, 0x20, 0xC6, 0x0B, 0x00, 0x07, 0x5C, 0x66, 0x70, 0x4C, 
-  0x18, 0x55, 0x2C, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 0x20, 0x25, 0xA7, 0x55, 0xAE, 0x5C, 
-  0x43, 0x18, 0x18, 0xC8, 0x03, 0x18, 0x18, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x07, 0x62, 0x64, 0x00, 0x00, 0x00, 0x20, 0xC6, 
-  0x0B, 0x00, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 0x20, 0xC6, 0x35, 0x18, 0x18, 0x64, 0x00, 0x00, 0x70, 0x4C, 0x18, 0x55, 
-  0x2C, 0x00, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x20, 0x96, 0x18, 0x18, 0x64, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x70, 0x4C, 0x18, 
-  0x55, 0x2C, 0x00, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC6, 0x0B, 0x1E, 0x64, 0x00, 0x20, 
-  0x96, 0x64, 0x00, 0x00, 0x1E, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x96, 0x64, 0x00, 
-  0x70, 0xAC, 0x66, 0x00, 0x20, 0x32, 0x2C, 0x20, 0x96, 0x64, 0x00, 0x03, 0xC8, 0x00, 0x03, 0xC8, 0x00, 0x00, 0x00, 0x70, 
-  0x2A, 0x2C, 0x70, 0x3D, 0x59, 0xC9, 0x2C, 0x70, 0x2A, 0x2C, 0x70, 0xAC, 0x66, 0x00, 0x20, 0x32, 0xAE, 0x5C, 0x66, 0x00, 
-  0x20, 0xC6, 0x0B, 0x1E, 0xC8, 0x00, 0x5E, 0x2F, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 
-  0x96, 0x64, 0x00, 0x07, 0x62, 0x2F, 0x00, 0x20, 0x96, 0x2F, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xC8, 0x00, 0x5E, 0x2F, 0x00, 0x20, 0x96, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 
-  0x00, 0x1E, 0xC8, 0x00, 0x5E, 0x2F, 0x00, 0x20, 0x96, 0x64, 0x00, 0x70, 0xAC, 0x66, 0x00, 0x20, 0x32, 0x2C, 0x20, 0x32, 
-  0x2C, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 0x96, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0xC8, 
-  0x00, 0x03, 0x2F, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x1E, 0x64, 0x00, 0x00, 0x1E, 0x64, 0x20, 0x32, 0x2C, 0x20, 0x32, 
-  0x2C, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x70, 0x3D, 0x0B, 0x10, 
-  0x66, 0x00, 0x00, 0x00, 0x07, 0x5C, 0x66, 0x20, 0x98, 0x00, 0x1E, 0x64, 0x20, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-  0x2A, 0x2C, 0x5E, 0xC8, 0x00, 0x5E, 0xC8, 0x70, 0xAC, 0x66, 0x00, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 
-  0x00, 0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x70, 0xAC, 0x66, 0x00, 
-  0x00, 0x00, 0x20, 0xC6, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xAC, 0x66, 0x00, 0x70, 0x2A, 0x2C, 0x20, 0x32, 
-  0x2C, 0x00, 0x20, 0x32, 0x2C, 0x70, 0xAC, 0x66, 0x00, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x07, 0x62, 0x18, 0x18, 0x18, 0x55, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x10, 0x66, 0x00, 0x00, 0x1E, 0x64, 
-  0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x1E, 0x18, 0x18, 0x55, 0x2C, 0x20, 0x32, 0x2C, 
-  0x00, 0x07, 0x5C, 0x7B, 0x3D, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x64, 0x5E, 0x64, 0x00, 0x03, 0xC8, 0x5E, 0xC8, 0x00, 
-  0x00, 0x00, 0x1E, 0x18, 0x18, 0x55, 0x2C, 0x20, 0xC6, 0x59, 0x5C, 0x66, 0x70, 0x4C, 0x18, 0x18, 0x18, 0x28, 0x66, 0x20, 
-  0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x07, 0x5C, 0x66, 
-  0x00, 0x70, 0xAC, 0x66, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x96, 0x18, 0x28, 0x66, 0x70, 0x4C, 0x18, 0x18, 
-  0x18, 0x28, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x70, 0x4C, 0x18, 0x18, 0x18, 0x28, 0x66, 0x20, 0x32, 0x2C, 
-  0x00, 0x00, 0x00, 0x1E, 0x18, 0x18, 0x55, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x20, 0x32, 
-  0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xC6, 0x0B, 0x00, 0x00, 0x1E, 0x64, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x1E, 
-  0x64, 0x00, 0x07, 0x62, 0x64, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x70, 0x4C, 0x64, 0x00, 0x20, 
-  0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x5E, 0x8C, 0xC8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2F, 0x10, 0x66, 0x00, 
-  0x20, 0x98, 0x10, 0x66, 0x00, 0x70, 0x4C, 0x64, 0x00, 0x20, 0x32, 0x2C, 0x07, 0x5C, 0x6A, 0xC6, 0x0B, 0x70, 0x2A, 0x2C, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 
-  0x66, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x70, 0xAC, 0x66, 0x00, 0x00, 0x00, 0x07, 0x62, 0x64, 0x00, 0x00, 0x00, 0x70, 0xAC, 
-  0x66, 0x70, 0x2A, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x00, 
-  0x00, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x70, 0x4C, 0x64, 0x00, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 
-  0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x64, 0x00, 0x00, 0x00, 0x03, 0x2F, 0x20, 
-  0x32, 0x2C, 0x00, 0x00, 0x1E, 0x2F, 0x00, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 
-  0x20, 0x32, 0x2C, 0x00, 0x20, 0x3B, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x20, 0x3B, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x70, 0x19, 0xC6, 0x0B, 0x00, 0x07, 0x5C, 0x25, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x3B, 0x66, 0x00, 0x5E, 0x18, 
-  0xC8, 0x00, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 
-  0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x70, 0xAC, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0x28, 
-  0x66, 0x00, 0x00, 0x03, 0x28, 0x66, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x32, 0x2C, 
-  0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x20, 0x3B, 0x66, 0x20, 0x32, 
-  0x2C, 0x00, 0x1E, 0xC8, 0x00, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC9, 0x2C, 0x00, 
-  0x00, 0x00, 0x70, 0xAC, 0x6A, 0x32, 0x2C, 0x00, 0x00, 0x1E, 0x8C, 0x18, 0x28, 0x66, 0x00, 0x20, 0x32, 0x2C, 0x07, 0x62, 
-  0x55, 0x66, 0x32, 0x2C, 0x00, 0x00, 0x5E, 0x18, 0x18, 0x94, 0xA7, 0x64, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x07, 0xC9, 0x2C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x62, 0x2F, 0x00, 0x00, 0x00, 0x1E, 0x2F, 0x00, 0x00, 0x00, 0x5E, 0x18, 0x18, 0x94, 
-  0xA7, 0x64, 0x00, 0x20, 0x3B, 0x66, 0x00, 0x00, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x70, 0x4C, 
-  0x18, 0x55, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x07, 0x5C, 0x66, 0x00, 0x70, 0xAC, 0x66, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x96, 0x18, 0x18, 0x55, 0x2C, 0x00, 0x00, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x20, 0x32, 
-  0x2C, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x5E, 0x18, 0x18, 
-  0x94, 0xA7, 0x64, 0x07, 0x62, 0x55, 0x2C, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 0x20, 0x32, 0x2C, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x20, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x28, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  
+  /*Sprite runs*/
+  0x3F, 0x3F, 0x24, 0x08, 0x80, 0x01, 0x05, 0x86, 0x02, 0x03, 0x04, 0x05, 0x06, 0x01, 0x01, 0x3F, 0x3F, 0x0D, 0x03, 0x84, 
+  0x07, 0x08, 0x09, 0x0A, 0x0B, 0x05, 0x86, 0x07, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x0B, 0x32, 0x80, 0x01, 0x00, 0x43, 0x07, 
+  0x80, 0x01, 0x3F, 0x14, 0x02, 0x86, 0x09, 0x11, 0x12, 0x13, 0x14, 0x15, 0x01, 0x04, 0x86, 0x01, 0x16, 0x17, 0x18, 0x18, 
+  0x19, 0x1A, 0x33, 0x86, 0x1B, 0x1C, 0x1D, 0x1D, 0x1E, 0x1F, 0x07, 0x3F, 0x13, 0x02, 0x86, 0x20, 0x21, 0x18, 0x18, 0x17, 
+  0x22, 0x07, 0x05, 0x85, 0x23, 0x0E, 0x18, 0x18, 0x24, 0x02, 0x33, 0x81, 0x09, 0x25, 0x42, 0x18, 0x81, 0x1D, 0x0B, 0x3F, 
+  0x13, 0x02, 0x86, 0x26, 0x27, 0x18, 0x18, 0x28, 0x29, 0x08, 0x05, 0x85, 0x23, 0x0E, 0x18, 0x18, 0x2A, 0x2B, 0x33, 0x81, 
+  0x09, 0x25, 0x42, 0x18, 0x81, 0x12, 0x0B, 0x3F, 0x13, 0x02, 0x86, 0x2C, 0x2D, 0x18, 0x18, 0x2E, 0x2F, 0x1B, 0x05, 0x85, 
+  0x30, 0x31, 0x18, 0x18, 0x32, 0x33, 0x00, 0x80, 0x01, 0x31, 0x81, 0x34, 0x24, 0x42, 0x18, 0x81, 0x35, 0x36, 0x02, 0x80, 
+  0x01, 0x3F, 0x0F, 0x02, 0x81, 0x36, 0x37, 0x42, 0x18, 0x81, 0x38, 0x2C, 0x00, 0x80, 0x01, 0x03, 0x86, 0x39, 0x3A, 0x18, 
+  0x18, 0x3B, 0x3C, 0x01, 0x32, 0x86, 0x1A, 0x3D, 0x2E, 0x18, 0x18, 0x3E, 0x3F, 0x00, 0x81, 0x07, 0x01, 0x3F, 0x10, 0x02, 
+  0x86, 0x0B, 0x1D, 0x2E, 0x18, 0x18, 0x40, 0x20, 0x05, 0x86, 0x41, 0x42, 0x18, 0x18, 0x17, 0x43, 0x07, 0x2E, 0x80, 0x01, 
+  0x02, 0x8A, 0x08, 0x44, 0x45, 0x18, 0x18, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x01, 0x3F, 0x0F, 0x02, 0x86, 0x07, 0x4B, 0x17, 
+  0x18, 0x18, 0x4C, 0x15, 0x05, 0x86, 0x4D, 0x21, 0x18, 0x18, 0x28, 0x4E, 0x07, 0x2F, 0x8D, 0x01, 0x0B, 0x4F, 0x50, 0x2D, 
+  0x2E, 0x18, 0x18, 0x28, 0x31, 0x51, 0x52, 0x53, 0x01, 0x3F, 0x0F, 0x02, 0x86, 0x01, 0x54, 0x55, 0x18, 0x18, 0x55, 0x56, 
+  0x05, 0x86, 0x1A, 0x57, 0x18, 0x18, 0x2E, 0x58, 0x59, 0x13, 0x80, 0x01, 0x01, 0x80, 0x01, 0x17, 0x84, 0x5A, 0x5B, 0x5C, 
+  0x5D, 0x17, 0x45, 0x18, 0x82, 0x28, 0x5E, 0x01, 0x3F, 0x0F, 0x03, 0x81, 0x5F, 0x4C, 0x42, 0x18, 0x81, 0x60, 0x01, 0x02, 
+  0x83, 0x08, 0x0B, 0x41, 0x61, 0x42, 0x18, 0x81, 0x62, 0x63, 0x00, 0x80, 0x01, 0x15, 0x80, 0x01, 0x15, 0x82, 0x01, 0x64, 
+  0x52, 0x48, 0x18, 0x82, 0x65, 0x53, 0x01, 0x06, 0x80, 0x01, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x12, 0x80, 0x01, 0x02, 
+  0x80, 0x01, 0x0F, 0x80, 0x01, 0x17, 0x03, 0x81, 0x26, 0x42, 0x42, 0x18, 0x88, 0x3D, 0x66, 0x66, 0x05, 0x67, 0x44, 0x58, 
+  0x68, 0x0E, 0x42, 0x18, 0x81, 0x68, 0x0A, 0x12, 0x84, 0x07, 0x69, 0x6A, 0x6B, 0x1A, 0x00, 0x84, 0x01, 0x36, 0x1B, 0x1B, 
+  0x07, 0x11, 0x81, 0x2B, 0x6C, 0x45, 0x18, 0x84, 0x31, 0x6D, 0x58, 0x6E, 0x6F, 0x04, 0x83, 0x01, 0x0B, 0x36, 0x01, 0x00, 
+  0x84, 0x01, 0x0B, 0x1B, 0x1B, 0x70, 0x01, 0x80, 0x01, 0x10, 0x84, 0x07, 0x59, 0x1B, 0x0B, 0x01, 0x05, 0x80, 0x01, 0x03, 
+  0x80, 0x01, 0x00, 0x82, 0x01, 0x36, 0x70, 0x00, 0x80, 0x01, 0x08, 0x80, 0x01, 0x01, 0x84, 0x07, 0x59, 0x71, 0x02, 0x01, 
+  0x05, 0x03, 0x81, 0x26, 0x42, 0x42, 0x18, 0x85, 0x55, 0x72, 0x73, 0x0E, 0x52, 0x45, 0x45, 0x18, 0x81, 0x74, 0x75, 0x05, 
+  0x80, 0x01, 0x04, 0x80, 0x01, 0x05, 0x8B, 0x1B, 0x35, 0x0E, 0x5D, 0x76, 0x3F, 0x05, 0x77, 0x78, 0x58, 0x56, 0x1A, 0x00, 
+  0x81, 0x01, 0x01, 0x04, 0x80, 0x01, 0x07, 0x8C, 0x71, 0x13, 0x46, 0x2D, 0x78, 0x4C, 0x18, 0x18, 0x2F, 0x71, 0x59, 0x0B, 
+  0x01, 0x02, 0x8D, 0x01, 0x63, 0x64, 0x77, 0x6E, 0x1A, 0x0B, 0x79, 0x1D, 0x78, 0x78, 0x7A, 0x41, 0x01, 0x11, 0x89, 0x7B, 
+  0x5B, 0x78, 0x7C, 0x1A, 0x01, 0x08, 0x07, 0x08, 0x01, 0x02, 0x80, 0x01, 0x02, 0x84, 0x01, 0x66, 0x7D, 0x7E, 0x02, 0x00, 
+  0x80, 0x01, 0x06, 0x80, 0x01, 0x00, 0x86, 0x1B, 0x7F, 0x43, 0x58, 0x38, 0x80, 0x07, 0x05, 0x03, 0x81, 0x63, 0x81, 0x4E, 
+  0x18, 0x81, 0x4C, 0x7B, 0x02, 0x80, 0x01, 0x02, 0x80, 0x08, 0x43, 0x0B, 0x80, 0x07, 0x01, 0x80, 0x01, 0x02, 0x86, 0x4D, 
+  0x82, 0x18, 0x74, 0x83, 0x81, 0x0E, 0x42, 0x18, 0x82, 0x0E, 0x1D, 0x41, 0x01, 0x80, 0x07, 0x42, 0x0B, 0x80, 0x08, 0x00, 
+  0x80, 0x01, 0x01, 0x42, 0x01, 0x01, 0x89, 0x08, 0x69, 0x41, 0x1B, 0x71, 0x68, 0x18, 0x18, 0x24, 0x84, 0x01, 0x80, 0x01, 
+  0x02, 0x87, 0x01, 0x85, 0x0D, 0x18, 0x27, 0x7B, 0x86, 0x4C, 0x42, 0x18, 0x83, 0x17, 0x24, 0x03, 0x07, 0x00, 0x80, 0x01, 
+  0x00, 0x80, 0x01, 0x06, 0x80, 0x01, 0x02, 0x8E, 0x01, 0x01, 0x49, 0x2E, 0x18, 0x42, 0x79, 0x4E, 0x35, 0x35, 0x7D, 0x87, 
+  0x06, 0x34, 0x07, 0x00, 0x81, 0x01, 0x01, 0x00, 0x85, 0x34, 0x6D, 0x18, 0x51, 0x05, 0x01, 0x04, 0x80, 0x01, 0x03, 0x87, 
+  0x05, 0x88, 0x45, 0x18, 0x89, 0x8A, 0x01, 0x01, 0x04, 0x03, 0x81, 0x07, 0x8B, 0x4A, 0x18, 0x80, 0x2E, 0x42, 0x18, 0x81, 
+  0x55, 0x4B, 0x01, 0x80, 0x01, 0x01, 0x88, 0x34, 0x03, 0x1C, 0x8C, 0x8D, 0x8D, 0x12, 0x4B, 0x8E, 0x01, 0x81, 0x01, 0x01, 
+  0x00, 0x85, 0x39, 0x8F, 0x18, 0x28, 0x90, 0x45, 0x44, 0x18, 0x82, 0x17, 0x37, 0x09, 0x00, 0x85, 0x91, 0x0C, 0x8C, 0x8C, 
+  0x30, 0x01, 0x00, 0x86, 0x07, 0x84, 0x92, 0x64, 0x93, 0x41, 0x1B, 0x03, 0x85, 0x63, 0x61, 0x18, 0x18, 0x94, 0x95, 0x00, 
+  0x80, 0x01, 0x03, 0x86, 0x01, 0x3C, 0x96, 0x18, 0x2A, 0x3D, 0x55, 0x45, 0x18, 0x82, 0x94, 0x1F, 0x01, 0x00, 0x80, 0x01, 
+  0x01, 0x84, 0x07, 0x34, 0x8E, 0x71, 0x97, 0x05, 0x86, 0x36, 0x98, 0x18, 0x18, 0x0D, 0x82, 0x65, 0x42, 0x18, 0x84, 0x17, 
+  0x2A, 0x6D, 0x80, 0x4F, 0x00, 0x80, 0x01, 0x00, 0x84, 0x4D, 0x5D, 0x18, 0x51, 0x54, 0x01, 0x82, 0x07, 0x02, 0x1A, 0x01, 
+  0x81, 0x01, 0x01, 0x00, 0x86, 0x6F, 0x24, 0x18, 0x18, 0x3B, 0x67, 0x07, 0x06, 0x03, 0x82, 0x07, 0x10, 0x2E, 0x42, 0x18, 
+  0x88, 0x45, 0x55, 0x4C, 0x74, 0x99, 0x38, 0x58, 0x6E, 0x4C, 0x42, 0x18, 0x81, 0x29, 0x01, 0x01, 0x8C, 0x0B, 0x92, 0x3D, 
+  0x32, 0x17, 0x17, 0x3B, 0x55, 0x45, 0x52, 0x6D, 0x9A, 0x07, 0x02, 0x81, 0x7F, 0x0D, 0x49, 0x18, 0x92, 0x52, 0x29, 0x0B, 
+  0x48, 0x96, 0x18, 0x18, 0x11, 0x01, 0x1A, 0x67, 0x3E, 0x90, 0x55, 0x96, 0x42, 0x5B, 0x50, 0x01, 0x01, 0x85, 0x07, 0x7C, 
+  0x18, 0x18, 0x42, 0x39, 0x05, 0x85, 0x01, 0x9B, 0x9C, 0x18, 0x18, 0x2E, 0x42, 0x18, 0x86, 0x2E, 0x2E, 0x18, 0x18, 0x2E, 
+  0x9D, 0x75, 0x00, 0x8A, 0x01, 0x63, 0x92, 0x86, 0x9E, 0x9F, 0x99, 0x77, 0xA0, 0x02, 0x01, 0x00, 0x80, 0x01, 0x00, 0x81, 
+  0x71, 0x14, 0x4A, 0x18, 0x82, 0x3B, 0x7A, 0x0B, 0x01, 0x8B, 0x1A, 0x8B, 0x72, 0x35, 0x09, 0x2C, 0x92, 0x60, 0x3E, 0xA1, 
+  0x7B, 0x70, 0x01, 0x86, 0x0B, 0x7C, 0x45, 0x18, 0x2E, 0x57, 0x09, 0x07, 0x04, 0x8D, 0xA2, 0x0E, 0x18, 0x18, 0x2E, 0x19, 
+  0xA3, 0x85, 0x7B, 0x26, 0x1A, 0x59, 0x26, 0x27, 0x42, 0x18, 0x81, 0xA4, 0x0B, 0x00, 0x8D, 0x0B, 0x53, 0xA5, 0x18, 0x45, 
+  0x6D, 0x22, 0x30, 0xA3, 0x78, 0x55, 0x18, 0xA6, 0x8A, 0x02, 0x81, 0xA2, 0x0F, 0x42, 0x18, 0x91, 0x3B, 0xA7, 0x6D, 0x6D, 
+  0xA7, 0x3B, 0x18, 0x18, 0x82, 0x8A, 0xA8, 0x55, 0x18, 0x2E, 0x4E, 0x26, 0x8C, 0x31, 0x44, 0x18, 0x82, 0x45, 0x9E, 0x5A, 
+  0x02, 0x84, 0xA9, 0x18, 0x18, 0x3B, 0x9B, 0x05, 0x82, 0x01, 0x9B, 0x9C, 0x43, 0x18, 0x88, 0x0D, 0x19, 0xAA, 0x5B, 0x24, 
+  0x0E, 0x18, 0x3B, 0xAB, 0x00, 0x83, 0x84, 0x1D, 0xAC, 0x2E, 0x43, 0x18, 0x82, 0x96, 0xAD, 0x41, 0x00, 0x80, 0x01, 0x00, 
+  0x81, 0x33, 0x74, 0x43, 0x18, 0x83, 0x45, 0x31, 0x0D, 0x0F, 0x43, 0x18, 0x82, 0xAC, 0x93, 0x07, 0x01, 0x82, 0x63, 0x5A, 
+  0xAE, 0x00, 0x87, 0x0A, 0x5B, 0x0E, 0x18, 0x45, 0x82, 0x93, 0x07, 0x00, 0x86, 0x91, 0x82, 0x18, 0x18, 0x3B, 0x05, 0x07, 
+  0x00, 0x80, 0x01, 0x05, 0x04, 0x86, 0x30, 0x9C, 0x18, 0x18, 0x45, 0xAF, 0x70, 0x04, 0x81, 0x36, 0x58, 0x42, 0x18, 0x81, 
+  0x24, 0x34, 0x00, 0x86, 0xB0, 0xB1, 0x18, 0x18, 0x3D, 0x41, 0x01, 0x00, 0x86, 0x01, 0x71, 0xB2, 0x18, 0x65, 0x10, 0x36, 
+  0x01, 0x95, 0xB3, 0x52, 0x18, 0x18, 0x2A, 0x53, 0x02, 0x1B, 0x1B, 0x02, 0x67, 0x27, 0x45, 0x38, 0x20, 0x12, 0x18, 0x18, 
+  0x2E, 0xB4, 0x7D, 0x17, 0x42, 0x18, 0x86, 0x45, 0x45, 0x18, 0x18, 0x2E, 0xA4, 0x1B, 0x00, 0x85, 0x01, 0xA9, 0x18, 0x18, 
+  0x9C, 0x30, 0x01, 0x80, 0x01, 0x02, 0x82, 0x01, 0x9B, 0x9C, 0x42, 0x18, 0x96, 0x82, 0x47, 0x1A, 0x0B, 0x36, 0x71, 0xB5, 
+  0x94, 0x8D, 0x1A, 0x09, 0x35, 0x17, 0x18, 0x18, 0x55, 0x3B, 0x55, 0x2E, 0x18, 0x17, 0x12, 0x1A, 0x00, 0x82, 0x01, 0x56, 
+  0x52, 0x42, 0x18, 0x86, 0x96, 0x35, 0x03, 0xB6, 0x53, 0x24, 0x28, 0x42, 0x18, 0x81, 0xAA, 0x1B, 0x00, 0x94, 0x01, 0x01, 
+  0x07, 0x07, 0x01, 0x01, 0x71, 0x77, 0x52, 0x18, 0x18, 0x46, 0x93, 0x36, 0x11, 0x55, 0x18, 0x2E, 0x5B, 0x1A, 0x01, 0x07, 
+  0x04, 0x86, 0x85, 0x0D, 0x18, 0x18, 0x45, 0x86, 0x97, 0x04, 0x8C, 0x07, 0xB7, 0x2E, 0x18, 0x18, 0x99, 0x84, 0x97, 0xB8, 
+  0x28, 0x18, 0x32, 0x3C, 0x04, 0x84, 0xAB, 0x9C, 0x18, 0x3A, 0x5A, 0x00, 0x86, 0x07, 0xB7, 0x45, 0x18, 0x55, 0x7E, 0x97, 
+  0x03, 0x95, 0x07, 0x85, 0x57, 0x30, 0x97, 0x8C, 0x18, 0x18, 0x2E, 0x89, 0x31, 0x18, 0x45, 0x46, 0x5C, 0x6E, 0x7D, 0x27, 
+  0x45, 0x18, 0x5D, 0x50, 0x01, 0x84, 0x11, 0x45, 0x18, 0x55, 0x1C, 0x02, 0x81, 0x01, 0x70, 0x00, 0x86, 0x01, 0x9B, 0x9C, 
+  0x18, 0x18, 0x2A, 0x30, 0x04, 0x90, 0x01, 0x2B, 0x8A, 0x01, 0xA2, 0x96, 0x18, 0x28, 0xB9, 0x83, 0x92, 0xA3, 0x6D, 0x52, 
+  0x18, 0x4C, 0x7F, 0x00, 0x87, 0x97, 0xA4, 0x45, 0x18, 0x18, 0x51, 0x7C, 0x1A, 0x02, 0x81, 0x66, 0x42, 0x42, 0x18, 0x81, 
+  0xBA, 0x95, 0x00, 0x84, 0x09, 0x04, 0xBB, 0x49, 0x95, 0x01, 0x8B, 0x3F, 0xBB, 0x88, 0x18, 0x18, 0x3A, 0xA4, 0x5D, 0x18, 
+  0x18, 0x8F, 0x06, 0x09, 0x04, 0x81, 0x26, 0x40, 0x42, 0x18, 0x81, 0x6D, 0x1A, 0x05, 0x8B, 0xA0, 0x0F, 0x18, 0x18, 0xAC, 
+  0x7B, 0x26, 0x9D, 0x18, 0x18, 0x90, 0x10, 0x43, 0x11, 0x85, 0x4E, 0x8C, 0x0F, 0x18, 0x96, 0x6B, 0x00, 0x85, 0x97, 0xAA, 
+  0x18, 0x18, 0xAC, 0x66, 0x00, 0x80, 0x01, 0x01, 0x80, 0x01, 0x00, 0x84, 0x97, 0x71, 0x08, 0x07, 0x35, 0x42, 0x18, 0x8D, 
+  0x2E, 0x18, 0x65, 0x78, 0xBC, 0x2C, 0x70, 0x0B, 0x7B, 0x42, 0x18, 0x0E, 0x4B, 0x01, 0x00, 0x85, 0x3C, 0x3B, 0x18, 0x18, 
+  0x8B, 0x07, 0x01, 0x89, 0x1A, 0x49, 0x50, 0x07, 0x9B, 0x9C, 0x18, 0x18, 0x61, 0xAE, 0x05, 0x80, 0x01, 0x00, 0x90, 0x36, 
+  0x8C, 0x45, 0x18, 0x13, 0x41, 0x07, 0x01, 0x07, 0x8E, 0x5B, 0x45, 0x18, 0x8D, 0x36, 0x34, 0x9E, 0x42, 0x18, 0x81, 0x57, 
+  0x02, 0x03, 0x81, 0x09, 0xA7, 0x42, 0x18, 0x81, 0x89, 0x8E, 0x00, 0x84, 0x8A, 0x9F, 0x2E, 0xAC, 0xB6, 0x01, 0x8B, 0x01, 
+  0x0B, 0xB3, 0x2A, 0x2E, 0x18, 0x45, 0x18, 0x18, 0x28, 0x7C, 0x97, 0x09, 0x04, 0x81, 0x71, 0x94, 0x42, 0x18, 0x81, 0x24, 
+  0x09, 0x00, 0x80, 0x01, 0x03, 0x87, 0xBD, 0x3B, 0x18, 0x18, 0x51, 0x1F, 0x66, 0x74, 0x4C, 0x18, 0x87, 0xB4, 0x01, 0x34, 
+  0x19, 0x18, 0x18, 0x99, 0x0A, 0x04, 0x80, 0x01, 0x02, 0x81, 0x08, 0x35, 0x44, 0x18, 0x81, 0xB9, 0x4D, 0x03, 0x85, 0x70, 
+  0x8D, 0x18, 0x65, 0x1C, 0x01, 0x00, 0x85, 0x7B, 0x4C, 0x18, 0x18, 0xAA, 0x0B, 0x01, 0x89, 0x9A, 0x6C, 0x68, 0x6B, 0x30, 
+  0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x07, 0x84, 0x4D, 0x27, 0x18, 0x0F, 0xA0, 0x01, 0x80, 0x01, 0x01, 0x8B, 0x66, 0xA5, 0x18, 
+  0xA6, 0xAE, 0x50, 0x6C, 0x18, 0x18, 0x45, 0x49, 0x07, 0x01, 0x80, 0x01, 0x00, 0x81, 0xAE, 0xA7, 0x42, 0x18, 0x81, 0x62, 
+  0x34, 0x00, 0x84, 0xBE, 0x5D, 0x18, 0x88, 0x2B, 0x01, 0x80, 0x01, 0x00, 0x82, 0x70, 0x30, 0x14, 0x43, 0x18, 0x82, 0x45, 
+  0x35, 0xAE, 0x01, 0x80, 0x01, 0x06, 0x04, 0x81, 0xAE, 0x6D, 0x42, 0x18, 0x81, 0x99, 0x95, 0x05, 0x8A, 0x8A, 0x3A, 0x18, 
+  0x18, 0x52, 0x67, 0x03, 0x32, 0x18, 0x18, 0x31, 0x49, 0x9F, 0x87, 0x7E, 0x01, 0xBE, 0x72, 0x18, 0x18, 0x2D, 0x59, 0x08, 
+  0x81, 0x08, 0x35, 0x43, 0x18, 0x81, 0x52, 0x5E, 0x01, 0x80, 0x01, 0x02, 0x84, 0xA8, 0x55, 0x17, 0x1C, 0x01, 0x00, 0x91, 
+  0xB6, 0x0D, 0x18, 0x18, 0x6C, 0xA8, 0x5A, 0x92, 0x5C, 0x45, 0x18, 0xBF, 0x6A, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x07, 0x84, 
+  0x06, 0x4C, 0x18, 0x73, 0x2B, 0x04, 0x8A, 0x0A, 0x82, 0x18, 0x14, 0x34, 0x6B, 0x96, 0x18, 0x18, 0x31, 0x92, 0x00, 0x80, 
+  0x01, 0x02, 0x81, 0xBE, 0x82, 0x42, 0x18, 0x81, 0x7D, 0x0B, 0x00, 0x84, 0x47, 0x96, 0x18, 0xC0, 0x71, 0x04, 0x81, 0x0B, 
+  0xA4, 0x44, 0x18, 0x82, 0x96, 0x12, 0x26, 0x01, 0x80, 0x01, 0x05, 0x04, 0x81, 0x0B, 0x12, 0x42, 0x18, 0x81, 0x0D, 0x33, 
+  0x05, 0x8A, 0x0A, 0x94, 0x18, 0x18, 0x45, 0x7C, 0x43, 0x65, 0x18, 0x55, 0x16, 0x49, 0x8E, 0x80, 0x1A, 0x00, 0x85, 0x8A, 
+  0x73, 0x18, 0x45, 0x1D, 0x70, 0x08, 0x81, 0x08, 0x35, 0x43, 0x18, 0x81, 0x32, 0x33, 0x05, 0x84, 0x64, 0x0E, 0x17, 0x1C, 
+  0x01, 0x00, 0x81, 0x95, 0x14, 0x42, 0x18, 0x8C, 0x0E, 0x6C, 0x31, 0x2E, 0x18, 0x4C, 0xA0, 0xBD, 0x9C, 0x18, 0x18, 0x8B, 
+  0x0B, 0x07, 0x84, 0x15, 0x32, 0x18, 0x99, 0x71, 0x00, 0x80, 0x01, 0x02, 0x85, 0x26, 0x9F, 0x18, 0x89, 0x41, 0x6E, 0x42, 
+  0x18, 0x81, 0x94, 0x8E, 0x04, 0x8C, 0x03, 0x90, 0x18, 0x18, 0x65, 0xA3, 0x07, 0x01, 0x4B, 0x28, 0x18, 0x13, 0x2C, 0x02, 
+  0x80, 0x01, 0x00, 0x8A, 0x26, 0xC0, 0x18, 0x18, 0x14, 0x24, 0x45, 0x18, 0x17, 0xA1, 0x76, 0x01, 0x80, 0x01, 0x04, 0x04, 
+  0x86, 0x97, 0x44, 0x2E, 0x18, 0x18, 0x3B, 0x03, 0x05, 0x8A, 0x34, 0xB9, 0x18, 0x18, 0x2E, 0x10, 0xAB, 0x3B, 0x18, 0x0E, 
+  0x04, 0x0B, 0x84, 0x6A, 0x0E, 0x18, 0x55, 0xC1, 0x09, 0x81, 0x08, 0x35, 0x43, 0x18, 0x81, 0x0E, 0x23, 0x04, 0x85, 0x07, 
+  0xC2, 0x28, 0x17, 0x1C, 0x01, 0x00, 0x82, 0x97, 0xC2, 0x65, 0x45, 0x18, 0x88, 0x4C, 0x22, 0x59, 0x9B, 0x9C, 0x18, 0x18, 
+  0x8B, 0x0B, 0x07, 0x84, 0x15, 0x32, 0x18, 0x99, 0x84, 0x02, 0x87, 0x01, 0x01, 0x1F, 0x32, 0x18, 0x14, 0x8A, 0x19, 0x42, 
+  0x18, 0x81, 0x5B, 0x0B, 0x04, 0x8C, 0x1C, 0x17, 0x18, 0x18, 0x96, 0x93, 0x01, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x04, 
+  0x8B, 0x05, 0x51, 0x18, 0x45, 0x1C, 0x66, 0xA6, 0x18, 0x18, 0x45, 0x38, 0x5A, 0x01, 0x80, 0x01, 0x03, 0x03, 0x87, 0x01, 
+  0x01, 0x54, 0x55, 0x18, 0x18, 0x55, 0xC3, 0x05, 0x81, 0x0B, 0x77, 0x42, 0x18, 0x85, 0x62, 0x1F, 0xAC, 0x18, 0x0E, 0x6B, 
+  0x05, 0x80, 0x01, 0x02, 0x86, 0x01, 0x01, 0x83, 0x45, 0x18, 0x0F, 0xB3, 0x09, 0x81, 0x08, 0x35, 0x44, 0x18, 0x81, 0x5B, 
+  0x1A, 0x03, 0x85, 0x1A, 0x57, 0x18, 0x17, 0xC3, 0x01, 0x01, 0x89, 0x41, 0x8C, 0x6C, 0x0F, 0x52, 0x96, 0xA5, 0x6D, 0x05, 
+  0x59, 0x00, 0x85, 0x9B, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x07, 0x84, 0x15, 0x32, 0x18, 0xBA, 0x95, 0x01, 0x80, 0x01, 0x00, 
+  0x8A, 0x0B, 0x6E, 0x45, 0x18, 0x2D, 0x9A, 0xA5, 0x18, 0x18, 0x55, 0xA3, 0x04, 0x81, 0x08, 0x1D, 0x42, 0x18, 0x81, 0x42, 
+  0x41, 0x00, 0x85, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x03, 0x85, 0x1B, 0xC4, 0x45, 0x18, 0x0D, 0x9A, 0x00, 0x86, 0x6B, 
+  0xB1, 0x18, 0x18, 0x45, 0x3D, 0x91, 0x01, 0x80, 0x01, 0x02, 0x04, 0x82, 0x01, 0x04, 0x52, 0x42, 0x18, 0x81, 0x6E, 0x01, 
+  0x04, 0x8B, 0x70, 0x29, 0x45, 0x18, 0x18, 0x3E, 0x92, 0xAC, 0x18, 0x28, 0xA9, 0x07, 0x03, 0x80, 0x01, 0x04, 0x85, 0x70, 
+  0xC2, 0x2E, 0x18, 0xAC, 0x7B, 0x09, 0x81, 0x08, 0x35, 0x44, 0x18, 0x82, 0x3B, 0x87, 0x1A, 0x01, 0x86, 0x36, 0xA3, 0x3B, 
+  0x18, 0x90, 0x30, 0x01, 0x00, 0x80, 0x01, 0x00, 0x87, 0x4F, 0xB0, 0xA0, 0x67, 0x23, 0x50, 0x02, 0x07, 0x00, 0x86, 0x01, 
+  0x9B, 0x9C, 0x18, 0x18, 0x8B, 0x0B, 0x07, 0x84, 0x76, 0x8F, 0x18, 0x88, 0x03, 0x03, 0x8A, 0x75, 0x9F, 0x18, 0x45, 0x4E, 
+  0x05, 0x0E, 0x18, 0x18, 0x74, 0x85, 0x04, 0x81, 0x34, 0x3E, 0x42, 0x18, 0x81, 0x13, 0xAE, 0x00, 0x85, 0x01, 0x4B, 0x65, 
+  0x18, 0x13, 0x1A, 0x03, 0x85, 0x66, 0xB1, 0x18, 0x18, 0x14, 0x71, 0x00, 0x88, 0x0B, 0x80, 0x2A, 0x18, 0x18, 0x45, 0xB9, 
+  0x5A, 0x01, 0x00, 0x80, 0x01, 0x01, 0x04, 0x82, 0x01, 0x03, 0x32, 0x42, 0x18, 0x81, 0x1E, 0x08, 0x03, 0x8C, 0x01, 0x01, 
+  0x79, 0x5D, 0x9D, 0x6D, 0x6E, 0x85, 0xAC, 0x18, 0x18, 0x25, 0x26, 0x00, 0x80, 0x01, 0x02, 0x8A, 0x08, 0x4A, 0xBD, 0x76, 
+  0x84, 0x1A, 0xB2, 0x65, 0x65, 0xB1, 0x5A, 0x09, 0x81, 0x08, 0x35, 0x45, 0x18, 0x89, 0x3B, 0xC5, 0x53, 0x05, 0x7D, 0x74, 
+  0x18, 0x18, 0x24, 0x26, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x06, 0x80, 0x01, 0x00, 0x86, 0x01, 0x9B, 0x9C, 0x18, 0x18, 
+  0x8B, 0x0B, 0x05, 0x80, 0x01, 0x00, 0x93, 0x1A, 0x3D, 0x18, 0x2E, 0x13, 0x5F, 0x26, 0x26, 0x92, 0x38, 0x45, 0x18, 0x5D, 
+  0x7B, 0x29, 0x45, 0x18, 0x18, 0x25, 0x71, 0x00, 0x80, 0x01, 0x02, 0x81, 0x39, 0x46, 0x42, 0x18, 0x81, 0xB8, 0x07, 0x00, 
+  0x85, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x02, 0x86, 0x70, 0xA9, 0x28, 0x18, 0x2E, 0x35, 0x70, 0x01, 0x87, 0x08, 0xA0, 
+  0x74, 0x18, 0x18, 0x45, 0xC6, 0x85, 0x03, 0x05, 0x86, 0x8E, 0x9F, 0x18, 0x2E, 0x65, 0x81, 0xAE, 0x05, 0x8B, 0x1A, 0xBC, 
+  0x26, 0x63, 0x59, 0x0A, 0x68, 0x18, 0x18, 0x17, 0xC2, 0x0B, 0x00, 0x80, 0x01, 0x01, 0x8A, 0x9A, 0xBA, 0x3B, 0x8F, 0xBF, 
+  0x8E, 0x30, 0xC3, 0x49, 0xC2, 0x3F, 0x09, 0x86, 0x08, 0x35, 0x18, 0x18, 0x55, 0x94, 0x0F, 0x42, 0x18, 0x87, 0x52, 0x0E, 
+  0x2E, 0x18, 0x18, 0x51, 0x5E, 0x07, 0x08, 0x80, 0x01, 0x02, 0x86, 0x01, 0x9B, 0x3B, 0x18, 0x45, 0x10, 0x97, 0x07, 0x8E, 
+  0x70, 0x43, 0x0E, 0x18, 0x45, 0xAC, 0x40, 0x40, 0x74, 0x2E, 0x18, 0x55, 0xA9, 0xAE, 0x58, 0x42, 0x18, 0x81, 0x77, 0x36, 
+  0x02, 0x88, 0x01, 0x01, 0x47, 0x0E, 0x18, 0x18, 0x65, 0x16, 0x01, 0x00, 0x85, 0x01, 0x4B, 0x65, 0x18, 0x13, 0x1A, 0x00, 
+  0x80, 0x01, 0x00, 0x85, 0x26, 0x68, 0x18, 0x18, 0x52, 0x5E, 0x03, 0x87, 0x1B, 0x6E, 0x73, 0x46, 0x61, 0xA9, 0x33, 0x01, 
+  0x02, 0x05, 0x86, 0x34, 0x77, 0xB4, 0x16, 0xA8, 0x5A, 0x08, 0x04, 0x80, 0x01, 0x04, 0x8B, 0x97, 0x44, 0x65, 0x18, 0x18, 
+  0x6C, 0x23, 0x97, 0x01, 0x70, 0xBC, 0x3D, 0x42, 0x18, 0x81, 0x25, 0x02, 0x01, 0x83, 0x01, 0x97, 0x01, 0x01, 0x08, 0x87, 
+  0x08, 0x35, 0x18, 0x18, 0x0D, 0x30, 0x8B, 0x0F, 0x45, 0x18, 0x82, 0x4C, 0x29, 0x1B, 0x0D, 0x87, 0x01, 0x20, 0x1C, 0x7E, 
+  0x49, 0x66, 0x01, 0x01, 0x05, 0x80, 0x01, 0x00, 0x82, 0x84, 0x57, 0x45, 0x45, 0x18, 0x89, 0x45, 0x13, 0x20, 0x0B, 0xA0, 
+  0x81, 0x9F, 0x88, 0x80, 0x07, 0x03, 0x86, 0x08, 0x7C, 0x45, 0x18, 0x18, 0x3B, 0x9B, 0x01, 0x85, 0x01, 0x4B, 0x65, 0x18, 
+  0x13, 0x1A, 0x01, 0x86, 0x01, 0xA2, 0x9C, 0x18, 0x18, 0xAC, 0xB0, 0x02, 0x80, 0x01, 0x00, 0x84, 0x1A, 0x4A, 0x39, 0x4F, 
+  0x07, 0x01, 0x80, 0x01, 0x01, 0x05, 0x82, 0x01, 0x1B, 0x08, 0x03, 0x80, 0x01, 0x09, 0x82, 0x01, 0x7B, 0x46, 0x42, 0x18, 
+  0x8A, 0xA5, 0x29, 0x30, 0xC7, 0x40, 0x45, 0x18, 0x18, 0x17, 0xC8, 0x07, 0x0E, 0x88, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 
+  0x02, 0x16, 0x9D, 0x42, 0x4C, 0x83, 0x3A, 0x57, 0x05, 0x4F, 0x00, 0x80, 0x01, 0x0E, 0x80, 0x01, 0x00, 0x80, 0x01, 0x0B, 
+  0x8A, 0x5A, 0x1D, 0xA5, 0x45, 0x18, 0x18, 0x45, 0x72, 0x1E, 0x76, 0x01, 0x00, 0x84, 0x01, 0x63, 0xBE, 0x15, 0x09, 0x00, 
+  0x80, 0x01, 0x02, 0x81, 0x1B, 0x37, 0x42, 0x18, 0x81, 0x8F, 0x76, 0x01, 0x85, 0x01, 0x4B, 0x65, 0x18, 0x38, 0x1A, 0x01, 
+  0x86, 0x0B, 0x8C, 0x2E, 0x18, 0x18, 0x68, 0x0A, 0x00, 0x80, 0x01, 0x08, 0x80, 0x01, 0x02, 0x03, 0x85, 0x01, 0x01, 0x97, 
+  0x2C, 0x1B, 0x07, 0x00, 0x80, 0x01, 0x0C, 0x88, 0x70, 0x05, 0x73, 0x2E, 0x18, 0x18, 0x65, 0x96, 0x55, 0x42, 0x18, 0x82, 
+  0x2E, 0x3E, 0x4D, 0x05, 0x80, 0x01, 0x02, 0x80, 0x01, 0x04, 0x85, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x00, 0x87, 0x08, 
+  0x20, 0x7B, 0x7B, 0x06, 0x8A, 0x63, 0x07, 0x00, 0x80, 0x01, 0x1C, 0x81, 0x01, 0x01, 0x00, 0x87, 0x36, 0x06, 0x4E, 0x86, 
+  0x1D, 0x7A, 0x7B, 0x36, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x03, 0x80, 0x01, 0x03, 0x86, 0x1A, 0x8C, 0x72, 0x0E, 0x45, 
+  0xC0, 0x3F, 0x00, 0x86, 0x01, 0x01, 0x4B, 0x65, 0x18, 0x3D, 0x2C, 0x01, 0x86, 0x26, 0x24, 0xA5, 0x24, 0x12, 0x6B, 0x0B, 
+  0x0E, 0x17, 0x80, 0x01, 0x00, 0x84, 0x08, 0x47, 0x6D, 0x32, 0x45, 0x43, 0x18, 0x84, 0x2E, 0x51, 0xC6, 0x7F, 0x07, 0x00, 
+  0x80, 0x01, 0x02, 0x80, 0x01, 0x09, 0x85, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x08, 0x80, 0x01, 0x1F, 0x80, 0x01, 0x01, 
+  0x83, 0x01, 0x07, 0x97, 0x01, 0x01, 0x80, 0x01, 0x0B, 0x86, 0x07, 0x1A, 0x50, 0x23, 0x7C, 0x83, 0x1B, 0x01, 0x85, 0x08, 
+  0x7A, 0x18, 0x18, 0xAF, 0x70, 0x01, 0x84, 0x2C, 0x03, 0xBC, 0x02, 0x0B, 0x01, 0x80, 0x01, 0x0D, 0x10, 0x80, 0x01, 0x08, 
+  0x8B, 0x07, 0x02, 0x92, 0x29, 0x1D, 0x24, 0x89, 0x19, 0xB4, 0x47, 0x0A, 0x07, 0x00, 0x80, 0x01, 0x09, 0x80, 0x01, 0x03, 
+  0x85, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x06, 0x80, 0x01, 0x22, 0x80, 0x01, 0x05, 0x80, 0x01, 0x0B, 0x80, 0x01, 0x01, 
+  0x84, 0x01, 0x07, 0x70, 0x08, 0x01, 0x01, 0x86, 0x70, 0x56, 0x94, 0x40, 0xA0, 0x01, 0x01, 0x00, 0x42, 0x01, 0x12, 0x13, 
+  0x80, 0x01, 0x08, 0x85, 0x01, 0x70, 0x02, 0x71, 0x09, 0x07, 0x13, 0x85, 0x08, 0x35, 0x18, 0x18, 0x74, 0x66, 0x3F, 0x01, 
+  0x80, 0x01, 0x04, 0x85, 0x01, 0x01, 0x1B, 0x71, 0x71, 0x1B, 0x18, 0x15, 0x80, 0x01, 0x04, 0x80, 0x01, 0x1A, 0x85, 0x08, 
+  0x35, 0x18, 0x18, 0x74, 0x66, 0x3F, 0x26, 0x19, 0x80, 0x01, 0x17, 0x80, 0x01, 0x03, 0x85, 0x08, 0x35, 0x18, 0x18, 0x74, 
+  0x66, 0x3F, 0x26, 0x37, 0x85, 0x08, 0x8C, 0x18, 0x18, 0x0D, 0x66, 0x3F, 0x26, 0x37, 0x85, 0x07, 0xAF, 0xA5, 0xB1, 0x99, 
+  0x5A, 0x3F, 0x26, 0x38, 0x84, 0x95, 0x5A, 0x5A, 0x8A, 0x36, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 
+  0x24, 0x03, 0x82, 0x70, 0xAC, 0x66, 0x06, 0x81, 0x1E, 0x64, 0x03, 0x85, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x16, 0x81, 
+  0x1E, 0x64, 0x01, 0x82, 0x03, 0x18, 0x64, 0x01, 0x81, 0x03, 0x2F, 0x12, 0x83, 0x07, 0x62, 0x18, 0xC8, 0x19, 0x80, 0x03, 
+  0x42, 0x18, 0x80, 0x2F, 0x21, 0x82, 0x20, 0x32, 0x2C, 0x0D, 0x03, 0x82, 0x03, 0x8C, 0xC8, 0x06, 0x81, 0x1E, 0x64, 0x06, 
+  0x82, 0x20, 0x32, 0x2C, 0x16, 0x81, 0x5E, 0xC8, 0x01, 0x82, 0x5E, 0x8C, 0xC8, 0x01, 0x81, 0x5E, 0xC8, 0x12, 0x82, 0x20, 
+  0x32, 0x2C, 0x19, 0x82, 0x03, 0x55, 0x2C, 0x00, 0x82, 0x07, 0x62, 0xC8, 0x20, 0x82, 0x20, 0x32, 0x2C, 0x0D, 0x02, 0x84, 
+  0x07, 0x5C, 0x7B, 0x3D, 0x0B, 0x00, 0x89, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x1E, 0x8C, 0x18, 0x18, 0x64, 0x00, 0x8F, 0x20, 
+  0x32, 0x02, 0x4C, 0x18, 0x55, 0x66, 0x25, 0xA7, 0x55, 0x2C, 0x20, 0x96, 0x18, 0x18, 0x64, 0x00, 0x85, 0x20, 0x25, 0xA7, 
+  0x55, 0xAA, 0x64, 0x00, 0x82, 0x20, 0xC6, 0x0B, 0x01, 0x8A, 0x20, 0xC6, 0x0B, 0x07, 0x5C, 0x6A, 0xC6, 0x0B, 0x07, 0x5C, 
+  0x66, 0x00, 0x87, 0x20, 0x96, 0x18, 0x18, 0x64, 0x20, 0xC6, 0x0B, 0x00, 0x91, 0x07, 0x5C, 0x66, 0x70, 0x4C, 0x18, 0x55, 
+  0x2C, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 0x8D, 0x20, 0x25, 0xA7, 0x55, 0xAE, 0x5C, 0x43, 
+  0x18, 0x18, 0xC8, 0x03, 0x18, 0x18, 0xC8, 0x03, 0x82, 0x07, 0x62, 0x64, 0x02, 0x82, 0x20, 0xC6, 0x0B, 0x00, 0x84, 0x70, 
+  0x4C, 0x18, 0x55, 0x2C, 0x00, 0x85, 0x20, 0xC6, 0x35, 0x18, 0x18, 0x64, 0x01, 0x84, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 
+  0x93, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x20, 0x96, 0x18, 0x18, 0x64, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x70, 0x4C, 0x18, 0x55, 
+  0x2C, 0x00, 0x84, 0x20, 0x25, 0xA7, 0x55, 0x2C, 0x01, 0x02, 0x84, 0x20, 0xC6, 0x0B, 0x1E, 0x64, 0x00, 0x82, 0x20, 0x96, 
+  0x64, 0x01, 0x8E, 0x1E, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x96, 0x64, 0x00, 0x82, 
+  0x70, 0xAC, 0x66, 0x00, 0x85, 0x20, 0x32, 0x2C, 0x20, 0x96, 0x64, 0x00, 0x81, 0x03, 0xC8, 0x00, 0x81, 0x03, 0xC8, 0x02, 
+  0x8D, 0x70, 0x2A, 0x2C, 0x70, 0x3D, 0x59, 0xC9, 0x2C, 0x70, 0x2A, 0x2C, 0x70, 0xAC, 0x66, 0x00, 0x84, 0x20, 0x32, 0xAE, 
+  0x5C, 0x66, 0x00, 0x84, 0x20, 0xC6, 0x0B, 0x1E, 0xC8, 0x00, 0x81, 0x5E, 0x2F, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x81, 
+  0x1E, 0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 0x20, 0x96, 0x64, 0x00, 0x82, 0x07, 0x62, 0x2F, 0x00, 0x82, 0x20, 0x96, 0x2F, 
+  0x00, 0x82, 0x20, 0x32, 0x2C, 0x02, 0x82, 0x20, 0x32, 0x2C, 0x06, 0x81, 0x1E, 0xC8, 0x00, 0x81, 0x5E, 0x2F, 0x00, 0x82, 
+  0x20, 0x96, 0xC8, 0x00, 0x82, 0x03, 0x9D, 0x0B, 0x00, 0x81, 0x1E, 0xC8, 0x00, 0x81, 0x5E, 0x2F, 0x00, 0x82, 0x20, 0x96, 
+  0x64, 0x00, 0x82, 0x70, 0xAC, 0x66, 0x00, 0x85, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x81, 0x1E, 0xC8, 0x00, 0x85, 
+  0x03, 0x9D, 0x0B, 0x20, 0x96, 0x64, 0x03, 0x02, 0x81, 0x5E, 0xC8, 0x00, 0x81, 0x03, 0x2F, 0x00, 0x82, 0x20, 0x32, 0x2C, 
+  0x01, 0x81, 0x1E, 0x64, 0x01, 0x8A, 0x1E, 0x64, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x04, 0x85, 0x70, 
+  0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x84, 0x70, 0x3D, 0x0B, 0x10, 0x66, 0x02, 0x84, 0x07, 0x5C, 0x66, 0x20, 0x98, 0x00, 
+  0x83, 0x1E, 0x64, 0x20, 0x98, 0x04, 0x84, 0x70, 0x2A, 0x2C, 0x5E, 0xC8, 0x00, 0x84, 0x5E, 0xC8, 0x70, 0xAC, 0x66, 0x00, 
+  0x88, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x85, 0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x82, 
+  0x07, 0x5C, 0x66, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x70, 0xAC, 0x66, 0x02, 0x82, 0x20, 0xC6, 0x0B, 0x05, 0x82, 
+  0x70, 0xAC, 0x66, 0x00, 0x85, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x85, 0x20, 0x32, 0x2C, 0x70, 0xAC, 0x66, 0x00, 
+  0x85, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x04, 0x88, 0x70, 0x2A, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x85, 
+  0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x03, 0x01, 0x81, 0x07, 0x62, 0x42, 0x18, 0x84, 0x55, 0x2C, 0x20, 0x32, 0x2C, 0x01, 
+  0x81, 0x10, 0x66, 0x01, 0x8A, 0x1E, 0x64, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x02, 0x87, 0x1E, 0x18, 
+  0x18, 0x55, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x84, 0x07, 0x5C, 0x7B, 0x3D, 0x0B, 0x03, 0x83, 0x5E, 0x64, 0x5E, 0x64, 0x00, 
+  0x83, 0x03, 0xC8, 0x5E, 0xC8, 0x02, 0x8B, 0x1E, 0x18, 0x18, 0x55, 0x2C, 0x20, 0xC6, 0x59, 0x5C, 0x66, 0x70, 0x4C, 0x42, 
+  0x18, 0x87, 0x28, 0x66, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x85, 0x07, 0x5C, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x82, 
+  0x07, 0x5C, 0x66, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x70, 0xAC, 0x66, 0x02, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x86, 
+  0x20, 0x96, 0x18, 0x28, 0x66, 0x70, 0x4C, 0x42, 0x18, 0x84, 0x28, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x84, 0x20, 0x32, 0x2C, 
+  0x70, 0x4C, 0x42, 0x18, 0x84, 0x28, 0x66, 0x20, 0x32, 0x2C, 0x02, 0x8A, 0x1E, 0x18, 0x18, 0x55, 0x2C, 0x20, 0x32, 0x2C, 
+  0x20, 0x32, 0x2C, 0x00, 0x85, 0x07, 0x5C, 0x66, 0x20, 0x32, 0x2C, 0x03, 0x01, 0x82, 0x20, 0xC6, 0x0B, 0x01, 0x84, 0x1E, 
+  0x64, 0x20, 0x32, 0x2C, 0x01, 0x81, 0x1E, 0x64, 0x00, 0x8B, 0x07, 0x62, 0x64, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x20, 
+  0x32, 0x2C, 0x00, 0x82, 0x70, 0x4C, 0x64, 0x00, 0x85, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x01, 0x82, 0x5E, 0x8C, 0xC8, 
+  0x04, 0x83, 0x03, 0x2F, 0x10, 0x66, 0x00, 0x83, 0x20, 0x98, 0x10, 0x66, 0x00, 0x82, 0x70, 0x4C, 0x64, 0x00, 0x8A, 0x20, 
+  0x32, 0x2C, 0x07, 0x5C, 0x6A, 0xC6, 0x0B, 0x70, 0x2A, 0x2C, 0x03, 0x85, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x85, 
+  0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x70, 0xAC, 
+  0x66, 0x02, 0x82, 0x07, 0x62, 0x64, 0x02, 0x85, 0x70, 0xAC, 0x66, 0x70, 0x2A, 0x2C, 0x03, 0x82, 0x20, 0x32, 0x2C, 0x00, 
+  0x85, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x03, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x70, 0x4C, 0x64, 0x00, 0x88, 0x20, 
+  0x32, 0x2C, 0x20, 0x32, 0x2C, 0x70, 0x2A, 0x2C, 0x00, 0x85, 0x70, 0xAC, 0x66, 0x20, 0x32, 0x2C, 0x03, 0x01, 0x81, 0x5E, 
+  0x64, 0x02, 0x84, 0x03, 0x2F, 0x20, 0x32, 0x2C, 0x01, 0x81, 0x1E, 0x2F, 0x00, 0x8B, 0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 
+  0x20, 0x32, 0x2C, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x85, 0x20, 0x3B, 0x66, 0x20, 0x32, 0x2C, 0x01, 
+  0x82, 0x20, 0x3B, 0x66, 0x04, 0x83, 0x70, 0x19, 0xC6, 0x0B, 0x00, 0x83, 0x07, 0x5C, 0x25, 0x2C, 0x00, 0x82, 0x20, 0x32, 
+  0x2C, 0x00, 0x82, 0x20, 0x3B, 0x66, 0x00, 0x82, 0x5E, 0x18, 0xC8, 0x01, 0x81, 0x1E, 0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 
+  0x20, 0x32, 0x2C, 0x00, 0x81, 0x1E, 0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x07, 0x5C, 0x66, 
+  0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x70, 0xAC, 0x66, 0x03, 0x82, 0x03, 0x28, 0x66, 0x01, 0x82, 0x03, 0x28, 0x66, 
+  0x00, 0x81, 0x1E, 0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x81, 0x1E, 
+  0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x85, 0x20, 0x3B, 0x66, 0x20, 
+  0x32, 0x2C, 0x00, 0x81, 0x1E, 0xC8, 0x00, 0x85, 0x03, 0x9D, 0x0B, 0x20, 0x32, 0x2C, 0x03, 0x01, 0x81, 0xC9, 0x2C, 0x02, 
+  0x84, 0x70, 0xAC, 0x6A, 0x32, 0x2C, 0x01, 0x84, 0x1E, 0x8C, 0x18, 0x28, 0x66, 0x00, 0x88, 0x20, 0x32, 0x2C, 0x07, 0x62, 
+  0x55, 0x66, 0x32, 0x2C, 0x01, 0x88, 0x5E, 0x18, 0x18, 0x94, 0xA7, 0x64, 0x20, 0x32, 0x2C, 0x01, 0x82, 0x07, 0xC9, 0x2C, 
+  0x04, 0x82, 0x07, 0x62, 0x2F, 0x02, 0x81, 0x1E, 0x2F, 0x02, 0x85, 0x5E, 0x18, 0x18, 0x94, 0xA7, 0x64, 0x00, 0x82, 0x20, 
+  0x3B, 0x66, 0x01, 0x84, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x84, 0x70, 0x4C, 0x18, 0x55, 
+  0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x07, 0x5C, 0x66, 0x00, 0x82, 0x70, 0xAC, 
+  0x66, 0x04, 0x85, 0x20, 0x96, 0x18, 0x18, 0x55, 0x2C, 0x01, 0x84, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x82, 0x20, 0x32, 
+  0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x00, 0x84, 0x70, 0x4C, 0x18, 0x28, 0x66, 0x00, 0x82, 0x20, 0x32, 0x2C, 0x01, 0x8E, 
+  0x5E, 0x18, 0x18, 0x94, 0xA7, 0x64, 0x07, 0x62, 0x55, 0x2C, 0x70, 0x4C, 0x18, 0x55, 0x2C, 0x00, 0x82, 0x20, 0x32, 0x2C, 
+  0x03, 0x29, 0x81, 0x20, 0x98, 0x3F, 0x38, 0x28, 0x82, 0x5E, 0x28, 0x66, 0x3F, 0x38, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x24
 };
@@ -241,327 +241,177 @@ const uint8_t sprite_rvalue_lut[] = {
 
 const uint8_t sprite_rvalue[] = {
 
-  8, /*bpp*/
+  0x88, /*bpp: 8BPP, run-length encoded*/
   0x00, 0x18, /*width*/
   0x01, 0x08, /*height*/
 
-  /*Sprite raw*/
+  /*Row index*/
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xED, 0x00, 0x01, 0x87, 0x00, 0x02, 0x6E, 0x00, 0x03, 0x48, 0x00, 0x04, 0x1C, 0x00, 0x05, 
+  0x10, 0x00, 0x06, 0x36, 0x00, 0x07, 0x00, 0x00, 0x07, 0xBC, 0x00, 0x08, 0x72, 0x00, 0x08, 0xFC, 0x00, 0x09, 0xCA, 0x00, 
+  0x0A, 0x78, 0x00, 0x0B, 0x28, 0x00, 0x0B, 0xD8, 0x00, 0x0C, 0x64, 
 
-  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x07, 0x02, 0x08, 0x00, 0x09, 0x02, 0x0A, 0x00, 0x0B, 0x0C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x13, 0x0E, 0x14, 0x00, 0x15, 0x16, 
-  0x17, 0x00, 0x18, 0x19, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x1B, 0x1C, 0x10, 0x1D, 0x11, 0x1E, 0x1F, 0x20, 
-  0x21, 0x00, 0x0C, 0x20, 0x22, 0x00, 0x23, 0x15, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25, 0x10, 0x26, 
-  0x27, 0x1D, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x29, 0x10, 0x2A, 0x00, 0x25, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2B, 0x2C, 0x25, 0x2D, 0x00, 0x2E, 0x10, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x1D, 0x30, 0x31, 0x00, 0x32, 0x10, 0x30, 0x33, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x11, 0x1E, 0x00, 0x00, 0x34, 0x35, 0x11, 0x36, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x10, 0x38, 0x00, 0x00, 
-  0x00, 0x38, 0x39, 0x3A, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 
-  0x11, 0x3C, 0x00, 0x00, 0x00, 0x2F, 0x30, 0x11, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3E, 0x30, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x11, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-  0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x44, 0x45, 0x34, 0x00, 0x00, 0x00, 0x00, 0x46, 0x10, 0x3F, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x47, 0x30, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x27, 
-  0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x34, 0x30, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x32, 0x25, 0x25, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x11, 0x29, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x11, 0x30, 0x3B, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x1D, 0x25, 0x12, 0x00, 0x00, 0x00, 0x44, 0x10, 
-  0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x2C, 0x39, 0x46, 0x00, 
-  0x00, 0x00, 0x37, 0x11, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x48, 0x10, 0x4E, 0x31, 0x00, 0x4F, 0x30, 0x10, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x4F, 0x30, 0x10, 0x4F, 0x00, 0x48, 0x11, 0x3A, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x10, 0x48, 0x3B, 0x35, 0x39, 0x51, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x10, 0x11, 0x1E, 0x10, 0x30, 0x49, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x2C, 0x11, 
-  0x10, 0x39, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3B, 0x2A, 0x10, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x43, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x10, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3F, 0x10, 0x10, 0x11, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x11, 0x1D, 0x56, 0x11, 0x36, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x37, 0x39, 0x44, 0x41, 
-  0x1D, 0x27, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 
-  0x10, 0x30, 0x43, 0x12, 0x58, 0x10, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x2D, 0x11, 0x3A, 0x00, 0x00, 0x5A, 0x10, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x10, 0x38, 0x00, 0x00, 0x4A, 0x10, 0x30, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x11, 0x52, 0x00, 0x00, 0x3D, 0x35, 0x25, 0x5C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5D, 0x25, 0x25, 0x5E, 0x00, 0x00, 
-  0x00, 0x2A, 0x10, 0x5F, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x10, 
-  0x58, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x25, 0x45, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x60, 0x37, 0x61, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x39, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x62, 
-  0x63, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x11, 0x53, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x65, 0x10, 0x62, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0x10, 
-  0x30, 0x49, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x04, 0x3F, 0x27, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x11, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x51, 0x00, 0x00, 0x00, 0x3B, 0x30, 0x11, 0x43, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x11, 0x66, 0x00, 0x00, 0x00, 0x65, 0x25, 0x2C, 
-  0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x25, 0x04, 0x00, 
-  0x00, 0x2C, 0x10, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x3A, 0x11, 0x29, 0x00, 0x3D, 0x35, 0x25, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x67, 0x27, 0x35, 0x50, 0x3C, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x30, 0x10, 0x38, 0x10, 0x10, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x69, 0x6A, 0x01, 0x00, 0x6B, 0x6C, 0x00, 0x00, 0x6A, 0x6D, 0x00, 0x6E, 0x10, 0x39, 0x10, 0x6F, 0x70, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x71, 0x72, 0x00, 0x73, 0x16, 0x00, 0x00, 0x74, 0x75, 0x00, 0x76, 0x77, 0x10, 
-  0x10, 0x78, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x79, 0x7A, 0x00, 0x08, 0x0B, 0x00, 0x00, 0x79, 0x01, 
-  0x00, 0x7B, 0x7C, 0x3E, 0x57, 0x08, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x7D, 0x4D, 
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x46, 0x10, 0x10, 0x5F, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0x58, 0x10, 0x11, 0x3F, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x10, 0x7E, 0x5F, 0x10, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x37, 0x27, 0x7F, 0x4B, 0x25, 0x11, 0x04, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x11, 0x30, 0x54, 0x00, 
-  0x10, 0x10, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 
-  0x11, 0x1E, 0x00, 0x00, 0x05, 0x10, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7E, 0x10, 0x80, 0x00, 0x00, 0x32, 0x10, 0x30, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x30, 0x39, 0x81, 0x00, 0x00, 0x31, 0x7E, 0x11, 0x53, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x27, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x53, 0x39, 0x3A, 
-  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x3F, 0x83, 0x00, 0x84, 
-  0x1B, 0x85, 0x30, 0x10, 0x86, 0x00, 0x00, 0x87, 0x69, 0x00, 0x88, 0x89, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x3A, 
-  0x8B, 0x8C, 0x00, 0x8D, 0x16, 0x1F, 0x4E, 0x10, 0x8E, 0x00, 0x7A, 0x0E, 0x8F, 0x00, 0x90, 0x6F, 0x30, 0x52, 0x00, 0x00, 
-  0x00, 0x00, 0x91, 0x92, 0x93, 0x08, 0x00, 0x0B, 0x02, 0x91, 0x44, 0x10, 0x94, 0x91, 0x00, 0x02, 0x22, 0x00, 0x95, 0x27, 
-  0x25, 0x33, 0x7A, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x39, 0x30, 0x42, 0x00, 0x00, 
-  0x00, 0x00, 0x96, 0x11, 0x58, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x30, 
-  0x11, 0x65, 0x00, 0x00, 0x00, 0x00, 0x44, 0x10, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x11, 0x5A, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x11, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x11, 0x30, 0x2B, 0x00, 0x00, 0x12, 0x30, 0x11, 0x57, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x2C, 0x27, 0x2E, 0x00, 0x00, 0x60, 0x27, 0x37, 
-  0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x10, 0x56, 0x49, 
-  0x49, 0x4E, 0x11, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x97, 0x30, 0x10, 0x04, 0x5E, 0x10, 0x30, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x10, 0x61, 0x5A, 0x10, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x39, 0x11, 0x11, 0x39, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5A, 0x11, 0x10, 0x36, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x04, 
-  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x1A, 0x00, 0x00, 0x99, 0x81, 0x3C, 0x9A, 0x1A, 0x09, 0x00, 
-  0x0C, 0x1A, 0x00, 0x00, 0x1A, 0x1A, 0x00, 0x07, 0x1A, 0x7A, 0x00, 0x00, 0x00, 0x73, 0x16, 0x00, 0x00, 0x9B, 0x10, 0x10, 
-  0x9C, 0x74, 0x9D, 0x00, 0x9E, 0x16, 0x00, 0x00, 0x9F, 0x0E, 0x00, 0x01, 0x16, 0x0A, 0x00, 0x00, 0x00, 0x23, 0x9D, 0x00, 
-  0x4F, 0x30, 0x10, 0x11, 0x39, 0xA0, 0x0B, 0x00, 0x69, 0x9D, 0x00, 0x00, 0xA1, 0x9D, 0x00, 0x07, 0x9D, 0x07, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x29, 0x10, 0x56, 0x3A, 0x10, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x45, 0x25, 0x2D, 0x52, 0x25, 0x39, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x1D, 0x30, 0x3B, 0x49, 0x30, 0x10, 0x96, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x11, 0x29, 0x00, 0x00, 
-  0xA2, 0x10, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-  0x10, 0x60, 0x00, 0x00, 0xA3, 0x10, 0x30, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3D, 0x30, 0x39, 0x24, 0x00, 0x00, 0x12, 0x35, 0x27, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4A, 0x27, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x3A, 0x10, 0x1E, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0x30, 0x00, 0x00, 0x00, 0x00, 0x52, 0x25, 0x4E, 
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x3A, 0x5B, 0x00, 0x00, 0x00, 
-  0x00, 0x49, 0x3F, 0x39, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x62, 0x3F, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x10, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x58, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x10, 0x58, 0x31, 0x00, 0x00, 0x00, 0x00, 0x26, 0x10, 
-  0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x3F, 0x27, 0x4A, 0x00, 0x00, 
-  0x00, 0x00, 0x37, 0x11, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 
-  0x10, 0x38, 0x00, 0x00, 0x00, 0x50, 0x30, 0x10, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4D, 0x11, 0x2C, 0x00, 0x00, 0x00, 0x2D, 0x25, 0x37, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x25, 0x97, 0x00, 0x00, 0x45, 0x10, 0x1E, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x3A, 0x10, 0x1E, 0x00, 0x3D, 0x35, 0x3F, 0x3C, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x27, 0x35, 0x50, 
-  0x4D, 0x10, 0x30, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x25, 0x10, 0x44, 0x10, 0x10, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA4, 0x07, 0xA5, 0x6A, 0x15, 
-  0x00, 0x1A, 0x6C, 0xA6, 0x00, 0xA7, 0x10, 0x39, 0x10, 0x6F, 0xA8, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xA9, 
-  0x03, 0x08, 0x71, 0x6C, 0x00, 0x23, 0x16, 0x9D, 0x00, 0xAA, 0x56, 0x10, 0x10, 0x78, 0xAB, 0x00, 0x23, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xAC, 0x08, 0x00, 0x7A, 0x79, 0xA5, 0x00, 0x03, 0x0B, 0x03, 0x00, 0xA5, 0x7C, 0x3E, 0xAD, 0x79, 0xAC, 0x00, 
-  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x38, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x38, 0xAE, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x10, 0x1D, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x1E, 0x10, 0x56, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x1D, 0x10, 0x35, 0x2B, 
-  0x00, 0x00, 0x00, 0x3B, 0x35, 0x10, 0x10, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 
-  0x11, 0x10, 0x10, 0x43, 0x00, 0x00, 0x00, 0x04, 0x39, 0x10, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x10, 0x33, 0x00, 0x00, 0x00, 0x2D, 0x11, 0x10, 0x10, 0x61, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x30, 0x10, 0x10, 0x10, 0x4D, 0x00, 0x00, 0x00, 0x5A, 0x11, 0x11, 0x10, 0x30, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x25, 0x11, 0x7E, 0x10, 0x5B, 0x00, 0x00, 0x00, 0x30, 
-  0x10, 0x37, 0x11, 0x58, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x27, 0x25, 0x46, 0x10, 0x56, 
-  0x00, 0x00, 0x31, 0x58, 0x1D, 0x51, 0x1D, 0x25, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x11, 
-  0x58, 0x7D, 0x10, 0x62, 0x49, 0x00, 0x2F, 0x30, 0x3F, 0x7D, 0x3F, 0x39, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x60, 0x10, 0x11, 0x42, 0x1D, 0x30, 0x98, 0x00, 0x97, 0x25, 0x30, 0xB0, 0x7E, 0x10, 0x5B, 0x49, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x11, 0xB1, 0x3B, 0x27, 0x25, 0x52, 0x00, 0xB2, 0x39, 0x30, 0x31, 0x53, 0x1D, 
-  0x61, 0x49, 0x00, 0x98, 0x54, 0x49, 0x00, 0x00, 0x00, 0x00, 0x5C, 0x47, 0x67, 0x00, 0x25, 0x11, 0x80, 0x00, 0x67, 0x10, 
-  0x30, 0x00, 0x52, 0x25, 0x3A, 0x49, 0x00, 0xB3, 0x30, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x11, 
-  0xB4, 0x00, 0x38, 0x11, 0x61, 0x00, 0x32, 0x3F, 0x11, 0x49, 0x3B, 0x30, 0x27, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x46, 0x39, 0x29, 0x49, 0xB4, 0x11, 0x38, 0x00, 0x49, 0x11, 0x25, 0x55, 0x42, 0x30, 0x25, 0x3E, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x25, 0x66, 0x49, 0x5F, 0x1D, 0x4D, 0x00, 0x49, 0x3A, 0x27, 0xB6, 0x97, 0x3F, 
-  0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x25, 0x27, 0x00, 0x56, 0x39, 0x5D, 0x00, 0x49, 0x61, 
-  0x1D, 0x26, 0x52, 0x1D, 0x58, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x10, 0x25, 0x04, 0x30, 0x39, 
-  0x3D, 0x00, 0x00, 0x53, 0x11, 0x35, 0x05, 0x10, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x1E, 
-  0x11, 0x61, 0x1D, 0x7E, 0x3B, 0x00, 0x00, 0x65, 0x27, 0x1D, 0x61, 0x11, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x49, 0xAF, 0x10, 0x11, 0x10, 0x66, 0x31, 0x00, 0x00, 0x04, 0x30, 0x10, 0x11, 0x1D, 0x4D, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x11, 0x10, 0x10, 0x1E, 0x49, 0x00, 0x00, 0x34, 0x58, 0x10, 0x10, 0x39, 
-  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x25, 0x10, 0x39, 0x38, 0x00, 0x00, 0x00, 0x00, 
-  0x29, 0x10, 0x10, 0x7E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x30, 0x10, 0x58, 0x4C, 
-  0x00, 0x00, 0x00, 0x00, 0x3C, 0x10, 0x10, 0x3A, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x2D, 0x10, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x2A, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x41, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0x10, 0x10, 0x56, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x10, 0x11, 0x39, 0xB4, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x25, 0x10, 0x29, 
-  0x11, 0x25, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x5F, 0x10, 0x45, 0x3B, 0x62, 0x10, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x3B, 0x45, 0x25, 0x2D, 0x00, 0x5B, 0x10, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x39, 0x30, 0x31, 0x00, 0xA3, 0x10, 0x62, 0x3B, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x11, 0x1E, 0x00, 0x00, 0x12, 0x35, 0x25, 0x2D, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3A, 0x11, 0x38, 0x00, 0x00, 
-  0x00, 0x3A, 0x10, 0x3A, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x30, 
-  0x11, 0x4D, 0x00, 0x00, 0x00, 0x3C, 0x3F, 0x2A, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x04, 0x25, 0x3F, 0x04, 0x00, 0x00, 0x00, 0x49, 0x25, 0x39, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x1E, 0x10, 0x31, 0x00, 0x00, 0x00, 0x00, 0x48, 0x11, 0x48, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x49, 0xB3, 0x58, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x11, 
-  0x30, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x4C, 0x25, 0x25, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x4C, 0x25, 0x27, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1D, 0x58, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x10, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x38, 0x10, 0x37, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x1D, 0x37, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x11, 
-  0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x10, 0x30, 0x4C, 0x00, 
-  0x00, 0x2B, 0x30, 0x1D, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 
-  0x3A, 0x1D, 0xAF, 0x00, 0x00, 0x05, 0x25, 0x45, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x38, 0x39, 0x10, 0x3B, 0x49, 0x45, 0x10, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x30, 0x10, 0x4A, 0x32, 0x10, 0x30, 0x59, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5B, 0x10, 0x37, 0xB7, 0x10, 0x4E, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3F, 0x10, 
-  0x39, 0x1D, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x44, 0x11, 0x11, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 
-  0x16, 0xB8, 0x35, 0x30, 0x30, 0x3C, 0x1B, 0x71, 0x72, 0x00, 0xB9, 0x16, 0x00, 0x00, 0x74, 0x9E, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x73, 0xBA, 0xBB, 0x10, 0x10, 0x10, 0x11, 0xBC, 0x71, 0x72, 0x00, 0xA9, 0x0E, 0x00, 0x00, 0x71, 0xBD, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x1D, 0x11, 0x97, 0x1E, 0x10, 0x10, 0xBE, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x10, 0x25, 0x60, 0x00, 0xB0, 0x10, 0x11, 0x61, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x11, 0x37, 0x00, 0x00, 
-  0x00, 0x65, 0x25, 0x1D, 0xA3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 
-  0x25, 0x41, 0x00, 0x00, 0x00, 0x00, 0x29, 0x10, 0x11, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x2D, 0x50, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x40, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x04, 0x25, 0x10, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x12, 0x58, 
-  0x11, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2D, 0x39, 0x3F, 0xA3, 0x00, 
-  0x00, 0x00, 0x80, 0x10, 0x58, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 
-  0x66, 0x10, 0x10, 0x3B, 0x00, 0x42, 0x39, 0x1D, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x32, 0x30, 0x10, 0x1E, 0x43, 0x10, 0x10, 0x2C, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBD, 
-  0xC0, 0x00, 0x7A, 0x9E, 0xA4, 0x00, 0xA1, 0x9E, 0xC1, 0x3C, 0x39, 0x11, 0x3F, 0x10, 0x6F, 0xC2, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xA9, 0x73, 0x00, 0x7A, 0xA9, 0x8D, 0x00, 0x87, 0x19, 0x0B, 0x00, 0xC3, 0x77, 0x25, 0x3A, 0xC4, 0xAB, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7A, 0x7A, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x00, 0x7A, 0x00, 0x00, 0x7A, 0x49, 
-  0x3B, 0x49, 0x7A, 0x7A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xAC, 
-  0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0xAC, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x74, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x73, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x71, 0x74, 0x0E, 0x0E, 0x0E, 0x0E, 0x71, 0x71, 0x01, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC6, 0xC7, 0xC8, 0x23, 0x23, 0x23, 0xC9, 0xC6, 0xC7, 0xCA, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x11, 0xCB, 0x00, 0x00, 0x00, 
-  0x24, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 
-  0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 
-  0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 
-  0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 
-  0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 
-  0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x10, 0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x35, 0x12, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x49, 0x25, 0x10, 0xCB, 0x00, 0x00, 0x00, 
-  0x7D, 0x30, 0x35, 0x57, 0x31, 0x31, 0x31, 0x31, 0x31, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x37, 0x66, 0x10, 0x10, 
-  0xCB, 0x00, 0x00, 0x00, 0x7D, 0x30, 0x10, 0x2C, 0x37, 0x37, 0x37, 0x37, 0x2A, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 
-  0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x00, 0x00, 0x00, 0x24, 0x62, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x58, 0xA3, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x96, 0x52, 0x52, 0x52, 0x52, 0x5D, 0x00, 0x00, 0x00, 0x2F, 0x3C, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 
-  0x3C, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x7E, 
-  0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x2A, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x65, 0x27, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x35, 0x29, 0x29, 0x29, 0x29, 0x1D, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 
-  0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 
-  0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 
-  0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 
-  0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 
-  0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 
-  0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x27, 0x1E, 0x49, 0x00, 0x00, 0x00, 0x62, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x3F, 0xCC, 0x49, 0x00, 0x00, 0x00, 0x62, 0x11, 0x40, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x9E, 0x75, 0xCD, 0xCE, 0xCF, 0x00, 0x00, 0x00, 
-  0x00, 0xD0, 0xCE, 0xD1, 0x9E, 0x9E, 0x9E, 0x9E, 0x9E, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0x71, 0x71, 0x71, 0x71, 
-  0xD3, 0x00, 0x00, 0x00, 0x00, 0x16, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0xD4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 
-  0x73, 0x73, 0x73, 0x73, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x6D, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x3B, 0x3B, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD6, 0x7E, 0x30, 0x30, 0x58, 0x1E, 0x57, 0x00, 0x00, 0x59, 0x25, 0xD7, 0x34, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0x11, 0x10, 0x27, 0x3F, 0x27, 0x10, 0x25, 0xD8, 0x00, 0x47, 
-  0x10, 0x58, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x10, 0x11, 0x3A, 0x4F, 0x00, 0x4F, 0x1E, 
-  0x10, 0x30, 0x49, 0x3A, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x10, 0x37, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x45, 0x10, 0xD9, 0x45, 0x10, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 
-  0x10, 0x39, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x10, 0x5F, 0x10, 0x10, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x10, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x10, 0x10, 0x25, 0x2B, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x10, 0xDA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x10, 0x10, 
-  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xDB, 0x10, 0x10, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x10, 0x1E, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0xDB, 0x10, 0x1D, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 
-  0x10, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x10, 0x30, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x36, 0x10, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0x10, 0x25, 0x34, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x10, 0x11, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x10, 0x10, 0x3F, 
-  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x30, 0x10, 0x10, 0x49, 0x00, 0x00, 0x00, 0xB0, 
-  0x10, 0x11, 0x10, 0x10, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x10, 0x10, 0x10, 
-  0xB4, 0x44, 0xB1, 0x39, 0x10, 0xDD, 0x56, 0x10, 0x10, 0xCB, 0x29, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x05, 0x25, 0x10, 0x10, 0x11, 0x10, 0x3F, 0x81, 0x00, 0xDE, 0x27, 0x10, 0x11, 0x10, 0xD8, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x41, 0x36, 0x63, 0x2D, 0x3D, 0x00, 0x00, 0x00, 0x55, 0x80, 0x46, 0x41, 0x34, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x40, 0x04, 
-  0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x3B, 0xA2, 0xDF, 0x62, 0x2E, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x49, 0x67, 0x58, 0xB6, 0xE0, 0x37, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0x56, 0x60, 0x49, 0x5D, 0x3F, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4D, 0x30, 0xE1, 0x00, 0x81, 0x35, 0x98, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x26, 0xB4, 0x2B, 0x00, 0x44, 
-  0x29, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x1E, 
-  0xE2, 0x00, 0xB0, 0xD7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3B, 0x61, 0x29, 0xD8, 0x47, 0x45, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x2E, 0x25, 0x10, 0x10, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x3F, 0xDA, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x5F, 0xAF, 0x34, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0x6E, 0x27, 
-  0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0xE2, 0x37, 0x10, 0x29, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x52, 0x35, 0x4E, 0x10, 0x11, 0xE5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x61, 0x1E, 0x00, 0xE6, 0xDF, 0xD9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x62, 0xDE, 0x00, 0xB0, 0xB3, 0xDD, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xE7, 0x2A, 0xE1, 0x00, 0x52, 0x10, 
-  0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x46, 0x48, 
-  0x3B, 0x00, 0xDA, 0x48, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x49, 0x60, 0x29, 0x3B, 0x05, 0x1D, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x59, 0x3F, 0x61, 0x30, 0xCB, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x05, 0xB4, 0x05, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x3B, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  
+  /*Sprite runs*/
+  0x02, 0x85, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x00, 0x82, 0x07, 0x02, 0x08, 0x00, 0x82, 0x09, 0x02, 0x0A, 0x00, 0x81, 
+  0x0B, 0x0C, 0x03, 0x02, 0x89, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x11, 0x12, 0x13, 0x0E, 0x14, 0x00, 0x82, 0x15, 0x16, 0x17, 
+  0x00, 0x82, 0x18, 0x19, 0x03, 0x02, 0x02, 0x89, 0x1A, 0x1B, 0x1C, 0x10, 0x1D, 0x11, 0x1E, 0x1F, 0x20, 0x21, 0x00, 0x82, 
+  0x0C, 0x20, 0x22, 0x00, 0x82, 0x23, 0x15, 0x07, 0x02, 0x03, 0x86, 0x24, 0x25, 0x10, 0x26, 0x27, 0x1D, 0x28, 0x0C, 0x03, 
+  0x82, 0x29, 0x10, 0x2A, 0x00, 0x82, 0x25, 0x10, 0x05, 0x0C, 0x02, 0x83, 0x2B, 0x2C, 0x25, 0x2D, 0x00, 0x82, 0x2E, 0x10, 
+  0x2C, 0x0C, 0x02, 0x83, 0x2F, 0x1D, 0x30, 0x31, 0x00, 0x83, 0x32, 0x10, 0x30, 0x33, 0x0B, 0x02, 0x82, 0x05, 0x11, 0x1E, 
+  0x01, 0x83, 0x34, 0x35, 0x11, 0x36, 0x0B, 0x02, 0x82, 0x37, 0x10, 0x38, 0x02, 0x83, 0x38, 0x39, 0x3A, 0x31, 0x0A, 0x01, 
+  0x83, 0x3B, 0x30, 0x11, 0x3C, 0x02, 0x83, 0x2F, 0x30, 0x11, 0x3D, 0x0A, 0x01, 0x83, 0x3E, 0x30, 0x3F, 0x40, 0x03, 0x82, 
+  0x3A, 0x11, 0x41, 0x05, 0x81, 0x42, 0x43, 0x02, 0x01, 0x83, 0x2F, 0x44, 0x45, 0x34, 0x03, 0x82, 0x46, 0x10, 0x3F, 0x05, 
+  0x82, 0x47, 0x30, 0x48, 0x01, 0x03, 0x80, 0x49, 0x04, 0x83, 0x4A, 0x27, 0x3F, 0x40, 0x04, 0x82, 0x30, 0x10, 0x05, 0x01, 
+  0x09, 0x83, 0x34, 0x30, 0x10, 0x05, 0x03, 0x83, 0x32, 0x25, 0x25, 0x4B, 0x01, 0x0A, 0x82, 0x44, 0x11, 0x29, 0x03, 0x83, 
+  0x3C, 0x11, 0x30, 0x3B, 0x01, 0x0A, 0x83, 0x4C, 0x1D, 0x25, 0x12, 0x02, 0x82, 0x44, 0x10, 0x3A, 0x02, 0x0A, 0x83, 0x31, 
+  0x2C, 0x39, 0x46, 0x02, 0x82, 0x37, 0x11, 0x4D, 0x02, 0x0B, 0x83, 0x48, 0x10, 0x4E, 0x31, 0x00, 0x83, 0x4F, 0x30, 0x10, 
+  0x50, 0x02, 0x0B, 0x83, 0x4F, 0x30, 0x10, 0x4F, 0x00, 0x83, 0x48, 0x11, 0x3A, 0x34, 0x02, 0x0C, 0x86, 0x3A, 0x10, 0x48, 
+  0x3B, 0x35, 0x39, 0x51, 0x03, 0x0C, 0x86, 0x52, 0x10, 0x11, 0x1E, 0x10, 0x30, 0x49, 0x03, 0x0C, 0x85, 0x49, 0x2C, 0x11, 
+  0x10, 0x39, 0x4D, 0x04, 0x0D, 0x83, 0x3B, 0x2A, 0x10, 0x53, 0x05, 0x0E, 0x81, 0x31, 0x54, 0x06, 0x05, 0x81, 0x43, 0x55, 
+  0x0F, 0x04, 0x83, 0x3C, 0x10, 0x10, 0x46, 0x0E, 0x03, 0x85, 0x3B, 0x3F, 0x10, 0x10, 0x11, 0x3D, 0x0D, 0x03, 0x85, 0x53, 
+  0x11, 0x1D, 0x56, 0x11, 0x36, 0x0D, 0x02, 0x87, 0x31, 0x37, 0x39, 0x44, 0x41, 0x1D, 0x27, 0x50, 0x0C, 0x02, 0x87, 0x57, 
+  0x10, 0x30, 0x43, 0x12, 0x58, 0x10, 0x59, 0x0C, 0x02, 0x82, 0x2D, 0x11, 0x3A, 0x01, 0x82, 0x5A, 0x10, 0x5B, 0x0C, 0x02, 
+  0x82, 0x37, 0x10, 0x38, 0x01, 0x83, 0x4A, 0x10, 0x30, 0x49, 0x0B, 0x01, 0x83, 0x3B, 0x30, 0x11, 0x52, 0x01, 0x83, 0x3D, 
+  0x35, 0x25, 0x5C, 0x0B, 0x01, 0x83, 0x5D, 0x25, 0x25, 0x5E, 0x02, 0x83, 0x2A, 0x10, 0x5F, 0x49, 0x0A, 0x01, 0x82, 0x2D, 
+  0x10, 0x58, 0x03, 0x83, 0x2D, 0x25, 0x45, 0x3B, 0x0A, 0x01, 0x82, 0x60, 0x37, 0x61, 0x03, 0x83, 0x3B, 0x30, 0x39, 0x4F, 
+  0x04, 0x83, 0x3E, 0x62, 0x63, 0x64, 0x01, 0x02, 0x81, 0x31, 0x3B, 0x04, 0x82, 0x29, 0x11, 0x53, 0x04, 0x83, 0x65, 0x10, 
+  0x62, 0x49, 0x01, 0x09, 0x83, 0x2E, 0x10, 0x30, 0x49, 0x03, 0x82, 0x44, 0x10, 0x1E, 0x02, 0x09, 0x83, 0x04, 0x3F, 0x27, 
+  0x4B, 0x03, 0x82, 0x3A, 0x11, 0x4D, 0x02, 0x0A, 0x82, 0x11, 0x10, 0x51, 0x02, 0x83, 0x3B, 0x30, 0x11, 0x43, 0x02, 0x0A, 
+  0x82, 0x2D, 0x11, 0x66, 0x02, 0x83, 0x65, 0x25, 0x2C, 0x2B, 0x02, 0x0A, 0x83, 0x50, 0x10, 0x25, 0x04, 0x01, 0x82, 0x2C, 
+  0x10, 0x1E, 0x03, 0x0A, 0x83, 0x49, 0x3A, 0x11, 0x29, 0x00, 0x83, 0x3D, 0x35, 0x25, 0x4D, 0x03, 0x0B, 0x86, 0x67, 0x27, 
+  0x35, 0x50, 0x3C, 0x10, 0x30, 0x04, 0x0B, 0x86, 0x49, 0x30, 0x10, 0x38, 0x10, 0x10, 0x68, 0x04, 0x01, 0x82, 0x69, 0x6A, 
+  0x01, 0x00, 0x81, 0x6B, 0x6C, 0x01, 0x81, 0x6A, 0x6D, 0x00, 0x85, 0x6E, 0x10, 0x39, 0x10, 0x6F, 0x70, 0x04, 0x01, 0x82, 
+  0x20, 0x71, 0x72, 0x00, 0x81, 0x73, 0x16, 0x01, 0x81, 0x74, 0x75, 0x00, 0x85, 0x76, 0x77, 0x10, 0x10, 0x78, 0x16, 0x04, 
+  0x01, 0x82, 0x0A, 0x79, 0x7A, 0x00, 0x81, 0x08, 0x0B, 0x01, 0x81, 0x79, 0x01, 0x00, 0x85, 0x7B, 0x7C, 0x3E, 0x57, 0x08, 
+  0x0B, 0x04, 0x04, 0x83, 0x49, 0x7D, 0x4D, 0x3B, 0x0E, 0x04, 0x84, 0x46, 0x10, 0x10, 0x5F, 0x49, 0x0D, 0x03, 0x85, 0x32, 
+  0x58, 0x10, 0x11, 0x3F, 0x7D, 0x0D, 0x03, 0x85, 0x47, 0x10, 0x7E, 0x5F, 0x10, 0x11, 0x0D, 0x02, 0x87, 0x2B, 0x37, 0x27, 
+  0x7F, 0x4B, 0x25, 0x11, 0x04, 0x0C, 0x02, 0x83, 0x32, 0x11, 0x30, 0x54, 0x00, 0x82, 0x10, 0x10, 0x2E, 0x0C, 0x02, 0x82, 
+  0x67, 0x11, 0x1E, 0x01, 0x82, 0x05, 0x10, 0x45, 0x0C, 0x02, 0x82, 0x7E, 0x10, 0x80, 0x01, 0x83, 0x32, 0x10, 0x30, 0x4F, 
+  0x0B, 0x01, 0x83, 0x50, 0x30, 0x39, 0x81, 0x01, 0x83, 0x31, 0x7E, 0x11, 0x53, 0x0B, 0x01, 0x83, 0x4A, 0x27, 0x30, 0x2F, 
+  0x02, 0x83, 0x53, 0x39, 0x3A, 0x34, 0x0A, 0x01, 0x83, 0x82, 0x10, 0x3F, 0x83, 0x00, 0x85, 0x84, 0x1B, 0x85, 0x30, 0x10, 
+  0x86, 0x01, 0x81, 0x87, 0x69, 0x00, 0x82, 0x88, 0x89, 0x7B, 0x02, 0x01, 0x83, 0x8A, 0x3A, 0x8B, 0x8C, 0x00, 0x85, 0x8D, 
+  0x16, 0x1F, 0x4E, 0x10, 0x8E, 0x00, 0x82, 0x7A, 0x0E, 0x8F, 0x00, 0x83, 0x90, 0x6F, 0x30, 0x52, 0x01, 0x01, 0x83, 0x91, 
+  0x92, 0x93, 0x08, 0x00, 0x86, 0x0B, 0x02, 0x91, 0x44, 0x10, 0x94, 0x91, 0x00, 0x81, 0x02, 0x22, 0x00, 0x85, 0x95, 0x27, 
+  0x25, 0x33, 0x7A, 0x91, 0x09, 0x83, 0x81, 0x39, 0x30, 0x42, 0x03, 0x83, 0x96, 0x11, 0x58, 0x2B, 0x01, 0x09, 0x83, 0x3B, 
+  0x30, 0x11, 0x65, 0x03, 0x82, 0x44, 0x10, 0x3A, 0x02, 0x0A, 0x82, 0x36, 0x11, 0x5A, 0x03, 0x82, 0x3A, 0x11, 0x4D, 0x02, 
+  0x0A, 0x83, 0x33, 0x11, 0x30, 0x2B, 0x01, 0x83, 0x12, 0x30, 0x11, 0x57, 0x02, 0x0A, 0x83, 0x3B, 0x2C, 0x27, 0x2E, 0x01, 
+  0x83, 0x60, 0x27, 0x37, 0x2B, 0x02, 0x0B, 0x87, 0x5A, 0x10, 0x56, 0x49, 0x49, 0x4E, 0x11, 0x48, 0x03, 0x0B, 0x87, 0x97, 
+  0x30, 0x10, 0x04, 0x5E, 0x10, 0x30, 0x5D, 0x03, 0x0C, 0x85, 0x1E, 0x10, 0x61, 0x5A, 0x10, 0x3A, 0x04, 0x0C, 0x85, 0x7D, 
+  0x39, 0x11, 0x11, 0x39, 0x24, 0x04, 0x0D, 0x83, 0x5A, 0x11, 0x10, 0x36, 0x05, 0x0D, 0x82, 0x49, 0x04, 0x98, 0x06, 0x00, 
+  0x81, 0x02, 0x1A, 0x01, 0x85, 0x99, 0x81, 0x3C, 0x9A, 0x1A, 0x09, 0x00, 0x81, 0x0C, 0x1A, 0x01, 0x81, 0x1A, 0x1A, 0x00, 
+  0x82, 0x07, 0x1A, 0x7A, 0x01, 0x00, 0x81, 0x73, 0x16, 0x01, 0x85, 0x9B, 0x10, 0x10, 0x9C, 0x74, 0x9D, 0x00, 0x81, 0x9E, 
+  0x16, 0x01, 0x81, 0x9F, 0x0E, 0x00, 0x82, 0x01, 0x16, 0x0A, 0x01, 0x00, 0x81, 0x23, 0x9D, 0x00, 0x86, 0x4F, 0x30, 0x10, 
+  0x11, 0x39, 0xA0, 0x0B, 0x00, 0x81, 0x69, 0x9D, 0x01, 0x81, 0xA1, 0x9D, 0x00, 0x82, 0x07, 0x9D, 0x07, 0x01, 0x03, 0x85, 
+  0x29, 0x10, 0x56, 0x3A, 0x10, 0x37, 0x0D, 0x02, 0x87, 0x3B, 0x45, 0x25, 0x2D, 0x52, 0x25, 0x39, 0x55, 0x0C, 0x02, 0x87, 
+  0x4C, 0x1D, 0x30, 0x3B, 0x49, 0x30, 0x10, 0x96, 0x0C, 0x02, 0x82, 0x60, 0x11, 0x29, 0x01, 0x82, 0xA2, 0x10, 0x61, 0x0C, 
+  0x02, 0x82, 0x10, 0x10, 0x60, 0x01, 0x83, 0xA3, 0x10, 0x30, 0x3B, 0x0B, 0x01, 0x83, 0x3D, 0x30, 0x39, 0x24, 0x01, 0x83, 
+  0x12, 0x35, 0x27, 0x41, 0x0B, 0x01, 0x83, 0x4A, 0x27, 0x30, 0x2F, 0x02, 0x83, 0x3A, 0x10, 0x1E, 0x49, 0x0A, 0x01, 0x82, 
+  0x41, 0x10, 0x30, 0x03, 0x83, 0x52, 0x25, 0x4E, 0x3B, 0x04, 0x81, 0x31, 0x54, 0x03, 0x01, 0x82, 0x4D, 0x3A, 0x5B, 0x03, 
+  0x83, 0x49, 0x3F, 0x39, 0x5D, 0x04, 0x83, 0x4B, 0x62, 0x3F, 0x3D, 0x01, 0x02, 0x81, 0x49, 0x31, 0x04, 0x82, 0x48, 0x10, 
+  0x48, 0x04, 0x82, 0x2D, 0x10, 0x58, 0x02, 0x09, 0x83, 0x2D, 0x10, 0x58, 0x31, 0x03, 0x82, 0x26, 0x10, 0x47, 0x02, 0x09, 
+  0x83, 0x4C, 0x3F, 0x27, 0x4A, 0x03, 0x82, 0x37, 0x11, 0x52, 0x02, 0x0A, 0x82, 0x7E, 0x10, 0x38, 0x02, 0x83, 0x50, 0x30, 
+  0x10, 0x3D, 0x02, 0x0A, 0x82, 0x4D, 0x11, 0x2C, 0x02, 0x83, 0x2D, 0x25, 0x37, 0x31, 0x02, 0x0A, 0x83, 0x12, 0x10, 0x25, 
+  0x97, 0x01, 0x82, 0x45, 0x10, 0x1E, 0x03, 0x0A, 0x83, 0x49, 0x3A, 0x10, 0x1E, 0x00, 0x83, 0x3D, 0x35, 0x3F, 0x3C, 0x03, 
+  0x0B, 0x87, 0x41, 0x27, 0x35, 0x50, 0x4D, 0x10, 0x30, 0x49, 0x03, 0x0C, 0x85, 0x25, 0x10, 0x44, 0x10, 0x10, 0x68, 0x04, 
+  0x01, 0x85, 0x20, 0xA4, 0x07, 0xA5, 0x6A, 0x15, 0x00, 0x82, 0x1A, 0x6C, 0xA6, 0x00, 0x85, 0xA7, 0x10, 0x39, 0x10, 0x6F, 
+  0xA8, 0x00, 0x80, 0x02, 0x02, 0x01, 0x85, 0x18, 0xA9, 0x03, 0x08, 0x71, 0x6C, 0x00, 0x82, 0x23, 0x16, 0x9D, 0x00, 0x85, 
+  0xAA, 0x56, 0x10, 0x10, 0x78, 0xAB, 0x00, 0x80, 0x23, 0x02, 0x01, 0x81, 0xAC, 0x08, 0x00, 0x82, 0x7A, 0x79, 0xA5, 0x00, 
+  0x82, 0x03, 0x0B, 0x03, 0x00, 0x85, 0xA5, 0x7C, 0x3E, 0xAD, 0x79, 0xAC, 0x00, 0x80, 0x03, 0x02, 0x03, 0x82, 0xA3, 0x38, 
+  0x31, 0x04, 0x82, 0x54, 0x38, 0xAE, 0x08, 0x02, 0x83, 0x12, 0x10, 0x1D, 0xAF, 0x03, 0x84, 0x49, 0x1E, 0x10, 0x56, 0x12, 
+  0x07, 0x02, 0x84, 0x5C, 0x1D, 0x10, 0x35, 0x2B, 0x02, 0x84, 0x3B, 0x35, 0x10, 0x10, 0xA3, 0x07, 0x02, 0x84, 0x47, 0x11, 
+  0x10, 0x10, 0x43, 0x02, 0x84, 0x04, 0x39, 0x10, 0x10, 0x05, 0x07, 0x02, 0x80, 0x30, 0x42, 0x10, 0x80, 0x33, 0x02, 0x84, 
+  0x2D, 0x11, 0x10, 0x10, 0x61, 0x07, 0x01, 0x81, 0x64, 0x30, 0x42, 0x10, 0x80, 0x4D, 0x02, 0x84, 0x5A, 0x11, 0x11, 0x10, 
+  0x30, 0x07, 0x01, 0x85, 0x40, 0x25, 0x11, 0x7E, 0x10, 0x5B, 0x02, 0x85, 0x30, 0x10, 0x37, 0x11, 0x58, 0xB0, 0x06, 0x01, 
+  0x85, 0x7D, 0x27, 0x25, 0x46, 0x10, 0x56, 0x01, 0x86, 0x31, 0x58, 0x1D, 0x51, 0x1D, 0x25, 0x4A, 0x06, 0x01, 0x86, 0x4D, 
+  0x11, 0x58, 0x7D, 0x10, 0x62, 0x49, 0x00, 0x86, 0x2F, 0x30, 0x3F, 0x7D, 0x3F, 0x39, 0x67, 0x06, 0x01, 0x86, 0x60, 0x10, 
+  0x11, 0x42, 0x1D, 0x30, 0x98, 0x00, 0x87, 0x97, 0x25, 0x30, 0xB0, 0x7E, 0x10, 0x5B, 0x49, 0x05, 0x01, 0x86, 0x44, 0x11, 
+  0xB1, 0x3B, 0x27, 0x25, 0x52, 0x00, 0x87, 0xB2, 0x39, 0x30, 0x31, 0x53, 0x1D, 0x61, 0x49, 0x00, 0x82, 0x98, 0x54, 0x49, 
+  0x01, 0x01, 0x82, 0x5C, 0x47, 0x67, 0x00, 0x82, 0x25, 0x11, 0x80, 0x00, 0x82, 0x67, 0x10, 0x30, 0x00, 0x83, 0x52, 0x25, 
+  0x3A, 0x49, 0x00, 0x82, 0xB3, 0x30, 0x6E, 0x01, 0x05, 0x82, 0x3A, 0x11, 0xB4, 0x00, 0x82, 0x38, 0x11, 0x61, 0x00, 0x87, 
+  0x32, 0x3F, 0x11, 0x49, 0x3B, 0x30, 0x27, 0xB5, 0x01, 0x05, 0x86, 0x46, 0x39, 0x29, 0x49, 0xB4, 0x11, 0x38, 0x00, 0x87, 
+  0x49, 0x11, 0x25, 0x55, 0x42, 0x30, 0x25, 0x3E, 0x01, 0x05, 0x86, 0x81, 0x25, 0x66, 0x49, 0x5F, 0x1D, 0x4D, 0x00, 0x87, 
+  0x49, 0x3A, 0x27, 0xB6, 0x97, 0x3F, 0x30, 0x2F, 0x01, 0x05, 0x82, 0x3D, 0x25, 0x27, 0x00, 0x82, 0x56, 0x39, 0x5D, 0x00, 
+  0x87, 0x49, 0x61, 0x1D, 0x26, 0x52, 0x1D, 0x58, 0x31, 0x01, 0x05, 0x86, 0x49, 0x10, 0x25, 0x04, 0x30, 0x39, 0x3D, 0x01, 
+  0x85, 0x53, 0x11, 0x35, 0x05, 0x10, 0x25, 0x02, 0x05, 0x86, 0x49, 0x1E, 0x11, 0x61, 0x1D, 0x7E, 0x3B, 0x01, 0x85, 0x65, 
+  0x27, 0x1D, 0x61, 0x11, 0xAF, 0x02, 0x05, 0x86, 0x49, 0xAF, 0x10, 0x11, 0x10, 0x66, 0x31, 0x01, 0x85, 0x04, 0x30, 0x10, 
+  0x11, 0x1D, 0x4D, 0x02, 0x06, 0x85, 0x51, 0x11, 0x10, 0x10, 0x1E, 0x49, 0x01, 0x85, 0x34, 0x58, 0x10, 0x10, 0x39, 0x98, 
+  0x02, 0x06, 0x84, 0x7D, 0x25, 0x10, 0x39, 0x38, 0x03, 0x84, 0x29, 0x10, 0x10, 0x7E, 0x3B, 0x02, 0x06, 0x84, 0x34, 0x30, 
+  0x10, 0x58, 0x4C, 0x03, 0x84, 0x3C, 0x10, 0x10, 0x3A, 0x49, 0x02, 0x07, 0x82, 0x2D, 0x10, 0x53, 0x04, 0x83, 0x64, 0x2A, 
+  0x25, 0x04, 0x03, 0x08, 0x81, 0x32, 0x49, 0x05, 0x81, 0x3B, 0x12, 0x04, 0x05, 0x82, 0x33, 0x41, 0x43, 0x0E, 0x04, 0x84, 
+  0x59, 0x10, 0x10, 0x56, 0x31, 0x0D, 0x04, 0x84, 0x2A, 0x10, 0x11, 0x39, 0xB4, 0x0D, 0x03, 0x86, 0x52, 0x25, 0x10, 0x29, 
+  0x11, 0x25, 0xB0, 0x0C, 0x02, 0x87, 0x49, 0x5F, 0x10, 0x45, 0x3B, 0x62, 0x10, 0x52, 0x0C, 0x02, 0x83, 0x3B, 0x45, 0x25, 
+  0x2D, 0x00, 0x82, 0x5B, 0x10, 0x47, 0x0C, 0x02, 0x83, 0x2F, 0x39, 0x30, 0x31, 0x00, 0x83, 0xA3, 0x10, 0x62, 0x3B, 0x0B, 
+  0x02, 0x82, 0x2D, 0x11, 0x1E, 0x01, 0x83, 0x12, 0x35, 0x25, 0x2D, 0x0B, 0x02, 0x82, 0x3A, 0x11, 0x38, 0x02, 0x83, 0x3A, 
+  0x10, 0x3A, 0x49, 0x0A, 0x01, 0x83, 0x31, 0x30, 0x11, 0x4D, 0x02, 0x83, 0x3C, 0x3F, 0x2A, 0x3B, 0x0A, 0x01, 0x83, 0x04, 
+  0x25, 0x3F, 0x04, 0x02, 0x83, 0x49, 0x25, 0x39, 0x5D, 0x05, 0x80, 0x42, 0x03, 0x01, 0x83, 0x33, 0x1E, 0x10, 0x31, 0x03, 
+  0x82, 0x48, 0x11, 0x48, 0x04, 0x83, 0x49, 0xB3, 0x58, 0x52, 0x01, 0x03, 0x80, 0x3B, 0x04, 0x83, 0x2D, 0x11, 0x30, 0x3B, 
+  0x03, 0x83, 0x4C, 0x25, 0x25, 0x97, 0x01, 0x09, 0x83, 0x4C, 0x25, 0x27, 0x7D, 0x03, 0x83, 0x3C, 0x1D, 0x58, 0x3B, 0x01, 
+  0x0A, 0x82, 0x25, 0x10, 0xA2, 0x03, 0x82, 0x38, 0x10, 0x37, 0x02, 0x0A, 0x82, 0x2D, 0x1D, 0x37, 0x03, 0x82, 0x1E, 0x11, 
+  0x2D, 0x02, 0x0A, 0x83, 0x50, 0x10, 0x30, 0x4C, 0x01, 0x83, 0x2B, 0x30, 0x1D, 0x2F, 0x02, 0x0A, 0x83, 0x34, 0x3A, 0x1D, 
+  0xAF, 0x01, 0x83, 0x05, 0x25, 0x45, 0x3B, 0x02, 0x0B, 0x87, 0x38, 0x39, 0x10, 0x3B, 0x49, 0x45, 0x10, 0x29, 0x03, 0x0B, 
+  0x87, 0x50, 0x30, 0x10, 0x4A, 0x32, 0x10, 0x30, 0x59, 0x03, 0x0C, 0x85, 0x5B, 0x10, 0x37, 0xB7, 0x10, 0x4E, 0x04, 0x0C, 
+  0x85, 0x04, 0x3F, 0x10, 0x39, 0x1D, 0x52, 0x04, 0x0D, 0x83, 0x44, 0x11, 0x11, 0x29, 0x05, 0x0E, 0x81, 0x04, 0x4F, 0x06, 
+  0x17, 0x17, 0x17, 0x17, 0x06, 0x81, 0x04, 0x3B, 0x0E, 0x02, 0x89, 0x71, 0x16, 0xB8, 0x35, 0x30, 0x30, 0x3C, 0x1B, 0x71, 
+  0x72, 0x00, 0x81, 0xB9, 0x16, 0x01, 0x81, 0x74, 0x9E, 0x03, 0x02, 0x82, 0x73, 0xBA, 0xBB, 0x42, 0x10, 0x83, 0x11, 0xBC, 
+  0x71, 0x72, 0x00, 0x81, 0xA9, 0x0E, 0x01, 0x81, 0x71, 0xBD, 0x03, 0x03, 0x87, 0x36, 0x1D, 0x11, 0x97, 0x1E, 0x10, 0x10, 
+  0xBE, 0x0B, 0x02, 0x83, 0x3D, 0x10, 0x25, 0x60, 0x00, 0x83, 0xB0, 0x10, 0x11, 0x61, 0x0B, 0x02, 0x82, 0x44, 0x11, 0x37, 
+  0x02, 0x83, 0x65, 0x25, 0x1D, 0xA3, 0x0A, 0x02, 0x82, 0x2D, 0x25, 0x41, 0x03, 0x83, 0x29, 0x10, 0x11, 0x3B, 0x04, 0x82, 
+  0x67, 0x2D, 0x50, 0x01, 0x03, 0x81, 0x40, 0xB0, 0x03, 0x83, 0x04, 0x25, 0x10, 0xA2, 0x03, 0x83, 0x12, 0x58, 0x11, 0x60, 
+  0x01, 0x0A, 0x83, 0x2D, 0x39, 0x3F, 0xA3, 0x02, 0x83, 0x80, 0x10, 0x58, 0x12, 0x01, 0x0A, 0x84, 0x49, 0x66, 0x10, 0x10, 
+  0x3B, 0x00, 0x83, 0x42, 0x39, 0x1D, 0x2E, 0x02, 0x0B, 0x88, 0x32, 0x30, 0x10, 0x1E, 0x43, 0x10, 0x10, 0x2C, 0xBF, 0x02, 
+  0x02, 0x81, 0xBD, 0xC0, 0x00, 0x82, 0x7A, 0x9E, 0xA4, 0x00, 0x89, 0xA1, 0x9E, 0xC1, 0x3C, 0x39, 0x11, 0x3F, 0x10, 0x6F, 
+  0xC2, 0x03, 0x02, 0x81, 0xA9, 0x73, 0x00, 0x82, 0x7A, 0xA9, 0x8D, 0x00, 0x82, 0x87, 0x19, 0x0B, 0x00, 0x85, 0xC3, 0x77, 
+  0x25, 0x3A, 0xC4, 0xAB, 0x03, 0x02, 0x81, 0x7A, 0x7A, 0x01, 0x80, 0x7A, 0x02, 0x80, 0x7A, 0x01, 0x85, 0x7A, 0x49, 0x3B, 
+  0x49, 0x7A, 0x7A, 0x03, 0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x05, 0x80, 0xC5, 0x46, 0xAC, 0x80, 0x09, 0x08, 0x05, 0x80, 
+  0x74, 0x46, 0x71, 0x81, 0x73, 0x09, 0x07, 0x05, 0x82, 0x0E, 0x71, 0x74, 0x43, 0x0E, 0x82, 0x71, 0x71, 0x01, 0x07, 0x05, 
+  0x82, 0xC6, 0xC7, 0xC8, 0x42, 0x23, 0x83, 0xC9, 0xC6, 0xC7, 0xCA, 0x07, 0x05, 0x82, 0x3F, 0x11, 0xCB, 0x02, 0x83, 0x24, 
+  0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 
+  0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 
+  0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 
+  0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 
+  0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 
+  0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 
+  0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 
+  0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 
+  0x05, 0x82, 0x3F, 0x10, 0xCB, 0x02, 0x83, 0x7D, 0x30, 0x35, 0x12, 0x07, 0x02, 0x85, 0x31, 0x31, 0x49, 0x25, 0x10, 0xCB, 
+  0x02, 0x83, 0x7D, 0x30, 0x35, 0x57, 0x44, 0x31, 0x80, 0x49, 0x01, 0x02, 0x85, 0x10, 0x37, 0x66, 0x10, 0x10, 0xCB, 0x02, 
+  0x83, 0x7D, 0x30, 0x10, 0x2C, 0x43, 0x37, 0x81, 0x2A, 0x04, 0x01, 0x02, 0x80, 0x62, 0x43, 0x3F, 0x80, 0x26, 0x02, 0x81, 
+  0x24, 0x62, 0x45, 0x3F, 0x81, 0x58, 0xA3, 0x01, 0x02, 0x80, 0x96, 0x43, 0x52, 0x80, 0x5D, 0x02, 0x81, 0x2F, 0x3C, 0x45, 
+  0x52, 0x81, 0x3C, 0x50, 0x01, 0x17, 0x17, 0x05, 0x81, 0x4D, 0x7E, 0x46, 0x2A, 0x80, 0x4F, 0x07, 0x05, 0x81, 0x65, 0x27, 
+  0x46, 0x10, 0x80, 0x04, 0x07, 0x05, 0x82, 0x65, 0x27, 0x35, 0x43, 0x29, 0x82, 0x1D, 0x10, 0x04, 0x07, 0x05, 0x82, 0x65, 
+  0x27, 0x1E, 0x03, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 
+  0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 
+  0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 
+  0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 
+  0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 
+  0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 
+  0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 
+  0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 
+  0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x65, 0x27, 0x1E, 0x49, 0x02, 0x82, 0x62, 0x10, 0x04, 0x07, 0x05, 0x83, 0x4D, 0x3F, 
+  0xCC, 0x49, 0x02, 0x82, 0x62, 0x11, 0x40, 0x07, 0x02, 0x85, 0x20, 0x9E, 0x75, 0xCD, 0xCE, 0xCF, 0x03, 0x82, 0xD0, 0xCE, 
+  0xD1, 0x44, 0x9E, 0x80, 0x20, 0x01, 0x02, 0x80, 0xD2, 0x43, 0x71, 0x80, 0xD3, 0x03, 0x80, 0x16, 0x46, 0x71, 0x80, 0xD4, 
+  0x01, 0x02, 0x80, 0xD5, 0x43, 0x73, 0x80, 0xBD, 0x03, 0x80, 0x0E, 0x46, 0x73, 0x80, 0x6D, 0x01, 0x0B, 0x80, 0x91, 0x0A, 
+  0x17, 0x17, 0x17, 0x07, 0x82, 0x3B, 0x3B, 0x31, 0x0C, 0x05, 0x86, 0xD6, 0x7E, 0x30, 0x30, 0x58, 0x1E, 0x57, 0x01, 0x83, 
+  0x59, 0x25, 0xD7, 0x34, 0x04, 0x04, 0x88, 0xAF, 0x11, 0x10, 0x27, 0x3F, 0x27, 0x10, 0x25, 0xD8, 0x00, 0x83, 0x47, 0x10, 
+  0x58, 0x34, 0x04, 0x03, 0x84, 0x65, 0x10, 0x11, 0x3A, 0x4F, 0x00, 0x87, 0x4F, 0x1E, 0x10, 0x30, 0x49, 0x3A, 0x10, 0x10, 
+  0x05, 0x02, 0x83, 0x12, 0x30, 0x10, 0x37, 0x04, 0x85, 0x45, 0x10, 0xD9, 0x45, 0x10, 0x2D, 0x05, 0x02, 0x83, 0x81, 0x10, 
+  0x39, 0x81, 0x04, 0x85, 0x98, 0x10, 0x5F, 0x10, 0x10, 0xB0, 0x05, 0x02, 0x82, 0x36, 0x10, 0x1D, 0x06, 0x84, 0x35, 0x10, 
+  0x10, 0x25, 0x2B, 0x05, 0x02, 0x82, 0x39, 0x10, 0xDA, 0x06, 0x83, 0xDB, 0x10, 0x10, 0x30, 0x06, 0x02, 0x82, 0x62, 0x10, 
+  0x1E, 0x06, 0x83, 0xDB, 0x10, 0x10, 0x65, 0x06, 0x02, 0x82, 0x62, 0x10, 0x1E, 0x06, 0x83, 0xDB, 0x10, 0x1D, 0xDC, 0x06, 
+  0x02, 0x82, 0x11, 0x10, 0x45, 0x06, 0x83, 0x7E, 0x10, 0x30, 0x49, 0x06, 0x02, 0x82, 0x36, 0x10, 0x27, 0x06, 0x83, 0x1D, 
+  0x10, 0x25, 0x34, 0x06, 0x02, 0x83, 0x81, 0x10, 0x11, 0x05, 0x04, 0x84, 0x53, 0x10, 0x10, 0x3F, 0x31, 0x06, 0x02, 0x84, 
+  0x12, 0x30, 0x10, 0x10, 0x49, 0x02, 0x85, 0xB0, 0x10, 0x11, 0x10, 0x10, 0x98, 0x06, 0x03, 0x80, 0x65, 0x42, 0x10, 0x8B, 
+  0xB4, 0x44, 0xB1, 0x39, 0x10, 0xDD, 0x56, 0x10, 0x10, 0xCB, 0x29, 0x5E, 0x03, 0x04, 0x87, 0x05, 0x25, 0x10, 0x10, 0x11, 
+  0x10, 0x3F, 0x81, 0x00, 0x85, 0xDE, 0x27, 0x10, 0x11, 0x10, 0xD8, 0x03, 0x05, 0x85, 0x57, 0x41, 0x36, 0x63, 0x2D, 0x3D, 
+  0x02, 0x84, 0x55, 0x80, 0x46, 0x41, 0x34, 0x03, 0x17, 0x17, 0x17, 0x17, 0x17, 0x0C, 0x83, 0x3B, 0x40, 0x04, 0x3B, 0x06, 
+  0x0B, 0x85, 0x3B, 0xA2, 0xDF, 0x62, 0x2E, 0x34, 0x05, 0x0A, 0x86, 0x49, 0x67, 0x58, 0xB6, 0xE0, 0x37, 0x42, 0x05, 0x0A, 
+  0x86, 0x4F, 0x56, 0x60, 0x49, 0x5D, 0x3F, 0x40, 0x05, 0x09, 0x83, 0x49, 0x4D, 0x30, 0xE1, 0x00, 0x82, 0x81, 0x35, 0x98, 
+  0x05, 0x09, 0x83, 0x31, 0x26, 0xB4, 0x2B, 0x00, 0x82, 0x44, 0x29, 0x50, 0x05, 0x09, 0x82, 0x3B, 0x1E, 0xE2, 0x00, 0x82, 
+  0xB0, 0xD7, 0x60, 0x06, 0x09, 0x86, 0x3B, 0x61, 0x29, 0xD8, 0x47, 0x45, 0xD8, 0x06, 0x09, 0x85, 0x49, 0x2E, 0x25, 0x10, 
+  0x10, 0x2D, 0x07, 0x0A, 0x83, 0xE3, 0x3F, 0xDA, 0xE4, 0x08, 0x09, 0x83, 0x2B, 0x5F, 0xAF, 0x34, 0x09, 0x08, 0x83, 0xA3, 
+  0x6E, 0x27, 0xDD, 0x0A, 0x07, 0x84, 0xE2, 0x37, 0x10, 0x29, 0x43, 0x0A, 0x06, 0x85, 0x52, 0x35, 0x4E, 0x10, 0x11, 0xE5, 
+  0x0A, 0x05, 0x82, 0xE1, 0x61, 0x1E, 0x00, 0x82, 0xE6, 0xDF, 0xD9, 0x0A, 0x05, 0x82, 0xDE, 0x62, 0xDE, 0x00, 0x82, 0xB0, 
+  0xB3, 0xDD, 0x0A, 0x04, 0x83, 0x49, 0xE7, 0x2A, 0xE1, 0x00, 0x82, 0x52, 0x10, 0x4F, 0x0A, 0x04, 0x83, 0x34, 0x46, 0x48, 
+  0x3B, 0x00, 0x82, 0xDA, 0x48, 0x3B, 0x0A, 0x04, 0x86, 0x49, 0x60, 0x29, 0x3B, 0x05, 0x1D, 0x5C, 0x0B, 0x04, 0x86, 0x49, 
+  0x59, 0x3F, 0x61, 0x30, 0xCB, 0x49, 0x0B, 0x05, 0x84, 0x3B, 0x05, 0xB4, 0x05, 0x3B, 0x0C, 0x06, 0x81, 0x49, 0x3B, 0x0E, 
+  0x17
 };
@@ -25,6 +25,7 @@
 #include "r_p2d.h"
 #include "r_gui.h"
 #include "r_mem.h"
+#include "r_fcnt.h"
 
 #ifdef SMART_TFT_SLAVE_MODE
 
@@ -59,7 +60,7 @@ const OpFunc_t opList[_S_NB_OP] = {
   &R_P2D_SpriteGetHeight,               //OP_P2D_SPRITE_GET_H,
   &R_SetLut,                            //OP_P2D_SET_LUT
   &R_Sprite,                            //OP_P2D_SPRITE,
-  NULL,                                 //OP_RESERVED_0X1D,
+  &R_P2D_Screenshot,                    //OP_P2D_SCREENSHOT,
   NULL,                                 //OP_RESERVED_0X1E,
   NULL,                                 //OP_RESERVED_0X1F,
   &R_GUI_GetLastAddedObject,            //OP_GUI_GET_LAST_OBJ
@@ -116,7 +117,10 @@ const OpFunc_t opList[_S_NB_OP] = {
   &R_MEM_ReadU32,                       //OP_MEM_READ_U32
   &R_MEM_ReadI32,                       //OP_MEM_READ_I32
   &R_MEM_ReadU8Arr,                     //OP_MEM_READ_U8_ARR
-  &R_MEM_ReadStr                        //OP_MEM_READ_STR
+  &R_MEM_ReadStr,                       //OP_MEM_READ_STR
+  &R_FCNT_Start,                        //OP_FCNT_START
+  &R_FCNT_Stop,                         //OP_FCNT_STOP
+  &R_FCNT_Read                          //OP_FCNT_READ
 };
 
 #endif
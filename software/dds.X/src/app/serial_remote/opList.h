@@ -57,7 +57,7 @@ enum {
   OP_P2D_SPRITE_GET_H,
   OP_P2D_SET_LUT,
   OP_P2D_SPRITE,
-  OP_RESERVED_0X1D,
+  OP_P2D_SCREENSHOT,
   OP_RESERVED_0X1E,
   OP_RESERVED_0X1F,
   OP_GUI_GET_LAST_OBJ,
@@ -115,6 +115,9 @@ enum {
   OP_MEM_READ_I32,
   OP_MEM_READ_U8_ARR,
   OP_MEM_READ_STR,
+  OP_FCNT_START,
+  OP_FCNT_STOP,
+  OP_FCNT_READ,
   _S_NB_OP
 };
 
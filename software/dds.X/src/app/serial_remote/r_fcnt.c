@@ -0,0 +1,64 @@
+/**
+ * @file r_fcnt.c
+ * @brief serialized frequency counter functions decoder (slave side)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-31
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "r_fcnt.h"
+#include "serial_common.h"
+#include "serial_remote.h"
+#include "fcnt.h"
+
+#ifdef SMART_TFT_SLAVE_MODE
+
+/* R_FCNT_Start
+ * ARG: gate(u16), in ms */
+int8_t R_FCNT_Start(void) {
+  int8_t res = -1; uint16_t gate;
+  gate = RxGetU16();
+  if(RxStatus() == 0) {
+    if(gate >= FCNT_GATE_MIN && gate <= FCNT_GATE_MAX) {
+      FCNT_Start(gate);
+      res = 0;
+    }
+    else Error("R_FCNT_Start: bad gate");
+  }
+  else Error(EXTRACT_ERROR_MSG);
+  return res;
+}
+
+/* R_FCNT_Stop
+ * ARG: none */
+int8_t R_FCNT_Stop(void) {
+  FCNT_Stop();
+  return 0;
+}
+
+/* R_FCNT_Read
+ * ARG: none
+ * RET: frequency(i32, mHz), period(u64, ns), count(u32) */
+int8_t R_FCNT_Read(void) {
+  TxMsgPut(fcntResult.frequency);
+  TxMsgPut(fcntResult.period);
+  TxMsgPut(fcntResult.count);
+  return 0;
+}
+
+#endif
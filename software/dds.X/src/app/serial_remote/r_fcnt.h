@@ -0,0 +1,33 @@
+/**
+ * @file r_fcnt.h
+ * @brief serialized frequency counter functions decoder (slave side)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-31
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _r_fcnt_h
+#define _r_fcnt_h
+
+#include "opList.h"
+
+int8_t R_FCNT_Start(void);
+int8_t R_FCNT_Stop(void);
+int8_t R_FCNT_Read(void);
+
+#endif
@@ -26,6 +26,7 @@
 #include "gui.h"
 #include "serial_common.h"
 #include "serial_remote.h"
+#include "screenshot.h"
 
 #ifdef SMART_TFT_SLAVE_MODE
 
@@ -93,12 +94,12 @@ int8_t R_P2D_P2D_SetAlpha(void) {
 }
 
 /* P2D_SetLineType
- * ARG: lineType(u8) */
+ * ARG: lineType(u8); 0: solid, else dotted */
 int8_t R_P2D_SetLineType(void) {
-  int8_t res = -1; line_t lineType;
+  int8_t res = -1; uint8_t lineType;
   lineType = RxGetU8();
   if(RxStatus() == 0) {
-    P2D_SetLineType(lineType);
+    P2D_SetLineType(lineType == 0? LINE_SOLID: LINE_DOT);
     res = 0;
   }
   return res;
@@ -354,6 +355,21 @@ int8_t R_Sprite(void) {
   return res;
 }
 
+/* Screenshot: whole screen saved in SHOTXXX.BMP, on the SD card
+ * ARG: -
+ * RET: fileNum(u16), size(u32, bytes), time(u32, us) */
+int8_t R_P2D_Screenshot(void) {
+  int8_t res = -1; shot_result_st shot;
+  if(ScreenshotSave(&shot) == 0) {
+    TxMsgPut(shot.fileNum);
+    TxMsgPut(shot.size);
+    TxMsgPut(shot.timeUs);
+    res = 0;
+  }
+  else Error("R_P2D_Screenshot: capture failed");
+  return res;
+}
+
 
 static int8_t Poly(bool bFill) {
   int8_t res = -1;
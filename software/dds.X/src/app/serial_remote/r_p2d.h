@@ -53,5 +53,6 @@ int8_t R_P2D_SpriteGetWidth(void);
 int8_t R_P2D_SpriteGetHeight(void);
 int8_t R_SetLut(void);
 int8_t R_Sprite(void);
+int8_t R_P2D_Screenshot(void);
 
 #endif
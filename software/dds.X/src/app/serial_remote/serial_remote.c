@@ -27,6 +27,7 @@
 #include "p2d.h"
 #include "gui_obj.h"
 #include "gui_w.h"
+#include "fcnt.h"
 
 
 #ifdef SMART_TFT_SLAVE_MODE
@@ -68,6 +69,9 @@ void SerialRemoteTask(void) {
   /*runtime*/
   else {
 
+    /*background process: frequency counter results (OP_FCNT_READ)*/
+    FCNT_Process();
+
     /*message from master?*/
     if(RxIsMsgReceived()) {
 
@@ -0,0 +1,265 @@
+/**
+ * @file screenshot.c
+ * @brief screen capture to the SD card, as a RGB 5:6:5 BMP file read back from the LCD GRAM
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-21
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "screenshot.h"
+#include "ILI9320.h"
+#include "salloc.h"
+#include "ticks.h"
+#include "timer.h"
+#include "touchscreen.h"
+#include "ff.h"
+
+#define SHOT_SECTOR_SIZE  512
+#define SHOT_BLOCK_SIZE   (SHOT_SECTORS * SHOT_SECTOR_SIZE)
+#define SHOT_HEADER_SIZE  66      /*file header (14) + BITMAPINFOHEADER (40) + R, G, B masks (12)*/
+
+/**
+ * Local variables
+ */
+static bool bArmed = false;
+static bool bHeld = false, bShotDone;
+static coord_t xHeld, yHeld;
+static timer_t tmHeld;
+
+/**
+ * Local functions
+ */
+static FRESULT OpenNewFile(FIL *pFile, uint16_t *pNum);
+static uint32_t PutHeader(uint8_t *p, length_t w, length_t h);
+static uint8_t *PutLe16(uint8_t *p, uint16_t val);
+static uint8_t *PutLe32(uint8_t *p, uint32_t val);
+
+
+/**
+ * @function ScreenshotSave
+ * @brief capture the whole screen into the first free SHOTXXX.BMP file, one line at a time (no frame buffer);
+ *        pixels are stored as read from the GRAM (16bpp BI_BITFIELDS BMP: pixel exact)
+ * @param shot_result_st *pRes: capture result (may be NULL)
+ * @return int8_t: 0 success, -1 error (no memory, no free file name, SD card error)
+ */
+int8_t ScreenshotSave(shot_result_st *pRes) {
+
+  int8_t res = -1;
+  FIL file;
+  FRESULT fr;
+  UINT byteWritten;
+  uint8_t *buf;
+  uint32_t fill, lineSize, size = 0, start;
+  uint16_t num = 0;
+  length_t w, h;
+  coord_t y;
+  rect_st rec;
+
+  start = TicksGetCycles();
+  w = LCD_GetWidth();
+  h = LCD_GetHeight();
+  lineSize = (uint32_t) w * sizeof(color_t);
+
+  /*staging buffer: one block + one line, so that a line is always read in place; the block is written at once*/
+  buf = salloc(SHOT_BLOCK_SIZE + lineSize);
+  if(buf != NULL) {
+
+    fr = OpenNewFile(&file, &num);
+    if(fr == FR_OK) {
+
+      fill = PutHeader(buf, w, h);
+
+      /*BMP lines are stored bottom-up; lineSize is a multiple of 4 (w even): no padding*/
+      rec.x = 0;
+      rec.w = w;
+      rec.h = 1;
+      for(y = (coord_t) h - 1; y >= 0 && fr == FR_OK; y--) {
+        rec.y = y;
+        LCD_SetWnd(&rec);
+        LCD_GetRun((color_t *) (buf + fill), w);
+        fill += lineSize;
+
+        /*full block: FatFs writes its sectors straight from buf, with a single multi-block command*/
+        if(fill >= SHOT_BLOCK_SIZE) {
+          fr = f_write(&file, buf, SHOT_BLOCK_SIZE, &byteWritten);
+          if(fr == FR_OK && byteWritten != SHOT_BLOCK_SIZE) fr = FR_DENIED;
+          fill -= SHOT_BLOCK_SIZE;
+          memmove(buf, buf + SHOT_BLOCK_SIZE, fill);
+          size += SHOT_BLOCK_SIZE;
+        }
+      }
+
+      if(fr == FR_OK && fill > 0) {
+        fr = f_write(&file, buf, fill, &byteWritten);
+        if(fr == FR_OK && byteWritten != fill) fr = FR_DENIED;
+        size += fill;
+      }
+
+      if(f_close(&file) == FR_OK && fr == FR_OK) res = 0;
+    }
+
+    LCD_SetWnd(NULL);
+    sfreeFrom(buf);
+  }
+
+  if(pRes != NULL) {
+    pRes->fileNum = num;
+    pRes->size = (res == 0) ? size : 0;
+    pRes->timeUs = TicksCyclesToUs(TicksGetCycles() - start);
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ScreenshotArm
+ * @brief arm / disarm the screenshot on a held touch (see ScreenshotTask)
+ * @param bool bArm: true -> armed
+ * @return none
+ */
+void ScreenshotArm(bool bArm) {
+  bArmed = bArm;
+  bHeld = false;
+}
+
+
+/**
+ * @function ScreenshotTask
+ * @brief if armed, save a screenshot once the touchscreen is held still for SHOT_HOLD_MS (one per touch);
+ *        shall be called cyclically, from the main loop
+ * @param none
+ * @return none
+ */
+void ScreenshotTask(void) {
+
+  coord_t x, y;
+
+  if(bArmed) {
+    if(TouchScreenIsPressed()) {
+      TouchScreenRead(&x, &y);
+
+      /*new touch, or moved: the hold time restarts*/
+      if(bHeld == false || abs(x - xHeld) > SHOT_MOVE_MAX || abs(y - yHeld) > SHOT_MOVE_MAX) {
+        xHeld = x;
+        yHeld = y;
+        tmHeld = GetTimeout(SHOT_HOLD_MS);
+        bHeld = true;
+      }
+      else if(bShotDone == false && IsTimerElapsed(tmHeld)) {
+        (void) ScreenshotSave(NULL);
+        bShotDone = true;
+      }
+    }
+    else {
+      bHeld = false;
+      bShotDone = false;
+    }
+  }
+}
+
+
+/**
+ * @function OpenNewFile
+ * @brief create the first SHOTXXX.BMP file which does not exist yet
+ * @param FIL *pFile: file
+ * @param uint16_t *pNum: XXX of the created file
+ * @return FRESULT: FR_OK if success
+ */
+static FRESULT OpenNewFile(FIL *pFile, uint16_t *pNum) {
+
+  FRESULT fr = FR_EXIST;
+  uint16_t num = 0;
+  char name[13];
+
+  while(fr == FR_EXIST && num < SHOT_FILE_MAX) {
+    sprintf(name, "SHOT%03u.BMP", (unsigned int) num);
+    fr = f_open(pFile, name, FA_CREATE_NEW | FA_WRITE);
+    if(fr == FR_EXIST) num++;
+  }
+
+  *pNum = num;
+  return fr;
+}
+
+
+/**
+ * @function PutHeader
+ * @brief write the BMP headers of a w * h, 16bpp RGB 5:6:5 image
+ * @param uint8_t *p: destination
+ * @param length_t w, h: image size, in pixels
+ * @return uint32_t: number of bytes written (SHOT_HEADER_SIZE)
+ */
+static uint32_t PutHeader(uint8_t *p, length_t w, length_t h) {
+
+  uint32_t dataSize = (uint32_t) w * h * sizeof(color_t);
+
+  /*BITMAPFILEHEADER*/
+  *p++ = 'B';
+  *p++ = 'M';
+  p = PutLe32(p, SHOT_HEADER_SIZE + dataSize);  /*file size*/
+  p = PutLe32(p, 0);                            /*reserved*/
+  p = PutLe32(p, SHOT_HEADER_SIZE);             /*offset of the pixels*/
+
+  /*BITMAPINFOHEADER; positive height: bottom-up*/
+  p = PutLe32(p, 40);
+  p = PutLe32(p, w);
+  p = PutLe32(p, h);
+  p = PutLe16(p, 1);                            /*planes*/
+  p = PutLe16(p, 16);                           /*bpp*/
+  p = PutLe32(p, 3);                            /*BI_BITFIELDS*/
+  p = PutLe32(p, dataSize);
+  p = PutLe32(p, 2835);                         /*72 dpi*/
+  p = PutLe32(p, 2835);
+  p = PutLe32(p, 0);                            /*palette*/
+  p = PutLe32(p, 0);
+
+  /*R, G, B masks*/
+  p = PutLe32(p, 0xF800);
+  p = PutLe32(p, 0x07E0);
+  (void) PutLe32(p, 0x001F);
+
+  return SHOT_HEADER_SIZE;
+}
+
+
+/**
+ * @function PutLe16
+ * @brief write a 16bit little endian value
+ * @param uint8_t *p: destination
+ * @param uint16_t val: value
+ * @return uint8_t *: next destination byte
+ */
+static uint8_t *PutLe16(uint8_t *p, uint16_t val) {
+  *p++ = (uint8_t) val;
+  *p++ = (uint8_t) (val >> 8);
+  return p;
+}
+
+
+/**
+ * @function PutLe32
+ * @brief write a 32bit little endian value
+ * @param uint8_t *p: destination
+ * @param uint32_t val: value
+ * @return uint8_t *: next destination byte
+ */
+static uint8_t *PutLe32(uint8_t *p, uint32_t val) {
+  p = PutLe16(p, (uint16_t) val);
+  return PutLe16(p, (uint16_t) (val >> 16));
+}
@@ -0,0 +1,70 @@
+/**
+ * @file screenshot.h
+ * @brief screen capture to the SD card, as a RGB 5:6:5 BMP file read back from the LCD GRAM
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-21
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _screenshot_h_
+#define _screenshot_h_
+
+#include "main.h"
+
+#define SHOT_FILE_MAX   1000    /*SHOT000.BMP to SHOT999.BMP, at the root of the SD card*/
+#define SHOT_SECTORS    8       /*file data written by blocks of 8 sectors (multi-block SD writes)*/
+#define SHOT_HOLD_MS    3000    /*armed: a touch held still during this time saves a screenshot*/
+#define SHOT_MOVE_MAX   8       /*max move of a held touch, in pixels*/
+
+/**
+ * struct shot_result_st
+ * result of the last capture
+ */
+typedef struct {
+  uint16_t fileNum;     /*XXX of SHOTXXX.BMP*/
+  uint32_t size;        /*file size, in bytes*/
+  uint32_t timeUs;      /*capture time (GRAM read + SD write), in us*/
+} shot_result_st;
+
+/**
+ * @function ScreenshotSave
+ * @brief capture the whole screen into the first free SHOTXXX.BMP file, one line at a time (no frame buffer);
+ *        pixels are stored as read from the GRAM (16bpp BI_BITFIELDS BMP: pixel exact)
+ * @param shot_result_st *pRes: capture result (may be NULL)
+ * @return int8_t: 0 success, -1 error (no memory, no free file name, SD card error)
+ */
+int8_t ScreenshotSave(shot_result_st *pRes);
+
+/**
+ * @function ScreenshotArm
+ * @brief arm / disarm the screenshot on a held touch (see ScreenshotTask)
+ * @param bool bArm: true -> armed
+ * @return none
+ */
+void ScreenshotArm(bool bArm);
+
+/**
+ * @function ScreenshotTask
+ * @brief if armed, save a screenshot once the touchscreen is held still for SHOT_HOLD_MS (one per touch);
+ *        shall be called cyclically, from the main loop
+ * @param none
+ * @return none
+ */
+void ScreenshotTask(void);
+
+#endif
@@ -32,6 +32,7 @@
 #include "usr_main.h"
 #include "serial_remote.h"
 #include "gamma.h"
+#include "screenshot.h"
 
 /**
  * Local variables
@@ -45,6 +46,7 @@ static bool bWasPressed;
  */
 static void BootTask(void);
 static void SetupMenuHandleTask(void);
+static void ScreenshotArmTask(void);
 
 
 /**
@@ -87,9 +89,9 @@ static void BootTask(void) {
  * Some defines & variables declaration for setup menu
  */
 #ifdef INCLUDE_GUI_DEMO
-  #define SETUP_ITEM_CNT 4
+  #define SETUP_ITEM_CNT 5
 #else
-  #define SETUP_ITEM_CNT 3
+  #define SETUP_ITEM_CNT 4
 #endif
 
 typedef struct {
@@ -100,7 +102,8 @@ typedef struct {
 static const setup_item_st setupItems[SETUP_ITEM_CNT] = {
   {"Exit setup", &BootTask},
   {"Touchscreen calibration", &TouchCalibTask},
-  {"Gamma adjustement", &GammaTask}
+  {"Gamma adjustement", &GammaTask},
+  {"Screenshots (hold 3s)", &ScreenshotArmTask}
   #ifdef INCLUDE_GUI_DEMO
   , {"P2D/GUI demonstration", &Gui_DemoLaunchTask}
   #endif
@@ -211,3 +214,15 @@ static void SetupMenuHandleTask(void) {
 
   bWasPressed = TouchScreenIsPressed();
 }
+
+
+/**
+ * @function ScreenshotArmTask
+ * @brief setup entry: arm the screenshots (SD card, touch held still for 3s), then exit the setup
+ * @param none
+ * @return none
+ */
+static void ScreenshotArmTask(void) {
+  ScreenshotArm(true);
+  pCurrentTask = &BootTask;
+}
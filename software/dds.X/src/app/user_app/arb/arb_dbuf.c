@@ -0,0 +1,103 @@
+/**
+ * @file arb_dbuf.c
+ * @brief double buffer of rendered samples: one block is played by the sample ISR while the other one is filled by a task
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-03
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "arb_dbuf.h"
+
+
+/**
+ * @function ARB_DbufInit
+ * @brief attach two blocks to a double buffer; both are empty, the first one will be played first
+ * @param arb_dbuf_st *db: double buffer
+ * @param uint16_t *buf1, uint16_t *buf2: blocks of len samples
+ * @param uint16_t len: block length, in samples
+ * @param void (*pOut) (uint16_t dataIn): output function, called by ARB_DbufIsr()
+ * @return none
+ */
+void ARB_DbufInit(arb_dbuf_st *db, uint16_t *buf1, uint16_t *buf2, uint16_t len, void (*pOut) (uint16_t dataIn)) {
+  db->buf[0] = buf1;
+  db->buf[1] = buf2;
+  db->len = len;
+  db->pos[0] = db->pos[1] = 0;
+  db->bEmpty[0] = db->bEmpty[1] = true;
+  db->cur = 0;
+  db->pOut = pOut;
+}
+
+
+/**
+ * @function ARB_DbufFill
+ * @brief fill the empty blocks of a double buffer; shall be called out of the sample ISR
+ * @param arb_dbuf_st *db: double buffer
+ * @param int8_t (*pFill) (uint16_t *buf, uint16_t len): fills a block; returns 0 on success, -1 otherwise
+ * @return int8_t: 0 -> ok, -1 -> a block could not be filled (it stays empty)
+ */
+int8_t ARB_DbufFill(arb_dbuf_st *db, int8_t (*pFill) (uint16_t *buf, uint16_t len)) {
+
+  int8_t res = 0;
+  uint8_t id;
+
+  for(id = 0; id < 2; id++) {
+    if(db->bEmpty[id]) {
+      if(pFill(db->buf[id], db->len) < 0) {
+        res = -1;
+      }
+      else {
+        db->pos[id] = 0;
+        db->bEmpty[id] = false;
+      }
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ARB_DbufIsr
+ * @brief sample ISR: output the next sample of the block being played; once played, the block is marked empty
+ *        and the other one is played. Nothing is output while the block to play is empty
+ * @param arb_dbuf_st *db: double buffer
+ * @return none
+ */
+void ARB_DbufIsr(arb_dbuf_st *db) {
+
+  uint8_t id = db->cur;
+
+  if(db->bEmpty[id] == false) {
+    db->pOut(db->buf[id][db->pos[id]]);
+    db->pos[id]++;
+    if(db->pos[id] >= db->len) {
+      db->cur = id ^ 1;
+      db->bEmpty[id] = true;
+    }
+  }
+}
+
+
+/**
+ * @function ARB_DbufIsReady
+ * @brief tell if the block to play is filled
+ * @param const arb_dbuf_st *db: double buffer
+ * @return bool: true if the playback can start
+ */
+bool ARB_DbufIsReady(const arb_dbuf_st *db) {
+  return db->bEmpty[db->cur] == false;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file arb_dbuf.h
+ * @brief double buffer of rendered samples: one block is played by the sample ISR while the other one is filled by a task
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-03
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _arb_dbuf_h_
+#define _arb_dbuf_h_
+
+#include "main.h"
+
+/**
+ * struct arb_dbuf_st
+ */
+typedef struct {
+  uint16_t *buf[2];
+  uint16_t len;
+  volatile uint16_t pos[2];       /*next sample to play, in each block*/
+  volatile bool bEmpty[2];        /*if true, the block shall be filled*/
+  volatile uint8_t cur;           /*block being played*/
+  void (*pOut) (uint16_t dataIn);
+} arb_dbuf_st;
+
+/**
+ * @function ARB_DbufInit
+ * @brief attach two blocks to a double buffer; both are empty, the first one will be played first
+ * @param arb_dbuf_st *db: double buffer
+ * @param uint16_t *buf1, uint16_t *buf2: blocks of len samples
+ * @param uint16_t len: block length, in samples
+ * @param void (*pOut) (uint16_t dataIn): output function, called by ARB_DbufIsr()
+ * @return none
+ */
+void ARB_DbufInit(arb_dbuf_st *db, uint16_t *buf1, uint16_t *buf2, uint16_t len, void (*pOut) (uint16_t dataIn));
+
+/**
+ * @function ARB_DbufFill
+ * @brief fill the empty blocks of a double buffer; shall be called out of the sample ISR
+ * @param arb_dbuf_st *db: double buffer
+ * @param int8_t (*pFill) (uint16_t *buf, uint16_t len): fills a block; returns 0 on success, -1 otherwise
+ * @return int8_t: 0 -> ok, -1 -> a block could not be filled (it stays empty)
+ */
+int8_t ARB_DbufFill(arb_dbuf_st *db, int8_t (*pFill) (uint16_t *buf, uint16_t len));
+
+/**
+ * @function ARB_DbufIsr
+ * @brief sample ISR: output the next sample of the block being played; once played, the block is marked empty
+ *        and the other one is played. Nothing is output while the block to play is empty
+ * @param arb_dbuf_st *db: double buffer
+ * @return none
+ */
+void ARB_DbufIsr(arb_dbuf_st *db);
+
+/**
+ * @function ARB_DbufIsReady
+ * @brief tell if the block to play is filled
+ * @param const arb_dbuf_st *db: double buffer
+ * @return bool: true if the playback can start
+ */
+bool ARB_DbufIsReady(const arb_dbuf_st *db);
+
+#endif
@@ -0,0 +1,159 @@
+/**
+ * @file arb_dither.c
+ * @brief TPDF dither & error-feedback noise shaping, applied on rendered sample blocks
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-10
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "arb_dither.h"
+
+
+/**
+ * local variables
+ */
+static uint8_t outShift[] = {5, 0, 6, 6};        /*LSBs dropped by OutputOnDdsDac, -DdsFreq, -Vpp, -Vo*/
+static arb_dither_e outMode[] = {DITHER_OFF, DITHER_OFF, DITHER_OFF, DITHER_OFF};
+static arb_out_e currentOut = OUTPUT_ON_DDS_DAC;
+static int32_t err1, err2;                      /*quantization error history*/
+static uint32_t seed = 0x12345678;
+
+
+/**
+ * local functions
+ */
+static int32_t Tpdf(uint8_t shift);
+
+
+/**
+ * @function ARB_DitherSetMode
+ * @brief select the quantization mode of an output target
+ * @param arb_out_e out: output target
+ * @param arb_dither_e mode: see arb_dither_e enum
+ * @return none
+ */
+void ARB_DitherSetMode(arb_out_e out, arb_dither_e mode) {
+  if(out <= OUTPUT_ON_VO && mode < _DITHER_COUNT) {
+    outMode[out] = mode;
+    err1 = err2 = 0;
+  }
+}
+
+
+/**
+ * @function ARB_DitherGetMode
+ * @brief return the quantization mode of an output target
+ * @param arb_out_e out: output target
+ * @return arb_dither_e: mode
+ */
+arb_dither_e ARB_DitherGetMode(arb_out_e out) {
+  return out <= OUTPUT_ON_VO ? outMode[out] : DITHER_OFF;
+}
+
+
+/**
+ * @function ARB_DitherSetResolution
+ * @brief set the number of distinct words an output target produces over the sample range [0; 0xFFFF]
+ *        (e.g. when it is scaled to a min / max); the output LSB is the largest power of 2 not above 0x10000 / codes
+ * @param arb_out_e out: output target
+ * @param uint32_t codes: distinct output words
+ * @return none
+ */
+void ARB_DitherSetResolution(arb_out_e out, uint32_t codes) {
+
+  uint8_t shift = 0;
+
+  if(out <= OUTPUT_ON_VO) {
+    while(shift < 15 && (0x10000ul >> (shift + 1)) >= codes) shift++;
+    outShift[out] = shift;
+    err1 = err2 = 0;
+  }
+}
+
+
+/**
+ * @function ARB_DitherSetOutput
+ * @brief select the output target used by ARB_DitherBlock(); clears the error history
+ * @param arb_out_e out: output target
+ * @return none
+ */
+void ARB_DitherSetOutput(arb_out_e out) {
+  if(out <= OUTPUT_ON_VO) currentOut = out;
+  err1 = err2 = 0;
+}
+
+
+/**
+ * @function ARB_DitherBlock
+ * @brief quantize a block to the word width of the current output target
+ *        the LSBs which are dropped by the output function are cleared, so the ISR stays untouched
+ * @param uint16_t *buf: samples; converted from signed to offset binary (0x8000 = 0) if bSigned
+ * @param uint16_t len: number of samples
+ * @param bool bSigned: true if buf holds int16_t samples
+ * @return none
+ */
+void ARB_DitherBlock(uint16_t *buf, uint16_t len, bool bSigned) {
+
+  uint16_t ii;
+  uint8_t shift = outShift[currentOut];
+  arb_dither_e mode = outMode[currentOut];
+  int32_t x, v, d, q, qMax = 0x10000 - (1 << shift);
+
+  /*no quantization: only convert signed samples*/
+  if(shift == 0) {
+    if(bSigned) {
+      for(ii = 0; ii < len; ii++) buf[ii] ^= 0x8000;
+    }
+  }
+  else {
+    for(ii = 0; ii < len; ii++) {
+
+      x = bSigned ? (int32_t)(int16_t)buf[ii] + 0x8000 : buf[ii];
+
+      /*error feedback: v = x - H(z).e*/
+      if(mode == DITHER_TPDF_NS1) v = x - err1;
+      else if(mode == DITHER_TPDF_NS2) v = x - 2 * err1 + err2;
+      else v = x;
+
+      /*dither (if any), then round to the output LSB*/
+      d = (mode == DITHER_OFF) ? 0 : Tpdf(shift);
+      q = ((v + d + (1 << (shift - 1))) >> shift) << shift;
+      err2 = err1;
+      err1 = q - v;
+
+      /*clip the output only: the error stays bounded, so does the loop*/
+      if(q < 0) q = 0;
+      else if(q > qMax) q = qMax;
+      buf[ii] = (uint16_t) q;
+    }
+  }
+}
+
+
+/**
+ * @function Tpdf
+ * @brief triangular PDF noise: sum of 2 uniform draws, +/-1 output LSB
+ * @param uint8_t shift: output LSB = 1 << shift
+ * @return int32_t: noise
+ */
+static int32_t Tpdf(uint8_t shift) {
+  int32_t r;
+  seed = seed * 1664525ul + 1013904223ul;
+  r = seed >> 16;
+  seed = seed * 1664525ul + 1013904223ul;
+  r += seed >> 16;
+  return (r - 0xFFFF) >> (16 - shift);
+}
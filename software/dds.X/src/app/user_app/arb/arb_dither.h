@@ -0,0 +1,82 @@
+/**
+ * @file arb_dither.h
+ * @brief TPDF dither & error-feedback noise shaping, applied on rendered sample blocks
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-10
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _arb_dither_h_
+#define _arb_dither_h_
+
+#include "arb_process.h"
+
+/*quantization mode*/
+typedef enum {
+  DITHER_OFF,         /*plain rounding to the output LSB*/
+  DITHER_TPDF,        /*triangular dither, +/-1 LSB*/
+  DITHER_TPDF_NS1,    /*TPDF + 1st order error feedback, NTF = 1 - z^-1*/
+  DITHER_TPDF_NS2,    /*TPDF + 2nd order error feedback, NTF = (1 - z^-1)^2*/
+  _DITHER_COUNT
+} arb_dither_e;
+
+/**
+ * @function ARB_DitherSetMode
+ * @brief select the quantization mode of an output target
+ * @param arb_out_e out: output target
+ * @param arb_dither_e mode: see arb_dither_e enum
+ * @return none
+ */
+void ARB_DitherSetMode(arb_out_e out, arb_dither_e mode);
+
+/**
+ * @function ARB_DitherGetMode
+ * @brief return the quantization mode of an output target
+ * @param arb_out_e out: output target
+ * @return arb_dither_e: mode
+ */
+arb_dither_e ARB_DitherGetMode(arb_out_e out);
+
+/**
+ * @function ARB_DitherSetResolution
+ * @brief set the number of distinct words an output target produces over the sample range [0; 0xFFFF]
+ *        (e.g. when it is scaled to a min / max); the output LSB is the largest power of 2 not above 0x10000 / codes
+ * @param arb_out_e out: output target
+ * @param uint32_t codes: distinct output words
+ * @return none
+ */
+void ARB_DitherSetResolution(arb_out_e out, uint32_t codes);
+
+/**
+ * @function ARB_DitherSetOutput
+ * @brief select the output target used by ARB_DitherBlock(); clears the error history
+ * @param arb_out_e out: output target
+ * @return none
+ */
+void ARB_DitherSetOutput(arb_out_e out);
+
+/**
+ * @function ARB_DitherBlock
+ * @brief quantize a block to the word width of the current output target
+ *        the LSBs which are dropped by the output function are cleared, so the ISR stays untouched
+ * @param uint16_t *buf: samples; converted from signed to offset binary (0x8000 = 0) if bSigned
+ * @param uint16_t len: number of samples
+ * @param bool bSigned: true if buf holds int16_t samples
+ * @return none
+ */
+void ARB_DitherBlock(uint16_t *buf, uint16_t len, bool bSigned);
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file arb_fft.c
+ * @brief fixed-point (Q15) radix-2 FFT / IFFT, computed incrementally
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include "arb_fft.h"
+#include "ticks.h"
+
+#define PI 3.14159265f
+
+
+/**
+ * local variables
+ */
+static int16_t quarterSine[FFT_SIZE_MAX / 4 + 1];  /*sin(2.pi.i / FFT_SIZE_MAX), i E [0; N/4]*/
+
+
+/**
+ * local functions
+ */
+static void Twiddle(uint16_t t, int16_t *pCos, int16_t *pSin);
+
+
+/**
+ * @function FFT_Init
+ * @brief build the twiddle table; shall be called once
+ * @param none
+ * @return none
+ */
+void FFT_Init(void) {
+  uint16_t ii;
+  for(ii = 0; ii <= FFT_SIZE_MAX / 4; ii++) {
+    quarterSine[ii] = (int16_t) (32767.0f * sin(2 * PI * ii / FFT_SIZE_MAX) + 0.5f);
+  }
+}
+
+
+/**
+ * @function FFT_Start
+ * @brief prepare a transform (bit-reversal permutation)
+ * @param fft_st *fft: transform handler
+ * @param int16_t *re, *im: samples, Q15; N = 1 << log2n
+ * @param uint8_t log2n: transform size, from 1 to FFT_LOG2_MAX
+ * @param bool bInverse: inverse transform if true
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t FFT_Start(fft_st *fft, int16_t *re, int16_t *im, uint8_t log2n, bool bInverse) {
+
+  int8_t res = -1;
+  uint16_t ii, jj, bit, n;
+  int16_t tmp;
+
+  if(fft != NULL && re != NULL && im != NULL && log2n > 0 && log2n <= FFT_LOG2_MAX) {
+
+    fft->re = re;
+    fft->im = im;
+    fft->log2n = log2n;
+    fft->bInverse = bInverse;
+    fft->bDone = false;
+    fft->span = 1;
+    fft->k = 0;
+    fft->cycles = 0;
+
+    /*bit-reversal permutation, jj = reverse(ii)*/
+    n = 1 << log2n;
+    for(ii = 1, jj = 0; ii < n; ii++) {
+      for(bit = n >> 1; jj & bit; bit >>= 1) jj ^= bit;
+      jj ^= bit;
+      if(ii < jj) {
+        tmp = re[ii]; re[ii] = re[jj]; re[jj] = tmp;
+        tmp = im[ii]; im[ii] = im[jj]; im[jj] = tmp;
+      }
+    }
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function FFT_Process
+ * @brief compute some butterflies of the transform
+ * @param fft_st *fft: transform handler
+ * @param uint16_t budget: max number of butterflies computed by this call
+ * @return bool: true if the transform is finished
+ */
+bool FFT_Process(fft_st *fft, uint16_t budget) {
+
+  uint16_t n, j, p, q;
+  int16_t wr, wi;
+  int32_t tr, ti, ar, ai;
+  uint32_t t0;
+  bool bDone = true;
+
+  if(fft != NULL) {
+
+    t0 = TicksGetCycles();
+    n = 1 << fft->log2n;
+
+    while(fft->bDone == false && budget > 0) {
+
+      /*butterfly #k of the stage: j-th of its group; twiddle = W(j / 2.span)*/
+      j = fft->k & (fft->span - 1);
+      p = ((fft->k - j) << 1) + j;
+      q = p + fft->span;
+      Twiddle((uint16_t)(j * (FFT_SIZE_MAX / (fft->span << 1))), &wr, &wi);
+      if(fft->bInverse == false) wi = -wi;
+
+      /*rounded products: a floor bias would pile up through the unscaled inverse stages*/
+      tr = ((int32_t)fft->re[q] * wr - (int32_t)fft->im[q] * wi + 0x4000) >> 15;
+      ti = ((int32_t)fft->re[q] * wi + (int32_t)fft->im[q] * wr + 0x4000) >> 15;
+      ar = fft->re[p];
+      ai = fft->im[p];
+
+      /*forward: 1/2 at each stage (no overflow); inverse: caller keeps sum(|X|) <= 1*/
+      if(fft->bInverse) {
+        fft->re[p] = (int16_t) (ar + tr); fft->im[p] = (int16_t) (ai + ti);
+        fft->re[q] = (int16_t) (ar - tr); fft->im[q] = (int16_t) (ai - ti);
+      }
+      else {
+        fft->re[p] = (int16_t) ((ar + tr + 1) >> 1); fft->im[p] = (int16_t) ((ai + ti + 1) >> 1);
+        fft->re[q] = (int16_t) ((ar - tr + 1) >> 1); fft->im[q] = (int16_t) ((ai - ti + 1) >> 1);
+      }
+
+      /*next butterfly; next stage every N/2 butterflies*/
+      fft->k++;
+      if(fft->k >= (n >> 1)) {
+        fft->k = 0;
+        fft->span <<= 1;
+        if(fft->span >= n) fft->bDone = true;
+      }
+      budget--;
+    }
+
+    fft->cycles += TicksGetCycles() - t0;
+    bDone = fft->bDone;
+  }
+
+  return bDone;
+}
+
+
+/**
+ * @function Twiddle
+ * @brief cos & sin of 2.pi.t / FFT_SIZE_MAX, from the quarter-wave table
+ * @param uint16_t t: angle, E [0; FFT_SIZE_MAX / 2[
+ * @param int16_t *pCos, *pSin: cos & sin, Q15
+ * @return none
+ */
+static void Twiddle(uint16_t t, int16_t *pCos, int16_t *pSin) {
+  if(t <= FFT_SIZE_MAX / 4) {
+    *pSin = quarterSine[t];
+    *pCos = quarterSine[FFT_SIZE_MAX / 4 - t];
+  }
+  else {
+    *pSin = quarterSine[FFT_SIZE_MAX / 2 - t];
+    *pCos = -quarterSine[t - FFT_SIZE_MAX / 4];
+  }
+}
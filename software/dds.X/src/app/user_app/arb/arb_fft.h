@@ -0,0 +1,72 @@
+/**
+ * @file arb_fft.h
+ * @brief fixed-point (Q15) radix-2 FFT / IFFT, computed incrementally
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _arb_fft_h_
+#define _arb_fft_h_
+
+#include "main.h"
+
+#define FFT_LOG2_MAX    9                   /*largest transform: 512 points*/
+#define FFT_SIZE_MAX    (1 << FFT_LOG2_MAX)
+
+/**
+ * struct fft_st
+ * transform in progress; re & im are provided by the caller, transformed in place
+ */
+typedef struct {
+  int16_t *re, *im;
+  uint8_t log2n;
+  bool bInverse;      /*inverse: X[k].e^(+j..), not scaled; forward: X[k].e^(-j..), scaled by 1/N*/
+  bool bDone;
+  uint16_t span;      /*current stage: butterfly span*/
+  uint16_t k;         /*next butterfly of the current stage*/
+  uint32_t cycles;    /*core timer cycles spent in FFT_Process()*/
+} fft_st;
+
+/**
+ * @function FFT_Init
+ * @brief build the twiddle table; shall be called once
+ * @param none
+ * @return none
+ */
+void FFT_Init(void);
+
+/**
+ * @function FFT_Start
+ * @brief prepare a transform (bit-reversal permutation)
+ * @param fft_st *fft: transform handler
+ * @param int16_t *re, *im: samples, Q15; N = 1 << log2n
+ * @param uint8_t log2n: transform size, from 1 to FFT_LOG2_MAX
+ * @param bool bInverse: inverse transform if true
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t FFT_Start(fft_st *fft, int16_t *re, int16_t *im, uint8_t log2n, bool bInverse);
+
+/**
+ * @function FFT_Process
+ * @brief compute some butterflies of the transform
+ * @param fft_st *fft: transform handler
+ * @param uint16_t budget: max number of butterflies computed by this call
+ * @return bool: true if the transform is finished
+ */
+bool FFT_Process(fft_st *fft, uint16_t budget);
+
+#endif
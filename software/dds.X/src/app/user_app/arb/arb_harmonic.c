@@ -0,0 +1,357 @@
+/**
+ * @file arb_harmonic.c
+ * @brief additive (harmonic) waveform synthesis through the IFFT, spectrum of the current table through the FFT
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "arb_harmonic.h"
+#include "arb_fft.h"
+#include "p2d.h"
+#include "ticks.h"
+
+#define PI        3.14159265f
+#define FFT_N     (1 << ARB_HARMONIC_LOG2)
+
+/*jobs*/
+typedef enum {
+  JOB_NONE,
+  JOB_SYNTH,
+  JOB_SPECTRUM
+} job_e;
+
+
+/**
+ * local variables
+ */
+static int16_t re[FFT_N], im[FFT_N];
+static int16_t amplitude[ARB_HARMONIC_COUNT + 1];  /*#0 unused*/
+static int16_t phase[ARB_HARMONIC_COUNT + 1];
+static int16_t levelDb[ARB_HARMONIC_COUNT + 1];
+static fft_st fft;
+static job_e job = JOB_NONE;
+static arb_st *pArb = NULL;
+static uint16_t transformTime;
+
+
+/**
+ * local functions
+ */
+static float LinearDroop(uint8_t h, uint16_t n);
+static void SynthEnd(void);
+static void SpectrumEnd(void);
+static uint32_t Sqrt32(uint32_t val);
+
+
+/**
+ * @function ARB_HarmonicInit
+ * @brief init the transform & the harmonic set (fundamental only)
+ * @param none
+ * @return none
+ */
+void ARB_HarmonicInit(void) {
+  uint8_t h;
+  FFT_Init();
+  memset(amplitude, 0, sizeof(amplitude));
+  memset(phase, 0, sizeof(phase));
+  for(h = 0; h <= ARB_HARMONIC_COUNT; h++) levelDb[h] = ARB_HARMONIC_DB_MIN;
+  amplitude[1] = ARB_HARMONIC_AMP_MAX;
+  job = JOB_NONE;
+}
+
+
+/**
+ * @function ARB_HarmonicSet
+ * @brief set amplitude & phase of a harmonic
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @param int32_t amp: amplitude, from 0 to ARB_HARMONIC_AMP_MAX (0.1%)
+ * @param int32_t ph: phase, in degree (sine reference)
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t ARB_HarmonicSet(uint8_t h, int32_t amp, int32_t ph) {
+
+  int8_t res = -1;
+
+  if(h >= 1 && h <= ARB_HARMONIC_COUNT && amp >= 0 && amp <= ARB_HARMONIC_AMP_MAX) {
+    ph %= 360;
+    if(ph < 0) ph += 360;
+    amplitude[h] = (int16_t) amp;
+    phase[h] = (int16_t) ph;
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ARB_HarmonicGet
+ * @brief get amplitude & phase of a harmonic
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @param int32_t *amp: amplitude, from 0 to ARB_HARMONIC_AMP_MAX (0.1%)
+ * @param int32_t *ph: phase, in degree
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t ARB_HarmonicGet(uint8_t h, int32_t *amp, int32_t *ph) {
+
+  int8_t res = -1;
+
+  if(h >= 1 && h <= ARB_HARMONIC_COUNT) {
+    if(amp != NULL) *amp = amplitude[h];
+    if(ph != NULL) *ph = phase[h];
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ARB_HarmonicSynthStart
+ * @brief start the synthesis of the wavetable; the job runs through ARB_HarmonicTask()
+ * @param arb_st *arb: pointer to the arbitrary waveform handler
+ * @return int8_t: 0 -> ok, -1 -> error (no harmonic set)
+ */
+int8_t ARB_HarmonicSynthStart(arb_st *arb) {
+
+  int8_t res = -1;
+  uint8_t h;
+  float weight[ARB_HARMONIC_COUNT + 1], sum = 0, mag;
+
+  if(arb != NULL) {
+
+    /*pre-emphasis: the 512 -> 201 linear resampling attenuates harmonic h by sinc^2(h/N)*/
+    for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+      weight[h] = amplitude[h] / LinearDroop(h, FFT_N);
+      sum += weight[h];
+    }
+
+    if(sum > 0) {
+
+      /*sum(|X[k]|) <= 1 -> the unscaled IFFT cannot overflow*/
+      memset(re, 0, sizeof(re));
+      memset(im, 0, sizeof(im));
+      for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+
+        /*A.sin(wt + phi) = A.cos(wt + phi - 90): X[h] = A/2.(sin(phi), -cos(phi)), X[N-h] = conj(X[h])*/
+        mag = 32000.0f * weight[h] / (2 * sum);
+        re[h] = (int16_t) ((mag * P2D_Sin(phase[h])) / P2D_G_DIV);
+        im[h] = (int16_t) (-(mag * P2D_Cos(phase[h])) / P2D_G_DIV);
+        re[FFT_N - h] = re[h];
+        im[FFT_N - h] = -im[h];
+      }
+
+      FFT_Start(&fft, re, im, ARB_HARMONIC_LOG2, true);
+      pArb = arb;
+      job = JOB_SYNTH;
+      res = 0;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ARB_SpectrumStart
+ * @brief start the spectrum analysis of the wavetable; the job runs through ARB_HarmonicTask()
+ * @param const arb_st *arb: pointer to the arbitrary waveform handler
+ * @return int8_t: 0 -> ok, -1 -> error
+ */
+int8_t ARB_SpectrumStart(const arb_st *arb) {
+
+  int8_t res = -1;
+  uint16_t n, idx, next;
+  uint32_t pos, frac;
+  int32_t a, b;
+
+  if(arb != NULL) {
+
+    /*201 -> 512 points, linear interpolation over one period; samples to Q15*/
+    for(n = 0; n < FFT_N; n++) {
+      pos = (uint32_t)n * ARB_WAVEFORM_DEPTH;
+      idx = pos / FFT_N;
+      frac = ((pos % FFT_N) << 16) / FFT_N;
+      next = (idx + 1 < ARB_WAVEFORM_DEPTH) ? idx + 1 : 0;
+      a = ((int32_t)arb->waveform[idx] - 128) << 8;
+      b = ((int32_t)arb->waveform[next] - 128) << 8;
+      re[n] = (int16_t) (a + (((b - a) * (int32_t)frac) >> 16));
+      im[n] = 0;
+    }
+
+    FFT_Start(&fft, re, im, ARB_HARMONIC_LOG2, false);
+    job = JOB_SPECTRUM;
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function ARB_HarmonicTask
+ * @brief run a slice of the current job; shall be called cyclically (UserTask()), whatever the page displayed
+ * @param uint16_t budget: max number of butterflies computed by this call
+ * @return bool: true when a job has just been finished
+ */
+bool ARB_HarmonicTask(uint16_t budget) {
+
+  bool bFinished = false;
+
+  if(job != JOB_NONE && FFT_Process(&fft, budget)) {
+    transformTime = (uint16_t) TicksCyclesToUs(fft.cycles);
+    if(job == JOB_SYNTH) SynthEnd();
+    else SpectrumEnd();
+    job = JOB_NONE;
+    bFinished = true;
+  }
+
+  return bFinished;
+}
+
+
+/**
+ * @function ARB_HarmonicIsBusy
+ * @brief check if a job is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool ARB_HarmonicIsBusy(void) {
+  return job != JOB_NONE;
+}
+
+
+/**
+ * @function ARB_SpectrumGetDb
+ * @brief level of a harmonic in the last analysed table, relative to the strongest one
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @return int16_t: level, in dB x 10 (ARB_HARMONIC_DB_MIN if unknown)
+ */
+int16_t ARB_SpectrumGetDb(uint8_t h) {
+  return (h >= 1 && h <= ARB_HARMONIC_COUNT) ? levelDb[h] : ARB_HARMONIC_DB_MIN;
+}
+
+
+/**
+ * @function ARB_HarmonicGetTransformTime
+ * @brief computation time of the last transform (butterflies only, not the slicing)
+ * @param none
+ * @return uint16_t: time, in us
+ */
+uint16_t ARB_HarmonicGetTransformTime(void) {
+  return transformTime;
+}
+
+
+/**
+ * @function LinearDroop
+ * @brief response of a linear interpolation of a n-points table, for harmonic h: sinc^2(h/n)
+ * @param uint8_t h: harmonic
+ * @param uint16_t n: table size
+ * @return float: gain
+ */
+static float LinearDroop(uint8_t h, uint16_t n) {
+  float x = PI * h / n;
+  return (sin(x) / x) * (sin(x) / x);
+}
+
+
+/**
+ * @function SynthEnd
+ * @brief IFFT done: resample the 512 points to the wavetable, normalized to full scale around 128
+ * @param none
+ * @return none
+ */
+static void SynthEnd(void) {
+
+  uint16_t ii, idx, next;
+  uint32_t pos, frac;
+  int32_t a, b, peak = 1;
+
+  /*512 -> 201 points; im[] is reused as temp buffer (IFFT imaginary part is ~0)*/
+  for(ii = 0; ii < ARB_WAVEFORM_DEPTH; ii++) {
+    pos = (uint32_t)ii * FFT_N;
+    idx = pos / ARB_WAVEFORM_DEPTH;
+    frac = ((pos % ARB_WAVEFORM_DEPTH) << 16) / ARB_WAVEFORM_DEPTH;
+    next = (idx + 1) & (FFT_N - 1);
+    a = re[idx];
+    b = re[next];
+    im[ii] = (int16_t) (a + (((b - a) * (int32_t)frac) >> 16));
+    if(P2D_Abs(im[ii]) > peak) peak = P2D_Abs(im[ii]);
+  }
+
+  for(ii = 0; ii < ARB_WAVEFORM_DEPTH; ii++) {
+    pArb->waveform[ii] = (uint8_t) (128 + ((int32_t)im[ii] * 127) / peak);
+  }
+}
+
+
+/**
+ * @function SpectrumEnd
+ * @brief FFT done: harmonic levels in dB, relative to the strongest one
+ * @param none
+ * @return none
+ */
+static void SpectrumEnd(void) {
+
+  uint8_t h;
+  uint32_t mag[ARB_HARMONIC_COUNT + 1], magMax = 0;
+  float f;
+
+  /*|X[h]|, corrected from the 201 -> 512 linear interpolation*/
+  for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+    mag[h] = Sqrt32((int32_t)re[h] * re[h] + (int32_t)im[h] * im[h]);
+    mag[h] = (uint32_t) (mag[h] / LinearDroop(h, ARB_WAVEFORM_DEPTH));
+    if(mag[h] > magMax) magMax = mag[h];
+  }
+
+  for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+    levelDb[h] = ARB_HARMONIC_DB_MIN;
+    if(mag[h] > 0 && magMax > 0) {
+      f = 200.0f * log10((float)mag[h] / magMax);
+      if(f > ARB_HARMONIC_DB_MIN) levelDb[h] = (int16_t) f;
+    }
+  }
+}
+
+
+/**
+ * @function Sqrt32
+ * @brief integer square root
+ * @param uint32_t val: value
+ * @return uint32_t: floor(sqrt(val))
+ */
+static uint32_t Sqrt32(uint32_t val) {
+
+  uint32_t res = 0, bit = 1ul << 30;
+
+  while(bit > val) bit >>= 2;
+  while(bit != 0) {
+    if(val >= res + bit) {
+      val -= res + bit;
+      res = (res >> 1) + bit;
+    }
+    else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return res;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file arb_harmonic.h
+ * @brief additive (harmonic) waveform synthesis through the IFFT, spectrum of the current table through the FFT
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _arb_harmonic_h_
+#define _arb_harmonic_h_
+
+#include "arb_process.h"
+
+#define ARB_HARMONIC_COUNT    32      /*harmonics 1 to ARB_HARMONIC_COUNT*/
+#define ARB_HARMONIC_LOG2     9       /*transform size: 512 points*/
+#define ARB_HARMONIC_AMP_MAX  1000    /*amplitude, in 0.1%*/
+#define ARB_HARMONIC_DB_MIN   (-999)  /*spectrum floor, in dB x 10*/
+#define ARB_HARMONIC_BUDGET   64      /*butterflies per software cycle*/
+
+/**
+ * @function ARB_HarmonicInit
+ * @brief init the transform & the harmonic set (fundamental only)
+ * @param none
+ * @return none
+ */
+void ARB_HarmonicInit(void);
+
+/**
+ * @function ARB_HarmonicSet
+ * @brief set amplitude & phase of a harmonic
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @param int32_t amp: amplitude, from 0 to ARB_HARMONIC_AMP_MAX (0.1%)
+ * @param int32_t ph: phase, in degree (sine reference)
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t ARB_HarmonicSet(uint8_t h, int32_t amp, int32_t ph);
+
+/**
+ * @function ARB_HarmonicGet
+ * @brief get amplitude & phase of a harmonic
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @param int32_t *amp: amplitude, from 0 to ARB_HARMONIC_AMP_MAX (0.1%)
+ * @param int32_t *ph: phase, in degree
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t ARB_HarmonicGet(uint8_t h, int32_t *amp, int32_t *ph);
+
+/**
+ * @function ARB_HarmonicSynthStart
+ * @brief start the synthesis of the wavetable; the job runs through ARB_HarmonicTask()
+ * @param arb_st *arb: pointer to the arbitrary waveform handler
+ * @return int8_t: 0 -> ok, -1 -> error (no harmonic set)
+ */
+int8_t ARB_HarmonicSynthStart(arb_st *arb);
+
+/**
+ * @function ARB_SpectrumStart
+ * @brief start the spectrum analysis of the wavetable; the job runs through ARB_HarmonicTask()
+ * @param const arb_st *arb: pointer to the arbitrary waveform handler
+ * @return int8_t: 0 -> ok, -1 -> error
+ */
+int8_t ARB_SpectrumStart(const arb_st *arb);
+
+/**
+ * @function ARB_HarmonicTask
+ * @brief run a slice of the current job; shall be called cyclically (UserTask()), whatever the page displayed
+ * @param uint16_t budget: max number of butterflies computed by this call
+ * @return bool: true when a job has just been finished
+ */
+bool ARB_HarmonicTask(uint16_t budget);
+
+/**
+ * @function ARB_HarmonicIsBusy
+ * @brief check if a job is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool ARB_HarmonicIsBusy(void);
+
+/**
+ * @function ARB_SpectrumGetDb
+ * @brief level of a harmonic in the last analysed table, relative to the strongest one
+ * @param uint8_t h: harmonic, from 1 to ARB_HARMONIC_COUNT
+ * @return int16_t: level, in dB x 10 (ARB_HARMONIC_DB_MIN if unknown)
+ */
+int16_t ARB_SpectrumGetDb(uint8_t h);
+
+/**
+ * @function ARB_HarmonicGetTransformTime
+ * @brief computation time of the last transform (butterflies only, not the slicing)
+ * @param none
+ * @return uint16_t: time, in us
+ */
+uint16_t ARB_HarmonicGetTransformTime(void);
+
+#endif
@@ -0,0 +1,265 @@
+/**
+ * @file arb_harmonic_page.c
+ * @brief harmonic editor page (additive synthesis & spectrum of the current table)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gui_common.h"
+#include "arb_page.h"
+#include "arb_harmonic.h"
+#include "arb_harmonic_page.h"
+
+#define GRAPH_WIDTH     ARB_WAVEFORM_DEPTH
+#define GRAPH_HEIGHT    121
+#define SPEC_DB_RANGE   600     /*spectrum view: 0dB to -60dB*/
+#define SPEC_BAR_STEP   6       /*spectrum view: 1 bar every 6px*/
+
+
+/*widgets signals*/
+enum {
+  SIG_RVAL_HARMONIC = 1,
+  SIG_RVAL_AMP,
+  SIG_RVAL_PHASE,
+  SIG_BTN_SYNTH,
+  SIG_BTN_SPECTRUM,
+  SIG_BTN_BACK
+};
+
+
+/**
+ * local variables
+ */
+static arb_st *pArb = NULL;
+static g_obj_st *pHarmVal, *pAmpVal, *pPhaseVal, *pObjGraph;
+static int32_t harmonic = 1, amp, phase;
+static int32_t harmonicOld = -1, ampOld, phaseOld;
+static uint16_t fftTime;
+static uint8_t specView[GRAPH_WIDTH];
+static bool bSpectrum = false;
+static bool bJobPending = false;      /*a transform started by the page is running (see UserTask())*/
+static int8_t var8;
+
+
+/**
+ * local functions
+ */
+static void ARB_HarmonicPageHandler(signal_t sig);
+static void UpdateSpectrumView(void);
+static void LockValueBox(void);
+
+
+/**
+ * @function ARB_HarmonicPageSetArb
+ * @brief select the arbitrary waveform handler edited by the page; shall be called before opening the page
+ * @param arb_st *arb: pointer to the arbitrary waveform handler
+ * @return none
+ */
+void ARB_HarmonicPageSetArb(arb_st *arb) {
+  pArb = arb;
+}
+
+
+/**
+ * @function ARB_HarmonicPage
+ * @brief harmonic editor page
+ * @param signal_t sig: unused
+ * @return none
+ */
+void ARB_HarmonicPage(signal_t sig) {
+
+  rect_st rec;
+
+  /*background*/
+  GUI_ClearAll();
+  DrawBackground();
+
+  /*harmonic #id, amplitude & phase value boxes*/
+  SetFont(G_FONT_DEFAULT);
+  rec = GUI_Rect(8, 160, 113, 32);
+  pHarmVal = GUI_W_RotaryValueAdd(&rec, &harmonic, &var8, "H", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_HARMONIC);
+  GUI_W_RotaryValueSetMinMax(NULL, 1, ARB_HARMONIC_COUNT);
+
+  rec = GUI_Rect(8, 195, 113, 32);
+  pAmpVal = GUI_W_RotaryValueAdd(&rec, &amp, &var8, "%", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_AMP);
+  GUI_W_RotaryValueSetDotPos(NULL, 1);
+  GUI_W_RotaryValueSetMinMax(NULL, 0, ARB_HARMONIC_AMP_MAX);
+
+  rec = GUI_Rect(8, 230, 113, 32);
+  pPhaseVal = GUI_W_RotaryValueAdd(&rec, &phase, &var8, "deg", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_PHASE);
+  GUI_W_RotaryValueSetMinMax(NULL, 0, 359);
+
+  LockValueBox();
+
+  /*synthesis / spectrum buttons, transform time*/
+  rec = GUI_Rect(8, 270, 41, 41);
+  GUI_W_ButtonAdd(&rec, "SYN", 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BTN_SYNTH);
+
+  rec.x += rec.w + 4;
+  GUI_W_ButtonAdd(&rec, "FFT", 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BTN_SPECTRUM);
+
+  rec.x += rec.w + 4; rec.w = 88;
+  GUI_W_ValueBoxAdd(&rec, &fftTime, BOX_T_UINT16, "%u us");
+
+  /*back to the ARB page*/
+  rec = GUI_Rect(188, 270, 41, 41);
+  GUI_W_RadioImgAdd(&rec, G_DDS_BACK0, NULL, 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BTN_BACK);
+
+  /*main rotary button*/
+  rec = GUI_Rect(130, 160, 102, 102);
+  GUI_W_RotaryButtonAdd(&rec, &var8, ROTARY_BTN_GR_30_DEG);
+
+  /*graph: wavetable or spectrum of the wavetable*/
+  rec = GUI_Rect(8, 23, 224, 134);
+  GUI_W_ImgAdd(&rec, 0, DISPLAY_TRANSPARENT);
+  rec.x += (rec.w - GRAPH_WIDTH) / 2;
+  rec.y += (rec.h - GRAPH_HEIGHT) / 2;
+  rec.w = GRAPH_WIDTH;
+  rec.h = GRAPH_HEIGHT;
+  GUI_W_GraphSetGridSpacing(SPEC_BAR_STEP * 5, 20);
+  pObjGraph = GUI_W_GraphAdd(&rec, GRAPH_GRID_DOT_HV, 0);
+  GUI_W_GraphAddCurveToGraph(NULL, bSpectrum ? specView : pArb->waveform, P2D_Color(255, 192, 0));
+
+  /*force the reload of the current harmonic*/
+  harmonicOld = -1;
+
+  /*table not synthesized yet? start now*/
+  if(pArb->waveformType == ARB_WAVE_HARMONIC && bSpectrum == false) {
+    if(ARB_HarmonicSynthStart(pArb) == 0) bJobPending = true;
+  }
+
+  GUI_SetUserTask(ARB_HarmonicPageHandler);
+}
+
+
+/**
+ * @function ARB_HarmonicPageHandler
+ * @brief harmonic editor page handler
+ * @param signal_t sig: signal coming from widgets
+ * @return none
+ */
+static void ARB_HarmonicPageHandler(signal_t sig) {
+
+  /*transforms run by slices in the background: refresh the view once finished*/
+  if(bJobPending && ARB_HarmonicIsBusy() == false) {
+    bJobPending = false;
+    fftTime = ARB_HarmonicGetTransformTime();
+    if(bSpectrum) UpdateSpectrumView();
+    GUI_ObjSetNeedRefresh(pObjGraph, true);
+  }
+
+  switch(sig) {
+
+    /*no signal: track the value boxes*/
+    case 0:
+      if(harmonic != harmonicOld) {
+        ARB_HarmonicGet(harmonic, &amp, &phase);
+        harmonicOld = harmonic;
+        ampOld = amp;
+        phaseOld = phase;
+      }
+      else if(amp != ampOld || phase != phaseOld) {
+        ARB_HarmonicSet(harmonic, amp, phase);
+        ampOld = amp;
+        phaseOld = phase;
+      }
+      break;
+
+    /*synthesize the wavetable from the harmonics*/
+    case SIG_BTN_SYNTH:
+      ARB_Stop(pArb);
+      if(pArb->waveformType != ARB_WAVE_HARMONIC) ARB_SetWaveform(pArb, ARB_WAVE_HARMONIC);
+      if(bSpectrum) {
+        bSpectrum = false;
+        GUI_SetUserTask(ARB_HarmonicPage);
+      }
+      else if(ARB_HarmonicSynthStart(pArb) == 0) {
+        bJobPending = true;
+      }
+      break;
+
+    /*spectrum of the current wavetable*/
+    case SIG_BTN_SPECTRUM:
+      if(ARB_HarmonicIsBusy() == false) {
+        if(ARB_SpectrumStart(pArb) == 0) bJobPending = true;
+        if(bSpectrum == false) {
+          bSpectrum = true;
+          memset(specView, 0, sizeof(specView));
+          GUI_SetUserTask(ARB_HarmonicPage);
+        }
+      }
+      break;
+
+    /*back to the ARB page*/
+    case SIG_BTN_BACK:
+      bSpectrum = false;
+      GUI_SetUserTask(ARB_Page);
+      break;
+
+    /*at this point, signal comes from a valuebox*/
+    default:
+      LockValueBox();
+      if(sig == SIG_RVAL_HARMONIC)  GUI_W_RotaryValueLock(pHarmVal, false);
+      else if(sig == SIG_RVAL_AMP)  GUI_W_RotaryValueLock(pAmpVal, false);
+      else                          GUI_W_RotaryValueLock(pPhaseVal, false);
+      break;
+  }
+}
+
+
+/**
+ * @function UpdateSpectrumView
+ * @brief draw the harmonic levels as bars into the spectrum curve (0dB on top, -60dB at the bottom)
+ * @param none
+ * @return none
+ */
+static void UpdateSpectrumView(void) {
+
+  uint8_t h;
+  int32_t level;
+  uint16_t x;
+
+  memset(specView, 0, sizeof(specView));
+  for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+    level = ARB_SpectrumGetDb(h) + SPEC_DB_RANGE;
+    if(level < 0) level = 0;
+    level = level * 255 / SPEC_DB_RANGE;
+    x = h * SPEC_BAR_STEP;
+    if(x + 1 < GRAPH_WIDTH) {
+      specView[x - 1] = specView[x] = specView[x + 1] = (uint8_t) level;
+    }
+  }
+}
+
+
+/**
+ * @function LockValueBox
+ * @brief lock all valueboxes
+ * @param none
+ * @return none
+ */
+static void LockValueBox(void) {
+  GUI_W_RotaryValueLock(pHarmVal, true);
+  GUI_W_RotaryValueLock(pAmpVal, true);
+  GUI_W_RotaryValueLock(pPhaseVal, true);
+}
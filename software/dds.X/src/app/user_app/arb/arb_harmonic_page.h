@@ -0,0 +1,43 @@
+/**
+ * @file arb_harmonic_page.h
+ * @brief harmonic editor page (additive synthesis & spectrum of the current table)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-17
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _arb_harmonic_page_h_
+#define _arb_harmonic_page_h_
+
+#include "arb_process.h"
+
+/**
+ * @function ARB_HarmonicPageSetArb
+ * @brief select the arbitrary waveform handler edited by the page; shall be called before opening the page
+ * @param arb_st *arb: pointer to the arbitrary waveform handler
+ * @return none
+ */
+void ARB_HarmonicPageSetArb(arb_st *arb);
+
+/**
+ * @function ARB_HarmonicPage
+ * @brief harmonic editor page
+ * @param signal_t sig: unused
+ * @return none
+ */
+void ARB_HarmonicPage(signal_t sig);
+
+#endif
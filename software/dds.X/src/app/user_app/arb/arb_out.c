@@ -20,6 +20,8 @@
  */
 
 #include "arb_out.h"
+#include "arb_dither.h"
+#include "ana.h"
 #include "AD9834.h"
 #include "AD5310.h"
 #include "spi.h"
@@ -59,6 +61,9 @@ void OutputOnDdsDac(uint16_t val) {
 void ARB_SetOutputFreqMinMax(int32_t _fmin, int32_t _fmax) {
   fmin = _fmin;
   fmax = _fmax;
+
+  /*one frequency step (0.1Hz) per output word*/
+  ARB_DitherSetResolution(OUTPUT_ON_DDS_FREQ, (uint32_t) abs(fmax - fmin) + 1);
 }
 
 
@@ -86,6 +91,9 @@ void OutputOnDdsFreq(uint16_t val) {
 void ARB_SetOutputVppMinMax(int32_t _vmin, int32_t _vmax) {
   vmin = _vmin;
   vmax = _vmax;
+
+  /*the Vpp DAC is coarser than the 0.01V steps: one DAC word per output word (see DAC_GetWordVpp())*/
+  ARB_DitherSetResolution(OUTPUT_ON_VPP, (uint32_t) abs(vmax - vmin) * ANA_DAC_VPP_MAX_WORD / (2 * ANA_OUTPUT_MAX) + 1);
 }
 
 
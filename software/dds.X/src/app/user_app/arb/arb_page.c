@@ -22,6 +22,7 @@
 #include "gui_common.h"
 #include "arb_page.h"
 #include "arb_process.h"
+#include "arb_harmonic_page.h"
 #include "mod.h"
 #include "mod_page.h"
 #include "ana.h"
@@ -91,6 +92,7 @@ void ARB_Page(signal_t sig) {
   GUI_ClearAll();
   DrawBackground();
   DrawIO(false, true, arb.waveformType == ARB_WAVE_ANA_IN? true: false);
+  DrawTrigStatus();
 
   /*frequency value box*/
   SetFont(G_FONT_DEFAULT);
@@ -100,7 +102,7 @@ void ARB_Page(signal_t sig) {
   GUI_W_RotaryValueSetDotPos(NULL, 1);
   GUI_W_RotaryValueSetMinMax(NULL, 1, 20000);
   if(arb.waveformType == ARB_WAVE_NOISE || arb.waveformType == ARB_WAVE_WAV
-       || arb.waveformType == ARB_WAVE_ANA_IN) GUI_ObjSetDisabled(pFreqVal, true);
+       || arb.waveformType == ARB_WAVE_ANA_IN || arb.waveformType == ARB_WAVE_DTMF) GUI_ObjSetDisabled(pFreqVal, true);
 
   /*Vpp value box*/
   rec = GUI_Rect(8, 195, 113, 32);
@@ -193,6 +195,19 @@ static void ARB_DrawGraphArea(const rect_st *dst) {
       GUI_SetAlign(0);
       break;
 
+    /*multi-tone & DTMF: no symbol, text only*/
+    case ARB_WAVE_MULTITONE:
+    case ARB_WAVE_DTMF:
+      GUI_SetAlign(G_ALIGN_H_CENTER | G_ALIGN_V_CENTER);
+      SetFont(G_FONT_DEFAULT);
+      rec = *dst;
+      rec.h /= 2;
+      GUI_W_TextAdd(&rec, (arb.waveformType == ARB_WAVE_MULTITONE)? "two-tone": "DTMF");
+      rec.y += rec.h;
+      GUI_W_TextAdd(&rec, (arb.waveformType == ARB_WAVE_MULTITONE)? "f & f + 10%": ARB_DTMF_SEQUENCE);
+      GUI_SetAlign(0);
+      break;
+
     /*other waveform: display graph*/
     default:
       rec.w = GRAPH_WIDTH;
@@ -252,13 +267,13 @@ static void ARB_PageHandler(signal_t sig) {
 
     /*browse*/
     case SIG_BTN_BROWSE:
-      ARB_Stop(&arb);
+      LocalExit();
       GUI_SetUserTask(ARB_PageSelectWaveform);
       break;
 
     /*modulation*/
     case SIG_BTN_MOD:
-      ARB_Stop(&arb);
+      LocalExit();
       GUI_SetUserTask(MOD_Page);
       break;
 
@@ -268,13 +283,38 @@ static void ARB_PageHandler(signal_t sig) {
       GUI_SetUserTask(GUI_MainMenu);
       break;
 
-    /*graph update*/
+    /*graph update; harmonic table: open the harmonic editor*/
     case SIG_GRAPH:
-      GUI_W_GraphGetTouch(pObjGraph, &x, &y);
-      bRefresh = ARB_UpdateWaveform(&arb, GRAPH_HEIGHT, oldX, oldY, x, y);
-      oldX = x;
-      oldY = y;
-      if(bRefresh) GUI_ObjSetNeedRefresh(pObjGraph, true);
+      if(arb.waveformType == ARB_WAVE_HARMONIC) {
+        LocalExit();
+        ARB_HarmonicPageSetArb(&arb);
+        GUI_SetUserTask(ARB_HarmonicPage);
+      }
+      else {
+        GUI_W_GraphGetTouch(pObjGraph, &x, &y);
+        bRefresh = ARB_UpdateWaveform(&arb, GRAPH_HEIGHT, oldX, oldY, x, y);
+        if(bRefresh) {
+          switch(arb.waveformType) {
+
+            /*the whole waveform is computed again from the touched point*/
+            case ARB_WAVE_TRIG:
+            case ARB_WAVE_PULSE:
+            case ARB_WAVE_RC:
+            case ARB_WAVE_SINEXX:
+              GUI_ObjSetNeedRefresh(pObjGraph, true);
+              break;
+
+            /*free draw: only the samples between the previous & the current touch are modified*/
+            default:
+              if(oldX < 0) GUI_W_GraphInvalidateSamples(pObjGraph, (uint16_t) x, 1);
+              else if(oldX < x) GUI_W_GraphInvalidateSamples(pObjGraph, (uint16_t) oldX, (uint16_t) (x - oldX + 1));
+              else GUI_W_GraphInvalidateSamples(pObjGraph, (uint16_t) x, (uint16_t) (oldX - x + 1));
+              break;
+          }
+        }
+        oldX = x;
+        oldY = y;
+      }
       break;
 
     /*at this point, signal comes from a valuebox*/
@@ -308,14 +348,30 @@ static void ARB_PageSelectWaveform(signal_t sig) {
   DrawBackground();
 
   /*display all possible waveforms*/
-  SetFont(G_FONT_WAVE_SYMBOL);
   rec.w = rec.h = width;
   for(ii = 0; ii < _ARB_WAV_COUNT; ii++) {
     str[0] = ii + 1;
     rec.x = startX + (ii % btnPerLine) * (rec.w + spacing);
     rec.y = startY + (ii / btnPerLine) * (rec.h + spacing);
-    GUI_W_ButtonAdd(&rec, str, 0);
-    GUI_SetSignal(E_PUSHED_TO_RELEASED, str[0]);
+
+    /*the waveform symbol font stops at ARB_WAVE_ANA_IN; use a text for the next ones*/
+    if(ii == ARB_WAVE_MULTITONE) {
+      SetFont(G_FONT_DEFAULT);
+      GUI_W_ButtonAdd(&rec, "2-T", 0);
+    }
+    else if(ii == ARB_WAVE_DTMF) {
+      SetFont(G_FONT_DEFAULT);
+      GUI_W_ButtonAdd(&rec, "DTMF", 0);
+    }
+    else if(ii == ARB_WAVE_HARMONIC) {
+      SetFont(G_FONT_DEFAULT);
+      GUI_W_ButtonAdd(&rec, "HARM", 0);
+    }
+    else {
+      SetFont(G_FONT_WAVE_SYMBOL);
+      GUI_W_ButtonAdd(&rec, str, 0);
+    }
+    GUI_SetSignal(E_PUSHED_TO_RELEASED, ii + 1);
   }
 
   SetFont(G_FONT_DEFAULT);
@@ -338,10 +394,18 @@ static void ARB_PageSelectWaveform(signal_t sig) {
  */
 static void ARB_PageSelectWaveformHandler(signal_t sig) {
   if(sig != 0) {
-    if(sig != SIG_BTN_HOME) {
-      ARB_SetWaveform(&arb, sig - 1);
+
+    /*harmonic: the editor switches the waveform once the table is synthesized*/
+    if(sig - 1 == ARB_WAVE_HARMONIC) {
+      ARB_HarmonicPageSetArb(&arb);
+      GUI_SetUserTask(ARB_HarmonicPage);
+    }
+    else {
+      if(sig != SIG_BTN_HOME) {
+        ARB_SetWaveform(&arb, sig - 1);
+      }
+      GUI_SetUserTask(ARB_Page);
     }
-    GUI_SetUserTask(ARB_Page);
   }
 }
 
@@ -370,11 +434,12 @@ static void LocalInit(void) {
 
 /**
  * @function LocalExit
- * @brief
+ * @brief detach the trigger & stop the ARB handler
  * @param none
  * @return none
  */
 static void LocalExit(void) {
+  ARB_SetTrigTarget(NULL);
   ARB_Stop(&arb);
 }
 
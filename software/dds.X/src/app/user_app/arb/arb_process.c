@@ -21,12 +21,16 @@
 
 #include "AD9834.h"
 #include "ana.h"
+#include "arb_dither.h"
+#include "arb_harmonic.h"
 #include "arb_out.h"
 #include "arb_process.h"
 #include "arb_wavedraw.h"
 #include "mod.h"
+#include "multitone.h"
 #include "P2D.h"
 #include "tmr.h"
+#include "trig.h"
 #include "wav_player.h"
 
 
@@ -34,6 +38,7 @@
  * local variables
  */
 static arb_st *currentArb = NULL;
+static arb_st *trigArb = NULL;   /*handler attached to the trigger, even if its waveform is not triggerable*/
 
 
 /**
@@ -42,6 +47,10 @@ static arb_st *currentArb = NULL;
 static void ARB_IsrStd(void);
 static void ARB_IsrNoise(void);
 static void ARB_IsrAnaIn(void);
+static void ARB_UpdateTwoTone(arb_st *arb);
+static void ARB_TrigStart(void *ctx);
+static void ARB_TrigStop(void *ctx);
+static void ARB_TrigStep(void *ctx);
 
 
 /**
@@ -58,6 +67,8 @@ void ARB_Init(arb_st *arb, bool bFirstRun) {
     /**default config: 100Hz, triangle, modulation OFF*/
     if(bFirstRun) {
       memset(arb, 0, sizeof(arb_st));
+      MT_Init();
+      ARB_HarmonicInit();
       ARB_SetWaveform(arb, ARB_WAVE_TRIG);
       arb->frequency = 1000;
       ARB_UpdateFrequency(arb, true);
@@ -84,6 +95,9 @@ void ARB_Init(arb_st *arb, bool bFirstRun) {
       AD9834_SetFrequency(0, modFM.freqMin);
       AD9834_SetWaveform(0, DDS_WAVE_SINUS);
     }
+
+    /*the external trigger may drive the handler from now*/
+    ARB_SetTrigTarget(arb);
   }
 }
 
@@ -97,6 +111,7 @@ void ARB_Init(arb_st *arb, bool bFirstRun) {
 void ARB_Stop(arb_st *arb) {
 
   if(arb != NULL) {
+
     arb->run = 0;
     arb->currentSample = 0;
 
@@ -108,6 +123,11 @@ void ARB_Stop(arb_st *arb) {
     if(arb->waveformType == ARB_WAVE_WAV) {
       WavStop();
     }
+
+    /*same for the multi-tone generator*/
+    if(arb->waveformType == ARB_WAVE_MULTITONE || arb->waveformType == ARB_WAVE_DTMF) {
+      MT_Stop();
+    }
   }
 }
 
@@ -158,6 +178,13 @@ void ARB_Run(arb_st *arb) {
         WavPlay(arb->pOut);
         break;
 
+      /*<multi-tone> special case: timer & ISR are directly handled by MT_Play()*/
+      case ARB_WAVE_MULTITONE:
+      case ARB_WAVE_DTMF:
+        MT_SetSampleRate(modType != MOD_OFF ? MT_SAMPLE_RATE / ARB_MOD_RATE_DIV : MT_SAMPLE_RATE);
+        MT_Play(arb->pOut);
+        break;
+
       /*analog in: special ISR*/
       case ARB_WAVE_ANA_IN:
         TmrSetCallback(ARB_TIMER, ARB_IsrAnaIn);
@@ -192,15 +219,23 @@ void ARB_UpdateFrequency(arb_st *arb, bool bForceRefresh) {
 
       arb->frequencyOld = arb->frequency;
 
-      /*AM/FM modulation ISRs need much more time -> decrease the sampling rate*/
-      if(modType != MOD_OFF) maxSamplePerSec /= 10;
+      /*multi-tone: the sample rate only depends on the modulation, just re-tune the NCOs*/
+      if(arb->waveformType == ARB_WAVE_MULTITONE) {
+        MT_SetSampleRate(modType != MOD_OFF ? MT_SAMPLE_RATE / ARB_MOD_RATE_DIV : MT_SAMPLE_RATE);
+        ARB_UpdateTwoTone(arb);
+      }
+      else if(arb->waveformType != ARB_WAVE_DTMF) {
 
-      /*if the frequency is too high, increase the sample increment*/
-      arb->sampleIncrement = (arb->frequency * ARB_WAVEFORM_DEPTH / 10) / maxSamplePerSec;
-      if(arb->sampleIncrement == 0) arb->sampleIncrement = 1;
+        /*AM/FM modulation ISRs need much more time -> decrease the sampling rate*/
+        if(modType != MOD_OFF) maxSamplePerSec /= ARB_MOD_RATE_DIV;
 
-      f = (((float)arb->frequency / 10) * ARB_WAVEFORM_DEPTH / arb->sampleIncrement);
-      TmrSetFrequency(ARB_TIMER, f);
+        /*if the frequency is too high, increase the sample increment*/
+        arb->sampleIncrement = (arb->frequency * ARB_WAVEFORM_DEPTH / 10) / maxSamplePerSec;
+        if(arb->sampleIncrement == 0) arb->sampleIncrement = 1;
+
+        f = (((float)arb->frequency / 10) * ARB_WAVEFORM_DEPTH / arb->sampleIncrement);
+        TmrSetFrequency(ARB_TIMER, f);
+      }
 
       /*re-launch the timer if needed (changing the freq through TmrSetFrequency() stop it)*/
       if(arb->run) ARB_Run(arb);
@@ -222,6 +257,9 @@ void ARB_SetOutput(arb_st *arb, arb_out_e out) {
     else if(out == OUTPUT_ON_VPP) arb->pOut = OutputOnVpp;
     else if(out == OUTPUT_ON_VO)  arb->pOut = OutputOnVo;
     else arb->pOut = OutputOnDdsDac;
+
+    /*rendered blocks (wav, multi-tone) are quantized for this output*/
+    ARB_DitherSetOutput(out);
   }
 }
 
@@ -253,7 +291,18 @@ void ARB_SetWaveform(arb_st *arb, arb_waveform_e waveformType) {
       case ARB_WAVE_SINE:       ARB_UpdateWaveformSine    (arb, 0, 0, 0, 30, 0); break;
       case ARB_WAVE_ANA_IN:     memset(arb->waveform, 127, ARB_WAVEFORM_DEPTH) ; break;
 
-      /*nothing to do here for these waveforms*/
+      /*multi-tone: NCOs are re-tuned by ARB_UpdateFrequency(); DTMF: default sequence, looped*/
+      case ARB_WAVE_MULTITONE:
+        memset(arb->waveform, 127, ARB_WAVEFORM_DEPTH);
+        break;
+
+      case ARB_WAVE_DTMF:
+        memset(arb->waveform, 127, ARB_WAVEFORM_DEPTH);
+        MT_SetDtmfSequence(ARB_DTMF_SEQUENCE, ARB_DTMF_TONE_MS, ARB_DTMF_PAUSE_MS, true);
+        break;
+
+      /*nothing to do here for these waveforms; harmonic: table is synthesized by the harmonic editor*/
+      case ARB_WAVE_HARMONIC:
       case ARB_WAVE_WAV:
       case ARB_WAVE_NOISE:
         break;
@@ -268,6 +317,11 @@ void ARB_SetWaveform(arb_st *arb, arb_waveform_e waveformType) {
     /*save waveform & refresh frequency*/
     arb->waveformType = waveformType;
     ARB_UpdateFrequency(arb, true);
+
+    /*the trigger follows the new waveform (.wav & multi-tone are not triggerable)*/
+    if(trigArb == arb) {
+      ARB_SetTrigTarget(arb);
+    }
   }
 }
 
@@ -300,6 +354,9 @@ bool ARB_UpdateWaveform(arb_st *arb, length_t graphHeight, coord_t x0, coord_t y
       case ARB_WAVE_NEG_DSINE:
       case ARB_WAVE_SINE:
       case ARB_WAVE_ANA_IN:
+      case ARB_WAVE_MULTITONE:
+      case ARB_WAVE_DTMF:
+      case ARB_WAVE_HARMONIC:
         break;
 
       /*no waveform? free draw*/
@@ -313,6 +370,32 @@ bool ARB_UpdateWaveform(arb_st *arb, length_t graphHeight, coord_t x0, coord_t y
 }
 
 
+/**
+ * @function ARB_SetTrigTarget
+ * @brief let the external trigger drive the arbitrary handler (start / stop / step)
+ * @param arb_st *arb: pointer to the arbitrary waveform handler; NULL -> detach the trigger
+ * @return none
+ * @note .wav & multi-tone playbacks are not triggerable (file access / block rendering at start)
+ */
+void ARB_SetTrigTarget(arb_st *arb) {
+
+  trig_target_st target;
+
+  trigArb = arb;
+  if(arb != NULL && arb->waveformType != ARB_WAVE_WAV && arb->waveformType != ARB_WAVE_MULTITONE
+       && arb->waveformType != ARB_WAVE_DTMF) {
+    target.ctx = arb;
+    target.pStart = ARB_TrigStart;
+    target.pStop = ARB_TrigStop;
+    target.pStep = ARB_TrigStep;
+    TRIG_SetTarget(&target);
+  }
+  else {
+    TRIG_SetTarget(NULL);
+  }
+}
+
+
 /**
  * @function ARB_IsrStd
  * @brief standard ISR (put the current sample, increment current sample #id)
@@ -346,3 +429,83 @@ static void ARB_IsrNoise(void) {
 static void ARB_IsrAnaIn(void) {
   currentArb->pOut(ANA_GetInput());
 }
+
+
+/**
+ * @function ARB_UpdateTwoTone
+ * @brief two-tone (intermodulation test) setup: f & f + 10%, same level
+ * @param arb_st *arb: pointer to the arbitrary waveform handler
+ * @return none
+ */
+static void ARB_UpdateTwoTone(arb_st *arb) {
+
+  int32_t freq = arb->frequency, freqMax = MT_GetFreqMax();
+
+  /*both tones must stay under the Nyquist frequency*/
+  if(freq > freqMax * 10 / 11) freq = freqMax * 10 / 11;
+
+  MT_ClearTones();
+  MT_SetTone(0, freq, MT_AMP_FULL_SCALE / 2, 0);
+  MT_SetTone(1, freq + freq / 10, MT_AMP_FULL_SCALE / 2, 0);
+}
+
+
+/**
+ * @function ARB_TrigStart
+ * @brief trigger action: restart the waveform from its first sample, output immediately
+ * @param void *ctx: pointer to the arbitrary waveform handler
+ * @return none
+ */
+static void ARB_TrigStart(void *ctx) {
+
+  arb_st *arb = (arb_st *) ctx;
+
+  /*next sample one full period after the first one*/
+  TmrStop(ARB_TIMER);
+  TmrClearCounter(ARB_TIMER);
+  arb->currentSample = 0;
+  ARB_Run(arb);
+
+  /*the timer ISR cannot preempt the trigger one: the first word is out before sample #1*/
+  switch(arb->waveformType) {
+    case ARB_WAVE_NOISE:  ARB_IsrNoise(); break;
+    case ARB_WAVE_ANA_IN: ARB_IsrAnaIn(); break;
+    default: arb->pOut((((uint16_t)arb->waveform[0]) << 8)); break;
+  }
+}
+
+
+/**
+ * @function ARB_TrigStop
+ * @brief trigger action: suspend the waveform (the output holds the last sample)
+ * @param void *ctx: pointer to the arbitrary waveform handler
+ * @return none
+ */
+static void ARB_TrigStop(void *ctx) {
+  ARB_Pause((arb_st *) ctx);
+}
+
+
+/**
+ * @function ARB_TrigStep
+ * @brief trigger action: output the next sample (external sample clock)
+ * @param void *ctx: pointer to the arbitrary waveform handler
+ * @return none
+ */
+static void ARB_TrigStep(void *ctx) {
+
+  arb_st *arb = (arb_st *) ctx;
+
+  /*first step: DDS on*/
+  if(arb->run == 0) {
+    arb->run = 1;
+    currentArb = arb;
+    AD9834_Resume(0);
+  }
+
+  switch(arb->waveformType) {
+    case ARB_WAVE_NOISE:  ARB_IsrNoise(); break;
+    case ARB_WAVE_ANA_IN: ARB_IsrAnaIn(); break;
+    default: ARB_IsrStd(); break;
+  }
+}
@@ -27,6 +27,10 @@
 
 #define ARB_WAVEFORM_DEPTH  201
 #define ARB_TIMER           TMR_5
+#define ARB_MOD_RATE_DIV    10        /*AM/FM modulation ISRs need much more time -> sample rate divider*/
+#define ARB_DTMF_SEQUENCE   "0123456789*#ABCD"  /*digits played by ARB_WAVE_DTMF*/
+#define ARB_DTMF_TONE_MS    100
+#define ARB_DTMF_PAUSE_MS   100
 
 /*waveform type*/
 typedef enum {
@@ -43,6 +47,9 @@ typedef enum {
   ARB_WAVE_NOISE,
   ARB_WAVE_WAV,
   ARB_WAVE_ANA_IN,
+  ARB_WAVE_MULTITONE,
+  ARB_WAVE_DTMF,
+  ARB_WAVE_HARMONIC,
   _ARB_WAV_COUNT
 } arb_waveform_e;
 
@@ -136,4 +143,13 @@ void ARB_SetWaveform(arb_st *arb, arb_waveform_e waveformType);
  */
 bool ARB_UpdateWaveform(arb_st *arb, length_t graphHeight, coord_t x0, coord_t y0, coord_t x1, coord_t y1);
 
+/**
+ * @function ARB_SetTrigTarget
+ * @brief let the external trigger drive the arbitrary handler (start / stop / step)
+ * @param arb_st *arb: pointer to the arbitrary waveform handler; NULL -> detach the trigger
+ * @return none
+ * @note .wav & multi-tone playbacks are not triggerable (file access / block rendering at start)
+ */
+void ARB_SetTrigTarget(arb_st *arb);
+
 #endif
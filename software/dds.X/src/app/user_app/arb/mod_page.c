@@ -24,12 +24,13 @@
 #include "gui_common.h"
 #include "mod_page.h"
 #include "arb_page.h"
+#include "arb_dither.h"
 
 
 /**
  * local variables
  */
-static uint8_t mod;
+static uint8_t mod, dither;
 static int8_t var8;
 static g_obj_st *pAmFreqVal, *pAmVminVal, *pAmVmaxVal, *pFmFreqMin, *pFmFreqMax, *pRotBtn;
 
@@ -41,6 +42,7 @@ static void MOD_PageHandler(signal_t sig);
 static void LocalInit(void);
 static void RefreshSelectedGroup(void);
 static void LockValueBox(void);
+static arb_out_e ModOutput(void);
 
 
 enum {
@@ -55,7 +57,13 @@ enum {
   _SIG_MOD = 100,
   SIG_MOD_OFF = _SIG_MOD,
   SIG_MOD_AM,
-  SIG_MOD_FM
+  SIG_MOD_FM,
+
+  _SIG_DITHER = 110,
+  SIG_DITHER_OFF = _SIG_DITHER,
+  SIG_DITHER_TPDF,
+  SIG_DITHER_NS1,
+  SIG_DITHER_NS2
 };
 
 
@@ -102,6 +110,25 @@ void MOD_Page(signal_t sig) {
   GUI_W_RadioAdd(&rec, "FM", &mod, MOD_FM);
   GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MOD_FM);
 
+  /*dither radios: quantization of the streamed samples (wav, multi-tone) on the output of the current modulation*/
+  dither = ARB_DitherGetMode(ModOutput());
+
+  rec = GUI_Rect(4, 203, 60, 24);
+  GUI_W_RadioAdd(&rec, "RND", &dither, DITHER_OFF);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_DITHER_OFF);
+
+  rec.y += rec.h + 3;
+  GUI_W_RadioAdd(&rec, "TPDF", &dither, DITHER_TPDF);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_DITHER_TPDF);
+
+  rec.y += rec.h + 3;
+  GUI_W_RadioAdd(&rec, "NS1", &dither, DITHER_TPDF_NS1);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_DITHER_NS1);
+
+  rec.y += rec.h + 3;
+  GUI_W_RadioAdd(&rec, "NS2", &dither, DITHER_TPDF_NS2);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_DITHER_NS2);
+
   /**
    * AM modulation widgets
    */
@@ -171,9 +198,19 @@ static void MOD_PageHandler(signal_t sig) {
     case SIG_MOD_FM:
       modType = sig - _SIG_MOD;
       mod = modType;
+      dither = ARB_DitherGetMode(ModOutput());
       RefreshSelectedGroup();
       break;
 
+    /*dither radios*/
+    case SIG_DITHER_OFF:
+    case SIG_DITHER_TPDF:
+    case SIG_DITHER_NS1:
+    case SIG_DITHER_NS2:
+      dither = sig - _SIG_DITHER;
+      ARB_DitherSetMode(ModOutput(), (arb_dither_e) dither);
+      break;
+
     /*mod AM, frequency value box*/
     case SIG_AM_RVAL_FREQ:
       LockValueBox();
@@ -285,3 +322,21 @@ static void LockValueBox(void) {
   GUI_W_RotaryValueLock(pFmFreqMin, true);
   GUI_W_RotaryValueLock(pFmFreqMax, true);
 }
+
+
+/**
+ * @function ModOutput
+ * @brief output driven by the ARB samples, for the current modulation type (see ARB_Init())
+ * @param none
+ * @return arb_out_e: output target
+ */
+static arb_out_e ModOutput(void) {
+
+  arb_out_e out;
+
+  if(modType == MOD_AM) out = OUTPUT_ON_VPP;
+  else if(modType == MOD_FM) out = OUTPUT_ON_DDS_FREQ;
+  else out = OUTPUT_ON_DDS_DAC;
+
+  return out;
+}
@@ -0,0 +1,467 @@
+/**
+ * @file multitone.c
+ * @brief multi-tone / DTMF generator: sum of up to 8 NCOs, block-rendered and played on the ARB output
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-03
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "multitone.h"
+#include "arb_dbuf.h"
+#include "arb_dither.h"
+#include "arb_process.h"
+#include "tmr.h"
+
+/**
+ * private variables definition
+ */
+#define MT_TIMER            ARB_TIMER
+#define MT_BLOCK_SIZE       512
+#define MT_SINE_DEPTH       256       /*quarter-wave table depth (+1 entry for interpolation)*/
+#define MT_DTMF_AMP_LOW     13014     /*low group, 2dB under the high group (twist)*/
+#define MT_DTMF_AMP_HIGH    16384
+#define PI                  3.14159265f
+
+/*one NCO: 32 bits phase accumulator*/
+typedef struct {
+  uint32_t phase, phaseOffset, increment;
+  int32_t frequency;                          /*Hz x 10, kept to re-tune the NCO on a sample rate change*/
+  uint16_t amplitude;
+} nco_st;
+
+static int16_t sineQ15[MT_SINE_DEPTH + 1];
+static nco_st nco[MT_NCO_COUNT];
+static uint8_t ncoCount;                      /*NCO #id [0; ncoCount[ are rendered*/
+static uint16_t scale;                        /*Q15 output scale, keeps the sum in range*/
+static uint32_t sampleRate = MT_SAMPLE_RATE;
+
+static mt_step_st seq[MT_SEQ_STEP_MAX];
+static uint8_t seqCount, seqStep;
+static uint32_t seqSampleLeft;
+static bool bSeqRepeat;
+
+static uint16_t buf1[MT_BLOCK_SIZE];
+static uint16_t buf2[MT_BLOCK_SIZE];
+static arb_dbuf_st dbuf;
+static eMtState state = MT_STOPPED;
+
+static const char dtmfKeys[] = "123A456B789C*0#D";
+static const int32_t dtmfRow[4] = {6970, 7700, 8520, 9410};
+static const int32_t dtmfCol[4] = {12090, 13360, 14770, 16330};
+
+
+/**
+ * private functions prototypes
+ */
+static void Callback(void);
+static int8_t RenderBlock(uint16_t *buffer, uint16_t len);
+static void UpdateScale(void);
+static void LoadStep(uint8_t step);
+static void SetNco(uint8_t id, int32_t frequency, uint16_t amplitude, int16_t phase);
+static int32_t SineQ15(uint32_t phase);
+
+
+/**
+ * @function MT_Init
+ * @brief build the shared quarter-wave sine table & clear all tones
+ * @param none
+ * @return none
+ */
+void MT_Init(void) {
+
+  uint16_t ii;
+
+  for(ii = 0; ii <= MT_SINE_DEPTH; ii++) {
+    sineQ15[ii] = (int16_t) (32767.0f * sin(PI * ii / (2 * MT_SINE_DEPTH)) + 0.5f);
+  }
+  MT_ClearTones();
+}
+
+
+/**
+ * @function MT_ClearTones
+ * @brief disable all NCOs & leave sequence mode
+ * @param none
+ * @return none
+ */
+void MT_ClearTones(void) {
+  memset(nco, 0, sizeof(nco));
+  ncoCount = 0;
+  seqCount = 0;
+  UpdateScale();
+}
+
+
+/**
+ * @function MT_SetTone
+ * @brief configure one NCO (leaves sequence mode)
+ * @param uint8_t id: NCO #id, from 0 to MT_NCO_COUNT - 1
+ * @param int32_t frequency: frequency, in Hz x 10 (0 to MT_GetFreqMax())
+ * @param uint16_t amplitude: amplitude, Q15 (0 -> NCO disabled)
+ * @param int16_t phase: initial phase, in degree
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t MT_SetTone(uint8_t id, int32_t frequency, uint16_t amplitude, int16_t phase) {
+
+  int8_t res = -1;
+
+  if(id < MT_NCO_COUNT && frequency >= 0 && frequency <= MT_GetFreqMax() && amplitude <= MT_AMP_FULL_SCALE) {
+    seqCount = 0;
+    SetNco(id, frequency, amplitude, phase);
+    UpdateScale();
+    res = 0;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function MT_SetSequence
+ * @brief play a sequence of two-tone steps (NCO 0 & 1)
+ * @param const mt_step_st *steps: steps to play (copied)
+ * @param uint8_t count: number of steps, up to MT_SEQ_STEP_MAX
+ * @param bool bRepeat: loop the sequence if true
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t MT_SetSequence(const mt_step_st *steps, uint8_t count, bool bRepeat) {
+
+  int8_t res = -1;
+  uint8_t ii;
+  int32_t freqMax = MT_GetFreqMax();
+
+  if(steps != NULL && count > 0 && count <= MT_SEQ_STEP_MAX) {
+
+    /*check the whole sequence before touching the current one*/
+    for(ii = 0; ii < count; ii++) {
+      if(steps[ii].freqA < 0 || steps[ii].freqA > freqMax) break;
+      if(steps[ii].freqB < 0 || steps[ii].freqB > freqMax) break;
+      if(steps[ii].ampA > MT_AMP_FULL_SCALE || steps[ii].ampB > MT_AMP_FULL_SCALE) break;
+      if(steps[ii].durationMs == 0) break;
+    }
+
+    if(ii == count) {
+      MT_ClearTones();
+      memcpy(seq, steps, count * sizeof(mt_step_st));
+      seqCount = count;
+      bSeqRepeat = bRepeat;
+      LoadStep(0);
+      res = 0;
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function MT_SetDtmfSequence
+ * @brief build & play a DTMF sequence
+ * @param const char *digits: digits among "0123456789*#ABCD"; ',' inserts a silent step
+ * @param uint16_t toneMs: duration of each digit, in ms
+ * @param uint16_t pauseMs: silence between digits, in ms
+ * @param bool bRepeat: loop the sequence if true
+ * @return int8_t: 0 -> ok, -1 -> unknown digit / sequence too long
+ */
+int8_t MT_SetDtmfSequence(const char *digits, uint16_t toneMs, uint16_t pauseMs, bool bRepeat) {
+
+  static mt_step_st steps[MT_SEQ_STEP_MAX];
+  uint8_t count = 0;
+  const char *pKey;
+  int8_t res = 0;
+
+  if(digits == NULL) res = -1;
+
+  while(res == 0 && *digits != 0) {
+
+    /*one digit + its pause -> 2 steps*/
+    if(count + 2 > MT_SEQ_STEP_MAX) {
+      res = -1;
+    }
+    else {
+      memset(&steps[count], 0, sizeof(mt_step_st));
+
+      if(*digits != ',') {
+        pKey = strchr(dtmfKeys, *digits);
+        if(pKey == NULL) {
+          res = -1;
+        }
+        else {
+          steps[count].freqA = dtmfRow[(pKey - dtmfKeys) / 4];
+          steps[count].freqB = dtmfCol[(pKey - dtmfKeys) % 4];
+          steps[count].ampA = MT_DTMF_AMP_LOW;
+          steps[count].ampB = MT_DTMF_AMP_HIGH;
+        }
+      }
+      steps[count].durationMs = toneMs;
+      count++;
+
+      /*silent step between digits, if any*/
+      if(pauseMs > 0) {
+        memset(&steps[count], 0, sizeof(mt_step_st));
+        steps[count].durationMs = pauseMs;
+        count++;
+      }
+      digits++;
+    }
+  }
+
+  if(res == 0) res = MT_SetSequence(steps, count, bRepeat);
+  return res;
+}
+
+
+/**
+ * @function MT_SetSampleRate
+ * @brief change the output sample rate (applied by the next MT_Play()); the NCOs are re-tuned,
+ *        tones above the new Nyquist frequency are clamped
+ * @param uint32_t rate: sample rate, in Hz (up to MT_SAMPLE_RATE)
+ * @return none
+ */
+void MT_SetSampleRate(uint32_t rate) {
+
+  uint8_t ii;
+  int32_t freqMax;
+
+  if(rate > MT_SAMPLE_RATE) rate = MT_SAMPLE_RATE;
+  if(rate > 0 && rate != sampleRate) {
+    sampleRate = rate;
+    freqMax = MT_GetFreqMax();
+    for(ii = 0; ii < MT_NCO_COUNT; ii++) {
+      if(nco[ii].frequency > freqMax) nco[ii].frequency = freqMax;
+      nco[ii].increment = (uint32_t) (((uint64_t)nco[ii].frequency << 32) / (sampleRate * 10));
+    }
+  }
+}
+
+
+/**
+ * @function MT_GetFreqMax
+ * @brief return the max tone frequency at the current sample rate
+ * @param none
+ * @return int32_t: max frequency, in Hz x 10
+ */
+int32_t MT_GetFreqMax(void) {
+  return (int32_t) (sampleRate / 2) * 10 - 10;
+}
+
+
+/**
+ * @function MT_Play
+ * @brief render the first blocks & launch the playback
+ * @param void (*pOut) (uint16_t dataIn): function to use for playback output
+ * @return none
+ */
+void MT_Play(void (*_pOut) (uint16_t dataIn)) {
+
+  MT_Stop();
+
+  if(_pOut != NULL) {
+
+    /*restart the sequence & fill both buffers*/
+    if(seqCount > 0) LoadStep(0);
+    ARB_DbufInit(&dbuf, buf1, buf2, MT_BLOCK_SIZE, _pOut);
+    (void) ARB_DbufFill(&dbuf, RenderBlock);
+
+    TmrSetFrequency(MT_TIMER, sampleRate);
+    TmrSetCallback(MT_TIMER, Callback);
+    TmrLaunch(MT_TIMER);
+    state = MT_PLAYING;
+  }
+}
+
+
+/**
+ * @function MT_Stop
+ * @brief stop the playback
+ * @param none
+ * @return none
+ */
+void MT_Stop(void) {
+  if(state != MT_STOPPED) {
+    state = MT_STOPPED;
+    TmrStop(MT_TIMER);
+    dbuf.pOut(0x8000);  /*back to mid-scale*/
+  }
+}
+
+
+/**
+ * @function MT_Process
+ * @brief multi-tone task (renders the empty blocks); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void MT_Process(void) {
+
+  if(state == MT_PLAYING) {
+    (void) ARB_DbufFill(&dbuf, RenderBlock);
+  }
+}
+
+
+/**
+ * @function MT_GetStatus
+ * @brief return the generator status
+ * @param none
+ * @return eMtState status
+ */
+eMtState MT_GetStatus(void) {
+  return state;
+}
+
+
+/**
+ * @function Callback
+ * @brief sample ISR: just push the next rendered sample
+ * @param none
+ * @return none
+ */
+static void Callback(void) {
+  ARB_DbufIsr(&dbuf);
+}
+
+
+/**
+ * @function RenderBlock
+ * @brief render a block: sum of the NCOs, scaled, centered on 0x8000
+ * @param uint16_t *buffer: buffer to fill
+ * @param uint16_t len: buffer length, in samples
+ * @return int8_t: 0 (rendering cannot fail)
+ */
+static int8_t RenderBlock(uint16_t *buffer, uint16_t len) {
+
+  uint16_t ii;
+  uint8_t jj;
+  int32_t acc;
+
+  for(ii = 0; ii < len; ii++) {
+
+    /*sequence mode: next step when the current one is elapsed*/
+    if(seqCount > 0) {
+      while(seqSampleLeft == 0 && seqCount > 0) {
+        if(seqStep + 1 < seqCount) LoadStep(seqStep + 1);
+        else if(bSeqRepeat) LoadStep(0);
+        else MT_ClearTones();
+      }
+      if(seqSampleLeft > 0) seqSampleLeft--;
+    }
+
+    /*each Q15 x Q15 product is brought back to Q15 before the sum*/
+    acc = 0;
+    for(jj = 0; jj < ncoCount; jj++) {
+      if(nco[jj].amplitude > 0) {
+        acc += (SineQ15(nco[jj].phase + nco[jj].phaseOffset) * nco[jj].amplitude) >> 15;
+      }
+      nco[jj].phase += nco[jj].increment;
+    }
+
+    acc = (acc * scale) >> 15;
+    if(acc > 32767) acc = 32767;
+    else if(acc < -32768) acc = -32768;
+    buffer[ii] = (uint16_t) (0x8000 + acc);
+  }
+
+  /*quantize to the output word width here, not in the ISR*/
+  ARB_DitherBlock(buffer, len, false);
+  return 0;
+}
+
+
+/**
+ * @function UpdateScale
+ * @brief compute the number of active NCOs & the output scale (sum of amplitudes <= full scale)
+ * @param none
+ * @return none
+ */
+static void UpdateScale(void) {
+
+  uint8_t ii;
+  uint32_t ampSum = 0;
+
+  ncoCount = 0;
+  for(ii = 0; ii < MT_NCO_COUNT; ii++) {
+    if(nco[ii].amplitude > 0) {
+      ampSum += nco[ii].amplitude;
+      ncoCount = ii + 1;
+    }
+  }
+
+  if(ampSum > MT_AMP_FULL_SCALE) scale = (uint16_t) (((uint32_t)MT_AMP_FULL_SCALE << 15) / ampSum);
+  else scale = 32768;
+}
+
+
+/**
+ * @function LoadStep
+ * @brief load a sequence step into NCO 0 & 1
+ * @param uint8_t step: step #id
+ * @return none
+ */
+static void LoadStep(uint8_t step) {
+  seqStep = step;
+  seqSampleLeft = (uint32_t)seq[step].durationMs * sampleRate / 1000;
+  SetNco(0, seq[step].freqA, seq[step].ampA, 0);
+  SetNco(1, seq[step].freqB, seq[step].ampB, 0);
+  UpdateScale();
+}
+
+
+/**
+ * @function SetNco
+ * @brief configure a NCO; increment = f * 2^32 / Fs
+ * @param uint8_t id: NCO #id
+ * @param int32_t frequency: frequency, in Hz x 10
+ * @param uint16_t amplitude: amplitude, Q15
+ * @param int16_t phase: initial phase, in degree
+ * @return none
+ */
+static void SetNco(uint8_t id, int32_t frequency, uint16_t amplitude, int16_t phase) {
+  phase %= 360;
+  if(phase < 0) phase += 360;
+  nco[id].increment = (uint32_t) (((uint64_t)frequency << 32) / (sampleRate * 10));
+  nco[id].frequency = frequency;
+  nco[id].phaseOffset = (uint32_t) (((uint64_t)phase << 32) / 360);
+  nco[id].amplitude = amplitude;
+  nco[id].phase = 0;
+}
+
+
+/**
+ * @function SineQ15
+ * @brief sine of a 32 bits phase, from the quarter-wave table, linear interpolation
+ * @param uint32_t phase: 0 -> 0 degree, 2^32 -> 360 degrees
+ * @return int32_t: sine, Q15
+ */
+static int32_t SineQ15(uint32_t phase) {
+
+  uint32_t x = phase & 0x3FFFFFFF, idx;
+  int32_t a, b, frac, s;
+
+  /*2nd & 4th quadrants: mirror the table*/
+  if(phase & 0x40000000) x = 0x40000000 - x;
+
+  idx = x >> 22;
+  frac = (x >> 8) & 0x3FFF;
+  a = sineQ15[idx];
+  b = (idx < MT_SINE_DEPTH) ? sineQ15[idx + 1] : a;
+  s = a + (((b - a) * frac) >> 14);
+
+  /*3rd & 4th quadrants: negative*/
+  return (phase & 0x80000000) ? -s : s;
+}
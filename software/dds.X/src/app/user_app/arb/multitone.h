@@ -0,0 +1,147 @@
+/**
+ * @file multitone.h
+ * @brief multi-tone / DTMF generator: sum of up to 8 NCOs, block-rendered and played on the ARB output
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-03
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _multitone_h_
+#define _multitone_h_
+
+#include "main.h"
+
+
+#define MT_NCO_COUNT        8         /*max number of simultaneous tones*/
+#define MT_SAMPLE_RATE      40000     /*default output sample rate, in Hz*/
+#define MT_FREQ_MAX         ((MT_SAMPLE_RATE / 2) * 10 - 10) /*max tone frequency at the default rate, in Hz x 10*/
+#define MT_SEQ_STEP_MAX     64        /*max number of steps of a tone sequence*/
+#define MT_AMP_FULL_SCALE   32767     /*amplitude full scale (Q15)*/
+
+
+typedef enum {
+  MT_PLAYING,
+  MT_STOPPED
+} eMtState;
+
+/**
+ * struct mt_step_st
+ * one step of a tone sequence: two tones (0 -> silent) during durationMs
+ */
+typedef struct {
+  int32_t freqA, freqB;   /*in Hz x 10*/
+  uint16_t ampA, ampB;    /*Q15*/
+  uint16_t durationMs;
+} mt_step_st;
+
+/**
+ * @function MT_Init
+ * @brief build the shared quarter-wave sine table & clear all tones
+ * @param none
+ * @return none
+ */
+void MT_Init(void);
+
+/**
+ * @function MT_ClearTones
+ * @brief disable all NCOs & leave sequence mode
+ * @param none
+ * @return none
+ */
+void MT_ClearTones(void);
+
+/**
+ * @function MT_SetTone
+ * @brief configure one NCO (leaves sequence mode)
+ * @param uint8_t id: NCO #id, from 0 to MT_NCO_COUNT - 1
+ * @param int32_t frequency: frequency, in Hz x 10 (0 to MT_GetFreqMax())
+ * @param uint16_t amplitude: amplitude, Q15 (0 -> NCO disabled)
+ * @param int16_t phase: initial phase, in degree
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t MT_SetTone(uint8_t id, int32_t frequency, uint16_t amplitude, int16_t phase);
+
+/**
+ * @function MT_SetSequence
+ * @brief play a sequence of two-tone steps (NCO 0 & 1)
+ * @param const mt_step_st *steps: steps to play (copied)
+ * @param uint8_t count: number of steps, up to MT_SEQ_STEP_MAX
+ * @param bool bRepeat: loop the sequence if true
+ * @return int8_t: 0 -> ok, -1 -> bad parameter
+ */
+int8_t MT_SetSequence(const mt_step_st *steps, uint8_t count, bool bRepeat);
+
+/**
+ * @function MT_SetDtmfSequence
+ * @brief build & play a DTMF sequence
+ * @param const char *digits: digits among "0123456789*#ABCD"; ',' inserts a silent step
+ * @param uint16_t toneMs: duration of each digit, in ms
+ * @param uint16_t pauseMs: silence between digits, in ms
+ * @param bool bRepeat: loop the sequence if true
+ * @return int8_t: 0 -> ok, -1 -> unknown digit / sequence too long
+ */
+int8_t MT_SetDtmfSequence(const char *digits, uint16_t toneMs, uint16_t pauseMs, bool bRepeat);
+
+/**
+ * @function MT_SetSampleRate
+ * @brief change the output sample rate (applied by the next MT_Play()); the NCOs are re-tuned,
+ *        tones above the new Nyquist frequency are clamped
+ * @param uint32_t rate: sample rate, in Hz (up to MT_SAMPLE_RATE)
+ * @return none
+ */
+void MT_SetSampleRate(uint32_t rate);
+
+/**
+ * @function MT_GetFreqMax
+ * @brief return the max tone frequency at the current sample rate
+ * @param none
+ * @return int32_t: max frequency, in Hz x 10
+ */
+int32_t MT_GetFreqMax(void);
+
+/**
+ * @function MT_Play
+ * @brief render the first blocks & launch the playback
+ * @param void (*pOut) (uint16_t dataIn): function to use for playback output
+ * @return none
+ */
+void MT_Play(void (*_pOut) (uint16_t dataIn));
+
+/**
+ * @function MT_Stop
+ * @brief stop the playback
+ * @param none
+ * @return none
+ */
+void MT_Stop(void);
+
+/**
+ * @function MT_Process
+ * @brief multi-tone task (renders the empty blocks); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void MT_Process(void);
+
+/**
+ * @function MT_GetStatus
+ * @brief return the generator status
+ * @param none
+ * @return eMtState status
+ */
+eMtState MT_GetStatus(void);
+
+#endif
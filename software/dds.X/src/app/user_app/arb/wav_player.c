@@ -21,6 +21,8 @@
 
 #include "wav_player.h"
 #include "arb_process.h"
+#include "arb_dither.h"
+#include "arb_dbuf.h"
 #include "dac.h"
 #include "tmr.h"
 
@@ -37,15 +39,11 @@
  */
 #define WAV_TIMER             ARB_TIMER
 #define BUF_SIZE 4096
-enum { BUFFER_1, BUFFER_2};
-static int16_t buf1[BUF_SIZE];
-static int16_t buf2[BUF_SIZE];
-static uint8_t bufferToUse;                 /*signals to the callback which buffer shall be used*/
-static uint16_t posBuf1, posBuf2;           /*buffer current position*/
-static bool isBuffer1Empty, isBuffer2Empty; /*if true, the corresponding buffer shal be filled with new wav data*/
+static uint16_t buf1[BUF_SIZE];
+static uint16_t buf2[BUF_SIZE];
+static arb_dbuf_st dbuf;                    /*buf1 & buf2, played by the callback & filled with new wav data by WavProcess()*/
 static eWavState state = WAV_STOPPED;
 static FIL pFile;
-static void (*pOut) (uint16_t dataIn);
 
 
 /**
@@ -53,8 +51,7 @@ static void (*pOut) (uint16_t dataIn);
  */
 //#define WavWriteDac(value)  do{if(IsSemUnlocked(spiBusy)) AD9834_SetPhase(0, 1024 + ((0x8000 + value) >> 5));} while(0)
 static void Callback_1CH_16BITS(void);
-static int8_t LoadBuffer(int16_t *buf);
-static int8_t LoadBuffers(void);
+static int8_t LoadBuffer(uint16_t *buf, uint16_t len);
 
 
 /**
@@ -74,7 +71,7 @@ void WavProcess(void) {
 
     /*WAV_PLAYING: check if the buffers are not empty / if the music is finished*/
     case WAV_PLAYING:
-      if(LoadBuffers() < 0) {
+      if(ARB_DbufFill(&dbuf, LoadBuffer) < 0) {
         WavStop();
       }
       break;
@@ -97,7 +94,7 @@ void WavStop(void) {
     state = WAV_STOPPED;
     TmrStop(WAV_TIMER);       /*disable the callback*/
     f_close(&pFile);
-    pOut(0x8000);       /*clear the DAC*/
+    dbuf.pOut(0x8000);  /*clear the DAC*/
   }
 }
 
@@ -110,8 +107,8 @@ void WavStop(void) {
  */
 void WavPlay(void (*_pOut) (uint16_t dataIn)) {
 
-  if(isBuffer1Empty == false && _pOut != NULL) { /*if the buffer is not empty (i.e wav file is consistant)*/
-    pOut = _pOut;
+  if(ARB_DbufIsReady(&dbuf) && _pOut != NULL) { /*if the buffer is not empty (i.e wav file is consistant)*/
+    dbuf.pOut = _pOut;
     TmrLaunch(WAV_TIMER);
     state = WAV_PLAYING;
   }
@@ -151,18 +148,14 @@ int8_t OpenWav(const char *path) {
     /*WAV files are assumed to be 16bits 1CH 44.1kHz on this project*/
     //wav_get_file_info()...
 
-    /*load file into buffers 1 & 2*/
-    isBuffer1Empty = true;
-    isBuffer2Empty = true;
-    LoadBuffers();
+    /*load file into buffers 1 & 2; we always start playback by using buffer 1*/
+    ARB_DbufInit(&dbuf, buf1, buf2, BUF_SIZE, dbuf.pOut);
+    (void) ARB_DbufFill(&dbuf, LoadBuffer);
 
     /*configure the playback frequency & its associated callback*/
     TmrSetFrequency(WAV_TIMER, 44100);
     TmrSetCallback(WAV_TIMER, Callback_1CH_16BITS);
 
-    /*we always start playback by using BUFFER_1*/
-    bufferToUse = BUFFER_1;
-
     /*start playback*/
     //WavPlay();
 
@@ -180,74 +173,20 @@ int8_t OpenWav(const char *path) {
  * @return none
  */
 static void Callback_1CH_16BITS(void) {
-
-  /*use buffer 1?*/
-  if(bufferToUse == BUFFER_1 && isBuffer1Empty == false) {
-    pOut(0x8000 + buf1[posBuf1]);
-    posBuf1++;
-    if(posBuf1 >= BUF_SIZE) {
-      bufferToUse = BUFFER_2;
-      isBuffer1Empty = true;
-    }
-  }
-
-  /*use buffer 2?*/
-  else if(bufferToUse == BUFFER_2 && isBuffer2Empty == false) {
-    pOut(0x8000 + buf2[posBuf2]);
-    posBuf2++;
-    if(posBuf2 >= BUF_SIZE) {
-      bufferToUse = BUFFER_1;
-      isBuffer2Empty = true;
-    }
-  }
-}
-
-
-/**
- * @function LoadBuffers
- * @brief loads buffers, from wav file to RAM (if necessary)
- * @param none
- * @return int8_t: -1: end of file / file not found, 0: ok
- */
-static int8_t LoadBuffers(void) {
-
-  int8_t res = 0;
-
-  /*buffer 1*/
-  if(isBuffer1Empty == true) {
-    if(LoadBuffer(buf1) < 0) {
-      res = -1;
-    }
-    else {
-      posBuf1 = 0;
-      isBuffer1Empty = false;
-    }
-  }
-
-  /*buffer 2 -- copy paste of buffer 1 procedure...*/
-  if(isBuffer2Empty == true) {
-    if(LoadBuffer(buf2) < 0) {
-      res = -1;
-    }
-    else {
-      posBuf2 = 0;
-      isBuffer2Empty = false;
-    }
-  }
-
-  return res;
+  ARB_DbufIsr(&dbuf);
 }
 
 
 /**
  * @function LoadBuffer
  * @brief loads a given buffer with the wav file, and increase the file seeker
- * @param int16_t *buffer: buffer[BUF_SIZE] to fill
+ * @param uint16_t *buffer: buffer to fill; signed samples are converted into offset binary
+ * @param uint16_t len: buffer length, in samples
  * @return int8_t: -1: end of file & repeat = false / file not found, 0: ok
  */
-static int8_t LoadBuffer(int16_t *buffer) {
+static int8_t LoadBuffer(uint16_t *buffer, uint16_t len) {
 
-  UINT readByte = 0, byteToRead = sizeof(buffer[0]) * BUF_SIZE, ii;
+  UINT readByte = 0, byteToRead = sizeof(buffer[0]) * len, ii;
   int8_t res = -1;
 
   /*wav util content (the music, after the file header) is assumed to be 48*/
@@ -266,12 +205,15 @@ static int8_t LoadBuffer(int16_t *buffer) {
 
       f_lseek(&pFile, wavContentOffset);
       ii = readByte / sizeof(buffer[0]);
-      if(f_read(&pFile, &buffer[ii], sizeof(buffer[0]) * (BUF_SIZE - ii), &readByte) == FR_OK) {
+      if(f_read(&pFile, &buffer[ii], sizeof(buffer[0]) * (len - ii), &readByte) == FR_OK) {
         res = 0;
       }
     }
   }
 
+  /*to offset binary, quantized to the output word width: nothing left to do in the ISR*/
+  if(res == 0) ARB_DitherBlock(buffer, len, true);
+
   return res;
 }
 
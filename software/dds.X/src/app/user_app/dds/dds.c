@@ -22,11 +22,19 @@
 #include "dds.h"
 #include "ana.h"
 #include "AD9834.h"
+#include "trig.h"
 
 
 #ifndef SMART_TFT_SLAVE_MODE
 
 
+/**
+ * local functions
+ */
+static void DDS_TrigStart(void *ctx);
+static void DDS_TrigStop(void *ctx);
+
+
 /**
  * @function DDS_Init
  * @brief initialize DDS & dds_ctrl_st struct
@@ -207,4 +215,52 @@ void DDS_SetWave(dds_ctrl_st *p, uint8_t w) {
   }
 }
 
+
+
+/**
+ * @function DDS_SetTrigTarget
+ * @brief let the external trigger drive the DDS (start / stop, no step)
+ * @param dds_ctrl_st *p: dds descriptor; NULL -> detach the trigger
+ * @return none
+ */
+void DDS_SetTrigTarget(dds_ctrl_st *p) {
+
+  trig_target_st target;
+
+  if(p != NULL) {
+    target.ctx = p;
+    target.pStart = DDS_TrigStart;
+    target.pStop = DDS_TrigStop;
+    target.pStep = NULL;
+    TRIG_SetTarget(&target);
+  }
+  else {
+    TRIG_SetTarget(NULL);
+  }
+}
+
+
+/**
+ * @function DDS_TrigStart
+ * @brief trigger action: restart the signal from phase 0
+ * @param void *ctx: dds descriptor
+ * @return none
+ */
+static void DDS_TrigStart(void *ctx) {
+  dds_ctrl_st *p = (dds_ctrl_st *) ctx;
+  DDS_Stop(p);
+  DDS_Run(p);
+}
+
+
+/**
+ * @function DDS_TrigStop
+ * @brief trigger action: hold in RESET (the next start is phase coherent)
+ * @param void *ctx: dds descriptor
+ * @return none
+ */
+static void DDS_TrigStop(void *ctx) {
+  DDS_Stop((dds_ctrl_st *) ctx);
+}
+
 #endif
@@ -107,4 +107,12 @@ void DDS_SetPhase(dds_ctrl_st *p, uint16_t phase);
  */
 void DDS_SetWave(dds_ctrl_st *p, uint8_t w);
 
+/**
+ * @function DDS_SetTrigTarget
+ * @brief let the external trigger drive the DDS (start / stop, no step)
+ * @param dds_ctrl_st *p: dds descriptor; NULL -> detach the trigger
+ * @return none
+ */
+void DDS_SetTrigTarget(dds_ctrl_st *p);
+
 #endif
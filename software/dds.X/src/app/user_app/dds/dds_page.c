@@ -82,6 +82,7 @@ void DDS_Page(signal_t sig) {
   GUI_ClearAll();
   DrawBackground();
   DrawIO(false, true, false);
+  DrawTrigStatus();
 
   /*frequency value box*/
   SetFont(G_FONT_BIG);
@@ -238,6 +239,7 @@ static void LocalInit(void) {
   DAC_Init(&voltages, 0, bFirstRun);
   DDS_Init(&dds, 0, bFirstRun);
   SetWave(dds.wave);
+  DDS_SetTrigTarget(&dds);
 
   bFirstRun = false;
 }
@@ -250,6 +252,7 @@ static void LocalInit(void) {
  * @return none
  */
 static void LocalExit(void) {
+  DDS_SetTrigTarget(NULL);
   DDS_Stop(&dds);
 }
 
@@ -0,0 +1,307 @@
+/**
+ * @file fcnt.c
+ * @brief reciprocal frequency counter / period meter on the analog input (comparator edges divided & timestamped by DMA)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-31
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "fcnt.h"
+#include "hw_config.h"
+#include "timer.h"
+
+#define FCNT_DMA_CHN    DMA_CHANNEL1
+#define FCNT_DIV_CHN    DMA_CHANNEL2
+#define FCNT_DIV_IRQ    _DMA2_IRQ
+#define FCNT_CLR_CHN    DMA_CHANNEL3
+#define FCNT_HALF_MAX   64      /*max number of timestamps per DMA interruption*/
+#define FCNT_DIV_MAX    512     /*max edge divider: FCNT_FREQ_MAX / (FCNT_HALF_MAX x FCNT_DIV_MAX) < FCNT_IRQ_RATE*/
+#define FCNT_IRQ_RATE   100     /*targeted DMA interruption rate, in Hz*/
+#define FCNT_IRQ_BURST  5000    /*DMA interruption rate above which the ISR raises the division by FCNT_IRQ_STEP, in Hz*/
+#define FCNT_IRQ_STEP   16      /*division raise of the ISR on a burst or an overrun*/
+
+
+/**
+ * global variables
+ */
+fcnt_result_st fcntResult;
+
+
+/**
+ * local variables
+ */
+static uint32_t ring[2 * FCNT_HALF_MAX];      /*DMA destination: timer value every 'edgeDiv' rising edges*/
+static uint8_t divSrc[FCNT_DIV_MAX];          /*edge divider: 1 byte moved per edge, its content is not used*/
+static uint8_t divDst;
+static const uint32_t divClr = _DCH2INT_CHBCIF_MASK;  /*written into DCH2INTCLR by FCNT_CLR_CHN: divider block done flag*/
+static volatile uint16_t half = 1;            /*number of timestamps per DMA interruption (half of the ring)*/
+static volatile uint16_t edgeDiv = 1;         /*number of edges between two timestamps*/
+static volatile uint32_t tIrq;                /*last timestamp of the previous interruption*/
+static volatile uint32_t gateCycles;
+static volatile bool bT0Valid;
+static volatile uint32_t t0, edges;           /*current gate: first timestamp & number of periods since t0*/
+static volatile uint32_t resEdges, resCycles; /*last completed gate*/
+static volatile uint8_t resSeq;
+static uint8_t resSeqOld;
+static bool bRunning = false;
+static timer_t tmNoSignal;
+static uint32_t timeoutMs;                    /*gate + FCNT_TIMEOUT: max delay between two results*/
+
+
+/**
+ * local functions
+ */
+static void FcntDmaResize(uint32_t total);
+static void FcntDmaConfigure(uint16_t h, uint16_t d);
+
+
+/**
+ * @function FCNT_Start
+ * @brief start the counter: comparator on the analog input (threshold at AVDD / 2), free running
+ *        32-bit timer (TMR2/3, not available for the PWM while measuring), DMA division & timestamping of the rising edges
+ * @param int32_t gateMs: gate time, in ms (FCNT_GATE_MIN to FCNT_GATE_MAX)
+ * @return none
+ */
+void FCNT_Start(int32_t gateMs) {
+
+  if(gateMs < FCNT_GATE_MIN) gateMs = FCNT_GATE_MIN;
+  else if(gateMs > FCNT_GATE_MAX) gateMs = FCNT_GATE_MAX;
+
+  /*already running: the new gate is used from the next result*/
+  gateCycles = (uint32_t) gateMs * (PER_CLK / 1000);
+  timeoutMs = (uint32_t) gateMs + FCNT_TIMEOUT;
+
+  if(bRunning == false) {
+
+    memset(&fcntResult, 0, sizeof(fcntResult));
+    resSeqOld = resSeq;
+
+    /*comparator: AN4 (C1IN-) vs CVREF = AVDD / 2; inverted output -> event on the rising edges of the input*/
+    CVREFOpen(CVREF_ENABLE | CVREF_OUTPUT_DISABLE | CVREF_RANGE_HIGH | CVREF_SOURCE_AVDD | CVREF_STEP_8);
+    CMP1Open(CMP_ENABLE | CMP_OUTPUT_DISABLE | CMP_OUTPUT_INVERT | CMP_EVENT_LOW_TO_HIGH | CMP_POS_INPUT_CVREF | CMP1_NEG_INPUT_C1IN_NEG);
+
+    /*timebase: TMR2/3, 32-bit free running timer @PER_CLK*/
+    OpenTimer23(T23_ON | T23_PS_1_1 | T23_SOURCE_INT, 0xFFFFFFFF);
+
+    /*DMA edge divider: one dummy byte per comparator event, its block done event every 'edgeDiv' edges (no CPU interruption)*/
+    DmaChnOpen(FCNT_DIV_CHN, DMA_CHN_PRI3, DMA_OPEN_AUTO);
+    DmaChnSetEventControl(FCNT_DIV_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(_COMPARATOR_1_IRQ));
+    DmaChnSetEvEnableFlags(FCNT_DIV_CHN, DMA_EV_BLOCK_DONE);
+    INTEnable(INT_SOURCE_DMA(FCNT_DIV_CHN), INT_DISABLED);
+
+    /*DMA flag clear: the divider block done event starts it too, after the timestamp (lower priority); its flag is cleared
+      without CPU so that the next block done is a new event -> every d-th edge is timestamped, not only the first one*/
+    DmaChnOpen(FCNT_CLR_CHN, DMA_CHN_PRI2, DMA_OPEN_AUTO);
+    DmaChnSetEventControl(FCNT_CLR_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(FCNT_DIV_IRQ));
+    DmaChnSetTxfer(FCNT_CLR_CHN, (const void *) &divClr, (void *) &DCH2INTCLR, sizeof(uint32_t), sizeof(uint32_t), sizeof(uint32_t));
+    INTEnable(INT_SOURCE_DMA(FCNT_CLR_CHN), INT_DISABLED);
+
+    /*DMA: TMR2 -> ring on each comparator / divider event, without CPU; channel re-enabled automatically at the end of the ring*/
+    DmaChnOpen(FCNT_DMA_CHN, DMA_CHN_PRI3, DMA_OPEN_AUTO);
+    DmaChnSetEvEnableFlags(FCNT_DMA_CHN, DMA_EV_DST_HALF | DMA_EV_BLOCK_DONE);
+    INTSetVectorPriority(INT_VECTOR_DMA(FCNT_DMA_CHN), INT_PRIORITY_LEVEL_3);
+    INTSetVectorSubPriority(INT_VECTOR_DMA(FCNT_DMA_CHN), INT_SUB_PRIORITY_LEVEL_0);
+
+    tmNoSignal = GetTimeout(timeoutMs);
+    bRunning = true;
+    FcntDmaConfigure(1, 1);
+  }
+}
+
+
+/**
+ * @function FCNT_Stop
+ * @brief stop the counter & release the hardware
+ * @param none
+ * @return none
+ */
+void FCNT_Stop(void) {
+  if(bRunning) {
+    INTEnable(INT_SOURCE_DMA(FCNT_DMA_CHN), INT_DISABLED);
+    DmaChnDisable(FCNT_DMA_CHN);
+    DmaChnDisable(FCNT_DIV_CHN);
+    DmaChnDisable(FCNT_CLR_CHN);
+    CloseTimer23();
+    CMP1Close();
+    CVREFClose();
+    bRunning = false;
+  }
+}
+
+
+/**
+ * @function FCNT_Process
+ * @brief counter task (result computation, DMA division & buffer size adaptation, no signal detection); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void FCNT_Process(void) {
+
+  uint32_t e, c, total;
+  uint64_t freq;
+  uint8_t seq;
+
+  if(bRunning) {
+
+    /*get the last completed gate*/
+    INTEnable(INT_SOURCE_DMA(FCNT_DMA_CHN), INT_DISABLED);
+    seq = resSeq;
+    e = resEdges;
+    c = resCycles;
+    INTEnable(INT_SOURCE_DMA(FCNT_DMA_CHN), INT_ENABLED);
+
+    if(seq != resSeqOld && e > 0 && c > 0) {
+      resSeqOld = seq;
+      tmNoSignal = GetTimeout(timeoutMs);
+
+      /*reciprocal counting: e whole periods in c timer cycles -> +/- 1 cycle over the gate, whatever the frequency*/
+      freq = ((uint64_t) e * PER_CLK * 1000ull + c / 2) / c;
+      if(freq > (uint64_t) FCNT_FREQ_MAX * 1000ull) freq = (uint64_t) FCNT_FREQ_MAX * 1000ull;
+      fcntResult.frequency = (int32_t) freq;
+      fcntResult.period = ((uint64_t) c * 1000000000ull + ((uint64_t) PER_CLK * e) / 2) / ((uint64_t) PER_CLK * e);
+      fcntResult.count++;
+
+      /*about FCNT_IRQ_RATE DMA interruptions per second; resize only on a x2 change, a resize restarts the gate*/
+      total = (uint32_t) (freq / 1000) / FCNT_IRQ_RATE;
+      if(total == 0) total = 1;
+      if(total >= 2ul * half * edgeDiv || 2 * total <= (uint32_t) half * edgeDiv) {
+        FcntDmaResize(total);
+      }
+    }
+
+    /*no signal: clear the result & go back to one interruption per edge*/
+    else if(IsTimerElapsed(tmNoSignal)) {
+      tmNoSignal = GetTimeout(timeoutMs);
+      fcntResult.frequency = 0;
+      fcntResult.period = 0;
+      if(half != 1 || edgeDiv != 1) FcntDmaConfigure(1, 1);
+    }
+  }
+}
+
+
+/**
+ * @function FCNT_IsRunning
+ * @brief tell if the counter is running
+ * @param none
+ * @return bool: true if running
+ */
+bool FCNT_IsRunning(void) {
+  return bRunning;
+}
+
+
+/**
+ * @function FcntDmaHandler
+ * @brief DMA interruption handler: one half of the ring is filled (i.e. 'half' x 'edgeDiv' new rising edges)
+ * @param none
+ * @return none
+ */
+void __ISR(_DMA_1_VECTOR, ipl3) FcntDmaHandler(void) {
+
+  uint32_t flags, t;
+
+  flags = DmaChnGetEvFlags(FCNT_DMA_CHN);
+  DmaChnClrEvFlags(FCNT_DMA_CHN, DMA_EV_ALL_EVNTS);
+  INTClearFlag(INT_SOURCE_DMA(FCNT_DMA_CHN));
+
+  /*both halves completed: serviced too late, some edges may be uncounted -> fewer interruptions, restart the gate*/
+  if((flags & DMA_EV_DST_HALF) && (flags & DMA_EV_BLOCK_DONE)) {
+    FcntDmaResize((uint32_t) half * edgeDiv * FCNT_IRQ_STEP);
+  }
+  else {
+
+    /*last timestamp of the completed half*/
+    t = ring[(flags & DMA_EV_DST_HALF)? half - 1: 2 * half - 1];
+
+    /*frequency step while the division is low: bound the interruption rate now, FCNT_Process() refines it later*/
+    if(bT0Valid && t - tIrq < PER_CLK / FCNT_IRQ_BURST && (half < FCNT_HALF_MAX || edgeDiv < FCNT_DIV_MAX)) {
+      FcntDmaResize((uint32_t) half * edgeDiv * FCNT_IRQ_STEP);
+    }
+    else if(bT0Valid) {
+      edges += (uint32_t) half * edgeDiv;
+      tIrq = t;
+      if(t - t0 >= gateCycles) {
+        resEdges = edges;
+        resCycles = t - t0;
+        resSeq++;
+        t0 = t;
+        edges = 0;
+      }
+    }
+    else {
+      t0 = t;
+      tIrq = t;
+      edges = 0;
+      bT0Valid = true;
+    }
+  }
+}
+
+
+/**
+ * @function FcntDmaResize
+ * @brief restart the DMA timestamping for a number of edges per interruption: more timestamps per interruption
+ *        first, then an edge divider (power of 2)
+ * @param uint32_t total: targeted number of edges per DMA interruption
+ * @return none
+ */
+static void FcntDmaResize(uint32_t total) {
+
+  uint16_t h, d = 1;
+
+  while(total / d > FCNT_HALF_MAX && d < FCNT_DIV_MAX) d <<= 1;
+  h = (total / d > FCNT_HALF_MAX)? FCNT_HALF_MAX: (uint16_t) (total / d);
+  if(h == 0) h = 1;
+  FcntDmaConfigure(h, d);
+}
+
+
+/**
+ * @function FcntDmaConfigure
+ * @brief (re)start the DMA timestamping with a ring of 2 x h timestamps, one every d edges; the current gate is restarted
+ * @param uint16_t h: number of timestamps per DMA interruption, 1 to FCNT_HALF_MAX
+ * @param uint16_t d: edge divider, 1 (each edge timestamped) to FCNT_DIV_MAX
+ * @return none
+ */
+static void FcntDmaConfigure(uint16_t h, uint16_t d) {
+  INTEnable(INT_SOURCE_DMA(FCNT_DMA_CHN), INT_DISABLED);
+  DmaChnDisable(FCNT_DMA_CHN);
+  DmaChnDisable(FCNT_DIV_CHN);
+  DmaChnDisable(FCNT_CLR_CHN);
+  half = h;
+  edgeDiv = d;
+  bT0Valid = false;
+
+  /*d > 1: the timestamp follows the block done event of the divider, a constant delay after the d-th edge*/
+  if(d > 1) {
+    DmaChnSetTxfer(FCNT_DIV_CHN, (const void *) divSrc, (void *) &divDst, d, 1, 1);
+    DmaChnClrEvFlags(FCNT_DIV_CHN, DMA_EV_ALL_EVNTS);
+    DmaChnSetEventControl(FCNT_DMA_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(FCNT_DIV_IRQ));
+    DmaChnEnable(FCNT_CLR_CHN);
+    DmaChnEnable(FCNT_DIV_CHN);
+  }
+  else {
+    DmaChnSetEventControl(FCNT_DMA_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(_COMPARATOR_1_IRQ));
+  }
+
+  DmaChnSetTxfer(FCNT_DMA_CHN, (const void *) &TMR2, (void *) ring, sizeof(uint32_t), 2 * h * sizeof(uint32_t), sizeof(uint32_t));
+  DmaChnClrEvFlags(FCNT_DMA_CHN, DMA_EV_ALL_EVNTS);
+  INTClearFlag(INT_SOURCE_DMA(FCNT_DMA_CHN));
+  INTEnable(INT_SOURCE_DMA(FCNT_DMA_CHN), INT_ENABLED);
+  DmaChnEnable(FCNT_DMA_CHN);
+}
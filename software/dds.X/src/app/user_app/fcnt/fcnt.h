@@ -0,0 +1,81 @@
+/**
+ * @file fcnt.h
+ * @brief reciprocal frequency counter / period meter on the analog input (comparator edges timestamped by DMA)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-31
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _fcnt_h_
+#define _fcnt_h_
+
+#include "usr_main.h"
+
+
+#define FCNT_GATE_MIN       10        /*min gate time, in ms*/
+#define FCNT_GATE_MAX       10000     /*max gate time, in ms*/
+#define FCNT_FREQ_MAX       2000000   /*max measurable frequency, in Hz (frequency result is an int32 in mHz)*/
+#define FCNT_TIMEOUT        12000     /*no result during gate + this time (ms) -> no signal; allows 0.1Hz with any gate*/
+
+/**
+ * struct fcnt_result_st
+ * last measurement; all fields are cleared when there is no signal
+ */
+typedef struct {
+  int32_t frequency;    /*in mHz*/
+  uint64_t period;      /*in ns (64-bit: up to 10s @0.1Hz)*/
+  uint32_t count;       /*number of measurements since FCNT_Start()*/
+} fcnt_result_st;
+
+/**
+ * global variables
+ */
+extern fcnt_result_st fcntResult;
+
+/**
+ * @function FCNT_Start
+ * @brief start the counter: comparator on the analog input (threshold at AVDD / 2), free running
+ *        32-bit timer (TMR2/3, not available for the PWM while measuring), DMA division & timestamping of the rising edges
+ * @param int32_t gateMs: gate time, in ms (FCNT_GATE_MIN to FCNT_GATE_MAX)
+ * @return none
+ */
+void FCNT_Start(int32_t gateMs);
+
+/**
+ * @function FCNT_Stop
+ * @brief stop the counter & release the hardware
+ * @param none
+ * @return none
+ */
+void FCNT_Stop(void);
+
+/**
+ * @function FCNT_Process
+ * @brief counter task (result computation, DMA division & buffer size adaptation, no signal detection); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void FCNT_Process(void);
+
+/**
+ * @function FCNT_IsRunning
+ * @brief tell if the counter is running
+ * @param none
+ * @return bool: true if running
+ */
+bool FCNT_IsRunning(void);
+
+#endif
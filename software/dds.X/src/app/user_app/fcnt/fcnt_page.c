@@ -0,0 +1,136 @@
+/**
+ * @file fcnt_page.c
+ * @brief frequency counter page
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-31
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gui_common.h"
+#include "fcnt.h"
+#include "fcnt_page.h"
+
+
+/**
+ * local variables
+ */
+static int8_t var8;
+static int32_t gate = 1000, gateOld;
+static float periodUs;
+static g_obj_st *pFreqVal, *pGateVal;
+
+
+/**
+ * local functions
+ */
+static void FCNT_PageHandler(signal_t sig);
+
+
+enum {
+  SIG_RVAL_GATE = 1,
+  SIG_BTN_HOME
+};
+
+
+/**
+ * @function FCNT_Page
+ * @brief frequency counter page
+ * @param signal_t sig: unused
+ * @return none
+ */
+void FCNT_Page(signal_t sig) {
+
+  rect_st rec;
+
+  FCNT_Start(gate);
+  gateOld = gate;
+  periodUs = 0;
+
+  /*background*/
+  GUI_ClearAll();
+  DrawBackground();
+  SetFont(G_FONT_DEFAULT);
+
+  rec = GUI_Rect(8, 10, 224, 20);
+  GUI_W_TextAdd(&rec, "frequency counter (analog in)");
+
+  /*frequency, read only*/
+  rec = GUI_Rect(8, 40, 224, 32);
+  pFreqVal = GUI_W_RotaryValueAdd(&rec, &fcntResult.frequency, &var8, "Hz", 0);
+  GUI_W_RotaryValueSetDotPos(NULL, 3);
+  GUI_W_RotaryValueLock(pFreqVal, true);
+
+  /*period*/
+  rec = GUI_Rect(8, 80, 224, 20);
+  GUI_W_ValueBoxAdd(&rec, &periodUs, BOX_T_FLOAT, "T = %.3fus");
+
+  /*gate value box*/
+  rec = GUI_Rect(8, 120, 70, 32);
+  GUI_W_TextAdd(&rec, "gate");
+  rec = GUI_Rect(80, 120, 152, 32);
+  pGateVal = GUI_W_RotaryValueAdd(&rec, &gate, &var8, "ms", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_GATE);
+  GUI_W_RotaryValueSetMinMax(NULL, FCNT_GATE_MIN, FCNT_GATE_MAX);
+  GUI_W_RotaryValueLock(pGateVal, true);
+
+  /*number of measurements*/
+  rec = GUI_Rect(120, 200, 112, 20);
+  GUI_W_ValueBoxAdd(&rec, &fcntResult.count, BOX_T_UINT32, "%lu meas.");
+
+  /*main rotary button*/
+  rec = GUI_Rect(8, 203, 102, 102);
+  GUI_W_RotaryButtonAdd(&rec, &var8, ROTARY_BTN_GR_30_DEG);
+
+  /*home button*/
+  rec = GUI_Rect(188, 270, 41, 41);
+  GUI_W_RadioImgAdd(&rec, G_DDS_BACK0, NULL, 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BTN_HOME);
+
+  GUI_SetUserTask(FCNT_PageHandler);
+}
+
+
+/**
+ * @function FCNT_PageHandler
+ * @brief FCNT_Page handler
+ * @param signal_t sig: signal coming from widgets
+ * @return none
+ */
+static void FCNT_PageHandler(signal_t sig) {
+
+  switch(sig) {
+
+    /*home: release the hardware (TMR2/3 is shared with the PWM)*/
+    case SIG_BTN_HOME:
+      FCNT_Stop();
+      GUI_SetUserTask(GUI_MainMenu);
+      break;
+
+    /*gate value box*/
+    case SIG_RVAL_GATE:
+      GUI_W_RotaryValueLock(pGateVal, false);
+      break;
+
+    /*idle: apply the new gate, refresh the period*/
+    default:
+      if(gate != gateOld) {
+        gateOld = gate;
+        FCNT_Start(gate);
+      }
+      periodUs = (float) fcntResult.period / 1000.0f;
+      break;
+  }
+}
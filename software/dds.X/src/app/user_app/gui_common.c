@@ -24,19 +24,57 @@
 #include "dds_page.h"
 #include "arb_page.h"
 #include "pwm_page.h"
+#include "trig.h"
+#include "trig_page.h"
+#include "fcnt_page.h"
+#include "ticks.h"
 
 
 enum {
   SIG_PAGE_DDS = 1,
   SIG_PAGE_ARB,
-  SIG_PAGE_PWM
+  SIG_PAGE_PWM,
+  SIG_PAGE_TRIG,
+  SIG_PAGE_FCNT,
+  SIG_PAGE_BENCH,
+  SIG_BENCH_HOME
 };
 
 
+#ifdef INCLUDE_FRAME_BENCH
+/**
+ * frame-time benchmark: each page is built & drawn BENCH_RUNS times, without then with the P2D display list.
+ * Two frames are timed: the first one after the page is built (each object drawn in the object loop), and the one
+ * following the invalidation of the whole screen (redrawn in bands)
+ */
+#define BENCH_PAGE_CNT  3
+#define BENCH_RUNS      4
+
+typedef struct {
+  const char *name;
+  pGuiUsrTask_t page;
+} bench_page_st;
+
+static const bench_page_st arBenchPage[BENCH_PAGE_CNT] = {
+  {"DDS", DDS_Page},
+  {"ARB", ARB_Page},
+  {"PWM", PWM_Page}
+};
+
+static bool bBenchRequest = false;
+static uint32_t arBenchUs[BENCH_PAGE_CNT][4];   /*average frame times (us): built, list off / on; redrawn, list off / on*/
+static uint32_t arBenchCull[BENCH_PAGE_CNT];    /*commands culled per frame, with the display list*/
+#endif
+
+
 /**
  * local functions
  */
 static void GUI_MainMenuHandler(signal_t sig);
+#ifdef INCLUDE_FRAME_BENCH
+static void GUI_FrameBenchPage(signal_t sig);
+static void GUI_FrameBenchHandler(signal_t sig);
+#endif
 
 
 /**
@@ -73,6 +111,26 @@ void DrawIO(bool pwm, bool anaOut, bool anaIn) {
 }
 
 
+/**
+ * @function DrawTrigStatus
+ * @brief draw the trigger latency & jitter in the status bar, if the trigger is enabled
+ * @param none
+ * @return none
+ */
+void DrawTrigStatus(void) {
+
+  rect_st rec;
+
+  if(trigCfg.mode != TRIG_MODE_OFF) {
+    SetFont(G_FONT_DEFAULT);
+    rec = GUI_Rect(2, 3, 60, 18);
+    GUI_W_ValueBoxAdd(&rec, &trigStat.latency, BOX_T_FLOAT, "%.1fus");
+    rec = GUI_Rect(85, 3, 48, 18);
+    GUI_W_ValueBoxAdd(&rec, &trigStat.jitter, BOX_T_FLOAT, "\xB1%.1f");
+  }
+}
+
+
 /**
  * @function GUI_MainMenu
  * @brief main menu page
@@ -112,6 +170,24 @@ void GUI_MainMenu(signal_t sig) {
   GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_PAGE_ARB);
 
   SetFont(G_FONT_DEFAULT);
+
+  /*trigger button*/
+  rec = GUI_Rect(67, 255, 50, 50);
+  GUI_W_ButtonAdd(&rec, "TRIG", 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_PAGE_TRIG);
+
+  /*frequency counter button*/
+  rec.x += rec.w + 5;
+  GUI_W_ButtonAdd(&rec, "FREQ", 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_PAGE_FCNT);
+
+#ifdef INCLUDE_FRAME_BENCH
+  /*frame-time benchmark button*/
+  rec = GUI_Rect(180, 5, 55, 30);
+  GUI_W_ButtonAdd(&rec, "BENCH", 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_PAGE_BENCH);
+#endif
+
   GUI_SetUserTask(GUI_MainMenuHandler);
 }
 
@@ -137,7 +213,128 @@ static void GUI_MainMenuHandler(signal_t sig) {
        GUI_SetUserTask(PWM_Page);
       break;
 
+    case SIG_PAGE_TRIG:
+      GUI_SetUserTask(TRIG_Page);
+      break;
+
+    case SIG_PAGE_FCNT:
+      GUI_SetUserTask(FCNT_Page);
+      break;
+
+#ifdef INCLUDE_FRAME_BENCH
+    /*the benchmark draws the pages itself: it runs in GUI_FrameBenchTask(), out of GUI_DrawObjects()*/
+    case SIG_PAGE_BENCH:
+      bBenchRequest = true;
+      break;
+#endif
+
     default:
       break;
   }
 }
+
+
+#ifdef INCLUDE_FRAME_BENCH
+/**
+ * @function GUI_FrameBenchTask
+ * @brief frame-time benchmark of the DDS, ARB & PWM pages, once requested by the main menu; shall be called
+ *        in the main loop, out of GUI_DrawObjects(). The results are displayed in a page
+ * @param none
+ * @return none
+ */
+void GUI_FrameBenchTask(void) {
+
+  uint8_t page, mode, run;
+  uint32_t t0, tBuilt, tRedrawn;
+  dlist_stat_st stat;
+
+  if(bBenchRequest) {
+    bBenchRequest = false;
+
+    for(page = 0; page < BENCH_PAGE_CNT; page++) {
+      for(mode = 0; mode < 2; mode++) {
+
+        GUI_DisplayListEnable(mode == 1 ? true : false);
+        P2D_ListResetStat();
+        tBuilt = 0;
+        tRedrawn = 0;
+
+        for(run = 0; run < BENCH_RUNS; run++) {
+
+          /*page built as from the main menu; its first frame draws all its objects*/
+          arBenchPage[page].page(0);
+          t0 = TicksGetCycles();
+          GUI_DrawObjects();
+          tBuilt += TicksGetCycles() - t0;
+
+          /*whole screen invalidated: redrawn in bands*/
+          GUI_Invalidate(NULL);
+          t0 = TicksGetCycles();
+          GUI_DrawObjects();
+          tRedrawn += TicksGetCycles() - t0;
+        }
+
+        arBenchUs[page][mode] = TicksCyclesToUs(tBuilt / BENCH_RUNS);
+        arBenchUs[page][2 + mode] = TicksCyclesToUs(tRedrawn / BENCH_RUNS);
+        P2D_ListGetStat(&stat);
+        if(mode == 1) arBenchCull[page] = stat.culled / (2 * BENCH_RUNS);
+      }
+    }
+
+    GUI_DisplayListEnable(true);
+    GUI_SetUserTask(GUI_FrameBenchPage);
+  }
+}
+
+
+/**
+ * @function GUI_FrameBenchPage
+ * @brief results of the frame-time benchmark
+ * @param signal_t sig: unused
+ * @return none
+ */
+static void GUI_FrameBenchPage(signal_t sig) {
+
+  rect_st rec;
+  uint8_t page;
+  char str[40];
+
+  GUI_ClearAll();
+  DrawBackground();
+  SetFont(G_FONT_DEFAULT);
+
+  rec = GUI_Rect(5, 30, 230, 20);
+  GUI_W_TextAdd(&rec, "frame (us): list off / on");
+
+  for(page = 0; page < BENCH_PAGE_CNT; page++) {
+    rec.y += 25;
+    snprintf(str, sizeof(str), "%s built: %lu / %lu", arBenchPage[page].name,
+             (unsigned long) arBenchUs[page][0], (unsigned long) arBenchUs[page][1]);
+    GUI_W_TextAdd(&rec, str);
+    rec.y += 20;
+    snprintf(str, sizeof(str), "%s redrawn: %lu / %lu", arBenchPage[page].name,
+             (unsigned long) arBenchUs[page][2], (unsigned long) arBenchUs[page][3]);
+    GUI_W_TextAdd(&rec, str);
+    rec.y += 20;
+    snprintf(str, sizeof(str), "%s culled: %lu", arBenchPage[page].name, (unsigned long) arBenchCull[page]);
+    GUI_W_TextAdd(&rec, str);
+  }
+
+  rec = GUI_Rect(95, 265, 50, 50);
+  GUI_W_ButtonAdd(&rec, "Menu", G_IMG_HOME);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BENCH_HOME);
+
+  GUI_SetUserTask(GUI_FrameBenchHandler);
+}
+
+
+/**
+ * @function GUI_FrameBenchHandler
+ * @brief GUI_FrameBenchPage handler
+ * @param signal_t sig: signal coming from widgets
+ * @return none
+ */
+static void GUI_FrameBenchHandler(signal_t sig) {
+  if(sig == SIG_BENCH_HOME) GUI_SetUserTask(GUI_MainMenu);
+}
+#endif
@@ -41,6 +41,14 @@ void DrawBackground(void);
  */
 void DrawIO(bool pwm, bool anaOut, bool anaIn);
 
+/**
+ * @function DrawTrigStatus
+ * @brief draw the trigger latency & jitter in the status bar, if the trigger is enabled
+ * @param none
+ * @return none
+ */
+void DrawTrigStatus(void);
+
 /**
  * @function GUI_MainMenu
  * @brief main menu page
@@ -49,4 +57,15 @@ void DrawIO(bool pwm, bool anaOut, bool anaIn);
  */
 void GUI_MainMenu(signal_t sig);
 
+#ifdef INCLUDE_FRAME_BENCH
+/**
+ * @function GUI_FrameBenchTask
+ * @brief frame-time benchmark of the DDS, ARB & PWM pages, once requested by the main menu; shall be called
+ *        in the main loop, out of GUI_DrawObjects(). The results are displayed in a page
+ * @param none
+ * @return none
+ */
+void GUI_FrameBenchTask(void);
+#endif
+
 #endif
@@ -0,0 +1,381 @@
+/**
+ * @file trig.c
+ * @brief external trigger / gate input: starts, stops, gates or steps the active generator
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-24
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "trig.h"
+#include "gpio.h"
+#include "hw_config.h"
+#include "ticks.h"
+#include "spi.h"
+
+#define TRIG_PORT       E
+#define TRIG_PIN        8                         /*RE8 / INT1*/
+#define CYCLES_PER_US   (SYS_CLK / 2000000ul)     /*core timer runs at SYS_CLK / 2*/
+#define RETRY_CYCLES    (2 * CYCLES_PER_US)       /*SPI bus busy: retry period of a pending action*/
+
+/*trigger state*/
+typedef enum {
+  TRIG_ST_OFF,        /*no target, or TRIG_MODE_OFF*/
+  TRIG_ST_ARMED,      /*waiting for an active edge*/
+  TRIG_ST_DELAY,      /*active edge received, waiting for the end of the delay*/
+  TRIG_ST_HOLDOFF,    /*action done, active edges ignored until the end of the holdoff*/
+  TRIG_ST_PENDING     /*action due, retried by the core timer until the SPI bus is released*/
+} trig_state_e;
+
+
+/**
+ * global variables
+ */
+trig_cfg_st trigCfg = {TRIG_MODE_OFF, TRIG_EDGE_RISING, 0, 0};
+trig_stat_st trigStat;
+
+
+/**
+ * local variables
+ */
+static trig_target_st target;
+static volatile trig_state_e state = TRIG_ST_OFF;
+static volatile bool bGateOpen = false;
+static uint32_t delayCycles, holdoffCycles;
+static volatile uint32_t tEdge;                             /*core timer, at the last accepted active edge*/
+static volatile uint32_t latLast, latMin, latMax, latCount; /*latency, in core timer cycles*/
+static void (* volatile pPending) (void *ctx);              /*action waiting for the SPI bus*/
+static volatile uint32_t tPending;                          /*core timer, at its theoretical action time*/
+static volatile bool bPendingStat;                          /*true: trigger action; false: gate closing*/
+static volatile trig_state_e statePending;                  /*state restored after a gate closing*/
+
+
+/**
+ * local functions
+ */
+static void TrigEdge(bool bActive, uint32_t now);
+static void TrigDelayElapsed(void);
+static void TrigFire(uint32_t tRef);
+static void TrigRun(void (*pAction) (void *ctx), uint32_t tRef, bool bStat);
+static bool TrigIsLevelActive(void);
+
+
+/**
+ * @function TRIG_Init
+ * @brief configure the trigger input (INT1) & the delay timer (core timer compare); trigger disabled
+ * @param none
+ * @return none
+ */
+void TRIG_Init(void) {
+
+  GPIO_SetPinDirection(TRIG_PORT, TRIG_PIN, GPIO_PIN_INPUT);
+  INTEnable(INT_INT1, INT_DISABLED);
+  INTEnable(INT_CT, INT_DISABLED);
+
+  /*above the ARB sample timer (ipl5): a trigger is never delayed by a sample output*/
+  INTSetVectorPriority(INT_EXTERNAL_1_VECTOR, INT_PRIORITY_LEVEL_6);
+  INTSetVectorSubPriority(INT_EXTERNAL_1_VECTOR, INT_SUB_PRIORITY_LEVEL_0);
+  INTSetVectorPriority(INT_CORE_TIMER_VECTOR, INT_PRIORITY_LEVEL_6);
+  INTSetVectorSubPriority(INT_CORE_TIMER_VECTOR, INT_SUB_PRIORITY_LEVEL_0);
+
+  memset(&target, 0, sizeof(target));
+  state = TRIG_ST_OFF;
+}
+
+
+/**
+ * @function TRIG_SetTarget
+ * @brief select the generator driven by the trigger, apply trigCfg & clear the statistics (kept when detached)
+ * @param const trig_target_st *target: generator (copied); NULL -> trigger disabled
+ * @return none
+ */
+void TRIG_SetTarget(const trig_target_st *_target) {
+
+  /*mask the trigger during the reconfiguration*/
+  INTEnable(INT_INT1, INT_DISABLED);
+  INTEnable(INT_CT, INT_DISABLED);
+
+  bGateOpen = false;
+  pPending = NULL;
+
+  if(trigCfg.delay < 0) trigCfg.delay = 0;
+  else if(trigCfg.delay > TRIG_DELAY_MAX) trigCfg.delay = TRIG_DELAY_MAX;
+  if(trigCfg.holdoff < 0) trigCfg.holdoff = 0;
+  else if(trigCfg.holdoff > TRIG_HOLDOFF_MAX) trigCfg.holdoff = TRIG_HOLDOFF_MAX;
+  delayCycles = (uint32_t) trigCfg.delay * CYCLES_PER_US;
+  holdoffCycles = (uint32_t) trigCfg.holdoff * CYCLES_PER_US;
+
+  if(_target != NULL && trigCfg.mode != TRIG_MODE_OFF && trigCfg.mode < _TRIG_MODE_COUNT) {
+    target = *_target;
+    state = TRIG_ST_ARMED;
+    latLast = latMin = latMax = latCount = 0;
+    memset(&trigStat, 0, sizeof(trigStat));
+
+    /*the generator waits for the trigger, except in STOP mode*/
+    if(trigCfg.mode != TRIG_MODE_STOP && target.pStop != NULL) {
+      target.pStop(target.ctx);
+    }
+
+    /*wait for the active edge; gate already open: generate it by software*/
+    INTCONbits.INT1EP = (trigCfg.edge == TRIG_EDGE_RISING)? 1: 0;
+    INTClearFlag(INT_INT1);
+    if(trigCfg.mode == TRIG_MODE_GATE && TrigIsLevelActive()) {
+      INTSetFlag(INT_INT1);
+    }
+    INTEnable(INT_INT1, INT_ENABLED);
+  }
+  else {
+    memset(&target, 0, sizeof(target));
+    state = TRIG_ST_OFF;
+  }
+}
+
+
+/**
+ * @function TRIG_Process
+ * @brief trigger task (holdoff expiry, statistics update); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void TRIG_Process(void) {
+
+  uint32_t lat, jitter;
+  bool bCoreTimer;
+
+  if(state != TRIG_ST_OFF) {
+
+    /*holdoff expiry is also checked here, since the core timer wraps every ~107s;
+    both trigger ISRs write the state & the latencies: mask them (the core timer one only if it is in use)*/
+    bCoreTimer = INTGetEnable(INT_CT)? true: false;
+    INTEnable(INT_CT, INT_DISABLED);
+    INTEnable(INT_INT1, INT_DISABLED);
+    if(state == TRIG_ST_HOLDOFF && TicksGetCycles() - tEdge >= holdoffCycles) {
+      state = TRIG_ST_ARMED;
+    }
+    lat = latLast;
+    jitter = latMax - latMin;
+    trigStat.count = latCount;
+    INTEnable(INT_INT1, INT_ENABLED);
+    if(bCoreTimer) INTEnable(INT_CT, INT_ENABLED);
+
+    trigStat.latency = (float) lat / CYCLES_PER_US;
+    trigStat.jitter = (float) jitter / CYCLES_PER_US;
+  }
+}
+
+
+/**
+ * @function TRIG_IsActive
+ * @brief tell if the trigger drives a generator
+ * @param none
+ * @return bool: true if a target is set & the mode is not TRIG_MODE_OFF
+ */
+bool TRIG_IsActive(void) {
+  return state != TRIG_ST_OFF;
+}
+
+
+/**
+ * @function TrigEdgeHandler
+ * @brief INT1 interruption handler (trigger input edge)
+ * @param none
+ * @return none
+ */
+void __ISR(_EXTERNAL_1_VECTOR, ipl6) TrigEdgeHandler(void) {
+
+  uint32_t now = TicksGetCycles();
+  bool bRising = INTCONbits.INT1EP? true: false;
+  bool bActive = (bRising == (trigCfg.edge == TRIG_EDGE_RISING));
+
+  INTClearFlag(INT_INT1);
+
+  /*gate: wait for the opposite edge; if the input already went back, the edge was missed -> set the flag*/
+  if(trigCfg.mode == TRIG_MODE_GATE) {
+    INTCONbits.INT1EP = bRising? 0: 1;
+    if((GPIO_GetPin(TRIG_PORT, TRIG_PIN)? true: false) != bRising) {
+      INTSetFlag(INT_INT1);
+    }
+  }
+
+  TrigEdge(bActive, now);
+}
+
+
+/**
+ * @function TrigDelayHandler
+ * @brief core timer interruption handler (end of the trigger delay)
+ * @param none
+ * @return none
+ */
+void __ISR(_CORE_TIMER_VECTOR, ipl6) TrigDelayHandler(void) {
+  TrigDelayElapsed();
+}
+
+
+/**
+ * @function TrigEdge
+ * @brief trigger state machine: edge event
+ * @param bool bActive: true -> active edge, false -> inactive edge
+ * @param uint32_t now: core timer, at the edge
+ * @return none
+ */
+static void TrigEdge(bool bActive, uint32_t now) {
+
+  /*gate: an edge cancels the opposite action if it still waits for the SPI bus*/
+  if(state == TRIG_ST_PENDING && trigCfg.mode == TRIG_MODE_GATE && bActive != bPendingStat) {
+    INTEnable(INT_CT, INT_DISABLED);
+    state = TRIG_ST_ARMED;
+    if(bActive == false) bGateOpen = false;   /*the gate never opened: nothing to stop*/
+  }
+
+  if(bActive) {
+
+    /*end of holdoff?*/
+    if(state == TRIG_ST_HOLDOFF && now - tEdge >= holdoffCycles) {
+      state = TRIG_ST_ARMED;
+    }
+
+    if(state == TRIG_ST_ARMED) {
+      tEdge = now;
+
+      if(delayCycles > 0) {
+        state = TRIG_ST_DELAY;
+        _CP0_SET_COMPARE(now + delayCycles);
+        INTClearFlag(INT_CT);
+        INTEnable(INT_CT, INT_ENABLED);
+
+        /*very short delay: the compare value may already be behind the core timer*/
+        if(TicksGetCycles() - now >= delayCycles) {
+          TrigDelayElapsed();
+        }
+      }
+      else {
+        TrigFire(now);
+      }
+    }
+  }
+
+  /*inactive edge: close the gate, or cancel its pending opening*/
+  else if(trigCfg.mode == TRIG_MODE_GATE) {
+    if(state == TRIG_ST_DELAY) {
+      INTEnable(INT_CT, INT_DISABLED);
+      state = TRIG_ST_ARMED;
+    }
+    if(bGateOpen && target.pStop != NULL) {
+      TrigRun(target.pStop, now, false);
+    }
+    bGateOpen = false;
+  }
+}
+
+
+/**
+ * @function TrigDelayElapsed
+ * @brief trigger state machine: end of the delay, or retry of a pending action
+ * @param none
+ * @return none
+ */
+static void TrigDelayElapsed(void) {
+  INTEnable(INT_CT, INT_DISABLED);
+  INTClearFlag(INT_CT);
+  if(state == TRIG_ST_DELAY) {
+    TrigFire(tEdge + delayCycles);
+  }
+  else if(state == TRIG_ST_PENDING && pPending != NULL) {
+    TrigRun(pPending, tPending, bPendingStat);
+  }
+}
+
+
+/**
+ * @function TrigFire
+ * @brief execute the action of the current mode
+ * @param uint32_t tRef: core timer, at the theoretical action time (edge + delay)
+ * @return none
+ */
+static void TrigFire(uint32_t tRef) {
+
+  void (*pAction) (void *ctx) = NULL;
+
+  switch(trigCfg.mode) {
+    case TRIG_MODE_START: pAction = target.pStart; break;
+    case TRIG_MODE_STOP:  pAction = target.pStop; break;
+    case TRIG_MODE_GATE:  pAction = target.pStart; bGateOpen = true; break;
+    case TRIG_MODE_STEP:  pAction = target.pStep; break;
+    default: break;
+  }
+
+  if(pAction != NULL) {
+    TrigRun(pAction, tRef, true);
+  }
+  else {
+    state = (holdoffCycles > 0)? TRIG_ST_HOLDOFF: TRIG_ST_ARMED;
+  }
+}
+
+
+/**
+ * @function TrigRun
+ * @brief execute an action if the SPI bus is free, else retry it from the core timer
+ * @param void (*pAction) (void *ctx): action (target function)
+ * @param uint32_t tRef: core timer, at the theoretical action time
+ * @param bool bStat: true -> trigger action (latency statistics, holdoff); false -> gate closing
+ * @return none
+ * @note the actions write the DDS / DAC: the lower priority code (main loop, ARB ISR) may own the bus
+ */
+static void TrigRun(void (*pAction) (void *ctx), uint32_t tRef, bool bStat) {
+
+  uint32_t lat;
+
+  if(IsSemLocked(spiBusy)) {
+    if(state != TRIG_ST_PENDING) statePending = state;
+    pPending = pAction;
+    tPending = tRef;
+    bPendingStat = bStat;
+    state = TRIG_ST_PENDING;
+    _CP0_SET_COMPARE(TicksGetCycles() + RETRY_CYCLES);
+    INTClearFlag(INT_CT);
+    INTEnable(INT_CT, INT_ENABLED);
+  }
+  else {
+    pAction(target.ctx);
+    pPending = NULL;
+
+    if(bStat) {
+      lat = TicksGetCycles() - tRef;
+      latLast = lat;
+      if(latCount == 0 || lat < latMin) latMin = lat;
+      if(latCount == 0 || lat > latMax) latMax = lat;
+      latCount++;
+      state = (holdoffCycles > 0)? TRIG_ST_HOLDOFF: TRIG_ST_ARMED;
+    }
+    else if(state == TRIG_ST_PENDING) {
+      state = statePending;
+    }
+  }
+}
+
+
+/**
+ * @function TrigIsLevelActive
+ * @brief tell if the trigger input is at its active level (level following the active edge)
+ * @param none
+ * @return bool: true if active
+ */
+static bool TrigIsLevelActive(void) {
+  bool bHigh = GPIO_GetPin(TRIG_PORT, TRIG_PIN)? true: false;
+  return bHigh == (trigCfg.edge == TRIG_EDGE_RISING);
+}
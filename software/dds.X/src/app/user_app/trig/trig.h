@@ -0,0 +1,118 @@
+/**
+ * @file trig.h
+ * @brief external trigger / gate input: starts, stops, gates or steps the active generator
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-24
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _trig_h_
+#define _trig_h_
+
+#include "usr_main.h"
+
+
+#define TRIG_DELAY_MAX      1000000   /*max trigger delay, in us*/
+#define TRIG_HOLDOFF_MAX    1000000   /*max trigger holdoff, in us*/
+
+/*trigger action*/
+typedef enum {
+  TRIG_MODE_OFF,      /*trigger input ignored*/
+  TRIG_MODE_START,    /*active edge: (re)start the generator from its first sample / phase 0*/
+  TRIG_MODE_STOP,     /*active edge: stop the generator*/
+  TRIG_MODE_GATE,     /*active edge: start; inactive edge: stop*/
+  TRIG_MODE_STEP,     /*active edge: advance the generator by one step (external sample clock)*/
+  _TRIG_MODE_COUNT
+} trig_mode_e;
+
+/*active edge*/
+typedef enum {
+  TRIG_EDGE_RISING,
+  TRIG_EDGE_FALLING
+} trig_edge_e;
+
+/**
+ * struct trig_cfg_st
+ * trigger configuration; applied by TRIG_SetTarget()
+ */
+typedef struct {
+  uint8_t mode;         /*see trig_mode_e*/
+  uint8_t edge;         /*see trig_edge_e*/
+  int32_t delay;        /*delay between the active edge & the action, in us*/
+  int32_t holdoff;      /*active edges are ignored during holdoff after an action, in us*/
+} trig_cfg_st;
+
+/**
+ * struct trig_stat_st
+ * latency between the trigger edge & the first output word (delay excluded)
+ */
+typedef struct {
+  float latency;        /*last latency, in us*/
+  float jitter;         /*max - min latency since the last TRIG_SetTarget(), in us*/
+  uint32_t count;       /*number of actions since the last TRIG_SetTarget()*/
+} trig_stat_st;
+
+/**
+ * struct trig_target_st
+ * generator driven by the trigger; the functions are called from the trigger ISR (ipl6) with the SPI bus free,
+ * & shall be short. A NULL function means that the corresponding action is not supported by the generator
+ */
+typedef struct {
+  void *ctx;                      /*generator descriptor, given to the functions below*/
+  void (*pStart) (void *ctx);     /*restart from the first sample / phase 0, first output word written before returning*/
+  void (*pStop) (void *ctx);      /*stop the output*/
+  void (*pStep) (void *ctx);      /*output the next step*/
+} trig_target_st;
+
+/**
+ * global variables
+ */
+extern trig_cfg_st trigCfg;
+extern trig_stat_st trigStat;
+
+/**
+ * @function TRIG_Init
+ * @brief configure the trigger input (INT1) & the delay timer (core timer compare); trigger disabled
+ * @param none
+ * @return none
+ */
+void TRIG_Init(void);
+
+/**
+ * @function TRIG_SetTarget
+ * @brief select the generator driven by the trigger, apply trigCfg & clear the statistics (kept when detached)
+ * @param const trig_target_st *target: generator (copied); NULL -> trigger disabled
+ * @return none
+ */
+void TRIG_SetTarget(const trig_target_st *target);
+
+/**
+ * @function TRIG_Process
+ * @brief trigger task (holdoff expiry, statistics update); shall be called cyclically
+ * @param none
+ * @return none
+ */
+void TRIG_Process(void);
+
+/**
+ * @function TRIG_IsActive
+ * @brief tell if the trigger drives a generator
+ * @param none
+ * @return bool: true if a target is set & the mode is not TRIG_MODE_OFF
+ */
+bool TRIG_IsActive(void);
+
+#endif
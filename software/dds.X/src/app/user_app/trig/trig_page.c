@@ -0,0 +1,201 @@
+/**
+ * @file trig_page.c
+ * @brief trigger config. page (mode, edge, delay, holdoff & latency statistics)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-24
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "gui_common.h"
+#include "trig.h"
+#include "trig_page.h"
+
+
+/**
+ * local variables
+ */
+static int8_t var8;
+static g_obj_st *pDelayVal, *pHoldoffVal;
+
+
+/**
+ * local functions
+ */
+static void TRIG_PageHandler(signal_t sig);
+static void LockValueBox(void);
+
+
+enum {
+
+  SIG_RVAL_DELAY = 1,
+  SIG_RVAL_HOLDOFF,
+  SIG_BTN_HOME,
+
+  _SIG_EDGE = 50,
+  SIG_EDGE_RISING = _SIG_EDGE + TRIG_EDGE_RISING,
+  SIG_EDGE_FALLING = _SIG_EDGE + TRIG_EDGE_FALLING,
+
+  _SIG_MODE = 100,
+  SIG_MODE_OFF = _SIG_MODE + TRIG_MODE_OFF,
+  SIG_MODE_START = _SIG_MODE + TRIG_MODE_START,
+  SIG_MODE_STOP = _SIG_MODE + TRIG_MODE_STOP,
+  SIG_MODE_GATE = _SIG_MODE + TRIG_MODE_GATE,
+  SIG_MODE_STEP = _SIG_MODE + TRIG_MODE_STEP
+};
+
+
+/**
+ * @function TRIG_Page
+ * @brief trigger config. page
+ * @param signal_t sig: unused
+ * @return none
+ */
+void TRIG_Page(signal_t sig) {
+
+  rect_st rec;
+
+  /*background*/
+  GUI_ClearAll();
+  DrawBackground();
+  SetFont(G_FONT_DEFAULT);
+
+  /*mode radios*/
+  rec = GUI_Rect(10, 10, 70, 29);
+  GUI_W_RadioAdd(&rec, "OFF", &trigCfg.mode, TRIG_MODE_OFF);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MODE_OFF);
+
+  rec.x += rec.w + 5;
+  GUI_W_RadioAdd(&rec, "START", &trigCfg.mode, TRIG_MODE_START);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MODE_START);
+
+  rec.x += rec.w + 5;
+  GUI_W_RadioAdd(&rec, "STOP", &trigCfg.mode, TRIG_MODE_STOP);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MODE_STOP);
+
+  rec = GUI_Rect(10, 44, 70, 29);
+  GUI_W_RadioAdd(&rec, "GATE", &trigCfg.mode, TRIG_MODE_GATE);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MODE_GATE);
+
+  rec.x += rec.w + 5;
+  GUI_W_RadioAdd(&rec, "STEP", &trigCfg.mode, TRIG_MODE_STEP);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_MODE_STEP);
+
+  /*edge radios*/
+  rec = GUI_Rect(10, 83, 70, 29);
+  GUI_W_RadioAdd(&rec, "RISE", &trigCfg.edge, TRIG_EDGE_RISING);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_EDGE_RISING);
+
+  rec.x += rec.w + 5;
+  GUI_W_RadioAdd(&rec, "FALL", &trigCfg.edge, TRIG_EDGE_FALLING);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_EDGE_FALLING);
+
+  /*delay value box*/
+  rec = GUI_Rect(8, 122, 70, 32);
+  GUI_W_TextAdd(&rec, "delay");
+  rec = GUI_Rect(80, 122, 152, 32);
+  pDelayVal = GUI_W_RotaryValueAdd(&rec, &trigCfg.delay, &var8, "us", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_DELAY);
+  GUI_W_RotaryValueSetMinMax(NULL, 0, TRIG_DELAY_MAX);
+
+  /*holdoff value box*/
+  rec = GUI_Rect(8, 157, 70, 32);
+  GUI_W_TextAdd(&rec, "holdoff");
+  rec = GUI_Rect(80, 157, 152, 32);
+  pHoldoffVal = GUI_W_RotaryValueAdd(&rec, &trigCfg.holdoff, &var8, "us", 0);
+  GUI_SetSignal(E_RELEASED_TO_PUSHED, SIG_RVAL_HOLDOFF);
+  GUI_W_RotaryValueSetMinMax(NULL, 0, TRIG_HOLDOFF_MAX);
+
+  LockValueBox();
+
+  /*latency statistics of the last triggered session*/
+  rec = GUI_Rect(120, 200, 112, 20);
+  GUI_W_ValueBoxAdd(&rec, &trigStat.latency, BOX_T_FLOAT, "lat. %.2fus");
+  rec.y += 22;
+  GUI_W_ValueBoxAdd(&rec, &trigStat.jitter, BOX_T_FLOAT, "jit. %.2fus");
+  rec.y += 22;
+  GUI_W_ValueBoxAdd(&rec, &trigStat.count, BOX_T_UINT32, "%lu trig.");
+
+  /*main rotary button*/
+  rec = GUI_Rect(8, 203, 102, 102);
+  GUI_W_RotaryButtonAdd(&rec, &var8, ROTARY_BTN_GR_30_DEG);
+
+  /*home button*/
+  rec = GUI_Rect(188, 270, 41, 41);
+  GUI_W_RadioImgAdd(&rec, G_DDS_BACK0, NULL, 0);
+  GUI_SetSignal(E_PUSHED_TO_RELEASED, SIG_BTN_HOME);
+
+  GUI_SetUserTask(TRIG_PageHandler);
+}
+
+
+/**
+ * @function TRIG_PageHandler
+ * @brief TRIG_Page handler
+ * @param signal_t sig: signal coming from widgets
+ * @return none
+ */
+static void TRIG_PageHandler(signal_t sig) {
+
+  switch(sig) {
+
+    /*home*/
+    case SIG_BTN_HOME:
+      GUI_SetUserTask(GUI_MainMenu);
+      break;
+
+    /*mode radios*/
+    case SIG_MODE_OFF:
+    case SIG_MODE_START:
+    case SIG_MODE_STOP:
+    case SIG_MODE_GATE:
+    case SIG_MODE_STEP:
+      trigCfg.mode = sig - _SIG_MODE;
+      break;
+
+    /*edge radios*/
+    case SIG_EDGE_RISING:
+    case SIG_EDGE_FALLING:
+      trigCfg.edge = sig - _SIG_EDGE;
+      break;
+
+    /*delay value box*/
+    case SIG_RVAL_DELAY:
+      LockValueBox();
+      GUI_W_RotaryValueLock(pDelayVal, false);
+      break;
+
+    /*holdoff value box*/
+    case SIG_RVAL_HOLDOFF:
+      LockValueBox();
+      GUI_W_RotaryValueLock(pHoldoffVal, false);
+      break;
+
+    default:
+      break;
+  }
+}
+
+
+/**
+ * @function LockValueBox
+ * @brief lock all valueboxes
+ * @param none
+ * @return none
+ */
+static void LockValueBox(void) {
+  GUI_W_RotaryValueLock(pDelayVal, true);
+  GUI_W_RotaryValueLock(pHoldoffVal, true);
+}
@@ -0,0 +1,35 @@
+/**
+ * @file trig_page.h
+ * @brief trigger config. page (mode, edge, delay, holdoff & latency statistics)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-05-24
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _trig_page_h_
+#define _trig_page_h_
+
+#include "usr_main.h"
+
+/**
+ * @function TRIG_Page
+ * @brief trigger config. page
+ * @param signal_t sig: unused
+ * @return none
+ */
+void TRIG_Page(signal_t sig);
+
+#endif
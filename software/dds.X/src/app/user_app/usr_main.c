@@ -27,6 +27,10 @@
 #include "spi.h"
 #include "gui_common.h"
 #include "wav_player.h"
+#include "multitone.h"
+#include "arb_harmonic.h"
+#include "trig.h"
+#include "fcnt.h"
 
 
 /**
@@ -46,6 +50,7 @@ void UserTask(void) {
     SPI_Init();
     DDS_Init(NULL, 0, true);
     DAC_Init(NULL, 0, true);
+    TRIG_Init();
 
     /*GUI init*/
     GUI_ClearAll();
@@ -54,6 +59,14 @@ void UserTask(void) {
     bInitialized = true;
   }
 
-  /*wav file process is the only background process*/
+  /*background processes: wav file & multi-tone block rendering, harmonic transforms, trigger statistics, frequency counter*/
   WavProcess();
+  MT_Process();
+  (void) ARB_HarmonicTask(ARB_HARMONIC_BUDGET);
+  TRIG_Process();
+  FCNT_Process();
+
+#ifdef INCLUDE_FRAME_BENCH
+  GUI_FrameBenchTask();
+#endif
 }
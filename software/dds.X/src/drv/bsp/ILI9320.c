@@ -7,7 +7,7 @@
  *                    2013-07-27: improvement of power-on sequence
  *                    2013-08-20: modification of <0x0003, 0x1038> (RGB swap, for compatibility with SDL)
  *                    2013-11-14: LCD_WriteReg is now accessible outside (for gamma ajdustement)
- *                    2014-02-20: support of display orientation (0, 90, 180, 270)
+ *                    2014-02-20: support of display orientation (0, 90, 180, 270�)
  *
  * Copyright (C) <2013>  Duboisset Philippe <duboisset.philippe@gmail.com>
  *
@@ -27,6 +27,7 @@
 #include "pmp.h"
 #include "gpio.h"
 #include "delay.h"
+#include "ticks.h"
 
 
 
@@ -42,6 +43,11 @@
 #define RS_DATA     {GPIO_SetPin(RS_PORT , RS_PIN , 1); Delay100ns();}
 #define RST_SET      GPIO_SetPin(RST_PORT, RST_PIN, 0)
 #define RST_RELEASE  GPIO_SetPin(RST_PORT, RST_PIN, 1)
+#define FMARK_PORT  E
+#define FMARK_PIN   9     /*RE9 / INT2, wired to the FMARK output of the panel*/
+
+#define DMA_LINE_LEN  256   /*pixels per DMA line buffer*/
+#define DMA_RUN_MIN   32    /*shorter runs are written by the CPU: cheaper than a DMA setup*/
 
 
 /**
@@ -50,6 +56,26 @@
 #define T_WAIT 0xFFFE
 #define CFGEND 0xFFFF
 static length_t lcd_w = 0, lcd_h = 0, xMax = 0, yMax = 0;
+static color_t dmaLine[2][DMA_LINE_LEN];  /*double buffer: one line is expanded while the other one is sent*/
+static uint8_t dmaLineId = 0;
+static uint32_t pxCnt = 0;                /*number of pixels sent to the GRAM (statistics)*/
+
+/*register shadow: window registers & GRAM address counter, in display coordinates*/
+static uint16_t wndShadow[4];             /*last values written into 0x0050-0x0053*/
+static coord_t wndX0, wndY0, wndX1, wndY1;
+static coord_t curX, curY;                /*GRAM address counter, tracked through the auto-increment*/
+static bool bShadowValid = false, bPosValid = false, bGramSelected = false;
+
+/*hardware scroll: screen line y shows the GRAM line drawn for y + scrollOff; a window crossing the GRAM end is split*/
+static coord_t scrollOff = 0;
+static coord_t wndYSplit;                 /*first line of the second part of a split window*/
+static bool bWndSplit = false;
+static uint32_t regWriteCnt = 0, regSavedCnt = 0;
+
+/*frame marker: one FMARK pulse per panel frame, when the scan is at the FMP line*/
+static volatile uint32_t fmarkCnt = 0;    /*number of markers received (0: FMARK not wired)*/
+static volatile uint32_t fmarkTime = 0;   /*core timer, at the last marker*/
+static volatile uint32_t fmarkPeriod = 0; /*core timer cycles between the last two markers*/
 static const uint16_t ili9320_cfg[] = {
 
   /*
@@ -60,7 +86,7 @@ static const uint16_t ili9320_cfg[] = {
   /*osc & Vcore setting*/
   0x00E5, 0x8000, /*0x00E5: Vcore setting*/
   0x0000, 0x0001, /*0x0000: Start Oscillator*/
-  T_WAIT,     12, /*8.2.3. "Wait at least 10ms to let the frequency of oscillator stable" */
+  T_WAIT,     12, /*�8.2.3. "Wait at least 10ms to let the frequency of oscillator stable" */
 
   /*power supply setting*/
   0x0010, 0x0000, /*0x0010: Power Control 1: clear*/
@@ -97,9 +123,9 @@ static const uint16_t ili9320_cfg[] = {
   0x0007, 0x0000, /*0x0007: Display Control 1 [PTDE1-0;BASEE;GON;DTE;CL;D1;D0]*/
   0x0008, 0x0404, /*0x0008: Display Control 2 [FP3-0;BP3-0]*/
   0x0009, 0x0000, /*0x0009: Display Control 3 [PTS2-0;PTG1-0;ISC3-0]*/
-  0x000A, 0x0000, /*0x000A: Display Control 4 [FMARKOE;FMI2-0]*/
+  0x000A, 0x0008, /*0x000A: Display Control 4 [FMARKOE;FMI2-0]: FMARK output, once per frame*/
   0x000C, 0x0000, /*0x000C: RGB Display Interface Control 1 [ENC2-0;RM;DM1-0;RIM1-0]*/
-  0x000D, 0x0000, /*0x000D: Frame Marker Position [FMP8-0]*/
+  0x000D, 0x0000, /*0x000D: Frame Marker Position [FMP8-0]: start of the back porch, i.e. just before the scan of the first line*/
   0x000F, 0x0000, /*0x000F: RGB Display Interface Control 2 [VSPL;HSPL;EPL;DPL]*/
   0x0060, 0xA700, /*0x0060: Driver Output Control 2 [GS;NL5-0;SCN5-0]*/
   0x0061, 0x0003, /*0x0061: Base Image Display Control [NDL;VLE;REV]*/
@@ -126,10 +152,63 @@ static const uint16_t ili9320_cfg[] = {
  * @return none
  */
 static void WriteReg(uint16_t addr, uint16_t data) {
+  PMP_DmaWait();
   RS_REGISTER;
   PMP_Write(addr);
   RS_DATA;
   PMP_Write(data);
+  bGramSelected = false;
+  regWriteCnt++;
+}
+
+
+/**
+ * @function WriteWndReg
+ * @brief write a window register (0x0050-0x0053), only if its value changed
+ * @param addr: SFR address
+ * @param data: 16bit word
+ * @return none
+ */
+static void WriteWndReg(uint16_t addr, uint16_t data) {
+  if(bShadowValid && wndShadow[addr - 0x0050] == data) {
+    regSavedCnt++;
+  }
+  else {
+    WriteReg(addr, data);
+    wndShadow[addr - 0x0050] = data;
+  }
+}
+
+
+/**
+ * @function CursorAdvance
+ * @brief follow the GRAM address counter auto-increment (raster order within the window) after n pixels
+ * @param uint32_t n: number of pixels written
+ * @return none
+ */
+static void CursorAdvance(uint32_t n) {
+
+  uint32_t w, rem;
+
+  if(bPosValid) {
+
+    if(curX < wndX0 || curX > wndX1 || curY < wndY0 || curY > wndY1) {
+      bPosValid = false;
+    }
+    else {
+      rem = (uint32_t) (wndX1 - curX + 1);
+      if(n < rem) {
+        curX += (coord_t) n;
+      }
+      else {
+        /*next line(s); the counter wraps to the window origin after its last pixel*/
+        n -= rem;
+        w = (uint32_t) (wndX1 - wndX0 + 1);
+        curX = wndX0 + (coord_t) (n % w);
+        curY = wndY0 + (coord_t) (((uint32_t) (curY - wndY0) + 1 + n / w) % (uint32_t) (wndY1 - wndY0 + 1));
+      }
+    }
+  }
 }
 
 
@@ -140,9 +219,99 @@ static void WriteReg(uint16_t addr, uint16_t data) {
  * @return none
  */
 static void WriteToGram(void) {
-  RS_REGISTER;
-  PMP_Write(0x22);
-  RS_DATA;
+  if(bGramSelected) {
+    regSavedCnt++;
+  }
+  else {
+    PMP_DmaWait();
+    RS_REGISTER;
+    PMP_Write(0x22);
+    RS_DATA;
+    bGramSelected = true;
+    regWriteCnt++;
+  }
+}
+
+
+/**
+ * @function ScrollMap
+ * @brief convert a screen line into the line of the GRAM which is currently displayed on it
+ * @param coord_t y: screen line
+ * @return coord_t: GRAM line, in screen coordinates
+ */
+static coord_t ScrollMap(coord_t y) {
+  y += scrollOff;
+  if(y >= (coord_t) lcd_h) y -= (coord_t) lcd_h;
+  return y;
+}
+
+
+/**
+ * @function WriteWnd
+ * @brief write the window registers; the window shall not cross the end of the GRAM
+ * @param coord_t x0, y0, x1, y1: window, GRAM lines in screen coordinates
+ * @return none
+ */
+static void WriteWnd(coord_t x0, coord_t y0, coord_t x1, coord_t y1) {
+
+#if DISP_ORIENTATION == 0
+  WriteWndReg(0x0050, y0);
+  WriteWndReg(0x0051, y1);
+  WriteWndReg(0x0052, x0);
+  WriteWndReg(0x0053, x1);
+#elif DISP_ORIENTATION == 180
+  WriteWndReg(0x0051, yMax - y0);
+  WriteWndReg(0x0050, yMax - y1);
+  WriteWndReg(0x0053, xMax - x0);
+  WriteWndReg(0x0052, xMax - x1);
+#elif DISP_ORIENTATION == 90
+  WriteWndReg(0x0052, y0);
+  WriteWndReg(0x0053, y1);
+  WriteWndReg(0x0051, xMax - x0);
+  WriteWndReg(0x0050, xMax - x1);
+#elif DISP_ORIENTATION == 270
+  WriteWndReg(0x0053, yMax - y0);
+  WriteWndReg(0x0052, yMax - y1);
+  WriteWndReg(0x0050, x0);
+  WriteWndReg(0x0051, x1);
+#endif
+
+  bShadowValid = true;
+}
+
+
+/**
+ * @function SplitSpan
+ * @brief number of pixels which can be sent before the cursor leaves the current part of a split window
+ * @param uint32_t n: number of pixels to send
+ * @return uint32_t: number of pixels to send before calling SplitNext(); n if the window is not split
+ */
+static uint32_t SplitSpan(uint32_t n) {
+
+  uint32_t k = n;
+  coord_t yEnd;
+
+  if(bWndSplit && bPosValid) {
+    yEnd = (curY < wndYSplit) ? wndYSplit - 1 : wndY1;
+    k = (uint32_t) (yEnd - curY) * (uint32_t) (wndX1 - wndX0 + 1) + (uint32_t) (wndX1 - curX + 1);
+    if(n < k) k = n;
+  }
+
+  return k;
+}
+
+
+/**
+ * @function SplitNext
+ * @brief once a part of a split window is full, move the GRAM address counter to the other part
+ * @param none
+ * @return none
+ */
+static void SplitNext(void) {
+  if(bWndSplit && bPosValid && curX == wndX0 && (curY == wndYSplit || curY == wndY0)) {
+    bPosValid = false;
+    LCD_SetPos(curX, curY);
+  }
 }
 
 
@@ -155,6 +324,12 @@ static void WriteToGram(void) {
  */
 void LCD_WriteReg(uint16_t addr, uint16_t data) {
   WriteReg(addr, data);
+
+  /*window or address counter: the shadow is lost; other registers (e.g. gamma) keep it, which a split window needs*/
+  if(addr == 0x0020 || addr == 0x0021 || (addr >= 0x0050 && addr <= 0x0053)) {
+    bShadowValid = false;
+    bPosValid = false;
+  }
   WriteToGram();
 }
 
@@ -189,6 +364,14 @@ void LCD_Init(void) {
   CS_UNSELECT; GPIO_SetPinDirection(CS_PORT, CS_PIN, GPIO_PIN_OUTPUT);
   RS_REGISTER; GPIO_SetPinDirection(RS_PORT, RS_PIN, GPIO_PIN_OUTPUT);
 
+  /*frame marker input: rising edge; below the signal generation interruptions (ARB ipl5, trigger ipl6)*/
+  GPIO_SetPinDirection(FMARK_PORT, FMARK_PIN, GPIO_PIN_INPUT);
+  INTEnable(INT_INT2, INT_DISABLED);
+  INTCONbits.INT2EP = 1;
+  INTSetVectorPriority(INT_EXTERNAL_2_VECTOR, INT_PRIORITY_LEVEL_2);
+  INTSetVectorSubPriority(INT_EXTERNAL_2_VECTOR, INT_SUB_PRIORITY_LEVEL_0);
+  fmarkCnt = fmarkTime = fmarkPeriod = 0;
+
   CS_SELECT;    /*select the controler, for ever (lcd is alone on the PMP)*/
   DelayMs(1);   /*tres >= 1ms*/
   RST_RELEASE;
@@ -213,8 +396,13 @@ void LCD_Init(void) {
   }
 
   /*clear windows & position*/
+  scrollOff = 0;
   LCD_SetWnd(NULL);
   LCD_SetPos(0, 0);
+
+  /*FMARK is output from now on*/
+  INTClearFlag(INT_INT2);
+  INTEnable(INT_INT2, INT_ENABLED);
 }
 
 
@@ -249,20 +437,40 @@ length_t LCD_GetHeight(void) {
  */
 void LCD_SetPos(coord_t x, coord_t y) {
 
+  coord_t gy;
+
+  /*skip the address counter if it already points to (x, y)*/
+  if(bPosValid && x == curX && y == curY) {
+    regSavedCnt += 2;
+  }
+  else {
+
+    /*split window: the hardware window is the part which contains y*/
+    if(bWndSplit) {
+      if(y < wndYSplit) WriteWnd(wndX0, ScrollMap(wndY0), wndX1, (coord_t) lcd_h - 1);
+      else WriteWnd(wndX0, 0, wndX1, ScrollMap(wndY1));
+    }
+    gy = ScrollMap(y);
+
 #if DISP_ORIENTATION == 0
-  WriteReg(0x0020, y);
-  WriteReg(0x0021, x);
+    WriteReg(0x0020, gy);
+    WriteReg(0x0021, x);
 #elif DISP_ORIENTATION == 180
-  WriteReg(0x0020, yMax - y);
-  WriteReg(0x0021, xMax - x);
+    WriteReg(0x0020, yMax - gy);
+    WriteReg(0x0021, xMax - x);
 #elif DISP_ORIENTATION == 90
-  WriteReg(0x0020, xMax - x);
-  WriteReg(0x0021, y);
+    WriteReg(0x0020, xMax - x);
+    WriteReg(0x0021, gy);
 #elif DISP_ORIENTATION == 270
-  WriteReg(0x0020, x);
-  WriteReg(0x0021, yMax - y);
+    WriteReg(0x0020, x);
+    WriteReg(0x0021, yMax - gy);
 #endif
 
+    curX = x;
+    curY = y;
+    bPosValid = true;
+  }
+
   WriteToGram();
 }
 
@@ -285,30 +493,18 @@ void LCD_SetWnd(const rect_st *rec) {
     lrect.h = lcd_h;
   }
 
-#if DISP_ORIENTATION == 0
-  WriteReg(0x0050, lrect.y);
-  WriteReg(0x0051, lrect.y + lrect.h - 1);
-  WriteReg(0x0052, lrect.x);
-  WriteReg(0x0053, lrect.x + lrect.w - 1);
-#elif DISP_ORIENTATION == 180
-  WriteReg(0x0051, yMax - lrect.y);
-  WriteReg(0x0050, yMax - (lrect.y + lrect.h - 1));
-  WriteReg(0x0053, xMax - lrect.x);
-  WriteReg(0x0052, xMax - (lrect.x + lrect.w - 1));
-#elif DISP_ORIENTATION == 90
-  WriteReg(0x0052, lrect.y);
-  WriteReg(0x0053, lrect.y + lrect.h - 1);
-  WriteReg(0x0051, xMax - lrect.x);
-  WriteReg(0x0050, xMax - (lrect.x + lrect.w - 1));
-#elif DISP_ORIENTATION == 270
-  WriteReg(0x0053, yMax - lrect.y);
-  WriteReg(0x0052, yMax - (lrect.y + lrect.h - 1));
-  WriteReg(0x0050, lrect.x);
-  WriteReg(0x0051, lrect.x + lrect.w - 1);
-#endif
+  wndX0 = lrect.x;
+  wndY0 = lrect.y;
+  wndX1 = lrect.x + lrect.w - 1;
+  wndY1 = lrect.y + lrect.h - 1;
+
+  /*scrolled screen: a window crossing the end of the GRAM is set part by part, by LCD_SetPos()*/
+  wndYSplit = (coord_t) lcd_h - scrollOff;
+  bWndSplit = (scrollOff > 0 && wndY0 < wndYSplit && wndY1 >= wndYSplit) ? true : false;
+  if(bWndSplit) bPosValid = false;
+  else WriteWnd(wndX0, ScrollMap(wndY0), wndX1, ScrollMap(wndY1));
 
   LCD_SetPos(lrect.x, lrect.y);
-  WriteToGram();
 }
 
 
@@ -319,5 +515,372 @@ void LCD_SetWnd(const rect_st *rec) {
  * @return none
  */
 void LCD_Put(color_t col) {
+  pxCnt++;
+  CursorAdvance(1);
+  PMP_DmaWait();
   PMP_Write(col);
+  SplitNext();
+}
+
+
+/**
+ * @function PutNPart
+ * @brief put n pixels of the same color, and increment the cursor position (within a part of a split window)
+ * @param color_t col: pixel color
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutNPart(color_t col, uint32_t n) {
+
+  color_t *line;
+  uint16_t i, len;
+
+  pxCnt += n;
+  CursorAdvance(n);
+
+  /*long run: DMA fill from a line of <col>, without waiting for the end of the transfer*/
+  if(n >= DMA_RUN_MIN) {
+    len = (n > DMA_LINE_LEN)? DMA_LINE_LEN: (uint16_t) n;
+    line = dmaLine[dmaLineId];
+    for(i = 0; i < len; i++) line[i] = col;
+    PMP_DmaWriteRepeat(line, len, n, NULL);
+    dmaLineId ^= 1;
+  }
+  else {
+    PMP_DmaWait();
+
+    /*unrolled: one loop test for 4 PMP writes*/
+    while(n >= 4) {
+      PMP_Write(col);
+      PMP_Write(col);
+      PMP_Write(col);
+      PMP_Write(col);
+      n -= 4;
+    }
+    while(n-- > 0) PMP_Write(col);
+  }
+}
+
+
+/**
+ * @function LCD_PutN
+ * @brief put n pixels of the same color, and increment the cursor position
+ * @param color_t col: pixel color
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutN(color_t col, uint32_t n) {
+
+  uint32_t k;
+
+  while(n > 0) {
+    k = SplitSpan(n);
+    PutNPart(col, k);
+    SplitNext();
+    n -= k;
+  }
+}
+
+
+/**
+ * @function PutRunPart
+ * @brief put n pixels from an array, and increment the cursor position (within a part of a split window)
+ * @param const color_t *src: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutRunPart(const color_t *src, uint32_t n) {
+
+  color_t *line;
+  uint16_t i, len;
+
+  pxCnt += n;
+  CursorAdvance(n);
+
+  /*long run: copied line per line, each line sent by DMA while the next one is copied*/
+  while(n >= DMA_RUN_MIN) {
+    len = (n > DMA_LINE_LEN)? DMA_LINE_LEN: (uint16_t) n;
+    line = dmaLine[dmaLineId];
+    for(i = 0; i < len; i++) line[i] = *src++;
+    PMP_DmaWrite(line, len, NULL);
+    dmaLineId ^= 1;
+    n -= len;
+  }
+
+  /*remaining short run, by CPU*/
+  if(n > 0) PMP_DmaWait();
+  while(n >= 4) {
+    PMP_Write(src[0]);
+    PMP_Write(src[1]);
+    PMP_Write(src[2]);
+    PMP_Write(src[3]);
+    src += 4;
+    n -= 4;
+  }
+  while(n-- > 0) PMP_Write(*src++);
+}
+
+
+/**
+ * @function LCD_PutRun
+ * @brief put n pixels from an array, and increment the cursor position
+ * @param const color_t *src: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutRun(const color_t *src, uint32_t n) {
+
+  uint32_t k;
+
+  while(n > 0) {
+    k = SplitSpan(n);
+    PutRunPart(src, k);
+    SplitNext();
+    src += k;
+    n -= k;
+  }
+}
+
+
+/**
+ * @function PutLut8RunPart
+ * @brief put n pixels from an array of 8bit indexes, through a lut, and increment the cursor position (within a part of a split window)
+ * @param const uint8_t *src: pixel indexes
+ * @param const color_t *lut: lut (256 entries, or at least max(src) + 1)
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+static void PutLut8RunPart(const uint8_t *src, const color_t *lut, uint32_t n) {
+
+  color_t *line;
+  uint16_t i, len;
+
+  pxCnt += n;
+  CursorAdvance(n);
+
+  /*long run: expanded to RGB565 line per line, each line sent by DMA while the next one is expanded*/
+  while(n >= DMA_RUN_MIN) {
+    len = (n > DMA_LINE_LEN)? DMA_LINE_LEN: (uint16_t) n;
+    line = dmaLine[dmaLineId];
+    for(i = 0; i < len; i++) line[i] = lut[*src++];
+    PMP_DmaWrite(line, len, NULL);
+    dmaLineId ^= 1;
+    n -= len;
+  }
+
+  /*remaining short run, by CPU*/
+  if(n > 0) PMP_DmaWait();
+  while(n >= 4) {
+    PMP_Write(lut[src[0]]);
+    PMP_Write(lut[src[1]]);
+    PMP_Write(lut[src[2]]);
+    PMP_Write(lut[src[3]]);
+    src += 4;
+    n -= 4;
+  }
+  while(n-- > 0) PMP_Write(lut[*src++]);
+}
+
+
+/**
+ * @function LCD_PutLut8Run
+ * @brief put n pixels from an array of 8bit indexes, through a lut, and increment the cursor position
+ * @param const uint8_t *src: pixel indexes
+ * @param const color_t *lut: lut (256 entries, or at least max(src) + 1)
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutLut8Run(const uint8_t *src, const color_t *lut, uint32_t n) {
+
+  uint32_t k;
+
+  while(n > 0) {
+    k = SplitSpan(n);
+    PutLut8RunPart(src, lut, k);
+    SplitNext();
+    src += k;
+    n -= k;
+  }
+}
+
+
+/**
+ * @function LCD_GetRun
+ * @brief read n pixels from the GRAM, from the cursor position (set by LCD_SetPos or LCD_SetWnd)
+ * @param color_t *dst: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_GetRun(color_t *dst, uint32_t n) {
+
+  uint32_t k;
+  coord_t x, y;
+
+  while(n > 0) {
+    k = SplitSpan(n);
+    WriteToGram();
+
+    /*the ILI9320 outputs a dummy word after its GRAM has been selected*/
+    PMP_Read(dst, k, 1);
+    CursorAdvance(k);
+    bGramSelected = false;
+    dst += k;
+    n -= k;
+
+    /*the address counter has moved (one read ahead): set it again for the next part, if any*/
+    x = curX;
+    y = curY;
+    bPosValid = false;
+    if(n > 0) LCD_SetPos(x, y);
+  }
+}
+
+
+/**
+ * @function LCD_ScrollV
+ * @brief hardware vertical scroll of a screen area: its content moves up by dy lines (down if dy < 0);
+ *        the lines exposed at the bottom (top if dy < 0) keep an old content & shall be redrawn.
+ *        Next operations still use screen coordinates (the driver remaps them into the GRAM).
+ *        The ILI9320 scrolls its whole base image only (partial images need the base image off)
+ * @param const rect_st *rec: scrolled area; shall be the whole screen (or NULL)
+ * @param coord_t dy: number of lines, range[-(LCD_GetHeight()-1) - (LCD_GetHeight()-1)]
+ * @return int8_t: 0 success, -1 error (area not supported, dy out of range, or gate lines along x: 0 / 180)
+ */
+int8_t LCD_ScrollV(const rect_st *rec, coord_t dy) {
+
+  int8_t res = -1;
+  bool bScreen;
+
+  bScreen = (rec == NULL || (rec->x == 0 && rec->y == 0 && rec->w == lcd_w && rec->h == lcd_h)) ? true : false;
+
+#if DISP_ORIENTATION == 90 || DISP_ORIENTATION == 270
+  if(bScreen && dy > -(coord_t) lcd_h && dy < (coord_t) lcd_h) {
+
+    scrollOff += dy;
+    if(scrollOff < 0) scrollOff += (coord_t) lcd_h;
+    else if(scrollOff >= (coord_t) lcd_h) scrollOff -= (coord_t) lcd_h;
+
+    /*VL: first GRAM line displayed; with 270, the gate lines run from the bottom of the screen*/
+  #if DISP_ORIENTATION == 90
+    WriteReg(0x006A, scrollOff);
+  #else
+    WriteReg(0x006A, (scrollOff == 0) ? 0 : lcd_h - scrollOff);
+  #endif
+
+    /*window & cursor are set again with the new mapping*/
+    bPosValid = false;
+    LCD_SetWnd(NULL);
+    res = 0;
+  }
+#else
+  (void) bScreen;
+  (void) dy;
+#endif
+
+  return res;
+}
+
+
+/**
+ * @function LCD_PutRunAsync
+ * @brief put n pixels from an array by DMA, without copy & without waiting for the end of the transfer
+ * @param const color_t *src: pixel colors; shall remain valid & unmodified until the end of the transfer
+ * @param uint32_t n: number of pixels
+ * @param pmpDmaCallback_t cb: end of transfer callback (called under interruption); may be NULL
+ * @return none
+ */
+void LCD_PutRunAsync(const color_t *src, uint32_t n, pmpDmaCallback_t cb) {
+
+  uint32_t k;
+
+  /*split window: one transfer per part; the callback is given to the last one*/
+  do {
+    k = SplitSpan(n);
+    pxCnt += k;
+    CursorAdvance(k);
+    PMP_DmaWrite(src, k, (k == n) ? cb : NULL);
+    SplitNext();
+    src += k;
+    n -= k;
+  } while(n > 0);
+}
+
+
+/**
+ * @function LCD_IsBusy
+ * @brief tell if a DMA transfer to the display is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool LCD_IsBusy(void) {
+  return PMP_DmaIsBusy();
+}
+
+
+/**
+ * @function LCD_Sync
+ * @brief wait for the end of the DMA transfers to the display
+ * @param none
+ * @return none
+ */
+void LCD_Sync(void) {
+  PMP_DmaWait();
+}
+
+
+/**
+ * @function LCD_GetPixelCnt
+ * @brief return the number of pixels sent to the display since startup (wraps around)
+ * @param none
+ * @return uint32_t: pixel count
+ */
+uint32_t LCD_GetPixelCnt(void) {
+  return pxCnt;
+}
+
+
+/**
+ * @function LCD_GetRegStat
+ * @brief return the number of register writes performed & saved by the register shadow since startup (wrap around)
+ * @param uint32_t *pWritten: register writes sent to the display; may be NULL
+ * @param uint32_t *pSaved: register writes skipped (unchanged window, cursor already in place); may be NULL
+ * @return none
+ */
+void LCD_GetRegStat(uint32_t /*@null@*/ *pWritten, uint32_t /*@null@*/ *pSaved) {
+  if(pWritten != NULL) *pWritten = regWriteCnt;
+  if(pSaved != NULL) *pSaved = regSavedCnt;
+}
+
+
+/**
+ * @function LCD_GetFrameMark
+ * @brief return the frame marker (FMARK) state: the panel scan starts a new frame right after each marker
+ * @param uint32_t *pCnt: number of markers received since startup (wraps around; 0: FMARK not wired); may be NULL
+ * @param uint32_t *pTime: core timer (TicksGetCycles()), at the last marker; may be NULL
+ * @param uint32_t *pPeriod: core timer cycles between the last two markers (0: unknown); may be NULL
+ * @return none
+ */
+void LCD_GetFrameMark(uint32_t /*@null@*/ *pCnt, uint32_t /*@null@*/ *pTime, uint32_t /*@null@*/ *pPeriod) {
+  INTEnable(INT_INT2, INT_DISABLED);
+  if(pCnt != NULL) *pCnt = fmarkCnt;
+  if(pTime != NULL) *pTime = fmarkTime;
+  if(pPeriod != NULL) *pPeriod = fmarkPeriod;
+  INTEnable(INT_INT2, INT_ENABLED);
+}
+
+
+/**
+ * @function LCD_FmarkHandler
+ * @brief INT2 interruption handler (frame marker)
+ * @param none
+ * @return none
+ */
+void __ISR(_EXTERNAL_2_VECTOR, ipl2) LCD_FmarkHandler(void) {
+
+  uint32_t now = TicksGetCycles();
+
+  INTClearFlag(INT_INT2);
+  if(fmarkCnt > 0) fmarkPeriod = now - fmarkTime;
+  fmarkTime = now;
+  fmarkCnt++;
 }
@@ -27,6 +27,7 @@
 #define _ILI9320_h_
 
 #include "main.h"
+#include "pmp.h"
 
 
 #define DISP_ORIENTATION  270 /*0 / 90 / 180 / 270*/
@@ -98,4 +99,106 @@ void LCD_SetWnd(const rect_st *rec);
  */
 void LCD_Put(color_t col);
 
+/**
+ * @function LCD_PutN
+ * @brief put n pixels of the same color, and increment the cursor position
+ * @param color_t col: pixel color
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutN(color_t col, uint32_t n);
+
+/**
+ * @function LCD_PutRun
+ * @brief put n pixels from an array, and increment the cursor position
+ * @param const color_t *src: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutRun(const color_t *src, uint32_t n);
+
+/**
+ * @function LCD_PutLut8Run
+ * @brief put n pixels from an array of 8bit indexes, through a lut, and increment the cursor position
+ * @param const uint8_t *src: pixel indexes
+ * @param const color_t *lut: lut (256 entries, or at least max(src) + 1)
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_PutLut8Run(const uint8_t *src, const color_t *lut, uint32_t n);
+
+/**
+ * @function LCD_GetRun
+ * @brief read n pixels from the GRAM, from the cursor position (set by LCD_SetPos or LCD_SetWnd)
+ * @param color_t *dst: pixel colors
+ * @param uint32_t n: number of pixels
+ * @return none
+ */
+void LCD_GetRun(color_t *dst, uint32_t n);
+
+/**
+ * @function LCD_ScrollV
+ * @brief hardware vertical scroll of a screen area: its content moves up by dy lines (down if dy < 0);
+ *        the lines exposed at the bottom (top if dy < 0) keep an old content & shall be redrawn.
+ *        Next operations still use screen coordinates (the driver remaps them into the GRAM).
+ *        The ILI9320 scrolls its whole base image only (partial images need the base image off)
+ * @param const rect_st *rec: scrolled area; shall be the whole screen (or NULL)
+ * @param coord_t dy: number of lines, range[-(LCD_GetHeight()-1) - (LCD_GetHeight()-1)]
+ * @return int8_t: 0 success, -1 error (area not supported, dy out of range, or gate lines along x: 0 / 180)
+ */
+int8_t LCD_ScrollV(const rect_st *rec, coord_t dy);
+
+/**
+ * @function LCD_PutRunAsync
+ * @brief put n pixels from an array by DMA, without copy & without waiting for the end of the transfer
+ * @param const color_t *src: pixel colors; shall remain valid & unmodified until the end of the transfer
+ * @param uint32_t n: number of pixels
+ * @param pmpDmaCallback_t cb: end of transfer callback (called under interruption); may be NULL
+ * @return none
+ */
+void LCD_PutRunAsync(const color_t *src, uint32_t n, pmpDmaCallback_t cb);
+
+/**
+ * @function LCD_IsBusy
+ * @brief tell if a DMA transfer to the display is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool LCD_IsBusy(void);
+
+/**
+ * @function LCD_Sync
+ * @brief wait for the end of the DMA transfers to the display
+ * @param none
+ * @return none
+ */
+void LCD_Sync(void);
+
+/**
+ * @function LCD_GetPixelCnt
+ * @brief return the number of pixels sent to the display since startup (wraps around)
+ * @param none
+ * @return uint32_t: pixel count
+ */
+uint32_t LCD_GetPixelCnt(void);
+
+/**
+ * @function LCD_GetRegStat
+ * @brief return the number of register writes performed & saved by the register shadow since startup (wrap around)
+ * @param uint32_t *pWritten: register writes sent to the display; may be NULL
+ * @param uint32_t *pSaved: register writes skipped (unchanged window, cursor already in place); may be NULL
+ * @return none
+ */
+void LCD_GetRegStat(uint32_t /*@null@*/ *pWritten, uint32_t /*@null@*/ *pSaved);
+
+/**
+ * @function LCD_GetFrameMark
+ * @brief return the frame marker (FMARK) state: the panel scan starts a new frame right after each marker
+ * @param uint32_t *pCnt: number of markers received since startup (wraps around; 0: FMARK not wired); may be NULL
+ * @param uint32_t *pTime: core timer (TicksGetCycles()), at the last marker; may be NULL
+ * @param uint32_t *pPeriod: core timer cycles between the last two markers (0: unknown); may be NULL
+ * @return none
+ */
+void LCD_GetFrameMark(uint32_t /*@null@*/ *pCnt, uint32_t /*@null@*/ *pTime, uint32_t /*@null@*/ *pPeriod);
+
 #endif
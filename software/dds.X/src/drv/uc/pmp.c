@@ -22,6 +22,28 @@
 #include "pmp.h"
 #include "hw_config.h"
 
+#define PMP_DMA_CHN         DMA_CHANNEL0
+#define PMP_DMA_BLOCK_MAX   0xFFFE    /*max bytes per DMA block (16bit size registers), even*/
+#define PMP_READ_WAITM      15        /*read strobe wait states: devices are much slower in read than in write*/
+
+
+/**
+ * local variables
+ */
+static volatile bool bDmaBusy = false;
+static volatile pmpDmaCallback_t dmaCallback = NULL;
+static const uint16_t *dmaSrc;        /*source of the next block*/
+static uint32_t dmaRemaining;         /*bytes remaining after the current block*/
+static uint32_t dmaBlockMax;          /*max bytes per block: pattern length for a repeated pattern*/
+static bool bDmaRepeat;
+
+
+/**
+ * local functions
+ */
+static void PmpDmaStart(const uint16_t *src, uint32_t bytes, uint32_t blockMax, bool bRepeat, pmpDmaCallback_t cb);
+static void PmpDmaNextBlock(void);
+
 
 /**
  * @function PMP_Init
@@ -40,5 +62,182 @@ void PMP_Init(void) {
   PMMODEbits.MODE16 = 1;                          //16 bit mode
   PMCONbits.PTRDEN = 1;                           //enable RD line
   PMCONbits.PTWREN = 1;                           //enable WR line
+  PMMODEbits.IRQM = 1;                            //PMP IRQ at the end of each write cycle: DMA cell trigger
   PMCONbits.PMPEN = 1;                            //enable PMP
+
+  /*DMA: one 16bit cell written into PMDIN per PMP IRQ; the first cell of each block is forced*/
+  DmaChnOpen(PMP_DMA_CHN, DMA_CHN_PRI2, DMA_OPEN_DEFAULT);
+  DmaChnSetEventControl(PMP_DMA_CHN, DMA_EV_START_IRQ_EN | DMA_EV_START_IRQ(_PMP_IRQ));
+  DmaChnSetEvEnableFlags(PMP_DMA_CHN, DMA_EV_BLOCK_DONE);
+  INTSetVectorPriority(INT_VECTOR_DMA(PMP_DMA_CHN), INT_PRIORITY_LEVEL_2);
+  INTSetVectorSubPriority(INT_VECTOR_DMA(PMP_DMA_CHN), INT_SUB_PRIORITY_LEVEL_0);
+  INTClearFlag(INT_SOURCE_DMA(PMP_DMA_CHN));
+  INTEnable(INT_SOURCE_DMA(PMP_DMA_CHN), INT_ENABLED);
+}
+
+
+/**
+ * @function PMP_DmaWrite
+ * @brief write a 16bit word buffer to the PMP by DMA; waits for the end of the previous DMA transfer, then returns
+ *        without waiting for the end of this one. src shall remain valid until the end of the transfer
+ * @param const uint16_t *src: words to write
+ * @param uint32_t n: number of words
+ * @param pmpDmaCallback_t cb: end of transfer callback; may be NULL
+ * @return none
+ */
+void PMP_DmaWrite(const uint16_t *src, uint32_t n, pmpDmaCallback_t cb) {
+  PmpDmaStart(src, n * sizeof(uint16_t), PMP_DMA_BLOCK_MAX, false, cb);
+}
+
+
+/**
+ * @function PMP_DmaWriteRepeat
+ * @brief write a pattern of 16bit words to the PMP by DMA, repeated until n words are written (e.g. constant color fill);
+ *        same behaviour than PMP_DmaWrite()
+ * @param const uint16_t *pattern: pattern to repeat
+ * @param uint16_t len: pattern length, in words (the longer, the less DMA interruptions)
+ * @param uint32_t n: total number of words
+ * @param pmpDmaCallback_t cb: end of transfer callback; may be NULL
+ * @return none
+ */
+void PMP_DmaWriteRepeat(const uint16_t *pattern, uint16_t len, uint32_t n, pmpDmaCallback_t cb) {
+  /*a block ends when max(source size, destination size) bytes are moved: with a 1 word source, each block
+  would be 1 pixel long -> the pattern length sets the block length, & the pattern is replayed for each block*/
+  if(len > PMP_DMA_BLOCK_MAX / sizeof(uint16_t)) len = PMP_DMA_BLOCK_MAX / sizeof(uint16_t);
+  PmpDmaStart(pattern, n * sizeof(uint16_t), (uint32_t) len * sizeof(uint16_t), true, cb);
+}
+
+
+/**
+ * @function PMP_DmaIsBusy
+ * @brief tell if a DMA transfer is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool PMP_DmaIsBusy(void) {
+  return bDmaBusy;
+}
+
+
+/**
+ * @function PMP_DmaWait
+ * @brief wait for the end of the current DMA transfer; shall be called before any CPU access to the PMP
+ * @param none
+ * @return none
+ */
+void PMP_DmaWait(void) {
+  while(bDmaBusy);
+}
+
+
+/**
+ * @function PMP_Read
+ * @brief read 16bit words from the PMP, with a slower read strobe; waits for the end of the DMA transfer first
+ * @param uint16_t *dst: words read
+ * @param uint32_t n: number of words
+ * @param uint8_t dummy: number of leading words read & dropped (device latency)
+ * @return none
+ */
+void PMP_Read(uint16_t *dst, uint32_t n, uint8_t dummy) {
+
+  uint32_t mode;
+
+  PMP_DmaWait();
+  while(PMMODEbits.BUSY);
+  mode = PMMODE;
+  PMMODEbits.WAITM = PMP_READ_WAITM;
+
+  /*each PMDIN read returns the word of the previous cycle & starts the next one: the first value is meaningless*/
+  (void) PMDIN;
+  while(dummy-- > 0) {
+    while(PMMODEbits.BUSY);
+    (void) PMDIN;
+  }
+  while(n-- > 0) {
+    while(PMMODEbits.BUSY);
+    *dst++ = PMDIN;
+  }
+
+  /*restore the write timings; the read IRQs shall not trigger the next DMA transfer*/
+  while(PMMODEbits.BUSY);
+  PMMODE = mode;
+  INTClearFlag(INT_PMP);
+}
+
+
+/**
+ * @function PmpDmaStart
+ * @brief start a DMA transfer to the PMP, once the previous one is done
+ * @param const uint16_t *src: source
+ * @param uint32_t bytes: total number of bytes to write
+ * @param uint32_t blockMax: max number of bytes per block (even, > 0)
+ * @param bool bRepeat: true: each block starts at src, false: each block follows the previous one
+ * @param pmpDmaCallback_t cb: end of transfer callback; may be NULL
+ * @return none
+ */
+static void PmpDmaStart(const uint16_t *src, uint32_t bytes, uint32_t blockMax, bool bRepeat, pmpDmaCallback_t cb) {
+
+  PMP_DmaWait();
+
+  if(src != NULL && bytes > 0) {
+    dmaSrc = src;
+    dmaRemaining = bytes;
+    dmaBlockMax = blockMax;
+    bDmaRepeat = bRepeat;
+    dmaCallback = cb;
+    bDmaBusy = true;
+    PmpDmaNextBlock();
+  }
+  else if(cb != NULL) {
+    cb();
+  }
+}
+
+
+/**
+ * @function PmpDmaNextBlock
+ * @brief program & start the next block of the current transfer
+ * @param none
+ * @return none
+ */
+static void PmpDmaNextBlock(void) {
+
+  uint32_t size;
+
+  size = dmaRemaining;
+  if(size > dmaBlockMax) size = dmaBlockMax;
+
+  DmaChnSetTxfer(PMP_DMA_CHN, (const void *) dmaSrc, (void *) &PMDIN, size, sizeof(uint16_t), sizeof(uint16_t));
+  dmaRemaining -= size;
+  if(bDmaRepeat == false) dmaSrc += size / sizeof(uint16_t);
+
+  /*the last CPU / DMA write shall be finished, & its IRQ shall not start the new block*/
+  while(PMMODEbits.BUSY);
+  INTClearFlag(INT_PMP);
+  DmaChnStartTxfer(PMP_DMA_CHN, DMA_WAIT_NOT, 0);
+}
+
+
+/**
+ * @function PmpDmaHandler
+ * @brief DMA interruption handler: end of block -> next block or end of transfer
+ * @param none
+ * @return none
+ */
+void __ISR(_DMA_0_VECTOR, ipl2) PmpDmaHandler(void) {
+
+  pmpDmaCallback_t cb;
+
+  DmaChnClrEvFlags(PMP_DMA_CHN, DMA_EV_ALL_EVNTS);
+  INTClearFlag(INT_SOURCE_DMA(PMP_DMA_CHN));
+
+  if(dmaRemaining > 0) {
+    PmpDmaNextBlock();
+  }
+  else {
+    cb = dmaCallback;
+    dmaCallback = NULL;
+    bDmaBusy = false;
+    if(cb != NULL) cb();
+  }
 }
@@ -34,6 +34,61 @@
  */
 void PMP_Init(void);
 
+/**
+ * pmpDmaCallback_t: end of DMA transfer callback; called under interruption (DMA ISR, ipl2)
+ * Candidate prototype: void Function(void)
+ */
+typedef void (*pmpDmaCallback_t) (void);
+
+/**
+ * @function PMP_DmaWrite
+ * @brief write a 16bit word buffer to the PMP by DMA; waits for the end of the previous DMA transfer, then returns
+ *        without waiting for the end of this one. src shall remain valid until the end of the transfer
+ * @param const uint16_t *src: words to write
+ * @param uint32_t n: number of words
+ * @param pmpDmaCallback_t cb: end of transfer callback; may be NULL
+ * @return none
+ */
+void PMP_DmaWrite(const uint16_t *src, uint32_t n, pmpDmaCallback_t cb);
+
+/**
+ * @function PMP_DmaWriteRepeat
+ * @brief write a pattern of 16bit words to the PMP by DMA, repeated until n words are written (e.g. constant color fill);
+ *        same behaviour than PMP_DmaWrite()
+ * @param const uint16_t *pattern: pattern to repeat
+ * @param uint16_t len: pattern length, in words (the longer, the less DMA interruptions)
+ * @param uint32_t n: total number of words
+ * @param pmpDmaCallback_t cb: end of transfer callback; may be NULL
+ * @return none
+ */
+void PMP_DmaWriteRepeat(const uint16_t *pattern, uint16_t len, uint32_t n, pmpDmaCallback_t cb);
+
+/**
+ * @function PMP_DmaIsBusy
+ * @brief tell if a DMA transfer is in progress
+ * @param none
+ * @return bool: true if busy
+ */
+bool PMP_DmaIsBusy(void);
+
+/**
+ * @function PMP_DmaWait
+ * @brief wait for the end of the current DMA transfer; shall be called before any CPU access to the PMP
+ * @param none
+ * @return none
+ */
+void PMP_DmaWait(void);
+
+/**
+ * @function PMP_Read
+ * @brief read 16bit words from the PMP, with a slower read strobe; waits for the end of the DMA transfer first
+ * @param uint16_t *dst: words read
+ * @param uint32_t n: number of words
+ * @param uint8_t dummy: number of leading words read & dropped (device latency)
+ * @return none
+ */
+void PMP_Read(uint16_t *dst, uint32_t n, uint8_t dummy);
+
 
 #ifdef _PMP_DIRTY_SPEED_
   #define PMP_Write(data) {PMDIN = data;} /*really dirty implementation for maximum speed; lcd timings may not be respected! */
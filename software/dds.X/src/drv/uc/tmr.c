@@ -213,6 +213,27 @@ void TmrStop(tmr_t tmr_id) {
 }
 
 
+/**
+ * @function TmrClearCounter
+ * @brief reset the counter of a given timer (next interruption after a full period)
+ * @param tmr_t tmr_id: timer id
+ * @return none
+ */
+void TmrClearCounter(tmr_t tmr_id) {
+  switch(tmr_id) {
+    case TMR_1:
+      TMR1 = 0;
+      break;
+    case TMR_4:
+      TMR4 = 0;
+      break;
+    case TMR_5:
+      TMR5 = 0;
+      break;
+  }
+}
+
+
 /**
  * @function Timer1Handler
  * @brief Timer1 interruption handler
@@ -74,4 +74,12 @@ void TmrLaunch(tmr_t id);
  */
 void TmrStop(tmr_t id);
 
+/**
+ * @function TmrClearCounter
+ * @brief reset the counter of a given timer (next interruption after a full period)
+ * @param tmr_t tmr_id: timer id
+ * @return none
+ */
+void TmrClearCounter(tmr_t id);
+
 #endif
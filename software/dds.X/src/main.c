@@ -33,6 +33,7 @@
 #include "p2d.h"
 #include "gui.h"
 #include "setup.h"
+#include "screenshot.h"
 
 #include "rtc.h"
 #include "diskio.h"
@@ -59,7 +60,7 @@ static FATFS Fatfs;
  */
 int32_t main(void) {
 
-  timer_t tmInit;
+  timer_t tmInit, tmLoop;
 
   UcInit();       /*uc init; shall be the first one*/
   TicksInit();    /*software clock init*/
@@ -88,18 +89,24 @@ int32_t main(void) {
   /*main loop*/
   while(1) {
 
+    /*loop period: 1ms at least*/
+    tmLoop = GetTimeout(1);
+
     /*execute the main task, if any*/
     if(pCurrentTask != NULL) pCurrentTask();
 
-    /*GUI task*/
-    GUI_DrawObjects();
-    GUI_DBG_Task();
+    /*GUI task: events handled at each loop, redraw paced on the display refresh*/
+    if(GUI_FrameTask()) GUI_DBG_Task();
 
     /*software RTC task*/
     RtcTask();
 
-    /*CPU limiter; reduces the power consumption*/
-    DelayMs(1);
+    /*screenshot on a held touch, if armed from the setup menu*/
+    ScreenshotTask();
+
+    /*CPU limiter; reduces the power consumption: idle until the end of the loop period, not only until the next
+     *interruption (the touchscreen ISR skips its sampling while the tasks read it); the frame sync window is wider*/
+    while(IsTimerElapsed(tmLoop) == false) UcIdle();
   }
 
   /*never arrive here*/
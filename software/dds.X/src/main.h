@@ -47,6 +47,13 @@
  */
 //#define INCLUDE_GUI_DEMO
 
+/**
+ * INCLUDE_FRAME_BENCH
+ * uncomment this flag if you want a BENCH button in the main menu: it measures the drawing time of the DDS, ARB & PWM
+ * pages, without & with the P2D display list. The pages are built as from the main menu: their outputs are initialized
+ */
+//#define INCLUDE_FRAME_BENCH
+
 /*current task; executed at each software cycle, in the main loop*/
 extern void (*pCurrentTask) (void);
 
@@ -22,6 +22,7 @@
  */
 
 #include "ticks.h"
+#include "hw_config.h"
 #include "tmr.h"
 #include "sem.h"
 
@@ -102,6 +103,28 @@ void TicksSetExternalCallback(void (*function)(void)) {
 }
 
 
+/**
+ * @function TicksGetCycles
+ * @brief return the core timer (free running, SYS_CLK / 2); used for short time measurements
+ * @param none
+ * @return uint32_t: core timer count
+ */
+uint32_t TicksGetCycles(void) {
+  return _CP0_GET_COUNT();
+}
+
+
+/**
+ * @function TicksCyclesToUs
+ * @brief convert a core timer count difference into us
+ * @param uint32_t cycles: core timer count difference
+ * @return uint32_t: us
+ */
+uint32_t TicksCyclesToUs(uint32_t cycles) {
+  return cycles / (SYS_CLK / 2000000ul);
+}
+
+
 /**
  * @function TicksCallback
  * @brief clock incrementation
@@ -61,4 +61,20 @@ void TicksSetWatchdog(void (*function)(void), ticks_t delay);
  */
 void TicksSetExternalCallback(void (*function)(void));
 
+/**
+ * @function TicksGetCycles
+ * @brief return the core timer (free running, SYS_CLK / 2); used for short time measurements
+ * @param none
+ * @return uint32_t: core timer count
+ */
+uint32_t TicksGetCycles(void);
+
+/**
+ * @function TicksCyclesToUs
+ * @brief convert a core timer count difference into us
+ * @param uint32_t cycles: core timer count difference
+ * @return uint32_t: us
+ */
+uint32_t TicksCyclesToUs(uint32_t cycles);
+
 #endif
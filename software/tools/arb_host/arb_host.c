@@ -0,0 +1,747 @@
+/**
+ * @file arb_host.c
+ * @brief host build of the ARB signal chain (arb_host): the generators are run on simulated timers,
+ *        their output is captured & measured against the expected signal
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * usage: arb_host test [name]     runs each test (or the named one); exits with 1 on any failure
+ *        arb_host bench [ms]       time of the fixed-point FFT / IFFT for each table size, during <ms> (default 200) each
+ *
+ * The firmware sources are built as they are; hw_host.c stands for the peripheral drivers they call.
+ * "make arb_test" from software/dds.X builds & runs every test.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "hw_host.h"
+#include "hw_config.h"
+#include "ana.h"
+#include "arb_dither.h"
+#include "arb_fft.h"
+#include "arb_harmonic.h"
+#include "multitone.h"
+#include "spi.h"
+#include "ticks.h"
+#include "trig.h"
+
+typedef struct {
+  const char *name;
+  int (*Test) (void);
+} test_st;
+
+static int TestMultitone(void);
+static int TestMultitoneMod(void);
+static int TestDtmf(void);
+static int TestDither(void);
+static int TestFft(void);
+static int TestHarmonic(void);
+static int TestTrig(void);
+static void Bench(double ms);
+static void FftRun(int16_t *re, int16_t *im, uint8_t log2n, bool bInverse, uint16_t budget);
+static void DftRef(const double *re, const double *im, uint32_t n, bool bInverse, double *pRe, double *pIm);
+static void Quantize(arb_dither_e mode, double amp, uint32_t n, uint32_t cycles);
+static double Noise(const double *pwr, uint32_t from, uint32_t to, uint32_t tone);
+static uint32_t Capture(tmr_t id, void (*Task) (void), uint32_t cnt);
+static void Out(uint16_t dataIn);
+static void Spectrum(const uint16_t *x, uint32_t n, bool bHann, double *pwr);
+static double Dft(const uint16_t *x, uint32_t n, bool bHann, double cycles);
+static double Sfdr(const double *pwr, uint32_t n, const uint32_t *bins, uint8_t binCnt, double *pToneDb);
+static uint32_t Peak(const double *pwr, uint32_t from, uint32_t to);
+static void TrigSet(uint8_t mode, uint8_t edge, int32_t delay, int32_t holdoff);
+static void TrigPulse(bool bRising, uint32_t widthUs);
+static void TrigStart(void *ctx);
+static void TrigStop(void *ctx);
+static void TrigStep(void *ctx);
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b);
+
+static const test_st arTest[] = {
+  {"multitone", TestMultitone},
+  {"mt_mod", TestMultitoneMod},
+  {"dtmf", TestDtmf},
+  {"dither", TestDither},
+  {"fft", TestFft},
+  {"harmonic", TestHarmonic},
+  {"trig", TestTrig}
+};
+
+#define TEST_CNT  (sizeof(arTest) / sizeof(arTest[0]))
+#define OUT_MAX   8192          /*captured samples*/
+#define TWO_TONE_SFDR_MIN 85.0  /*dBc, 16 bits output*/
+#define DITHER_SFDR_GAIN  6.0   /*dB, -40dBFS sine on 10 bits*/
+#define NS_GAIN           10.0  /*dB, in-band noise*/
+#define FFT_ERR_STAGE     0.5   /*LSB per stage, forward (1/2 scaling per stage)*/
+#define IFFT_ERR_STAGE    1.5   /*LSB per stage, inverse (unscaled), sum(|X|) <= 1*/
+#define FFT_SNR_MIN       50.0  /*dB*/
+#define HARM_ERR_MAX      0.3   /*dB, harmonic levels read back from the 8 bits wavetable*/
+#define HARM_FLOOR        (-400) /*dB x 10, harmonics which are not set*/
+#define CYC_US            (SYS_CLK / 2000000ul) /*core timer cycles per us*/
+#define PI        3.14159265358979
+
+static uint16_t arOut[OUT_MAX];
+static double arPwr[OUT_MAX / 2];
+static uint32_t outCnt;
+static uint32_t trigStart, trigStop, trigStep, trigLast;  /*target calls & core timer at the last one*/
+
+
+int main(int argc, char **argv) {
+
+  int res = 0;
+  unsigned int ii;
+
+  if(argc > 1 && strcmp(argv[1], "bench") == 0) {
+    Bench((argc > 2 && atof(argv[2]) > 0) ? atof(argv[2]) : 200);
+  }
+  else if(argc < 2 || strcmp(argv[1], "test") != 0) {
+    fprintf(stderr, "usage: arb_host test [name] | bench [ms]\n");
+    res = 1;
+  }
+  else {
+    for(ii = 0; ii < TEST_CNT; ii++) {
+      if(argc <= 2 || strcmp(argv[2], arTest[ii].name) == 0) {
+        if(arTest[ii].Test() != 0) res = 1;
+      }
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function TestMultitone
+ * @brief two tones (1kHz & 1.1kHz, -6dBFS each), then 8 tones; played through the double buffer,
+ *        output without quantization: every sample shall be output & the spurs shall stay under the tones
+ */
+static int TestMultitone(void) {
+  static const uint32_t arBin2[] = {100, 110};
+  static const uint32_t arBin8[] = {25, 100, 137, 250, 410, 555, 890, 1500};
+  const uint32_t n = 4000;      /*40kHz / 4000 -> 10Hz bins: every tone on a bin*/
+  double sfdr, tone;
+  uint32_t cnt;
+  uint8_t ii;
+  int res = 0;
+
+  MT_Init();
+  MT_SetSampleRate(MT_SAMPLE_RATE);
+  ARB_DitherSetOutput(OUTPUT_ON_DDS_FREQ);
+  (void) MT_SetTone(0, 10000, MT_AMP_FULL_SCALE / 2, 0);
+  (void) MT_SetTone(1, 11000, MT_AMP_FULL_SCALE / 2, 90);
+  MT_Play(Out);
+  cnt = Capture(ARB_TIMER, MT_Process, n);
+  MT_Stop();
+
+  Spectrum(arOut, n, false, arPwr);
+  sfdr = Sfdr(arPwr, n, arBin2, 2, &tone);
+  res |= Result("multitone", cnt == n && HostTmrGetFrequency(ARB_TIMER) == MT_SAMPLE_RATE, "%.0f samples output, %.0f expected", cnt, n);
+  res |= Result("multitone", fabs(tone + 6.02) < 0.1, "two tones: %.2f dBFS, %.2f expected", tone, -6.02);
+  res |= Result("multitone", sfdr > TWO_TONE_SFDR_MIN, "two tones: SFDR %.1f dBc, %.1f min", sfdr, TWO_TONE_SFDR_MIN);
+
+  /*8 tones: the sum is scaled down to full scale*/
+  MT_ClearTones();
+  for(ii = 0; ii < 8; ii++) (void) MT_SetTone(ii, arBin8[ii] * 100, MT_AMP_FULL_SCALE / 2, ii * 45);
+  MT_Play(Out);
+  cnt = Capture(ARB_TIMER, MT_Process, n);
+  MT_Stop();
+
+  Spectrum(arOut, n, false, arPwr);
+  sfdr = Sfdr(arPwr, n, arBin8, 8, &tone);
+  res |= Result("multitone", fabs(tone + 18.06) < 0.1, "8 tones: %.2f dBFS, %.2f expected", tone, -18.06);
+  res |= Result("multitone", sfdr > TWO_TONE_SFDR_MIN, "8 tones: SFDR %.1f dBc, %.1f min", sfdr, TWO_TONE_SFDR_MIN);
+  return res;
+}
+
+
+/**
+ * @function TestMultitoneMod
+ * @brief AM/FM modulation rate: the tones keep their frequency at the divided sample rate,
+ *        those above the new Nyquist frequency are clamped
+ */
+static int TestMultitoneMod(void) {
+  static const uint32_t arBin[] = {100, 110};
+  const uint32_t rate = MT_SAMPLE_RATE / ARB_MOD_RATE_DIV, n = rate / 10;
+  double sfdr, tone;
+  uint32_t cnt;
+  int res = 0;
+
+  MT_Init();
+  MT_SetSampleRate(MT_SAMPLE_RATE);
+  ARB_DitherSetOutput(OUTPUT_ON_DDS_FREQ);
+  (void) MT_SetTone(0, 10000, MT_AMP_FULL_SCALE / 2, 0);
+  (void) MT_SetTone(1, 11000, MT_AMP_FULL_SCALE / 2, 0);
+  MT_SetSampleRate(rate);
+  MT_Play(Out);
+  cnt = Capture(ARB_TIMER, MT_Process, n);
+  MT_Stop();
+
+  Spectrum(arOut, n, false, arPwr);
+  sfdr = Sfdr(arPwr, n, arBin, 2, &tone);
+  res |= Result("mt_mod", HostTmrGetFrequency(ARB_TIMER) == rate && cnt == n, "timer %.0f Hz, %.0f expected", HostTmrGetFrequency(ARB_TIMER), rate);
+  res |= Result("mt_mod", fabs(tone + 6.02) < 0.1, "two tones: %.2f dBFS, %.2f expected", tone, -6.02);
+  res |= Result("mt_mod", sfdr > TWO_TONE_SFDR_MIN, "two tones: SFDR %.1f dBc, %.1f min", sfdr, TWO_TONE_SFDR_MIN);
+  res |= Result("mt_mod", MT_GetFreqMax() == (int32_t) rate * 5 - 10 && MT_SetTone(2, rate * 5, 1000, 0) < 0,
+    "max frequency %.0f, %.0f expected", MT_GetFreqMax(), rate * 5 - 10);
+  return res;
+}
+
+
+/**
+ * @function TestDtmf
+ * @brief DTMF digit "5" (770Hz + 1336Hz, 2dB twist): the two strongest tones shall be at the row & column frequencies
+ */
+static int TestDtmf(void) {
+  const uint32_t n = 4000;      /*100ms @ 40kHz: exactly one digit*/
+  uint32_t low, high;
+  double twist;
+  int res = 0;
+
+  MT_Init();
+  MT_SetSampleRate(MT_SAMPLE_RATE);
+  ARB_DitherSetOutput(OUTPUT_ON_DDS_FREQ);
+  res |= Result("dtmf", MT_SetDtmfSequence("5", 100, 0, true) == 0 && MT_SetDtmfSequence("5X", 100, 0, true) < 0,
+    "sequence accepted, unknown digit rejected", 0, 0);
+  MT_Play(Out);
+  (void) Capture(ARB_TIMER, MT_Process, n);
+  MT_Stop();
+
+  /*10Hz bins: 770Hz -> 77, 1336Hz -> 133.6*/
+  Spectrum(arOut, n, true, arPwr);
+  low = Peak(arPwr, 50, 105);
+  high = Peak(arPwr, 105, 200);
+  res |= Result("dtmf", low == 77 && (high == 133 || high == 134), "tones at %.0f & %.0f Hz", low * 10.0, high * 10.0);
+  twist = 10 * log10(Dft(arOut, n, true, 133.6) / Dft(arOut, n, true, 77));
+  res |= Result("dtmf", fabs(twist - 2.0) < 0.1, "row tone %.2f dB under the column one, %.2f expected", twist, 2.0);
+  return res;
+}
+
+
+/**
+ * @function TestDither
+ * @brief low level sine (-40dBFS, ~5 LSB) quantized to 10 bits (Vo DAC): rounding only leaves harmonic spurs,
+ *        TPDF dither turns them into noise (SFDR up, same tone level), noise shaping moves that noise out of the band;
+ *        then the output LSB shall follow the resolution of the scaled outputs
+ */
+static int TestDither(void) {
+  const uint32_t n = 4096, cycles = 17, band = n / 32;
+  double sfdrOff, sfdrTpdf, tone, noiseTpdf, noiseNs2, errMax = 0;
+  uint32_t ii;
+  bool bAligned = true;
+  int res = 0;
+
+  ARB_DitherSetOutput(OUTPUT_ON_VO);
+
+  /*rounding: error within +/- 1/2 LSB (+ 1/2 of the 16 bits input rounding)*/
+  Quantize(DITHER_OFF, 0.01, n, cycles);
+  for(ii = 0; ii < n; ii++) {
+    tone = (double) arOut[ii] - (32768.0 + 0.01 * 32767.0 * sin(2 * PI * cycles * ii / n));
+    if(fabs(tone) > errMax) errMax = fabs(tone);
+  }
+  res |= Result("dither", errMax <= 32.5, "rounding: max error %.1f, %.1f max (1/2 LSB)", errMax, 32.5);
+  Spectrum(arOut, n, false, arPwr);
+  sfdrOff = Sfdr(arPwr, n, &cycles, 1, &tone);
+
+  Quantize(DITHER_TPDF, 0.01, n, cycles);
+  Spectrum(arOut, n, false, arPwr);
+  sfdrTpdf = Sfdr(arPwr, n, &cycles, 1, &tone);
+  noiseTpdf = Noise(arPwr, 1, band, cycles);
+  res |= Result("dither", sfdrTpdf > sfdrOff + DITHER_SFDR_GAIN, "SFDR %.1f dBc with TPDF, %.1f dBc without", sfdrTpdf, sfdrOff);
+  res |= Result("dither", fabs(tone + 40.0) < 0.2, "TPDF: tone %.2f dBFS, %.2f expected", tone, -40.0);
+
+  Quantize(DITHER_TPDF_NS2, 0.01, n, cycles);
+  Spectrum(arOut, n, false, arPwr);
+  noiseNs2 = Noise(arPwr, 1, band, cycles);
+  res |= Result("dither", noiseNs2 < noiseTpdf - NS_GAIN, "in-band noise %.1f dBFS with NS2, %.1f dBFS with TPDF", noiseNs2, noiseTpdf);
+
+  /*AM: 1V span on the Vpp DAC -> ~90 words -> LSB = 512*/
+  ARB_DitherSetResolution(OUTPUT_ON_VPP, 100 * ANA_DAC_VPP_MAX_WORD / (2 * ANA_OUTPUT_MAX) + 1);
+  ARB_DitherSetOutput(OUTPUT_ON_VPP);
+  Quantize(DITHER_TPDF, 0.5, n, cycles);
+  for(ii = 0; ii < n; ii++) {
+    if(arOut[ii] % 512 != 0) bAligned = false;
+  }
+  ARB_DitherSetResolution(OUTPUT_ON_VPP, 2 * ANA_OUTPUT_MAX * ANA_DAC_VPP_MAX_WORD / (2 * ANA_OUTPUT_MAX) + 1);
+  res |= Result("dither", bAligned, "Vpp output, 1V span: words aligned on %.0f (%.0f DAC words)", 512, 100 * ANA_DAC_VPP_MAX_WORD / (2 * ANA_OUTPUT_MAX) + 1);
+  return res;
+}
+
+
+/**
+ * @function Quantize
+ * @brief quantize a sine (amplitude relative to full scale, <cycles> periods per <n> samples) to the current output
+ */
+static void Quantize(arb_dither_e mode, double amp, uint32_t n, uint32_t cycles) {
+  uint32_t ii;
+
+  for(ii = 0; ii < n; ii++) arOut[ii] = (uint16_t) lround(32768.0 + amp * 32767.0 * sin(2 * PI * cycles * ii / n));
+  ARB_DitherSetMode(OUTPUT_ON_VPP, mode);
+  ARB_DitherSetMode(OUTPUT_ON_VO, mode);
+  ARB_DitherBlock(arOut, n, false);
+}
+
+
+/**
+ * @function Noise
+ * @brief total power of the bins [from; to[, the tone bin excluded
+ * @return double: power, in dBFS
+ */
+static double Noise(const double *pwr, uint32_t from, uint32_t to, uint32_t tone) {
+  uint32_t k;
+  double sum = 1e-30;
+
+  for(k = from; k < to; k++) {
+    if(k != tone) sum += pwr[k];
+  }
+  return 10 * log10(sum);
+}
+
+
+/**
+ * @function TestFft
+ * @brief each table size against a double precision DFT, in slices of 7 butterflies (as the main loop does):
+ *        forward on random samples (scaled by 1/N), inverse on a sparse spectrum with sum(|X|) <= 1 (unscaled)
+ */
+static int TestFft(void) {
+  static int16_t re[FFT_SIZE_MAX], im[FFT_SIZE_MAX];
+  static double inRe[FFT_SIZE_MAX], inIm[FFT_SIZE_MAX], refRe[FFT_SIZE_MAX], refIm[FFT_SIZE_MAX];
+  char name[16];
+  uint32_t seed = 1, n, ii, k;
+  uint8_t log2n, inv;
+  double err, errMax, errSum, sigSum, snr;
+  int res = 0;
+
+  FFT_Init();
+  for(log2n = 1; log2n <= FFT_LOG2_MAX; log2n++) {
+    n = 1u << log2n;
+    for(inv = 0; inv < 2; inv++) {
+
+      for(ii = 0; ii < n; ii++) inRe[ii] = inIm[ii] = 0;
+      if(inv == 0) {
+        for(ii = 0; ii < n; ii++) {
+          seed = seed * 1664525ul + 1013904223ul;
+          inRe[ii] = (double) ((int32_t)(seed >> 16) - 32768) / 2;
+          seed = seed * 1664525ul + 1013904223ul;
+          inIm[ii] = (double) ((int32_t)(seed >> 16) - 32768) / 2;
+        }
+      }
+      else {
+        /*a few conjugate pairs, 16000 in all*/
+        for(ii = 0; ii < 4 && ii < n / 2; ii++) {
+          seed = seed * 1664525ul + 1013904223ul;
+          k = 1 + (seed >> 16) % (n / 2);
+          inRe[k] = 2000.0 * cos(ii);
+          inIm[k] = 2000.0 * sin(ii);
+          inRe[n - k] += inRe[k];
+          inIm[n - k] -= inIm[k];
+        }
+      }
+
+      for(ii = 0; ii < n; ii++) {
+        re[ii] = (int16_t) inRe[ii];
+        im[ii] = (int16_t) inIm[ii];
+      }
+      FftRun(re, im, log2n, inv != 0, 7);
+      DftRef(inRe, inIm, n, inv != 0, refRe, refIm);
+
+      errMax = errSum = 0;
+      sigSum = 1e-30;
+      for(ii = 0; ii < n; ii++) {
+        err = hypot(re[ii] - refRe[ii], im[ii] - refIm[ii]);
+        if(err > errMax) errMax = err;
+        errSum += err * err;
+        sigSum += refRe[ii] * refRe[ii] + refIm[ii] * refIm[ii];
+      }
+      snr = 10 * log10(sigSum / (errSum + 1e-30));
+      sprintf(name, "%s%u", inv ? "ifft" : "fft", (unsigned int) n);
+      res |= Result(name, errMax <= (inv ? IFFT_ERR_STAGE : FFT_ERR_STAGE) * log2n + 0.5 && snr >= FFT_SNR_MIN,
+        "max error %.2f LSB, SNR %.1f dB", errMax, snr);
+    }
+  }
+  return res;
+}
+
+
+/**
+ * @function TestHarmonic
+ * @brief harmonics at 0 / -20 / -10 / -20dB synthesized into the wavetable, then read back by the spectrum view
+ */
+static int TestHarmonic(void) {
+  static arb_st arb;
+  static const int32_t arAmp[ARB_HARMONIC_COUNT + 1] = {0, 1000, 100, 316, 0, 100};
+  static const int32_t arPhase[ARB_HARMONIC_COUNT + 1] = {0, 0, 30, 90, 0, 200};
+  uint8_t h;
+  int16_t db, dbMax = ARB_HARMONIC_DB_MIN;
+  double errMax = 0, expected;
+  int res = 0;
+
+  memset(&arb, 0, sizeof(arb));
+  ARB_HarmonicInit();
+  for(h = 1; h <= ARB_HARMONIC_COUNT; h++) (void) ARB_HarmonicSet(h, arAmp[h], arPhase[h]);
+  res |= Result("harmonic", ARB_HarmonicSynthStart(&arb) == 0, "synthesis started", 0, 0);
+  while(ARB_HarmonicTask(ARB_HARMONIC_BUDGET) == false);
+  res |= Result("harmonic", ARB_SpectrumStart(&arb) == 0, "spectrum started", 0, 0);
+  while(ARB_HarmonicTask(ARB_HARMONIC_BUDGET) == false);
+
+  for(h = 1; h <= ARB_HARMONIC_COUNT; h++) {
+    db = ARB_SpectrumGetDb(h);
+    if(arAmp[h] > 0) {
+      expected = 20 * log10(arAmp[h] / 1000.0);
+      if(fabs(db / 10.0 - expected) > errMax) errMax = fabs(db / 10.0 - expected);
+    }
+    else if(db > dbMax) dbMax = db;
+  }
+  res |= Result("harmonic", errMax <= HARM_ERR_MAX, "levels within %.2f dB, %.2f max", errMax, HARM_ERR_MAX);
+  res |= Result("harmonic", dbMax <= HARM_FLOOR, "other harmonics under %.1f dB, %.1f max", dbMax / 10.0, HARM_FLOOR / 10.0);
+  return res;
+}
+
+
+/**
+ * @function TestTrig
+ * @brief trigger state machine on the simulated INT1 / core timer: each mode, delay, holdoff, gate cancel,
+ *        and the actions held while the SPI bus is owned by the lower priority code (retried until released)
+ */
+static int TestTrig(void) {
+  uint32_t t0;
+  int res = 0;
+
+  HostCoreSim(0xFFFF0000ul);    /*wraps during the test*/
+  TRIG_Init();
+
+  /*start, no delay: one action per edge, on the edge*/
+  TrigSet(TRIG_MODE_START, TRIG_EDGE_RISING, 0, 0);
+  res |= Result("trig", trigStop == 1, "start mode: the generator waits for the trigger (%.0f stop)", trigStop, 0);
+  TrigPulse(true, 10);
+  TrigPulse(true, 10);
+  TRIG_Process();
+  res |= Result("trig", trigStart == 2 && trigStat.count == 2 && trigStat.latency == 0, "start: %.0f actions, latency %.2f us",
+    trigStart, trigStat.latency);
+
+  /*falling edge, 100us delay: no action before the end of the delay*/
+  TrigSet(TRIG_MODE_START, TRIG_EDGE_FALLING, 100, 0);
+  HostTrigInput(true);
+  HostCoreAdvance(10 * CYC_US);
+  t0 = TicksGetCycles();
+  HostTrigInput(false);
+  HostCoreAdvance(99 * CYC_US);
+  res |= Result("trig", trigStart == 0, "delay: %.0f action after 99 of 100 us", trigStart, 0);
+  HostCoreAdvance(2 * CYC_US);
+  res |= Result("trig", trigStart == 1 && trigLast - t0 == 100 * CYC_US, "delay: %.0f action, %.2f us after the edge",
+    trigStart, (double) (trigLast - t0) / CYC_US);
+
+  /*holdoff: the edges within 500us after an action are ignored*/
+  TrigSet(TRIG_MODE_START, TRIG_EDGE_RISING, 0, 500);
+  TrigPulse(true, 100);
+  TrigPulse(true, 100);
+  HostCoreAdvance(200 * CYC_US);
+  TrigPulse(true, 100);
+  res |= Result("trig", trigStart == 2, "holdoff: %.0f actions for 3 edges in 600 us, 2 expected", trigStart, 0);
+
+  /*gate: start on the active edge, stop on the other one; closed during the delay -> nothing*/
+  TrigSet(TRIG_MODE_GATE, TRIG_EDGE_RISING, 50, 0);
+  TrigPulse(true, 100);
+  res |= Result("trig", trigStart == 1 && trigStop == 2, "gate: %.0f start, %.0f stop (set target + gate)", trigStart, trigStop);
+  TrigPulse(true, 20);
+  res |= Result("trig", trigStart == 1 && trigStop == 2, "gate shorter than the delay: %.0f start, %.0f stop", trigStart, trigStop);
+
+  /*gate already open at the reconfiguration: opened by software*/
+  HostTrigInput(true);
+  TrigSet(TRIG_MODE_GATE, TRIG_EDGE_RISING, 0, 0);
+  res |= Result("trig", trigStart == 1, "gate open at the arming: %.0f start", trigStart, 0);
+  HostTrigInput(false);
+
+  /*step & stop modes*/
+  TrigSet(TRIG_MODE_STEP, TRIG_EDGE_RISING, 0, 0);
+  TrigPulse(true, 1);
+  TrigPulse(true, 1);
+  TrigPulse(true, 1);
+  res |= Result("trig", trigStep == 3 && trigStart == 0, "step: %.0f steps for 3 edges", trigStep, 0);
+  TrigSet(TRIG_MODE_STOP, TRIG_EDGE_RISING, 0, 0);
+  res |= Result("trig", trigStop == 0, "stop mode: the generator runs until the trigger (%.0f stop)", trigStop, 0);
+  TrigPulse(true, 1);
+  res |= Result("trig", trigStop == 1, "stop: %.0f action", trigStop, 0);
+
+  /*SPI bus owned by the main loop: the action waits for its release, then is done once*/
+  TrigSet(TRIG_MODE_START, TRIG_EDGE_RISING, 0, 0);
+  SemLock(spiBusy);
+  TrigPulse(true, 30);
+  res |= Result("trig", trigStart == 0, "SPI bus busy: %.0f action during 30 us", trigStart, 0);
+  TRIG_Process();
+  res |= Result("trig", INTGetEnable(INT_CT) != 0, "SPI bus busy: retry kept armed by the trigger task", 0, 0);
+  t0 = TicksGetCycles();
+  SemUnlock(spiBusy);
+  HostCoreAdvance(10 * CYC_US);
+  TRIG_Process();
+  res |= Result("trig", trigStart == 1 && trigLast - t0 <= 2 * CYC_US, "SPI bus released: %.0f action, %.2f us later",
+    trigStart, (double) (trigLast - t0) / CYC_US);
+  res |= Result("trig", trigStat.latency >= 60 && trigStat.latency <= 62, "SPI bus busy for 60 us: latency %.2f us",
+    trigStat.latency, 0);
+
+  /*gate opened & closed while the SPI bus is busy: the start is cancelled, no stop*/
+  TrigSet(TRIG_MODE_GATE, TRIG_EDGE_RISING, 0, 0);
+  SemLock(spiBusy);
+  TrigPulse(true, 5);
+  SemUnlock(spiBusy);
+  HostCoreAdvance(10 * CYC_US);
+  res |= Result("trig", trigStart == 0 && trigStop == 1, "gate while SPI busy: %.0f start, %.0f stop (set target)",
+    trigStart, trigStop);
+
+  /*gate closed while the SPI bus is busy: the stop is held, then done*/
+  HostTrigInput(true);
+  SemLock(spiBusy);
+  HostTrigInput(false);
+  HostCoreAdvance(10 * CYC_US);
+  res |= Result("trig", trigStart == 1 && trigStop == 1, "gate closing held: %.0f start, %.0f stop", trigStart, trigStop);
+  SemUnlock(spiBusy);
+  HostCoreAdvance(10 * CYC_US);
+  res |= Result("trig", trigStop == 2, "gate closing done after the release: %.0f stop", trigStop, 0);
+
+  TRIG_SetTarget(NULL);
+  res |= Result("trig", TRIG_IsActive() == false, "detached", 0, 0);
+  return res;
+}
+
+
+/**
+ * @function Bench
+ * @brief time of a transform for each table size, forward & inverse, in one slice (host time, not the PIC32 one)
+ */
+static void Bench(double ms) {
+  static int16_t re[FFT_SIZE_MAX], im[FFT_SIZE_MAX];
+  uint8_t log2n, inv;
+  uint32_t n, rep, ii, t0, t;
+
+  FFT_Init();
+  for(log2n = 1; log2n <= FFT_LOG2_MAX; log2n++) {
+    n = 1u << log2n;
+    for(inv = 0; inv < 2; inv++) {
+      rep = 0;
+      t0 = TicksGetCycles();
+      do {
+        for(ii = 0; ii < n; ii++) {
+          re[ii] = (int16_t) ((ii * 2654435761u) >> 20);
+          im[ii] = 0;
+        }
+        FftRun(re, im, log2n, inv != 0, 0xFFFF);
+        rep++;
+        t = TicksCyclesToUs(TicksGetCycles() - t0);
+      } while(t < ms * 1000.0);
+      printf("%-5s %4u points %10.2f us/transform %6u butterflies\n", inv ? "ifft" : "fft", (unsigned int) n,
+        (double) t / rep, (unsigned int) ((n / 2) * log2n));
+    }
+  }
+}
+
+
+/**
+ * @function FftRun
+ * @brief run a whole transform, by slices of <budget> butterflies
+ */
+static void FftRun(int16_t *re, int16_t *im, uint8_t log2n, bool bInverse, uint16_t budget) {
+  fft_st fft;
+  (void) FFT_Start(&fft, re, im, log2n, bInverse);
+  while(FFT_Process(&fft, budget) == false);
+}
+
+
+/**
+ * @function DftRef
+ * @brief double precision DFT; forward: scaled by 1/N, as FFT_Process()
+ */
+static void DftRef(const double *re, const double *im, uint32_t n, bool bInverse, double *pRe, double *pIm) {
+  uint32_t k, ii;
+  double a, sign = bInverse ? 1 : -1;
+
+  for(k = 0; k < n; k++) {
+    pRe[k] = pIm[k] = 0;
+    for(ii = 0; ii < n; ii++) {
+      a = sign * 2 * PI * (double) ((k * ii) % n) / n;
+      pRe[k] += re[ii] * cos(a) - im[ii] * sin(a);
+      pIm[k] += re[ii] * sin(a) + im[ii] * cos(a);
+    }
+    if(bInverse == false) {
+      pRe[k] /= n;
+      pIm[k] /= n;
+    }
+  }
+}
+
+
+/**
+ * @function Capture
+ * @brief run a timer during <cnt> periods; the main loop task is run every ms
+ * @return uint32_t: number of samples output
+ */
+static uint32_t Capture(tmr_t id, void (*Task) (void), uint32_t cnt) {
+  uint32_t ii, taskPeriod = HostTmrGetFrequency(id) / 1000;
+
+  if(taskPeriod == 0) taskPeriod = 1;
+  outCnt = 0;
+  for(ii = 0; ii < cnt; ii++) {
+    if(ii % taskPeriod == 0) Task();
+    HostTmrTick(id);
+  }
+  return outCnt;
+}
+
+
+static void Out(uint16_t dataIn) {
+  if(outCnt < OUT_MAX) arOut[outCnt] = dataIn;
+  outCnt++;
+}
+
+
+/**
+ * @function Spectrum
+ * @brief power of each bin [0; n/2[ of a block of offset binary samples, relative to a full scale sine
+ */
+static void Spectrum(const uint16_t *x, uint32_t n, bool bHann, double *pwr) {
+  static double arCos[OUT_MAX], arSin[OUT_MAX], arX[OUT_MAX];
+  uint32_t k, ii, idx;
+  double re, im, w, norm = 0;
+
+  for(ii = 0; ii < n; ii++) {
+    arCos[ii] = cos(2 * PI * ii / n);
+    arSin[ii] = sin(2 * PI * ii / n);
+    w = bHann ? 0.5 - 0.5 * arCos[ii] : 1;
+    arX[ii] = w * ((double) x[ii] - 32768.0) / 32768.0;
+    norm += w;
+  }
+  for(k = 0; k < n / 2; k++) {
+    re = im = 0;
+    for(ii = 0, idx = 0; ii < n; ii++) {
+      re += arX[ii] * arCos[idx];
+      im -= arX[ii] * arSin[idx];
+      idx += k;
+      if(idx >= n) idx -= n;
+    }
+    pwr[k] = (re * re + im * im) * 4 / (norm * norm);
+  }
+}
+
+
+/**
+ * @function Dft
+ * @brief power at <cycles> periods per block (not necessarily a bin), relative to a full scale sine
+ */
+static double Dft(const uint16_t *x, uint32_t n, bool bHann, double cycles) {
+  uint32_t ii;
+  double re = 0, im = 0, v, w, norm = 0;
+
+  for(ii = 0; ii < n; ii++) {
+    w = bHann ? 0.5 - 0.5 * cos(2 * PI * ii / n) : 1;
+    v = w * ((double) x[ii] - 32768.0) / 32768.0;
+    re += v * cos(2 * PI * fmod(cycles * ii, n) / n);
+    im -= v * sin(2 * PI * fmod(cycles * ii, n) / n);
+    norm += w;
+  }
+  return (re * re + im * im) * 4 / (norm * norm);
+}
+
+
+/**
+ * @function Sfdr
+ * @brief spurious free dynamic range: weakest tone / strongest other bin (DC excluded)
+ * @return double: SFDR, in dB; *pToneDb: weakest tone, in dBFS
+ */
+static double Sfdr(const double *pwr, uint32_t n, const uint32_t *bins, uint8_t binCnt, double *pToneDb) {
+  uint32_t k;
+  uint8_t ii;
+  double tone = 1e9, spur = 1e-30;
+  bool bTone;
+
+  for(k = 1; k < n / 2; k++) {
+    bTone = false;
+    for(ii = 0; ii < binCnt; ii++) {
+      if(bins[ii] == k) bTone = true;
+    }
+    if(bTone && pwr[k] < tone) tone = pwr[k];
+    else if(bTone == false && pwr[k] > spur) spur = pwr[k];
+  }
+  *pToneDb = 10 * log10(tone);
+  return 10 * log10(tone / spur);
+}
+
+
+static uint32_t Peak(const double *pwr, uint32_t from, uint32_t to) {
+  uint32_t k, kMax = from;
+  for(k = from; k < to; k++) {
+    if(pwr[k] > pwr[kMax]) kMax = k;
+  }
+  return kMax;
+}
+
+
+/**
+ * @function TrigSet
+ * @brief configure the trigger, attach the recording target & clear the counters
+ */
+static void TrigSet(uint8_t mode, uint8_t edge, int32_t delay, int32_t holdoff) {
+  trig_target_st target = {NULL, TrigStart, TrigStop, TrigStep};
+
+  trigCfg.mode = mode;
+  trigCfg.edge = edge;
+  trigCfg.delay = delay;
+  trigCfg.holdoff = holdoff;
+  trigStart = trigStop = trigStep = 0;
+  TRIG_SetTarget(&target);
+}
+
+
+/**
+ * @function TrigPulse
+ * @brief pulse on the trigger input, then the same time at the idle level
+ */
+static void TrigPulse(bool bRising, uint32_t widthUs) {
+  HostTrigInput(bRising);
+  HostCoreAdvance(widthUs * CYC_US);
+  HostTrigInput(!bRising);
+  HostCoreAdvance(widthUs * CYC_US);
+}
+
+
+/*recording target*/
+static void TrigStart(void *ctx) {
+  (void) ctx;
+  trigStart++;
+  trigLast = TicksGetCycles();
+}
+
+static void TrigStop(void *ctx) {
+  (void) ctx;
+  trigStop++;
+  trigLast = TicksGetCycles();
+}
+
+static void TrigStep(void *ctx) {
+  (void) ctx;
+  trigStep++;
+  trigLast = TicksGetCycles();
+}
+
+
+/**
+ * @function Result
+ * @brief print a check result
+ * @return int: 0 -> ok, 1 -> failure
+ */
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b) {
+  printf("%-10s %s ", name, bOk ? "ok  " : "FAIL");
+  printf(fmt, a, b);
+  printf("\n");
+  return bOk ? 0 : 1;
+}
@@ -0,0 +1,229 @@
+/**
+ * @file hw_host.c
+ * @brief host build of the ARB signal chain (arb_host): peripheral drivers used by the ARB code;
+ *        the timers are simulated, their callbacks are run by HostTmrTick(); the core timer runs on the host clock
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include "hw_host.h"
+#include "hw_config.h"
+#include "ticks.h"
+#include "spi.h"
+
+#define TMR_COUNT 6   /*indexed by tmr_t*/
+
+typedef struct {
+  uint32_t freq;
+  bool bRun;
+  void (*callback) (void);
+} tmr_host_st;
+
+static tmr_host_st tmr[TMR_COUNT];
+
+/*simulated interrupt controller & core timer*/
+host_intcon_st INTCONbits;
+host_trise_st TRISEbits;
+host_porte_st PORTEbits;
+sem_t spiBusy = SEM_UNLOCKED;
+
+static bool bIntFlag[_INT_SOURCE_COUNT], bIntEnable[_INT_SOURCE_COUNT];
+static bool bIsrRunning = false;
+static bool bCoreSim = false;
+static uint32_t coreCount, coreCompare;
+
+extern void TrigEdgeHandler(void);
+extern void TrigDelayHandler(void);
+
+static void HostIntDispatch(void);
+
+
+int8_t TmrSetFrequency(tmr_t id, uint32_t freq) {
+  tmr[id].freq = freq;
+  tmr[id].bRun = false;   /*as the hardware driver: changing the frequency stops the timer*/
+  return 0;
+}
+
+void TmrSetCallback(tmr_t id, void (*callback)(void)) {
+  tmr[id].callback = callback;
+}
+
+void TmrLaunch(tmr_t id) {
+  tmr[id].bRun = true;
+}
+
+void TmrStop(tmr_t id) {
+  tmr[id].bRun = false;
+}
+
+void TmrClearCounter(tmr_t id) {
+  (void) id;
+}
+
+
+/*core timer (SYS_CLK / 2), from the host clock or simulated*/
+uint32_t TicksGetCycles(void) {
+  struct timespec t;
+  if(bCoreSim) return coreCount;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t) (((uint64_t)t.tv_sec * 1000000000ull + t.tv_nsec) / (2000000000ull / SYS_CLK));
+}
+
+uint32_t TicksCyclesToUs(uint32_t cycles) {
+  return cycles / (SYS_CLK / 2000000ul);
+}
+
+
+/*interrupt controller: a flag set while enabled runs its handler, unless a handler is running (same ipl)*/
+void INTEnable(INT_SOURCE src, INT_EN_DIS enable) {
+  bIntEnable[src] = (enable == INT_ENABLED);
+  HostIntDispatch();
+}
+
+unsigned int INTGetEnable(INT_SOURCE src) {
+  return bIntEnable[src]? 1: 0;
+}
+
+void INTClearFlag(INT_SOURCE src) {
+  bIntFlag[src] = false;
+}
+
+void INTSetFlag(INT_SOURCE src) {
+  bIntFlag[src] = true;
+  HostIntDispatch();
+}
+
+void _CP0_SET_COMPARE(unsigned int compare) {
+  coreCompare = compare;
+}
+
+
+/**
+ * @function HostTmrTick
+ * @brief one period of a timer: runs its callback if the timer is launched
+ * @param tmr_t id: timer
+ * @return none
+ */
+void HostTmrTick(tmr_t id) {
+  if(tmr[id].bRun && tmr[id].callback != NULL) tmr[id].callback();
+}
+
+
+/**
+ * @function HostTmrGetFrequency
+ * @brief return the last frequency set by TmrSetFrequency()
+ * @param tmr_t id: timer
+ * @return uint32_t: frequency, in Hz
+ */
+uint32_t HostTmrGetFrequency(tmr_t id) {
+  return tmr[id].freq;
+}
+
+
+/**
+ * @function HostTmrIsRunning
+ * @brief tell if a timer is launched
+ * @param tmr_t id: timer
+ * @return bool: true if launched
+ */
+bool HostTmrIsRunning(tmr_t id) {
+  return tmr[id].bRun;
+}
+
+
+/**
+ * @function HostCoreSim
+ * @brief run the core timer from HostCoreAdvance() instead of the host clock
+ * @param uint32_t count: initial core timer value
+ * @return none
+ */
+void HostCoreSim(uint32_t count) {
+  bCoreSim = true;
+  coreCount = count;
+}
+
+
+/**
+ * @function HostCoreAdvance
+ * @brief advance the simulated core timer; the compare match raises the core timer interruption
+ * @param uint32_t cycles: number of core timer cycles
+ * @return none
+ */
+void HostCoreAdvance(uint32_t cycles) {
+
+  uint32_t d;
+
+  while(cycles > 0) {
+    d = coreCompare - coreCount;
+    if(d > 0 && d <= cycles) {
+      coreCount += d;
+      cycles -= d;
+      bIntFlag[INT_CT] = true;
+      HostIntDispatch();
+    }
+    else {
+      coreCount += cycles;
+      cycles = 0;
+    }
+  }
+}
+
+
+/**
+ * @function HostTrigInput
+ * @brief drive the trigger input (RE8 / INT1); the edge selected by INTCONbits.INT1EP sets the INT1 flag
+ * @param bool bHigh: new level
+ * @return none
+ */
+void HostTrigInput(bool bHigh) {
+  bool bOld = PORTEbits.RE8? true: false;
+  PORTEbits.RE8 = bHigh? 1: 0;
+  if(bOld != bHigh && bHigh == (INTCONbits.INT1EP? true: false)) {
+    INTSetFlag(INT_INT1);
+  }
+}
+
+
+/**
+ * @function HostIntDispatch
+ * @brief run the handlers of the pending & enabled interruptions
+ * @param none
+ * @return none
+ */
+static void HostIntDispatch(void) {
+
+  bool bRun = true;
+
+  if(bIsrRunning == false) {
+    bIsrRunning = true;
+    while(bRun) {
+      bRun = false;
+      if(bIntFlag[INT_INT1] && bIntEnable[INT_INT1]) {
+        TrigEdgeHandler();
+        bRun = true;
+      }
+      else if(bIntFlag[INT_CT] && bIntEnable[INT_CT]) {
+        TrigDelayHandler();
+        bRun = true;
+      }
+    }
+    bIsrRunning = false;
+  }
+}
@@ -0,0 +1,78 @@
+/**
+ * @file hw_host.h
+ * @brief host build of the ARB signal chain (arb_host): peripheral drivers used by the ARB code;
+ *        the timers are simulated, their callbacks are run by HostTmrTick(); the core timer runs on the host clock,
+ *        or is simulated with the interrupt controller & the trigger input for the trigger state machine
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _hw_host_h_
+#define _hw_host_h_
+
+#include "main.h"
+#include "tmr.h"
+
+/**
+ * @function HostTmrTick
+ * @brief one period of a timer: runs its callback if the timer is launched
+ * @param tmr_t id: timer
+ * @return none
+ */
+void HostTmrTick(tmr_t id);
+
+/**
+ * @function HostTmrGetFrequency
+ * @brief return the last frequency set by TmrSetFrequency()
+ * @param tmr_t id: timer
+ * @return uint32_t: frequency, in Hz
+ */
+uint32_t HostTmrGetFrequency(tmr_t id);
+
+/**
+ * @function HostTmrIsRunning
+ * @brief tell if a timer is launched
+ * @param tmr_t id: timer
+ * @return bool: true if launched
+ */
+bool HostTmrIsRunning(tmr_t id);
+
+/**
+ * @function HostCoreSim
+ * @brief run the core timer from HostCoreAdvance() instead of the host clock
+ * @param uint32_t count: initial core timer value
+ * @return none
+ */
+void HostCoreSim(uint32_t count);
+
+/**
+ * @function HostCoreAdvance
+ * @brief advance the simulated core timer; the compare match raises the core timer interruption
+ * @param uint32_t cycles: number of core timer cycles
+ * @return none
+ */
+void HostCoreAdvance(uint32_t cycles);
+
+/**
+ * @function HostTrigInput
+ * @brief drive the trigger input (RE8 / INT1); the edge selected by INTCONbits.INT1EP sets the INT1 flag
+ * @param bool bHigh: new level
+ * @return none
+ */
+void HostTrigInput(bool bHigh);
+
+#endif
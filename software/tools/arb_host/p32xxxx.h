@@ -0,0 +1,4 @@
+/**
+ * @file p32xxxx.h
+ * @brief host build of the ARB signal chain (arb_host): stands for the PIC32 device header, which is not used
+ */
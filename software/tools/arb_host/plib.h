@@ -0,0 +1,49 @@
+/**
+ * @file plib.h
+ * @brief host build of the ARB signal chain (arb_host): stands for the PIC32 peripheral library;
+ *        interrupt controller, core timer compare & trigger pin are simulated by hw_host.c
+ */
+#ifndef _arb_host_plib_h_
+#define _arb_host_plib_h_
+
+typedef int BOOL;
+#define TRUE  1
+#define FALSE 0
+
+/*interrupt sources & vectors (only those used by the host build)*/
+typedef enum {
+  INT_INT1,
+  INT_CT,
+  _INT_SOURCE_COUNT
+} INT_SOURCE;
+
+typedef enum {
+  INT_DISABLED,
+  INT_ENABLED
+} INT_EN_DIS;
+
+#define INT_EXTERNAL_1_VECTOR         0
+#define INT_CORE_TIMER_VECTOR         1
+#define INT_PRIORITY_LEVEL_6          6
+#define INT_SUB_PRIORITY_LEVEL_0      0
+
+#define __ISR(vector, ipl)
+#define INTSetVectorPriority(v, p)    ((void) 0)
+#define INTSetVectorSubPriority(v, p) ((void) 0)
+
+void INTEnable(INT_SOURCE src, INT_EN_DIS enable);
+unsigned int INTGetEnable(INT_SOURCE src);
+void INTClearFlag(INT_SOURCE src);
+void INTSetFlag(INT_SOURCE src);
+void _CP0_SET_COMPARE(unsigned int compare);
+
+/*registers*/
+typedef struct { unsigned int INT1EP; } host_intcon_st;
+typedef struct { unsigned int TRISE8; } host_trise_st;
+typedef struct { unsigned int RE8; } host_porte_st;
+
+extern host_intcon_st INTCONbits;
+extern host_trise_st TRISEbits;
+extern host_porte_st PORTEbits;
+
+#endif
@@ -0,0 +1,697 @@
+/**
+ * @file dma_host.c
+ * @brief host model of the DMA transfers (dma_host): the PMP & LCD drivers & the frequency counter run on a simulated
+ *        DMA controller, every descriptor is checked, the pixels received by a simulated ILI9320 are compared with the
+ *        expected ones & the counter shall timestamp every (divided) comparator edge; the sprites of the GUI (uid table)
+ *        & its objects (screen damage) are drawn on the simulated ILI9320 through P2D
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-12
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * usage: dma_host test [name]     runs each test (or the named one); exits with 1 on any failure
+ *
+ * The firmware sources are built as they are; hw_host.c stands for the peripherals they drive.
+ * "make dma_test" from software/dds.X builds & runs every test.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "hw_host.h"
+#include "ILI9320.h"
+#include "pmp.h"
+#include "hw_config.h"
+#include "fcnt.h"
+#include "p2d.h"
+#include "resources.h"
+#include "gui.h"
+
+#define GUI_CELLS   4         /*cells per side of a GUI test object*/
+
+typedef struct {
+  const char *name;
+  int (*Test) (void);
+} test_st;
+
+typedef struct {
+  const uint8_t *sheet;
+  gui_img_t from, to;
+  const uint8_t *lut;
+  lutmode_t mode, modeDisabled;   /*modeDisabled: 0 if the sheet has no G_LUT_DISABLED lut*/
+} sheet_ref_st;
+
+typedef struct {
+  uint8_t arCell[GUI_CELLS][GUI_CELLS];   /*0: transparent; 1 - 3: fill, + circle, + line & text*/
+  uint8_t id;
+} gui_tile_st;
+
+static int TestPmp(void);
+static int TestLcd(void);
+static int TestFcnt(void);
+static int TestSprite(void);
+static void ScreenGet(uint16_t *dst);
+static int TestGui(void);
+static void TileDraw(void *g_obj, void *obj);
+static void TileCell(const g_obj_st *g_obj, uint8_t cx, uint8_t cy, rect_st *rec);
+static void RefPut(color_t c);
+static bool RefCheck(void);
+static void Done(void);
+static uint32_t Rnd(void);
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b);
+
+static const test_st arTest[] = {
+  {"pmp", TestPmp},
+  {"lcd", TestLcd},
+  {"fcnt", TestFcnt},
+  {"sprite", TestSprite},
+  {"gui", TestGui}
+};
+
+#define TEST_CNT    (sizeof(arTest) / sizeof(arTest[0]))
+#define SRC_LEN     100000    /*words*/
+#define LCD_OPS     20000     /*random LCD operations*/
+#define LCD_CHECK   500       /*screen check period, in operations*/
+#define BLOCK_BYTES 0xFFFE    /*PMP_DMA_BLOCK_MAX of pmp.c*/
+#define FCNT_GATE   100       /*gate of the frequency counter test, in ms*/
+#define FCNT_RUN    3000      /*simulated time per frequency, in ms*/
+#define SPRITE_BACK 0x8410    /*screen color behind the sprites*/
+#define GUI_STEPS   400       /*GUI cycles*/
+#define GUI_TILES   12        /*objects over the background one: 3 x 4, 70 x 70 pixels*/
+
+/*sprite sheets registered by GraphInit()*/
+static const sheet_ref_st arSheetRef[] = {
+  {sprite_background, G_IMG_BACKROUND, G_IMG_BACKROUND, sprite_background_lut, LUT_E_COPY, 0},
+  {sprite_logo, G_IMG_LOGO, G_IMG_LOGO, sprite_logo_lut, LUT_E_COPY | LUT_O_COLOR_KEY, 0},
+  {sprite_rvalue, G_IMG_RVAL_VMAX, G_IMG_RVAL_CHAIN, sprite_rvalue_lut, LUT_E_COPY, LUT_E_COPY | LUT_O_BLACK_AND_WHITE},
+  {sprite_in_out, G_IN_OFF, G_OUT_ON, sprite_in_out_lut, LUT_E_COPY | LUT_O_COLOR_KEY, 0},
+  {sprite_rbutton, G_RBTN_000, G_RBTN_330, sprite_rbutton_lut, LUT_E_COPY | LUT_O_COLOR_KEY,
+    LUT_E_COPY | LUT_O_COLOR_KEY | LUT_O_BLACK_AND_WHITE},
+  {sprite_dds_button, G_DDS_DC0, G_DDS_MOD3, sprite_dds_button_lut, LUT_E_COPY | LUT_O_COLOR_KEY, 0}
+};
+#define SHEET_REF_CNT (sizeof(arSheetRef) / sizeof(arSheetRef[0]))
+
+static uint16_t arSrc[SRC_LEN], arLog[SRC_LEN];
+static uint8_t arIdx[SRC_LEN];
+static uint16_t arLut[256];
+static uint16_t arRef[HOST_LCD_H][HOST_LCD_W];    /*expected screen*/
+static uint16_t arScreen[HOST_LCD_H][HOST_LCD_W];
+static gui_tile_st arTile[1 + GUI_TILES];
+static int refX0, refY0, refX1, refY1, refX, refY;  /*expected window & cursor*/
+static uint32_t doneCnt;
+static uint32_t rndState = 1;
+
+
+int main(int argc, char **argv) {
+
+  int res = 0;
+  unsigned int ii;
+
+  if(argc < 2 || strcmp(argv[1], "test") != 0) {
+    fprintf(stderr, "usage: dma_host test [name]\n");
+    res = 1;
+  }
+  else {
+    for(ii = 0; ii < SRC_LEN; ii++) {
+      arSrc[ii] = (uint16_t) Rnd();
+      arIdx[ii] = (uint8_t) Rnd();
+    }
+    for(ii = 0; ii < 256; ii++) arLut[ii] = (uint16_t) Rnd();
+
+    for(ii = 0; ii < TEST_CNT; ii++) {
+      if(argc <= 2 || strcmp(argv[2], arTest[ii].name) == 0) {
+        if(arTest[ii].Test() != 0) res = 1;
+      }
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function TestPmp
+ * @brief PMP_DmaWrite & PMP_DmaWriteRepeat, from 0 to 99999 words: every descriptor shall be valid, the words shall
+ *        reach the PMP in order, in the expected number of blocks, & the callback shall be called once, at the end
+ */
+static int TestPmp(void) {
+  static const uint32_t arSize[] = {0, 1, 2, 31, 32, 33, 255, 256, 257, 32766, 32767, 32768, 32769, 65535, 65536, 99999};
+  static const uint16_t arLen[] = {1, 7, 256, 32767, 40000};
+  uint32_t desc0, err0, desc, err, blocks = 0, words = 0, bad = 0, n, ii, jj, kk;
+  uint16_t len;
+  bool bCb = true;
+  int res = 0;
+
+  LATGbits.LATG13 = 0;    /*LCD selected, data*/
+  LATGbits.LATG12 = 1;
+  PMP_Init();
+  HostDmaStat(&desc0, &err0);
+
+  for(ii = 0; ii < sizeof(arSize) / sizeof(arSize[0]); ii++) {
+    n = arSize[ii];
+    words += n;
+
+    HostPmpLog(arLog, SRC_LEN);
+    doneCnt = 0;
+    PMP_DmaWrite(arSrc, n, Done);
+    PMP_DmaWait();
+    if(HostPmpLogCount() != n || memcmp(arLog, arSrc, n * sizeof(uint16_t)) != 0) bad++;
+    if(doneCnt != 1) bCb = false;
+    blocks += (n * 2 + BLOCK_BYTES - 1) / BLOCK_BYTES;
+
+    for(jj = 0; jj < sizeof(arLen) / sizeof(arLen[0]); jj++) {
+      len = arLen[jj];
+      words += n;
+      HostPmpLog(arLog, SRC_LEN);
+      doneCnt = 0;
+      PMP_DmaWriteRepeat(arSrc, len, n, Done);
+      PMP_DmaWait();
+      if(len > BLOCK_BYTES / 2) len = BLOCK_BYTES / 2;   /*longest pattern*/
+      if(HostPmpLogCount() != n) bad++;
+      for(kk = 0; kk < n; kk++) {
+        if(arLog[kk] != arSrc[kk % len]) {
+          bad++;
+          break;
+        }
+      }
+      if(doneCnt != 1) bCb = false;
+      blocks += (n + len - 1) / len;
+    }
+  }
+  HostPmpLog(NULL, 0);
+  HostDmaStat(&desc, &err);
+
+  res |= Result("pmp", bad == 0, "%.0f words sent, %.0f wrong transfers", words, bad);
+  res |= Result("pmp", desc - desc0 == blocks, "%.0f descriptors, %.0f expected", desc - desc0, blocks);
+  res |= Result("pmp", err == err0, "%.0f invalid descriptors or bus conflicts", err - err0, 0);
+  res |= Result("pmp", bCb, "callback called once, at the end of each transfer", 0, 0);
+
+  /*the model shall catch an odd descriptor*/
+  DmaChnSetTxfer(DMA_CHANNEL0, arSrc, (void *) &PMDIN, 3, 2, 2);
+  HostDmaStat(NULL, &err);
+  res |= Result("pmp", err == err0 + 1, "odd PMP descriptor detected by the model", 0, 0);
+  return res;
+}
+
+
+/**
+ * @function TestLcd
+ * @brief random windows, cursors, pixels, fills, runs (CPU & DMA paths), LUT runs, asynchronous runs & scrolls through
+ *        the LCD driver: the screen of the ILI9320 model shall match the expected one; register writes are reported
+ */
+static int TestLcd(void) {
+
+  uint32_t desc0, err0, err, wr0, sv0, wr, sv, ii, n, bad = 0, cb = 0, cbExp = 0;
+  uint16_t c;
+  rect_st r;
+  int op, x, y, dy, it;
+  static uint16_t arTmp[HOST_LCD_H][HOST_LCD_W];
+
+  LCD_Init();
+  HostDmaStat(&desc0, &err0);
+  LCD_GetRegStat(&wr0, &sv0);
+  refX0 = refY0 = 0;
+  refX1 = HOST_LCD_W - 1;
+  refY1 = HOST_LCD_H - 1;
+  refX = refY = 0;
+
+  for(it = 0; it < LCD_OPS; it++) {
+    op = (int) (Rnd() % 9);
+    switch(op) {
+
+      /*window; sometimes the same one again*/
+      case 0:
+        if(Rnd() % 3 == 0) {
+          r.x = (coord_t) refX0; r.y = (coord_t) refY0;
+          r.w = (length_t) (refX1 - refX0 + 1); r.h = (length_t) (refY1 - refY0 + 1);
+        }
+        else {
+          r.x = (coord_t) (Rnd() % HOST_LCD_W); r.y = (coord_t) (Rnd() % HOST_LCD_H);
+          r.w = (length_t) (1 + Rnd() % (HOST_LCD_W - r.x)); r.h = (length_t) (1 + Rnd() % (HOST_LCD_H - r.y));
+        }
+        LCD_SetWnd(&r);
+        refX0 = refX = r.x; refY0 = refY = r.y;
+        refX1 = r.x + r.w - 1; refY1 = r.y + r.h - 1;
+        break;
+
+      /*cursor within the window; sometimes the current one*/
+      case 1:
+        x = refX0 + (int) (Rnd() % (uint32_t) (refX1 - refX0 + 1));
+        y = refY0 + (int) (Rnd() % (uint32_t) (refY1 - refY0 + 1));
+        if(Rnd() % 2) { x = refX; y = refY; }
+        LCD_SetPos((coord_t) x, (coord_t) y);
+        refX = x; refY = y;
+        break;
+
+      case 2:
+        c = (uint16_t) Rnd();
+        LCD_Put(c);
+        RefPut(c);
+        break;
+
+      case 3:
+        c = (uint16_t) Rnd();
+        n = Rnd() % 700;
+        LCD_PutN(c, n);
+        for(ii = 0; ii < n; ii++) RefPut(c);
+        break;
+
+      case 4:
+        n = Rnd() % 3000;
+        LCD_PutRun(arSrc, n);
+        for(ii = 0; ii < n; ii++) RefPut(arSrc[ii]);
+        break;
+
+      case 5:
+        n = Rnd() % 700;
+        LCD_PutLut8Run(arIdx, arLut, n);
+        for(ii = 0; ii < n; ii++) RefPut(arLut[arIdx[ii]]);
+        break;
+
+      case 6:
+        n = 1 + Rnd() % 700;
+        doneCnt = 0;
+        LCD_PutRunAsync(arSrc + 7, n, Done);
+        LCD_Sync();
+        cb += doneCnt;
+        cbExp++;
+        for(ii = 0; ii < n; ii++) RefPut(arSrc[7 + ii]);
+        break;
+
+      /*whole screen scroll: the lines move up by dy, those which leave the top come back at the bottom*/
+      case 7:
+        if(Rnd() % 8 == 0) {
+          dy = (int) (Rnd() % (2 * HOST_LCD_H - 1)) - (HOST_LCD_H - 1);
+          (void) LCD_ScrollV(NULL, (coord_t) dy);
+          memcpy(arTmp, arRef, sizeof(arRef));
+          for(y = 0; y < HOST_LCD_H; y++) {
+            memcpy(arRef[y], arTmp[(y + dy + HOST_LCD_H) % HOST_LCD_H], sizeof(arRef[y]));
+          }
+          refX0 = refY0 = refX = refY = 0;
+          refX1 = HOST_LCD_W - 1;
+          refY1 = HOST_LCD_H - 1;
+        }
+        break;
+
+      /*user register write: the shadow is dropped*/
+      default:
+        if(Rnd() % 16 == 0) LCD_WriteReg(0x0007, 0x0133);
+        break;
+    }
+
+    if(it % LCD_CHECK == 0 && RefCheck() == false) bad++;
+  }
+
+  LCD_Sync();
+  if(RefCheck() == false) bad++;
+  HostDmaStat(NULL, &err);
+  LCD_GetRegStat(&wr, &sv);
+
+  return Result("lcd", bad == 0, "%.0f screens out of %.0f differ from the expected one", bad, LCD_OPS / LCD_CHECK + 1)
+    | Result("lcd", err == err0, "%.0f invalid descriptors or bus conflicts", err - err0, 0)
+    | Result("lcd", cb == cbExp, "asynchronous runs: %.0f callbacks, %.0f expected", cb, cbExp)
+    | Result("lcd", wr > wr0, "%.0f register writes, %.0f saved by the shadow", wr - wr0, sv - sv0);
+}
+
+
+/**
+ * @function TestFcnt
+ * @brief comparator edges from 10Hz to 1.5MHz, FCNT_Process() every ms: once settled (second half of the run), a timestamp
+ *        shall be taken on every edge, or on every divided edge (divider block done), & the frequency shall be within
+ *        1ppm + 1mHz
+ */
+static int TestFcnt(void) {
+  static const uint32_t arFreq[] = {10, 1000, 100000, 1500000};   /*Hz; 0.377Hz are added: period not a whole cycle count*/
+  uint32_t fMilli, cells0, blocks0, edges0 = 0, cells, blocks, edges, ii, err0, err;
+  uint64_t t0, tEdge, tMs, tHalf, tEnd;
+  bool bHalf;
+  int res = 0;
+  char name[16];
+
+  HostDmaStat(NULL, &err0);
+  for(ii = 0; ii < sizeof(arFreq) / sizeof(arFreq[0]); ii++) {
+    fMilli = arFreq[ii] * 1000 + 377;
+    FCNT_Start(FCNT_GATE);
+
+    tMs = t0 = (uint64_t) ii * FCNT_RUN * (PER_CLK / 1000);
+    tHalf = t0 + FCNT_RUN / 2 * (PER_CLK / 1000);
+    tEnd = t0 + FCNT_RUN * (PER_CLK / 1000);
+    cells0 = blocks0 = 0;
+    bHalf = false;
+    edges = 0;
+    tEdge = t0 + 1;
+    while(tEdge < tEnd) {
+      if(tEdge <= tMs) {
+        HostCmpEdge(tEdge);
+        edges++;
+        tEdge = t0 + 1 + (uint64_t) edges * PER_CLK * 1000 / fMilli;
+      }
+      else {
+        HostSetTime(tMs);
+        FCNT_Process();
+        tMs += PER_CLK / 1000;
+        if(bHalf == false && tMs >= tHalf) {
+          bHalf = true;
+          edges0 = edges;
+          HostDmaCount(DMA_CHANNEL1, &cells0, NULL);
+          HostDmaCount(DMA_CHANNEL2, NULL, &blocks0);
+        }
+      }
+    }
+    HostDmaCount(DMA_CHANNEL1, &cells, NULL);
+    HostDmaCount(DMA_CHANNEL2, NULL, &blocks);
+    cells -= cells0;
+    blocks -= blocks0;
+    edges -= edges0;
+    FCNT_Stop();
+
+    snprintf(name, sizeof(name), "fcnt %u", (unsigned int) arFreq[ii]);
+    if(blocks > 0) {
+      res |= Result(name, cells == blocks, "%.0f timestamps for %.0f divided edges", cells, blocks);
+    }
+    else {
+      res |= Result(name, cells == edges, "%.0f timestamps for %.0f edges", cells, edges);
+    }
+    res |= Result(name, fcntResult.count > 0 && fcntResult.frequency >= fMilli - fMilli / 1000000 - 1 &&
+      fcntResult.frequency <= fMilli + fMilli / 1000000 + 1, "%.0f mHz measured, %.0f mHz expected", fcntResult.frequency, fMilli);
+  }
+  HostDmaStat(NULL, &err);
+  res |= Result("fcnt", err == err0, "%.0f invalid descriptors or bus conflicts", err - err0, 0);
+  return res;
+}
+
+
+/**
+ * @function TestSprite
+ * @brief sprite uid table of the GUI (GraphInit): for each uid of a registered sheet, the size shall be the tile of its
+ *        sheet (sheet width, sheet height / number of uids) & Sprite() shall show the same screen as P2D_Sprite() on
+ *        the tile (from (uid - from) * height), through the normal & the disabled luts, partly out of the screen;
+ *        the other uids shall have no size & shall draw nothing
+ */
+static int TestSprite(void) {
+
+  lut8bpp_st lutRef;
+  const sheet_ref_st *ref;
+  rect_st src, dst;
+  length_t w, h;
+  uint32_t ii, badSize = 0, badScreen = 0, cnt = 0;
+  uint8_t lut;
+  int id;
+
+  LCD_Init();
+  P2D_Init();
+  GraphInit();
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+
+  for(id = 0; id < G_NB_IMG; id++) {
+
+    ref = NULL;
+    for(ii = 0; ii < SHEET_REF_CNT; ii++) {
+      if(id >= arSheetRef[ii].from && id <= arSheetRef[ii].to) ref = &arSheetRef[ii];
+    }
+    w = (ref != NULL)? P2D_SpriteGetWidth(ref->sheet): 0;
+    h = (ref != NULL)? P2D_SpriteGetHeight(ref->sheet) / (ref->to - ref->from + 1): 0;
+    if(SpriteGetWidth((gui_img_t) id) != w || SpriteGetHeight((gui_img_t) id) != h) badSize++;
+
+    for(lut = G_LUT_NORMAL; lut < G_NB_LUT; lut++) {
+      dst.x = (coord_t) ((int32_t) (Rnd() % (LCD_GetWidth() + w)) - w / 2);
+      dst.y = (coord_t) ((int32_t) (Rnd() % (LCD_GetHeight() + h)) - h / 2);
+
+      /*uid table*/
+      P2D_SetColor(SPRITE_BACK);
+      P2D_Clear();
+      SetLut(lut);
+      Sprite(dst.x, dst.y, (gui_img_t) id);
+      ScreenGet(&arScreen[0][0]);
+
+      /*tile of the sheet, drawn directly*/
+      P2D_SetColor(SPRITE_BACK);
+      P2D_Clear();
+      if(ref != NULL) {
+        P2D_InitLut8BPP(&lutRef, ref->lut, (lut == G_LUT_DISABLED && ref->modeDisabled != 0)? ref->modeDisabled: ref->mode);
+        P2D_SpriteSetLut8BPP(&lutRef);
+        src.x = 0;
+        src.y = (coord_t) ((id - ref->from) * h);
+        src.w = w;
+        src.h = h;
+        dst.w = w;
+        dst.h = h;
+        P2D_Sprite(&src, &dst, ref->sheet);
+      }
+      ScreenGet(&arRef[0][0]);
+
+      if(memcmp(arScreen, arRef, sizeof(arRef)) != 0) badScreen++;
+      cnt++;
+    }
+  }
+  SetLut(G_LUT_NORMAL);
+
+  return Result("sprite", badSize == 0, "%.0f uids, %.0f sizes differ from the tiles of their sheet", G_NB_IMG, badSize)
+    | Result("sprite", badScreen == 0, "%.0f sprites drawn, %.0f screens differ from the tile of the sheet", cnt, badScreen);
+}
+
+
+/**
+ * @function TestGui
+ * @brief screen damage of the GUI: a background object & 12 objects over it, made of cells which change at random.
+ *        A change which may show what is behind (the background object, a transparent cell) is declared as screen
+ *        damage (GUI_Invalidate), the others as a damaged part of the object (GUI_ObjInvalidate); random damage rects
+ *        are added, beyond the max number of rects. After each cycle (GUI_RefreshObjects, with & without the display
+ *        list), the screen shall be the one of a full redraw, & the invalidated area shall be the pending screen damage
+ *        plus the object refresh areas
+ */
+static int TestGui(void) {
+
+  g_obj_st *arObj[1 + GUI_TILES], *obj;
+  gui_damage_stat_st stat;
+  rect_st rec;
+  uint32_t ii, jj, n, pxExp, badScreen = 0, badStat = 0, pushed = 0, full = 0;
+  uint8_t t, cx, cy, old;
+
+  LCD_Init();
+  P2D_Init();
+  GUI_Init();
+  GUI_ClearAll();
+
+  for(t = 0; t <= GUI_TILES; t++) {
+    arTile[t].id = t;
+    for(cx = 0; cx < GUI_CELLS; cx++) {
+      for(cy = 0; cy < GUI_CELLS; cy++) arTile[t].arCell[cx][cy] = (uint8_t) (Rnd() % 4);
+    }
+    obj = GUI_AddGenericObject();
+    obj->obj = &arTile[t];
+    obj->draw = TileDraw;
+    if(t == 0) {
+      obj->rec.x = obj->rec.y = 0;
+      obj->rec.w = P2D_GetLcdWidth();
+      obj->rec.h = P2D_GetLcdHeight();
+    }
+    else {
+      obj->rec.x = (coord_t) (10 + ((t - 1) % 3) * 78);
+      obj->rec.y = (coord_t) (10 + ((t - 1) / 3) * 78);
+      obj->rec.w = obj->rec.h = 70;
+    }
+    arObj[t] = obj;
+  }
+
+  for(ii = 0; ii <= GUI_STEPS; ii++) {
+
+    /*first cycle: every object drawn as a whole*/
+    n = (ii == 0)? 0: 1 + Rnd() % 12;
+    for(jj = 0; jj < n; jj++) {
+      t = (uint8_t) (Rnd() % (1 + GUI_TILES));
+      if(Rnd() % 16 == 0) {
+        rec.x = (coord_t) ((int32_t) (Rnd() % 260) - 10);
+        rec.y = (coord_t) ((int32_t) (Rnd() % 340) - 10);
+        rec.w = (length_t) (1 + Rnd() % 120);
+        rec.h = (length_t) (1 + Rnd() % 120);
+        GUI_Invalidate(&rec);
+      }
+      else {
+        cx = (uint8_t) (Rnd() % GUI_CELLS);
+        cy = (uint8_t) (Rnd() % GUI_CELLS);
+        old = arTile[t].arCell[cx][cy];
+        arTile[t].arCell[cx][cy] = (uint8_t) (Rnd() % 4);
+        TileCell(arObj[t], cx, cy, &rec);
+        if(t == 0 || old == 0 || arTile[t].arCell[cx][cy] == 0) GUI_Invalidate(&rec);
+        else GUI_ObjInvalidate(arObj[t], &rec);
+      }
+    }
+
+    pxExp = GUI_GetDamagePending();
+    for(t = 0; t <= GUI_TILES; t++) {
+      if(GUI_ObjIsNeedRefresh(arObj[t])) {
+        pxExp += P2D_GetPixelCnt((arObj[t]->damage.w > 0)? &arObj[t]->damage: &arObj[t]->rec);
+      }
+    }
+
+    GUI_DisplayListEnable((ii & 1) == 0);
+    GUI_RefreshObjects();
+    GUI_GetDamageStat(&stat);
+    if(stat.pxInvalidated != pxExp) badStat++;
+    if(ii > 0) pushed += stat.pxPushed;
+    ScreenGet(&arScreen[0][0]);
+
+    /*full redraw*/
+    P2D_SetClip(NULL);
+    P2D_SetColor(GetColor(G_COL_BACKGROUND));
+    P2D_Clear();
+    for(t = 0; t <= GUI_TILES; t++) {
+      P2D_SetClip(&arObj[t]->rec);
+      TileDraw(arObj[t], arObj[t]->obj);
+    }
+    P2D_SetClip(NULL);
+    ScreenGet(&arRef[0][0]);
+    if(ii == 0) full = stat.pxPushed;
+
+    if(memcmp(arScreen, arRef, sizeof(arRef)) != 0) badScreen++;
+  }
+  GUI_DisplayListEnable(true);
+
+  return Result("gui", badScreen == 0, "%.0f cycles, %.0f screens differ from a full redraw", GUI_STEPS, badScreen)
+    | Result("gui", badStat == 0, "%.0f cycles, %.0f invalidated areas differ from the damage", GUI_STEPS, badStat)
+    | Result("gui", pushed < full * GUI_STEPS, "%.0f pixels pushed per cycle, %.0f for the first (whole) one",
+      (double) pushed / GUI_STEPS, full);
+}
+
+
+/**
+ * @function TileDraw
+ * @brief draw function of the GUI test objects: each cell is transparent, or filled with a color of its state, its
+ *        object & its place, with a circle (state 2) or a line & a letter (state 3, the letter when it fits)
+ * @param void *g_obj: generic object
+ * @param void *obj: gui_tile_st
+ */
+static void TileDraw(void *g_obj, void *obj) {
+
+  const gui_tile_st *tile = obj;
+  rect_st rec;
+  uint8_t cx, cy, s;
+
+  for(cx = 0; cx < GUI_CELLS; cx++) {
+    for(cy = 0; cy < GUI_CELLS; cy++) {
+      s = tile->arCell[cx][cy];
+      if(s > 0) {
+        TileCell(g_obj, cx, cy, &rec);
+        P2D_SetColor(P2D_Color(s * 80, tile->id * 20, (cx * GUI_CELLS + cy) * 16));
+        P2D_FillRect(&rec);
+        P2D_SetColor(P2D_Color(255 - s * 80, 255 - tile->id * 20, 128));
+        if(s == 2) P2D_Circle(rec.x + rec.w / 2, rec.y + rec.h / 2, rec.w / 3);
+        if(s == 3) {
+          P2D_Line(rec.x, rec.y, rec.x + rec.w - 1, rec.y + rec.h - 1);
+          /*the letter shall not overflow its cell: the cell next to it may be damaged alone*/
+          P2D_SetFont(FontMedium);
+          P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+          if(P2D_GetTextWidth("A") + 2 <= rec.w && P2D_GetTextHeight() + 2 <= rec.h) P2D_PutText(rec.x + 2, rec.y + 2, "A");
+        }
+      }
+    }
+  }
+}
+
+
+/**
+ * @function TileCell
+ * @brief area of a cell of a GUI test object
+ * @param const g_obj_st *g_obj: generic object
+ * @param uint8_t cx, cy: cell
+ * @param rect_st *rec: output area (absolute)
+ */
+static void TileCell(const g_obj_st *g_obj, uint8_t cx, uint8_t cy, rect_st *rec) {
+  rec->x = g_obj->rec.x + (coord_t) (cx * g_obj->rec.w / GUI_CELLS);
+  rec->y = g_obj->rec.y + (coord_t) (cy * g_obj->rec.h / GUI_CELLS);
+  rec->w = (length_t) ((cx + 1) * g_obj->rec.w / GUI_CELLS - cx * g_obj->rec.w / GUI_CELLS);
+  rec->h = (length_t) ((cy + 1) * g_obj->rec.h / GUI_CELLS - cy * g_obj->rec.h / GUI_CELLS);
+}
+
+
+/**
+ * @function ScreenGet
+ * @brief copy the screen of the ILI9320 model
+ * @param uint16_t *dst: HOST_LCD_W x HOST_LCD_H pixels
+ */
+static void ScreenGet(uint16_t *dst) {
+
+  int x, y;
+
+  LCD_Sync();
+  for(y = 0; y < HOST_LCD_H; y++) {
+    for(x = 0; x < HOST_LCD_W; x++) *dst++ = HostLcdScreen(x, y);
+  }
+}
+
+
+/**
+ * @function RefPut
+ * @brief expected screen: one pixel at the cursor, which moves in raster order within the window & wraps
+ */
+static void RefPut(color_t c) {
+  arRef[refY][refX] = c;
+  if(++refX > refX1) {
+    refX = refX0;
+    if(++refY > refY1) refY = refY0;
+  }
+}
+
+
+/**
+ * @function RefCheck
+ * @brief compare the screen of the ILI9320 model with the expected one
+ * @return bool: true if identical
+ */
+static bool RefCheck(void) {
+
+  int x, y;
+  bool bOk = true;
+
+  LCD_Sync();
+  for(y = 0; y < HOST_LCD_H && bOk; y++) {
+    for(x = 0; x < HOST_LCD_W && bOk; x++) {
+      if(HostLcdScreen(x, y) != arRef[y][x]) bOk = false;
+    }
+  }
+  return bOk;
+}
+
+
+/**
+ * @function Done
+ * @brief end of transfer callback
+ */
+static void Done(void) {
+  doneCnt++;
+}
+
+
+/**
+ * @function Rnd
+ * @brief 16 bits pseudo-random value (same sequence on every host)
+ */
+static uint32_t Rnd(void) {
+  rndState = rndState * 1103515245u + 12345u;
+  return (rndState >> 8) & 0xFFFF;
+}
+
+
+/**
+ * @function Result
+ * @brief print a check result
+ * @return int: 0 if ok, 1 otherwise
+ */
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b) {
+  printf("%-10s %s ", name, bOk ? "ok  " : "FAIL");
+  printf(fmt, a, b);
+  printf("\n");
+  return bOk ? 0 : 1;
+}
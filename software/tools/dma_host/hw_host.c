@@ -0,0 +1,613 @@
+/**
+ * @file hw_host.c
+ * @brief host model of the DMA transfers (dma_host): interrupt controller, DMA controller, PMP, ILI9320 controller,
+ *        comparator, TMR2/3 & touch screen (never pressed);
+ *        each DMA cell is moved on its start event, the descriptors & the bus accesses are checked on the fly.
+ *        The transfers run to their end inside the call which starts them (no CPU / DMA overlap)
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-12
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+#include "hw_host.h"
+#include "hw_config.h"
+#include "ticks.h"
+#include "touchscreen.h"
+
+#define DMA_SIZE_MAX    0xFFFF      /*DCHxSSIZ, DCHxDSIZ & DCHxCSIZ are 16bit registers*/
+#define IRQ_QUEUE_LEN   16
+#define PMDIN_IDLE      0x10000u    /*PMDIN slot value when no CPU write is pending (a write is a 16bit value)*/
+
+typedef struct {
+  const uint8_t *src;
+  uint8_t *dst;
+  uint32_t srcSize, dstSize, cellSize;
+  uint32_t srcPtr, dstPtr, blockCnt;      /*bytes moved in the current block*/
+  uint32_t cells, blocks;
+  int evCtrl;
+  uint8_t evEnable, evFlags;
+  DmaChannelPri pri;
+  bool bAuto, bEnabled;
+} dma_host_st;
+
+/*registers*/
+unsigned int PMMODE, PMAEN, PMCON;
+host_pmmode_st PMMODEbits;
+host_pmcon_st PMCONbits;
+host_latg_st LATGbits;
+host_latd_st LATDbits;
+host_trisg_st TRISGbits;
+host_trisd_st TRISDbits;
+host_trise_st TRISEbits;
+host_intcon_st INTCONbits;
+unsigned int TMR2, DCH2INTCLR;
+
+/*interrupt controller*/
+extern void PmpDmaHandler(void);
+extern void FcntDmaHandler(void);
+static void (* const arIsr[_INT_SOURCE_COUNT]) (void) = {
+  NULL,             /*INT_INT2: frame marker, not simulated*/
+  NULL,             /*INT_PMP: DMA start event only*/
+  PmpDmaHandler,    /*INT_DMA0*/
+  FcntDmaHandler,   /*INT_DMA1*/
+  NULL,
+  NULL
+};
+static bool bIntFlag[_INT_SOURCE_COUNT], bIntEnable[_INT_SOURCE_COUNT];
+static uint8_t arIrq[IRQ_QUEUE_LEN], irqRd, irqWr;
+static bool bRunning = false;
+
+/*DMA controller*/
+static dma_host_st arDma[DMA_CHANNELS];
+static uint32_t descCnt, errCnt;
+
+/*PMP*/
+static unsigned int pmdin = PMDIN_IDLE;
+static bool bPmdinRs;
+static uint16_t *pLog;
+static uint32_t logMax, logCnt;
+
+/*ILI9320: GRAM [gate][source], address counter & registers*/
+static uint16_t arGram[HOST_LCD_H][HOST_LCD_W];
+static uint16_t arLcdReg[256];
+static uint16_t lcdIdx;
+static int lcdH, lcdV;
+
+static uint32_t coreCount;
+static uint64_t perTime;                  /*PER_CLK cycles since the start*/
+static bool bCmpOpen, bTimerOn;
+
+static void HostIrqPost(uint8_t irq);
+static void HostRun(void);
+static void DmaStartEvent(uint8_t irq);
+static void DmaCell(DmaChannel chn);
+static void DmaSetFlags(DmaChannel chn, uint8_t flags);
+static bool DmaIsPmpBusy(void);
+static void PmpWrite(bool bRs, uint16_t val);
+static void LcdWrite(bool bRs, uint16_t val);
+static void LcdIncrement(void);
+
+
+/*interrupt controller: a flag set while enabled runs its handler once the DMA events are done*/
+void INTEnable(INT_SOURCE src, INT_EN_DIS enable) {
+  bIntEnable[src] = (enable == INT_ENABLED);
+  HostRun();
+}
+
+unsigned int INTGetEnable(INT_SOURCE src) {
+  return bIntEnable[src]? 1: 0;
+}
+
+void INTClearFlag(INT_SOURCE src) {
+  bIntFlag[src] = false;
+}
+
+void INTSetFlag(INT_SOURCE src) {
+  bIntFlag[src] = true;
+  HostRun();
+}
+
+
+/*DMA controller*/
+void DmaChnOpen(DmaChannel chn, DmaChannelPri pri, int oFlags) {
+  uint32_t cells = arDma[chn].cells, blocks = arDma[chn].blocks;
+  memset(&arDma[chn], 0, sizeof(arDma[chn]));
+  arDma[chn].cells = cells;
+  arDma[chn].blocks = blocks;
+  arDma[chn].pri = pri;
+  arDma[chn].bAuto = (oFlags & DMA_OPEN_AUTO)? true: false;
+}
+
+void DmaChnSetEventControl(DmaChannel chn, int evFlags) {
+  arDma[chn].evCtrl = evFlags;
+}
+
+void DmaChnSetEvEnableFlags(DmaChannel chn, int evFlags) {
+  arDma[chn].evEnable |= (uint8_t) evFlags;
+}
+
+void DmaChnClrEvFlags(DmaChannel chn, int evFlags) {
+  arDma[chn].evFlags &= (uint8_t) ~evFlags;
+}
+
+int DmaChnGetEvFlags(DmaChannel chn) {
+  return arDma[chn].evFlags;
+}
+
+void DmaChnSetTxfer(DmaChannel chn, const void *vSrcAdd, void *vDstAdd, int srcSize, int dstSize, int cellSize) {
+
+  dma_host_st *p = &arDma[chn];
+
+  descCnt++;
+  if(p->bEnabled && p->blockCnt > 0) errCnt++;
+  if(srcSize < 1 || srcSize > DMA_SIZE_MAX || dstSize < 1 || dstSize > DMA_SIZE_MAX || cellSize < 1 || cellSize > DMA_SIZE_MAX) {
+    errCnt++;
+  }
+
+  /*PMP destination: one 16bit word per cell, i.e. per write cycle, from an aligned source*/
+  if(vDstAdd == (void *) &pmdin && (dstSize != 2 || cellSize != 2 || (srcSize & 1) != 0 || ((uintptr_t) vSrcAdd & 1) != 0)) {
+    errCnt++;
+  }
+
+  p->src = (const uint8_t *) vSrcAdd;
+  p->dst = (uint8_t *) vDstAdd;
+  p->srcSize = (uint32_t) srcSize;
+  p->dstSize = (uint32_t) dstSize;
+  p->cellSize = (uint32_t) cellSize;
+  p->srcPtr = p->dstPtr = p->blockCnt = 0;
+}
+
+void DmaChnEnable(DmaChannel chn) {
+  HostPmpFlush();
+  arDma[chn].bEnabled = true;
+}
+
+void DmaChnDisable(DmaChannel chn) {
+  arDma[chn].bEnabled = false;
+}
+
+void DmaChnStartTxfer(DmaChannel chn, int wait, unsigned long retries) {
+  (void) wait;
+  (void) retries;
+  HostPmpFlush();
+  arDma[chn].bEnabled = true;
+  DmaCell(chn);
+  HostRun();
+}
+
+
+/*PMP: a CPU write is sent once the next access starts, with the RS line of its own write*/
+unsigned int *HostPmpSlot(void) {
+  HostPmpFlush();
+  if(DmaIsPmpBusy()) errCnt++;
+  bPmdinRs = LATGbits.LATG12? true: false;
+  return &pmdin;
+}
+
+
+/*comparator, voltage reference & timer*/
+void CVREFOpen(int config) {
+  (void) config;
+}
+
+void CVREFClose(void) {
+}
+
+void CMP1Open(int config) {
+  (void) config;
+  bCmpOpen = true;
+}
+
+void CMP1Close(void) {
+  bCmpOpen = false;
+}
+
+void OpenTimer23(int config, unsigned int period) {
+  (void) config;
+  (void) period;
+  bTimerOn = true;
+}
+
+void CloseTimer23(void) {
+  bTimerOn = false;
+}
+
+
+/*system*/
+ticks_t TicksGet(void) {
+  return perTime / (PER_CLK / 1000);
+}
+
+uint32_t TicksGetCycles(void) {
+  return coreCount++;
+}
+
+void DelayMs(uint16_t u16delayMs) {
+  coreCount += (uint32_t) u16delayMs * (SYS_CLK / 2000);
+}
+
+
+/*touch screen*/
+void TouchScreenRead(coord_t *x, coord_t *y) {
+  *x = -1;
+  *y = -1;
+}
+
+
+/**
+ * @function HostDmaStat
+ * @brief number of DMA descriptors programmed & of rule violations since the start
+ *        (descriptor out of the register ranges, PMP descriptor which is not a 16bit cell per write,
+ *        descriptor changed during a block, CPU access to the PMP during a DMA transfer)
+ * @param uint32_t *pDesc: number of descriptors; may be NULL
+ * @param uint32_t *pErr: number of violations; may be NULL
+ * @return none
+ */
+void HostDmaStat(uint32_t *pDesc, uint32_t *pErr) {
+  if(pDesc != NULL) *pDesc = descCnt;
+  if(pErr != NULL) *pErr = errCnt;
+}
+
+
+/**
+ * @function HostDmaCount
+ * @brief number of cells moved & of blocks completed by a DMA channel since the start
+ * @param DmaChannel chn: channel
+ * @param uint32_t *pCells: number of cells; may be NULL
+ * @param uint32_t *pBlocks: number of blocks; may be NULL
+ * @return none
+ */
+void HostDmaCount(DmaChannel chn, uint32_t *pCells, uint32_t *pBlocks) {
+  if(pCells != NULL) *pCells = arDma[chn].cells;
+  if(pBlocks != NULL) *pBlocks = arDma[chn].blocks;
+}
+
+
+/**
+ * @function HostCmpEdge
+ * @brief rising edge on the comparator input at a given time: TMR2/3 & the ms ticks are updated to that time,
+ *        then the comparator interruption request (DMA start event) is raised if the comparator is open
+ * @param uint64_t t: time, in PER_CLK cycles since the start; shall not decrease
+ * @return none
+ */
+void HostCmpEdge(uint64_t t) {
+  HostSetTime(t);
+  if(bCmpOpen) {
+    HostIrqPost(_COMPARATOR_1_IRQ);
+    HostRun();
+  }
+}
+
+
+/**
+ * @function HostSetTime
+ * @brief set the time without comparator edge (TMR2/3 & ms ticks)
+ * @param uint64_t t: time, in PER_CLK cycles since the start; shall not decrease
+ * @return none
+ */
+void HostSetTime(uint64_t t) {
+  if(bTimerOn) TMR2 += (uint32_t) (t - perTime);
+  perTime = t;
+}
+
+
+/**
+ * @function HostPmpFlush
+ * @brief complete the last CPU write into PMDIN (a CPU write is sent once the next bus access starts)
+ * @param none
+ * @return none
+ */
+void HostPmpFlush(void) {
+  unsigned int val = pmdin;
+  pmdin = PMDIN_IDLE;
+  if(val < PMDIN_IDLE) {
+    PmpWrite(bPmdinRs, (uint16_t) val);
+    HostRun();
+  }
+}
+
+
+/**
+ * @function HostPmpLog
+ * @brief record the data words (RS high) sent by the PMP, CPU & DMA writes
+ * @param uint16_t *log: destination; NULL -> no record
+ * @param uint32_t max: max number of words recorded
+ * @return none
+ */
+void HostPmpLog(uint16_t *log, uint32_t max) {
+  HostPmpFlush();
+  pLog = log;
+  logMax = max;
+  logCnt = 0;
+}
+
+
+/**
+ * @function HostPmpLogCount
+ * @brief number of data words sent since the last HostPmpLog()
+ * @param none
+ * @return uint32_t: number of words (may be greater than the max recorded)
+ */
+uint32_t HostPmpLogCount(void) {
+  HostPmpFlush();
+  return logCnt;
+}
+
+
+/**
+ * @function HostLcdScreen
+ * @brief pixel shown on the screen by the ILI9320 model, in the orientation of the driver (DISP_ORIENTATION 270)
+ * @param int x, y: screen coordinates
+ * @return uint16_t: color
+ */
+uint16_t HostLcdScreen(int x, int y) {
+  /*screen line y is the gate HOST_LCD_H - 1 - y, which shows the GRAM line VL lines further*/
+  HostPmpFlush();
+  return arGram[(HOST_LCD_H - 1 - y + arLcdReg[0x6A]) % HOST_LCD_H][x];
+}
+
+
+/**
+ * @function HostLcdReg
+ * @brief value of a register of the ILI9320 model
+ * @param uint8_t addr: register index
+ * @return uint16_t: last value written
+ */
+uint16_t HostLcdReg(uint8_t addr) {
+  HostPmpFlush();
+  return arLcdReg[addr];
+}
+
+
+/**
+ * @function HostIrqPost
+ * @brief interruption request: DMA start event of the channels waiting for it, run by HostRun()
+ * @param uint8_t irq: interruption request number
+ * @return none
+ */
+static void HostIrqPost(uint8_t irq) {
+  if((irqWr + 1) % IRQ_QUEUE_LEN == irqRd) {
+    errCnt++;
+  }
+  else {
+    arIrq[irqWr] = irq;
+    irqWr = (irqWr + 1) % IRQ_QUEUE_LEN;
+  }
+}
+
+
+/**
+ * @function HostRun
+ * @brief run the pending DMA start events, then the handlers of the pending & enabled interruptions, until none is left
+ * @param none
+ * @return none
+ */
+static void HostRun(void) {
+
+  bool bRun = true;
+  uint8_t irq;
+  int src;
+
+  if(bRunning == false) {
+    bRunning = true;
+    while(bRun) {
+      bRun = false;
+      if(irqRd != irqWr) {
+        irq = arIrq[irqRd];
+        irqRd = (irqRd + 1) % IRQ_QUEUE_LEN;
+        DmaStartEvent(irq);
+        bRun = true;
+      }
+      else {
+        for(src = 0; src < _INT_SOURCE_COUNT && bRun == false; src++) {
+          if(bIntFlag[src] && bIntEnable[src] && arIsr[src] != NULL) {
+            arIsr[src]();
+            bRun = true;
+          }
+        }
+      }
+    }
+    bRunning = false;
+  }
+}
+
+
+/**
+ * @function DmaStartEvent
+ * @brief one cell for each enabled channel started by an interruption request, by decreasing priority
+ * @param uint8_t irq: interruption request number
+ * @return none
+ */
+static void DmaStartEvent(uint8_t irq) {
+
+  int pri, chn;
+
+  for(pri = DMA_CHN_PRI3; pri >= DMA_CHN_PRI0; pri--) {
+    for(chn = 0; chn < DMA_CHANNELS; chn++) {
+      if(arDma[chn].bEnabled && (int) arDma[chn].pri == pri && (arDma[chn].evCtrl & DMA_EV_START_IRQ_EN) &&
+        ((arDma[chn].evCtrl >> 8) & 0xFF) == irq) {
+        DmaCell((DmaChannel) chn);
+      }
+    }
+  }
+}
+
+
+/**
+ * @function DmaCell
+ * @brief move one cell; a block ends after max(source size, destination size) bytes
+ * @param DmaChannel chn: channel
+ * @return none
+ */
+static void DmaCell(DmaChannel chn) {
+
+  dma_host_st *p = &arDma[chn];
+  uint32_t blk, ii;
+  uint8_t flags = DMA_EV_CELL_DONE;
+
+  if(p->src == NULL || p->dst == NULL) {
+    errCnt++;
+    p->bEnabled = false;
+  }
+  else {
+    blk = (p->srcSize > p->dstSize)? p->srcSize: p->dstSize;
+    for(ii = 0; ii < p->cellSize && p->blockCnt < blk; ii++) {
+      p->dst[p->dstPtr++] = p->src[p->srcPtr++];
+      p->blockCnt++;
+      if(p->srcPtr == p->srcSize / 2) flags |= DMA_EV_SRC_HALF;
+      if(p->dstPtr == p->dstSize / 2) flags |= DMA_EV_DST_HALF;
+      if(p->srcPtr == p->srcSize) { p->srcPtr = 0; flags |= DMA_EV_SRC_FULL; }
+      if(p->dstPtr == p->dstSize) { p->dstPtr = 0; flags |= DMA_EV_DST_FULL; }
+    }
+
+    p->cells++;
+    if(p->blockCnt >= blk) {
+      p->blocks++;
+      p->srcPtr = p->dstPtr = p->blockCnt = 0;
+      if(p->bAuto == false) p->bEnabled = false;
+      flags |= DMA_EV_BLOCK_DONE;
+    }
+
+    /*destination register*/
+    if(p->dst == (uint8_t *) &pmdin) {
+      ii = pmdin & 0xFFFF;
+      pmdin = PMDIN_IDLE;
+      PmpWrite(LATGbits.LATG12? true: false, (uint16_t) ii);
+    }
+    else if(p->dst == (uint8_t *) &DCH2INTCLR) {
+      arDma[DMA_CHANNEL2].evFlags &= (uint8_t) ~DCH2INTCLR;
+    }
+
+    DmaSetFlags(chn, flags);
+  }
+}
+
+
+/**
+ * @function DmaSetFlags
+ * @brief set event flags; the channel interruption (flag & DMA start event) is raised when its first enabled flag is set
+ * @param DmaChannel chn: channel
+ * @param uint8_t flags: events
+ * @return none
+ */
+static void DmaSetFlags(DmaChannel chn, uint8_t flags) {
+
+  bool bReq = (arDma[chn].evFlags & arDma[chn].evEnable) != 0;
+
+  arDma[chn].evFlags |= flags;
+  if(bReq == false && (arDma[chn].evFlags & arDma[chn].evEnable) != 0) {
+    bIntFlag[INT_SOURCE_DMA(chn)] = true;
+    HostIrqPost((uint8_t) (_DMA0_IRQ + chn));
+  }
+}
+
+
+/**
+ * @function DmaIsPmpBusy
+ * @brief tell if a DMA channel writes into the PMP
+ * @param none
+ * @return bool: true if busy
+ */
+static bool DmaIsPmpBusy(void) {
+
+  int chn;
+  bool bBusy = false;
+
+  for(chn = 0; chn < DMA_CHANNELS; chn++) {
+    if(arDma[chn].bEnabled && arDma[chn].dst == (uint8_t *) &pmdin) bBusy = true;
+  }
+  return bBusy;
+}
+
+
+/**
+ * @function PmpWrite
+ * @brief PMP write cycle: word sent to the LCD controller, then PMP interruption request (IRQM = 1)
+ * @param bool bRs: RS line; false: index, true: data
+ * @param uint16_t val: word
+ * @return none
+ */
+static void PmpWrite(bool bRs, uint16_t val) {
+
+  if(PMCONbits.PMPEN == 0 || LATGbits.LATG13 != 0) errCnt++;   /*PMP off or LCD not selected*/
+
+  if(bRs) {
+    if(pLog != NULL && logCnt < logMax) pLog[logCnt] = val;
+    logCnt++;
+  }
+  LcdWrite(bRs, val);
+
+  if(PMMODEbits.IRQM == 1) {
+    bIntFlag[INT_PMP] = true;
+    HostIrqPost(_PMP_IRQ);
+  }
+}
+
+
+/**
+ * @function LcdWrite
+ * @brief ILI9320: index register (RS low), register or GRAM (index 0x22) write (RS high)
+ * @param bool bRs: RS line
+ * @param uint16_t val: word
+ * @return none
+ */
+static void LcdWrite(bool bRs, uint16_t val) {
+  if(bRs == false) {
+    lcdIdx = val & 0xFF;
+  }
+  else if(lcdIdx == 0x22) {
+    arGram[lcdV][lcdH] = val;
+    LcdIncrement();
+  }
+  else {
+    arLcdReg[lcdIdx] = val;
+    if(lcdIdx == 0x20) lcdH = val % HOST_LCD_W;
+    else if(lcdIdx == 0x21) lcdV = val % HOST_LCD_H;
+  }
+}
+
+
+/**
+ * @function LcdIncrement
+ * @brief ILI9320: address counter update after a GRAM write, following the entry mode (0x03: I/D1-0, AM)
+ *        within the window (0x50-0x53)
+ * @param none
+ * @return none
+ */
+static void LcdIncrement(void) {
+
+  uint16_t em = arLcdReg[0x03];
+  int dh = (em & 0x10)? 1: -1, dv = (em & 0x20)? 1: -1;
+  int hs = arLcdReg[0x50], he = arLcdReg[0x51], vs = arLcdReg[0x52], ve = arLcdReg[0x53];
+
+  if((em & 0x08) == 0) {
+    lcdH += dh;
+    if(lcdH < hs || lcdH > he) {
+      lcdH = (dh > 0)? hs: he;
+      lcdV += dv;
+      if(lcdV < vs || lcdV > ve) lcdV = (dv > 0)? vs: ve;
+    }
+  }
+  else {
+    lcdV += dv;
+    if(lcdV < vs || lcdV > ve) {
+      lcdV = (dv > 0)? vs: ve;
+      lcdH += dh;
+      if(lcdH < hs || lcdH > he) lcdH = (dh > 0)? hs: he;
+    }
+  }
+}
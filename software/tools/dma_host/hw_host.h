@@ -0,0 +1,111 @@
+/**
+ * @file hw_host.h
+ * @brief host model of the DMA transfers (dma_host): interrupt controller, DMA controller, PMP, ILI9320 controller,
+ *        comparator & TMR2/3;
+ *        each DMA cell is moved on its start event, the descriptors & the bus accesses are checked on the fly
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-12
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _hw_host_h_
+#define _hw_host_h_
+
+#include "main.h"
+
+#define HOST_LCD_W  240   /*GRAM: 240 sources x 320 gates*/
+#define HOST_LCD_H  320
+
+/**
+ * @function HostDmaStat
+ * @brief number of DMA descriptors programmed & of rule violations since the start
+ *        (descriptor out of the register ranges, PMP descriptor which is not a 16bit cell per write,
+ *        descriptor changed during a block, CPU access to the PMP during a DMA transfer)
+ * @param uint32_t *pDesc: number of descriptors; may be NULL
+ * @param uint32_t *pErr: number of violations; may be NULL
+ * @return none
+ */
+void HostDmaStat(uint32_t *pDesc, uint32_t *pErr);
+
+/**
+ * @function HostPmpFlush
+ * @brief complete the last CPU write into PMDIN (a CPU write is sent once the next bus access starts)
+ * @param none
+ * @return none
+ */
+void HostPmpFlush(void);
+
+/**
+ * @function HostPmpLog
+ * @brief record the data words (RS high) sent by the PMP, CPU & DMA writes
+ * @param uint16_t *log: destination; NULL -> no record
+ * @param uint32_t max: max number of words recorded
+ * @return none
+ */
+void HostPmpLog(uint16_t *log, uint32_t max);
+
+/**
+ * @function HostPmpLogCount
+ * @brief number of data words sent since the last HostPmpLog()
+ * @param none
+ * @return uint32_t: number of words (may be greater than the max recorded)
+ */
+uint32_t HostPmpLogCount(void);
+
+/**
+ * @function HostLcdScreen
+ * @brief pixel shown on the screen by the ILI9320 model, in the orientation of the driver (DISP_ORIENTATION 270)
+ * @param int x, y: screen coordinates
+ * @return uint16_t: color
+ */
+uint16_t HostLcdScreen(int x, int y);
+
+/**
+ * @function HostLcdReg
+ * @brief value of a register of the ILI9320 model
+ * @param uint8_t addr: register index
+ * @return uint16_t: last value written
+ */
+uint16_t HostLcdReg(uint8_t addr);
+
+/**
+ * @function HostDmaCount
+ * @brief number of cells moved & of blocks completed by a DMA channel since the start
+ * @param DmaChannel chn: channel
+ * @param uint32_t *pCells: number of cells; may be NULL
+ * @param uint32_t *pBlocks: number of blocks; may be NULL
+ * @return none
+ */
+void HostDmaCount(DmaChannel chn, uint32_t *pCells, uint32_t *pBlocks);
+
+/**
+ * @function HostCmpEdge
+ * @brief rising edge on the comparator input at a given time: TMR2/3 & the ms ticks are updated to that time,
+ *        then the comparator interruption request (DMA start event) is raised if the comparator is open
+ * @param uint64_t t: time, in PER_CLK cycles since the start; shall not decrease
+ * @return none
+ */
+void HostCmpEdge(uint64_t t);
+
+/**
+ * @function HostSetTime
+ * @brief set the time without comparator edge (TMR2/3 & ms ticks)
+ * @param uint64_t t: time, in PER_CLK cycles since the start; shall not decrease
+ * @return none
+ */
+void HostSetTime(uint64_t t);
+
+#endif
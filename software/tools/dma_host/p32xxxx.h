@@ -0,0 +1,47 @@
+/**
+ * @file p32xxxx.h
+ * @brief host model of the DMA transfers (dma_host): stands for the PIC32 device header; the registers used by the
+ *        drivers are variables of hw_host.c. PMDIN is a slot of the simulated PMP: a value written into it is sent
+ *        to the simulated LCD controller, with the RS line latched at the write. A value moved into DCH2INTCLR clears
+ *        these flags of the DMA channel 2
+ */
+#ifndef _dma_host_p32xxxx_h_
+#define _dma_host_p32xxxx_h_
+
+/*PMP*/
+typedef struct {
+  unsigned int BUSY, IRQM, MODE, WAITB, WAITM, WAITE, MODE16;
+} host_pmmode_st;
+
+typedef struct {
+  unsigned int PTRDEN, PTWREN, PMPEN;
+} host_pmcon_st;
+
+unsigned int *HostPmpSlot(void);
+#define PMDIN (*HostPmpSlot())
+
+extern unsigned int PMMODE, PMAEN, PMCON;
+extern host_pmmode_st PMMODEbits;
+extern host_pmcon_st PMCONbits;
+
+/*LCD control lines (CS: RG13, RS: RG12, RST: RD2) & frame marker input (RE9 / INT2)*/
+typedef struct { unsigned int LATG12, LATG13; } host_latg_st;
+typedef struct { unsigned int LATD2; } host_latd_st;
+typedef struct { unsigned int TRISG12, TRISG13; } host_trisg_st;
+typedef struct { unsigned int TRISD2; } host_trisd_st;
+typedef struct { unsigned int TRISE9; } host_trise_st;
+typedef struct { unsigned int INT2EP; } host_intcon_st;
+
+extern host_latg_st LATGbits;
+extern host_latd_st LATDbits;
+extern host_trisg_st TRISGbits;
+extern host_trisd_st TRISDbits;
+extern host_trise_st TRISEbits;
+extern host_intcon_st INTCONbits;
+
+/*TMR2/3 count & DMA channel 2 interrupt flags clear register*/
+#define _DCH2INT_CHBCIF_MASK  0x00000008
+
+extern unsigned int TMR2, DCH2INTCLR;
+
+#endif
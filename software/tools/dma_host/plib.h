@@ -0,0 +1,119 @@
+/**
+ * @file plib.h
+ * @brief host model of the DMA transfers (dma_host): stands for the PIC32 peripheral library;
+ *        interrupt controller, DMA controller, PMP, comparator & timer are simulated by hw_host.c
+ */
+#ifndef _dma_host_plib_h_
+#define _dma_host_plib_h_
+
+typedef int BOOL;
+#define TRUE  1
+#define FALSE 0
+
+/*interrupt sources & vectors (only those used by the host build)*/
+typedef enum {
+  INT_INT2,
+  INT_PMP,
+  INT_DMA0,
+  INT_DMA1,
+  INT_DMA2,
+  INT_DMA3,
+  _INT_SOURCE_COUNT
+} INT_SOURCE;
+
+typedef enum {
+  INT_DISABLED,
+  INT_ENABLED
+} INT_EN_DIS;
+
+#define INT_SOURCE_DMA(chn)           ((INT_SOURCE) (INT_DMA0 + (chn)))
+#define INT_VECTOR_DMA(chn)           (chn)
+#define INT_EXTERNAL_2_VECTOR         0
+#define INT_PRIORITY_LEVEL_2          2
+#define INT_PRIORITY_LEVEL_3          3
+#define INT_SUB_PRIORITY_LEVEL_0      0
+
+#define __ISR(vector, ipl)
+#define INTSetVectorPriority(v, p)    ((void) 0)
+#define INTSetVectorSubPriority(v, p) ((void) 0)
+
+void INTEnable(INT_SOURCE src, INT_EN_DIS enable);
+unsigned int INTGetEnable(INT_SOURCE src);
+void INTClearFlag(INT_SOURCE src);
+void INTSetFlag(INT_SOURCE src);
+
+/*interruption requests which can start a DMA cell transfer*/
+enum {
+  _PMP_IRQ = 1,
+  _DMA0_IRQ,
+  _DMA1_IRQ,
+  _DMA2_IRQ,
+  _DMA3_IRQ,
+  _COMPARATOR_1_IRQ
+};
+
+/*DMA controller; flags have the values of the DCHxCON / DCHxECON / DCHxINT bits*/
+typedef enum {
+  DMA_CHANNEL0,
+  DMA_CHANNEL1,
+  DMA_CHANNEL2,
+  DMA_CHANNEL3,
+  DMA_CHANNELS
+} DmaChannel;
+
+typedef enum {
+  DMA_CHN_PRI0,
+  DMA_CHN_PRI1,
+  DMA_CHN_PRI2,
+  DMA_CHN_PRI3
+} DmaChannelPri;
+
+#define DMA_OPEN_DEFAULT      0x00
+#define DMA_OPEN_AUTO         0x10                /*CHAEN: re-enabled at the end of each block*/
+#define DMA_EV_START_IRQ_EN   0x10                /*SIRQEN*/
+#define DMA_EV_START_IRQ(irq) ((irq) << 8)        /*CHSIRQ*/
+#define DMA_EV_ERR            0x01
+#define DMA_EV_ABORT          0x02
+#define DMA_EV_CELL_DONE      0x04
+#define DMA_EV_BLOCK_DONE     0x08
+#define DMA_EV_DST_HALF       0x10
+#define DMA_EV_DST_FULL       0x20
+#define DMA_EV_SRC_HALF       0x40
+#define DMA_EV_SRC_FULL       0x80
+#define DMA_EV_ALL_EVNTS      0xFF
+#define DMA_WAIT_NOT          0
+
+void DmaChnOpen(DmaChannel chn, DmaChannelPri pri, int oFlags);
+void DmaChnSetEventControl(DmaChannel chn, int evFlags);
+void DmaChnSetEvEnableFlags(DmaChannel chn, int evFlags);
+void DmaChnClrEvFlags(DmaChannel chn, int evFlags);
+int DmaChnGetEvFlags(DmaChannel chn);
+void DmaChnSetTxfer(DmaChannel chn, const void *vSrcAdd, void *vDstAdd, int srcSize, int dstSize, int cellSize);
+void DmaChnEnable(DmaChannel chn);
+void DmaChnDisable(DmaChannel chn);
+void DmaChnStartTxfer(DmaChannel chn, int wait, unsigned long retries);
+
+/*comparator, voltage reference & TMR2/3: only the edges of the comparator & the timer count are simulated*/
+#define CVREF_ENABLE            0
+#define CVREF_OUTPUT_DISABLE    0
+#define CVREF_RANGE_HIGH        0
+#define CVREF_SOURCE_AVDD       0
+#define CVREF_STEP_8            0
+#define CMP_ENABLE              0
+#define CMP_OUTPUT_DISABLE      0
+#define CMP_OUTPUT_INVERT       0
+#define CMP_EVENT_LOW_TO_HIGH   0
+#define CMP_POS_INPUT_CVREF     0
+#define CMP1_NEG_INPUT_C1IN_NEG 0
+#define T23_ON                  0
+#define T23_PS_1_1              0
+#define T23_SOURCE_INT          0
+
+void CVREFOpen(int config);
+void CVREFClose(void);
+void CMP1Open(int config);
+void CMP1Close(void);
+void OpenTimer23(int config, unsigned int period);
+void CloseTimer23(void);
+
+#endif
@@ -0,0 +1,571 @@
+/**
+ * @file font_box.c
+ * @brief host tool: compiles 4BPP font resources (.c files) into the trimmed glyph box format of p2d_font.c
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-07-05
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * usage: font_box <font_file.c> [<font_file.c> ...]
+ *        font_box -i <font.ttf|.otf|.bdf|.pcf> <pixel size> <first glyph> <last glyph> <array name>
+ *
+ * 1st form: every 4BPP font array of each file is rewritten in place as a FONT_4BPP_BOX font; arrays
+ * already converted are decoded then encoded again, so the tool can be run at every build: a file is
+ * only written if its content changes. Anything outside the arrays (#ifdef, comments...) is kept.
+ * 2nd form: rasterizes a font through FreeType, and prints the resource file on stdout; only available
+ * when built with FONT_BOX_FREETYPE ("make font_box_ft" in dds.X):
+ *   gcc -O2 -DFONT_BOX_FREETYPE -o font_box font_box.c $(pkg-config --cflags --libs freetype2)
+ *
+ * FONT_4BPP_BOX font:
+ *  3, first glyph, last glyph, font height
+ *  glyph table: one 8 bytes entry per glyph
+ *    width (advance), box x, box y, box w, box h: the box is the smallest rectangle of the glyph cell
+ *    (width x font height) holding all the non-zero pixels; a blank glyph has an empty box (0, 0, 0, 0)
+ *    offset of the box data from the first glyph (24 bits, MSB first); bit 7 of the MSB is the RLE flag
+ *  box data, starting on a byte boundary:
+ *    raw: box w * box h nibbles, MSB first, row after row
+ *    RLE: one byte per run [LLLL CCCC], L + 1 pixels of nibble C; a run never crosses a row
+ *  each glyph gets the smaller of both encodings
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#ifdef FONT_BOX_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+#define FONT_4BPP       2
+#define FONT_4BPP_BOX   3
+#define BPP_ENTRY_SIZE  4
+#define BOX_ENTRY_SIZE  8
+#define BOX_RLE         0x80
+#define RLE_RUN_MAX     16
+#define BYTES_PER_LINE  20
+
+typedef struct {
+  uint8_t first, last, height;
+  uint8_t width[256];
+  uint8_t *px[256];           /*glyph cell, one nibble per byte, width * height*/
+} font_st;
+
+
+/**
+ * @function LoadFile
+ * @brief load a whole text file
+ * @param const char *path: file path
+ * @param size_t *len: output length
+ * @return char*: file content (zero terminated), NULL if error
+ */
+static char *LoadFile(const char *path, size_t *len) {
+
+  FILE *f;
+  char *buf = NULL;
+  long size;
+
+  f = fopen(path, "rb");
+  if(f != NULL) {
+    if(fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+      buf = malloc((size_t) size + 1);
+      if(buf != NULL) {
+        if(fread(buf, 1, (size_t) size, f) == (size_t) size) {
+          buf[size] = 0;
+          *len = (size_t) size;
+        }
+        else {
+          free(buf);
+          buf = NULL;
+        }
+      }
+    }
+    fclose(f);
+  }
+
+  return buf;
+}
+
+
+/**
+ * @function ParseArray
+ * @brief read the numbers of a C array initializer, comments skipped
+ * @param const char *p: first char after the '{'
+ * @param uint8_t *out: output bytes
+ * @param size_t max: size of out
+ * @param size_t *cnt: number of bytes read
+ * @return const char*: pointer to the closing '}', NULL if error
+ */
+static const char *ParseArray(const char *p, uint8_t *out, size_t max, size_t *cnt) {
+
+  char *end;
+  unsigned long val;
+
+  *cnt = 0;
+  while(*p != 0 && *p != '}') {
+    if(p[0] == '/' && p[1] == '*') {
+      p = strstr(p + 2, "*/");
+      if(p == NULL) break;
+      p += 2;
+    }
+    else if(p[0] == '/' && p[1] == '/') {
+      while(*p != 0 && *p != '\n') p++;
+    }
+    else if(isdigit((unsigned char) *p)) {
+      val = strtoul(p, &end, 0);
+      if(val > 0xFF || *cnt >= max) return NULL;
+      out[(*cnt)++] = (uint8_t) val;
+      p = end;
+    }
+    else {
+      p++;
+    }
+  }
+
+  return (p != NULL && *p == '}') ? p : NULL;
+}
+
+
+/**
+ * @function FontFree
+ * @brief release the glyph cells of a font
+ * @param font_st *font: font
+ * @return none
+ */
+static void FontFree(font_st *font) {
+  int g;
+  for(g = 0; g < 256; g++) {
+    free(font->px[g]);
+    font->px[g] = NULL;
+  }
+}
+
+
+/**
+ * @function FontDecode
+ * @brief expand a FONT_4BPP or FONT_4BPP_BOX font into glyph cells
+ * @param const uint8_t *p: font array
+ * @param size_t len: font array length
+ * @param font_st *font: output font
+ * @return int: 0 success, -1 error
+ */
+static int FontDecode(const uint8_t *p, size_t len, font_st *font) {
+
+  const uint8_t *entry, *raw, *data;
+  uint32_t offset, n, i, x, y, bx, by, bw, bh, run;
+  size_t entrySize, rawPos;
+  int g;
+
+  if(len < 4 || (p[0] != FONT_4BPP && p[0] != FONT_4BPP_BOX) || p[1] > p[2] || p[3] == 0) return -1;
+
+  memset(font, 0, sizeof(*font));
+  font->first = p[1];
+  font->last = p[2];
+  font->height = p[3];
+  entrySize = (p[0] == FONT_4BPP) ? BPP_ENTRY_SIZE : BOX_ENTRY_SIZE;
+  rawPos = 4 + entrySize * (size_t) (font->last - font->first + 1);
+  if(rawPos > len) return -1;
+  raw = &p[rawPos];
+
+  for(g = font->first; g <= font->last; g++) {
+
+    entry = &p[4 + entrySize * (size_t) (g - font->first)];
+    font->width[g] = entry[0];
+    n = (uint32_t) font->width[g] * font->height;
+    font->px[g] = calloc(n + 1, 1);
+    if(font->px[g] == NULL) return -1;
+
+    if(p[0] == FONT_4BPP) {
+      offset = ((uint32_t) entry[1] << 16) + ((uint32_t) entry[2] << 8) + entry[3];
+      if(rawPos + offset + (n + 1) / 2 > len) return -1;
+      data = &raw[offset];
+      for(i = 0; i < n; i++) font->px[g][i] = (i & 1) ? (data[i / 2] & 0x0F) : (data[i / 2] >> 4);
+    }
+    else {
+      bx = entry[1];
+      by = entry[2];
+      bw = entry[3];
+      bh = entry[4];
+      offset = ((uint32_t) (entry[5] & ~BOX_RLE) << 16) + ((uint32_t) entry[6] << 8) + entry[7];
+      if(bx + bw > font->width[g] || by + bh > font->height) return -1;
+      data = &raw[offset];
+      if(entry[5] & BOX_RLE) {
+        for(y = 0; y < bh; y++) {
+          for(x = 0; x < bw; x += run) {
+            if(data >= &p[len]) return -1;
+            run = (uint32_t) (*data >> 4) + 1;
+            if(x + run > bw) return -1;
+            for(i = 0; i < run; i++) font->px[g][(by + y) * font->width[g] + bx + x + i] = *data & 0x0F;
+            data++;
+          }
+        }
+      }
+      else {
+        if(rawPos + offset + (bw * bh + 1) / 2 > len) return -1;
+        for(i = 0; i < bw * bh; i++) {
+          font->px[g][(by + i / bw) * font->width[g] + bx + i % bw] = (i & 1) ? (data[i / 2] & 0x0F) : (data[i / 2] >> 4);
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+/**
+ * @function RleEncode
+ * @brief encode the box of a glyph as runs
+ * @param const uint8_t *px: glyph cell
+ * @param uint32_t w: cell width
+ * @param uint32_t bx, by, bw, bh: box
+ * @param uint8_t *out: output runs; NULL for computing the length only
+ * @return size_t: number of bytes
+ */
+static size_t RleEncode(const uint8_t *px, uint32_t w, uint32_t bx, uint32_t by, uint32_t bw, uint32_t bh, uint8_t *out) {
+
+  const uint8_t *row;
+  size_t len = 0;
+  uint32_t x, y, run;
+
+  for(y = by; y < by + bh; y++) {
+    row = &px[y * w + bx];
+    for(x = 0; x < bw; x += run) {
+      run = 1;
+      while(x + run < bw && run < RLE_RUN_MAX && row[x + run] == row[x]) run++;
+      if(out != NULL) out[len] = (uint8_t) (((run - 1) << 4) | row[x]);
+      len++;
+    }
+  }
+
+  return len;
+}
+
+
+/**
+ * @function WriteBytes
+ * @brief print a byte list, BYTES_PER_LINE per line
+ * @param FILE *f: output
+ * @param const uint8_t *p: bytes
+ * @param size_t n: number of bytes
+ * @param int bLast: no trailing ',' after the last byte
+ * @return none
+ */
+static void WriteBytes(FILE *f, const uint8_t *p, size_t n, int bLast) {
+  size_t i;
+  for(i = 0; i < n; i++) {
+    if(i % BYTES_PER_LINE == 0) fprintf(f, "  ");
+    fprintf(f, "0x%02X", p[i]);
+    if(i + 1 < n || bLast == 0) fprintf(f, ",");
+    if(i % BYTES_PER_LINE == BYTES_PER_LINE - 1 || i + 1 == n) fprintf(f, "\n");
+    else fprintf(f, " ");
+  }
+}
+
+
+/**
+ * @function FontEncode
+ * @brief print the array initializer of a FONT_4BPP_BOX font, braces excluded
+ * @param FILE *f: output
+ * @param const font_st *font: font
+ * @param size_t *size: output font size, in bytes
+ * @return int: 0 success, -1 error
+ */
+static int FontEncode(FILE *f, const font_st *font, size_t *size) {
+
+  uint8_t entry[256][BOX_ENTRY_SIZE];
+  uint8_t *data, *out;
+  size_t dataLen = 0, rleLen, rawLen, cap;
+  uint32_t w, h, x, y, x0, y0, x1, y1, i;
+  int g, cnt, bBlank;
+
+  cnt = font->last - font->first + 1;
+  cap = 16;
+  for(g = font->first; g <= font->last; g++) cap += (size_t) font->width[g] * font->height;
+  data = malloc(cap);
+  if(data == NULL) return -1;
+
+  for(g = font->first; g <= font->last; g++) {
+
+    w = font->width[g];
+    h = font->height;
+
+    /*bounding box of the non-zero pixels*/
+    x0 = w; y0 = h; x1 = 0; y1 = 0;
+    for(y = 0; y < h; y++) {
+      for(x = 0; x < w; x++) {
+        if(font->px[g][y * w + x] != 0) {
+          if(x < x0) x0 = x;
+          if(x > x1) x1 = x;
+          if(y < y0) y0 = y;
+          if(y > y1) y1 = y;
+        }
+      }
+    }
+    bBlank = (x0 > x1) ? 1 : 0;
+    if(bBlank) {
+      x0 = 0; y0 = 0; x1 = 0; y1 = 0;
+    }
+
+    out = &data[dataLen];
+    entry[g][0] = font->width[g];
+    entry[g][1] = (uint8_t) x0;
+    entry[g][2] = (uint8_t) y0;
+    entry[g][3] = (uint8_t) (bBlank ? 0 : x1 - x0 + 1);
+    entry[g][4] = (uint8_t) (bBlank ? 0 : y1 - y0 + 1);
+    entry[g][5] = (uint8_t) (dataLen >> 16);
+    entry[g][6] = (uint8_t) (dataLen >> 8);
+    entry[g][7] = (uint8_t) dataLen;
+    if(dataLen >= ((size_t) BOX_RLE << 16)) {
+      free(data);
+      return -1;
+    }
+
+    if(bBlank == 0) {
+      rawLen = ((size_t) entry[g][3] * entry[g][4] + 1) / 2;
+      rleLen = RleEncode(font->px[g], w, x0, y0, entry[g][3], entry[g][4], NULL);
+      if(rleLen < rawLen) {
+        entry[g][5] |= BOX_RLE;
+        dataLen += RleEncode(font->px[g], w, x0, y0, entry[g][3], entry[g][4], out);
+      }
+      else {
+        memset(out, 0, rawLen);
+        for(i = 0; i < (uint32_t) entry[g][3] * entry[g][4]; i++) {
+          out[i / 2] |= (uint8_t) (font->px[g][(y0 + i / entry[g][3]) * w + x0 + i % entry[g][3]] << ((i & 1) ? 0 : 4));
+        }
+        dataLen += rawLen;
+      }
+    }
+  }
+
+  fprintf(f, "\n  %d,  /*font type: 4BPP, trimmed glyph boxes*/\n", FONT_4BPP_BOX);
+  fprintf(f, "  %u, /*first car ID*/\n", font->first);
+  fprintf(f, "  %u, /*last car ID*/\n", font->last);
+  fprintf(f, "  %u, /*font height*/\n", font->height);
+  fprintf(f, "  /*index table: glyph width, box x, y, w, h, offset hl (bit 7: RLE), lh, ll*/\n");
+  for(g = font->first; g <= font->last; g++) {
+    fprintf(f, " ");
+    for(i = 0; i < BOX_ENTRY_SIZE; i++) fprintf(f, " 0x%02X,", entry[g][i]);
+    if(g > ' ' && g < 0x7F) fprintf(f, " /*'%c'*/\n", g);
+    else fprintf(f, " /*0x%02X*/\n", g);
+  }
+  fprintf(f, "  /*glyph boxes*/\n");
+  WriteBytes(f, data, dataLen, 1);
+
+  *size = 4 + (size_t) cnt * BOX_ENTRY_SIZE + dataLen;
+  free(data);
+  return 0;
+}
+
+
+/**
+ * @function ConvertFile
+ * @brief convert the 4BPP fonts contained in a resource file
+ * @param const char *path: resource file
+ * @return int: 0 success, -1 error
+ */
+static int ConvertFile(const char *path) {
+
+  static font_st font;
+  char *src, *body, *name, *out = NULL, msg[4096];
+  const char *p, *end;
+  uint8_t *arr;
+  size_t srcLen, arrLen, newLen, outLen = 0, msgLen = 0;
+  FILE *f;
+  int res = 0;
+
+  msg[0] = 0;
+  src = LoadFile(path, &srcLen);
+  arr = (src != NULL) ? malloc(srcLen + 1) : NULL;
+  f = tmpfile();
+  if(arr == NULL || f == NULL) {
+    fprintf(stderr, "%s: cannot read\n", path);
+    free(src);
+    free(arr);
+    if(f != NULL) fclose(f);
+    return -1;
+  }
+
+  /*copy the file, every font array being encoded again*/
+  p = src;
+  for(name = strstr(src, "const uint8_t"); name != NULL && res == 0; name = strstr(end, "const uint8_t")) {
+    body = strchr(name, '{');
+    end = (body != NULL) ? ParseArray(body + 1, arr, srcLen, &arrLen) : NULL;
+    if(end == NULL) {
+      fprintf(stderr, "%s: bad array\n", path);
+      end = name + 1;
+      res = -1;
+    }
+    else if(FontDecode(arr, arrLen, &font) == 0) {
+      fwrite(p, 1, (size_t) (body + 1 - p), f);
+      res = FontEncode(f, &font, &newLen);
+      if(res == 0 && msgLen < sizeof(msg)) {
+        msgLen += (size_t) snprintf(&msg[msgLen], sizeof(msg) - msgLen, "%s: %.*s: %u glyphs, %lu -> %lu bytes\n", path,
+                                    (int) strcspn(name + 14, "[ "), name + 14, font.last - font.first + 1,
+                                    (unsigned long) arrLen, (unsigned long) newLen);
+      }
+      else {
+        fprintf(stderr, "%s: font too large\n", path);
+      }
+      p = end;
+    }
+    FontFree(&font);
+  }
+  fputs(p, f);
+
+  if(res == 0) {
+    outLen = (size_t) ftell(f);
+    out = malloc(outLen + 1);
+    rewind(f);
+    if(out == NULL || fread(out, 1, outLen, f) != outLen) res = -1;
+  }
+  fclose(f);
+
+  /*write only if changed*/
+  if(res == 0 && (outLen != srcLen || memcmp(out, src, srcLen) != 0)) {
+    f = fopen(path, "wb");
+    if(f != NULL && fwrite(out, 1, outLen, f) == outLen) {
+      if(msgLen > 0) fputs(msg, stdout);
+    }
+    else {
+      fprintf(stderr, "%s: cannot write\n", path);
+      res = -1;
+    }
+    if(f != NULL) fclose(f);
+  }
+
+  free(out);
+  free(arr);
+  free(src);
+  return res;
+}
+
+
+#ifdef FONT_BOX_FREETYPE
+/**
+ * @function ImportFont
+ * @brief rasterize a font through FreeType, and print it as a resource file
+ * @param const char *path: font file (any format known by FreeType: TTF, OTF, BDF, PCF...)
+ * @param int size: pixel size; for bitmap fonts, the closest strike is used
+ * @param int first, last: glyph range
+ * @param const char *name: array name
+ * @return int: 0 success, -1 error
+ */
+static int ImportFont(const char *path, int size, int first, int last, const char *name) {
+
+  static font_st font;
+  FT_Library lib;
+  FT_Face face;
+  FT_Bitmap *bmp;
+  int res = -1, g, i, best, asc, desc, x, y, cx, cy;
+  uint8_t val;
+  size_t fontSize;
+
+  if(first < 1 || last > 255 || first > last || size < 1 || size > 255) return -1;
+  if(FT_Init_FreeType(&lib) != 0) return -1;
+
+  if(FT_New_Face(lib, path, 0, &face) == 0) {
+
+    /*scalable font: pixel size; bitmap font: closest strike*/
+    if(FT_IS_SCALABLE(face)) {
+      res = (FT_Set_Pixel_Sizes(face, 0, (FT_UInt) size) == 0) ? 0 : -1;
+    }
+    else if(face->num_fixed_sizes > 0) {
+      best = 0;
+      for(i = 1; i < face->num_fixed_sizes; i++) {
+        if(abs(face->available_sizes[i].height - size) < abs(face->available_sizes[best].height - size)) best = i;
+      }
+      res = (FT_Select_Size(face, best) == 0) ? 0 : -1;
+    }
+
+    if(res == 0) {
+      memset(&font, 0, sizeof(font));
+      asc = (int) ((face->size->metrics.ascender + 63) >> 6);
+      desc = (int) ((-face->size->metrics.descender + 63) >> 6);
+      font.first = (uint8_t) first;
+      font.last = (uint8_t) last;
+      font.height = (uint8_t) ((asc + desc > 255) ? 255 : asc + desc);
+
+      for(g = first; g <= last && res == 0; g++) {
+        if(FT_Load_Char(face, (FT_ULong) g, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL) != 0) {
+          font.width[g] = 0;
+          font.px[g] = calloc(1, 1);
+        }
+        else {
+          x = (int) ((face->glyph->advance.x + 32) >> 6);
+          font.width[g] = (uint8_t) ((x > 255) ? 255 : x);
+          font.px[g] = calloc((size_t) font.width[g] * font.height + 1, 1);
+          bmp = &face->glyph->bitmap;
+
+          /*the bitmap is placed from the pen position & the baseline, then clipped to the cell*/
+          for(y = 0; y < (int) bmp->rows && font.px[g] != NULL; y++) {
+            for(x = 0; x < (int) bmp->width; x++) {
+              cx = face->glyph->bitmap_left + x;
+              cy = asc - face->glyph->bitmap_top + y;
+              if(bmp->pixel_mode == FT_PIXEL_MODE_MONO) val = ((bmp->buffer[y * bmp->pitch + x / 8] >> (7 - x % 8)) & 1) ? 0x0F : 0x00;
+              else val = bmp->buffer[y * bmp->pitch + x] >> 4;
+              if(cx >= 0 && cx < font.width[g] && cy >= 0 && cy < font.height) font.px[g][cy * font.width[g] + cx] = val;
+            }
+          }
+        }
+        if(font.px[g] == NULL) res = -1;
+      }
+
+      if(res == 0) {
+        printf("\n#include \"resources.h\"\n\nconst uint8_t %s[] = {", name);
+        res = FontEncode(stdout, &font, &fontSize);
+        printf("};\n");
+        fprintf(stderr, "%s: %d glyphs, height %u, %lu bytes\n", name, last - first + 1, font.height, (unsigned long) fontSize);
+      }
+      FontFree(&font);
+    }
+    FT_Done_Face(face);
+  }
+  FT_Done_FreeType(lib);
+
+  return res;
+}
+#endif
+
+
+int main(int argc, char **argv) {
+
+  int i, res = 0;
+
+  if(argc < 2) {
+    fprintf(stderr, "usage: %s <font_file.c> [<font_file.c> ...]\n", argv[0]);
+    fprintf(stderr, "       %s -i <font.ttf|.otf|.bdf|.pcf> <pixel size> <first glyph> <last glyph> <array name>\n", argv[0]);
+    res = 1;
+  }
+  else if(strcmp(argv[1], "-i") == 0) {
+#ifdef FONT_BOX_FREETYPE
+    if(argc != 7 || ImportFont(argv[2], atoi(argv[3]), atoi(argv[4]), atoi(argv[5]), argv[6]) != 0) {
+      fprintf(stderr, "%s: cannot import %s\n", argv[0], (argc > 2) ? argv[2] : "");
+      res = 1;
+    }
+#else
+    fprintf(stderr, "%s: built without FreeType (FONT_BOX_FREETYPE)\n", argv[0]);
+    res = 1;
+#endif
+  }
+  else {
+    for(i = 1; i < argc; i++) {
+      if(ConvertFile(argv[i]) != 0) res = 1;
+    }
+  }
+
+  return res;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file lcd_fb.c
+ * @brief host build of P2D (p2d_host): ILI9320 driver API on an in-memory RGB 5:6:5 frame buffer
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-28
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Functions are documented in ILI9320.h & ticks.h. Same behaviour as the GRAM seen through ILI9320.c: a window (LCD_SetWnd), a cursor (LCD_SetPos) which
+ * moves right then down and wraps inside the window, screen size given by DISP_ORIENTATION.
+ * Pixels out of the screen are dropped. DMA transfers complete immediately. The core timer (ticks.h) is emulated by the host monotonic clock.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+#include <time.h>
+#include "ILI9320.h"
+#include "ticks.h"
+#include "lcd_fb.h"
+
+/**
+ * Frame buffer & local variables
+ */
+color_t lcdFb[LCD_FB_W * LCD_FB_H];
+static coord_t wndX0, wndY0, wndX1, wndY1, curX, curY;
+static uint32_t pixelCnt, regCnt;
+
+
+void LCD_Init(void) {
+  LCD_SetWnd(NULL);
+}
+
+void LCD_WriteReg(uint16_t addr, uint16_t data) {
+  (void) addr;
+  (void) data;
+  regCnt++;
+}
+
+length_t LCD_GetWidth(void) {
+  return LCD_FB_W;
+}
+
+length_t LCD_GetHeight(void) {
+  return LCD_FB_H;
+}
+
+void LCD_SetPos(coord_t x, coord_t y) {
+  curX = x;
+  curY = y;
+  regCnt += 2;
+}
+
+void LCD_SetWnd(const rect_st *rec) {
+  if(rec != NULL) {
+    wndX0 = rec->x;
+    wndY0 = rec->y;
+    wndX1 = rec->x + rec->w - 1;
+    wndY1 = rec->y + rec->h - 1;
+  }
+  else {
+    wndX0 = 0;
+    wndY0 = 0;
+    wndX1 = LCD_FB_W - 1;
+    wndY1 = LCD_FB_H - 1;
+  }
+  curX = wndX0;
+  curY = wndY0;
+  regCnt += 6;
+}
+
+void LCD_Put(color_t col) {
+  if(curX >= 0 && curX < LCD_FB_W && curY >= 0 && curY < LCD_FB_H) lcdFb[curY * LCD_FB_W + curX] = col;
+  pixelCnt++;
+  if(++curX > wndX1) {
+    curX = wndX0;
+    if(++curY > wndY1) curY = wndY0;
+  }
+}
+
+void LCD_PutN(color_t col, uint32_t n) {
+  while(n-- > 0) LCD_Put(col);
+}
+
+void LCD_PutRun(const color_t *src, uint32_t n) {
+  while(n-- > 0) LCD_Put(*src++);
+}
+
+void LCD_PutLut8Run(const uint8_t *src, const color_t *lut, uint32_t n) {
+  while(n-- > 0) LCD_Put(lut[*src++]);
+}
+
+void LCD_GetRun(color_t *dst, uint32_t n) {
+  while(n-- > 0) {
+    *dst++ = (curX >= 0 && curX < LCD_FB_W && curY >= 0 && curY < LCD_FB_H) ? lcdFb[curY * LCD_FB_W + curX] : 0;
+    if(++curX > wndX1) {
+      curX = wndX0;
+      if(++curY > wndY1) curY = wndY0;
+    }
+  }
+}
+
+int8_t LCD_ScrollV(const rect_st *rec, coord_t dy) {
+
+  static color_t tmp[LCD_FB_W * LCD_FB_H];
+  int8_t res = -1;
+  coord_t y;
+
+  /*same limits as the ILI9320: whole screen only*/
+  if((rec == NULL || (rec->x == 0 && rec->y == 0 && rec->w == LCD_FB_W && rec->h == LCD_FB_H)) && dy > -LCD_FB_H && dy < LCD_FB_H) {
+    for(y = 0; y < LCD_FB_H; y++) {
+      memcpy(&tmp[y * LCD_FB_W], &lcdFb[((y + dy + LCD_FB_H) % LCD_FB_H) * LCD_FB_W], LCD_FB_W * sizeof(color_t));
+    }
+    memcpy(lcdFb, tmp, sizeof(tmp));
+    LCD_SetWnd(NULL);
+    res = 0;
+  }
+  return res;
+}
+
+void LCD_PutRunAsync(const color_t *src, uint32_t n, pmpDmaCallback_t cb) {
+  LCD_PutRun(src, n);
+  if(cb != NULL) cb();
+}
+
+bool LCD_IsBusy(void) {
+  return false;
+}
+
+void LCD_Sync(void) {
+}
+
+uint32_t LCD_GetPixelCnt(void) {
+  return pixelCnt;
+}
+
+void LCD_GetRegStat(uint32_t *pWritten, uint32_t *pSaved) {
+  if(pWritten != NULL) *pWritten = regCnt;
+  if(pSaved != NULL) *pSaved = 0;
+}
+
+/*core timer: SYS_CLK / 2 = 40MHz*/
+uint32_t TicksGetCycles(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (uint32_t) ((uint64_t) t.tv_sec * 40000000u + (uint64_t) t.tv_nsec / 25u);
+}
+
+uint32_t TicksCyclesToUs(uint32_t cycles) {
+  return cycles / 40;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file lcd_fb.h
+ * @brief host build of P2D (p2d_host): ILI9320 driver API on an in-memory RGB 5:6:5 frame buffer
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-28
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _lcd_fb_h_
+#define _lcd_fb_h_
+
+#include "ILI9320.h"
+
+/*same test as LCD_Init(): gate lines along x (0 / 180) -> landscape*/
+#if DISP_ORIENTATION == 0 || DISP_ORIENTATION == 180
+  #define LCD_FB_W 320
+  #define LCD_FB_H 240
+#else
+  #define LCD_FB_W 240
+  #define LCD_FB_H 320
+#endif
+
+/*screen content, line after line*/
+extern color_t lcdFb[LCD_FB_W * LCD_FB_H];
+
+#endif
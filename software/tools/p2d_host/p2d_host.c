@@ -0,0 +1,1787 @@
+/**
+ * @file p2d_host.c
+ * @brief host build of P2D (p2d_host): renders test scenes of every primitive into a frame buffer;
+ *        exports them as PPM images or hashes, or measures the rendering speed
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-28
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * usage: p2d_host [-l] ppm <dir> [scene]     writes <dir>/<scene>.ppm for each scene
+ *        p2d_host [-l] hash [scene]          prints a hash of the screen for each scene
+ *        p2d_host [-l] check <ref> [scene]   compares the hash of each scene with the reference file <ref> (output of "hash");
+ *                                            exits with 1 on any mismatch
+ *        p2d_host [-l] bench [ms] [scene]    draws each scene during <ms> (default 500), prints pixels/s & us per scene
+ *        p2d_host [-l] band [ms] [scene]     draws each scene over the whole screen in bands of 1 to 32 lines (as the GUI
+ *                                            redraws its screen damage, GUI_BAND_LINES) & directly, during <ms> each;
+ *                                            prints the cost of the draw callbacks (one per band) against the band
+ *                                            height, & checks that the banded screen is the direct one (exit 1 if not)
+ *        p2d_host test [name]                numeric checks of the P2D arithmetic (alpha blend, Q16 trigonometry, CORDIC,
+ *                                            transforms) & comparisons with the former polygon filler, line
+ *                                            rasterizer & circles, span calls & surface copies against pixel
+ *                                            models, display list against direct drawing; exits with 1 on any
+ *                                            failure
+ *        -l: each scene is recorded into the display list, then replayed; the hashes shall not change,
+ *            & bench also prints the display list statistics per scene
+ *
+ * The scenes only depend on P2D & on the resources. p2d_host.ref holds the reference hashes (golden images):
+ * "make p2d_check" from software/dds.X checks them, with & without the display list. On a mismatch, dump both
+ * builds with "ppm" & compare; once the new images are checked, regenerate the reference with "hash > p2d_host.ref".
+ * "make p2d_test" runs the numeric checks. Build: "make p2d_host" from software/dds.X.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "p2d.h"
+#include "p2d_internal.h"
+#include "resources.h"
+#include "salloc.h"
+#include "lcd_fb.h"
+
+typedef struct {
+  const char *name;
+  void (*Draw) (void);
+} scene_st;
+
+typedef struct {
+  const char *name;
+  int (*Test) (void);
+} test_st;
+
+static void SceneFill(void);
+static void SceneLine(void);
+static void SceneCircle(void);
+static void ScenePoly(void);
+static void SceneSprite(void);
+static void SceneText(void);
+static void SceneClip(void);
+static void SceneLut(void);
+static void SceneSurface(void);
+static void SceneWidgets(void);
+static void SceneStar(void);
+static void SceneConcave(void);
+static void SceneMany(void);
+static void SceneSlopes(void);
+static void SceneStart(void);
+static void Draw(const scene_st *scene);
+static void Bench(const scene_st *scene, double ms);
+static int BenchBand(const scene_st *scene, double ms);
+static void BandStart(void);
+static int WritePpm(const char *dir, const char *name);
+static uint32_t Hash(void);
+static int Check(const char *ref, const char *name, uint32_t hash);
+static double Now(void);
+static int TestBlend(void);
+static int TestQ16(void);
+static int TestXform(void);
+static int TestPoly(void);
+static void RandPoly(point_st *pts, uint8_t nbPoint, uint8_t kind);
+static void RandClip(rect_st *clip);
+static void RefFillPoly(const point_st *pts, uint8_t nbPoint);
+static int TestLine(void);
+static void RefLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, bool bDot, bool bSolid, color_t front, color_t back);
+static int TestCircle(void);
+static void RefCircle(coord_t x0, coord_t y0, length_t radius, bool bFill, color_t col);
+static int TestSpan(void);
+static void RefSpanPut(color_t col);
+static int TestCopy(void);
+static int TestDlist(void);
+static void DlistDraw(uint32_t nbCmd, bool bDirect);
+static double Q16Err(uint16_t angle, double ref);
+static uint32_t Rnd(void);
+static double BlendErr(color_t c, color_t a, color_t b, uint8_t alpha, double *pSum);
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b);
+
+static const scene_st arScene[] = {
+  {"fill", SceneFill},
+  {"line", SceneLine},
+  {"circle", SceneCircle},
+  {"poly", ScenePoly},
+  {"sprite", SceneSprite},
+  {"text", SceneText},
+  {"clip", SceneClip},
+  {"lut", SceneLut},
+  {"surface", SceneSurface},
+  {"widgets", SceneWidgets},
+  {"star", SceneStar},
+  {"concave", SceneConcave},
+  {"many", SceneMany},
+  {"slopes", SceneSlopes}
+};
+
+static const test_st arTest[] = {
+  {"blend", TestBlend},
+  {"q16", TestQ16},
+  {"xform", TestXform},
+  {"poly", TestPoly},
+  {"line", TestLine},
+  {"circle", TestCircle},
+  {"span", TestSpan},
+  {"copy", TestCopy},
+  {"dlist", TestDlist}
+};
+
+#define SCENE_CNT (sizeof(arScene) / sizeof(arScene[0]))
+#define TEST_CNT  (sizeof(arTest) / sizeof(arTest[0]))
+#define LIST_SIZE 4096  /*display list arena, as the GUI one*/
+#define REF_LINE  64
+#define BLEND_PAIRS     256   /*random color pairs per alpha level*/
+#define BLEND_ERR_MAX   2.0   /*LSB of the channel: 5 bit alpha (1/64 of a 6 bit channel) + truncation*/
+#define BLEND_BIAS_MAX  0.75  /*LSB, mean error (truncation: -1/2)*/
+#define SIN_ERR_MAX     1.2   /*LSB of 32767: table rounding (1/2) + interpolation (~0.15) + its rounding (1/2)*/
+#define ATAN_ERR_MAX    0.6   /*Q16 LSB: result rounding (1/2) + 18 CORDIC iterations (~0.08)*/
+#define XFORM_ERR_MAX   0.6   /*pixel: result rounding (1/2) + coefficient error over +/-4096*/
+#define PI              3.14159265358979
+#define POLY_CASES      3000  /*random polygons compared with the former filler*/
+#define POLY_PTS_MAX    10
+#define REF_INTER_MAX   16    /*intersections per line of the former filler*/
+#define LINE_CASES      120000  /*random lines compared with the former rasterizer*/
+#define LINE_PER_SCREEN 40
+#define CIRCLE_CASES    20000 /*random circles compared with the former mid-point loop*/
+#define CIRCLE_PER_SCREEN 10
+#define SQRT_CASES      1000000
+#define SPAN_OPS        100000  /*random span calls per surface*/
+#define SPAN_W          61      /*software surface of the span test*/
+#define SPAN_H          37
+#define COPY_CASES      20000   /*random surface copies*/
+#define COPY_SRC_MAX    100     /*source surface, up to 100 x 100*/
+#define COPY_DST_W      160     /*destination software surface*/
+#define COPY_DST_H      120
+#define DLIST_SCREENS   2000  /*random screens drawn directly & through the display list*/
+#define DLIST_CMD_MAX   40    /*commands per screen; every 4th screen: DLIST_CMD_FULL, more than the arena holds*/
+#define DLIST_CMD_FULL  400
+#define BAND_LINES_MAX  32    /*highest band of the band benchmark*/
+
+static const length_t arBandLines[] = {0, 1, 2, 4, 8, 16, BAND_LINES_MAX};  /*0: direct drawing*/
+static lut8bpp_st lutLogo, lutRbutton, lutDds;
+static color_t arFb[LCD_FB_W * LCD_FB_H];   /*reference screen of the comparisons*/
+static bool bList = false;      /*-l: scenes drawn through the display list*/
+static void *heapStart = NULL;  /*memory allocated after the display list arena*/
+static uint32_t rndState = 1;
+static coord_t refX, refY, refWx0, refWy0, refWx1, refWy1;  /*window & cursor of the span model (arFb)*/
+
+
+int main(int argc, char **argv) {
+
+  int res = 0, argScene = 2;
+  unsigned int ii;
+  const char *cmd;
+  double ms = 500;
+
+  if(argc > 1 && strcmp(argv[1], "-l") == 0) {
+    bList = true;
+    argc--;
+    argv++;
+  }
+  cmd = (argc > 1) ? argv[1] : "";
+
+  if((strcmp(cmd, "ppm") == 0 || strcmp(cmd, "check") == 0) && argc > 2) argScene = 3;
+  else if((strcmp(cmd, "bench") == 0 || strcmp(cmd, "band") == 0) && argc > 2 && atof(argv[2]) > 0) {
+    ms = atof(argv[2]);
+    argScene = 3;
+  }
+  else if(strcmp(cmd, "hash") != 0 && strcmp(cmd, "bench") != 0 && strcmp(cmd, "band") != 0 && strcmp(cmd, "test") != 0) {
+    fprintf(stderr, "usage: p2d_host [-l] ppm <dir> [scene] | hash [scene] | check <ref> [scene] | bench [ms] [scene]"
+      " | band [ms] [scene] | test [name]\n");
+    res = 1;
+  }
+
+  if(res == 0 && strcmp(cmd, "test") == 0) {
+    LCD_Init();
+    (void) P2D_ListInit(LIST_SIZE);
+    heapStart = salloc(0);
+    for(ii = 0; ii < TEST_CNT; ii++) {
+      if(argc <= 2 || strcmp(argv[2], arTest[ii].name) == 0) {
+        SceneStart();
+        if(arTest[ii].Test() != 0) res = 1;
+      }
+    }
+  }
+  else if(res == 0) {
+    LCD_Init();
+    (void) P2D_ListInit(LIST_SIZE);
+    if(strcmp(cmd, "band") == 0) (void) P2D_BandInit((uint32_t) LCD_GetWidth() * BAND_LINES_MAX * 2);
+    heapStart = salloc(0);
+    for(ii = 0; ii < SCENE_CNT; ii++) {
+      if(argc <= argScene || strcmp(argv[argScene], arScene[ii].name) == 0) {
+        SceneStart();
+        Draw(&arScene[ii]);
+        if(strcmp(cmd, "ppm") == 0) {
+          if(WritePpm(argv[2], arScene[ii].name) != 0) res = 1;
+        }
+        else if(strcmp(cmd, "hash") == 0) printf("%-10s %08x\n", arScene[ii].name, (unsigned int) Hash());
+        else if(strcmp(cmd, "check") == 0) {
+          if(Check(argv[2], arScene[ii].name, Hash()) != 0) res = 1;
+        }
+        else if(strcmp(cmd, "band") == 0) {
+          if(BenchBand(&arScene[ii], ms) != 0) res = 1;
+        }
+        else Bench(&arScene[ii], ms);
+      }
+    }
+  }
+
+  return res;
+}
+
+
+/**
+ * @function Bench
+ * @brief draw a scene again & again on its own result (same primitives, same pixel count) during <ms>
+ */
+static void Bench(const scene_st *scene, double ms) {
+  unsigned int rep = 0;
+  uint32_t px;
+  double t0, t;
+  dlist_stat_st stat;
+
+  P2D_ListResetStat();
+  px = LCD_GetPixelCnt();
+  t0 = Now();
+  do {
+    Draw(scene);
+    rep++;
+    t = Now() - t0;
+  } while(t * 1000.0 < ms);
+  px = LCD_GetPixelCnt() - px;
+  printf("%-10s %8.2f Mpx/s %10.1f us/scene %8u px/scene", scene->name, px / t / 1e6, t / rep * 1e6, (unsigned int) (px / rep));
+  if(bList) {
+    P2D_ListGetStat(&stat);
+    printf("  rec %4u cull %3u state- %3u wnd- %3u flush %2u",
+      (unsigned int) (stat.recorded / rep), (unsigned int) (stat.culled / rep), (unsigned int) (stat.stateSaved / rep),
+      (unsigned int) (stat.wndSaved / rep), (unsigned int) (stat.flush / rep));
+  }
+  printf("\n");
+}
+
+
+/**
+ * @function BenchBand
+ * @brief draw a scene over the whole screen during <ms>, for each band height: every band clears its background
+ *        & runs the whole scene again, clipped to the band (one draw callback per band, as the GUI objects);
+ *        the first frame of each height is compared with the direct drawing of the scene (screen before the call)
+ * @return 0 if every banded frame matches, -1 otherwise
+ */
+static int BenchBand(const scene_st *scene, double ms) {
+  int res = 0;
+  unsigned int ii, rep;
+  uint32_t px, reg, regEnd, calls, hashRef;
+  double t0, t;
+  rect_st scr;
+  bool bMatch;
+
+  hashRef = Hash();
+  scr.x = 0;
+  scr.y = 0;
+  scr.w = P2D_GetLcdWidth();
+  scr.h = P2D_GetLcdHeight();
+
+  for(ii = 0; ii < sizeof(arBandLines) / sizeof(arBandLines[0]); ii++) {
+    rep = 0;
+    calls = 0;
+    bMatch = true;
+    px = LCD_GetPixelCnt();
+    LCD_GetRegStat(&reg, NULL);
+    t0 = Now();
+    do {
+      if(arBandLines[ii] == 0) {
+        BandStart();
+        Draw(scene);
+        calls++;
+      }
+      else if(P2D_BandBegin(&scr, arBandLines[ii]) == 0) {
+        while(P2D_BandNext(NULL)) {
+          BandStart();
+          Draw(scene);
+          calls++;
+        }
+      }
+      else bMatch = false;
+      LCD_Sync();
+      if(rep == 0 && Hash() != hashRef) bMatch = false;
+      rep++;
+      t = Now() - t0;
+    } while(t * 1000.0 < ms);
+    px = LCD_GetPixelCnt() - px;
+    LCD_GetRegStat(&regEnd, NULL);
+
+    if(arBandLines[ii] == 0) printf("%-10s direct   ", scene->name);
+    else printf("%-10s %2u lines ", scene->name, (unsigned int) arBandLines[ii]);
+    printf("%6u B %10.1f us/frame %4u calls %8.1f us/call %7u px %5u reg%s\n",
+      (unsigned int) ((uint32_t) scr.w * arBandLines[ii] * 2 * sizeof(color_t)), t / rep * 1e6,
+      (unsigned int) (calls / rep), t / calls * 1e6, (unsigned int) (px / rep), (unsigned int) ((regEnd - reg) / rep),
+      bMatch ? "" : "  MISMATCH");
+    if(bMatch == false) res = -1;
+  }
+
+  return res;
+}
+
+
+/**
+ * @function BandStart
+ * @brief reset the drawing context as P2D_Init() (the current surface & its clip apart) & clear the current surface,
+ *        so that every band starts as the direct drawing of the scene
+ */
+static void BandStart(void) {
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_SetColors(COLOR_BLACK, COLOR_BLACK);
+  P2D_SetAlpha(255);
+  P2D_SetLineType(LINE_SOLID);
+  P2D_SetFillRule(FILL_EVEN_ODD);
+  P2D_SetFont(NULL);
+  P2D_SetClip(NULL);
+  P2D_SetColor(P2D_Color(230, 230, 220));
+  P2D_Clear();
+}
+
+
+/**
+ * @function Draw
+ * @brief draw a scene, directly or through the display list (-l)
+ */
+static void Draw(const scene_st *scene) {
+  if(bList) (void) P2D_ListBegin();
+  scene->Draw();
+  if(bList) P2D_ListEnd();
+}
+
+
+/**
+ * @function SceneStart
+ * @brief reset P2D (context, clip, surfaces, caches) & clear the screen before a scene
+ */
+static void SceneStart(void) {
+  sfreeFrom(heapStart);
+  P2D_Init();
+  P2D_LutCacheFlush();
+  P2D_SetColor(P2D_Color(230, 230, 220));
+  P2D_Clear();
+}
+
+
+static void SceneFill(void) {
+  rect_st rec;
+  coord_t ii;
+
+  for(ii = 0; ii < 8; ii++) {
+    P2D_SetColor(P2D_Color(ii * 32, 255 - ii * 32, 128));
+    rec.x = 10 + ii * 12;
+    rec.y = 10 + ii * 8;
+    rec.w = 120 - ii * 10;
+    rec.h = 60;
+    P2D_FillRect(&rec);
+  }
+
+  /*partly out of the screen*/
+  P2D_SetColor(COLOR_BLUE);
+  rec.x = -20; rec.y = 180; rec.w = 80; rec.h = 100;
+  P2D_FillRect(&rec);
+  rec.x = P2D_GetLcdWidth() - 40; rec.y = -10; rec.w = 100; rec.h = 50;
+  P2D_FillRect(&rec);
+
+  /*outlines*/
+  P2D_SetColor(COLOR_BLACK);
+  rec.x = 150; rec.y = 20; rec.w = 100; rec.h = 70;
+  P2D_Rect(&rec);
+  rec.x = 152; rec.y = 22; rec.w = 1; rec.h = 1;
+  P2D_Rect(&rec);
+
+  /*translucent*/
+  P2D_SetColor(COLOR_RED);
+  P2D_SetAlpha(96);
+  rec.x = 60; rec.y = 40; rec.w = 150; rec.h = 120;
+  P2D_FillRectAlpha(&rec);
+  P2D_SetAlpha(255);
+}
+
+
+static void SceneLine(void) {
+  static const line_t arType[] = {LINE_SOLID, LINE_DOT, LINE_DASH, LINE_DASH_DOT};
+  coord_t ii, cx = 120, cy = 90;
+
+  /*star, every octant*/
+  P2D_SetColor(COLOR_BLACK);
+  for(ii = 0; ii < 16; ii++) {
+    P2D_Line(cx, cy, cx + (P2D_Cos(ii * 23) * 70) / 32767, cy + (P2D_Sin(ii * 23) * 70) / 32767);
+  }
+
+  /*line types, horizontal, vertical & diagonal*/
+  for(ii = 0; ii < 4; ii++) {
+    P2D_SetLineType(arType[ii]);
+    P2D_SetColor(P2D_Color(0, 0, 80 + ii * 50));
+    P2D_Line(20, 180 + ii * 6, 220, 180 + ii * 6);
+    P2D_Line(20 + ii * 6, 210, 20 + ii * 6, 300);
+    P2D_Line(50, 210 + ii * 6, 120, 260 + ii * 6);
+  }
+  P2D_SetLineType(LINE_SOLID);
+
+  /*far out of the screen: clipped before rasterizing*/
+  P2D_SetColor(COLOR_RED);
+  P2D_Line(-1000, 300, 1000, 150);
+  P2D_Line(200, -500, 150, 900);
+
+  /*anti-aliased*/
+  P2D_SetColor(P2D_Color(0, 100, 0));
+  for(ii = 0; ii < 8; ii++) {
+    P2D_LineAA(130 + ii * 12, 310, 140 + ii * 10, 220 + ii * 4);
+  }
+}
+
+
+static void SceneCircle(void) {
+  coord_t ii;
+
+  for(ii = 0; ii < 6; ii++) {
+    P2D_SetColor(P2D_Color(40 * ii, 0, 255 - 40 * ii));
+    P2D_Circle(70, 70, 5 + ii * 12);
+  }
+
+  P2D_SetColor(P2D_Color(0, 160, 0));
+  P2D_FillCircle(170, 70, 55);
+  P2D_SetColor(COLOR_WHITE);
+  P2D_FillCircle(170, 70, 0);
+  P2D_FillCircle(170, 70 + 20, 3);
+
+  /*clipped by the screen borders*/
+  P2D_SetColor(COLOR_BLUE);
+  P2D_FillCircle(0, P2D_GetLcdHeight(), 60);
+  P2D_Circle(P2D_GetLcdWidth() - 10, P2D_GetLcdHeight() - 10, 50);
+
+  /*anti-aliased*/
+  P2D_SetColor(COLOR_BLACK);
+  for(ii = 0; ii < 4; ii++) {
+    P2D_CircleAA(80 + ii * 25, 180, 8 + ii * 4);
+  }
+}
+
+
+static void ScenePoly(void) {
+  static const point_st arStar[] = {{0, -50}, {29, 40}, {-47, -15}, {47, -15}, {-29, 40}};
+  point_st ar[5], ref = {0, 0};
+  xform_st m;
+
+  /*self-intersecting star: even-odd leaves its center empty, non-zero fills it*/
+  P2D_XformInit(&m, &ref, 0, 100, 60, 60);
+  P2D_P_Transform(arStar, ar, 5, &m);
+  P2D_SetColor(P2D_Color(200, 120, 0));
+  P2D_SetFillRule(FILL_EVEN_ODD);
+  P2D_FillPoly(ar, 5);
+
+  P2D_XformInit(&m, &ref, 0, 100, 170, 60);
+  P2D_P_Transform(arStar, ar, 5, &m);
+  P2D_SetFillRule(FILL_NON_ZERO);
+  P2D_FillPoly(ar, 5);
+  P2D_SetFillRule(FILL_EVEN_ODD);
+
+  /*rotated, zoomed & outlined*/
+  P2D_XformInit(&m, &ref, 5461, 150, 110, 170);
+  P2D_P_Transform(arStar, ar, 5, &m);
+  P2D_SetColor(P2D_Color(0, 80, 160));
+  P2D_FillPoly(ar, 5);
+  P2D_SetColor(COLOR_BLACK);
+  P2D_Poly(ar, 5);
+
+  /*partly out of the screen*/
+  P2D_XformInit(&m, &ref, 12000, 200, P2D_GetLcdWidth() - 20, 200);
+  P2D_P_Transform(arStar, ar, 5, &m);
+  P2D_SetColor(COLOR_RED);
+  P2D_FillPoly(ar, 5);
+}
+
+
+static void SceneSprite(void) {
+  rect_st src, dst;
+
+  P2D_InitLut8BPP(&lutLogo, sprite_logo_lut, LUT_E_COPY);
+  P2D_InitLut8BPP(&lutRbutton, sprite_rbutton_lut, LUT_E_COPY);
+  P2D_InitLut8BPP(&lutDds, sprite_dds_button_lut, LUT_E_COPY);
+
+  /*whole sprite, solid & transparent*/
+  P2D_SpriteSetLut8BPP(&lutLogo);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  dst.x = 5; dst.y = 5; dst.w = 0; dst.h = 0;
+  P2D_Sprite(NULL, &dst, sprite_logo);
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+  dst.y = 5 + P2D_SpriteGetHeight(sprite_logo) + 5;
+  P2D_Sprite(NULL, &dst, sprite_logo);
+
+  /*tiles of sprite sheets (run-length encoded), one clipped by the screen border*/
+  P2D_SpriteSetLut8BPP(&lutRbutton);
+  src.x = 0; src.y = 510; src.w = 102; src.h = 102;
+  dst.x = 20; dst.y = 130;
+  P2D_Sprite(&src, &dst, sprite_rbutton);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  dst.x = P2D_GetLcdWidth() - 60; dst.y = 150;
+  P2D_Sprite(&src, &dst, sprite_rbutton);
+
+  P2D_SpriteSetLut8BPP(&lutDds);
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+  src.x = 0; src.y = 287; src.w = 41; src.h = 41;
+  dst.x = 150; dst.y = 140;
+  P2D_Sprite(&src, &dst, sprite_dds_button);
+  dst.x = -20; dst.y = -20;
+  P2D_Sprite(&src, &dst, sprite_dds_button);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+}
+
+
+static void SceneText(void) {
+
+  /*1BPP font*/
+  P2D_SetFont(FontMedium);
+  P2D_SetColors(COLOR_BLACK, P2D_Color(255, 255, 160));
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_PutText(5, 5, "Solid 1BPP: The quick brown fox 0123456789");
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+  P2D_PutText(-8, 30, "Transparent, clipped on the left side");
+
+  /*4BPP font: anti-aliased on the background color, or on the surface content*/
+  P2D_SetFont(FontFreeSerif_4bpp_n_16);
+  P2D_SetColors(P2D_Color(0, 0, 140), P2D_Color(230, 230, 220));
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_PutText(5, 60, "Serif 4BPP solid, AaBbCc 123");
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+  P2D_PutText(5, 90, "Serif 4BPP transparent");
+  P2D_PutText(P2D_GetLcdWidth() - 60, 120, "clipped on the right");
+  P2D_PutText(20, P2D_GetLcdHeight() - 8, "clipped at the bottom");
+
+  P2D_SetFont(FontBig);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_SetColors(COLOR_WHITE, COLOR_BLACK);
+  P2D_PutText(5, 150, "12.345");
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+}
+
+
+static void SceneClip(void) {
+  rect_st clip = {30, 60, 180, 200}, rec;
+
+  P2D_SetColor(COLOR_BLACK);
+  P2D_Rect(&clip);
+  clip.x++; clip.y++; clip.w -= 2; clip.h -= 2;
+  P2D_SetClip(&clip);
+
+  /*every primitive crosses the clip borders*/
+  P2D_SetColor(P2D_Color(120, 200, 255));
+  rec.x = 0; rec.y = 0; rec.w = 120; rec.h = 100;
+  P2D_FillRect(&rec);
+  P2D_SetColor(P2D_Color(0, 150, 0));
+  P2D_FillCircle(200, 250, 60);
+  P2D_SetColor(COLOR_RED);
+  P2D_Line(0, 0, P2D_GetLcdWidth() - 1, P2D_GetLcdHeight() - 1);
+  P2D_LineAA(0, P2D_GetLcdHeight() - 1, P2D_GetLcdWidth() - 1, 0);
+  P2D_SetColor(COLOR_BLUE);
+  P2D_Circle(120, 160, 90);
+  P2D_SetFont(FontFreeSerif_4bpp_n_16);
+  P2D_SetColors(COLOR_BLACK, COLOR_WHITE);
+  P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+  P2D_PutText(10, 80, "text crossing the clip area");
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+  P2D_PutText(10, 230, "solid text crossing the clip");
+  P2D_SetClip(NULL);
+}
+
+
+static void SceneLut(void) {
+  static const lutmode_t arMode[] = {
+    LUT_E_COPY,
+    LUT_E_COPY | LUT_O_BLACK_AND_WHITE,
+    LUT_E_COPY | LUT_O_ALPHA,
+    LUT_E_FILLED,
+    LUT_E_GRADIENT,
+    LUT_E_COPY | LUT_O_COLOR_KEY
+  };
+  rect_st dst;
+  uint8_t ii;
+  length_t w = P2D_SpriteGetWidth(sprite_logo), h = P2D_SpriteGetHeight(sprite_logo);
+
+  P2D_SetColors(P2D_Color(200, 0, 0), P2D_Color(0, 0, 120));
+  P2D_SetAlpha(100);
+  dst.w = 0;
+  dst.h = 0;
+  for(ii = 0; ii < sizeof(arMode) / sizeof(arMode[0]); ii++) {
+    P2D_InitLut8BPP(&lutLogo, sprite_logo_lut, arMode[ii]);
+    P2D_SpriteSetLut8BPP(&lutLogo);
+    P2D_SetDisplayMode((ii & 1) ? DISPLAY_TRANSPARENT : DISPLAY_SOLID);
+    dst.x = (ii % 2) * (w + 4);
+    dst.y = (ii / 2) * (h + 4);
+    P2D_Sprite(NULL, &dst, sprite_logo);
+  }
+  P2D_SetAlpha(255);
+  P2D_SetDisplayMode(DISPLAY_SOLID);
+}
+
+
+static void SceneSurface(void) {
+  rect_st rec = {0, 0, 160, 80}, src, dst;
+  surfaceId_t id;
+
+  id = P2D_SurfaceCreate(&rec);
+  if(id != SURFACE_LCD) {
+    P2D_SetDest(id);
+    P2D_SetColor(P2D_Color(255, 220, 0));
+    P2D_FillRect(&rec);
+    P2D_SetColor(COLOR_BLACK);
+    P2D_FillCircle(80, 40, 30);
+    P2D_SetFont(FontMedium);
+    P2D_SetColors(COLOR_RED, COLOR_WHITE);
+    P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+    P2D_PutText(4, 4, "in a surface");
+    P2D_SetDisplayMode(DISPLAY_SOLID);
+    P2D_SetDest(SURFACE_LCD);
+
+    /*whole surface, part of it, and clipped by the screen*/
+    dst.x = 10; dst.y = 10; dst.w = rec.w; dst.h = rec.h;
+    P2D_CopySurface(id, &rec, &dst);
+    src.x = 40; src.y = 10; src.w = 80; src.h = 60;
+    dst.x = 140; dst.y = 110; dst.w = src.w; dst.h = src.h;
+    P2D_CopySurface(id, &src, &dst);
+    dst.x = P2D_GetLcdWidth() - 100; dst.y = P2D_GetLcdHeight() - 50; dst.w = rec.w; dst.h = rec.h;
+    P2D_CopySurface(id, &rec, &dst);
+    P2D_SurfaceDelete(id);
+  }
+}
+
+
+/**
+ * @function SceneWidgets
+ * @brief a page of the GUI: panels of buttons, some of them redrawn (pressed) over their first drawing
+ */
+static void SceneWidgets(void) {
+  rect_st rec, pnl;
+  coord_t ii;
+  char str[8];
+
+  P2D_SetFont(FontFreeSerif_4bpp_n_16);
+  for(ii = 0; ii < 12; ii++) {
+    rec.x = 6 + (ii % 3) * 78;
+    rec.y = 8 + (ii / 3) * 56;
+    rec.w = 70;
+    rec.h = 48;
+    P2D_SetClip(&rec);
+    P2D_SetColor(P2D_Color(60, 60, 70));
+    P2D_FillRect(&rec);
+    P2D_SetColor(COLOR_WHITE);
+    P2D_Rect(&rec);
+    P2D_SetColors(COLOR_WHITE, P2D_Color(60, 60, 70));
+    P2D_SetDisplayMode(DISPLAY_TRANSPARENT);
+    snprintf(str, sizeof(str), "B%d", ii);
+    P2D_PutText(rec.x + 20, rec.y + 14, str);
+    P2D_SetDisplayMode(DISPLAY_SOLID);
+  }
+
+  /*pressed buttons: redrawn over their first drawing*/
+  for(ii = 0; ii < 12; ii += 4) {
+    rec.x = 6 + (ii % 3) * 78;
+    rec.y = 8 + (ii / 3) * 56;
+    rec.w = 70;
+    rec.h = 48;
+    P2D_SetClip(&rec);
+    P2D_SetColor(P2D_Color(200, 120, 0));
+    P2D_FillRect(&rec);
+    P2D_SetColors(COLOR_BLACK, P2D_Color(200, 120, 0));
+    snprintf(str, sizeof(str), "P%d", ii);
+    P2D_PutText(rec.x + 20, rec.y + 14, str);
+  }
+
+  /*panel covering the last row*/
+  pnl.x = 0; pnl.y = 176; pnl.w = P2D_GetLcdWidth(); pnl.h = 60;
+  P2D_SetClip(NULL);
+  P2D_SetColor(P2D_Color(230, 230, 220));
+  P2D_FillRect(&pnl);
+  P2D_SetColor(COLOR_BLACK);
+  P2D_SetFont(FontMedium);
+  P2D_PutText(8, 196, "panel over the last row");
+}
+
+
+static void SceneStar(void) {
+  static const point_st arPenta[] = {{0, -60}, {35, 48}, {-57, -18}, {57, -18}, {-35, 48}};
+  point_st arStar[24], ar[24], ref = {0, 0};
+  xform_st m;
+  uint8_t ii;
+
+  /*star, 12 branches*/
+  for(ii = 0; ii < 24; ii++) {
+    arStar[ii].x = (coord_t) ((P2D_CosQ16((uint16_t) (ii * 65536 / 24)) * ((ii & 1)? 30: 75)) / 32767);
+    arStar[ii].y = (coord_t) ((P2D_SinQ16((uint16_t) (ii * 65536 / 24)) * ((ii & 1)? 30: 75)) / 32767);
+  }
+  P2D_XformInit(&m, &ref, 1000, 100, 80, 80);
+  P2D_P_Transform(arStar, ar, 24, &m);
+  P2D_SetColor(P2D_Color(0, 120, 200));
+  P2D_FillPoly(ar, 24);
+
+  /*pentagrams: even-odd, then non-zero*/
+  P2D_XformInit(&m, &ref, 0, 100, 170, 200);
+  P2D_P_Transform(arPenta, ar, 5, &m);
+  P2D_SetColor(P2D_Color(200, 120, 0));
+  P2D_FillPoly(ar, 5);
+  P2D_XformInit(&m, &ref, 0, 100, 70, 250);
+  P2D_P_Transform(arPenta, ar, 5, &m);
+  P2D_SetFillRule(FILL_NON_ZERO);
+  P2D_FillPoly(ar, 5);
+  P2D_SetFillRule(FILL_EVEN_ODD);
+}
+
+
+static void SceneConcave(void) {
+  point_st ar[2 * 20 + 2];
+  uint8_t ii, n = 0;
+
+  /*comb, 20 teeth: 40 crossings per line through the teeth*/
+  for(ii = 0; ii < 20; ii++) {
+    ar[n].x = (coord_t) (10 + ii * 11);
+    ar[n++].y = 20;
+    ar[n].x = (coord_t) (15 + ii * 11);
+    ar[n++].y = (ii & 1)? 260: 220;
+  }
+  ar[n].x = 230; ar[n++].y = 300;
+  ar[n].x = 10; ar[n++].y = 300;
+  P2D_SetColor(P2D_Color(120, 0, 120));
+  P2D_FillPoly(ar, n);
+}
+
+
+static void SceneMany(void) {
+  point_st ar[255];
+  uint16_t ii;
+  int32_t r;
+
+  /*circle, 200 vertices*/
+  for(ii = 0; ii < 200; ii++) {
+    ar[ii].x = (coord_t) (120 + (P2D_CosQ16((uint16_t) (ii * 65536 / 200)) * 100) / 32767);
+    ar[ii].y = (coord_t) (100 + (P2D_SinQ16((uint16_t) (ii * 65536 / 200)) * 80) / 32767);
+  }
+  P2D_SetColor(P2D_Color(0, 150, 60));
+  P2D_FillPoly(ar, 200);
+
+  /*gear, 255 vertices (the max)*/
+  for(ii = 0; ii < 255; ii++) {
+    r = (ii % 6 < 3)? 90: 75;
+    ar[ii].x = (coord_t) (120 + (P2D_CosQ16((uint16_t) (ii * 65536 / 255)) * r) / 32767);
+    ar[ii].y = (coord_t) (230 + (P2D_SinQ16((uint16_t) (ii * 65536 / 255)) * r) / 32767);
+  }
+  P2D_SetColor(P2D_Color(160, 60, 0));
+  P2D_FillPoly(ar, 255);
+}
+
+
+static void SceneSlopes(void) {
+  static const line_t arType[] = {LINE_SOLID, LINE_DOT, LINE_DASH, LINE_DASH_DOT};
+  coord_t ii, cx = 120, cy = 110;
+
+  /*every slope, 2 degrees apart, from 1 to 100px long*/
+  for(ii = 0; ii < 180; ii++) {
+    P2D_SetColor(P2D_Color(ii, 0, 180 - ii));
+    P2D_Line(cx, cy, cx + (P2D_Cos(ii * 2) * (1 + ii * 99 / 179)) / 32767, cy + (P2D_Sin(ii * 2) * (1 + ii * 99 / 179)) / 32767);
+  }
+
+  /*long shallow & steep lines, crossing the screen, each line type*/
+  for(ii = 0; ii < 16; ii++) {
+    P2D_SetLineType(arType[ii & 3]);
+    P2D_SetColor(P2D_Color(0, 60 + ii * 10, 0));
+    P2D_Line(-300, 220 + ii * 5, 540, 240 + ii * 3);
+    P2D_Line(10 + ii * 14, -400, 30 + ii * 12, 700);
+  }
+  P2D_SetLineType(LINE_SOLID);
+}
+
+
+/**
+ * @function WritePpm
+ * @brief write the screen into <dir>/<name>.ppm, binary PPM (8 bits per component, 5:6:5 extended by bit replication)
+ */
+static int WritePpm(const char *dir, const char *name) {
+  FILE *f;
+  uint32_t ii;
+  color_t c;
+  uint8_t rgb[3];
+  char path[512];
+  int res = -1;
+
+  snprintf(path, sizeof(path), "%s/%s.ppm", dir, name);
+  f = fopen(path, "wb");
+  if(f != NULL) {
+    fprintf(f, "P6\n%d %d\n255\n", LCD_FB_W, LCD_FB_H);
+    for(ii = 0; ii < LCD_FB_W * LCD_FB_H; ii++) {
+      c = lcdFb[ii];
+      rgb[0] = (uint8_t) (((c >> 11) << 3) | (c >> 13));
+      rgb[1] = (uint8_t) ((((c >> 5) & 0x3F) << 2) | ((c >> 9) & 0x03));
+      rgb[2] = (uint8_t) (((c & 0x1F) << 3) | ((c >> 2) & 0x07));
+      (void) fwrite(rgb, 1, 3, f);
+    }
+    if(fclose(f) == 0) res = 0;
+  }
+  if(res != 0) fprintf(stderr, "p2d_host: cannot write %s\n", path);
+  return res;
+}
+
+
+/**
+ * @function Hash
+ * @brief FNV-1a of the screen
+ */
+static uint32_t Hash(void) {
+  uint32_t ii, h = 2166136261u;
+  for(ii = 0; ii < LCD_FB_W * LCD_FB_H; ii++) {
+    h = (h ^ lcdFb[ii]) * 16777619u;
+  }
+  return h;
+}
+
+
+/**
+ * @function Check
+ * @brief compare the hash of a scene with its reference, read from <ref> ("<scene> <hash>" lines, as printed by "hash")
+ * @return 0 if equal, -1 otherwise (mismatch, scene missing, or no reference file)
+ */
+static int Check(const char *ref, const char *name, uint32_t hash) {
+  FILE *f;
+  char line[REF_LINE], refName[REF_LINE];
+  unsigned int refHash;
+  int res = -1;
+  bool bFound = false;
+
+  f = fopen(ref, "r");
+  if(f == NULL) {
+    fprintf(stderr, "p2d_host: cannot read %s\n", ref);
+  }
+  else {
+    while(bFound == false && fgets(line, sizeof(line), f) != NULL) {
+      if(sscanf(line, "%63s %x", refName, &refHash) == 2 && strcmp(refName, name) == 0) bFound = true;
+    }
+    (void) fclose(f);
+
+    if(bFound == false) printf("%-10s FAIL (no reference)\n", name);
+    else if(refHash != hash) printf("%-10s FAIL %08x, expected %08x\n", name, (unsigned int) hash, refHash);
+    else {
+      printf("%-10s ok\n", name);
+      res = 0;
+    }
+  }
+  return res;
+}
+
+
+/**
+ * @function TestBlend
+ * @brief SWAR alpha blend against the exact blend of the RGB565 channels: exact at alpha 0 & 255, error & bias bounded;
+ *        the run version & the translucent rectangle (read back from the GRAM, clipped) shall give the same pixels
+ */
+static int TestBlend(void) {
+  uint32_t alpha, ii, n = 0, bad = 0;
+  double err, errMax = 0, sum = 0;
+  color_t a, b, c, arPix[BLEND_PAIRS], arBack[BLEND_PAIRS];
+  bool bEnds = true, bRun = true;
+  rect_st rec, clip;
+  coord_t x, y;
+  int res = 0;
+
+  for(alpha = 0; alpha < 256; alpha++) {
+    a = (color_t) Rnd();
+    for(ii = 0; ii < BLEND_PAIRS; ii++) arBack[ii] = arPix[ii] = (color_t) Rnd();
+    P2D_AlphaBlendRun(arPix, BLEND_PAIRS, a, (uint8_t) alpha);
+
+    for(ii = 0; ii < BLEND_PAIRS; ii++) {
+      b = arBack[ii];
+      c = P2D_AlphaBlend(a, b, (uint8_t) alpha);
+      if(c != arPix[ii]) bRun = false;
+      if((alpha == 0 && c != b) || (alpha == 255 && c != a)) bEnds = false;
+      err = BlendErr(c, a, b, (uint8_t) alpha, &sum);
+      if(err > errMax) errMax = err;
+      n += 3;
+    }
+  }
+
+  res |= Result("blend", bEnds, "alpha 0 & 255 exact", 0, 0);
+  res |= Result("blend", errMax <= BLEND_ERR_MAX, "max error %.2f LSB, %.2f max", errMax, BLEND_ERR_MAX);
+  res |= Result("blend", fabs(sum / n) <= BLEND_BIAS_MAX, "mean error %.2f LSB, %.2f max", sum / n, BLEND_BIAS_MAX);
+  res |= Result("blend", bRun, "run blend identical to the pixel blend", 0, 0);
+
+  /*translucent rectangle across the clip: inside, background blended; outside, untouched*/
+  rndState = 7;
+  for(ii = 0; ii < LCD_FB_W * LCD_FB_H; ii++) lcdFb[ii] = (color_t) Rnd();
+  rec = (rect_st) {20, 30, 150, 100};
+  clip = (rect_st) {60, 10, 200, 80};
+  P2D_SetClip(&clip);
+  P2D_SetColor(P2D_Color(40, 200, 90));
+  P2D_SetAlpha(77);
+  P2D_FillRectAlpha(&rec);
+  rndState = 7;
+  for(y = 0; y < LCD_FB_H; y++) {
+    for(x = 0; x < LCD_FB_W; x++) {
+      b = (color_t) Rnd();
+      if(x >= 60 && x < 170 && y >= 30 && y < 90) b = P2D_AlphaBlend(P2D_Color(40, 200, 90), b, 77);
+      if(lcdFb[y * LCD_FB_W + x] != b) bad++;
+    }
+  }
+  res |= Result("blend", bad == 0, "translucent rectangle: %.0f wrong pixels", bad, 0);
+  return res;
+}
+
+
+/**
+ * @function TestQ16
+ * @brief Q16 sine / cosine on every angle & CORDIC atan2 on vectors of every magnitude, against the libm functions;
+ *        degree conversions shall round-trip
+ */
+static int TestQ16(void) {
+  const int32_t arRadius[] = {3, 100, 4096, 1000000, 1 << 30};
+  uint32_t angle, ii;
+  double err, errSin = 0, errAtan = 0, ref;
+  int32_t x, y;
+  int16_t deg;
+  bool bExact, bDeg = true;
+  int res = 0;
+
+  for(angle = 0; angle < 65536; angle++) {
+    ref = 32767.0 * sin(angle * 2 * PI / 65536);
+    err = fabs(P2D_SinQ16((uint16_t) angle) - ref);
+    if(err > errSin) errSin = err;
+    if(P2D_CosQ16((uint16_t) angle) != P2D_SinQ16((uint16_t) (angle + 0x4000))) errSin = 1e9;
+  }
+  bExact = P2D_SinQ16(0) == 0 && P2D_SinQ16(0x4000) == 32767 && P2D_SinQ16(0x8000) == 0 && P2D_SinQ16(0xC000) == -32767;
+  res |= Result("q16", bExact, "sine exact at 0, 90, 180 & 270 degrees", 0, 0);
+  res |= Result("q16", errSin <= SIN_ERR_MAX, "sine / cosine max error %.2f LSB, %.2f max", errSin, SIN_ERR_MAX);
+
+  /*reference: atan2 of the same integer vector*/
+  for(ii = 0; ii < sizeof(arRadius) / sizeof(arRadius[0]); ii++) {
+    for(angle = 0; angle < 65536; angle += 7) {
+      x = (int32_t) lround(arRadius[ii] * cos(angle * 2 * PI / 65536));
+      y = (int32_t) lround(arRadius[ii] * sin(angle * 2 * PI / 65536));
+      if(x != 0 || y != 0) {
+        err = Q16Err(P2D_Atan2(y, x), atan2(y, x) * 65536 / (2 * PI));
+        if(err > errAtan) errAtan = err;
+      }
+    }
+  }
+  bExact = P2D_Atan2(0, 0) == 0 && P2D_Atan2(0, 5) == 0 && P2D_Atan2(5, 0) == 0x4000 && P2D_Atan2(0, -5) == 0x8000
+    && P2D_Atan2(-5, 0) == 0xC000;
+  res |= Result("q16", bExact, "atan2 exact on the axes, 0 for a null vector", 0, 0);
+  res |= Result("q16", errAtan <= ATAN_ERR_MAX, "atan2 max error %.3f LSB, %.2f max (radius 3 to 2^30)", errAtan, ATAN_ERR_MAX);
+
+  for(deg = -720; deg <= 720; deg++) {
+    if(P2D_Q16ToDeg(P2D_DegToQ16(deg)) != ((deg % 360) + 360) % 360) bDeg = false;
+  }
+  res |= Result("q16", bDeg, "degrees -> Q16 -> degrees round trip, -720 to 720", 0, 0);
+  return res;
+}
+
+
+/**
+ * @function TestXform
+ * @brief fixed point transforms (rotation, zoom, move) against the floating point ones, on points spread over
+ *        +/-2000 & on the coord_t bounds (clamped result); a quarter turn shall be exact
+ */
+static int TestXform(void) {
+  const uint8_t arZoom[] = {100, 50, 255};
+  point_st arSrc[200], arDst[200], ref = {160, 120};
+  double c, s, zoom, xr, yr, err, errMax = 0;
+  uint32_t angle, ii, jj;
+  xform_st m;
+  bool bQuarter = true;
+  int res = 0;
+
+  for(ii = 0; ii < 200; ii++) {
+    arSrc[ii].x = (coord_t) (Rnd() % 4001) - 2000;
+    arSrc[ii].y = (coord_t) (Rnd() % 4001) - 2000;
+  }
+
+  for(jj = 0; jj < sizeof(arZoom); jj++) {
+    for(angle = 0; angle < 65536; angle += 1031) {
+      zoom = arZoom[jj] / 100.0;
+      c = P2D_CosQ16((uint16_t) angle) / 32768.0 * zoom;
+      s = P2D_SinQ16((uint16_t) angle) / 32768.0 * zoom;
+      P2D_XformInit(&m, &ref, (uint16_t) angle, arZoom[jj], 7, -3);
+      P2D_P_Transform(arSrc, arDst, 200, &m);
+      for(ii = 0; ii < 200; ii++) {
+        xr = c * (arSrc[ii].x - ref.x) - s * (arSrc[ii].y - ref.y) + ref.x + 7;
+        yr = s * (arSrc[ii].x - ref.x) + c * (arSrc[ii].y - ref.y) + ref.y - 3;
+        err = fmax(fabs(arDst[ii].x - xr), fabs(arDst[ii].y - yr));
+        if(err > errMax) errMax = err;
+      }
+    }
+  }
+  res |= Result("xform", errMax <= XFORM_ERR_MAX, "max error %.3f px, %.2f max", errMax, XFORM_ERR_MAX);
+
+  /*4 quarter turns around ref: back to the start; each one exact*/
+  memcpy(arDst, arSrc, sizeof(arDst));
+  for(jj = 0; jj < 4; jj++) {
+    P2D_P_RotateQ16(arDst, 200, &ref, 0x4000);
+    for(ii = 0; ii < 200 && jj == 0; ii++) {
+      if(arDst[ii].x != ref.x - (arSrc[ii].y - ref.y) || arDst[ii].y != ref.y + (arSrc[ii].x - ref.x)) bQuarter = false;
+    }
+  }
+  if(memcmp(arDst, arSrc, sizeof(arDst)) != 0) bQuarter = false;
+  res |= Result("xform", bQuarter, "quarter turns exact", 0, 0);
+
+  /*coord_t bounds, zoom 255%: no 32 bit wrap; a result out of the coord_t range is clamped*/
+  errMax = 0;
+  for(ii = 0; ii < 200; ii++) {
+    arSrc[ii].x = (ii & 1)? INT16_MAX: (ii & 2)? INT16_MIN: (coord_t) ((int32_t) Rnd() - 32768);
+    arSrc[ii].y = (ii & 4)? INT16_MAX: (ii & 8)? INT16_MIN: (coord_t) ((int32_t) Rnd() - 32768);
+  }
+  for(jj = 0; jj < 4; jj++) {
+    ref.x = (jj & 1)? 4096: -4096;
+    ref.y = (jj & 2)? 30000: -30000;
+    for(angle = 0; angle < 65536; angle += 1031) {
+      P2D_XformInit(&m, &ref, (uint16_t) angle, 255, 7, -3);
+      c = m.xx / 32768.0;   /*coefficients as quantized: the error of the coefficients grows with the distance*/
+      s = m.yx / 32768.0;
+      P2D_P_Transform(arSrc, arDst, 200, &m);
+      for(ii = 0; ii < 200; ii++) {
+        xr = fmin(fmax(c * (arSrc[ii].x - ref.x) - s * (arSrc[ii].y - ref.y) + ref.x + 7, INT16_MIN), INT16_MAX);
+        yr = fmin(fmax(s * (arSrc[ii].x - ref.x) + c * (arSrc[ii].y - ref.y) + ref.y - 3, INT16_MIN), INT16_MAX);
+        err = fmax(fabs(arDst[ii].x - xr), fabs(arDst[ii].y - yr));
+        if(err > errMax) errMax = err;
+      }
+    }
+  }
+  res |= Result("xform", errMax <= 0.5, "coord_t bounds, zoom 255%%: max error %.3f px, %.2f max", errMax, 0.5);
+  return res;
+}
+
+
+/**
+ * @function TestPoly
+ * @brief active edge table filler against the former one (kept below as RefFillPoly): random (self-intersecting)
+ *        polygons, rectangles & convex polygons, partly out of the screen, with random clips, shall give the same screen
+ */
+static int TestPoly(void) {
+  point_st ar[POLY_PTS_MAX];
+  rect_st clip;
+  uint32_t ii, bad = 0;
+  uint8_t nb;
+  color_t col;
+
+  for(ii = 0; ii < POLY_CASES; ii++) {
+    nb = (ii % 3 == 1)? 4: (uint8_t) (3 + Rnd() % (POLY_PTS_MAX - 2));
+    RandPoly(ar, nb, (uint8_t) (ii % 3));
+    RandClip(&clip);
+    col = (color_t) Rnd();
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColor(col);
+    RefFillPoly(ar, nb);
+    memcpy(arFb, lcdFb, sizeof(arFb));
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColor(col);
+    P2D_FillPoly(ar, nb);
+    if(memcmp(arFb, lcdFb, sizeof(arFb)) != 0) bad++;
+  }
+  return Result("poly", bad == 0, "%.0f random polygons, %.0f differ from the former filler", POLY_CASES, bad);
+}
+
+
+/**
+ * @function TestLine
+ * @brief run-slice rasterizer against the former Bresenham loop (kept below as RefLine): random lines of every slope,
+ *        up to 1000px out of the screen, solid & dotted, solid & transparent mode, random clips, shall give the same screen
+ */
+static int TestLine(void) {
+  coord_t ar[LINE_PER_SCREEN][4];
+  rect_st clip;
+  uint32_t ii, jj, kk, bad = 0;
+  color_t front, back;
+  bool bDot, bSolid;
+
+  for(ii = 0; ii < LINE_CASES / LINE_PER_SCREEN; ii++) {
+    for(jj = 0; jj < LINE_PER_SCREEN; jj++) {
+      for(kk = 0; kk < 4; kk++) {
+        /*mostly on the screen, some far out; some axis-aligned*/
+        ar[jj][kk] = (coord_t) ((Rnd() % 8 == 0)? (int32_t) (Rnd() % 2401) - 1000: (int32_t) (Rnd() % (LCD_FB_W + 40)) - 20);
+      }
+      if(Rnd() % 8 == 0) ar[jj][2] = ar[jj][0];
+      else if(Rnd() % 8 == 0) ar[jj][3] = ar[jj][1];
+    }
+    RandClip(&clip);
+    bDot = (ii & 1) != 0;
+    bSolid = (ii & 2) != 0;
+    front = (color_t) Rnd();
+    back = (color_t) Rnd();
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColors(front, back);
+    P2D_SetLineType(bDot? LINE_DOT: LINE_SOLID);
+    P2D_SetDisplayMode(bSolid? DISPLAY_SOLID: DISPLAY_TRANSPARENT);
+    for(jj = 0; jj < LINE_PER_SCREEN; jj++) RefLine(ar[jj][0], ar[jj][1], ar[jj][2], ar[jj][3], bDot, bSolid, front, back);
+    memcpy(arFb, lcdFb, sizeof(arFb));
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColors(front, back);
+    P2D_SetLineType(bDot? LINE_DOT: LINE_SOLID);
+    P2D_SetDisplayMode(bSolid? DISPLAY_SOLID: DISPLAY_TRANSPARENT);
+    for(jj = 0; jj < LINE_PER_SCREEN; jj++) P2D_Line(ar[jj][0], ar[jj][1], ar[jj][2], ar[jj][3]);
+    if(memcmp(arFb, lcdFb, sizeof(arFb)) != 0) bad++;
+  }
+  return Result("line", bad == 0, "%.0f random lines, %.0f screens differ from the former rasterizer", LINE_CASES, bad);
+}
+
+
+/**
+ * @function RefLine
+ * @brief former P2D_Line: solid horizontal & vertical lines as rectangles, the others pixel per pixel (Bresenham,
+ *        every pixel clipped); a dotted line alternates front & background (or nothing) from the first pixel
+ */
+static void RefLine(coord_t x0, coord_t y0, coord_t x1, coord_t y1, bool bDot, bool bSolid, color_t front, color_t back) {
+  coord_t dx, sx, dy, sy, err, e2;
+  rect_st rec;
+  bool bBlink = true;
+
+  if(bDot == false && (x0 == x1 || y0 == y1)) {
+    rec.x = (x0 < x1)? x0: x1;
+    rec.y = (y0 < y1)? y0: y1;
+    rec.w = (length_t) (((x0 < x1)? x1 - x0: x0 - x1) + 1);
+    rec.h = (length_t) (((y0 < y1)? y1 - y0: y0 - y1) + 1);
+    P2D_FillRect(&rec);
+  }
+  else {
+    dx = (x1 > x0)? x1 - x0: x0 - x1;
+    sx = x0 < x1 ? 1 : -1;
+    dy = (y1 > y0)? y1 - y0: y0 - y1;
+    sy = y0 < y1 ? 1 : -1;
+    err = (dx > dy ? dx : -dy) / 2;
+    while(1) {
+      if(bBlink) P2D_SetPixel(x0, y0, front);
+      else if(bSolid) P2D_SetPixel(x0, y0, back);
+      if(bDot) bBlink = !bBlink;
+      if(x0 == x1 && y0 == y1) break;
+      e2 = err;
+      if(e2 >-dx) { err -= dy; x0 += sx; }
+      if(e2 < dy) { err += dx; y0 += sy; }
+    }
+  }
+}
+
+
+/**
+ * @function RandPoly
+ * @brief random polygon, around the screen
+ * @param point_st *pts: output
+ * @param uint8_t nbPoint: number of points (4 for a rectangle)
+ * @param uint8_t kind: 0: random points, 1: rectangle, 2: convex polygon (points of an ellipse, by increasing angle)
+ */
+static void RandPoly(point_st *pts, uint8_t nbPoint, uint8_t kind) {
+  coord_t cx = (coord_t) (Rnd() % (LCD_FB_W + 80)) - 40, cy = (coord_t) (Rnd() % (LCD_FB_H + 80)) - 40;
+  coord_t rx = (coord_t) (1 + Rnd() % 150), ry = (coord_t) (1 + Rnd() % 150);
+  uint16_t arAngle[POLY_PTS_MAX], a;
+  uint8_t ii, jj;
+
+  if(kind == 0) {
+    for(ii = 0; ii < nbPoint; ii++) {
+      pts[ii].x = cx + (coord_t) (Rnd() % (2 * rx + 1)) - rx;
+      pts[ii].y = cy + (coord_t) (Rnd() % (2 * ry + 1)) - ry;
+    }
+  }
+  else if(kind == 1) {
+    pts[0].x = pts[3].x = cx - rx;
+    pts[1].x = pts[2].x = cx + rx;
+    pts[0].y = pts[1].y = cy - ry;
+    pts[2].y = pts[3].y = cy + ry;
+  }
+  else {
+    for(ii = 0; ii < nbPoint; ii++) {
+      a = (uint16_t) Rnd();
+      for(jj = ii; jj > 0 && arAngle[jj - 1] > a; jj--) arAngle[jj] = arAngle[jj - 1];
+      arAngle[jj] = a;
+    }
+    for(ii = 0; ii < nbPoint; ii++) {
+      pts[ii].x = cx + (coord_t) ((P2D_CosQ16(arAngle[ii]) * rx) / 32767);
+      pts[ii].y = cy + (coord_t) ((P2D_SinQ16(arAngle[ii]) * ry) / 32767);
+    }
+  }
+}
+
+
+/**
+ * @function TestCircle
+ * @brief span circles against the former mid-point loop (kept below as RefCircle): random outlined & filled circles,
+ *        partly or fully out of the clip, shall give the same screen; P2D_sqrt32 against floor(sqrt)
+ */
+static int TestCircle(void) {
+  coord_t ar[CIRCLE_PER_SCREEN][3];
+  rect_st clip;
+  uint32_t ii, jj, val, bad = 0, badSqrt = 0;
+  color_t col;
+  bool bFill;
+  int res;
+
+  for(ii = 0; ii < CIRCLE_CASES / CIRCLE_PER_SCREEN; ii++) {
+    for(jj = 0; jj < CIRCLE_PER_SCREEN; jj++) {
+      ar[jj][0] = (coord_t) ((int32_t) (Rnd() % (LCD_FB_W + 200)) - 100);
+      ar[jj][1] = (coord_t) ((int32_t) (Rnd() % (LCD_FB_H + 200)) - 100);
+      /*mostly small radii, some larger than the screen*/
+      ar[jj][2] = (coord_t) ((Rnd() % 4 == 0)? Rnd() % 400: Rnd() % 40);
+    }
+    RandClip(&clip);
+    bFill = (ii & 1) != 0;
+    col = (color_t) Rnd();
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColor(col);
+    for(jj = 0; jj < CIRCLE_PER_SCREEN; jj++) RefCircle(ar[jj][0], ar[jj][1], (length_t) ar[jj][2], bFill, col);
+    memcpy(arFb, lcdFb, sizeof(arFb));
+
+    SceneStart();
+    P2D_SetClip(&clip);
+    P2D_SetColor(col);
+    for(jj = 0; jj < CIRCLE_PER_SCREEN; jj++) {
+      if(bFill) P2D_FillCircle(ar[jj][0], ar[jj][1], (length_t) ar[jj][2]);
+      else P2D_Circle(ar[jj][0], ar[jj][1], (length_t) ar[jj][2]);
+    }
+    if(memcmp(arFb, lcdFb, sizeof(arFb)) != 0) bad++;
+  }
+  res = Result("circle", bad == 0, "%.0f random circles, %.0f screens differ from the former mid-point loop", CIRCLE_CASES, bad);
+
+  for(ii = 0; ii < SQRT_CASES; ii++) {
+    /*small values, perfect squares & their neighbours, any 32 bit value*/
+    if(ii < 70000) val = ii;
+    else if(ii < 200000) val = (Rnd() & 0xFFFF) * (Rnd() & 0xFFFF) + (uint32_t) (ii % 3) - 1;
+    else val = Rnd();
+    if(ii == SQRT_CASES - 1) val = 0xFFFFFFFFUL;
+    if(P2D_sqrt32(val) != (uint16_t) floor(sqrt((double) val))) badSqrt++;
+  }
+  res |= Result("sqrt32", badSqrt == 0, "%.0f values, %.0f differ from floor(sqrt)", SQRT_CASES, badSqrt);
+  return res;
+}
+
+
+/**
+ * @function RefCircle
+ * @brief former P2D_Circle & P2D_FillCircle: mid-point loop, 4 clipped pixels per step for the outline,
+ *        2 solid horizontal lines (rectangles) per step for the filled circle
+ */
+static void RefCircle(coord_t x0, coord_t y0, length_t radius, bool bFill, color_t col) {
+  coord_t x, y, err, r;
+  rect_st rec;
+
+  r = radius;
+  x = -r;
+  y = 0;
+  err = 2 - 2 * r;
+  do {
+    if(bFill) {
+      rec.x = x0 + x;
+      rec.w = (length_t) (1 - 2 * x);
+      rec.h = 1;
+      rec.y = y0 + y;
+      P2D_FillRect(&rec);
+      rec.y = y0 - y;
+      P2D_FillRect(&rec);
+    }
+    else {
+      P2D_SetPixel(x0 - x, y0 + y, col);
+      P2D_SetPixel(x0 - y, y0 - x, col);
+      P2D_SetPixel(x0 + x, y0 - y, col);
+      P2D_SetPixel(x0 + y, y0 + x, col);
+    }
+
+    r = err;
+    if(r <= y) {
+      y++;
+      err += y * 2 + 1;
+    }
+    if(r > x || err > y) {
+      x++;
+      err += x * 2 + 1;
+    }
+  } while(x < 0);
+}
+
+
+/**
+ * @function TestSpan
+ * @brief span calls (Put, PutN, PutRun, PutLut8Run, GetRun) with random windows & cursors, on a software surface &
+ *        on the LCD, against a model of the window (RefSpanPut, arFb): a run wraps at the right edge of the window to
+ *        the next line, then from the bottom line to the top one; GetRun reads back through the same cursor
+ */
+static int TestSpan(void) {
+  static color_t arSrc[2 * LCD_FB_W], arRead[LCD_FB_W * LCD_FB_H], arLut[256];
+  static uint8_t arIdx[2 * LCD_FB_W];
+  rect_st rec;
+  uint32_t ii, jj, n, bad = 0;
+  length_t w, h;
+  uint8_t pass;
+
+  for(ii = 0; ii < 256; ii++) arLut[ii] = (color_t) Rnd();
+
+  for(pass = 0; pass < 2; pass++) {
+    SceneStart();
+    if(pass == 0) {
+      rec.x = rec.y = 0;
+      rec.w = SPAN_W;
+      rec.h = SPAN_H;
+      if(P2D_SetDest(P2D_SurfaceCreate(&rec)) == SURFACE_LCD) bad++;
+      P2D_SetClip(NULL);
+    }
+    w = GetWidth();
+    h = GetHeight();
+
+    /*whole surface cleared through a window covering it*/
+    rec.x = rec.y = 0;
+    rec.w = w;
+    rec.h = h;
+    SetWnd(&rec);
+    PutN(0, (uint32_t) w * h);
+    memset(arFb, 0, sizeof(arFb));
+    refWx0 = refX = 0;
+    refWy0 = refY = 0;
+    refWx1 = (coord_t) w - 1;
+    refWy1 = (coord_t) h - 1;
+
+    for(ii = 0; ii < SPAN_OPS; ii++) {
+      n = 1 + Rnd() % (2 * (uint32_t) w);
+      switch(Rnd() % 8) {
+        case 0:
+          rec.x = (coord_t) (Rnd() % w);
+          rec.y = (coord_t) (Rnd() % h);
+          rec.w = (length_t) (1 + Rnd() % (w - rec.x));
+          rec.h = (length_t) (1 + Rnd() % (h - rec.y));
+          SetWnd(&rec);
+          refWx0 = refX = rec.x;
+          refWy0 = refY = rec.y;
+          refWx1 = rec.x + rec.w - 1;
+          refWy1 = rec.y + rec.h - 1;
+          break;
+        case 1:
+          refX = refWx0 + (coord_t) (Rnd() % (uint32_t) (refWx1 - refWx0 + 1));
+          refY = refWy0 + (coord_t) (Rnd() % (uint32_t) (refWy1 - refWy0 + 1));
+          SetPos(refX, refY);
+          break;
+        case 2:
+          arSrc[0] = (color_t) Rnd();
+          Put(arSrc[0]);
+          RefSpanPut(arSrc[0]);
+          break;
+        case 3:
+          arSrc[0] = (color_t) Rnd();
+          PutN(arSrc[0], n);
+          for(jj = 0; jj < n; jj++) RefSpanPut(arSrc[0]);
+          break;
+        case 4:
+          for(jj = 0; jj < n; jj++) arSrc[jj] = (color_t) Rnd();
+          PutRun(arSrc, n);
+          for(jj = 0; jj < n; jj++) RefSpanPut(arSrc[jj]);
+          break;
+        case 5:
+          for(jj = 0; jj < n; jj++) arIdx[jj] = (uint8_t) Rnd();
+          PutLut8Run(arIdx, arLut, n);
+          for(jj = 0; jj < n; jj++) RefSpanPut(arLut[arIdx[jj]]);
+          break;
+        default:
+          /*read back: the model cursor moves as after a Put of the same pixels*/
+          GetRun(arRead, n);
+          for(jj = 0; jj < n; jj++) {
+            if(arRead[jj] != arFb[refY * LCD_FB_W + refX]) bad++;
+            RefSpanPut(arFb[refY * LCD_FB_W + refX]);
+          }
+          break;
+      }
+    }
+
+    /*whole surface read back*/
+    rec.x = rec.y = 0;
+    rec.w = w;
+    rec.h = h;
+    SetWnd(&rec);
+    GetRun(arRead, (uint32_t) w * h);
+    for(ii = 0; ii < (uint32_t) w * h; ii++) {
+      if(arRead[ii] != arFb[(ii / w) * LCD_FB_W + ii % w]) bad++;
+    }
+  }
+  return Result("span", bad == 0, "%.0f random span calls on a software surface & on the LCD, %.0f pixels differ from"
+    " the window model", 2 * SPAN_OPS, bad);
+}
+
+
+/**
+ * @function RefSpanPut
+ * @brief model of a pixel put through the window: write at the cursor (arFb, LCD_FB_W pixels per line), then move it
+ *        right; past the right edge of the window, to the start of the next line; past the bottom, to the top line
+ */
+static void RefSpanPut(color_t col) {
+  arFb[refY * LCD_FB_W + refX] = col;
+  if(++refX > refWx1) {
+    refX = refWx0;
+    if(++refY > refWy1) refY = refWy0;
+  }
+}
+
+
+/**
+ * @function TestCopy
+ * @brief P2D_CopySurface against a pixel per pixel model: random source surface & part (partly out of the surface, or
+ *        whole lines for the PutRun of whole surface lines), copied at a random place of the LCD or of another software
+ *        surface with a random clip; the part of the source within its surface goes to dst, its pixels within the
+ *        clip are copied, the others are kept
+ */
+static int TestCopy(void) {
+  static color_t arSrc[COPY_SRC_MAX * COPY_SRC_MAX], arRead[LCD_FB_W * LCD_FB_H];
+  rect_st rec, src, dst, clip;
+  surfaceId_t idSrc, idDst;
+  length_t sw, sh, dw, dh;
+  coord_t sx0, sy0, sx1, sy1, x, y, dx, dy;
+  uint32_t ii, jj, bad = 0;
+
+  for(ii = 0; ii < COPY_CASES; ii++) {
+    SceneStart();
+
+    /*source, random content*/
+    rec.x = rec.y = 0;
+    rec.w = sw = (length_t) (1 + Rnd() % COPY_SRC_MAX);
+    rec.h = sh = (length_t) (1 + Rnd() % COPY_SRC_MAX);
+    idSrc = P2D_SurfaceCreate(&rec);
+    (void) P2D_SetDest(idSrc);
+    P2D_SetClip(NULL);
+    SetWnd(&rec);
+    for(jj = 0; jj < (uint32_t) sw * sh; jj++) arSrc[jj] = (color_t) Rnd();
+    PutRun(arSrc, (uint32_t) sw * sh);
+
+    /*destination: LCD, or software surface; its content is the expected one before the copy (arFb, dw pixels per line)*/
+    if(ii % 2 == 0) {
+      idDst = SURFACE_LCD;
+      dw = LCD_FB_W;
+      dh = LCD_FB_H;
+    }
+    else {
+      rec.w = dw = COPY_DST_W;
+      rec.h = dh = COPY_DST_H;
+      idDst = P2D_SurfaceCreate(&rec);
+    }
+    (void) P2D_SetDest(idDst);
+    P2D_SetClip(NULL);
+    rec.w = dw;
+    rec.h = dh;
+    SetWnd(&rec);
+    GetRun(arFb, (uint32_t) dw * dh);
+
+    if(Rnd() % 4 == 0) {
+      clip = rec;
+    }
+    else {
+      clip.x = (coord_t) (Rnd() % dw);
+      clip.y = (coord_t) (Rnd() % dh);
+      clip.w = (length_t) (1 + Rnd() % (dw - clip.x));
+      clip.h = (length_t) (1 + Rnd() % (dh - clip.y));
+    }
+    if(ii % 4 < 2) {
+      src.x = 0;
+      src.w = sw;
+    }
+    else {
+      src.x = (coord_t) ((int32_t) (Rnd() % (sw + 20)) - 10);
+      src.w = (length_t) (1 + Rnd() % (sw + 10));
+    }
+    src.y = (coord_t) ((int32_t) (Rnd() % (sh + 20)) - 10);
+    src.h = (length_t) (1 + Rnd() % (sh + 10));
+    dst.x = (coord_t) ((int32_t) (Rnd() % (dw + 2 * COPY_SRC_MAX)) - COPY_SRC_MAX);
+    dst.y = (coord_t) ((int32_t) (Rnd() % (dh + 2 * COPY_SRC_MAX)) - COPY_SRC_MAX);
+    dst.w = dst.h = 0;
+
+    /*model*/
+    sx0 = (src.x < 0)? 0: src.x;
+    sy0 = (src.y < 0)? 0: src.y;
+    sx1 = src.x + (coord_t) src.w - 1;
+    sy1 = src.y + (coord_t) src.h - 1;
+    if(sx1 > (coord_t) sw - 1) sx1 = (coord_t) sw - 1;
+    if(sy1 > (coord_t) sh - 1) sy1 = (coord_t) sh - 1;
+    for(dy = 0; sy0 + dy <= sy1; dy++) {
+      for(dx = 0; sx0 + dx <= sx1; dx++) {
+        x = dst.x + dx;
+        y = dst.y + dy;
+        if(x >= clip.x && x < clip.x + (coord_t) clip.w && y >= clip.y && y < clip.y + (coord_t) clip.h) {
+          arFb[y * dw + x] = arSrc[(sy0 + dy) * sw + sx0 + dx];
+        }
+      }
+    }
+
+    P2D_SetClip(&clip);
+    P2D_CopySurface(idSrc, &src, &dst);
+
+    P2D_SetClip(NULL);
+    SetWnd(&rec);
+    GetRun(arRead, (uint32_t) dw * dh);
+    if(memcmp(arRead, arFb, (uint32_t) dw * dh * sizeof(color_t)) != 0) bad++;
+  }
+  return Result("copy", bad == 0, "%.0f random surface copies, %.0f differ from the pixel per pixel model", COPY_CASES,
+    bad);
+}
+
+
+/**
+ * @function TestDlist
+ * @brief display list against direct drawing: random commands (fills, alpha fills, lines, circles, text, sprites) with
+ *        random state & clip changes, drawn directly then recorded & replayed, shall give the same screen; every 4th
+ *        screen records more commands than the arena holds (replays on a full arena), the others also access the
+ *        surface directly while recording (replays before the access)
+ */
+static int TestDlist(void) {
+  dlist_stat_st stat;
+  uint32_t ii, nb, flush, seed, bad = 0, full = 0;
+  bool bFull;
+
+  P2D_ListResetStat();
+  for(ii = 0; ii < DLIST_SCREENS; ii++) {
+    bFull = (ii % 4) == 0;
+    nb = bFull? DLIST_CMD_FULL: 1 + Rnd() % DLIST_CMD_MAX;
+
+    /*same random commands for both screens*/
+    seed = rndState;
+    SceneStart();
+    DlistDraw(nb, !bFull);
+    memcpy(arFb, lcdFb, sizeof(arFb));
+
+    rndState = seed;
+    SceneStart();
+    P2D_ListGetStat(&stat);
+    flush = stat.flush;
+    (void) P2D_ListBegin();
+    DlistDraw(nb, !bFull);
+    P2D_ListEnd();
+    P2D_ListGetStat(&stat);
+    if(bFull && stat.flush > flush + 1) full++;
+    if(memcmp(arFb, lcdFb, sizeof(arFb)) != 0) bad++;
+  }
+  P2D_ListGetStat(&stat);
+  return Result("dlist", bad == 0, "%.0f random screens, %.0f differ when drawn through"
+    " the display list", DLIST_SCREENS, bad) |
+    Result("dlist", full > 0 && stat.culled > 0, "arena full on %.0f screens, %.0f commands culled", full, stat.culled);
+}
+
+
+/**
+ * @function DlistDraw
+ * @brief random commands of TestDlist
+ * @param uint32_t nbCmd: number of commands
+ * @param bool bDirect: true: also direct accesses to the surface (not recorded lines, polygons)
+ */
+static void DlistDraw(uint32_t nbCmd, bool bDirect) {
+  static const char *arStr[] = {"Ag", "The quick brown fox 0123456789", "12.345",
+    "A text longer than a record of the display list: it is drawn at once, after a replay of the commands before it,"
+    " so that the order of the screen is kept"};
+  rect_st rec, src;
+  point_st arPt[4];
+  uint32_t ii, jj;
+
+  P2D_InitLut8BPP(&lutLogo, sprite_logo_lut, LUT_E_COPY);
+  P2D_InitLut8BPP(&lutRbutton, sprite_rbutton_lut, LUT_E_COPY);
+
+  for(ii = 0; ii < nbCmd; ii++) {
+    rec.x = (coord_t) ((int32_t) (Rnd() % (LCD_FB_W + 40)) - 20);
+    rec.y = (coord_t) ((int32_t) (Rnd() % (LCD_FB_H + 40)) - 20);
+    rec.w = (length_t) ((Rnd() % 8 == 0)? LCD_FB_W: Rnd() % 80);
+    rec.h = (length_t) ((Rnd() % 8 == 0)? LCD_FB_H: Rnd() % 80);
+
+    switch(Rnd() % 16) {
+      case 0:
+        RandClip(&rec);
+        P2D_SetClip((Rnd() % 4 == 0)? NULL: &rec);
+        break;
+      case 1:
+        P2D_SetColors((color_t) Rnd(), (color_t) Rnd());
+        break;
+      case 2:
+        P2D_SetDisplayMode((Rnd() % 2 == 0)? DISPLAY_SOLID: DISPLAY_TRANSPARENT);
+        P2D_SetLineType((Rnd() % 2 == 0)? LINE_SOLID: LINE_DOT);
+        break;
+      case 3:
+        P2D_SetAlpha((uint8_t) Rnd());
+        break;
+      case 4:
+        jj = Rnd() % 3;
+        P2D_SetFont((jj == 0)? FontMedium: (jj == 1)? FontFreeSerif_4bpp_n_16: FontBig);
+        break;
+      case 5:
+      case 6:
+        P2D_FillRect(&rec);
+        break;
+      case 7:
+        P2D_FillRectAlpha(&rec);
+        break;
+      case 8:
+        P2D_Gline(rec.x, rec.y, rec.x + (coord_t) rec.w - 40, rec.y + (coord_t) rec.h - 40);
+        break;
+      case 9:
+        if(Rnd() % 2 == 0) P2D_Circle(rec.x, rec.y, rec.w);
+        else P2D_FillCircle(rec.x, rec.y, rec.w);
+        break;
+      case 10:
+      case 11:
+        P2D_PutText(rec.x, rec.y, arStr[Rnd() % (sizeof(arStr) / sizeof(arStr[0]))]);
+        break;
+      case 12:
+        P2D_SpriteSetLut8BPP(&lutLogo);
+        P2D_Sprite(NULL, &rec, sprite_logo);
+        break;
+      case 13:
+        P2D_SpriteSetLut8BPP(&lutRbutton);
+        src.x = 0;
+        src.y = (coord_t) (102 * (Rnd() % 12));
+        src.w = src.h = 102;
+        P2D_Sprite(&src, &rec, sprite_rbutton);
+        break;
+      default:
+        if(bDirect && Rnd() % 2 == 0) P2D_Line(rec.x, rec.y, rec.x + (coord_t) rec.w, rec.y - 30);
+        else if(bDirect) {
+          for(jj = 0; jj < 4; jj++) {
+            arPt[jj].x = rec.x + (coord_t) (Rnd() % 60);
+            arPt[jj].y = rec.y + (coord_t) (Rnd() % 60);
+          }
+          P2D_FillPoly(arPt, 4);
+        }
+        break;
+    }
+  }
+}
+
+
+/**
+ * @function RandClip
+ * @brief random clip rectangle within the screen; the whole screen once out of 4
+ */
+static void RandClip(rect_st *clip) {
+  if(Rnd() % 4 == 0) {
+    clip->x = clip->y = 0;
+    clip->w = LCD_FB_W;
+    clip->h = LCD_FB_H;
+  }
+  else {
+    clip->x = (coord_t) (Rnd() % LCD_FB_W);
+    clip->y = (coord_t) (Rnd() % LCD_FB_H);
+    clip->w = (length_t) (1 + Rnd() % (LCD_FB_W - clip->x));
+    clip->h = (length_t) (1 + Rnd() % (LCD_FB_H - clip->y));
+  }
+}
+
+
+/**
+ * @function RefFillPoly
+ * @brief former P2D_FillPoly: all edges intersected on every line (offset from pts[p1] truncated toward 0), at most
+ *        REF_INTER_MAX intersections per line, spans & outline through P2D_Line
+ */
+static void RefFillPoly(const point_st *pts, uint8_t nbPoint) {
+  coord_t y, yMin, yMax, x1, y1, x2, y2, tmp, xList[REF_INTER_MAX];
+  uint8_t ii, p1, p2, nbInter;
+
+  yMin = yMax = pts[0].y;
+  for(ii = 1; ii < nbPoint; ii++) {
+    if(pts[ii].y < yMin) yMin = pts[ii].y;
+    if(pts[ii].y > yMax) yMax = pts[ii].y;
+  }
+
+  for(y = yMin; y <= yMax; y++) {
+    nbInter = 0;
+    p2 = nbPoint - 1;
+    for(p1 = 0; p1 < nbPoint && nbInter < REF_INTER_MAX; p1++) {
+      y1 = pts[p1].y;
+      y2 = pts[p2].y;
+      if((y1 < y && y2 >= y) || (y2 < y && y1 >= y)) {
+        x1 = pts[p1].x;
+        x2 = pts[p2].x;
+        xList[nbInter++] = x1 + (y - y1) * (x2 - x1) / (y2 - y1);
+      }
+      p2 = p1;
+    }
+
+    /*gnome sort, as the former SortIntersection*/
+    ii = 0;
+    while(nbInter >= 2 && ii < nbInter - 1) {
+      if(xList[ii] > xList[ii + 1]) {
+        tmp = xList[ii];
+        xList[ii] = xList[ii + 1];
+        xList[ii + 1] = tmp;
+        if(ii > 0) ii--;
+      }
+      else {
+        ii++;
+      }
+    }
+    for(ii = 0; ii + 1 < nbInter; ii += 2) P2D_Line(xList[ii], y, xList[ii + 1], y);
+  }
+  P2D_Poly(pts, nbPoint);
+}
+
+
+/**
+ * @function Q16Err
+ * @brief absolute error of a Q16 angle, the reference being in Q16 LSB (any turn)
+ */
+static double Q16Err(uint16_t angle, double ref) {
+  double err = fmod(angle - ref, 65536.0);
+  if(err < -32768) err += 65536;
+  else if(err > 32768) err -= 65536;
+  return fabs(err);
+}
+
+
+/**
+ * @function BlendErr
+ * @brief max error of a blended color over its 3 channels, in LSB of each channel; the signed errors are summed
+ */
+static double BlendErr(color_t c, color_t a, color_t b, uint8_t alpha, double *pSum) {
+  const uint8_t arShift[3] = {11, 5, 0}, arMask[3] = {31, 63, 31};
+  double ref, err, errMax = 0;
+  uint8_t ii;
+
+  for(ii = 0; ii < 3; ii++) {
+    ref = (alpha * ((a >> arShift[ii]) & arMask[ii]) + (255 - alpha) * ((b >> arShift[ii]) & arMask[ii])) / 255.0;
+    err = ((c >> arShift[ii]) & arMask[ii]) - ref;
+    *pSum += err;
+    if(fabs(err) > errMax) errMax = fabs(err);
+  }
+  return errMax;
+}
+
+
+/**
+ * @function Rnd
+ * @brief deterministic pseudo random numbers (LCG), 16 bits
+ */
+static uint32_t Rnd(void) {
+  rndState = rndState * 1103515245u + 12345u;
+  return (rndState >> 8) & 0xFFFF;
+}
+
+
+/**
+ * @function Result
+ * @brief print a check result
+ * @return int: 0 -> ok, 1 -> failure
+ */
+static int Result(const char *name, bool bOk, const char *fmt, double a, double b) {
+  printf("%-10s %s ", name, bOk ? "ok  " : "FAIL");
+  printf(fmt, a, b);
+  printf("\n");
+  return bOk ? 0 : 1;
+}
+
+
+static double Now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
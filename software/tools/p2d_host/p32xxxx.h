@@ -0,0 +1,4 @@
+/**
+ * @file p32xxxx.h
+ * @brief host build of P2D (p2d_host): stands for the PIC32 device header, which P2D does not use
+ */
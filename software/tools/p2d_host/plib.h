@@ -0,0 +1,4 @@
+/**
+ * @file plib.h
+ * @brief host build of P2D (p2d_host): stands for the PIC32 peripheral library, which P2D does not use
+ */
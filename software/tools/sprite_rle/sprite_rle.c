@@ -0,0 +1,372 @@
+/**
+ * @file sprite_rle.c
+ * @brief host tool: converts 8BPP sprite resources (.c files) into the run-length encoded sprite format of p2d_sprite.c
+ * @author Duboisset Philippe
+ * @version 0.1b
+ * @date (yyyy-mm-dd) 2014-06-01
+ *
+ * Copyright (C) <2014>  Duboisset Philippe <duboisset.philippe@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * usage: sprite_rle <sprite_file.c> [<sprite_file.c> ...]
+ *
+ * The last array of each file is the sprite (the first one being its lut); it is rewritten in place,
+ * run-length encoded. Files already encoded are decoded then encoded again, so the tool can be run
+ * at every build: a file is only written if its content changes.
+ *
+ * Encoded sprite:
+ *  0x88, w (MSB, LSB), h (MSB, LSB)
+ *  row index: (h + 15) / 16 offsets (24 bits, MSB first) of rows #0, #16, #32... from the first run
+ *  runs: one control byte [TT LLLLLL], length = L + 1 pixels; a run never crosses a row
+ *    TT = 00: transparent run (index 0)
+ *    TT = 01: fill run, followed by the index
+ *    TT = 10: literal run, followed by <length> indexes
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+
+#define BPP_8           8
+#define BPP_RLE8        0x88
+#define RLE_INDEX_ROWS  16
+#define RLE_RUN_MAX     64
+#define RLE_TRANSPARENT 0x00
+#define RLE_FILL        0x40
+#define RLE_LITERAL     0x80
+#define BYTES_PER_LINE  20
+
+
+/**
+ * @function LoadFile
+ * @brief load a whole text file
+ * @param const char *path: file path
+ * @param size_t *len: output length
+ * @return char*: file content (zero terminated), NULL if error
+ */
+static char *LoadFile(const char *path, size_t *len) {
+
+  FILE *f;
+  char *buf = NULL;
+  long size;
+
+  f = fopen(path, "rb");
+  if(f != NULL) {
+    if(fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 && fseek(f, 0, SEEK_SET) == 0) {
+      buf = malloc((size_t) size + 1);
+      if(buf != NULL) {
+        if(fread(buf, 1, (size_t) size, f) == (size_t) size) {
+          buf[size] = 0;
+          *len = (size_t) size;
+        }
+        else {
+          free(buf);
+          buf = NULL;
+        }
+      }
+    }
+    fclose(f);
+  }
+
+  return buf;
+}
+
+
+/**
+ * @function ParseArray
+ * @brief read the numbers of a C array initializer, comments skipped
+ * @param const char *p: first char after the '{'
+ * @param uint8_t *out: output bytes
+ * @param size_t max: size of out
+ * @param size_t *cnt: number of bytes read
+ * @return const char*: pointer to the closing '}', NULL if error
+ */
+static const char *ParseArray(const char *p, uint8_t *out, size_t max, size_t *cnt) {
+
+  char *end;
+  unsigned long val;
+
+  *cnt = 0;
+  while(*p != 0 && *p != '}') {
+    if(p[0] == '/' && p[1] == '*') {
+      p = strstr(p + 2, "*/");
+      if(p == NULL) break;
+      p += 2;
+    }
+    else if(p[0] == '/' && p[1] == '/') {
+      while(*p != 0 && *p != '\n') p++;
+    }
+    else if(isdigit((unsigned char) *p)) {
+      val = strtoul(p, &end, 0);
+      if(val > 0xFF || *cnt >= max) return NULL;
+      out[(*cnt)++] = (uint8_t) val;
+      p = end;
+    }
+    else {
+      p++;
+    }
+  }
+
+  return (*p == '}') ? p : NULL;
+}
+
+
+/**
+ * @function RleDecode
+ * @brief expand an encoded sprite into raw indexes
+ * @param const uint8_t *spr: encoded sprite (header included)
+ * @param size_t len: encoded sprite length
+ * @param uint8_t *raw: output indexes (w * h)
+ * @return int: 0 success, -1 error
+ */
+static int RleDecode(const uint8_t *spr, size_t len, uint8_t *raw) {
+
+  uint32_t w, h, x, y, n, i;
+  size_t pos;
+  uint8_t ctrl;
+
+  w = ((uint32_t) spr[1] << 8) + spr[2];
+  h = ((uint32_t) spr[3] << 8) + spr[4];
+  pos = 5 + 3 * ((h + RLE_INDEX_ROWS - 1) / RLE_INDEX_ROWS);
+
+  for(y = 0; y < h; y++) {
+    for(x = 0; x < w; x += n) {
+      if(pos >= len) return -1;
+      ctrl = spr[pos++];
+      n = (ctrl & 0x3Fu) + 1;
+      if(x + n > w) return -1;
+      for(i = 0; i < n; i++) {
+        if((ctrl & 0xC0) == RLE_TRANSPARENT) raw[y * w + x + i] = 0;
+        else if((ctrl & 0xC0) == RLE_FILL) raw[y * w + x + i] = spr[pos];
+        else if((ctrl & 0xC0) == RLE_LITERAL) raw[y * w + x + i] = spr[pos + i];
+        else return -1;
+      }
+      if((ctrl & 0xC0) == RLE_FILL) pos++;
+      else if((ctrl & 0xC0) == RLE_LITERAL) pos += n;
+      else { /*nothing to skip*/ }
+    }
+  }
+
+  return 0;
+}
+
+
+/**
+ * @function RleEncodeRow
+ * @brief encode one row of indexes
+ * @param const uint8_t *row: indexes
+ * @param uint32_t w: row width
+ * @param uint8_t *out: output runs
+ * @return size_t: number of bytes written
+ */
+static size_t RleEncodeRow(const uint8_t *row, uint32_t w, uint8_t *out) {
+
+  size_t len = 0;
+  uint32_t x = 0, rep, lit;
+
+  while(x < w) {
+
+    /*length of the repetition starting at x*/
+    rep = 1;
+    while(x + rep < w && rep < RLE_RUN_MAX && row[x + rep] == row[x]) rep++;
+
+    if(row[x] == 0) {
+      out[len++] = (uint8_t) (RLE_TRANSPARENT | (rep - 1));
+      x += rep;
+    }
+    else if(rep >= 3) {
+      out[len++] = (uint8_t) (RLE_FILL | (rep - 1));
+      out[len++] = row[x];
+      x += rep;
+    }
+    else {
+      /*literal: up to the next transparent pixel or the next repetition of 3+ indexes*/
+      lit = 0;
+      while(x + lit < w && lit < RLE_RUN_MAX && row[x + lit] != 0) {
+        if(x + lit + 2 < w && row[x + lit] == row[x + lit + 1] && row[x + lit] == row[x + lit + 2]) break;
+        lit++;
+      }
+      if(lit == 0) lit = 1;
+      out[len++] = (uint8_t) (RLE_LITERAL | (lit - 1));
+      memcpy(&out[len], &row[x], lit);
+      len += lit;
+      x += lit;
+    }
+  }
+
+  return len;
+}
+
+
+/**
+ * @function WriteBytes
+ * @brief print a byte list, BYTES_PER_LINE per line
+ * @param FILE *f: output
+ * @param const uint8_t *p: bytes
+ * @param size_t n: number of bytes
+ * @param int bLast: no trailing ',' after the last byte
+ * @return none
+ */
+static void WriteBytes(FILE *f, const uint8_t *p, size_t n, int bLast) {
+  size_t i;
+  for(i = 0; i < n; i++) {
+    if(i % BYTES_PER_LINE == 0) fprintf(f, "  ");
+    fprintf(f, "0x%02X", p[i]);
+    if(i + 1 < n || bLast == 0) fprintf(f, ", ");
+    if(i % BYTES_PER_LINE == BYTES_PER_LINE - 1 || i + 1 == n) fprintf(f, "\n");
+  }
+}
+
+
+/**
+ * @function ConvertFile
+ * @brief encode the sprite contained in a resource file
+ * @param const char *path: resource file
+ * @return int: 0 success, -1 error
+ */
+static int ConvertFile(const char *path) {
+
+  char *src, *start, *body, *out = NULL;
+  const char *end;
+  uint8_t *spr, *raw, *runs, *index;
+  size_t srcLen, sprLen, runLen, outLen = 0, rawLen;
+  uint32_t w, h, y, idxCnt;
+  FILE *f;
+  int res = -1;
+
+  src = LoadFile(path, &srcLen);
+  spr = (src != NULL) ? malloc(srcLen + 1) : NULL;
+  if(spr == NULL) {
+    fprintf(stderr, "%s: cannot read\n", path);
+    free(src);
+    return -1;
+  }
+
+  /*the sprite is the last array of the file*/
+  start = NULL;
+  for(body = strstr(src, "const uint8_t"); body != NULL; body = strstr(body + 1, "const uint8_t")) start = body;
+  body = (start != NULL) ? strchr(start, '{') : NULL;
+  end = (body != NULL) ? ParseArray(body + 1, spr, srcLen, &sprLen) : NULL;
+
+  if(end == NULL || sprLen < 5 || (spr[0] != BPP_8 && spr[0] != BPP_RLE8)) {
+    fprintf(stderr, "%s: no 8BPP sprite found\n", path);
+  }
+  else {
+    w = ((uint32_t) spr[1] << 8) + spr[2];
+    h = ((uint32_t) spr[3] << 8) + spr[4];
+    rawLen = (size_t) w * h;
+    idxCnt = (h + RLE_INDEX_ROWS - 1) / RLE_INDEX_ROWS;
+    raw = malloc(rawLen + 1);
+    runs = malloc(rawLen * 2 + 1);
+    index = malloc(idxCnt * 3 + 1);
+    out = malloc(srcLen + rawLen * 16 + 1024);
+
+    if(raw != NULL && runs != NULL && index != NULL && out != NULL) {
+
+      /*get the raw indexes*/
+      if(spr[0] == BPP_8 && sprLen == rawLen + 5) {
+        memcpy(raw, &spr[5], rawLen);
+        res = 0;
+      }
+      else if(spr[0] == BPP_RLE8) {
+        res = RleDecode(spr, sprLen, raw);
+      }
+      else {
+        fprintf(stderr, "%s: raw size mismatch\n", path);
+      }
+
+      if(res == 0) {
+
+        /*encode, row per row*/
+        runLen = 0;
+        for(y = 0; y < h; y++) {
+          if(y % RLE_INDEX_ROWS == 0) {
+            index[3 * (y / RLE_INDEX_ROWS) + 0] = (uint8_t) (runLen >> 16);
+            index[3 * (y / RLE_INDEX_ROWS) + 1] = (uint8_t) (runLen >> 8);
+            index[3 * (y / RLE_INDEX_ROWS) + 2] = (uint8_t) runLen;
+          }
+          runLen += RleEncodeRow(&raw[y * w], w, &runs[runLen]);
+        }
+
+        if(runLen > 0xFFFFFFu) {
+          fprintf(stderr, "%s: sprite too large\n", path);
+          res = -1;
+        }
+      }
+
+      /*rewrite the sprite array, the rest of the file is kept*/
+      if(res == 0) {
+        f = tmpfile();
+        if(f != NULL) {
+          fwrite(src, 1, (size_t) (body + 1 - src), f);
+          fprintf(f, "\n\n  0x%02X, /*bpp: 8BPP, run-length encoded*/\n", BPP_RLE8);
+          fprintf(f, "  0x%02X, 0x%02X, /*width*/\n", spr[1], spr[2]);
+          fprintf(f, "  0x%02X, 0x%02X, /*height*/\n\n", spr[3], spr[4]);
+          fprintf(f, "  /*Row index*/\n");
+          WriteBytes(f, index, idxCnt * 3, 0);
+          fprintf(f, "\n  /*Sprite runs*/\n");
+          WriteBytes(f, runs, runLen, 1);
+          fputs(end, f);
+          outLen = (size_t) ftell(f);
+          rewind(f);
+          if(fread(out, 1, outLen, f) != outLen) res = -1;
+          fclose(f);
+        }
+        else {
+          res = -1;
+        }
+      }
+
+      /*write only if changed*/
+      if(res == 0 && (outLen != srcLen || memcmp(out, src, srcLen) != 0)) {
+        f = fopen(path, "wb");
+        if(f != NULL && fwrite(out, 1, outLen, f) == outLen) {
+          printf("%s: %ux%u, %lu -> %lu bytes\n", path, w, h, (unsigned long) rawLen + 5, (unsigned long) (5 + idxCnt * 3 + runLen));
+        }
+        else {
+          fprintf(stderr, "%s: cannot write\n", path);
+          res = -1;
+        }
+        if(f != NULL) fclose(f);
+      }
+    }
+
+    free(raw);
+    free(runs);
+    free(index);
+  }
+
+  free(out);
+  free(spr);
+  free(src);
+  return res;
+}
+
+
+int main(int argc, char **argv) {
+
+  int i, res = 0;
+
+  if(argc < 2) {
+    fprintf(stderr, "usage: %s <sprite_file.c> [<sprite_file.c> ...]\n", argv[0]);
+    res = 1;
+  }
+
+  for(i = 1; i < argc; i++) {
+    if(ConvertFile(argv[i]) != 0) res = 1;
+  }
+
+  return res;
+}